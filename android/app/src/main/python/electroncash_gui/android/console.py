@@ -5,7 +5,6 @@ from code import InteractiveConsole
 import os
 from os.path import dirname, exists, join, split
 import pkgutil
-from shutil import copyfile
 from time import time
 
 from electroncash import commands, daemon, interface, keystore, storage, util
@@ -200,11 +199,11 @@ class AndroidCommands(commands.Commands):
     def list_wallets(self):
         """List available wallets"""
         return sorted([name for name in os.listdir(self._wallet_path())
-                       if not name.endswith(storage.TMP_SUFFIX)])
+                       if storage.is_wallet_file_name(name)])
 
     def delete_wallet(self, name=None):
         """Delete a wallet"""
-        os.remove(self._wallet_path(name))
+        storage.delete_wallet_file(self._wallet_path(name))
 
     def rename_wallet(self, name, new_name):
         if name == new_name:
@@ -219,7 +218,7 @@ class AndroidCommands(commands.Commands):
             # We are renaming the currently loaded wallet. Close it before renaming it.
             self.close_wallet(name)
             self.select_wallet(None)
-        os.rename(original_path, new_path)
+        storage.rename_wallet_file(original_path, new_path)
 
     def copy_wallet(self, name, destination_path, overwrite=True, create_dir=True):
         original_path = self._wallet_path(name)
@@ -234,7 +233,7 @@ class AndroidCommands(commands.Commands):
         if not overwrite:
             if exists(destination_path):
                 raise FileExistsError(destination_path)
-        copyfile(original_path, destination_path)
+        storage.copy_wallet_file(original_path, destination_path)
 
     def unit_test(self):
         """Run all unit tests. Expect failures with functionality not present on Android,
@@ -29,6 +29,7 @@ from collections import namedtuple
 from typing import Union
 
 from . import cashaddr, networks
+from .caches import ExpiringCache
 from .bitcoin import EC_KEY, is_minikey, minikey_to_private_key, SCRIPT_TYPES, OpCodes, push_script_bytes, ripemd160
 from .util import cachedproperty, inv_dict
 
@@ -304,6 +305,11 @@ class ScriptOutput(namedtuple("ScriptAddressTuple", "script")):
     #
     protocol_classes = set()
 
+    # protocol_classes that define a 6 byte `_protocol_prefix` (OP_RETURN,
+    # push of 4, lokad id) by that prefix, plus those that don't, rebuilt
+    # whenever protocol_classes changes. See find_protocol_class.
+    _protocol_dispatch = (frozenset(), {}, ())
+
     def make_complete(self, block_height=None, block_hash=None, txid=None):
         ''' Subclasses implement this, noop here. '''
         pass
@@ -315,12 +321,36 @@ class ScriptOutput(namedtuple("ScriptAddressTuple", "script")):
     @classmethod
     def find_protocol_class(cls, script_bytes):
         ''' Scans the protocol_classes set, and if the passed-in script matches
-        a known protocol, returns that class, otherwise returns our class. '''
-        for c in cls.protocol_classes:
+        a known protocol, returns that class, otherwise returns our class.
+
+        This runs on every script output of every transaction deserialized,
+        so instead of asking each class in turn, the first 6 bytes of an
+        OP_RETURN script are looked up among the prefixes of the classes, and
+        only the protocol_match of the class(es) with that prefix is called. '''
+        classes, by_prefix, others = __class__._protocol_dispatch
+        if classes != __class__.protocol_classes:
+            classes, by_prefix, others = __class__._protocol_dispatch = __class__._build_protocol_dispatch()
+        if by_prefix and script_bytes and script_bytes[0] == OpCodes.OP_RETURN:
+            for c in by_prefix.get(bytes(script_bytes[:6]), ()):
+                if c.protocol_match(script_bytes):
+                    return c
+        for c in others:
             if c.protocol_match(script_bytes):
                 return c
         return __class__
 
+    @staticmethod
+    def _build_protocol_dispatch():
+        classes = frozenset(__class__.protocol_classes)
+        by_prefix, others = {}, []
+        for c in classes:
+            prefix = getattr(c, '_protocol_prefix', None)
+            if isinstance(prefix, bytes) and len(prefix) == 6 and prefix[0] == OpCodes.OP_RETURN:
+                by_prefix.setdefault(prefix, []).append(c)
+            else:
+                others.append(c)
+        return classes, by_prefix, tuple(others)
+
     @staticmethod
     def protocol_factory(script):
         ''' One shot -- find the right class and construct object based on script '''
@@ -343,6 +373,12 @@ class Address(namedtuple("AddressTuple", "hash160 kind")):
     # Default to legacy
     FMT_UI = FMT_LEGACY
 
+    # String forms by (address, fmt, net), shared by all the Address objects
+    # for the same hash and kind. The per-object _addr2str_cache is lost each
+    # time an address is rebuilt from a storage string or a script, which the
+    # wallet and the address/history lists do all the time.
+    _str_cache = ExpiringCache(maxlen=100000, name="Address string cache")
+
     def __new__(cls, hash160, kind):
         assert kind in (cls.ADDR_P2PKH, cls.ADDR_P2SH)
         hash160 = to_bytes(hash160)
@@ -486,6 +522,11 @@ class Address(namedtuple("AddressTuple", "hash160 kind")):
                     return cached
             except (IndexError, TypeError):
                 raise AddressError('unrecognised format')
+        cached = self._str_cache.get((self, fmt, net))
+        if cached:
+            if net is networks.net:
+                self._addr2str_cache[fmt] = cached
+            return cached
 
         try:
             cached = None
@@ -505,8 +546,10 @@ class Address(namedtuple("AddressTuple", "hash160 kind")):
             cached = Base58.encode_check(bytes([verbyte]) + self.hash160)
             return cached
         finally:
-            if cached and net is networks.net:
-                self._addr2str_cache[fmt] = cached
+            if cached:
+                self._str_cache.put((self, fmt, net), cached)
+                if net is networks.net:
+                    self._addr2str_cache[fmt] = cached
 
     def to_full_string(self, fmt, *, net=None):
         '''Convert to text, with a URI prefix for cashaddr format.'''
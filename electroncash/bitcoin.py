@@ -30,6 +30,7 @@ import base64
 import hmac
 import os
 import json
+import time
 
 import ecdsa
 import pyaes
@@ -41,6 +42,8 @@ from . import networks
 from .util import (bfh, bh2u, to_string, print_error, InvalidPassword,
                    assert_bytes, to_bytes, inv_dict, profiler)
 from . import version
+from . import ecc_fast
+from . import secp256k1
 from .ecc_fast import do_monkey_patching_of_python_ecdsa_internals_with_libsecp256k1
 
 # Ensure Python interpreter is not running with -O, since this entire
@@ -75,7 +78,11 @@ TYPE_SCRIPT  = 2
 try:
     from Cryptodome.Cipher import AES
 except:
-    AES = None
+    try:
+        # pycryptodome under its own name; we already need it for SHA512 above
+        from Crypto.Cipher import AES
+    except:
+        AES = None
 
 
 # Derived from Bitcoin Cash Node src/script/script.h
@@ -276,6 +283,22 @@ def aes_encrypt_with_iv(key, iv, data):
     return e
 
 
+# The piece size in which EC_KEY.encrypt_message and decrypt_message process
+# their payload (a multiple of the AES block size)
+ECIES_CHUNK = 1 << 20
+
+
+def _aes_cbc_stream(key, iv, decrypt):
+    ''' Returns a function en- or decrypting successive block-aligned pieces
+    of a single AES-CBC stream, without padding. '''
+    if AES:
+        cipher = AES.new(key, AES.MODE_CBC, iv)
+        return cipher.decrypt if decrypt else cipher.encrypt
+    aes_cbc = pyaes.AESModeOfOperationCBC(key, iv=iv)
+    op = aes_cbc.decrypt if decrypt else aes_cbc.encrypt
+    return lambda data: b''.join(op(bytes(data[i:i + 16])) for i in range(0, len(data), 16))
+
+
 def aes_decrypt_with_iv(key, iv, data):
     assert_bytes(key, iv, data)
     if AES:
@@ -325,6 +348,8 @@ def pw_encode(s, password):
         return s
 
 def pw_decode(s, password):
+    if isinstance(password, PwDecoder):
+        return password.decode(s)
     if password is not None:
         secret = Hash(password)
         try:
@@ -336,6 +361,83 @@ def pw_decode(s, password):
         return s
 
 
+def _mlock(buf, lock=True):
+    ''' Best effort at keeping bytearray `buf` out of swap (POSIX only). '''
+    try:
+        import ctypes, ctypes.util
+        libc = ctypes.CDLL(ctypes.util.find_library('c'))
+        addr = ctypes.addressof((ctypes.c_char * len(buf)).from_buffer(buf))
+        return (libc.mlock if lock else libc.munlock)(ctypes.c_void_p(addr), ctypes.c_size_t(len(buf))) == 0
+    except Exception:
+        return False
+
+
+class PwDecoder:
+    ''' An unlocked session for decrypting many pw_encode()d fields: the AES
+    key is derived from the password once, instead of once per field.
+
+    Pass an instance anywhere a password goes to pw_decode(), e.g.:
+
+        with PwDecoder(password) as pw:
+            keys = [keystore.export_private_key(pk, pw) for pk in pubkeys]
+
+    The key is held in a bytearray that is mlock()ed where the OS allows it,
+    and is wiped by close() (or on leaving the with block) or once `lifetime`
+    seconds have passed, after which decode() raises Expired. Decrypted
+    values are remembered for the life of the session, so the same field
+    (e.g. a keystore's xprv) is only decrypted once; they are dropped along
+    with the key. '''
+
+    class Expired(InvalidPassword):
+        ''' Raised by decode() after the session was closed or timed out. '''
+
+    def __init__(self, password, *, lifetime=300.0):
+        self.password_given = password is not None
+        self.key = bytearray(Hash(password)) if self.password_given else None
+        self.locked = bool(self.key) and _mlock(self.key)
+        self.expiry = time.monotonic() + lifetime
+        self.plaintexts = {}
+
+    def decode(self, s):
+        if not self.password_given:
+            return s
+        if self.key is None or time.monotonic() > self.expiry:
+            self.close()
+            raise self.Expired()
+        d = self.plaintexts.get(s)
+        if d is None:
+            try:
+                d = to_string(DecodeAES_base64(self.key, s), "utf8")
+            except Exception:
+                raise InvalidPassword()
+            self.plaintexts[s] = d
+        return d
+
+    def decode_many(self, items):
+        ''' Returns the decryption of each of the pw_encode()d `items`. '''
+        return [self.decode(s) for s in items]
+
+    def close(self):
+        self.plaintexts.clear()
+        if self.key is not None:
+            self.key[:] = bytes(len(self.key))
+            if self.locked:
+                _mlock(self.key, False)
+            self.key = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def __del__(self):
+        try:
+            self.close()
+        except Exception:
+            pass
+
+
 def rev_hex(s):
     return bh2u(bfh(s)[::-1])
 
@@ -414,6 +516,18 @@ def Hash(x):
     out = bytes(sha256(sha256(x)))
     return out
 
+def Hash_64_multi(data):
+    """Hash() of each consecutive 64-byte block of data, such as the
+    concatenated node pairs of one merkle tree level. Returns a list of
+    32-byte digests."""
+    data = bytes(data)
+    if len(data) % 64:
+        raise ValueError("data length must be a multiple of 64")
+    out = ecc_fast.sha256d64_multi(data)
+    if out is None:
+        return [Hash(data[i:i+64]) for i in range(0, len(data), 64)]
+    return [out[i:i+32] for i in range(0, len(out), 32)]
+
 def sha512_256(x):
     x = to_bytes(x, 'utf8')
     h = SHA512.new(truncate="256")
@@ -686,6 +800,15 @@ def public_key_from_private_key(pk, compressed):
     public_key = GetPubKey(pkey.pubkey, compressed)
     return bh2u(public_key)
 
+def public_keys_from_private_keys(pks, compressed):
+    """ Like public_key_from_private_key, but for a list of 32-byte private
+    keys. Uses a single native batch call when libsecp256k1 supports it. """
+    pks = list(pks)
+    result = ecc_fast.pubkey_create_batch(pks, compressed)
+    if result is None:
+        return [public_key_from_private_key(pk, compressed) for pk in pks]
+    return [bh2u(public_key) for public_key in result]
+
 def address_from_private_key(sec, *, net=None):
     if net is None: net = networks.net
     txin_type, privkey, compressed = deserialize_privkey(sec, net=net)
@@ -730,13 +853,37 @@ def msg_magic(message):
 
 
 def verify_message(address, sig, message, *, net=None):
+    return verify_messages([(address, sig, message)], net=net)[0]
+
+def verify_messages(items, *, net=None):
+    ''' verify_message() for each (address, sig, message) of items, returning
+    the list of results. With libsecp256k1 all the public keys are recovered
+    in one batch; any signature the batch rejects is rechecked by the Python
+    code, so that results and exceptions are exactly those of verify_message. '''
     if net is None: net = networks.net
-    assert_bytes(sig, message)
     from .address import Address
-    if not isinstance(address, Address):
-        address = Address.from_string(address, net=net)
-
-    h = Hash(msg_magic(message))
+    items = [(address if isinstance(address, Address) else Address.from_string(address, net=net), sig, message)
+             for address, sig, message in items]
+    hashes, headers = [], []
+    for address, sig, message in items:
+        assert_bytes(sig, message)
+        hashes.append(Hash(msg_magic(message)))
+        headers.append(_message_sig_header(sig))
+    pubkeys = secp256k1.ecdsa_recover_batch([sig[1:] for _, sig, _ in items], [recid for recid, _ in headers],
+                                            hashes, compressed=False)
+    results = []
+    for (address, sig, message), h, (recid, compressed), pubkey in zip(items, hashes, headers, pubkeys or [None] * len(items)):
+        if pubkey is None:
+            results.append(_verify_message_slow(address, sig, h))
+            continue
+        # a recovered key is one the signature is valid for
+        if compressed:
+            pubkey = bytes((2 + (pubkey[64] & 1),)) + pubkey[1:33]
+        results.append(address == Address.from_pubkey(pubkey))
+    return results
+
+def _verify_message_slow(address, sig, h):
+    from .address import Address
     public_key, compressed = pubkey_from_signature(sig, h)
     # check public key using the right address
     pubkey = point_to_ser(public_key.pubkey.point, compressed)
@@ -824,7 +971,8 @@ class MyVerifyingKey(ecdsa.VerifyingKey):
         return klass.from_public_point( Q, curve )
 
 
-def pubkey_from_signature(sig, h):
+def _message_sig_header(sig):
+    ''' Returns the (recid, compressed) of a 65-byte message signature. '''
     if len(sig) != 65:
         raise Exception("Wrong encoding")
     nV = sig[0]
@@ -835,7 +983,10 @@ def pubkey_from_signature(sig, h):
         nV -= 4
     else:
         compressed = False
-    recid = nV - 27
+    return nV - 27, compressed
+
+def pubkey_from_signature(sig, h):
+    recid, compressed = _message_sig_header(sig)
     return MyVerifyingKey.from_signature(sig[1:], recid, h, curve = SECP256k1), compressed
 
 
@@ -897,50 +1048,98 @@ class EC_KEY(object):
         public_key.verify_digest(sig[1:], h, sigdecode = ecdsa.util.sigdecode_string)
 
 
-    # ECIES encryption/decryption methods; AES-128-CBC with PKCS7 is used as the cipher; hmac-sha256 is used as the mac
+    # ECIES encryption/decryption methods; AES-128-CBC with PKCS7 is used as the cipher; hmac-sha256 is used as the mac.
+    # The ECDH and key derivation are done natively by libsecp256k1 when it
+    # has secp256k1_ecies_derive_keys, and the payload is processed in
+    # ECIES_CHUNK sized pieces rather than through whole-buffer copies.
 
     @classmethod
     def encrypt_message(self, message, pubkey):
         assert_bytes(message)
 
-        pk = ser_to_point(pubkey)
-        if not ecdsa.ecdsa.point_is_valid(generator_secp256k1, pk.x(), pk.y()):
-            raise Exception('invalid pubkey')
-
-        ephemeral_exponent = number_to_string(ecdsa.util.randrange(pow(2,256)), generator_secp256k1.order())
-        ephemeral = EC_KEY(ephemeral_exponent)
-        ecdh_key = point_to_ser(pk * ephemeral.privkey.secret_multiplier)
-        key = hashlib.sha512(ecdh_key).digest()
+        order = generator_secp256k1.order()
+        if secp256k1.has_ecies():
+            ephemeral_exponent = number_to_string(ecdsa.util.randrange(order), order)
+            try:
+                key, ephemeral_pubkey = secp256k1.ecies_derive_keys(ephemeral_exponent, pubkey, ephemeral=True)
+            except ValueError:
+                raise Exception('invalid pubkey')
+        else:
+            pk = ser_to_point(pubkey)
+            if not ecdsa.ecdsa.point_is_valid(generator_secp256k1, pk.x(), pk.y()):
+                raise Exception('invalid pubkey')
+
+            ephemeral_exponent = number_to_string(ecdsa.util.randrange(pow(2,256)), order)
+            ephemeral = EC_KEY(ephemeral_exponent)
+            ecdh_key = point_to_ser(pk * ephemeral.privkey.secret_multiplier)
+            key = hashlib.sha512(ecdh_key).digest()
+            ephemeral_pubkey = bfh(ephemeral.get_public_key(compressed=True))
         iv, key_e, key_m = key[0:16], key[16:32], key[32:]
-        ciphertext = aes_encrypt_with_iv(key_e, iv, message)
-        ephemeral_pubkey = bfh(ephemeral.get_public_key(compressed=True))
-        encrypted = b'BIE1' + ephemeral_pubkey + ciphertext
-        mac = hmac.new(key_m, encrypted, hashlib.sha256).digest()
 
-        return base64.b64encode(encrypted + mac)
+        header = b'BIE1' + ephemeral_pubkey
+        aligned = len(message) - len(message) % 16
+        padlen = 16 - len(message) % 16
+        out = bytearray(len(header) + aligned + padlen + 32)
+        out[:len(header)] = header
+        mac = hmac.new(key_m, header, hashlib.sha256)
+        crypt = _aes_cbc_stream(key_e, iv, decrypt=False)
+        view = memoryview(message)
+        pos = len(header)
+        def put(piece):
+            nonlocal pos
+            c = crypt(piece)
+            out[pos:pos + len(c)] = c
+            mac.update(c)
+            pos += len(c)
+        for i in range(0, aligned, ECIES_CHUNK):
+            put(view[i:min(i + ECIES_CHUNK, aligned)])
+        put(bytes(view[aligned:]) + bytes([padlen]) * padlen)
+        out[pos:] = mac.digest()
+
+        return base64.b64encode(out)
 
     def decrypt_message(self, encrypted):
         encrypted = base64.b64decode(encrypted)
         if len(encrypted) < 85:
             raise Exception('invalid ciphertext: length')
+        view = memoryview(encrypted)
         magic = encrypted[:4]
         ephemeral_pubkey = encrypted[4:37]
-        ciphertext = encrypted[37:-32]
         mac = encrypted[-32:]
         if magic != b'BIE1':
             raise Exception('invalid ciphertext: invalid magic bytes')
-        try:
-            ephemeral_pubkey = ser_to_point(ephemeral_pubkey)
-        except AssertionError as e:
-            raise Exception('invalid ciphertext: invalid ephemeral pubkey')
-        if not ecdsa.ecdsa.point_is_valid(generator_secp256k1, ephemeral_pubkey.x(), ephemeral_pubkey.y()):
-            raise Exception('invalid ciphertext: invalid ephemeral pubkey')
-        ecdh_key = point_to_ser(ephemeral_pubkey * self.privkey.secret_multiplier)
-        key = hashlib.sha512(ecdh_key).digest()
+        if secp256k1.has_ecies():
+            try:
+                key = secp256k1.ecies_derive_keys(number_to_string(self.secret, generator_secp256k1.order()),
+                                                  ephemeral_pubkey)[0]
+            except ValueError:
+                raise Exception('invalid ciphertext: invalid ephemeral pubkey')
+        else:
+            try:
+                ephemeral_pubkey = ser_to_point(ephemeral_pubkey)
+            except AssertionError as e:
+                raise Exception('invalid ciphertext: invalid ephemeral pubkey')
+            if not ecdsa.ecdsa.point_is_valid(generator_secp256k1, ephemeral_pubkey.x(), ephemeral_pubkey.y()):
+                raise Exception('invalid ciphertext: invalid ephemeral pubkey')
+            ecdh_key = point_to_ser(ephemeral_pubkey * self.privkey.secret_multiplier)
+            key = hashlib.sha512(ecdh_key).digest()
         iv, key_e, key_m = key[0:16], key[16:32], key[32:]
-        if mac != hmac.new(key_m, encrypted[:-32], hashlib.sha256).digest():
+        if not hmac.compare_digest(mac, hmac.new(key_m, view[:-32], hashlib.sha256).digest()):
+            raise InvalidPassword()
+
+        ciphertext = view[37:-32]
+        if len(ciphertext) % 16 != 0 or len(ciphertext) == 0:
+            raise InvalidPassword()
+        out = bytearray(len(ciphertext))
+        crypt = _aes_cbc_stream(key_e, iv, decrypt=True)
+        for i in range(0, len(ciphertext), ECIES_CHUNK):
+            p = crypt(ciphertext[i:i + ECIES_CHUNK])
+            out[i:i + len(p)] = p
+        padlen = out[-1]
+        if not 0 < padlen <= 16 or out[-padlen:] != bytes([padlen]) * padlen:
             raise InvalidPassword()
-        return aes_decrypt_with_iv(key_e, iv, ciphertext)
+        del out[-padlen:]
+        return bytes(out)
 
 
 ###################################### BIP32 ##############################
@@ -995,13 +1194,30 @@ def CKD_pub(cK, c, n):
 def _CKD_pub(cK, c, s):
     order = generator_secp256k1.order()
     I = hmac.new(c, cK + s, hashlib.sha512).digest()
+    c_n = I[32:]
+    if secp256k1.secp256k1:
+        pubkey_point = secp256k1.ECPoint.generator_mul(int.from_bytes(I[0:32], 'big')) + secp256k1.ECPoint(cK)
+        return pubkey_point.to_bytes(compressed=True), c_n
     curve = SECP256k1
     pubkey_point = string_to_number(I[0:32])*curve.generator + ser_to_point(cK)
     public_key = ecdsa.VerifyingKey.from_public_point( pubkey_point, curve = SECP256k1 )
-    c_n = I[32:]
     cK_n = GetPubKey(public_key.pubkey,True)
     return cK_n, c_n
 
+def CKD_pub_range(cK, c, start, count):
+    """ Derive the non-hardened children start .. start+count-1 of (cK, c).
+    Returns a list of (cK_n, c_n) tuples, as CKD_pub would for each index.
+    The HMACs are computed here; the point arithmetic for the whole range is
+    done in one native call when libsecp256k1 supports it. """
+    if start < 0 or count < 0 or start + count > BIP32_PRIME:
+        raise ValueError('CKD_pub_range: indices must be non-hardened')
+    Is = [hmac.new(c, cK + bfh(rev_hex(int_to_hex(n, 4))), hashlib.sha512).digest()
+          for n in range(start, start + count)]
+    result = ecc_fast.pubkey_tweak_add_batch(cK, [I[0:32] for I in Is], True)
+    if result is None:
+        return [CKD_pub(cK, c, n) for n in range(start, start + count)]
+    return [(cK_n, I[32:]) for cK_n, I in zip(result, Is)]
+
 
 def xprv_header(xtype, *, net=None):
     if net is None: net = networks.net
@@ -1214,6 +1430,27 @@ def bip38_decrypt(enc_key, password, *, require_fast=True, net=None):
         print_error("[bip38_decrypt] Error with key", enc_key, "error was:", repr(e))
     return None
 
+def bip38_decrypt_many(enc_keys, password, *, require_fast=True, net=None, max_workers=None):
+    ''' Like bip38_decrypt, but for a whole list of keys with the same password.
+    Returns a list with one bip38_decrypt result per key, in order. The fast
+    scrypt implementations release the GIL, so with those the keys are
+    decrypted on up to `max_workers` threads at once (default: one per CPU);
+    the slow pure-Python one would only contend for the GIL, so it gets one. '''
+    enc_keys = list(enc_keys)
+    if not is_bip38_available(require_fast):
+        return [None] * len(enc_keys)
+    if max_workers is None:
+        max_workers = os.cpu_count() or 1
+    if not Bip38Key.isFast():
+        max_workers = 1
+    max_workers = min(max_workers, len(enc_keys))
+    decrypt = lambda k: bip38_decrypt(k, password, require_fast=require_fast, net=net)
+    if max_workers <= 1:
+        return [decrypt(k) for k in enc_keys]
+    from concurrent.futures import ThreadPoolExecutor
+    with ThreadPoolExecutor(max_workers=max_workers, thread_name_prefix='Bip38Decrypt') as executor:
+        return list(executor.map(decrypt, enc_keys))
+
 
 class Bip38Key:
     '''
@@ -1644,8 +1881,11 @@ class Bip38Key:
         seedb = os.urandom(24)
         factorb = Hash(seedb)
 
-        point = ser_to_point(passpoint) * cls._bytes_to_int(factorb)
-        pubkey = point_to_ser(point, compressed)
+        if secp256k1.secp256k1:
+            pubkey = (secp256k1.ECPoint(passpoint) * cls._bytes_to_int(factorb)).to_bytes(compressed)
+        else:
+            point = ser_to_point(passpoint) * cls._bytes_to_int(factorb)
+            pubkey = point_to_ser(point, compressed)
         generatedaddress = pubkey_to_address('p2pkh', pubkey.hex())
         addresshash = Hash(generatedaddress)[:4]
 
@@ -21,14 +21,18 @@
 # CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 # SOFTWARE.
 
+import mmap
 import os
 import sys
 import threading
+import time
 
+from ctypes import byref, c_char_p, c_int64, c_size_t, c_uint, c_uint32, c_void_p, POINTER
 from typing import Optional
 
 from . import asert_daa
 from . import networks
+from . import secp256k1
 from . import util
 
 from .bitcoin import *
@@ -53,6 +57,16 @@ NULL_HEADER = bytes([0]) * HEADER_SIZE
 NULL_HASH_BYTES = bytes([0]) * 32
 NULL_HASH_HEX = NULL_HASH_BYTES.hex()
 
+SECP256K1_HEADERS_TESTNET_RULE = 1 << 0
+
+_secp256k1_headers_verify_chunk = secp256k1.bind('secp256k1_headers_verify_chunk', [
+    c_void_p, POINTER(c_size_t), c_char_p, c_size_t, c_int64, c_char_p, POINTER(c_uint32),
+    c_int64, c_int64, c_int64, c_uint32, c_int64, c_int64, c_char_p, c_uint ])
+
+def has_fast_verify_chunk():
+    """Can Blockchain.verify_chunk verify ASERT headers natively?"""
+    return bool(_secp256k1_headers_verify_chunk)
+
 
 def bits_to_work(bits):
     target = bits_to_target(bits)
@@ -198,6 +212,9 @@ def verify_proven_chunk(chunk_base_height, chunk_data):
         if i > 0:
             if prev_header_hash != header.get('prev_block_hash'):
                 raise VerifyError("prev hash mismatch: %s vs %s" % (prev_header_hash, header.get('prev_block_hash')))
+        # Whatever their bits should be, every header must meet its own.
+        if int('0x' + this_header_hash, 16) > bits_to_target(header.get('bits')):
+            raise VerifyError("insufficient proof of work at height %i" % header.get('block_height'))
         prev_header_hash = this_header_hash
 
 # Copied from electrumx
@@ -217,9 +234,9 @@ class HeaderChunk:
     def __init__(self, base_height, data):
         self.base_height = base_height
         self.header_count = len(data) // HEADER_SIZE
-        self.headers = [deserialize_header(data[i * HEADER_SIZE : (i + 1) * HEADER_SIZE],
-                                           base_height + i)
-                        for i in range(self.header_count)]
+        self.data = data
+        # Deserialized on first access; the native verifier reads the raw data.
+        self.headers = [None] * self.header_count
 
     def __repr__(self):
         return "HeaderChunk(base_height={}, header_count={})".format(self.base_height, self.header_count)
@@ -235,7 +252,11 @@ class HeaderChunk:
         return self.get_header_at_index(height - self.base_height)
 
     def get_header_at_index(self, index):
-        return self.headers[index]
+        header = self.headers[index]
+        if header is None:
+            header = self.headers[index] = deserialize_header(
+                self.data[index * HEADER_SIZE : (index + 1) * HEADER_SIZE], self.base_height + index)
+        return header
 
 class Blockchain(util.PrintError):
     """
@@ -247,6 +268,17 @@ class Blockchain(util.PrintError):
         self.catch_up = None # interface catching up
         self.base_height = base_height
         self.parent_base_height = parent_base_height
+        # Read-only map of the headers file, replaced by update_size() after each write
+        self._mmap = None
+        # 32-byte hash of each header of this branch in height order, or 32 zero bytes
+        # where it has not been computed yet. Bumping _write_count invalidates hashes that
+        # were being computed concurrently.
+        self._hashes = bytearray()
+        self._write_count = 0
+        # Header hash -> height, filled in as hashes are computed. Entries may be stale
+        # after a write, so they are checked against self._hashes.
+        self._hash_heights = {}
+        self._all_hashed = False
 
         self.lock = threading.Lock()
         with self.lock:
@@ -283,7 +315,11 @@ class Blockchain(util.PrintError):
     def fork(parent, header):
         base_height = header.get('block_height')
         self = Blockchain(parent.config, base_height, parent.base_height)
-        open(self.path(), 'w+').close()
+        with self.lock:
+            self.close_mmap()
+            self.forget_hashes()
+            open(self.path(), 'w+').close()
+            self.update_size()
         self.save_header(header)
         return self
 
@@ -295,8 +331,33 @@ class Blockchain(util.PrintError):
             return self._size
 
     def update_size(self):
+        ''' Must be called with self.lock held. Also (re)maps the headers file. '''
         p = self.path()
         self._size = os.path.getsize(p)//HEADER_SIZE if os.path.exists(p) else 0
+        self.close_mmap()
+        if self._size:
+            with open(p, 'rb') as f:
+                self._mmap = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        n = len(self._hashes) // 32
+        if n > self._size:
+            del self._hashes[self._size * 32:]
+        elif n < self._size:
+            self._hashes.extend(bytes(32 * (self._size - n)))
+            self._all_hashed = False
+
+    def forget_hashes(self):
+        ''' Must be called with self.lock held, if the file was rewritten other
+        than through write(). '''
+        self._write_count += 1
+        del self._hashes[:]
+
+    def close_mmap(self):
+        ''' Must be called with self.lock held. Windows cannot truncate or rename
+        a mapped file, so this has to happen before either; update_size() maps
+        it again. '''
+        if self._mmap is not None:
+            self._mmap.close()
+            self._mmap = None
 
     def verify_header(self, header, prev_header, bits=None):
         prev_header_hash = hash_header(prev_header)
@@ -316,21 +377,64 @@ class Blockchain(util.PrintError):
             if int('0x' + this_header_hash, 16) > target:
                 raise VerifyError("insufficient proof of work: %s vs target %s" % (int('0x' + this_header_hash, 16), target))
 
+    def verify_chunk_fast(self, chunk_base_height, chunk_data, chunk):
+        '''Verify the leading headers of the chunk whose difficulty comes from
+        a known ASERT anchor natively. Returns how many headers passed; the
+        rest need verifying the slow way, which also explains any failure.'''
+        anchor = networks.net.asert_daa.anchor
+        if not _secp256k1_headers_verify_chunk or anchor is None or chunk_base_height < 11:
+            return 0
+        prev_headers = [self.read_header(height, chunk)
+                        for height in range(chunk_base_height - 11, chunk_base_height)]
+        if None in prev_headers:
+            return 0
+        nverified = c_size_t(0)
+        _secp256k1_headers_verify_chunk(
+            secp256k1.secp256k1.ctx, byref(nverified), bytes(chunk_data), chunk.get_count(), chunk_base_height,
+            hash_decode(hash_header(prev_headers[-1])), (c_uint32 * 11)(*(h['timestamp'] for h in prev_headers)),
+            networks.net.asert_daa.MTP_ACTIVATION_TIME, networks.net.asert_daa.HALF_LIFE,
+            anchor.height, anchor.bits, anchor.prev_time,
+            networks.net.BITCOIN_CASH_FORK_BLOCK_HEIGHT, hash_decode(networks.net.BITCOIN_CASH_FORK_BLOCK_HASH),
+            SECP256K1_HEADERS_TESTNET_RULE if networks.net.TESTNET else 0)
+        return nverified.value
+
     def verify_chunk(self, chunk_base_height, chunk_data):
         chunk = HeaderChunk(chunk_base_height, chunk_data)
+        start = self.verify_chunk_fast(chunk_base_height, chunk_data, chunk)
 
         prev_header = None
-        if chunk_base_height != 0:
-            prev_header = self.read_header(chunk_base_height - 1)
+        if chunk_base_height + start != 0:
+            prev_header = self.read_header(chunk_base_height + start - 1, chunk)
 
         header_count = len(chunk_data) // HEADER_SIZE
-        for i in range(header_count):
+        for i in range(start, header_count):
             header = chunk.get_header_at_index(i)
             # Check the chain of hashes and the difficulty.
             bits = self.get_bits(header, chunk)
             self.verify_header(header, prev_header, bits)
             prev_header = header
 
+    def verify_proven_chunk_difficulty(self, chunk_base_height, chunk_data):
+        '''Check the difficulty of the headers of a proven chunk we have none of
+        the predecessors of, like the one ending at a fast sync checkpoint.
+        Under ASERT the bits of a header follow from the anchor and the 11
+        headers before it, so all but the first 11 headers can be checked.'''
+        anchor = networks.net.asert_daa.anchor
+        if anchor is None or chunk_base_height <= anchor.height:
+            raise VerifyError("no known ASERT anchor below height %i" % chunk_base_height)
+        chunk = HeaderChunk(chunk_base_height, chunk_data)
+        prev_header = chunk.get_header_at_index(10)
+        for i in range(11, chunk.get_count()):
+            header = chunk.get_header_at_index(i)
+            # Timestamps ahead of schedule lower the ASERT target, so hold them
+            # to the same future limit as nodes do.
+            if header['timestamp'] > time.time() + 2 * 60 * 60:
+                raise VerifyError("header at height %i is too far in the future" % header['block_height'])
+            if self.get_median_time_past(header['block_height'] - 1, chunk) < networks.net.asert_daa.MTP_ACTIVATION_TIME:
+                raise VerifyError("header at height %i precedes ASERT activation" % header['block_height'])
+            self.verify_header(header, prev_header, self.get_bits(header, chunk))
+            prev_header = header
+
     def path(self):
         d = util.get_headers_dir(self.config)
         filename = 'blockchain_headers' if self.parent_base_height is None else os.path.join('forks', 'fork_%d_%d'%(self.parent_base_height, self.base_height))
@@ -358,26 +462,43 @@ class Blockchain(util.PrintError):
         parent_base_height = self.parent_base_height
         base_height = self.base_height
         parent = self.parent()
-        with open(self.path(), 'rb') as f:
-            my_data = f.read()
-        with open(parent.path(), 'rb') as f:
-            f.seek((base_height - parent.base_height)*HEADER_SIZE)
-            parent_data = f.read(parent_branch_size*HEADER_SIZE)
+        delta = base_height - parent.base_height
+        with self.lock:
+            my_data = self._mmap[:]
+            my_hashes = bytes(self._hashes)
+        with parent.lock:
+            parent_data = parent._mmap[delta*HEADER_SIZE:(delta + parent_branch_size)*HEADER_SIZE]
+            parent_hashes = bytes(parent._hashes[delta*32:(delta + parent_branch_size)*32])
         self.write(parent_data, 0)
-        parent.write(my_data, (base_height - parent.base_height)*HEADER_SIZE)
+        parent.write(my_data, delta*HEADER_SIZE)
+        # The hashes moved along with the headers; no need to recompute them.
+        with self.lock:
+            self._hashes[:] = parent_hashes
+        with parent.lock:
+            parent._hashes[delta*32:] = my_hashes
         # store file path
         for b in blockchains.values():
             b.old_path = b.path()
         # swap parameters
         self.parent_base_height = parent.parent_base_height; parent.parent_base_height = parent_base_height
         self.base_height = parent.base_height; parent.base_height = base_height
-        self._size = parent._size; parent._size = parent_branch_size
+        with self.lock, parent.lock:
+            # Each now owns the other's file, and with it the map and hashes of that file.
+            self._size = parent._size; parent._size = parent_branch_size
+            self._mmap, parent._mmap = parent._mmap, self._mmap
+            self._hashes, parent._hashes = parent._hashes, self._hashes
+            self._write_count += 1; parent._write_count += 1
+        self._hash_heights, parent._hash_heights = {**parent._hash_heights, **self._hash_heights}, parent._hash_heights
+        self._all_hashed = parent._all_hashed = False
         # move files
         for b in blockchains.values():
             if b in [self, parent]: continue
             if b.old_path != b.path():
                 self.print_error("renaming", b.old_path, b.path())
-                os.rename(b.old_path, b.path())
+                with b.lock:
+                    b.close_mmap()
+                    os.rename(b.old_path, b.path())
+                    b.update_size()
         # update pointers
         blockchains[self.base_height] = self
         blockchains[parent.base_height] = parent
@@ -385,6 +506,10 @@ class Blockchain(util.PrintError):
     def write(self, data, offset, truncate=True):
         filename = self.path()
         with self.lock:
+            self.close_mmap()
+            self._write_count += 1
+            # Hashes of the overwritten headers, and of any truncated ones, are gone
+            del self._hashes[offset // HEADER_SIZE * 32:]
             with open(filename, 'rb+') as f:
                 if truncate and offset != self._size*HEADER_SIZE:
                     f.seek(offset)
@@ -415,23 +540,68 @@ class Blockchain(util.PrintError):
             return self.parent().read_header(height)
         if height > self.height():
             return
+        h = self._read_raw_header(height)
+        # Is it a pre-checkpoint header that has never been requested?
+        if h is None or h == NULL_HEADER:
+            return None
+        return deserialize_header(h, height)
+
+    def _read_raw_header(self, height):
         delta = height - self.base_height
-        name = self.path()
-        if os.path.exists(name):
-            with open(name, 'rb') as f:
-                f.seek(delta * HEADER_SIZE)
-                h = f.read(HEADER_SIZE)
-            # Is it a pre-checkpoint header that has never been requested?
-            if h == NULL_HEADER:
+        with self.lock:
+            if self._mmap is None:
                 return None
-            return deserialize_header(h, height)
+            h = self._mmap[delta * HEADER_SIZE : (delta + 1) * HEADER_SIZE]
+        return h if len(h) == HEADER_SIZE else None
+
+    def _get_hash_bytes(self, height):
+        ''' The hash of the header at height on this branch, or None if it is
+        missing. Hashes the raw header once and caches the result. '''
+        delta = height - self.base_height
+        with self.lock:
+            h = bytes(self._hashes[delta * 32 : (delta + 1) * 32])
+            write_count = self._write_count
+        if len(h) == 32 and h != NULL_HASH_BYTES:
+            return h
+        raw = self._read_raw_header(height)
+        if raw is None or raw == NULL_HEADER:
+            return None
+        h = RadiantHash(raw)
+        with self.lock:
+            if write_count == self._write_count:
+                self._hashes[delta * 32 : (delta + 1) * 32] = h
+                self._hash_heights[h] = height
+        return h
 
     def get_hash(self, height):
         if height == -1:
             return NULL_HASH_HEX
         elif height == 0:
             return networks.net.GENESIS
-        return hash_header(self.read_header(height))
+        if height < 0:
+            return NULL_HASH_HEX
+        if height < self.base_height:
+            return self.parent().get_hash(height)
+        if height > self.height():
+            return NULL_HASH_HEX
+        h = self._get_hash_bytes(height)
+        return NULL_HASH_HEX if h is None else hash_encode(h)
+
+    def get_height_of_hash(self, hash_hex):
+        ''' Returns the height of the header with this hash on this branch
+        (not its parents), or None. The first miss hashes every header of
+        the branch that has not been hashed yet. '''
+        key = hash_decode(hash_hex)
+        for attempt in range(2):
+            height = self._hash_heights.get(key)
+            if height is not None and self.base_height <= height <= self.height() \
+                    and self._get_hash_bytes(height) == key:
+                return height
+            if attempt or self._all_hashed:
+                return None
+            for height in range(self.base_height, self.height() + 1):
+                self._get_hash_bytes(height)
+            self._all_hashed = True
 
     # Not used.
     def BIP9(self, height, flag):
@@ -577,7 +747,7 @@ class Blockchain(util.PrintError):
         previous_header = self.read_header(height -1)
         if not previous_header:
             return False
-        prev_hash = hash_header(previous_header)
+        prev_hash = self.get_hash(height - 1)
         if prev_hash != header.get('prev_block_hash'):
             return False
         bits = self.get_bits(header)
@@ -615,8 +785,7 @@ class Blockchain(util.PrintError):
             # there is, indicate the need for the server to fork.
             intersection_height = min(top_height, self.height())
             chunk_header = chunk.get_header_at_height(intersection_height)
-            our_header = self.read_header(intersection_height)
-            if hash_header(chunk_header) != hash_header(our_header):
+            if hash_header(chunk_header) != self.get_hash(intersection_height):
                 return CHUNK_FORKS
             if intersection_height <= self.height():
                 return CHUNK_ACCEPTED
@@ -624,9 +793,8 @@ class Blockchain(util.PrintError):
             # This base of this chunk joins to the top of the blockchain in theory.
             # We need to rule out the case where the chunk is actually a fork at the
             # connecting height.
-            our_header = self.read_header(self.height())
             chunk_header = chunk.get_header_at_height(base_height)
-            if hash_header(our_header) != chunk_header['prev_block_hash']:
+            if self.get_hash(self.height()) != chunk_header['prev_block_hash']:
                 return CHUNK_FORKS
 
         try:
@@ -10,7 +10,7 @@ import threading
 import queue
 import weakref
 import math
-from collections import defaultdict
+from collections import defaultdict, OrderedDict
 from .util import PrintError, print_error
 
 class ExpiringCache:
@@ -91,6 +91,87 @@ class ExpiringCache:
         )
         return (f'<{__class__.__name__} "{name}" at {address}, {length} item{"s" if length != 1 else ""} (maxlen={maxlen} timeout={timeout})>')
 
+class ByteBudgetCache:
+    ''' A thread-safe LRU cache of bytes values that is bounded by the total
+    size of what it holds rather than by its number of items.
+
+    Unlike ExpiringCache, there is no manager thread and no deep examination
+    of the contents: each entry is charged len(key) + len(value) plus a fixed
+    `overhead`, which makes put() O(1). Once the `max_bytes` budget is
+    exceeded, the least recently used entries are evicted right away.
+
+    Hit, miss and eviction counts are kept so that the budget can be tuned,
+    see stats(). '''
+    overhead = 200  # rough bytes of Python object and dict slot cost per entry
+
+    def __init__(self, *, max_bytes, name="An Unnamed Cache"):
+        assert max_bytes > 0
+        self.max_bytes = max_bytes
+        self.name = name
+        self.d = OrderedDict()
+        self.nbytes = 0
+        self.hits = self.misses = self.evictions = 0
+        self.lock = threading.Lock()
+    def _cost(self, key, value):
+        return len(key) + len(value) + self.overhead
+    def get(self, key, default=None):
+        with self.lock:
+            value = self.d.get(key)
+            if value is None:
+                self.misses += 1
+                return default
+            self.d.move_to_end(key)
+            self.hits += 1
+            return value
+    def put(self, key, value):
+        cost = self._cost(key, value)
+        with self.lock:
+            old = self.d.pop(key, None)
+            if old is not None:
+                self.nbytes -= self._cost(key, old)
+            if cost > self.max_bytes:
+                # would evict everything else and still not fit
+                return
+            self.d[key] = value
+            self.nbytes += cost
+            while self.nbytes > self.max_bytes:
+                k, v = self.d.popitem(last=False)
+                self.nbytes -= self._cost(k, v)
+                self.evictions += 1
+    def set_max_bytes(self, max_bytes):
+        assert max_bytes > 0
+        with self.lock:
+            self.max_bytes = max_bytes
+            while self.nbytes > self.max_bytes:
+                k, v = self.d.popitem(last=False)
+                self.nbytes -= self._cost(k, v)
+                self.evictions += 1
+    def clear(self):
+        with self.lock:
+            self.d.clear()
+            self.nbytes = 0
+    def size_bytes(self):
+        ''' Returns the bytes charged to the budget for the current contents. '''
+        return self.nbytes
+    def stats(self):
+        ''' Returns a dict of the cache's size and its hit, miss and eviction
+        counts since it was created. '''
+        with self.lock:
+            return {
+                'name': self.name,
+                'items': len(self.d),
+                'bytes': self.nbytes,
+                'max_bytes': self.max_bytes,
+                'hits': self.hits,
+                'misses': self.misses,
+                'evictions': self.evictions,
+            }
+    def __len__(self):
+        return len(self.d)
+    def __repr__(self):
+        return (f'<{__class__.__name__} "{self.name}" at 0x{id(self):x}, {len(self)} item{"s" if len(self) != 1 else ""}'
+                f' ({self.nbytes}/{self.max_bytes} bytes)>')
+
 class _ExpiringCacheMgr(PrintError):
     '''Do not use this class directly. Instead just create ExpiringCache
     instances and that will handle the creation of this object automatically
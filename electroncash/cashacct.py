@@ -209,9 +209,8 @@ class ScriptOutput(ScriptOutputBase):
     def make_complete(self, block_height=None, block_hash=None, txid=None):
         '''Make this ScriptOutput instance complete by specifying block height,
         block_hash (hex string or bytes), and txid (hex string or bytes)'''
-        ch = collision_hash(block_hash, txid) if block_hash and txid else None
+        ch, em = collision_hash_and_emoji(block_hash, txid) if block_hash and txid else (None, None)
         num = bh2num(block_height) if block_height is not None else None
-        em = emoji(block_hash, txid) if ch else None
         return self.make_complete2(num, ch, emoji=em)
 
     def clear_completion(self):
@@ -465,14 +464,17 @@ def _collision_hash(block_hash, txid):
         raise ArgumentError('Invalid arguments', block_hash, txid)
     return bitcoin.sha256(bh + tx)
 
+def _collision_hash_str(h):
+    ch = h[:4]
+    ch = ''.join(reversed(str(int.from_bytes(ch, byteorder='big'))))  # convert int to string, reverse it
+    ch += '0' * (10 - len(ch))  # pad with 0's at the end
+    return ch
+
 def collision_hash(block_hash, txid):
     ''' May raise if block_hash and txid are not valid hex-encoded strings
     and/or raw bytes, otherwise returns the 0-padded collision hash string
     (always a str of length 10).'''
-    ch = _collision_hash(block_hash, txid)[:4]
-    ch = ''.join(reversed(str(int.from_bytes(ch, byteorder='big'))))  # convert int to string, reverse it
-    ch += '0' * (10 - len(ch))  # pad with 0's at the end
-    return ch
+    return _collision_hash_str(_collision_hash(block_hash, txid))
 
 chash = collision_hash  # alias.
 
@@ -501,6 +503,12 @@ def emoji(block_hash, txid):
     ''' Returns the emoji character givern a block hash and txid. May raise.'''
     return chr(emoji_list[emoji_index(block_hash, txid)])
 
+def collision_hash_and_emoji(block_hash, txid):
+    ''' Returns the (collision_hash, emoji) tuple of a registration, from a
+    single hash of block_hash + txid. May raise. '''
+    h = _collision_hash(block_hash, txid)
+    return _collision_hash_str(h), chr(emoji_list[int.from_bytes(h[-4:], byteorder='big') % 100])
+
 _emoji = emoji  # alias for internal use if names clash
 
 def number_from_block_height(block_height):
@@ -675,6 +683,14 @@ def lookup_asynch(server, number, success_cb, error_cb=None,
                          target=thread_func, daemon=True)
     t.start()
 
+# Recent results of lookup_asynch_all by (number, name, collision_prefix), and
+# the callbacks waiting on the lookups in flight, so that a query made again
+# shortly after, or while it is still running, doesn't go out to the servers
+# again.
+_lookup_cache = caches.ExpiringCache(maxlen=1000, name="CashAcct lookup cache", timeout=300.0)
+_lookups_in_flight = dict()  # key -> list of (success_cb, error_cb)
+_lookups_lock = threading.Lock()
+
 def lookup_asynch_all(number, success_cb, error_cb=None, name=None,
                       collision_prefix=None, timeout=timeout, debug=debug):
     ''' Like lookup_asynch above except it tries *all* the hard-coded servers
@@ -688,7 +704,43 @@ def lookup_asynch_all(number, success_cb, error_cb=None, name=None,
     One of the two callbacks are guaranteed to be called in either case.
 
     Callbacks are called in another thread context so GUI-facing code should
-    be aware of that fact (see nodes for lookup_asynch above).  '''
+    be aware of that fact (see nodes for lookup_asynch above).
+
+    Identical queries share one lookup while it runs, and its result for a
+    few minutes after. '''
+    key = (number, name and name.strip().lower(), collision_prefix and collision_prefix.strip())
+    cached = _lookup_cache.get(key)
+    if cached is not None:
+        # Still from another thread, as callers may hold locks the callbacks take
+        threading.Thread(daemon=True, target=success_cb, args=cached).start()
+        return
+    with _lookups_lock:
+        cbs = _lookups_in_flight.setdefault(key, [])
+        cbs.append((success_cb, error_cb))
+        if len(cbs) > 1:
+            if debug: util.print_error(f"lookup_asynch_all: {key} already in flight")
+            return
+    def on_success(res, server):
+        _lookup_cache.put(key, (res, server))
+        with _lookups_lock:
+            cbs = _lookups_in_flight.pop(key, [])
+        for success_cb, _ in cbs:
+            success_cb(res, server)
+    def on_error(exc):
+        with _lookups_lock:
+            cbs = _lookups_in_flight.pop(key, [])
+        for _, error_cb in cbs:
+            if error_cb:
+                error_cb(exc)
+    _lookup_asynch_all(number, on_success, on_error, name=name, collision_prefix=collision_prefix,
+                       timeout=timeout, debug=debug)
+
+def _forget_lookup(number, name=None, collision_prefix=None):
+    ''' Drops a result of lookup_asynch_all that turned out to be bad. '''
+    _lookup_cache.put((number, name and name.strip().lower(), collision_prefix and collision_prefix.strip()), None)
+
+def _lookup_asynch_all(number, success_cb, error_cb=None, name=None,
+                       collision_prefix=None, timeout=timeout, debug=debug):
     assert servers, "No servers hard-coded in cashacct.py. FIXME!"
     my_servers = servers.copy()
     random.shuffle(my_servers)
@@ -824,6 +876,10 @@ class CashAcct(util.PrintError, verifier.SPVDelegate):
     # corrseponding RegTx but not necessarily vice-versa.
     VerifTx = namedtuple("VerifTx", "txid, block_height, block_hash")
 
+    # How long a block processed from a lookup server is used for minimal
+    # collision hashes, across restarts, before it is looked up again
+    processed_block_ttl = 24 * 3600.0
+
     def __init__(self, wallet):
         assert wallet, "CashAcct cannot be instantiated without a wallet"
         self.wallet = wallet
@@ -851,8 +907,10 @@ class CashAcct(util.PrintError, verifier.SPVDelegate):
         # minimal collision hash encodings cache. keyed off (name.lower(), number, collision_hash) -> '03' string or '' string, serialized to disk for good UX on startup.
         self.minimal_ch_cache = caches.ExpiringCache(name=f"{self.wallet.diagnostic_name()} - CashAcct minimal collision_hash cache")
 
-        # Dict of block_height -> ProcessedBlock (not serialized to disk)
+        # Dict of block_height -> ProcessedBlock. Those younger than
+        # processed_block_ttl are saved, see save() and load()
         self.processed_blocks = caches.ExpiringCache(name=f"{self.wallet.diagnostic_name()} - CashAcct processed block cache", maxlen=5000, timeout=3600.0)
+        self.processed_block_times = dict()  # block_height -> time.time() the block was processed
 
     def diagnostic_name(self):
         return f'{self.wallet.diagnostic_name()}.{__class__.__name__}'
@@ -1144,6 +1202,7 @@ class CashAcct(util.PrintError, verifier.SPVDelegate):
         eat_d = dd.get('ext_reg_tx', {})
         vtx_d = dd.get('verified_tx', {})
         min_enc_l = dd.get('minimal_ch_cache', [])
+        pb_l = dd.get('processed_blocks', [])
 
         seen_scripts = {}
 
@@ -1176,6 +1235,15 @@ class CashAcct(util.PrintError, verifier.SPVDelegate):
             value = item[-1]
             key = item[:-1]
             self.minimal_ch_cache.put(tuple(key), value)  # re-populate the cache
+        now = time.time()
+        for height, block_hash, txids, t in pb_l:
+            # Only blocks whose registrations are all still here, verified in that block
+            if (now - t < self.processed_block_ttl
+                    and all(txid in seen_scripts and txid in self.v_tx
+                            and self.v_tx[txid].block_hash == block_hash for txid in txids)):
+                reg_txs = {txid: self.RegTx(txid, seen_scripts[txid]) for txid in txids}
+                self.processed_blocks.put(height, ProcessedBlock(hash=block_hash, height=height, reg_txs=reg_txs))
+                self.processed_block_times[height] = t
 
         # Re-enqueue previously unverified for verification.
         # they may come from either wallet or external source, but we
@@ -1210,7 +1278,8 @@ class CashAcct(util.PrintError, verifier.SPVDelegate):
         '''
 
         wat_d, eat_d, vtx_d = dict(), dict(), dict()
-        min_enc_l = list()
+        min_enc_l, pb_l = list(), list()
+        now = time.time()
         with self.lock:
             for txid, rtx in self.wallet_reg_tx.items():
                 wat_d[txid] = rtx.script.to_dict()
@@ -1225,12 +1294,17 @@ class CashAcct(util.PrintError, verifier.SPVDelegate):
                     # items but don't delete the entry.  Skip these.
                     continue
                 min_enc_l.append([*key, value])
+            for height, tup in self.processed_blocks.copy_dict().items():
+                pb, t = tup[-1], self.processed_block_times.get(height)
+                if pb is not None and t is not None and now - t < self.processed_block_ttl:
+                    pb_l.append([height, pb.hash, list(pb.reg_txs), t])
 
         data =  {
                     'wallet_reg_tx' : wat_d,
                     'ext_reg_tx'    : eat_d,
                     'verified_tx'   : vtx_d,
                     'minimal_ch_cache' : min_enc_l,
+                    'processed_blocks' : pb_l,
                 }
 
         self.wallet.storage.put('cash_accounts_data', data)
@@ -1381,6 +1455,17 @@ class CashAcct(util.PrintError, verifier.SPVDelegate):
             self.print_error(f"Warning, received a block from server with number {number}"
                              "but we didn't recognize any tx's in it. "
                              "To the dev reading this: See if the Cash Account spec has changed!")
+        # BULK COLLISION HASH CHECK
+        # Every collision hash and emoji in pb was computed from pb.hash (see
+        # lookup), so checking that one hash against our own header at that
+        # height checks them all at once. Without the header yet, the SPV
+        # verification below does it tx by tx.
+        header = network.blockchain().read_header(pb.height)
+        if header and blockchain.hash_header(header) != pb.hash:
+            self.print_error(f"Block number {number} from server {server} has hash {pb.hash}, not that of our header at height {pb.height}")
+            exc.append(RuntimeError('Block hash mismatch', number, server))
+            _forget_lookup(number)
+            return
         # REORG or BAD SERVER CHECK
         def check_sanity_detect_reorg_etc():
             minimal_ch_removed = []
@@ -1389,6 +1474,7 @@ class CashAcct(util.PrintError, verifier.SPVDelegate):
                 if pb_cached and pb != pb_cached:
                     # Poor man's reorg detection below...
                     self.processed_blocks.put(pb.height, None)
+                    _forget_lookup(number)
                     self.print_error(f"Warning, retrieved block info from server {server} is {pb} which differs from cached version {pb_cached}! Reverifying!")
                     keys = set()  # (lname, number, collision_hash) tuples
                     chash_rtxs = dict()  # chash_key_tuple -> regtx
@@ -1458,11 +1544,13 @@ class CashAcct(util.PrintError, verifier.SPVDelegate):
             except (queue.Empty, VFail) as e:
                 if num_needed():
                     exc.append(e)
+                    _forget_lookup(number)
                     return
             finally:
                 network.unregister_callback(on_verified)
         with self.lock:
             self.processed_blocks.put(pb.height, pb)
+            self.processed_block_times[pb.height] = time.time()
         return pb
 
     ############################
@@ -19,26 +19,47 @@
 # OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 # THE SOFTWARE.
 
+import base64
+from functools import lru_cache
+
 _CHARSET = "qpzry9x8gf2tvdw0s3jn54khce6mua7l"
 
+# bytes.translate tables. RFC 4648 base32 packs bits into 5-bit groups exactly
+# the way cashaddr does, so base64.b32encode/b32decode can do the bit shuffling
+# of _convertbits for whole strings at once; these map between its alphabet,
+# 5-bit values and our charset. Bytes that aren't in _CHARSET decode to 0xff.
+_B32_ALPHABET = b'ABCDEFGHIJKLMNOPQRSTUVWXYZ234567'
+_B32_TO_VALUES = bytes.maketrans(_B32_ALPHABET, bytes(range(32)))
+_VALUES_TO_B32 = bytes.maketrans(bytes(range(32)), _B32_ALPHABET)
+_VALUES_TO_CHARSET = bytes.maketrans(bytes(range(32)), _CHARSET.encode('ascii'))
+_CHARSET_TO_VALUES = bytes(_CHARSET.find(chr(i)) & 0xff for i in range(256))
+
+def _make_generator_table():
+    """The xor of the generator constants selected by each possible value of
+    the top 5 bits of the checksum state, so that _polymod does one lookup
+    per symbol instead of five tests."""
+    gen = (0x98f2bc8e61, 0x79b76d99e2, 0xf33e5fb3c4, 0xae2eabe2a8, 0x1e4f43e470)
+    table = []
+    for c0 in range(32):
+        x = 0
+        for i in range(5):
+            if c0 & (1 << i):
+                x ^= gen[i]
+        table.append(x)
+    return tuple(table)
+
+_GENERATOR_TABLE = _make_generator_table()
+
+def _polymod_state(values, c=1):
+    """Feeds values into the checksum state c and returns the new state."""
+    table = _GENERATOR_TABLE
+    for d in values:
+        c = ((c & 0x07ffffffff) << 5) ^ d ^ table[c >> 35]
+    return c
+
 def _polymod(values):
     """Internal function that computes the cashaddr checksum."""
-    c = 1
-    for d in values:
-        c0 = c >> 35
-        c = ((c & 0x07ffffffff) << 5) ^ d
-        if (c0 & 0x01):
-            c ^= 0x98f2bc8e61
-        if (c0 & 0x02):
-            c ^= 0x79b76d99e2
-        if (c0 & 0x04):
-            c ^= 0xf33e5fb3c4
-        if (c0 & 0x08):
-            c ^= 0xae2eabe2a8
-        if (c0 & 0x10):
-            c ^= 0x1e4f43e470
-    retval= c ^ 1
-    return retval
+    return _polymod_state(values) ^ 1
 
 def _prefix_expand(prefix):
     """Expand the prefix into values for checksum computation."""
@@ -47,15 +68,48 @@ def _prefix_expand(prefix):
     retval.append(0)
     return retval
 
+@lru_cache(maxsize=32)
+def _prefix_state(prefix):
+    """The checksum state after the expanded prefix, which is the same for
+    every address of a network."""
+    return _polymod_state(_prefix_expand(prefix))
+
+def _prefixed_polymod(prefix, data):
+    """Same as _polymod(_prefix_expand(prefix) + data)."""
+    return _polymod_state(data, _prefix_state(prefix)) ^ 1
+
 def _create_checksum(prefix, data):
     """Compute the checksum values given prefix and data."""
-    values = _prefix_expand(prefix) + data + bytes(8)
-    polymod = _polymod(values)
+    polymod = _prefixed_polymod(prefix, data + bytes(8))
     # Return the polymod expanded into eight 5-bit elements
     return bytes((polymod >> 5 * (7 - i)) & 31 for i in range(8))
 
+def _values_to_string(values):
+    """Maps 5-bit values to the characters of the cashaddr charset."""
+    return bytes(values).translate(_VALUES_TO_CHARSET).decode('ascii')
+
+def _string_to_values(payload):
+    """Maps cashaddr characters to their 5-bit values. Raises ValueError if
+    there are characters outside the charset."""
+    try:
+        data = payload.encode('ascii').translate(_CHARSET_TO_VALUES)
+    except UnicodeEncodeError:
+        data = b'\xff'
+    if b'\xff' in data:
+        raise ValueError('invalid characters in address: {}'.format(payload))
+    return data
+
 def _convertbits(data, frombits, tobits, pad=True):
     """General power-of-2 base conversion."""
+    if frombits == 8 and tobits == 5 and pad:
+        encoded = base64.b32encode(bytes(data)).rstrip(b'=')
+        return bytearray(encoded.translate(_B32_TO_VALUES))
+    if frombits == 5 and tobits == 8 and not pad and len(data) % 8 in (0, 2, 4, 5, 7):
+        # b32decode drops the leftover bits of the last group, just as the
+        # loop below does without padding
+        encoded = bytes(data).translate(_VALUES_TO_B32)
+        return bytearray(base64.b32decode(encoded + b'=' * (-len(data) % 8)))
+
     acc = 0
     bits = 0
     ret = bytearray()
@@ -121,13 +175,9 @@ def _decode_payload(addr):
     if not (8 <= len(payload) <= 124):
         raise ValueError('address payload has invalid length: {}'
                          .format(len(addr)))
-    try:
-        data = bytes(_CHARSET.find(x) for x in payload)
-    except ValueError:
-        raise ValueError('invalid characters in address: {}'
-                            .format(payload))
+    data = _string_to_values(payload)
 
-    if _polymod(_prefix_expand(prefix) + data):
+    if _prefixed_polymod(prefix, data):
         raise ValueError('invalid checksum in address: {}'.format(addr))
 
     if lower != addr:
@@ -193,7 +243,7 @@ def encode(prefix, kind, addr_hash):
 
     payload = _pack_addr_data(kind, addr_hash)
     checksum = _create_checksum(prefix, payload)
-    return ''.join([_CHARSET[d] for d in (payload + checksum)])
+    return _values_to_string(payload + checksum)
 
 
 def encode_full(prefix, kind, addr_hash):
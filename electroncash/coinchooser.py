@@ -40,45 +40,156 @@ class PRNG:
     def __init__(self, seed):
         self.sha = sha256(seed)
         self.pool = bytearray()
+        self.pos = 0  # bytes of pool already used
+
+    def _refill(self, n):
+        # make sure at least n unused bytes are in the pool
+        if len(self.pool) - self.pos < n:
+            del self.pool[:self.pos]
+            self.pos = 0
+            while len(self.pool) < n:
+                self.pool.extend(self.sha)
+                self.sha = sha256(self.sha)
 
     def get_bytes(self, n):
-        while len(self.pool) < n:
-            self.pool.extend(self.sha)
-            self.sha = sha256(self.sha)
-        result, self.pool = self.pool[:n], self.pool[n:]
+        self._refill(n)
+        result = self.pool[self.pos:self.pos + n]
+        self.pos += n
         return result
 
     def randint(self, start, end):
-        # Returns random integer in [start, end)
+        # Returns random integer in [start, end), from as many big endian
+        # bytes of the pool as it takes to reach end - start
         n = end - start
-        r = 0
-        p = 1
-        while p < n:
-            r = self.get_bytes(1)[0] + (r << 8)
-            p = p << 8
+        r = int.from_bytes(self.get_bytes(((n - 1).bit_length() + 7) // 8), 'big') if n > 1 else 0
         return start + (r % n)
 
     def choice(self, seq):
         return seq[self.randint(0, len(seq))]
 
     def shuffle(self, x):
+        # This is randint(0, i+1) for each i, inlined as it dominates the
+        # coin chooser's time on wallets with many addresses
+        pool, pos = self.pool, self.pos
         for i in reversed(range(1, len(x))):
             # pick an element in x[:i+1] with which to exchange x[i]
-            j = self.randint(0, i+1)
+            k = (i.bit_length() + 7) // 8
+            if len(pool) - pos < k:
+                self.pos = pos
+                self._refill(k)
+                pos = self.pos
+            if k == 2:
+                r = pool[pos] << 8 | pool[pos + 1]
+            elif k == 1:
+                r = pool[pos]
+            else:
+                r = int.from_bytes(pool[pos:pos + k], 'big')
+            j = r % (i + 1)
+            pos += k
             x[i], x[j] = x[j], x[i]
+        self.pos = pos
 
 
 Bucket = namedtuple('Bucket', ['desc', 'size', 'value', 'coins'])
 
+# How many nodes branch_and_bound() may visit before giving up
+BNB_MAX_TRIES = 20000
+
+class SpendTarget:
+    '''What the inputs of a transaction must pay for. Called with a list of
+    buckets it tells whether they are enough; sufficient() and changeless()
+    answer the same for just the total value and size of some buckets, which
+    the selection code keeps as running sums instead of re-adding lists.'''
+
+    def __init__(self, base_size, spent_amount, fee_estimator, dust_threshold):
+        self.base_size = base_size
+        self.spent_amount = spent_amount
+        self.fee_estimator = fee_estimator
+        self.dust_threshold = dust_threshold
+
+    def __call__(self, buckets):
+        return self.sufficient(sum(bucket.value for bucket in buckets),
+                               sum(bucket.size for bucket in buckets))
+
+    def sufficient(self, value, size):
+        return value >= self.spent_amount + self.fee_estimator(size + self.base_size)
+
+    def changeless(self, value, size):
+        '''True if what is left over would not be worth a change output (see
+        change_outputs), i.e. it would all go to the fee.'''
+        return value - self.spent_amount - self.fee_estimator(size + self.base_size + 34) < self.dust_threshold
+
 def strip_unneeded(bkts, sufficient_funds):
     '''Remove buckets that are unnecessary in achieving the spend amount'''
     bkts = sorted(bkts, key = lambda bkt: bkt.value)
+    # totals of bkts[i:], so that each check is O(1)
+    value = size = 0
+    totals = [(0, 0)]
+    for bkt in reversed(bkts):
+        value += bkt.value
+        size += bkt.size
+        totals.append((value, size))
+    totals.reverse()
     for i in range(len(bkts)):
-        if not sufficient_funds(bkts[i + 1:]):
+        if not sufficient_funds.sufficient(*totals[i + 1]):
             return bkts[i:]
     # Shouldn't get here
     return bkts
 
+def branch_and_bound(values, sizes, target, max_tries=BNB_MAX_TRIES):
+    '''Depth-first search for a set of buckets, given as the arrays of their
+    values and sizes, that pays for the transaction with no change left
+    worth an output (target.sufficient() and target.changeless()). Buckets
+    are tried largest first, and a branch is cut as soon as it overshoots or
+    can no longer get there even with all the buckets left. Gives up after
+    max_tries steps. Returns the indices of the chosen buckets, or None.'''
+    order = sorted(range(len(values)), key=lambda i: values[i], reverse=True)
+    n = len(order)
+    # value and size of all the buckets from order[pos:] on
+    rem_values, rem_sizes = [0] * (n + 1), [0] * (n + 1)
+    for pos in reversed(range(n)):
+        rem_values[pos] = rem_values[pos + 1] + values[order[pos]]
+        rem_sizes[pos] = rem_sizes[pos + 1] + sizes[order[pos]]
+    chosen = []  # positions in order of the buckets included
+    value = size = pos = 0
+    for _ in range(max_tries):
+        enough = target.sufficient(value, size)
+        if enough and target.changeless(value, size):
+            return [order[p] for p in chosen]
+        if enough or pos == n or not target.sufficient(value + rem_values[pos], size + rem_sizes[pos]):
+            # undo the last inclusion, and go on without that bucket
+            if not chosen:
+                return None
+            p = chosen.pop()
+            value -= values[order[p]]
+            size -= sizes[order[p]]
+            pos = p + 1
+        else:
+            chosen.append(pos)
+            value += values[order[pos]]
+            size += sizes[order[pos]]
+            pos += 1
+    return None
+
+def estimated_input_sizes(coins, sign_schnorr=False):
+    '''Transaction.estimated_input_size() of each of coins. The estimate of
+    an input without a scriptSig only depends on a few of its fields, so it
+    is computed once per combination of those.'''
+    known = {}
+    sizes = []
+    for coin in coins:
+        key = None
+        if coin.get('type') in ('p2pkh', 'p2pk', 'p2sh') and coin.get('scriptSig') is None:
+            key = (coin['type'], coin.get('num_sig', 1), len(coin.get('x_pubkeys', [None])),
+                   Transaction.estimate_pubkey_size_for_txin(coin))
+        size = known.get(key)
+        if size is None:
+            size = Transaction.estimated_input_size(coin, sign_schnorr=sign_schnorr)
+            if key is not None:
+                known[key] = size
+        sizes.append(size)
+    return sizes
+
 class CoinChooserBase(PrintError):
 
     def keys(self, coins):
@@ -86,15 +197,16 @@ class CoinChooserBase(PrintError):
 
     def bucketize_coins(self, coins, sign_schnorr=False):
         keys = self.keys(coins)
+        sizes = estimated_input_sizes(coins, sign_schnorr=sign_schnorr)
         buckets = defaultdict(list)
-        for key, coin in zip(keys, coins):
+        bucket_sizes = defaultdict(int)
+        for key, coin, size in zip(keys, coins, sizes):
             buckets[key].append(coin)
+            bucket_sizes[key] += size
 
         def make_Bucket(desc, coins):
-            size = sum(Transaction.estimated_input_size(coin, sign_schnorr=sign_schnorr)
-                       for coin in coins)
             value = sum(coin['value'] for coin in coins)
-            return Bucket(desc, size, value, coins)
+            return Bucket(desc, bucket_sizes[desc], value, coins)
 
         return list(map(make_Bucket, buckets.keys(), buckets.values()))
 
@@ -182,12 +294,9 @@ class CoinChooserBase(PrintError):
         base_size = tx.estimated_size()
         spent_amount = tx.output_value()
 
-        def sufficient_funds(buckets):
-            '''Given a list of buckets, return True if it has enough
-            value to pay for the transaction'''
-            total_input = sum(bucket.value for bucket in buckets)
-            total_size = sum(bucket.size for bucket in buckets) + base_size
-            return total_input >= spent_amount + fee_estimator(total_size)
+        # Given a list of buckets, tells whether it has enough value to pay
+        # for the transaction
+        sufficient_funds = SpendTarget(base_size, spent_amount, fee_estimator, dust_threshold)
 
         # Collect the coins into buckets, choose a subset of the buckets
         buckets = self.bucketize_coins(coins, sign_schnorr=sign_schnorr)
@@ -217,10 +326,13 @@ class CoinChooserRandom(CoinChooserBase):
     def bucket_candidates(self, buckets, sufficient_funds):
         '''Returns a list of bucket sets.'''
         candidates = set()
+        # The search below works on these rather than on the buckets
+        values = [bucket.value for bucket in buckets]
+        sizes = [bucket.size for bucket in buckets]
 
         # Add all singletons
         for n, bucket in enumerate(buckets):
-            if sufficient_funds([bucket]):
+            if sufficient_funds.sufficient(values[n], sizes[n]):
                 candidates.add((n,))
 
         # And now some random ones
@@ -230,15 +342,21 @@ class CoinChooserRandom(CoinChooserBase):
             # Get a random permutation of the buckets, and
             # incrementally combine buckets until sufficient
             self.p.shuffle(permutation)
-            bkts = []
+            value = size = 0
             for count, index in enumerate(permutation):
-                bkts.append(buckets[index])
-                if sufficient_funds(bkts):
+                value += values[index]
+                size += sizes[index]
+                if sufficient_funds.sufficient(value, size):
                     candidates.add(tuple(sorted(permutation[:count + 1])))
                     break
             else:
                 raise NotEnoughFunds()
 
+        # And a set that needs no change output, if there is one
+        changeless = branch_and_bound(values, sizes, sufficient_funds)
+        if changeless is not None:
+            candidates.add(tuple(sorted(changeless)))
+
         candidates = [[buckets[n] for n in c] for c in candidates]
         return [strip_unneeded(c, sufficient_funds) for c in candidates]
 
@@ -63,6 +63,10 @@ class Command:
         self.requires_network = 'n' in s
         self.requires_wallet = 'w' in s
         self.requires_password = 'p' in s
+        # 'm': changes the wallet, so is run one at a time per wallet. Other
+        # commands run concurrently (see jsonrpc.py), taking the wallet's
+        # own locks where they need them.
+        self.modifies_wallet = 'm' in s
         self.description = func.__doc__
         self.help = self.description.split('.')[0] if self.description else None
         varnames = func.__code__.co_varnames[1:func.__code__.co_argcount]
@@ -104,6 +108,9 @@ def command(s):
             if c.requires_password and password is None and wallet.storage.get('use_encryption') \
                and not kwargs.get("unsigned"):
                 return {'error': 'Password required' }
+            if c.modifies_wallet:
+                with wallet.command_lock:
+                    return func(*args, **kwargs)
             return func(*args, **kwargs)
         return func_wrapper
     return decorator
@@ -198,7 +205,7 @@ class Commands:
             'msg': d['msg'],
         }
 
-    @command('wp')
+    @command('wpm')
     def password(self, password=None, new_password=None):
         """Change wallet password. """
         b = self.wallet.storage.is_encrypted()
@@ -348,13 +355,13 @@ class Commands:
         address = bitcoin.hash160_to_p2sh(hash_160(bfh(redeem_script)))
         return {'address':address, 'redeemScript':redeem_script}
 
-    @command('w')
+    @command('wm')
     def freeze(self, address):
         """Freeze address. Freeze the funds at one of your wallet\'s addresses"""
         address = Address.from_string(address)
         return self.wallet.set_frozen_state([address], True)
 
-    @command('w')
+    @command('wm')
     def unfreeze(self, address):
         """Unfreeze address. Unfreeze the funds at one of your wallet\'s address"""
         address = Address.from_string(address)
@@ -363,14 +370,12 @@ class Commands:
     @command('wp')
     def getprivatekeys(self, address, password=None):
         """Get private keys of addresses. You may pass a single wallet address, or a list of wallet addresses."""
-        def get_pk(address):
-            address = Address.from_string(address)
-            return self.wallet.export_private_key(address, password)
-
         if isinstance(address, str):
-            return get_pk(address)
+            return self.wallet.export_private_key(Address.from_string(address), password)
         else:
-            return [get_pk(addr) for addr in address]
+            addresses = [Address.from_string(addr) for addr in address]
+            keys = self.wallet.export_private_keys(addresses, password)
+            return [keys[addr] for addr in addresses]
 
     @command('w')
     def ismine(self, address):
@@ -427,6 +432,38 @@ class Commands:
         """Return the list of available servers"""
         return self.network.get_servers()
 
+    @command('')
+    def txcachestats(self):
+        """Return the size of the in-memory cache of fetched transactions, and
+        its hit, miss and eviction counts since startup."""
+        return Transaction.tx_cache_stats()
+
+    @command('')
+    def profilerstats(self, reset=False):
+        """Return the call counts and timings (total, mean, p50, p99 and max,
+        in seconds) of the profiled functions, such as wallet loading and
+        history checks, since startup (or the last reset)."""
+        return util.profiler_stats(reset=reset)
+
+    @command('')
+    def rpcstats(self, reset=False):
+        """Return the call counts and timings (total, mean, p50, p99 and max,
+        in seconds) of the daemon's JSON-RPC methods since startup (or the
+        last reset)."""
+        from .jsonrpc import method_stats
+        return method_stats(reset=reset)
+
+    @command('')
+    def secp256k1stats(self, reset=False):
+        """Return libsecp256k1's counts of point multiplications, field
+        inversions and square roots since startup (or the last reset). Only
+        available when the library was built with ENABLE_STATS."""
+        from . import secp256k1
+        stats = secp256k1.context_stats(reset=reset)
+        if stats is None:
+            raise BaseException('libsecp256k1 was built without ENABLE_STATS')
+        return stats
+
     @command('')
     def version(self):
         """Return the version of Electron Cash."""
@@ -449,7 +486,7 @@ class Commands:
         s = self.wallet.get_seed(password)
         return s
 
-    @command('wp')
+    @command('wpm')
     def importprivkey(self, privkey, password=None):
         """Import a private key."""
         if not self.wallet.can_import_privkey():
@@ -548,19 +585,19 @@ class Commands:
             return {'error': 'This command may only be used on an RPA wallet.'}
         return rpa.paycode.generate_paycode(self.wallet)
 
-    @command('w')
+    @command('wm')
     def rpa_generate_transaction_from_paycode(self, amount, paycode):
         # WARNING: Amount is in full Bitcoin Cash units
         return rpa.paycode.generate_transaction_from_paycode(self.wallet, self.config, amount, paycode)
 
-    @command('wp')
+    @command('wpm')
     def rpa_extract_private_keys_from_transaction(self, raw_tx, password=None):
         if self.wallet.wallet_type != 'rpa':
             return {'error': 'This command may only be used on an RPA wallet.'}
 
         return rpa.paycode.extract_private_keys_from_transaction(self.wallet, raw_tx, password)
 
-    @command('wp')
+    @command('wpm')
     def payto(self, destination, amount, fee=None, feerate=None, from_addr=None, change_addr=None, nocheck=False, unsigned=False, password=None, locktime=None,
               op_return=None, op_return_raw=None, addtransaction=False):
         """Create a transaction. """
@@ -569,7 +606,7 @@ class Commands:
         tx = self._mktx([(destination, amount)], tx_fee, feerate, change_addr, domain, nocheck, unsigned, password, locktime, op_return, op_return_raw, addtransaction=addtransaction)
         return tx.as_dict()
 
-    @command('wp')
+    @command('wpm')
     def paytomany(self, outputs, fee=None, feerate=None, from_addr=None, change_addr=None, nocheck=False, unsigned=False, password=None, locktime=None, addtransaction=False):
         """Create a multi-output transaction. """
         tx_fee = satoshis(fee)
@@ -621,7 +658,7 @@ class Commands:
                 kwargs['fee_calc_timeout'] = time_remaining()  # since we blocked above, recompute time_remaining for kwargs
         return self.wallet.export_history(**kwargs)
 
-    @command('w')
+    @command('wm')
     def setlabel(self, key, label):
         """Assign a label to an item. Item may be a bitcoin address address or a
         transaction ID"""
@@ -752,18 +789,18 @@ class Commands:
             out = list(filter(lambda x: x.get('status')==f, out))
         return list(map(self._format_request, out))
 
-    @command('w')
+    @command('wm')
     def createnewaddress(self):
         """Create a new receiving address, beyond the gap limit of the wallet"""
         return self.wallet.create_new_address(False).to_ui_string()
 
-    @command('w')
+    @command('wm')
     def getunusedaddress(self):
         """Returns the first unused address of the wallet, or None if all addresses are used.
         An address is considered as used if it has received a transaction, or if it is used in a payment request."""
         return self.wallet.get_unused_address().to_ui_string()
 
-    @command('w')
+    @command('wm')
     def addrequest(self, amount, memo='', expiration=None, force=False, payment_url=None, index_url=None):
         """Create a payment request, using the first unused address of the wallet.
         The address will be condidered as used after this operation.
@@ -785,7 +822,7 @@ class Commands:
         out = self.wallet.get_payment_request(addr, self.config)
         return self._format_request(out)
 
-    @command('wp')
+    @command('wpm')
     def signrequest(self, address, password=None):
         "Sign payment request with an OpenAlias"
         alias = self.config.get('alias')
@@ -797,12 +834,12 @@ class Commands:
             raise RuntimeError('Alias could not be resolved')
         self.wallet.sign_payment_request(address, alias, alias_addr, password)
 
-    @command('w')
+    @command('wm')
     def rmrequest(self, address):
         """Remove a payment request"""
         return self.wallet.remove_payment_request(address, self.config)
 
-    @command('w')
+    @command('wm')
     def clearrequests(self):
         """Remove all payment requests"""
         for k in list(self.wallet.receive_requests.keys()):
@@ -896,6 +933,7 @@ command_options = {
     'pending':     (None, "Show only pending requests."),
     'privkey':     (None, "Private key. Set to '?' to get a prompt."),
     'receiving':   (None, "Show only receiving addresses"),
+    'reset':       (None, "Zero the counters after reading them"),
     'seed_type':   (None, "The type of seed to create, currently: 'electrum' and 'bip39' is supported. Default 'bip39'."),
     'show_addresses': (None, "Show input and output addresses"),
     'show_fiat':   (None, "Show fiat value of transactions"),
@@ -1036,7 +1074,7 @@ def get_parser():
     add_global_options(parser_gui)
     # daemon
     parser_daemon = subparsers.add_parser('daemon', help="Run Daemon")
-    parser_daemon.add_argument("subcommand", nargs='?', help="start, stop, status, load_wallet, close_wallet. Other commands may be added by plugins.")
+    parser_daemon.add_argument("subcommand", nargs='?', help="start, stop, status, stats, load_wallet, close_wallet. Other commands may be added by plugins.")
     parser_daemon.add_argument("subargs", nargs='*', metavar='arg', help="additional arguments (used by plugins)")
     #parser_daemon.set_defaults(func=run_daemon)
     add_network_options(parser_daemon)
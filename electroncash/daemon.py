@@ -26,6 +26,7 @@ import ast
 import os
 import time
 import sys
+import threading
 
 # from jsonrpc import JSONRPCResponseManager
 import jsonrpclib
@@ -36,7 +37,7 @@ from .network import Network
 from .util import (json_decode, DaemonThread, print_error, to_string,
                    standardize_path)
 from .wallet import Wallet
-from .storage import WalletStorage
+from .storage import WalletStorage, delete_wallet_file
 from .commands import known_commands, Commands
 from .simple_config import SimpleConfig
 from .exchange_rate import FxThread
@@ -158,6 +159,9 @@ class Daemon(DaemonThread):
         self.gui = None
         self.server = None
         self.wallets = {}
+        # The JSON-RPC server handles requests concurrently; the daemon
+        # subcommands (load_wallet, close_wallet, ...) still go one at a time
+        self.daemon_cmd_lock = threading.Lock()
         if listen_jsonrpc:
             # Setup JSONRPC server
             self.init_server(config, fd, is_gui)
@@ -169,7 +173,8 @@ class Daemon(DaemonThread):
         rpc_user, rpc_password = get_rpc_credentials(config)
         try:
             server = VerifyingJSONRPCServer((host, port), logRequests=False,
-                                            rpc_user=rpc_user, rpc_password=rpc_password)
+                                            rpc_user=rpc_user, rpc_password=rpc_password,
+                                            max_workers=config.get('rpcthreads', 8))
         except Exception as e:
             self.print_error('Warning: cannot initialize RPC server on host', host, e)
             os.close(fd)
@@ -190,11 +195,15 @@ class Daemon(DaemonThread):
         return True
 
     def run_daemon(self, config_options):
+        with self.daemon_cmd_lock:
+            return self._run_daemon(config_options)
+
+    def _run_daemon(self, config_options):
         config = SimpleConfig(config_options)
         sub = config.get('subcommand')
         subargs = config.get('subargs')
         plugin_cmd = self.plugins and self.plugins.daemon_commands.get(sub)
-        if subargs and sub in [None, 'start', 'stop', 'status']:
+        if subargs and sub in [None, 'start', 'stop', 'status', 'stats']:
             return "Unexpected arguments: {!r}. {!r} takes no options.".format(subargs, sub)
         if subargs and sub in ['load_wallet', 'close_wallet']:
             return "Unexpected arguments: {!r}. Provide options to {!r} using the -w and -wp options.".format(subargs, sub)
@@ -230,6 +239,17 @@ class Daemon(DaemonThread):
                 }
             else:
                 response = "Daemon offline"
+        elif sub == 'stats':
+            # Per wallet: its requests in the network's fair queue, and the
+            # worker thread its synchronizer runs on
+            requests = self.network.get_request_stats() if self.network else {}
+            response = {
+                k: {
+                    'requests': requests.get(w.diagnostic_name()),
+                    'worker': w.job_worker.get_stats() if w.job_worker else None,
+                }
+                for k, w in self.wallets.items()
+            }
         elif sub == 'stop':
             self.stop()
             response = "Daemon stopped"
@@ -273,6 +293,9 @@ class Daemon(DaemonThread):
             return
         if storage.get_action():
             return
+        binary_tables = self.config.get('wallet_binary_tables')
+        if binary_tables is not None:
+            storage.set_binary_tables(binary_tables)
         wallet = Wallet(storage)
         wallet.start_threads(self.network)
         self.wallets[path] = wallet
@@ -288,7 +311,7 @@ class Daemon(DaemonThread):
     def delete_wallet(self, path):
         self.stop_wallet(path)
         if os.path.exists(path):
-            os.unlink(path)
+            delete_wallet_file(path)
             return True
         return False
 
@@ -331,6 +354,8 @@ class Daemon(DaemonThread):
     def run(self):
         while self.is_running():
             self.server.handle_request() if self.server else time.sleep(0.1)
+        if self.server:
+            self.server.server_close()
         for k, wallet in self.wallets.items():
             wallet.stop_threads()
         if self.network:
@@ -9,7 +9,7 @@ import os
 import sys
 import traceback
 import ecdsa
-from ctypes import (byref, c_size_t, create_string_buffer)
+from ctypes import (byref, c_char_p, c_size_t, c_uint, c_void_p, create_string_buffer)
 
 from .util import print_error, print_msg
 from . import secp256k1
@@ -42,8 +42,13 @@ def _prepare_monkey_patching_of_python_ecdsa_internals_with_libsecp256k1():
             return point_at_infinity
         pubkey = create_string_buffer(64)
         public_pair_bytes = b'\4' + int(self.x()).to_bytes(32, byteorder="big") + int(self.y()).to_bytes(32, byteorder="big")
-        r = secp256k1.secp256k1.secp256k1_ec_pubkey_parse(
-            secp256k1.secp256k1.ctx, pubkey, public_pair_bytes, len(public_pair_bytes))
+        cache = secp256k1.thread_pubkey_cache()
+        if cache:
+            r = secp256k1.secp256k1.secp256k1_pubkey_cache_parse(
+                secp256k1.secp256k1.ctx, cache, pubkey, public_pair_bytes, len(public_pair_bytes))
+        else:
+            r = secp256k1.secp256k1.secp256k1_ec_pubkey_parse(
+                secp256k1.secp256k1.ctx, pubkey, public_pair_bytes, len(public_pair_bytes))
         if not r:
             return False
         r = secp256k1.secp256k1.secp256k1_ec_pubkey_tweak_mul(secp256k1.secp256k1.ctx, pubkey, int(other).to_bytes(32, byteorder="big"))
@@ -89,6 +94,11 @@ def _prepare_monkey_patching_of_python_ecdsa_internals_with_libsecp256k1():
         r = secp256k1.secp256k1.secp256k1_ecdsa_signature_normalize(secp256k1.secp256k1.ctx, sig, sig)
 
         public_pair_bytes = b'\4' + int(self.point.x()).to_bytes(32, byteorder="big") + int(self.point.y()).to_bytes(32, byteorder="big")
+        cache = _secp256k1_ecdsa_verify_cached and secp256k1.thread_pubkey_cache()
+        if cache:
+            return 1 == _secp256k1_ecdsa_verify_cached(
+                secp256k1.secp256k1.ctx, cache, sig, int(hash).to_bytes(32, byteorder="big"),
+                public_pair_bytes, len(public_pair_bytes))
         pubkey = create_string_buffer(64)
         r = secp256k1.secp256k1.secp256k1_ec_pubkey_parse(
             secp256k1.secp256k1.ctx, pubkey, public_pair_bytes, len(public_pair_bytes))
@@ -139,4 +149,208 @@ def is_using_fast_ecc():
     return _patched_functions.monkey_patching_active
 
 
+_secp256k1_ecdsa_verify_cached = secp256k1.has_pubkey_cache() and secp256k1.bind('secp256k1_ecdsa_verify_cached', [c_void_p, c_void_p, c_char_p, c_char_p, c_char_p, c_size_t])
+
+_secp256k1_ec_pubkey_create_batch = secp256k1.bind('secp256k1_ec_pubkey_create_batch', [ c_void_p, c_char_p, c_size_t, c_char_p, c_size_t, c_uint ])
+
+def has_fast_pubkey_create_batch():
+    """Does pubkey_create_batch() compute the public keys natively?"""
+    return bool(_secp256k1_ec_pubkey_create_batch)
+
+_secp256k1_ec_pubkey_tweak_add_batch = secp256k1.bind('secp256k1_ec_pubkey_tweak_add_batch', [ c_void_p, c_char_p, c_size_t, c_char_p, c_char_p, c_size_t, c_uint ])
+
+def has_fast_pubkey_tweak_add_batch():
+    """Does pubkey_tweak_add_batch() tweak the public keys natively?"""
+    return bool(_secp256k1_ec_pubkey_tweak_add_batch)
+
+_secp256k1_ec_pubkey_tweak_mul_batch = secp256k1.bind('secp256k1_ec_pubkey_tweak_mul_batch', [ c_void_p, c_char_p, c_size_t, c_char_p, c_char_p, c_size_t, c_uint ])
+
+def has_fast_pubkey_tweak_mul_batch():
+    """Does pubkey_tweak_mul_batch() multiply the public key natively?"""
+    return bool(_secp256k1_ec_pubkey_tweak_mul_batch)
+
+_secp256k1_sha256d64_multi = secp256k1.bind('secp256k1_sha256d64_multi', [ c_void_p, c_char_p, c_char_p, c_size_t ])
+
+def has_fast_sha256d64_multi():
+    """Does sha256d64_multi() hash the blocks natively?"""
+    return bool(_secp256k1_sha256d64_multi)
+
+_secp256k1_merkle_roots = secp256k1.bind('secp256k1_merkle_roots', [ c_void_p, c_char_p, c_char_p, c_char_p, c_void_p, c_void_p, c_size_t ])
+
+def has_fast_merkle_roots():
+    """Does merkle_roots() compute the roots natively?"""
+    return bool(_secp256k1_merkle_roots)
+
+_secp256k1_sha256d_affixed_multi = secp256k1.bind('secp256k1_sha256d_affixed_multi', [ c_void_p, c_char_p, c_char_p, c_size_t, c_char_p, c_void_p, c_char_p, c_size_t, c_size_t ])
+
+def has_fast_sha256d_affixed_multi():
+    """Does sha256d_affixed_multi() hash the messages natively?"""
+    return bool(_secp256k1_sha256d_affixed_multi)
+
+_secp256k1_ecdsa_sign_grind = secp256k1.bind('secp256k1_ecdsa_sign_grind', [ c_void_p, c_char_p, c_char_p, c_char_p, c_size_t ])
+
+def has_fast_ecdsa_sign_grind():
+    """Does ecdsa_sign_grind() grind the signatures natively?"""
+    return bool(_secp256k1_ecdsa_sign_grind)
+
+def pubkey_create_batch(secrets, compressed):
+    """Compute the serialized public keys (as bytes) for a sequence of 32-byte
+    secrets in a single native call, sharing one field inversion across the
+    whole batch.
+
+    Returns None if the native function is unavailable or if any of the
+    secrets is not a valid private key; callers should then fall back to
+    computing the keys one at a time."""
+    if not _secp256k1_ec_pubkey_create_batch:
+        return None
+    secrets = list(secrets)
+    if not all(len(s) == 32 for s in secrets):
+        return None
+    if compressed:
+        outlen, flags = 33, secp256k1.SECP256K1_EC_COMPRESSED
+    else:
+        outlen, flags = 65, secp256k1.SECP256K1_EC_UNCOMPRESSED
+    n = len(secrets)
+    output = create_string_buffer(outlen * n)
+    res = _secp256k1_ec_pubkey_create_batch(secp256k1.thread_context(), output, outlen,
+                                            b''.join(secrets), n, flags)
+    if not res:
+        return None
+    raw = output.raw
+    return [raw[i*outlen:(i+1)*outlen] for i in range(n)]
+
+def pubkey_tweak_add_batch(pubkey, tweaks, compressed):
+    """Compute pubkey + tweak*G for each 32-byte tweak in a single native
+    call, returning the serialized results (as bytes). pubkey is a serialized
+    public key.
+
+    Returns None if the native function is unavailable, if pubkey does not
+    parse, or if any of the tweaks is out of range or yields the point at
+    infinity; callers should then fall back to tweaking one key at a time."""
+    if not _secp256k1_ec_pubkey_tweak_add_batch:
+        return None
+    tweaks = list(tweaks)
+    if not all(len(t) == 32 for t in tweaks):
+        return None
+    ctx = secp256k1.thread_context()
+    parsed = create_string_buffer(64)
+    if not secp256k1.secp256k1.secp256k1_ec_pubkey_parse(ctx, parsed, pubkey, len(pubkey)):
+        return None
+    if compressed:
+        outlen, flags = 33, secp256k1.SECP256K1_EC_COMPRESSED
+    else:
+        outlen, flags = 65, secp256k1.SECP256K1_EC_UNCOMPRESSED
+    n = len(tweaks)
+    output = create_string_buffer(outlen * n)
+    res = _secp256k1_ec_pubkey_tweak_add_batch(ctx, output, outlen, parsed,
+                                               b''.join(tweaks), n, flags)
+    if not res:
+        return None
+    raw = output.raw
+    return [raw[i*outlen:(i+1)*outlen] for i in range(n)]
+
+def pubkey_tweak_mul_batch(pubkey, tweaks, compressed):
+    """Compute tweak*pubkey for each 32-byte tweak in a single native call,
+    returning the serialized results (as bytes). pubkey is a serialized public
+    key. The multiplications run in constant time, so the tweaks may be secret.
+
+    Returns None if the native function is unavailable, if pubkey does not
+    parse, or if any of the tweaks is zero or out of range; callers should then
+    fall back to multiplying one key at a time."""
+    if not _secp256k1_ec_pubkey_tweak_mul_batch:
+        return None
+    tweaks = list(tweaks)
+    if not all(len(t) == 32 for t in tweaks):
+        return None
+    ctx = secp256k1.thread_context()
+    parsed = create_string_buffer(64)
+    if not secp256k1.secp256k1.secp256k1_ec_pubkey_parse(ctx, parsed, pubkey, len(pubkey)):
+        return None
+    if compressed:
+        outlen, flags = 33, secp256k1.SECP256K1_EC_COMPRESSED
+    else:
+        outlen, flags = 65, secp256k1.SECP256K1_EC_UNCOMPRESSED
+    n = len(tweaks)
+    output = create_string_buffer(outlen * n)
+    res = _secp256k1_ec_pubkey_tweak_mul_batch(ctx, output, outlen, parsed,
+                                               b''.join(tweaks), n, flags)
+    if not res:
+        return None
+    raw = output.raw
+    return [raw[i*outlen:(i+1)*outlen] for i in range(n)]
+
+def sha256d64_multi(data):
+    """Double SHA-256 each consecutive 64-byte block of data in a single native
+    call, returning the 32-byte digests concatenated in the same order.
+
+    Returns None if the native function is unavailable; callers should then
+    fall back to hashing one block at a time."""
+    if not _secp256k1_sha256d64_multi:
+        return None
+    n, rem = divmod(len(data), 64)
+    if rem:
+        raise ValueError("data length must be a multiple of 64")
+    output = create_string_buffer(32 * n)
+    _secp256k1_sha256d64_multi(secp256k1.secp256k1.ctx, output, bytes(data), n)
+    return output.raw
+
+def merkle_roots(leaves, branches, positions):
+    """Compute the merkle roots of many transactions in a single native call.
+    leaves are the 32-byte tx hashes, branches the matching lists of 32-byte
+    branch hashes (leaf first) and positions the indices of the txs in their
+    blocks. All hashes are in serialized byte order.
+
+    Returns the list of 32-byte roots, or None if the native function is
+    unavailable; callers should then fall back to hashing in Python."""
+    if not _secp256k1_merkle_roots:
+        return None
+    n = len(leaves)
+    output = create_string_buffer(32 * n)
+    _secp256k1_merkle_roots(secp256k1.secp256k1.ctx, output, b''.join(leaves),
+                            b''.join(b''.join(branch) for branch in branches),
+                            (c_size_t * n)(*(len(branch) for branch in branches)),
+                            (c_size_t * n)(*positions), n)
+    raw = output.raw
+    return [raw[i*32:(i+1)*32] for i in range(n)]
+
+def sha256d_affixed_multi(prefix, middles, suffix):
+    """Double SHA-256 prefix + middle + suffix for each bytes object in middles
+    in a single native call, hashing the shared prefix only once.
+
+    Returns the list of 32-byte digests, or None if the native function is
+    unavailable; callers should then fall back to hashing in Python."""
+    if not _secp256k1_sha256d_affixed_multi:
+        return None
+    n = len(middles)
+    output = create_string_buffer(32 * n)
+    _secp256k1_sha256d_affixed_multi(secp256k1.secp256k1.ctx, output, prefix, len(prefix),
+                                     b''.join(middles), (c_size_t * n)(*(len(m) for m in middles)),
+                                     suffix, len(suffix), n)
+    raw = output.raw
+    return [raw[i*32:(i+1)*32] for i in range(n)]
+
+# The largest DER signature ecdsa_sign_grind() accepts for grind=True: a low R.
+GRIND_LOW_R_DER_LEN = 70
+
+def ecdsa_sign_grind(seckey, msghash, max_der_len=GRIND_LOW_R_DER_LEN):
+    """Sign the 32-byte msghash with the 32-byte seckey, grinding the nonce
+    inside the library until the DER encoding of the signature is at most
+    max_der_len bytes. The first attempt is the usual deterministic
+    signature, so a signature that already fits is unchanged.
+
+    Returns the DER signature, or None if the native function is unavailable
+    or no signature fit within its attempts; callers should then sign
+    without grinding."""
+    if not _secp256k1_ecdsa_sign_grind:
+        return None
+    ctx = secp256k1.thread_context()
+    sig = create_string_buffer(64)
+    if not _secp256k1_ecdsa_sign_grind(ctx, sig, msghash, seckey, max_der_len):
+        return None
+    der = create_string_buffer(72)
+    derlen = c_size_t(72)
+    secp256k1.secp256k1.secp256k1_ecdsa_signature_serialize_der(ctx, der, byref(derlen), sig)
+    return der.raw[:derlen.value]
+
+
 _prepare_monkey_patching_of_python_ecdsa_internals_with_libsecp256k1()
@@ -1,3 +1,5 @@
+from array import array
+from bisect import bisect_left
 from datetime import datetime
 import inspect
 import requests
@@ -9,6 +11,7 @@ from threading import Thread
 import time
 import csv
 import decimal
+import struct
 from decimal import Decimal as PyDecimal  # Qt 5.12 also exports Decimal
 from collections import defaultdict
 
@@ -31,10 +34,84 @@ CCY_PRECISIONS = {'BHD': 3, 'BIF': 0, 'BYR': 0, 'CLF': 4, 'CLP': 0,
                   'VUV': 0, 'XAF': 0, 'XAU': 4, 'XOF': 0, 'XPF': 0}
 
 
+class RateHistory:
+    ''' The daily rates of one currency, as two parallel arrays sorted by day,
+    a day being the proleptic Gregorian ordinal of a date.
+
+    On disk it's a flat run of (day, rate) records, in the same order, so that
+    a newer history which only differs from the cached one in its last few
+    days is written by rewriting just those (see write()). '''
+
+    _record = struct.Struct('<Id')
+
+    def __init__(self, days=(), rates=()):
+        self.days = array('l', days)
+        self.rates = array('d', rates)
+        assert len(self.days) == len(self.rates)
+
+    @classmethod
+    def from_dict(cls, d):
+        ''' From a dict of 'YYYY-MM-DD' -> rate, as request_history returns. '''
+        items = sorted((datetime.strptime(k, '%Y-%m-%d').toordinal(), float(v))
+                       for k, v in d.items() if v is not None)
+        return cls((day for day, _ in items), (rate for _, rate in items))
+
+    @classmethod
+    def read(cls, filename):
+        with open(filename, 'rb') as f:
+            data = f.read()
+        data = data[:len(data) - len(data) % cls._record.size]  # drop a partial last record
+        h = cls()
+        for day, rate in cls._record.iter_unpack(data):
+            if h.days and day <= h.days[-1]:
+                raise ValueError(f"{filename} is not sorted")
+            h.days.append(day)
+            h.rates.append(rate)
+        return h
+
+    def write(self, filename, start=0):
+        ''' Writes the records from index `start` on over the ones in the file,
+        which must already have those before it. '''
+        with open(filename, 'r+b' if start else 'wb') as f:
+            f.seek(start * self._record.size)
+            f.truncate()
+            f.write(b''.join(self._record.pack(self.days[i], self.rates[i])
+                             for i in range(start, len(self.days))))
+        os.utime(filename)  # the age of the file is the age of the history
+
+    def common_prefix(self, other):
+        ''' The number of leading records self and other have in common. '''
+        n = min(len(self.days), len(other.days))
+        i = 0
+        while i < n and self.days[i] == other.days[i] and self.rates[i] == other.rates[i]:
+            i += 1
+        return i
+
+    def __len__(self):
+        return len(self.days)
+
+    def get(self, day):
+        i = bisect_left(self.days, day)
+        if i < len(self.days) and self.days[i] == day:
+            return self.rates[i]
+
+    def get_many(self, days):
+        ''' [self.get(day) for day in days], in one pass over the days sorted,
+        each search starting where the one before it ended. '''
+        rates = [None] * len(days)
+        lo, n = 0, len(self.days)
+        for k in sorted(range(len(days)), key=days.__getitem__):
+            day = days[k]
+            lo = bisect_left(self.days, day, lo)
+            if lo < n and self.days[lo] == day:
+                rates[k] = self.rates[lo]
+        return rates
+
+
 class ExchangeBase(PrintError):
 
     def __init__(self, on_quotes, on_history):
-        self.history = {}
+        self.history = {}  # ccy -> RateHistory
         self.history_timestamps = defaultdict(float)
         self.quotes = {}
         self.on_quotes = on_quotes
@@ -78,8 +155,7 @@ class ExchangeBase(PrintError):
         if os.path.exists(filename):
             timestamp = os.stat(filename).st_mtime
             try:
-                with open(filename, 'r', encoding='utf-8') as f:
-                    h = json.loads(f.read())
+                h = RateHistory.read(filename)
                 if h:
                     self.print_error("read_historical_rates: returning cached history from", filename)
             except Exception as e:
@@ -88,7 +164,7 @@ class ExchangeBase(PrintError):
         return h, timestamp
 
     def _get_cache_filename(self, ccy, cache_dir):
-        return os.path.join(cache_dir, self.name() + '_' + ccy)
+        return os.path.join(cache_dir, self.name() + '_' + ccy + '.rates')
 
     @staticmethod
     def _is_timestamp_old(timestamp):
@@ -98,19 +174,21 @@ class ExchangeBase(PrintError):
     def is_historical_rate_old(self, ccy):
         return self._is_timestamp_old(self.history_timestamps.get(ccy, 0.0))
 
-    def _cache_historical_rates(self, h, ccy, cache_dir):
-        ''' Writes the history, h, to the cache file. Catches its own exceptions
-        and always returns successfully, even if the write process failed. '''
-        wroteBytes, filename = 0, '(none)'
+    def _cache_historical_rates(self, h, ccy, cache_dir, cached=None):
+        ''' Writes the history, h, to the cache file, which holds `cached` if
+        not None. Only the days from where they differ on are written. Catches
+        its own exceptions and always returns successfully, even if the write
+        process failed. '''
+        wroteRecords, filename = 0, '(none)'
         try:
             filename = self._get_cache_filename(ccy, cache_dir)
-            with open(filename, 'w', encoding='utf-8') as f:
-                f.write(json.dumps(h))
-            wroteBytes = os.stat(filename).st_size
+            start = h.common_prefix(cached) if cached else 0
+            h.write(filename, start)
+            wroteRecords = len(h) - start
         except Exception as e:
             self.print_error("cache_historical_rates error:", repr(e))
             return False
-        self.print_error(f"cache_historical_rates: wrote {wroteBytes} bytes to file {filename}")
+        self.print_error(f"cache_historical_rates: wrote {wroteRecords} days to file {filename}")
         return True
 
     def get_historical_rates_safe(self, ccy, cache_dir):
@@ -118,13 +196,13 @@ class ExchangeBase(PrintError):
         if not h or self._is_timestamp_old(timestamp):
             try:
                 self.print_error("requesting fx history for", ccy)
-                h = self.request_history(ccy)
+                cached, h = h, RateHistory.from_dict(self.request_history(ccy) or {})
                 self.print_error("received fx history for", ccy)
                 if not h:
                     # Paranoia: No data; abort early rather than write out an
                     # empty file
                     raise RuntimeWarning(f"received empty history for {ccy}")
-                self._cache_historical_rates(h, ccy, cache_dir)
+                self._cache_historical_rates(h, ccy, cache_dir, cached)
             except Exception as e:
                 self.print_error("failed fx history:", repr(e))
                 return
@@ -145,7 +223,14 @@ class ExchangeBase(PrintError):
         return []
 
     def historical_rate(self, ccy, d_t):
-        return self.history.get(ccy, {}).get(d_t.strftime('%Y-%m-%d'))
+        return self.historical_rates(ccy, [d_t])[0]
+
+    def historical_rates(self, ccy, d_ts):
+        ''' The rate on the date of each of the datetimes d_ts, or None. '''
+        h = self.history.get(ccy)
+        if not h:
+            return [None] * len(d_ts)
+        return h.get_many([d_t.toordinal() for d_t in d_ts])
 
     def get_currencies(self):
         rates = self.get_rates('')
@@ -477,18 +562,31 @@ class FxThread(ThreadJob):
                 else int(PyDecimal(fiat) / rate * COIN))
 
     def history_rate(self, d_t):
-        rate = self.exchange.historical_rate(self.ccy, d_t)
-        # Frequently there is no rate for today, until tomorrow :)
-        # Use spot quotes in that case
-        if rate is None and (datetime.today().date() - d_t.date()).days <= 2:
-            rate = self.exchange.quotes.get(self.ccy)
-            self.history_used_spot = True
-        return PyDecimal(rate) if rate is not None else None
+        return self.history_rates([d_t])[0]
+
+    def history_rates(self, d_ts):
+        ''' history_rate for each of d_ts, looked up together. '''
+        today = datetime.today().date()
+        rates = []
+        for d_t, rate in zip(d_ts, self.exchange.historical_rates(self.ccy, d_ts)):
+            # Frequently there is no rate for today, until tomorrow :)
+            # Use spot quotes in that case
+            if rate is None and (today - d_t.date()).days <= 2:
+                rate = self.exchange.quotes.get(self.ccy)
+                self.history_used_spot = True
+            rates.append(PyDecimal(rate) if rate is not None else None)
+        return rates
 
     def historical_value_str(self, satoshis, d_t):
         rate = self.history_rate(d_t)
         return self.value_str(satoshis, rate)
 
+    def historical_value_strs(self, satoshis_list, d_ts):
+        ''' historical_value_str for each pair of satoshis_list and d_ts, e.g.
+        for a whole page of the history at once. '''
+        return [self.value_str(satoshis, rate)
+                for satoshis, rate in zip(satoshis_list, self.history_rates(d_ts))]
+
     def historical_value(self, satoshis, d_t):
         rate = self.history_rate(d_t)
         if rate:
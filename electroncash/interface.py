@@ -326,6 +326,13 @@ class Interface(util.PrintError):
         self.unsent_requests = []
         self.unanswered_requests = {}
         self.last_send = time.time()
+        # Responses already read off the wire as part of a batch array but not
+        # yet returned by get_responses()
+        self.unread_responses = []
+        # wire id -> time sent, for the latency estimate below
+        self.request_send_times = {}
+        # Moving average of the response time in seconds, None until measured
+        self.latency = None
 
         self.mode = None
 
@@ -385,6 +392,23 @@ class Interface(util.PrintError):
             l[1] = chunkSize
         config.set_key("network_unanswered_requests_throttle", l)
 
+    req_batch_size_default = 50
+
+    @classmethod
+    def get_req_batch_size(cls, config):
+        """Returns the maximum number of requests to put into a single JSON-RPC
+        batch array. A value of 1 disables batching."""
+        n = config and config.get("network_request_batch_size")
+        if not isinstance(n, int) or n < 1:
+            n = cls.req_batch_size_default
+        return n
+
+    @classmethod
+    def set_req_batch_size(cls, config, n):
+        if not config:
+            return
+        config.set_key("network_request_batch_size", max(int(n), 1))
+
     def num_requests(self):
         """If there are more than tup.max (default: 2000) unanswered requests,
         don't send any more. Otherwise send more requests, but not more than tup.chunkSize
@@ -409,7 +433,14 @@ class Interface(util.PrintError):
             n = self.num_requests()
             wire_requests = self.unsent_requests[0:n]
 
-            self.pipe.send_all([make_dict(*r) for r in wire_requests])
+            # Up to batch_size requests go out as one JSON-RPC batch array; the
+            # server answers each array with an array, saving round trips.
+            batch_size = self.get_req_batch_size(self.config)
+            messages = [make_dict(*r) for r in wire_requests]
+            if batch_size > 1 and len(messages) > 1:
+                batches = [messages[i:i + batch_size] for i in range(0, len(messages), batch_size)]
+                messages = [b if len(b) > 1 else b[0] for b in batches]
+            self.pipe.send_all(messages)
         except util.timeout:
             # this is OK, the send is in the pipe and we'll flush it out
             # eventually.
@@ -422,12 +453,24 @@ class Interface(util.PrintError):
             return False
 
         self.unsent_requests = self.unsent_requests[n:]
+        now = time.time()
         for request in wire_requests:
             if self.debug:
                 self.print_error("-->", request)
             self.unanswered_requests[request[2]] = request
+            self.request_send_times[request[2]] = now
         return True
 
+    def load(self):
+        """Number of requests queued on or in flight to this server."""
+        return len(self.unsent_requests) + len(self.unanswered_requests)
+
+    def _note_response_time(self, wire_id):
+        sent = self.request_send_times.pop(wire_id, None)
+        if sent is not None:
+            elapsed = time.time() - sent
+            self.latency = elapsed if self.latency is None else 0.8 * self.latency + 0.2 * elapsed
+
     def ping_required(self):
         """Returns True if a ping should be sent."""
         return time.time() - self.last_send > PING_INTERVAL
@@ -449,18 +492,29 @@ class Interface(util.PrintError):
         Otherwise it is a response, which has an 'id' member and a
         corresponding request.  If the connection was closed remotely
         or the remote server is misbehaving, a (None, None) will appear.
+        Responses to a batch array are returned in the order the server
+        sent them, as if they had arrived one per line.
         """
         responses = []
         while True:
             response = None
-            try:
-                response = self.pipe.get()
-            except util.timeout:
-                break
-            except self.pipe.Closed as e:
-                self.print_error(str(e))
-            except Exception as e:
-                traceback.print_exc(file=sys.stderr)
+            if self.unread_responses:
+                response = self.unread_responses.pop()
+            else:
+                try:
+                    response = self.pipe.get()
+                except util.timeout:
+                    break
+                except self.pipe.Closed as e:
+                    self.print_error(str(e))
+                except Exception as e:
+                    traceback.print_exc(file=sys.stderr)
+                if type(response) is list and response:
+                    # Batch response; keep the rest for the following iterations
+                    # (stored reversed so that pop() is O(1))
+                    response.reverse()
+                    self.unread_responses = response
+                    response = self.unread_responses.pop()
 
             if type(response) is not dict:
                 # time to close this connection.
@@ -498,6 +552,9 @@ class Interface(util.PrintError):
             else:
                 request = self.unanswered_requests.pop(wire_id, None)
                 if request:
+                    self._note_response_time(wire_id)
+                    if request[0] == 'blockchain.block.headers':
+                        self._decode_header_chunk(response)
                     responses.append((request, response))
                 else:
                     self.print_error("unknown wire ID", wire_id)
@@ -506,6 +563,18 @@ class Interface(util.PrintError):
 
         return responses
 
+    @staticmethod
+    def _decode_header_chunk(response):
+        """Replace the 'hex' of a header chunk result with its bytes, so the
+        chunk is hex-decoded exactly once. Malformed data is left alone for
+        Network.on_block_headers to reject."""
+        result = response.get('result')
+        if isinstance(result, dict) and isinstance(result.get('hex'), str):
+            try:
+                result['hex'] = bytes.fromhex(result['hex'])
+            except ValueError:
+                pass
+
 
 def check_cert(host, cert):
     try:
@@ -25,11 +25,33 @@
 
 from jsonrpclib.SimpleJSONRPCServer import SimpleJSONRPCServer, SimpleJSONRPCRequestHandler
 from base64 import b64decode
+from collections import defaultdict
+from concurrent.futures import ThreadPoolExecutor
+import threading
 import time
 
 from . import util
 
 
+# method name -> util.ProfilerStats of the time taken to answer it
+_method_stats = defaultdict(util.ProfilerStats)
+_method_stats_lock = threading.Lock()
+
+def method_stats(reset=False):
+    """ Returns {method: {count, total, mean, p50, p99, max}} (times in
+    seconds) for every JSON-RPC method called, optionally resetting them.
+    Commands sent by the command line client (run_cmdline) are counted under
+    their own names. """
+    with _method_stats_lock:
+        items = list(_method_stats.items())
+    ret = {}
+    for name, stats in sorted(items):
+        summary = stats.summary(reset)
+        if summary['count']:
+            ret[name] = summary
+    return ret
+
+
 class RPCAuthCredentialsInvalid(Exception):
     def __str__(self):
         return 'Authentication failed (bad credentials)'
@@ -47,13 +69,22 @@ class RPCAuthUnsupportedType(Exception):
 
 # based on http://acooke.org/cute/BasicHTTPA0.html by andrew cooke
 class VerifyingJSONRPCServer(SimpleJSONRPCServer):
+    """ Connections are served by a pool of max_workers threads, so a slow
+    command only holds up the requests behind it on its own connection.
+    Connections are kept alive (HTTP/1.1) for further, possibly pipelined,
+    requests until idle for keepalive_timeout seconds. """
 
-    def __init__(self, *args, rpc_user, rpc_password, **kargs):
+    def __init__(self, *args, rpc_user, rpc_password, max_workers=8, keepalive_timeout=15.0, **kargs):
 
         self.rpc_user = rpc_user
         self.rpc_password = rpc_password
+        self.executor = ThreadPoolExecutor(max_workers=max(int(max_workers), 1),
+                                           thread_name_prefix='JSONRPCServer')
 
         class VerifyingRequestHandler(SimpleJSONRPCRequestHandler):
+            protocol_version = 'HTTP/1.1'
+            timeout = keepalive_timeout
+
             def parse_request(myself):
                 # first, call the original implementation which returns
                 # True if all OK so far
@@ -73,6 +104,34 @@ class VerifyingJSONRPCServer(SimpleJSONRPCServer):
         SimpleJSONRPCServer.__init__(
             self, requestHandler=VerifyingRequestHandler, *args, **kargs)
 
+    def process_request(self, request, client_address):
+        self.executor.submit(self._process_request, request, client_address)
+
+    def _process_request(self, request, client_address):
+        # as socketserver.ThreadingMixIn.process_request_thread
+        try:
+            self.finish_request(request, client_address)
+        except Exception:
+            self.handle_error(request, client_address)
+        finally:
+            self.shutdown_request(request)
+
+    def server_close(self):
+        super().server_close()
+        self.executor.shutdown(wait=False)
+
+    def _dispatch(self, method, params, *args, **kwargs):
+        name = method
+        if method == 'run_cmdline' and params and isinstance(params[0], dict):
+            name = params[0].get('cmd') or method
+        t0 = time.perf_counter()
+        try:
+            return super()._dispatch(method, params, *args, **kwargs)
+        finally:
+            with _method_stats_lock:
+                stats = _method_stats[name]
+            stats.add(time.perf_counter() - t0)
+
     def authenticate(self, headers):
         if self.rpc_password == '':
             # RPC authentication is disabled
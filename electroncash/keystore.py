@@ -26,6 +26,8 @@
 
 import inspect
 from . import bitcoin
+from . import ecc_fast
+from . import secp256k1
 from .bitcoin import *
 
 from .address import Address, PublicKey
@@ -116,16 +118,19 @@ class Software_KeyStore(KeyStore):
             keypairs[k] = self.get_private_key(v, password)
         # Sign
         if keypairs:
+            kwargs = {}
             if ndata is not None:
                 # If we have ndata, check that the Transaction class passed to us supports ndata.
                 # Some extant plugins such as Flipstarter inherit from Transaction (reimplementing `sign`) and do not
                 # support this argument.
                 if 'ndata' not in inspect.signature(tx.sign, follow_wrapped=True).parameters:
                     raise RuntimeError(f'Transaction subclass "{tx.__class__.__name__}" does not support the "ndata" kwarg')
-                tx.sign(keypairs, use_cache=use_cache, ndata=ndata)
-            else:
-                # Regular transaction sign (no ndata supported or no ndata specified)
-                tx.sign(keypairs, use_cache=use_cache)
+                kwargs['ndata'] = ndata
+            if grind and 'grind' in inspect.signature(tx.sign, follow_wrapped=True).parameters:
+                # Grinding only makes signatures smaller, so subclasses without it just don't.
+                kwargs['grind'] = grind
+            # Regular transaction sign when neither is given (or supported)
+            tx.sign(keypairs, use_cache=use_cache, **kwargs)
 
 
 class Imported_KeyStore(Software_KeyStore):
@@ -283,7 +288,7 @@ class Xpub:
     def get_master_public_key(self):
         return self.xpub
 
-    def derive_pubkey(self, for_change, n):
+    def get_branch_xpub(self, for_change):
         xpub = self.xpub_change if for_change else self.xpub_receive
         if xpub is None:
             xpub = bip32_public_derivation(self.xpub, "", "/%d"%for_change)
@@ -291,7 +296,16 @@ class Xpub:
                 self.xpub_change = xpub
             else:
                 self.xpub_receive = xpub
-        return self.get_pubkey_from_xpub(xpub, (n,))
+        return xpub
+
+    def derive_pubkey(self, for_change, n):
+        return self.get_pubkey_from_xpub(self.get_branch_xpub(for_change), (n,))
+
+    def derive_pubkey_range(self, for_change, start, count):
+        """ Equivalent to [derive_pubkey(for_change, n) for n in
+        range(start, start + count)], but derives the whole range at once. """
+        _, _, _, _, c, cK = deserialize_xpub(self.get_branch_xpub(for_change))
+        return [bh2u(cK_n) for cK_n, _ in CKD_pub_range(cK, c, start, count)]
 
     @classmethod
     def get_pubkey_from_xpub(self, xpub, sequence):
@@ -484,11 +498,14 @@ class Old_KeyStore(Deterministic_KeyStore):
 
     @classmethod
     def get_sequence(self, mpk, for_change, n):
-        return string_to_number(Hash(("%d:%d:"%(n, for_change)).encode('ascii') + bfh(mpk)))
+        return int.from_bytes(Hash(("%d:%d:"%(n, for_change)).encode('ascii') + bfh(mpk)), 'big')
 
     @classmethod
     def get_pubkey_from_mpk(self, mpk, for_change, n):
         z = self.get_sequence(mpk, for_change, n)
+        if secp256k1.secp256k1:
+            pubkey_point = secp256k1.ECPoint(bfh('04' + mpk)) + secp256k1.ECPoint.generator_mul(z)
+            return bh2u(pubkey_point.to_bytes(compressed=False))
         master_public_key = ecdsa.VerifyingKey.from_string(bfh(mpk), curve = SECP256k1)
         pubkey_point = master_public_key.pubkey.point + z*SECP256k1.generator
         public_key2 = ecdsa.VerifyingKey.from_public_point(pubkey_point, curve = SECP256k1)
@@ -497,6 +514,15 @@ class Old_KeyStore(Deterministic_KeyStore):
     def derive_pubkey(self, for_change, n):
         return self.get_pubkey_from_mpk(self.mpk, for_change, n)
 
+    def derive_pubkey_range(self, for_change, start, count):
+        order = generator_secp256k1.order()
+        tweaks = [number_to_string(self.get_sequence(self.mpk, for_change, n), order)
+                  for n in range(start, start + count)]
+        result = ecc_fast.pubkey_tweak_add_batch(bfh('04' + self.mpk), tweaks, False)
+        if result is None:
+            return [self.derive_pubkey(for_change, n) for n in range(start, start + count)]
+        return [bh2u(pubkey) for pubkey in result]
+
     def get_private_key_from_stretched_exponent(self, for_change, n, secexp):
         order = generator_secp256k1.order()
         secexp = (secexp + self.get_sequence(self.mpk, for_change, n)) % order
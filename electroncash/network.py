@@ -30,6 +30,7 @@ import errno
 import random
 import re
 import select
+import statistics
 from collections import defaultdict
 import threading
 import socket
@@ -46,12 +47,24 @@ from .interface import Connection, Interface
 from . import blockchain
 from . import version
 from .tor import TorController, check_proxy_bypass_tor_control
+from .transaction import Transaction
+from .tx_store import RawTxStore
 from .utils import Event
 
 DEFAULT_AUTO_CONNECT = True
 # Versions prior to 4.0.15 had this set to True, but we opted for False to
 # promote network health by allowing clients to connect to new servers easily.
 DEFAULT_WHITELIST_SERVERS_ONLY = False
+# Fast header sync (config key 'fast_header_sync') moves the verification
+# checkpoint up to this many blocks below the median tip of this many servers,
+# rounded down to a chunk boundary, once they all agree on its merkle root. It
+# is only done when it saves at least FAST_SYNC_MIN_DISTANCE headers, and it
+# falls back to the hardcoded checkpoint if that takes more than
+# FAST_SYNC_TIMEOUT seconds.
+FAST_SYNC_DEPTH = 100
+FAST_SYNC_MIN_DISTANCE = 2016
+FAST_SYNC_CONFIRMATIONS = 3
+FAST_SYNC_TIMEOUT = 30.0
 
 def parse_servers(result):
     """ parse servers list into dict format"""
@@ -208,6 +221,29 @@ def _socksocket_filtered(*args, **kwargs):
         return socks.socksocket(*args, **kwargs)
 
 
+class RequestStats:
+    """ Counters of the requests one owner (e.g. a wallet) sent through
+    Network's fair queue, see Network.send(). """
+    __slots__ = ('sent', 'answered', 'errors', 'queue_wait', 'latency', 'max_latency')
+
+    def __init__(self):
+        self.sent = self.answered = self.errors = 0
+        self.queue_wait = 0.0  # total seconds requests waited for their turn
+        self.latency = 0.0  # total seconds from their turn to the answer
+        self.max_latency = 0.0
+
+    def to_dict(self, queued=0):
+        return {
+            'queued': queued,
+            'sent': self.sent,
+            'answered': self.answered,
+            'errors': self.errors,
+            'avg_queue_wait_ms': round(1e3 * self.queue_wait / self.sent, 3) if self.sent else None,
+            'avg_latency_ms': round(1e3 * self.latency / self.answered, 3) if self.answered else None,
+            'max_latency_ms': round(1e3 * self.max_latency, 3),
+        }
+
+
 class Network(util.DaemonThread):
     """The Network class manages a set of connections to remote electrum
     servers, each connected socket is handled by an Interface() object.
@@ -228,6 +264,12 @@ class Network(util.DaemonThread):
     NODES_RETRY_INTERVAL = 60  # How often to retry a node we know about in secs, if we are connected to less than 10 nodes
     SERVER_RETRY_INTERVAL = 10  # How often to reconnect when server down in secs
     MAX_MESSAGE_BYTES = 1024*1024*32 # = 32MB. The message size limit in bytes. This is to prevent a DoS vector whereby the server can fill memory with garbage data.
+    # Requests sent with an owner are handed to the interfaces round robin
+    # between owners, FAIR_QUANTUM at a time, while fewer than FAIR_DEPTH
+    # client requests are unanswered. So a wallet being restored doesn't
+    # queue thousands of requests ahead of every other wallet's.
+    FAIR_DEPTH = 400
+    FAIR_QUANTUM = 25
 
     tor_controller: TorController = None
 
@@ -259,7 +301,11 @@ class Network(util.DaemonThread):
         self.interface_lock = threading.RLock()            # <- re-entrant
         self.pending_sends_lock = threading.Lock()
 
-        self.pending_sends = []
+        self.pending_sends = []  # (messages, callback, owner, time.time() of send)
+        self.posted_calls = queue.Queue()  # (func, args) to run from the network thread, see post()
+        self._fair_turn = 0  # rotates which owner goes first
+        self.request_stats = defaultdict(RequestStats)  # owner -> RequestStats
+        self.request_owners = {}  # message_id -> (owner, time.time() sent) of unanswered owned requests
         self.message_id = util.Monotonic(locking=True)
         self.verified_checkpoint = False
         self.verifications_required = 1
@@ -268,6 +314,11 @@ class Network(util.DaemonThread):
         if networks.net.VERIFICATION_BLOCK_HEIGHT is None:
             self.verifications_required = 3
         self.checkpoint_servers_verified = {}
+        self.fast_header_sync = self.config.get('fast_header_sync', False)
+        self.fast_sync_tips = {}  # server -> tip, of the servers the fast sync checkpoint is picked from
+        self.fast_sync_deadline = None  # time.time() by which a fast sync in progress must be done
+        self.fast_sync_off = False  # set once this session fell back to the hardcoded checkpoint
+        self.load_fast_sync_checkpoint()
         self.checkpoint_height = networks.net.VERIFICATION_BLOCK_HEIGHT
         self.debug = False
         self.irc_servers = {} # returned by interface (list from irc)
@@ -292,6 +343,19 @@ class Network(util.DaemonThread):
         self.subscribed_addresses = set()
         # Requests from client we've not seen a response to
         self.unanswered_requests = {}
+        # Whether to spread SPREAD_METHODS reads over all good interfaces.
+        # Off by default: it tells every server we are connected to which
+        # txids we care about, rather than just the main one.
+        self.spread_reads = self.config.get('network_spread_reads', False)
+        # Raw tx's fetched by wallets without storage encryption are kept on
+        # disk for all of them. Opt-in, as the store itself is not encrypted.
+        self.tx_store = None
+        if self.config.get('tx_store', False):
+            try:
+                self.tx_store = RawTxStore(os.path.join(self.config.path, 'tx_store'))
+            except OSError as e:
+                self.print_error("could not open tx store:", repr(e))
+        Transaction.tx_cache_set_store(self.tx_store)
         # retry times
         self.server_retry_time = time.time()
         self.nodes_retry_time = time.time()
@@ -465,6 +529,8 @@ class Network(util.DaemonThread):
         """
         if interface is None:
             interface = self.interface
+            if callback and method in self.SPREAD_METHODS:
+                interface = self._pick_read_interface(interface)
         elif interface == 'random':
             interface = random.choice(self.get_interfaces(interfaces=True)
                                       or (None,))  # may set interface to None if no interfaces
@@ -487,11 +553,60 @@ class Network(util.DaemonThread):
             self.print_error("*** WARNING: queueing request on a stale instance!")
         return message_id
 
+    # Idempotent reads whose results we can check ourselves (txid, merkle proof
+    # against our headers), so any server on our chain may answer them.
+    SPREAD_METHODS = frozenset(('blockchain.transaction.get', 'blockchain.transaction.get_merkle'))
+    # Assumed response time of a server we have not measured yet, in seconds
+    DEFAULT_READ_LATENCY = 0.5
+
+    def _pick_read_interface(self, primary):
+        """Choose where to send a read from SPREAD_METHODS: the server with the
+        lowest expected wait (latency times queue depth) among the main
+        interface and the servers that follow the same chain and are not
+        behind it. Never done through a proxy (e.g. Tor), where linking our
+        reads across servers matters most."""
+        if not primary or not self.spread_reads or self.proxy:
+            return primary
+        best, best_score = primary, None
+        for interface in self.get_interfaces(interfaces=True):
+            if interface is not primary and (interface.mode != Interface.MODE_DEFAULT
+                                             or interface.blockchain is not primary.blockchain
+                                             or interface.tip < primary.tip):
+                continue
+            latency = interface.latency if interface.latency is not None else self.DEFAULT_READ_LATENCY
+            score = latency * (1 + interface.load())
+            if best_score is None or score < best_score:
+                best, best_score = interface, score
+        return best
+
+    def _requeue_client_requests(self, interface):
+        """Reissue the client requests still pending on a secondary interface
+        that went down. (Those on the main interface are resent by
+        send_subscriptions() once a new one is up.)"""
+        pending = interface.unsent_requests + list(interface.unanswered_requests.values())
+        for method, params, message_id in pending:
+            client_req = self.unanswered_requests.pop(message_id, None)
+            self.request_owners.pop(message_id, None)
+            if client_req:
+                self.queue_request(client_req[0], client_req[1], callback=client_req[2])
+
+    @staticmethod
+    def _check_tx_response(params, response) -> bool:
+        """True unless a blockchain.transaction.get result hashes to some other
+        txid than the one requested."""
+        result = response.get('result')
+        raw = result.get('hex') if isinstance(result, dict) else result
+        try:
+            return bh2u(Hash(bfh(raw))[::-1]) == params[0]
+        except Exception:
+            return False
+
     def send_subscriptions(self):
         self.sub_cache.clear()
         # Resend unanswered requests
         old_reqs = self.unanswered_requests
         self.unanswered_requests = {}
+        self.request_owners = {}
         for m_id, request in old_reqs.items():
             message_id = self.queue_request(request[0], request[1], callback=request[2])
             assert message_id is not None
@@ -791,7 +906,7 @@ class Network(util.DaemonThread):
         self.recent_servers = self.recent_servers[0:20]
         self.save_recent_servers()
 
-    def process_response(self, interface, request, response, callbacks):
+    def process_response(self, interface, request, response, callbacks, runs=None):
         if self.debug:
             self.print_error("<--", response)
         error = response.get('error')
@@ -865,7 +980,33 @@ class Network(util.DaemonThread):
                 self.connection_down(interface.server)
 
         for callback in callbacks:
+            self._dispatch_response(callback, response, runs)
+
+    @staticmethod
+    def _dispatch_response(callback, response, runs=None):
+        """Invoke `callback` for `response`. Callbacks decorated with
+        util.batch_responses get a list. If `runs` is a list, such responses
+        are appended to it as (callback, [responses]) runs to be delivered by
+        _flush_response_runs(), merging consecutive responses for the same
+        callback. Plain callbacks flush any pending runs first so that the
+        relative order of all responses is preserved."""
+        if not getattr(callback, 'batch_responses', False):
+            if runs:
+                Network._flush_response_runs(runs)
             callback(response)
+        elif runs is None:
+            callback([response])
+        elif runs and runs[-1][0] == callback:
+            runs[-1][1].append(response)
+        else:
+            runs.append((callback, [response]))
+
+    @staticmethod
+    def _flush_response_runs(runs):
+        pending = runs.copy()
+        runs.clear()
+        for callback, responses in pending:
+            callback(responses)
 
     @staticmethod
     def get_index(method, params):
@@ -874,6 +1015,14 @@ class Network(util.DaemonThread):
 
     def process_responses(self, interface):
         responses = interface.get_responses()
+        runs = []
+        try:
+            self._process_responses(interface, responses, runs)
+        finally:
+            self._flush_response_runs(runs)
+
+    def _process_responses(self, interface, responses, runs):
+        bad_interface = False
         for request, response in responses:
             if request:
                 method, params, message_id = request
@@ -882,9 +1031,22 @@ class Network(util.DaemonThread):
                 # callback, are only sent to the current interface,
                 # and are placed in the unanswered_requests dictionary
                 client_req = self.unanswered_requests.pop(message_id, None)
+                owned = self.request_owners.pop(message_id, None)
+                if owned:
+                    self._note_owned_response(owned, response)
                 if client_req:
                     if interface != self.interface:
-                        self.print_error("advisory: response from non-primary {}".format(interface))
+                        if method not in self.SPREAD_METHODS:
+                            self.print_error("advisory: response from non-primary {}".format(interface))
+                        elif response.get('error') is not None or (method == 'blockchain.transaction.get'
+                                                                   and not self._check_tx_response(params, response)):
+                            # A secondary may lag behind on the mempool or may be lying. Either way
+                            # the main server gets the final say.
+                            if response.get('error') is None:
+                                interface.print_error("bad response for", method, params, "- disconnecting")
+                                bad_interface = True
+                            self.queue_request(method, params, self.interface, callback=client_req[2])
+                            continue
                     callbacks = [client_req[2]]
                 else:
                     # fixme: will only work for subscriptions
@@ -900,6 +1062,7 @@ class Network(util.DaemonThread):
                     self.subscribed_addresses.add(params[0])
             else:
                 if not response:  # Closed remotely / misbehaving
+                    self._flush_response_runs(runs)
                     self.connection_down(interface.server)
                     break
                 # Rewrite response shape to match subscription request response
@@ -919,12 +1082,15 @@ class Network(util.DaemonThread):
                 with self.interface_lock:
                     self.sub_cache[k] = response
             # Response is now in canonical form
-            self.process_response(interface, request, response, callbacks)
+            self.process_response(interface, request, response, callbacks, runs)
+        if bad_interface:
+            self._flush_response_runs(runs)
+            self.connection_down(interface.server)
 
-    def subscribe_to_scripthashes(self, scripthashes: Iterable[str], callback):
+    def subscribe_to_scripthashes(self, scripthashes: Iterable[str], callback, *, owner=None):
         msgs = [('blockchain.scripthash.subscribe', [sh])
                 for sh in scripthashes]
-        self.send(msgs, callback)
+        self.send(msgs, callback, owner=owner)
 
     def unsubscribe_from_scripthashes(self, scripthashes: Iterable[str], callback):
         method_sub = 'blockchain.scripthash.subscribe'
@@ -961,14 +1127,73 @@ class Network(util.DaemonThread):
     def request_scripthash_history(self, sh, callback):
         self.send([('blockchain.scripthash.get_history', [sh])], callback)
 
-    def send(self, messages, callback):
-        """Messages is a list of (method, params) tuples"""
+    def send(self, messages, callback, *, owner=None):
+        """Messages is a list of (method, params) tuples. Those of an `owner`,
+        a str naming e.g. a wallet, take turns with other owners' (see
+        FAIR_DEPTH), and are counted in get_request_stats()."""
         messages = list(messages)
         # Guard against empty message-list which is a no-op and just wastes CPU to enqueue/dequeue (not even callback is
         # called). I've seen the code send empty message lists before in synchronizer.py
         if messages:
             with self.pending_sends_lock:
-               self.pending_sends.append((messages, callback))
+               self.pending_sends.append((messages, callback, owner, time.time()))
+
+    def _take_pending_sends(self):
+        """ Returns the pending sends to process now: all of those without an
+        owner, and owners' messages round robin, up to FAIR_DEPTH unanswered.
+        The rest stay pending. Call with pending_sends_lock held. """
+        sends, by_owner = [], {}
+        for item in self.pending_sends:
+            if item[2] is None:
+                sends.append(item)
+            else:
+                by_owner.setdefault(item[2], []).append(item)
+        if not by_owner:
+            self.pending_sends = []
+            return sends
+        budget = self.FAIR_DEPTH - len(self.unanswered_requests)
+        owners = list(by_owner)
+        self._fair_turn = (self._fair_turn + 1) % len(owners)
+        owners = owners[self._fair_turn:] + owners[:self._fair_turn]
+        while budget > 0 and owners:
+            for owner in owners.copy():
+                items, quantum = by_owner[owner], min(self.FAIR_QUANTUM, budget)
+                while quantum and items:
+                    messages, callback, _owner, t = items[0]
+                    if len(messages) <= quantum:
+                        sends.append(items.pop(0))
+                        n = len(messages)
+                    else:
+                        sends.append((messages[:quantum], callback, owner, t))
+                        del messages[:quantum]
+                        n = quantum
+                    quantum -= n
+                    budget -= n
+                if not items:
+                    owners.remove(owner)
+                if budget <= 0:
+                    break
+        self.pending_sends = [item for items in by_owner.values() for item in items]
+        return sends
+
+    def _note_owned_response(self, owned, response):
+        owner, t = owned
+        stats = self.request_stats[owner]
+        latency = time.time() - t
+        stats.answered += 1
+        stats.errors += response.get('error') is not None
+        stats.latency += latency
+        stats.max_latency = max(stats.max_latency, latency)
+
+    def get_request_stats(self):
+        """ Returns {owner: RequestStats.to_dict()} of the owners of sends. """
+        with self.pending_sends_lock:
+            queued = defaultdict(int)
+            for messages, callback, owner, t in self.pending_sends:
+                if owner is not None:
+                    queued[owner] += len(messages)
+            return {owner: stats.to_dict(queued[owner])
+                    for owner, stats in list(self.request_stats.items())}
 
     def process_pending_sends(self):
         # Requests needs connectivity.  If we don't have an interface,
@@ -977,10 +1202,14 @@ class Network(util.DaemonThread):
             return
 
         with self.pending_sends_lock:
-            sends = self.pending_sends
-            self.pending_sends = []
+            sends = self._take_pending_sends()
 
-        for messages, callback in sends:
+        now = time.time()
+        for messages, callback, owner, t in sends:
+            if owner is not None:
+                stats = self.request_stats[owner]
+                stats.sent += len(messages)
+                stats.queue_wait += (now - t) * len(messages)
             for method, params in messages:
                 r = None
                 if method.endswith('.subscribe'):
@@ -993,9 +1222,13 @@ class Network(util.DaemonThread):
                     r = self.sub_cache.get(k)
                 if r is not None:
                     util.print_error("cache hit", k)
-                    callback(r)
+                    if owner is not None:
+                        self._note_owned_response((owner, now), r)
+                    self._dispatch_response(callback, r)
                 else:
-                    self.queue_request(method, params, callback=callback)
+                    message_id = self.queue_request(method, params, callback=callback)
+                    if owner is not None and message_id is not None:
+                        self.request_owners[message_id] = (owner, now)
 
     def _cancel_pending_sends(self, callback, *, method=None, params=None) -> Tuple[int, int]:
         ct = 0
@@ -1004,7 +1237,7 @@ class Network(util.DaemonThread):
             idx = 0
             for item in self.pending_sends.copy():
                 do_delete = False
-                messages, _callback = item
+                messages, _callback = item[:2]
                 if callback == _callback:
                     if method is None and params is None:
                         do_delete = True
@@ -1052,6 +1285,27 @@ class Network(util.DaemonThread):
             self.print_error(f"Removed {ct} subscription callbacks and {ct2} pending sends (nmsgs={ct3}) for"
                              f" callback: {qname}")
 
+    def post(self, func, *args):
+        """Have func(*args) called from the network thread: right away if
+        called from it, otherwise on its next loop. For the methods that are
+        only safe from the network thread, e.g. cancel_requests(), when called
+        from another thread such as a JobWorker."""
+        if threading.current_thread() is self:
+            func(*args)
+        else:
+            self.posted_calls.put((func, args))
+
+    def run_posted_calls(self):
+        while True:
+            try:
+                func, args = self.posted_calls.get_nowait()
+            except queue.Empty:
+                return
+            try:
+                func(*args)
+            except Exception as e:
+                self.print_error("posted call", getattr(func, '__qualname__', repr(func)), "failed:", repr(e))
+
     def cancel_requests(self, callback, *, method=None, params=None):
         """Remove a callback to free object references to enable GC.
         It is advised that this function only be called from the network thread
@@ -1068,6 +1322,7 @@ class Network(util.DaemonThread):
                     # guard against race conditions here. Note: this usually is called from the network thread but who
                     # knows what future programmers may do. :)
                     self.unanswered_requests.pop(message_id, None)
+                    self.request_owners.pop(message_id, None)
                     ct += 1
         ct2, ct3 = self._cancel_pending_sends(callback, method=method, params=params)
         if ct or ct2 or ct3:
@@ -1085,7 +1340,11 @@ class Network(util.DaemonThread):
         if server == self.default_server:
             self.set_status('disconnected')
         if server in self.interfaces:
-            self.close_interface(self.interfaces[server])
+            interface = self.interfaces[server]
+            was_main = interface is self.interface
+            self.close_interface(interface)
+            if not was_main:
+                self._requeue_client_requests(interface)
             self.notify('interfaces')
         for b in self.blockchains.values():
             if b.catch_up == server:
@@ -1208,6 +1467,8 @@ class Network(util.DaemonThread):
             # Ensure the chunk can be rerequested, but only if the request originated from us.
             if request and request[1][0] // 2016 in self.requested_chunks:
                 self.requested_chunks.remove(request[1][0] // 2016)
+            if request and self._is_fast_sync_proposal(request[1]):
+                self.fall_back_from_fast_sync("error from {}".format(interface.server))
             return
 
         # Ignore unsolicited chunks
@@ -1220,38 +1481,53 @@ class Network(util.DaemonThread):
             return
         if index in self.requested_chunks:
             self.requested_chunks.remove(index)
+        if (interface.mode == Interface.MODE_VERIFICATION and len(request_params) == 3 and request_params[2]
+                and request_params[2] not in (self.checkpoint_height, networks.net.VERIFICATION_BLOCK_HEIGHT)):
+            # Verification against a fast sync checkpoint given up on since.
+            # The server was asked again against the hardcoded one.
+            interface.print_error("ignoring chunk for abandoned fast sync checkpoint {}".format(request_params[2]))
+            return
+        proposal = self._is_fast_sync_proposal(request_params)
 
-        header_hexsize = blockchain.HEADER_SIZE * 2
-        hexdata = result['hex']
-        actual_header_count = len(hexdata) // header_hexsize
+        # Interface hands us the chunk already hex-decoded
+        chunk_data = result['hex']
+        if not isinstance(chunk_data, bytes):
+            raise ValueError('header chunk is not valid hex')
+        actual_header_count = len(chunk_data) // blockchain.HEADER_SIZE
         # We accept less headers than we asked for, to cover the case where the distance to the tip was unknown.
         if actual_header_count > expected_header_count:
-            interface.print_error("chunk data size incorrect expected_size={} actual_size={}".format(expected_header_count * header_hexsize, len(hexdata)))
+            interface.print_error("chunk data size incorrect expected_size={} actual_size={}".format(expected_header_count * blockchain.HEADER_SIZE, len(chunk_data)))
             return
 
         proof_was_provided = False
         if 'root' in result and 'branch' in result:
             header_height = request_base_height + actual_header_count - 1
-            header_offset = (actual_header_count - 1) * header_hexsize
-            header = hexdata[header_offset : header_offset + header_hexsize]
-            if not self.validate_checkpoint_result(interface, result["root"], result["branch"], header, header_height):
+            header_offset = (actual_header_count - 1) * blockchain.HEADER_SIZE
+            header = chunk_data[header_offset : header_offset + blockchain.HEADER_SIZE]
+            if not self.validate_checkpoint_result(interface, result["root"], result["branch"], bh2u(header), header_height,
+                                                   request_params[2]):
                 # Got checkpoint validation data, server failed to provide proof.
                 interface.print_error("disconnecting server for incorrect checkpoint proof")
                 self.connection_down(interface.server, blacklist=True)
+                if proposal:
+                    self.fall_back_from_fast_sync("bad proof from {}".format(interface.server))
                 return
 
-            data = bfh(hexdata)
             try:
-                blockchain.verify_proven_chunk(request_base_height, data)
+                blockchain.verify_proven_chunk(request_base_height, chunk_data)
             except blockchain.VerifyError as e:
                 interface.print_error('disconnecting server for failed verify_proven_chunk: {}'.format(e))
                 self.connection_down(interface.server, blacklist=True)
+                if proposal:
+                    self.fall_back_from_fast_sync("bad headers from {}".format(interface.server))
                 return
 
             proof_was_provided = True
         elif len(request_params) == 3 and request_params[2] != 0:
             # Expected checkpoint validation data, did not receive it.
             self.connection_down(interface.server)
+            if proposal:
+                self.fall_back_from_fast_sync("no proof from {}".format(interface.server))
             return
 
         verification_top_height = self.checkpoint_servers_verified.get(interface.server, {}).get('height', None)
@@ -1267,6 +1543,16 @@ class Network(util.DaemonThread):
                 interface.print_error("disconnecting unverified server for sending verification header chunk without proof")
                 self.connection_down(interface.server, blacklist=True)
                 return
+            if request_params[2] != networks.net.VERIFICATION_BLOCK_HEIGHT:
+                # A fast sync checkpoint has no known root, but its headers must
+                # follow the difficulty of the chain from the known ASERT anchor.
+                try:
+                    self.blockchains[0].verify_proven_chunk_difficulty(request_base_height, chunk_data)
+                except blockchain.VerifyError as e:
+                    interface.print_error('disconnecting server for bad fast sync checkpoint: {}'.format(e))
+                    self.connection_down(interface.server, blacklist=True)
+                    self.fall_back_from_fast_sync("bad difficulty from {}".format(interface.server))
+                    return
 
             if not self.apply_successful_verification(interface, request_params[2], result['root']):
                 return
@@ -1275,7 +1561,6 @@ class Network(util.DaemonThread):
         else:
             target_blockchain = interface.blockchain
 
-        chunk_data = bfh(hexdata)
         connect_state = (target_blockchain.connect_chunk(request_base_height, chunk_data, proof_was_provided)
                          if target_blockchain
                          else blockchain.CHUNK_BAD)  # fix #1079 -- invariant is violated here due to extant bugs, so rather than raise an exception, just trigger a connection_down below...
@@ -1305,6 +1590,15 @@ class Network(util.DaemonThread):
         # This interface was verified above. Get it syncing.
         if initial_interface_mode == Interface.MODE_VERIFICATION:
             self._process_latest_tip(interface)
+            # Along with the servers that were waiting on the same fast sync checkpoint.
+            with self.interface_lock:
+                waiting = [i for i in self.interfaces.values()
+                           if i.mode == Interface.MODE_VERIFICATION
+                           and self.checkpoint_servers_verified.get(i.server, {}).get('root') == result['root']]
+            for i in waiting:
+                i.blockchain = target_blockchain
+                i.set_mode(Interface.MODE_DEFAULT)
+                self._process_latest_tip(i)
             return
 
         # If not finished, get the next chunk.
@@ -1574,13 +1868,15 @@ class Network(util.DaemonThread):
         filename = b.path()
         # NB: HEADER_SIZE = 80 bytes
         length = blockchain.HEADER_SIZE * (networks.net.VERIFICATION_BLOCK_HEIGHT + 1)
-        if not os.path.exists(filename) or os.path.getsize(filename) < length:
-            with open(filename, 'wb') as f:
-                if length>0:
-                    f.seek(length-1)
-                    f.write(b'\x00')
-        util.ensure_sparse_file(filename)
         with b.lock:
+            if not os.path.exists(filename) or os.path.getsize(filename) < length:
+                b.close_mmap()
+                b.forget_hashes()
+                with open(filename, 'wb') as f:
+                    if length>0:
+                        f.seek(length-1)
+                        f.write(b'\x00')
+            util.ensure_sparse_file(filename)
             b.update_size()
 
     def run(self):
@@ -1594,9 +1890,11 @@ class Network(util.DaemonThread):
 
         while self.is_running():
             self.maintain_sockets()
+            self.maintain_fast_sync()
             self.wait_on_sockets()
             if self.verified_checkpoint:
                 self.run_jobs()    # Synchronizer and Verifier and Fx
+            self.run_posted_calls()
             self.process_pending_sends()
         self.stop_network()
 
@@ -1604,6 +1902,10 @@ class Network(util.DaemonThread):
         self.tor_controller.stop()
         self.tor_controller = None
 
+        if self.tx_store:
+            Transaction.tx_cache_set_store(None)
+            self.tx_store.close()
+
         self.on_stop()
 
     def on_server_version(self, interface, version_data):
@@ -1694,22 +1996,96 @@ class Network(util.DaemonThread):
             # a given number of confirmations for the same conservative height.
             if self.checkpoint_height is None:
                 self.checkpoint_height = interface.tip - 100
+            elif (self.checkpoint_height == networks.net.VERIFICATION_BLOCK_HEIGHT and not self.checkpoint_servers_verified
+                    and self.fast_header_sync and not self.fast_sync_off and self.num_server >= FAST_SYNC_CONFIRMATIONS):
+                # The height of a fast sync comes from the median tip of
+                # several servers, so that no single one can pick it.
+                if self.fast_sync_deadline is None:
+                    self.fast_sync_deadline = time.time() + FAST_SYNC_TIMEOUT
+                self.fast_sync_tips[interface.server] = interface.tip
+                if len(self.fast_sync_tips) < FAST_SYNC_CONFIRMATIONS:
+                    interface.print_error("request_initial_proof_and_headers waiting on more server tips for a fast sync")
+                    return
+                fast_height = self.get_fast_sync_height(statistics.median_low(self.fast_sync_tips.values()))
+                if fast_height is None:
+                    self.fall_back_from_fast_sync("it would not save enough")
+                    return
+                interface.print_error("proposing fast sync checkpoint at height {}".format(fast_height))
+                self.checkpoint_height = fast_height
+                self._request_pending_verifications()
+                return
             self.checkpoint_servers_verified[interface.server] = { 'root': None, 'height': self.checkpoint_height }
             # We need at least 147 headers before the post checkpoint headers for daa calculations.
             self._request_headers(interface, self.checkpoint_height - 147 + 1, 147, self.checkpoint_height)
+        elif self.checkpoint_height != networks.net.VERIFICATION_BLOCK_HEIGHT:
+            # It agreed to a fast sync checkpoint that is still short of confirmations.
+            interface.print_error("request_initial_proof_and_headers waiting on fast sync confirmations")
         else:
             # We already have them verified, maybe we got disconnected.
             interface.print_error("request_initial_proof_and_headers bypassed")
             interface.set_mode(Interface.MODE_DEFAULT)
             self._process_latest_tip(interface)
 
+    def _request_pending_verifications(self):
+        ''' Makes the verification request of every connected server that
+        hasn't made one yet, or whose request was dropped by a fallback. '''
+        with self.interface_lock:
+            pending = [i for i in self.interfaces.values()
+                       if i.mode == Interface.MODE_VERIFICATION and i.tip
+                       and i.server not in self.checkpoint_servers_verified]
+        for interface in pending:
+            self.request_initial_proof_and_headers(interface)
+
+    def _is_fast_sync_proposal(self, request_params):
+        ''' Whether a blockchain.block.headers request verifies against the
+        fast sync checkpoint in progress. '''
+        return (len(request_params) == 3 and request_params[2] == self.checkpoint_height
+                and self.checkpoint_height != networks.net.VERIFICATION_BLOCK_HEIGHT)
+
+    def maintain_fast_sync(self):
+        if self.fast_sync_deadline is not None and time.time() > self.fast_sync_deadline:
+            self.fall_back_from_fast_sync("timed out")
+
+    def fall_back_from_fast_sync(self, reason):
+        ''' Gives up on the fast sync in progress for this session, and
+        verifies the servers against the hardcoded checkpoint instead. '''
+        if self.fast_sync_deadline is None:
+            return
+        self.print_error("fast sync abandoned ({}), verifying against the hardcoded checkpoint".format(reason))
+        self.fast_sync_off = True
+        self.fast_sync_deadline = None
+        self.fast_sync_tips.clear()
+        self.checkpoint_height = networks.net.VERIFICATION_BLOCK_HEIGHT
+        for server, v in list(self.checkpoint_servers_verified.items()):
+            if v['height'] != self.checkpoint_height:
+                del self.checkpoint_servers_verified[server]
+        self._request_pending_verifications()
+
     def apply_successful_verification(self, interface, checkpoint_height, checkpoint_root):
-        known_roots = [ v['root'] for v in self.checkpoint_servers_verified.values() if v['root'] is not None ]
-        if len(known_roots) > 0 and checkpoint_root != known_roots[0]:
-            interface.print_error("server sent inconsistent root '{}'".format(checkpoint_root))
-            self.connection_down(interface.server)
-            return False
-        self.checkpoint_servers_verified[interface.server]['root'] = checkpoint_root
+        if checkpoint_height != networks.net.VERIFICATION_BLOCK_HEIGHT:
+            # A proposed fast sync checkpoint: every server must return the same root.
+            self.checkpoint_servers_verified[interface.server]['root'] = checkpoint_root
+            roots = {v['root'] for v in self.checkpoint_servers_verified.values()
+                     if v['root'] is not None and v['height'] == checkpoint_height}
+            if len(roots) > 1:
+                interface.print_error("server sent a different fast sync checkpoint root '{}'".format(checkpoint_root))
+                self.fall_back_from_fast_sync("servers disagree on the root")
+                return False
+            confirmations = sum(1 for v in self.checkpoint_servers_verified.values()
+                                if v['root'] == checkpoint_root and v['height'] == checkpoint_height)
+            if confirmations < FAST_SYNC_CONFIRMATIONS:
+                interface.print_error("fast sync checkpoint confirmed by {} of {} servers"
+                                      .format(confirmations, FAST_SYNC_CONFIRMATIONS))
+                return False
+            self.apply_fast_sync_checkpoint(checkpoint_height, checkpoint_root)
+        else:
+            known_roots = [ v['root'] for v in self.checkpoint_servers_verified.values()
+                            if v['root'] is not None and v['height'] == checkpoint_height ]
+            if len(known_roots) > 0 and checkpoint_root != known_roots[0]:
+                interface.print_error("server sent inconsistent root '{}'".format(checkpoint_root))
+                self.connection_down(interface.server)
+                return False
+            self.checkpoint_servers_verified[interface.server]['root'] = checkpoint_root
 
         # rt12 --- checkpoint generation currently disabled.
         if False:
@@ -1741,16 +2117,21 @@ class Network(util.DaemonThread):
         interface.set_mode(Interface.MODE_DEFAULT)
         return True
 
-    def validate_checkpoint_result(self, interface, merkle_root, merkle_branch, header, header_height):
+    def validate_checkpoint_result(self, interface, merkle_root, merkle_branch, header, header_height, checkpoint_height=None):
         """
         header: hex representation of the block header.
         merkle_root: hex representation of the server's calculated merkle root.
         branch: list of hex representations of the server's calculated merkle root branches.
+        checkpoint_height: the cp_height of the request. The root of a proposed fast
+        sync checkpoint is not known yet, so the branch is only checked against the
+        received one; apply_successful_verification then waits for servers to agree.
 
         Returns a boolean to represent whether the server's proof is correct.
         """
         received_merkle_root = bfh(merkle_root)[::-1]
-        if networks.net.VERIFICATION_BLOCK_MERKLE_ROOT:
+        if checkpoint_height is not None and checkpoint_height == self.checkpoint_height != networks.net.VERIFICATION_BLOCK_HEIGHT:
+            expected_merkle_root = received_merkle_root
+        elif networks.net.VERIFICATION_BLOCK_MERKLE_ROOT:
             expected_merkle_root = bfh(networks.net.VERIFICATION_BLOCK_MERKLE_ROOT)[::-1]
         else:
             expected_merkle_root = received_merkle_root
@@ -1770,6 +2151,50 @@ class Network(util.DaemonThread):
 
         return True
 
+    def get_fast_sync_height(self, tip):
+        ''' The height of the checkpoint to fast sync to given the servers' tip,
+        or None if fast sync is off or would not save enough. The height ends a
+        chunk so that servers with slightly different tips propose the same
+        one, and so that chunks never straddle it. '''
+        if not self.fast_header_sync or self.num_server < FAST_SYNC_CONFIRMATIONS:
+            return None
+        anchor = networks.net.asert_daa.anchor
+        if anchor is None or len(self.blockchains) != 1:
+            # Without the anchor the difficulty after the checkpoint can't be
+            # computed, and forks would be left dangling below it.
+            return None
+        height = (tip - FAST_SYNC_DEPTH) // 2016 * 2016 - 1
+        if height - 147 <= anchor.height or height - self.blockchains[0].height() < FAST_SYNC_MIN_DISTANCE:
+            return None
+        return height
+
+    def apply_fast_sync_checkpoint(self, height, root):
+        ''' Make height the verification checkpoint. Headers below it are then
+        only fetched, with proofs against root, when something needs them. '''
+        self.print_error("fast syncing to checkpoint at height {} with merkle root {!r}".format(height, root))
+        networks.net.VERIFICATION_BLOCK_HEIGHT = height
+        networks.net.VERIFICATION_BLOCK_MERKLE_ROOT = root
+        self.checkpoint_height = height
+        self.fast_sync_deadline = None
+        self.fast_sync_tips.clear()
+        # The headers file now has a hole below the checkpoint that only this
+        # checkpoint's proofs can fill, so it has to survive restarts.
+        self.config.set_key('fast_sync_checkpoint', [height, root], True)
+        self.init_headers_file()
+        self.verified_checkpoint = True
+
+    def load_fast_sync_checkpoint(self):
+        checkpoint = self.config.get('fast_sync_checkpoint')
+        try:
+            height, root = checkpoint
+            if not isinstance(height, int) or not isinstance(root, str) or len(bfh(root)) != 32:
+                raise ValueError(checkpoint)
+        except (TypeError, ValueError):
+            return
+        if height > networks.net.VERIFICATION_BLOCK_HEIGHT:
+            networks.net.VERIFICATION_BLOCK_HEIGHT = height
+            networks.net.VERIFICATION_BLOCK_MERKLE_ROOT = root
+
     def blockchain(self):
         with self.interface_lock:
             if self.interface and self.interface.blockchain is not None:
@@ -1832,6 +2257,9 @@ class Network(util.DaemonThread):
                  replied with (with a generic fallback message is used
                  if the server message is not recognized). """
         txid = str(txid).strip()
+        raw = self.tx_store and self.tx_store.get(txid)
+        if raw:
+            return True, raw.hex()
         try:
             r = self.synchronous_get(('blockchain.transaction.get',[txid]), timeout=timeout)
             print ("DEBUG network 1803 r is ",r)
@@ -3,7 +3,7 @@ from .i18n import _
 
 
 import datetime
-from collections import defaultdict
+from bisect import bisect_left, bisect_right
 from .bitcoin import COIN
 
 import matplotlib
@@ -14,39 +14,137 @@ from matplotlib.patches import Ellipse
 from matplotlib.offsetbox import AnchoredOffsetbox, TextArea, DrawingArea, HPacker
 
 
-def plot_history(wallet, history):
-    hist_in = defaultdict(int)
-    hist_out = defaultdict(int)
-    for item in history:
-        tx_hash, height, confirmations, timestamp, value, balance = item
-        if not confirmations:
-            continue
-        if timestamp is None:
-            continue
-        value = value*1./COIN
-        date = datetime.datetime.fromtimestamp(timestamp)
-        datenum = int(md.date2num(datetime.date(date.year, date.month, 1)))
-        if value > 0:
-            hist_in[datenum] += value
-        else:
-            hist_out[datenum] -= value
+# The most bars drawn per axes; zooming in switches to finer periods
+MAX_BARS = 400
+
+# (title, x axis label, approximate length in days, date format)
+PERIODS = (
+    ('Daily Volume', 'Day', 1, '%Y-%m-%d'),
+    ('Weekly Volume', 'Week', 7, '%Y-%m-%d'),
+    ('Monthly Volume', 'Month', 30.5, '%Y-%m'),
+)
+
+
+class HistoryBuckets:
+    ''' The confirmed incoming and outgoing amounts of a history summed per
+    day, week (starting Monday) and month, each as sorted columns: the
+    matplotlib date numbers of the periods, and the amounts in and out.
+    Building them is a single pass over the history; after that the bars of
+    any zoom range are found by bisection. '''
+
+    def __init__(self):
+        self.days = {}  # date ordinal -> [in, out], in satoshis
+        self.columns = None
+
+    def add(self, items):
+        for tx_hash, height, conf, timestamp, value, balance in items:
+            if not conf or timestamp is None or not value:
+                continue
+            day = datetime.date.fromtimestamp(timestamp).toordinal()
+            b = self.days.get(day)
+            if b is None:
+                b = self.days[day] = [0, 0]
+            if value > 0:
+                b[0] += value
+            else:
+                b[1] -= value
+        self.columns = None
+
+    @staticmethod
+    def _period_start(day, period):
+        if period == 0:
+            return day
+        if period == 1:
+            return day - datetime.date.fromordinal(day).weekday()
+        return datetime.date.fromordinal(day).replace(day=1).toordinal()
+
+    def get_columns(self, period):
+        ''' Returns (datenums, ins, outs) of PERIODS[period], amounts in
+        coins. '''
+        if self.columns is None:
+            self.columns = {}
+        cols = self.columns.get(period)
+        if cols is None:
+            sums = {}
+            for day, (v_in, v_out) in self.days.items():
+                start = self._period_start(day, period)
+                s = sums.get(start)
+                if s is None:
+                    s = sums[start] = [0, 0]
+                s[0] += v_in
+                s[1] += v_out
+            starts = sorted(sums)
+            offset = md.date2num(datetime.date.fromordinal(1)) - 1  # datenum of ordinal 0
+            cols = self.columns[period] = ([offset + d for d in starts],
+                                           [sums[d][0] / COIN for d in starts],
+                                           [sums[d][1] / COIN for d in starts])
+        return cols
+
+    def __bool__(self):
+        return bool(self.days)
+
+
+def choose_period(span_days):
+    ''' The finest period of which no more than MAX_BARS fit in span_days. '''
+    for i, (_title, _label, length, _fmt) in enumerate(PERIODS):
+        if span_days / length <= MAX_BARS:
+            return i
+    return len(PERIODS) - 1
+
+
+def plot_history(wallet, history=None):
+    ''' Plots the volume of history, by default the whole wallet's, read a
+    page at a time. However many transactions there are, at most MAX_BARS
+    bars are drawn per axes: the period of the bars follows the zoom. '''
+    buckets = HistoryBuckets()
+    if history is not None:
+        buckets.add(history)
+    else:
+        n, page_size, start = None, 10000, 0
+        while n is None or start < n:
+            n, page = wallet.get_history_page(start, start + page_size)
+            buckets.add(page)
+            start += page_size
 
     f, axarr = plt.subplots(2, sharex=True)
     plt.subplots_adjust(bottom=0.2)
     plt.xticks(rotation=25)
     ax = plt.gca()
     plt.ylabel('BCH')
-    plt.xlabel('Month')
-    xfmt = md.DateFormatter('%Y-%m-%d')
-    ax.xaxis.set_major_formatter(xfmt)
-    axarr[0].set_title('Monthly Volume')
-    xfmt = md.DateFormatter('%Y-%m')
-    ax.xaxis.set_major_formatter(xfmt)
-    width = 20
-    dates, values = zip(*sorted(hist_in.items()))
-    r1 = axarr[0].bar(dates, values, width, label='incoming')
+    if not buckets:
+        return plt
+
+    # the whole range, at the coarsest period that shows it
+    first = buckets.get_columns(len(PERIODS) - 1)[0]
+    lo, hi = first[0] - PERIODS[-1][2], first[-1] + 2 * PERIODS[-1][2]
+    bars = []
+
+    def draw(x0, x1):
+        period = choose_period(x1 - x0)
+        title, label, length, fmt = PERIODS[period]
+        dates, ins, outs = buckets.get_columns(period)
+        i, j = bisect_left(dates, x0 - length), bisect_right(dates, x1)
+        while bars:
+            bars.pop().remove()
+        width = length * 0.7
+        bars.append(axarr[0].bar(dates[i:j], ins[i:j], width, label='incoming', color='C0'))
+        bars.append(axarr[1].bar(dates[i:j], outs[i:j], width, color='r', label='outgoing'))
+        axarr[0].set_title(title)
+        ax.set_xlabel(label)
+        ax.xaxis.set_major_formatter(md.DateFormatter(fmt))
+        for a in axarr:
+            a.relim()
+            a.autoscale_view(scalex=False)
+
+    def on_xlim_changed(a):
+        draw(*a.get_xlim())
+        a.figure.canvas.draw_idle()
+
+    for a in axarr:
+        a.set_autoscalex_on(False)
+    ax.set_xlim(lo, hi)
+    draw(lo, hi)
     axarr[0].legend(loc='upper left')
-    dates, values = zip(*sorted(hist_out.items()))
-    r2 = axarr[1].bar(dates, values, width, color='r', label='outgoing')
     axarr[1].legend(loc='upper left')
+    ax.callbacks.connect('xlim_changed', on_xlim_changed)
     return plt
@@ -24,63 +24,10 @@
 Implements a custom cashaddr-style encoding for a Reusable Payment Address (RPA)
 """
 
-_CHARSET = "qpzry9x8gf2tvdw0s3jn54khce6mua7l"
-
-
-def _polymod(values):
-    """Internal function that computes the cashaddr checksum."""
-    c = 1
-    for d in values:
-        c0 = c >> 35
-        c = ((c & 0x07ffffffff) << 5) ^ d
-        if (c0 & 0x01):
-            c ^= 0x98f2bc8e61
-        if (c0 & 0x02):
-            c ^= 0x79b76d99e2
-        if (c0 & 0x04):
-            c ^= 0xf33e5fb3c4
-        if (c0 & 0x08):
-            c ^= 0xae2eabe2a8
-        if (c0 & 0x10):
-            c ^= 0x1e4f43e470
-    retval = c ^ 1
-    return retval
-
-
-def _prefix_expand(prefix):
-    """Expand the prefix into values for checksum computation."""
-    retval = bytearray(ord(x) & 0x1f for x in prefix)
-    # Append null separator
-    retval.append(0)
-    return retval
-
-
-def _create_checksum(prefix, data):
-    """Compute the checksum values given prefix and data."""
-    values = _prefix_expand(prefix) + data + bytes(8)
-    polymod = _polymod(values)
-    # Return the polymod expanded into eight 5-bit elements
-    return bytes((polymod >> 5 * (7 - i)) & 31 for i in range(8))
-
-
-def _convertbits(data, frombits, tobits, pad=True):
-    """General power-of-2 base conversion."""
-    acc = 0
-    bits = 0
-    ret = bytearray()
-    maxv = (1 << tobits) - 1
-    max_acc = (1 << (frombits + tobits - 1)) - 1
-    for value in data:
-        acc = ((acc << frombits) | value) & max_acc
-        bits += frombits
-        while bits >= tobits:
-            bits -= tobits
-            ret.append((acc >> bits) & maxv)
-
-    if pad and bits:
-        ret.append((acc << (tobits - bits)) & maxv)
-
-    return ret
+# The checksum and base conversion are the same as for regular cashaddrs
+from ..cashaddr import (_convertbits, _create_checksum,
+                        _prefixed_polymod, _string_to_values,
+                        _values_to_string)
 
 
 def _pack_addr_data(kind, addr_hash):
@@ -112,13 +59,9 @@ def _decode_payload(addr):
         raise ValueError('address prefix is missing: {}'.format(addr))
     if not all(33 <= ord(x) <= 126 for x in prefix):
         raise ValueError('invalid address prefix: {}'.format(prefix))
-    try:
-        data = bytes(_CHARSET.find(x) for x in payload)
-    except ValueError:
-        raise ValueError('invalid characters in address: {}'
-                         .format(payload))
+    data = _string_to_values(payload)
 
-    if _polymod(_prefix_expand(prefix) + data):
+    if _prefixed_polymod(prefix, data):
         raise ValueError('invalid checksum in address: {}'.format(addr))
 
     if lower != addr:
@@ -172,7 +115,7 @@ def encode(prefix, kind, addr_hash):
 
     payload = _pack_addr_data(kind, addr_hash)
     checksum = _create_checksum(prefix, payload)
-    return ''.join([_CHARSET[d] for d in (payload + checksum)])
+    return _values_to_string(payload + checksum)
 
 
 def encode_full(prefix, kind, addr_hash):
@@ -10,7 +10,10 @@
 This implements the functionality for RPA (Reusable Payment Address) aka Paycodes
 '''
 
+from ctypes import byref, c_char_p, c_int, c_size_t, c_uint, c_void_p, create_string_buffer
 from decimal import Decimal as PyDecimal
+import os
+import threading
 import time
 
 from . import addr
@@ -23,6 +26,8 @@ from ..transaction import Transaction, OPReturn
 from ..keystore import KeyStore
 from ..util import print_msg
 from .. import networks
+from .. import schnorr
+from .. import secp256k1
 
 
 def _satoshis(amount):
@@ -82,12 +87,33 @@ def _mktx(wallet, config, outputs, fee=None, change_addr=None, domain=None, noch
     return tx
 
 
+_secp256k1_rpa_shared_secret = secp256k1.bind('secp256k1_rpa_shared_secret', [ c_void_p, c_char_p, c_char_p, c_char_p, c_size_t, c_char_p, c_size_t ])
+_secp256k1_rpa_shared_secret_batch = secp256k1.bind('secp256k1_rpa_shared_secret_batch', [ c_void_p, c_char_p, c_char_p, c_char_p, c_void_p, c_char_p, c_void_p, c_size_t ])
+_secp256k1_rpa_grind = secp256k1.bind('secp256k1_rpa_grind', [ c_void_p, c_char_p, c_void_p, c_char_p, c_size_t, c_size_t, c_char_p, c_char_p, c_char_p, c_size_t, c_size_t, c_char_p, c_uint, c_void_p ])
+
+def has_fast_shared_secret():
+    """Does _calculate_paycode_shared_secret() use native code?"""
+    return bool(_secp256k1_rpa_shared_secret)
+
+def has_fast_grind():
+    """Does generate_transaction_from_paycode() grind in native code?"""
+    return bool(_secp256k1_rpa_grind)
+
+
 def _calculate_paycode_shared_secret(private_key, public_key, outpoint):
     """private key is expected to be an integer.
     public_key is expected to be bytes.
     outpoint is expected to be a string.
     returns the paycode shared secret as bytes"""
 
+    if _secp256k1_rpa_shared_secret and 0 < private_key < SECP256k1.order:
+        outpoint_bytes = to_bytes(outpoint, 'utf8')
+        shared_secret = create_string_buffer(32)
+        if _secp256k1_rpa_shared_secret(secp256k1.secp256k1.ctx, shared_secret, private_key.to_bytes(32, byteorder="big"),
+                                        public_key, len(public_key), outpoint_bytes, len(outpoint_bytes)):
+            return shared_secret.raw
+        # Invalid public key: let the Python code below raise as it always has.
+
     from ..bitcoin import Point
     from ..bitcoin import curve_secp256k1 as curve
 
@@ -119,6 +145,87 @@ def _calculate_paycode_shared_secret(private_key, public_key, outpoint):
     return shared_secret
 
 
+def _calculate_paycode_shared_secrets(private_key, public_keys_and_outpoints):
+    """Batch version of _calculate_paycode_shared_secret, for a list of
+    (public_key, outpoint) tuples that all share private_key. Returns the
+    list of shared secrets, computed in a single native call if possible."""
+    n = len(public_keys_and_outpoints)
+    if not _secp256k1_rpa_shared_secret_batch or not n or not 0 < private_key < SECP256k1.order:
+        return [_calculate_paycode_shared_secret(private_key, public_key, outpoint)
+                for public_key, outpoint in public_keys_and_outpoints]
+    public_keys = [public_key for public_key, _ in public_keys_and_outpoints]
+    outpoints = [to_bytes(outpoint, 'utf8') for _, outpoint in public_keys_and_outpoints]
+    public_key_lens = (c_size_t * n)(*map(len, public_keys))
+    outpoint_lens = (c_size_t * n)(*map(len, outpoints))
+    output = create_string_buffer(32 * n)
+    res = _secp256k1_rpa_shared_secret_batch(secp256k1.thread_context(), output, private_key.to_bytes(32, byteorder="big"),
+                                             b''.join(public_keys), public_key_lens,
+                                             b''.join(outpoints), outpoint_lens, n)
+    raw = output.raw
+    shared_secrets = [raw[i*32:(i+1)*32] for i in range(n)]
+    if not res:
+        # Some public key did not parse; redo those one at a time so the
+        # caller sees the same exception the Python code raises.
+        for i, shared_secret in enumerate(shared_secrets):
+            if shared_secret == bytes(32):
+                shared_secrets[i] = _calculate_paycode_shared_secret(private_key, *public_keys_and_outpoints[i])
+    return shared_secrets
+
+
+# Candidates each grinding thread tries per native call; progress is reported
+# and exit_event checked in between.
+_GRIND_CHUNK = 4096
+_GRIND_MAX_THREADS = 8
+
+def _grind_signature_native(sec, pre_hash, serialized_input, sigpos, paycode_hex, grinding_version,
+                            prefix, prefix_bits, exit_event=None, progress_callback=None, nthreads=None):
+    """Search, in native code, for a Schnorr signature of pre_hash under sec
+    that makes the double SHA256 of serialized_input (with the signature at
+    sigpos) start with the prefix_bits leading bits of prefix.
+
+    The search is split over nthreads threads. Thread i starts from the nonce
+    the Python loop would use for grind count i and walks on from there, so
+    threads never try the same nonce; the first one to find a match stops the
+    others. Returns the 64-byte signature, or None if exit_event was set."""
+    nthreads = nthreads or min(os.cpu_count() or 1, _GRIND_MAX_THREADS)
+    stop = c_int(0)
+    lock = threading.Lock()
+    found = []
+    tried = [0]
+
+    def worker(i):
+        ctx = secp256k1.thread_context()
+        ndata = sha256(paycode_hex + str(i) + grinding_version)
+        sig = create_string_buffer(64)
+        n = c_size_t()
+        start = 0
+        while not stop.value:
+            res = _secp256k1_rpa_grind(ctx, sig, byref(n), serialized_input, len(serialized_input), sigpos,
+                                       pre_hash, sec, ndata, start, _GRIND_CHUNK, prefix, prefix_bits, byref(stop))
+            with lock:
+                tried[0] += n.value
+                if res and not found:
+                    found.append(sig.raw)
+                    stop.value = 1
+            start += _GRIND_CHUNK
+
+    threads = [threading.Thread(target=worker, args=(i,), name="RPA grinder", daemon=True)
+               for i in range(nthreads)]
+    for t in threads:
+        t.start()
+    progress_count = 0
+    while any(t.is_alive() for t in threads):
+        if exit_event and exit_event.is_set():
+            stop.value = 1
+        if progress_callback and progress_count < tried[0] // 1000:
+            progress_count = tried[0] // 1000
+            progress_callback(progress_count)
+        threads[0].join(0.1)
+    for t in threads:
+        t.join()
+    return found[0] if found else None
+
+
 def _generate_address_from_pubkey_and_secret(parent_pubkey, secret):
     """parent_pubkey and secret are expected to be bytes
     This function generates a receiving address based on CKD."""
@@ -128,7 +235,9 @@ def _generate_address_from_pubkey_and_secret(parent_pubkey, secret):
 
     # Currently, just uses compressed keys, but if this ever changes to
     # require uncompressed points:
-    if use_uncompressed:
+    if use_uncompressed and secp256k1.secp256k1:
+        new_pubkey = secp256k1.ECPoint(new_pubkey).to_bytes(compressed=False)
+    elif use_uncompressed:
         pubkey_point = bitcoin.ser_to_point(new_pubkey)
         x_coord = hex(pubkey_point.x())[2:].zfill(64)
         y_coord = hex(pubkey_point.y())[2:].zfill(64)
@@ -313,6 +422,23 @@ def generate_transaction_from_paycode(wallet, config, amount, rpa_paycode=None,
     if progress_callback:
         progress_callback(progress_count)
 
+    if _secp256k1_rpa_grind and tx._sign_schnorr:
+        # Serialize input zero once, with a placeholder where the signature goes.
+        txin = tx._inputs[0]
+        placeholder = bytes(64) + bytes((nHashType & 0xff,))
+        txin['signatures'][0] = bh2u(placeholder)
+        txin['pubkeys'][0] = pubkey
+        serialized_input = bytes.fromhex(tx.serialize_input(txin, tx.input_script(txin, False, tx._sign_schnorr)))
+        sigpos = serialized_input.index(placeholder)
+        grind_prefix = bytes.fromhex((paycode_field_scan_pubkey[2:prefix_chars + 2] + "0")[:2 * ((prefix_chars + 1) // 2)])
+        sig = _grind_signature_native(sec, pre_hash, serialized_input, sigpos, paycode_hex, grinding_version,
+                                      grind_prefix, 4 * prefix_chars, exit_event, progress_callback)
+        if sig is not None:
+            assert schnorr.verify(bfh(pubkey), sig, pre_hash)  # verify what we just signed
+            txin['signatures'][0] = bh2u(sig + bytes((nHashType & 0xff,)))
+            tx_matches_paycode_prefix = True
+        # If cancelled, exit_event is set and the loop below returns at once.
+
     while not tx_matches_paycode_prefix:
         if exit_event:
             if exit_event.is_set():
@@ -366,17 +492,11 @@ def extract_private_keys_from_transaction(wallet, raw_tx, password=None):
                 i['address'].to_string(
                     Address.FMT_CASHADDR))
 
-    # Variables for looping
-    number_of_inputs = len(unpacked_tx["inputs"])
-    input_index = 0
-    process_inputs = True
-
-    # Process each input until we find one that creates the shared secret to
-    # get a private key for an output
-    while process_inputs:
-
+    # Collect the sender pubkey and outpoint of each input; the shared
+    # secrets for all of them are then computed in one batch.
+    candidates = []
+    for single_input in unpacked_tx["inputs"]:
         # Grab the outpoint
-        single_input = unpacked_tx["inputs"][input_index]
         prevout_hash = single_input["prevout_hash"]
         prevout_n = str(single_input["prevout_n"])  # n is int. convert to str.
         outpoint_string = prevout_hash + prevout_n
@@ -394,64 +514,52 @@ def extract_private_keys_from_transaction(wallet, raw_tx, password=None):
                     sender_pubkey = bytes.fromhex(d["pubkeys"][0])
 
         if sender_pubkey is None:
-            # exit early.  This scriptsig either doesn't have a key (coinbase
+            # skip.  This scriptsig either doesn't have a key (coinbase
             # tx, etc), or the xpubkey in the scriptsig is not a hex string
             # (P2PK etc)
-            input_index += 1
-            if input_index >= number_of_inputs:
-                process_inputs = False
             continue
 
-        sender_pubkey = bytes.fromhex(d["pubkeys"][0])
+        candidates.append((sender_pubkey, outpoint_string))
 
-        # We need the private key that corresponds to the scanpubkey.
-        # In this implementation, this is the one that goes with receiving
-        # address 0
-        scanpubkey = wallet.derive_pubkeys(0, 0)
+    if not candidates:
+        return retval
 
-        scan_private_key_wif_format = wallet.export_private_key_from_index(
-            (False, 0), password)
+    # We need the private key that corresponds to the scanpubkey.
+    # In this implementation, this is the one that goes with receiving
+    # address 0
+    scan_private_key_wif_format = wallet.export_private_key_from_index(
+        (False, 0), password)
+    scan_private_key_int_format = int.from_bytes(Base58.decode_check(scan_private_key_wif_format)[1:33],
+                                                 byteorder="big")
 
-        scan_private_key_int_format = int.from_bytes(Base58.decode_check(scan_private_key_wif_format)[1:33],
-                                                     byteorder="big")
-        # Calculate shared secret
-        shared_secret = _calculate_paycode_shared_secret(
-            scan_private_key_int_format, sender_pubkey, outpoint_string)
+    # Get the spendpubkey for our paycode.
+    # In this implementation, simply: receiving address 1.
+    spendpubkey = wallet.derive_pubkeys(0, 1)
+
+    # Fetch our own private (spend) key out of the wallet.
+    spend_private_key_wif_format = wallet.export_private_key_from_index(
+        (False, 1), password)
+    spend_private_key_int_format = int.from_bytes(Base58.decode_check(spend_private_key_wif_format)[1:33],
+                                                  byteorder="big")
 
-        # Get the spendpubkey for our paycode.
-        # In this implementation, simply: receiving address 1.
-        spendpubkey = wallet.derive_pubkeys(0, 1)
+    # Calculate the shared secrets
+    shared_secrets = _calculate_paycode_shared_secrets(scan_private_key_int_format, candidates)
 
+    for shared_secret in shared_secrets:
         # Get the destination address for the transaction
         destination = _generate_address_from_pubkey_and_secret(bytes.fromhex(spendpubkey), shared_secret).to_string(
             Address.FMT_CASHADDR)
 
-        # Fetch our own private (spend) key out of the wallet.
-        spendpubkey = wallet.derive_pubkeys(0, 1)
-        spend_private_key_wif_format = wallet.export_private_key_from_index(
-            (False, 1), password)
-        spend_private_key_int_format = int.from_bytes(Base58.decode_check(spend_private_key_wif_format)[1:33],
-                                                      byteorder="big")
-        # Generate the private key for the money being received via paycode
-        privkey = _generate_privkey_from_secret(bytes.fromhex(
-            hex(spend_private_key_int_format)[2:]), shared_secret)
-
-        # Now convert to WIF
-        extendedkey = "80" + privkey
-        extendedkey_bytes = bytes.fromhex(extendedkey)
-        checksum = bitcoin.Hash(extendedkey).hex()[0:8]
-        key_with_checksum = extendedkey + checksum
-        privkey_wif = bitcoin.EncodeBase58Check(extendedkey_bytes)
-
         # Check the address matches
         if destination in output_addresses:
+            # Generate the private key for the money being received via paycode
+            privkey = _generate_privkey_from_secret(bytes.fromhex(
+                hex(spend_private_key_int_format)[2:]), shared_secret)
+
+            # Now convert to WIF
+            extendedkey = "80" + privkey
+            extendedkey_bytes = bytes.fromhex(extendedkey)
+            privkey_wif = bitcoin.EncodeBase58Check(extendedkey_bytes)
             retval.append(privkey_wif)
-            
-        # Increment the input
-        input_index += 1
-
-        # If this was the last input, stop.
-        if input_index >= number_of_inputs:
-            process_inputs = False
 
     return retval
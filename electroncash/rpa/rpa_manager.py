@@ -23,8 +23,11 @@
 # CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 # SOFTWARE.
 
+from collections import deque
+from concurrent.futures import ThreadPoolExecutor
 from threading import Lock
 import hashlib
+import os
 import traceback
 import time
 import queue
@@ -41,11 +44,24 @@ class Rpa_manager(ThreadJob):
     External interface: __init__() and add() member functions.
     '''
 
-    def __init__(self, wallet, network):
+    def __init__(self, wallet, network, worker=None):
         self.wallet = wallet
         self.network = network
+        # Like the Synchronizer, we run on the wallet's worker if given one
+        self.worker = worker
+        self.owner = wallet.diagnostic_name()
         self.lock = Lock()
         self.rpa_q_rawtx = queue.Queue()
+
+        # Raw txs are scanned by a pool of workers.  The heavy lifting (the ECDH for every input) is done in
+        # native code with the GIL released, so this scales across cores.  self.rpa_pending holds the scans
+        # (and "lastblock" items) in queue order, so that hits are imported and rpa_height is bumped in the
+        # same order as before.
+        self.rpa_scan_workers = max(1, min(8, os.cpu_count() or 1))
+        self.rpa_scan_pool = ThreadPoolExecutor(max_workers=self.rpa_scan_workers, thread_name_prefix='RpaScan')
+        self.rpa_pending = deque()
+        self._need_release = False
+        self.cleaned_up = False
         
         # self.tx_heights is a dict that stores the height of each tx the rpa_manager encounters.
         self.tx_heights = dict()
@@ -54,6 +70,25 @@ class Rpa_manager(ThreadJob):
         self.block_requests = dict()
         
 
+    def _release(self):
+        """ Called from the thread we run in: stop the scan workers and unregister ourselves as a job. """
+        self._need_release = False
+        self.cleaned_up = True
+        for future, tx_height in self.rpa_pending:
+            if future is not None:
+                future.cancel()
+        self.rpa_pending.clear()
+        self.rpa_scan_pool.shutdown(wait=False)
+        (self.worker or self.network).remove_jobs([self])
+
+    def release(self):
+        """ Called from main thread, enqueues a 'release' to happen in the
+        thread we run in. """
+        self._need_release = True
+
+    def _callback(self, func):
+        return self.worker.callback(func) if self.worker else func
+
     def rpa_phase_1_mempool(self):
 
         # Not part of the normal peristent loop.  This is called externally when the wallet 
@@ -65,7 +100,7 @@ class Rpa_manager(ThreadJob):
         params = [rpa_grind_string]
         requests = []
         requests.append(('blockchain.reusable.get_mempool', params))
-        self.network.send(requests, self.rpa_phase_2)
+        self.network.send(requests, self._callback(self.rpa_phase_2), owner=self.owner)
         return
             
   
@@ -74,7 +109,7 @@ class Rpa_manager(ThreadJob):
         
         # Check the rawtx queue first, because if it still has transactions to process from a previous run,
         # we don't want to request more blocks from the server until we're caught up.
-        if self.rpa_q_rawtx.qsize() > 0:
+        if self.rpa_q_rawtx.qsize() > 0 or self.rpa_pending:
             return
             
         # Make sure the password is available.  If not, do nothing.
@@ -110,7 +145,7 @@ class Rpa_manager(ThreadJob):
             # Otherwise, a plethora of requests can be sent.
             if rpa_height not in self.block_requests:
                 requests.append(('blockchain.reusable.get_history', params))
-                self.network.send(requests, self.rpa_phase_2)
+                self.network.send(requests, self._callback(self.rpa_phase_2), owner=self.owner)
                 self.block_requests[rpa_height]=1
         return    
   
@@ -137,7 +172,7 @@ class Rpa_manager(ThreadJob):
             rawtx_request  = []
             params_tx_get = [txid]
             rawtx_request.append(('blockchain.transaction.get', params_tx_get))
-            self.network.send(rawtx_request,self.rpa_phase_3)
+            self.network.send(rawtx_request, self._callback(self.rpa_phase_3), owner=self.owner)
          
         # We will also implement a special queue item called "lastblock" which contains the literal strick "lastblock"
         # instead of a rawtx.  This can pushed on the queue after all other items in the payload are pushed.  The FIFO
@@ -172,39 +207,43 @@ class Rpa_manager(ThreadJob):
         return
  
   
+    def _scan_rawtx(self, rawtx, password):
+        # Runs in a worker thread.  Returns the (usually empty) list of private keys that can be extracted.
+        return self.wallet.extract_private_keys_from_transaction(rawtx, password)
+
     def rpa_phase_4(self):
         
         # The rawtx tuple unpacks into a a rawtx and a height.  There is a special value
         # for rawtx: "lastblock", which also has a height, and is treated differently.
         # It signals that the payload chunk is completely processed and the rpa_height in the wallet can be bumped.
 
-        #If the queue is empty, exit.
-        if self.rpa_q_rawtx.qsize() == 0:
-            return
-       
-        lastblock_height = 0
-        if not self.rpa_q_rawtx.empty():
-            rawtx_tuple = self.rpa_q_rawtx.get()
-            rawtx=rawtx_tuple[0]
-            tx_height = rawtx_tuple[1]
-            extracted_private_key = 0
-            
+        # Fan the queued transactions out to the scan workers, keeping a bounded number in flight.
+        max_pending = 4 * self.rpa_scan_workers
+        while len(self.rpa_pending) < max_pending and not self.rpa_q_rawtx.empty():
+            rawtx, tx_height = self.rpa_q_rawtx.get()
             if rawtx != "lastblock":
+                future = self.rpa_scan_pool.submit(self._scan_rawtx, rawtx, self.wallet.rpa_pwd)
+            else:
+                future = None
+            self.rpa_pending.append((future, tx_height))
+
+        # Merge the finished scans in queue order.  A "lastblock" item is only reached once every
+        # transaction queued ahead of it has been scanned and its keys imported.
+        new_height = 0
+        while self.rpa_pending:
+            future, tx_height = self.rpa_pending[0]
+            if future is not None and not future.done():
+                break
+            self.rpa_pending.popleft()
+            if future is not None:
                 password = self.wallet.rpa_pwd
-                # This will be assigned to zero if the private key cannot be extracted (most tx)
-                extracted_private_keys = self.wallet.extract_private_keys_from_transaction(rawtx, password)  
+                extracted_private_keys = future.result()
                 for pk in extracted_private_keys:
                     self.wallet.import_private_key(pk, password)
             else:
-                lastblock_height = tx_height
- 
-            
- 
-        new_height = 0
-        # last block
-        if lastblock_height > 0:
-            new_height = lastblock_height+1       
-            
+                # last block
+                new_height = tx_height+1
+
         if new_height > 0:
             self.wallet.storage.put('rpa_height', new_height)
             self.wallet.storage.write()          
@@ -240,6 +279,11 @@ class Rpa_manager(ThreadJob):
         # which will allow phase 1 to process the next chunk, and so on.
         #
         # Note: only phase 1 and phase 4 are called directly from this run loop.  Phases 2 and 3 are executed as callbacks.
+        # Phase 4 scans the transactions on a pool of worker threads and merges the results back in queue order.
+        if self._need_release:
+            self._release()
+        if self.cleaned_up:
+            return
         self.rpa_phase_1()
         self.rpa_phase_4()
         
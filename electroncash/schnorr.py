@@ -13,6 +13,7 @@ vulnerabilities, and must not be used in an automated-signing environment.
 '''
 import os
 import sys
+import threading
 import hmac, hashlib
 from ctypes import create_string_buffer, c_void_p, c_char_p, c_int, c_size_t, byref, cast
 
@@ -49,6 +50,14 @@ def _setup_verify_function():
 
 _secp256k1_schnorr_sign = _setup_sign_function()
 _secp256k1_schnorr_verify = _setup_verify_function()
+_secp256k1_schnorr_verify_batch = secp256k1.bind('secp256k1_schnorr_verify_batch', [ c_void_p, c_void_p, c_void_p, c_void_p, c_size_t ])
+_secp256k1_schnorr_sign_batch = secp256k1.bind('secp256k1_schnorr_sign_batch', [ c_void_p, c_void_p, c_void_p, c_size_t, c_void_p, c_void_p, c_void_p, c_void_p ])
+_secp256k1_schnorr_verify_cached = secp256k1.has_pubkey_cache() and secp256k1.bind('secp256k1_schnorr_verify_cached', [ c_void_p, c_void_p, c_char_p, c_char_p, c_char_p, c_size_t ])
+_secp256k1_schnorr_blind_sign = secp256k1.bind('secp256k1_schnorr_blind_sign', [ c_void_p, c_void_p, c_char_p, c_char_p, c_char_p ])
+_secp256k1_schnorr_blind_finalize = secp256k1.bind('secp256k1_schnorr_blind_finalize', [ c_void_p, c_void_p, c_void_p, c_char_p, c_int ])
+_secp256k1_schnorr_blind_request_get_nonce = secp256k1.bind('secp256k1_schnorr_blind_request_get_nonce', [ c_void_p, c_char_p, c_void_p, c_void_p ])
+_secp256k1_schnorr_blind_request_create = (_secp256k1_schnorr_blind_sign and _secp256k1_schnorr_blind_finalize and _secp256k1_schnorr_blind_request_get_nonce
+                                           and secp256k1.bind('secp256k1_schnorr_blind_request_create', [ c_void_p, c_void_p, c_void_p, c_char_p, c_size_t, c_char_p, c_size_t, c_char_p, c_char_p, c_void_p ]))
 seclib = secp256k1.secp256k1
 
 def has_fast_sign():
@@ -57,6 +66,15 @@ def has_fast_sign():
 def has_fast_verify():
     """Does verify() do fast schnorr verification?"""
     return bool(_secp256k1_schnorr_verify)
+def has_fast_verify_batch():
+    """Does verify_batch() do native batch verification?"""
+    return bool(_secp256k1_schnorr_verify_batch)
+def has_fast_sign_batch():
+    """Does sign_batch() sign natively in one call?"""
+    return bool(_secp256k1_schnorr_sign_batch)
+def has_fast_blind():
+    """Do BlindSigner and BlindSignatureRequest do each step in one native call?"""
+    return bool(seclib and _secp256k1_schnorr_blind_request_create)
 
 def jacobi(a, n):
     """Jacobi symbol"""
@@ -182,6 +200,61 @@ def sign(privkey, message_hash, *, ndata=None):
         return rbytes + int(s).to_bytes(32, 'big')
 
 
+def sign_batch(privkey, message_hashes, *, ndata=None, pubkey=None):
+    '''Create Schnorr signatures for many message hashes with one key.
+
+    Returns a list of 64-long bytes objects, the same ones `sign` would
+    return for each hash, or raises ValueError on failure.
+
+    With a libsecp256k1 that has secp256k1_schnorr_sign_batch, the key is
+    loaded and its public key derived once for the whole batch. If `pubkey`
+    (raw public key bytes) is given, signing fails unless it belongs to
+    `privkey`.'''
+    message_hashes = list(message_hashes)
+    if ndata is not None:
+        assert len(ndata) == 32
+    if not isinstance(privkey, bytes) or len(privkey) != 32:
+        raise ValueError('privkey must be a bytes object of length 32')
+    for message_hash in message_hashes:
+        if not isinstance(message_hash, bytes) or len(message_hash) != 32:
+            raise ValueError('message_hash must be a bytes object of length 32')
+    if pubkey is not None and (not isinstance(pubkey, bytes) or len(pubkey) not in (33, 65)):
+        raise ValueError('pubkey must be a bytes object of either length 33 or 65')
+
+    if not _secp256k1_schnorr_sign_batch:
+        if pubkey is not None and not _pubkey_matches(privkey, pubkey):
+            raise ValueError('could not sign')
+        return [sign(privkey, message_hash, ndata=ndata) for message_hash in message_hashes]
+
+    ctx = secp256k1.thread_context()
+    pubkey_parsed = None
+    if pubkey is not None:
+        pubkey_parsed = create_string_buffer(64)
+        res = secp256k1.secp256k1.secp256k1_ec_pubkey_parse(ctx, pubkey_parsed, pubkey, c_size_t(len(pubkey)))
+        if not res:
+            raise ValueError('pubkey could not be parsed by the secp256k1 library')
+    n = len(message_hashes)
+    sigs = create_string_buffer(64 * n)
+    res = _secp256k1_schnorr_sign_batch(
+        ctx, sigs, b''.join(message_hashes), c_size_t(n), privkey, pubkey_parsed, None, ndata
+    )
+    if not res:
+        # As with sign(): an invalid privkey, or one that is not pubkey's.
+        raise ValueError('could not sign')
+    raw = sigs.raw
+    return [raw[64 * i:64 * (i + 1)] for i in range(n)]
+
+def _pubkey_matches(privkey, pubkey):
+    G = ecdsa.SECP256k1.generator
+    secexp = int.from_bytes(privkey, 'big')
+    if not 0 < secexp < G.order():
+        return False
+    try:
+        return ser_to_point(pubkey) == secexp * G
+    except Exception:
+        return False
+
+
 def verify(pubkey, signature, message_hash):
     '''Verify a Schnorr signature, returning True if valid.
 
@@ -202,6 +275,12 @@ def verify(pubkey, signature, message_hash):
         raise ValueError('signature must be a bytes object of length 64')
     if not isinstance(message_hash, bytes) or len(message_hash) != 32:
         raise ValueError('message_hash must be a bytes object of length 32')
+    cache = _secp256k1_schnorr_verify_cached and secp256k1.thread_pubkey_cache()
+    if cache and _secp256k1_schnorr_verify_cached(
+            secp256k1.thread_context(), cache, signature, message_hash, pubkey, c_size_t(len(pubkey))):
+        return True
+    # Without a cache, or on failure, which the code below tells apart from
+    # an unparseable pubkey.
     if _secp256k1_schnorr_verify:
         pubkey_parsed = create_string_buffer(64)
         res = secp256k1.secp256k1.secp256k1_ec_pubkey_parse(
@@ -253,6 +332,43 @@ def verify(pubkey, signature, message_hash):
 
         return (int(R.x()).to_bytes(32, 'big') == rbytes)
 
+def verify_batch(pubkeys, signatures, message_hashes):
+    '''Verify many Schnorr signatures at once, returning True iff they are
+    all valid.
+
+    The three arguments are equal-length sequences, with the same meaning
+    per-item as the arguments to `verify` above. May raise a ValueError on
+    malformed arguments.
+
+    With a libsecp256k1 that has secp256k1_schnorr_verify_batch this costs a
+    single multi-scalar multiplication, which is several times faster than
+    verifying one by one. A False result does not tell which signature was
+    bad; call `verify` on each if you need to know.'''
+    pubkeys, signatures, message_hashes = list(pubkeys), list(signatures), list(message_hashes)
+    if not len(pubkeys) == len(signatures) == len(message_hashes):
+        raise ValueError('pubkeys, signatures and message_hashes must be of equal length')
+    n = len(pubkeys)
+    if not _secp256k1_schnorr_verify_batch or n < 2:
+        return all(verify(pubkey, sig, msg) for pubkey, sig, msg in zip(pubkeys, signatures, message_hashes))
+    for pubkey, sig, msg in zip(pubkeys, signatures, message_hashes):
+        if not isinstance(pubkey, bytes) or len(pubkey) not in (33, 65):
+            raise ValueError('pubkey must be a bytes object of either length 33 or 65')
+        if not isinstance(sig, bytes) or len(sig) != 64:
+            raise ValueError('signature must be a bytes object of length 64')
+        if not isinstance(msg, bytes) or len(msg) != 32:
+            raise ValueError('message_hash must be a bytes object of length 32')
+    ctx = secp256k1.thread_context()
+    pubkeys_parsed = [create_string_buffer(64) for _ in range(n)]
+    for buf, pubkey in zip(pubkeys_parsed, pubkeys):
+        res = secp256k1.secp256k1.secp256k1_ec_pubkey_parse(ctx, buf, pubkey, c_size_t(len(pubkey)))
+        if not res:
+            raise ValueError('pubkey could not be parsed by the secp256k1 library')
+    sig_ptrs = (c_char_p * n)(*signatures)
+    msg_ptrs = (c_char_p * n)(*message_hashes)
+    pubkey_ptrs = (c_void_p * n)(*(cast(buf, c_void_p) for buf in pubkeys_parsed))
+    res = _secp256k1_schnorr_verify_batch(ctx, sig_ptrs, msg_ptrs, pubkey_ptrs, c_size_t(n))
+    return bool(res)
+
 class BlindSigner:
     """ Schnorr blind signature creator, signer side.
 
@@ -298,8 +414,18 @@ class BlindSigner:
         k = ecdsa.util.randrange(self.order)
         # we store k in a list since .pop() is atomic.
         self._kcontainer = [k]
-        Rpoint = k * ecdsa.SECP256k1.generator
-        self.R = point_to_ser(Rpoint, comp=True)
+        if has_fast_blind():
+            ctx = secp256k1.thread_context()
+            R_buf = create_string_buffer(64)
+            res = seclib.secp256k1_ec_pubkey_create(ctx, R_buf, int(k).to_bytes(32, 'big'))
+            assert res == 1, "should never fail since 0 < k < order"
+            R_serialized = create_string_buffer(33)
+            R_size = c_size_t(33)
+            seclib.secp256k1_ec_pubkey_serialize(ctx, R_serialized, byref(R_size), R_buf, secp256k1.SECP256K1_EC_COMPRESSED)
+            self.R = R_serialized.raw
+        else:
+            Rpoint = k * ecdsa.SECP256k1.generator
+            self.R = point_to_ser(Rpoint, comp=True)
 
     def get_R(self):
         return self.R
@@ -312,6 +438,13 @@ class BlindSigner:
         except IndexError:
             raise RuntimeError("Attempted to sign twice!")
 
+        if has_fast_blind():
+            s_buf = create_string_buffer(32)
+            res = _secp256k1_schnorr_blind_sign(secp256k1.thread_context(), s_buf, int(k).to_bytes(32, 'big'), privkey, ebytes)
+            if not res:
+                raise ValueError('privkey is zero or out of range')
+            return s_buf.raw
+
         x = int.from_bytes(privkey, 'big')
         e = int.from_bytes(ebytes, 'big')
 
@@ -319,6 +452,46 @@ class BlindSigner:
         return int(s).to_bytes(32, 'big')
 
 
+# A requester usually makes many blind signature requests against the same
+# signer key, so once a key has been seen _FIXED_TABLE_MIN_USES times its b*P
+# multiplications go through a secp256k1.FixedTable, shared by all threads.
+_FIXED_TABLE_MIN_USES = 50
+_FIXED_TABLE_MAX_KEYS = 4
+_fixed_table_uses = dict()
+_fixed_tables = dict()  # compressed pubkey -> FixedTable, least recently used first
+_fixed_table_lock = threading.Lock()
+
+def _signer_fixed_table(pubkey):
+    ''' Returns the FixedTable for a serialized signer key, or None if it is
+    not (yet) used often enough to have one. '''
+    if not secp256k1.has_fixed_table():
+        return None
+    with _fixed_table_lock:
+        table = _fixed_tables.pop(pubkey, None)
+        if table is not None:
+            _fixed_tables[pubkey] = table
+            return table
+        uses = _fixed_table_uses.get(pubkey, 0) + 1
+        if uses < _FIXED_TABLE_MIN_USES:
+            if len(_fixed_table_uses) >= 64:
+                _fixed_table_uses.clear()
+            _fixed_table_uses[pubkey] = uses
+            return None
+        _fixed_table_uses.pop(pubkey, None)
+    # built outside the lock; a second thread racing here just builds another
+    pubkey_buf = create_string_buffer(64)
+    if not seclib.secp256k1_ec_pubkey_parse(seclib.ctx, pubkey_buf, pubkey, c_size_t(len(pubkey))):
+        return None
+    try:
+        table = secp256k1.FixedTable(pubkey_buf)
+    except ValueError:
+        return None
+    with _fixed_table_lock:
+        _fixed_tables[pubkey] = table
+        while len(_fixed_tables) > _FIXED_TABLE_MAX_KEYS:
+            del _fixed_tables[next(iter(_fixed_tables))]
+    return table
+
 class BlindSignatureRequest:
     """ Schnorr blind signature creator, requester side.
 
@@ -367,13 +540,17 @@ class BlindSignatureRequest:
 
         self.a = ecdsa.util.randrange(self.order)
         self.b = ecdsa.util.randrange(self.order)
-        if seclib:
+        self._request = None
+        if has_fast_blind():
+            self._create_request_native()
+        elif seclib:
             self._calc_initial_fast()
         else:
             self._calc_initial()
         assert self.c in (-1, +1)
         ehash = hashlib.sha256(self.Rxnew + self.pubkey_compressed + message_hash).digest()
-        self.e = (self.c * int.from_bytes(ehash,'big') + self.b) % self.order
+        if self._request is None:
+            self.e = (self.c * int.from_bytes(ehash,'big') + self.b) % self.order
 
         self.enew = int.from_bytes(ehash,'big') % self.order # debug
 
@@ -404,55 +581,69 @@ class BlindSignatureRequest:
 
     def _calc_initial_fast(self):
         # Fast version of _calc_initial, using libsecp256k1. About 2.4x faster.
-        ctx = seclib.ctx
-
-        abytes = int(self.a).to_bytes(32,'big')
-        bbytes = int(self.b).to_bytes(32,'big')
-
-        R_buf = create_string_buffer(64)
-        res = seclib.secp256k1_ec_pubkey_parse(ctx, R_buf, self.R, c_size_t(len(self.R)))
-        if not res:
+        # The points stay parsed in the library from start to end.
+        try:
+            Rpoint = secp256k1.ECPoint(self.R)
+        except ValueError:
             raise ValueError('R could not be parsed by the secp256k1 library')
-
-        pubkey_buf = create_string_buffer(64)
-        res = seclib.secp256k1_ec_pubkey_parse(ctx, pubkey_buf, self.pubkey, c_size_t(len(self.pubkey)))
-        if not res:
+        try:
+            pubpoint = secp256k1.ECPoint(self.pubkey)
+        except ValueError:
             raise ValueError('pubkey could not be parsed by the secp256k1 library')
 
         # resave pubkey as compressed.
-        P_compressed = create_string_buffer(33)
-        P_size = c_size_t(33)
-        res = seclib.secp256k1_ec_pubkey_serialize(ctx, P_compressed, byref(P_size), pubkey_buf, secp256k1.SECP256K1_EC_COMPRESSED)
-        self.pubkey_compressed = P_compressed.raw
-
-        A_buf = create_string_buffer(64)
+        self.pubkey_compressed = pubpoint.to_bytes(compressed=True)
 
         # calculate a*G. ~24 microsec
-        res = seclib.secp256k1_ec_pubkey_create(ctx, A_buf, abytes)
-        assert res == 1, "should never fail since 0 < a < order"
+        Apoint = secp256k1.ECPoint.generator_mul(self.a)
+        assert not Apoint.is_infinity(), "should never fail since 0 < a < order"
 
-        # in-place tweak the pubkey by multiplying with scalar b. ~33 microsec
-        res = seclib.secp256k1_ec_pubkey_tweak_mul(ctx, pubkey_buf, bbytes)
-        assert res == 1, "should never fail since 0 < b < order"
+        # multiply the pubkey by scalar b. ~33 microsec, or ~22 with a table
+        # for a frequently used signer key
+        table = _signer_fixed_table(self.pubkey)
+        Bpoint = table.mul(self.b) if table else pubpoint * self.b
+        assert not Bpoint.is_infinity(), "should never fail since 0 < b < order"
 
         # add the three points together. ~6 microsec
-        Rnew_buf = create_string_buffer(64)
-        publist = (c_void_p*3)(*(cast(x, c_void_p) for x in (R_buf, A_buf, pubkey_buf)))
-        res = seclib.secp256k1_ec_pubkey_combine(ctx, Rnew_buf, publist, 3)
-        assert res == 1, "fails with 2^-256 chance (if sum is point at infinity), in which case we have cracked the key"
+        Rnew = secp256k1.ECPoint.sum((Rpoint, Apoint, Bpoint))
+        assert not Rnew.is_infinity(), "fails with 2^-256 chance (if sum is point at infinity), in which case we have cracked the key"
 
         # serialize the new R point
-        Rnew_serialized = create_string_buffer(65)
-        Rnew_size = c_size_t(65)
-        res = seclib.secp256k1_ec_pubkey_serialize(ctx, Rnew_serialized, byref(Rnew_size), Rnew_buf, secp256k1.SECP256K1_EC_UNCOMPRESSED)
-        assert res == 1, "defined to never fail"
-        assert Rnew_size.value == 65, "should fill buffer as uncompressed"
+        Rnew_serialized = Rnew.to_bytes(compressed=False)
         self.Rxnew = Rnew_serialized[1:33]
         y = int.from_bytes(Rnew_serialized[33:], byteorder="big")
 
         # calculate the jacobi symbol (+1 or -1). ~30 microsec, because pure python :(
         self.c = jacobi(y, self.fieldsize)
 
+    def _create_request_native(self):
+        # One native call for what _calc_initial_fast does and for e, keeping
+        # a, c and R'.x in the opaque request for finalize(). Rxnew, c and
+        # pubkey_compressed are then set as on the other paths.
+        self._request = create_string_buffer(161)
+        e_buf = create_string_buffer(32)
+        table = _signer_fixed_table(self.pubkey)
+        blind = int(self.a).to_bytes(32,'big') + int(self.b).to_bytes(32,'big')
+        res = _secp256k1_schnorr_blind_request_create(
+            secp256k1.thread_context(), self._request, e_buf, self.pubkey, c_size_t(len(self.pubkey)),
+            self.R, c_size_t(len(self.R)), self.message_hash, blind, table.table if table else None)
+        if not res:
+            self._request = None
+            R_buf = create_string_buffer(64)
+            if not seclib.secp256k1_ec_pubkey_parse(seclib.ctx, R_buf, self.R, c_size_t(len(self.R))):
+                raise ValueError('R could not be parsed by the secp256k1 library')
+            if not seclib.secp256k1_ec_pubkey_parse(seclib.ctx, R_buf, self.pubkey, c_size_t(len(self.pubkey))):
+                raise ValueError('pubkey could not be parsed by the secp256k1 library')
+            raise AssertionError("fails with 2^-256 chance (if R' is the point at infinity), in which case we have cracked the key")
+        self.e = int.from_bytes(e_buf.raw, 'big')
+
+        Rx_buf = create_string_buffer(32)
+        negated = c_int()
+        _secp256k1_schnorr_blind_request_get_nonce(secp256k1.thread_context(), Rx_buf, byref(negated), self._request)
+        self.Rxnew = Rx_buf.raw
+        self.c = -1 if negated.value else +1
+        self.pubkey_compressed = secp256k1.ECPoint(self.pubkey).to_bytes(compressed=True)
+
     def get_request(self,):
         """ returns 32 bytes e value, to be sent to the signer """
         return int(self.e).to_bytes(32,'big')
@@ -465,6 +656,12 @@ class BlindSignatureRequest:
         the blind signer has provided an incorrect blinded s value."""
         assert len(sbytes) == 32
 
+        if self._request is not None:
+            sig_buf = create_string_buffer(64)
+            if not _secp256k1_schnorr_blind_finalize(secp256k1.thread_context(), sig_buf, self._request, bytes(sbytes), int(bool(check))):
+                raise RuntimeError("Blind signature verification failed.")
+            return sig_buf.raw
+
         s = int.from_bytes(sbytes,'big')
 
         snew = (self.c*(s + self.a)) % self.order
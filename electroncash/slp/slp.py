@@ -4,8 +4,11 @@ from .. import caches
 from .. import util
 from ..transaction import Transaction
 from typing import List, Tuple, Set
+import queue
+import threading
 
 from .exceptions import *
+from . import validation
 
 lokad_id = b"SLP\x00"  # aka protocol code (prefix) -- this appears after the 'OP_RETURN + OP_PUSH(4)' bytes in the ScriptOutput for *ALL* SLP scripts
 valid_token_types = frozenset((1, 65, 129))  # any token types not in this set will be rejected
@@ -626,6 +629,7 @@ class WalletData(util.PrintError):
     def __init__(self, wallet):
         assert wallet
         self.wallet = wallet
+        self.validation_thread = None
         self.clear()
 
     def diagnostic_name(self):
@@ -651,6 +655,8 @@ class WalletData(util.PrintError):
                     self.txo_token_id[txo] = token_id_hex
             # dict of Address -> set of txo_name
             self.txo_byaddr = {address.Address.from_string(k) : {vv.lower() for vv in v} for k,v in data['txo_byaddr'].items()}
+            # dict of txid -> validation.Result; absent in older files
+            self.validation = {k.lower() : validation.Result.from_json(v) for k,v in data.get('validation', {}).items()}
             self.need_rebuild = False
         except (ValueError, TypeError, AttributeError, address.AddressError, AssertionError, KeyError) as e:
             # Note: We want TypeError/AttributeError/KeyError raised above on
@@ -669,6 +675,7 @@ class WalletData(util.PrintError):
             'validity' : self.validity,
             'token_quantities' : {k:list([v0,v1] for v0,v1 in v.items()) for k,v in self.token_quantities.items()},
             'txo_byaddr' : { k.to_storage_string() : list(v) for k,v in self.txo_byaddr.items() },
+            'validation' : { k : v.to_json() for k,v in self.validation.items() },
             'version' : self.DATA_VERSION,
         }
         self.wallet.storage.put('slp', data)
@@ -680,13 +687,17 @@ class WalletData(util.PrintError):
         self.txo_byaddr = dict()  # [address] -> set of "prevouthash:n" for that address
         self.token_quantities = dict() # [token_id_hex] -> dict of ["prevouthash:n"] -> qty (-1 for qty indicates minting baton)
         self.txo_token_id = dict() # ["prevouthash:n"] -> "token_id_hex"
+        self.validation = dict() # ["txid"] -> validation.Result, for the wallet's SLP txs and all of their ancestors
 
     def rebuild(self):
         '''This takes wallet.lock'''
         with self.wallet.lock:
+            # What was learned about the ancestors doesn't depend on this wallet's data
+            kept_validation = self.validation
             self.clear()
-            for txid, tx in self.wallet.transactions.items():
-                self.add_tx(txid, Transaction(tx.raw))  # we take a copy of the transaction so prevent storing deserialized tx in wallet.transactions dict
+            self.validation = kept_validation
+            for txid, raw in self.wallet.transactions.raw_items():
+                self.add_tx(txid, Transaction(raw))  # we take a copy of the transaction so prevent storing deserialized tx in wallet.transactions dict
 
     #--- GETTERS / SETTERS from wallet
     def token_info_for_txo(self, txo) -> Tuple[str, int]:
@@ -720,6 +731,59 @@ class WalletData(util.PrintError):
                             if qty <= -1)
     #--- /GETTERS/SETTERS
 
+    #-- Validation
+    def start(self, network):
+        ''' Starts validating the wallet's SLP txs of unknown validity in a
+        thread, now and whenever add_tx adds one. '''
+        q = queue.Queue()
+        q.put(True)
+        self.validation_thread = threading.Thread(target=self._validation_thread, args=(network, q),
+                                                  daemon=True, name=self.diagnostic_name() + '/validation')
+        self.validation_thread.q = q
+        self.validation_thread.start()
+
+    def stop(self):
+        t, self.validation_thread = self.validation_thread, None  # this also signals a stop
+        if t and t.is_alive():
+            t.q.put(None)  # signal stop
+            # if the join times out, it's ok. it means the thread was stuck in
+            # a network call and it will eventually exit.
+            t.join(timeout=3.0)
+
+    def _validation_thread(self, network, q):
+        fetch = validation.network_fetcher(self.wallet, network)
+        while True:
+            item = q.get()
+            while item is not None and not q.empty():
+                item = q.get()  # one pass covers all the txs added meanwhile
+            if item is None:
+                return
+            try:
+                self.validate_pending(fetch)
+            except Exception as e:
+                self.print_error("Validation failed:", repr(e))
+
+    def validate_pending(self, fetch):
+        ''' Validates the txs in self.validity that are still UNKNOWN. The DAG
+        walk runs without locks, on a copy of self.validation, so that the
+        wallet isn't held up by network round trips. '''
+        with self.wallet.lock:
+            txids = [txid for txid, v in self.validity.items() if v == validation.UNKNOWN]
+            results = dict(self.validation)
+        if not txids:
+            return
+        known = set(results)
+        validities = validation.Validator(results, fetch).validate(txids)
+        with self.wallet.lock:
+            for txid in results.keys() - known:
+                self.validation[txid] = results[txid]
+            for txid, v in validities.items():
+                if txid in self.validity:
+                    self.validity[txid] = v
+        self.print_error(f"Validated {sum(1 for v in validities.values() if v)} of {len(txids)} tx(s),",
+                         len(results) - len(known), "new result(s)")
+    #-- /Validation
+
     #-- Wallet hooks (rm_tx, add_tx)
     def rm_tx(self, txid):
         ''' Caller should hold wallet.lock
@@ -779,6 +843,9 @@ class WalletData(util.PrintError):
                 raise InvalidOutputMessage('Bad transaction type')
         except (AssertionError, ValueError, KeyError, TypeError, IndexError) as e:
             self.print_error(f"ERROR: tx {txid}; exc =", repr(e))
+        t = self.validation_thread
+        if t and self.validity.get(txid) == validation.UNKNOWN:
+            t.q.put(True)  # wake it up
     #-- /Wallet hooks (rm_tx, add_tx)
 
     def _add_token_qty(self, token_id_hex, txo_name, qty):
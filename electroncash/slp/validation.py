@@ -0,0 +1,250 @@
+#!/usr/bin/env python3
+#
+# Electron Cash - lightweight Bitcoin client
+# Copyright (C) 2017-2022 The Electron Cash Developers
+#
+# Permission is hereby granted, free of charge, to any person
+# obtaining a copy of this software and associated documentation files
+# (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge,
+# publish, distribute, sublicense, and/or sell copies of the Software,
+# and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be
+# included in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+# BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+# ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+'''
+SLP token transaction validation.
+
+Whether a SEND or MINT is valid depends on the token outputs it spends, and
+so on the validity of the transactions that created them, all the way back
+to the GENESIS. The Validator walks that ancestor DAG breadth-first, fetching
+each level of it in one batch, and then judges the transactions from the
+oldest down. Every result, including "not SLP" for the plain transactions
+met on the way, goes into a dict keyed by txid that the caller persists (see
+WalletData.validation), and a walk stops at any transaction already in it,
+so the history of a wallet is only ever validated once.
+'''
+
+import queue
+import time
+from collections import namedtuple
+from typing import Callable, Dict, Iterable, Optional
+
+from .. import util
+from ..transaction import Transaction
+from .exceptions import Error
+
+# Values of WalletData.validity and of Result.validity
+UNKNOWN = 0
+VALID = 1
+INVALID_SLP = 2  # not SLP at all, or a bad message
+INVALID_DAG = 3  # a well formed message whose inputs don't back it up
+
+NFT_CHILD, NFT_PARENT = 65, 129
+
+
+class Result(namedtuple("Result", "validity token_id_hex token_type amounts baton_vout")):
+    ''' What is known about a transaction once it has been judged. `amounts`
+    is the token quantity on each output of a valid one, indexed by vout. '''
+
+    def to_json(self):
+        return [self.validity, self.token_id_hex, self.token_type, list(self.amounts), self.baton_vout]
+
+    @classmethod
+    def from_json(cls, v):
+        validity, token_id_hex, token_type, amounts, baton_vout = v
+        return cls(int(validity), token_id_hex, token_type, tuple(int(a) for a in amounts), baton_vout)
+
+    def token_qty(self, n, token_id_hex, token_type):
+        ''' The quantity of the token on output n, 0 if none. '''
+        if (self.validity != VALID or self.token_id_hex != token_id_hex
+                or self.token_type != token_type or n >= len(self.amounts)):
+            return 0
+        return self.amounts[n]
+
+    def has_baton(self, n, token_id_hex, token_type):
+        return (self.validity == VALID and self.baton_vout == n
+                and self.token_id_hex == token_id_hex and self.token_type == token_type)
+
+
+NOT_SLP = Result(INVALID_SLP, None, None, (), None)
+
+
+def _message(tx):
+    ''' The parsed SLP message of tx, or None. '''
+    from .slp import ScriptOutput  # circular import
+    outputs = tx.outputs()
+    so = outputs and outputs[0][1]
+    return so.message if isinstance(so, ScriptOutput) else None
+
+
+def _needs_inputs(msg):
+    ''' Whether the validity of a message depends on what its tx spends. '''
+    return (msg.transaction_type in ('SEND', 'MINT')
+            or msg.transaction_type == 'GENESIS' and msg.token_type == NFT_CHILD)
+
+
+def _parents(tx):
+    ''' The txids tx spends outputs of that could carry tokens (output 0 is
+    always the OP_RETURN). '''
+    return {inp['prevout_hash'] for inp in tx.inputs() if inp['prevout_n'] > 0}
+
+
+class Validator(util.PrintError):
+    ''' Validates SLP transactions against, and into, `results`, a dict of
+    txid -> Result.
+
+    `fetch` is called with a list of txids and returns a dict of
+    txid -> Transaction for those it could get. A transaction that can't be
+    fetched leaves whatever depends on it UNKNOWN, to be tried again later. '''
+
+    def __init__(self, results: Dict[str, Result], fetch: Callable[[list], Dict[str, Transaction]]):
+        self.results = results
+        self.fetch = fetch
+
+    def validate(self, txids: Iterable[str]) -> Dict[str, int]:
+        ''' Returns the validity of each of txids. '''
+        txids = list(txids)
+        messages = {}  # txid -> (tx, message) for the part of the DAG not in self.results
+        frontier = {t for t in txids if t not in self.results}
+        while frontier:
+            txs = self.fetch(sorted(frontier))
+            parents = set()
+            for txid in frontier:
+                tx = txs.get(txid)
+                if tx is None:
+                    messages[txid] = (None, None)
+                    continue
+                try:
+                    msg = _message(tx)
+                    needs_inputs = msg is not None and _needs_inputs(msg)
+                except Error:
+                    msg = None
+                if msg is None:
+                    self.results[txid] = NOT_SLP
+                    continue
+                messages[txid] = (tx, msg)
+                if needs_inputs:
+                    parents |= _parents(tx)
+            frontier = {p for p in parents if p not in self.results and p not in messages}
+        self._judge(messages)
+        return {t: self.results[t].validity if t in self.results else UNKNOWN for t in txids}
+
+    def _judge(self, messages):
+        ''' Judges the transactions of `messages` with all of their parents
+        judged first, without recursing since the DAG can be deep. '''
+        unknown = set()  # couldn't be fetched, or depends on one that couldn't
+        for root in messages:
+            stack = [root]
+            while stack:
+                txid = stack[-1]
+                if txid in self.results or txid in unknown:
+                    stack.pop()
+                    continue
+                tx, msg = messages[txid]
+                if tx is None:
+                    unknown.add(txid)
+                    stack.pop()
+                    continue
+                parents = _parents(tx) if _needs_inputs(msg) else ()
+                pending = [p for p in parents if p not in self.results and p not in unknown]
+                if pending:
+                    stack.extend(pending)
+                    continue
+                stack.pop()
+                if any(p in unknown for p in parents):
+                    unknown.add(txid)
+                    continue
+                try:
+                    self.results[txid] = self._judge_one(txid, tx, msg)
+                except Error as e:
+                    # breaks the SLP spec: final
+                    self.print_error(f"tx {txid}: {e!r}")
+                    self.results[txid] = NOT_SLP
+                except Exception as e:
+                    # a bug or a bad tx from the server: not cached, so it is
+                    # judged again next time
+                    self.print_error(f"tx {txid}: unexpected error, leaving it unknown: {e!r}")
+                    unknown.add(txid)
+
+    def _judge_one(self, txid, tx, msg):
+        token_type, transaction_type = msg.token_type, msg.transaction_type
+        n_outputs = len(tx.outputs())
+        if transaction_type in ('GENESIS', 'MINT'):
+            token_id_hex = txid if transaction_type == 'GENESIS' else msg.token_id_hex
+            if transaction_type == 'GENESIS':
+                qty = msg.initial_token_mint_quantity
+                if token_type == NFT_CHILD:
+                    # An NFT1 child genesis must burn a parent group token, on its first input
+                    inp = tx.inputs()[0]
+                    parent = self.results.get(inp['prevout_hash'])
+                    if not parent or parent.validity != VALID or parent.token_type != NFT_PARENT or not parent.token_qty(inp['prevout_n'], parent.token_id_hex, NFT_PARENT):
+                        return Result(INVALID_DAG, token_id_hex, token_type, (), None)
+            else:
+                qty = msg.additional_token_quantity
+                if not any(self.results[inp['prevout_hash']].has_baton(inp['prevout_n'], token_id_hex, token_type)
+                           for inp in tx.inputs() if inp['prevout_hash'] in self.results):
+                    return Result(INVALID_DAG, token_id_hex, token_type, (), None)
+            baton_vout = msg.mint_baton_vout
+            if baton_vout is not None and baton_vout >= n_outputs:
+                baton_vout = None
+            amounts = (0, qty) if n_outputs > 1 else ()
+            return Result(VALID, token_id_hex, token_type, amounts, baton_vout)
+        if transaction_type == 'SEND':
+            token_id_hex = msg.token_id_hex
+            amounts = msg.token_output
+            available = sum(self.results[inp['prevout_hash']].token_qty(inp['prevout_n'], token_id_hex, token_type)
+                            for inp in tx.inputs() if inp['prevout_hash'] in self.results)
+            if available < sum(amounts):
+                return Result(INVALID_DAG, token_id_hex, token_type, (), None)
+            return Result(VALID, token_id_hex, token_type, amounts[:n_outputs], None)
+        return NOT_SLP  # COMMIT
+
+
+def network_fetcher(wallet, network, *, timeout=30) -> Callable[[list], Dict[str, Transaction]]:
+    ''' Returns a `fetch` for Validator that looks in the wallet and the
+    network's tx_store first, and asks the server for the rest all at once,
+    so that they go out in JSON-RPC batches and are answered in parallel. '''
+    def fetch(txids):
+        txs, missing = {}, []
+        for txid in txids:
+            raw = wallet.transactions.get_raw(txid)
+            if raw is None and network.tx_store:
+                raw = network.tx_store.get(txid)
+                raw = raw and raw.hex()
+            if raw is not None:
+                txs[txid] = Transaction(raw)
+            else:
+                missing.append(txid)
+        if not missing:
+            return txs
+        q = queue.Queue()
+        network.send([('blockchain.transaction.get', [txid]) for txid in missing], q.put)
+        deadline = time.time() + timeout
+        for _ in missing:
+            try:
+                r = q.get(True, max(deadline - time.time(), 0.0))
+            except queue.Empty:
+                break  # the rest stay unknown, for next time
+            txid = (r.get('params') or [None])[0]
+            raw = r.get('result')
+            if r.get('error') or txid not in missing or not isinstance(raw, str):
+                continue
+            tx = Transaction(raw)
+            try:
+                if tx.txid() == txid:
+                    txs[txid] = tx
+            except Exception:
+                pass
+        return txs
+    return fetch
@@ -28,6 +28,7 @@ import threading
 import json
 import copy
 import re
+import shutil
 import stat
 import hmac, hashlib
 import base64
@@ -38,6 +39,7 @@ from .util import PrintError, profiler, standardize_path
 from .plugins import run_hook, plugin_loaders
 from .keystore import bip44_derivation
 from . import bitcoin
+from . import storage_tables
 
 
 # seed_version is now used for the version of the wallet file
@@ -47,8 +49,22 @@ NEW_SEED_VERSION = 11       # electrum versions >= 2.0
 FINAL_SEED_VERSION = 17     # electrum >= 2.7 will set this to prevent
                             # old versions from overwriting new format
 
+# Written instead of FINAL_SEED_VERSION by wallets with 'binary_tables' set,
+# whose big tables are in the BINARY_TABLES_KEY blob (see storage_tables.py),
+# so that older versions refuse the file instead of finding no history in it.
+# Loading decodes the blob, so in memory such a wallet is at FINAL_SEED_VERSION.
+BINARY_TABLES_SEED_VERSION = 18
+BINARY_TABLES_KEY = 'binary_tables_v1'
+
 TMP_SUFFIX = ".tmp.{}".format(os.getpid())
 
+# Changes since the last full write are appended to a sidecar journal next to
+# the wallet file, one line per write().  The journal is folded back into the
+# wallet file ("compacted") once it grows past this many bytes, or past half
+# the size of the wallet file itself, whichever is larger.
+JOURNAL_SUFFIX = ".journal"
+JOURNAL_COMPACT_MIN_BYTES = 512 * 1024
+
 
 def multisig_type(wallet_type):
     '''If wallet_type is mofn multi-sig, return [m, n],
@@ -61,6 +77,34 @@ def multisig_type(wallet_type):
     return match
 
 
+def delete_wallet_file(path):
+    '''Remove a wallet file and its journal, if it has one.'''
+    os.remove(path)
+    try:
+        os.remove(path + JOURNAL_SUFFIX)
+    except FileNotFoundError:
+        pass
+
+
+def rename_wallet_file(path, new_path):
+    '''Rename a closed wallet file together with its journal, if it has one.'''
+    os.rename(path, new_path)
+    if os.path.exists(path + JOURNAL_SUFFIX):
+        os.rename(path + JOURNAL_SUFFIX, new_path + JOURNAL_SUFFIX)
+
+
+def copy_wallet_file(path, new_path):
+    '''Copy a closed wallet file together with its journal, if it has one.'''
+    shutil.copyfile(path, new_path)
+    if os.path.exists(path + JOURNAL_SUFFIX):
+        shutil.copyfile(path + JOURNAL_SUFFIX, new_path + JOURNAL_SUFFIX)
+
+
+def is_wallet_file_name(name):
+    '''False for the temporary and journal files kept next to wallet files.'''
+    return not (name.endswith(TMP_SUFFIX) or name.endswith(JOURNAL_SUFFIX))
+
+
 class WalletStorage(PrintError):
 
     def __init__(self, path, manual_upgrades=False, *, in_memory_only=False):
@@ -74,6 +118,12 @@ class WalletStorage(PrintError):
         self.pubkey = None
         self.raw = None
         self._in_memory_only=in_memory_only
+        # key -> None if the whole value changed, or the set of changed subkeys
+        self._dirty = {}
+        # digest of the wallet file our journal on disk extends, None if no journal
+        self._journal_base = None
+        self._journal_size = 0
+        self._needs_compact = False
         if self.file_exists() and not self._in_memory_only:
             try:
                 with open(self.path, "r", encoding='utf-8') as f:
@@ -86,7 +136,7 @@ class WalletStorage(PrintError):
             # avoid new wallets getting 'upgraded'
             self.put('seed_version', FINAL_SEED_VERSION)
 
-    def load_data(self, s):
+    def load_data(self, s, ec_key=None):
         try:
             self.data = json.loads(s)
 
@@ -108,6 +158,17 @@ class WalletStorage(PrintError):
                     continue
                 self.data[key] = value
 
+        blob = self.data.pop(BINARY_TABLES_KEY, None)
+        if blob is not None:
+            try:
+                self.data.update(storage_tables.decode(base64.b64decode(blob)))
+            except Exception as e:
+                raise IOError("Cannot read wallet file '%s': %s" % (self.path, e))
+            if self.data.get('seed_version') == BINARY_TABLES_SEED_VERSION:
+                self.data['seed_version'] = FINAL_SEED_VERSION
+
+        self._replay_journal(ec_key)
+
         # check here if I need to load a plugin
         t = self.get('wallet_type')
         l = plugin_loaders.get(t)
@@ -139,7 +200,7 @@ class WalletStorage(PrintError):
         s = zlib.decompress(ec_key.decrypt_message(self.raw)) if self.raw else None
         self.pubkey = ec_key.get_public_key()
         s = s.decode('utf8')
-        self.load_data(s)
+        self.load_data(s, ec_key)
 
     def set_password(self, password, encrypt):
         self.put('use_encryption', bool(password))
@@ -150,7 +211,20 @@ class WalletStorage(PrintError):
         else:
             self.pubkey = None
         if self.pubkey != old_pubkey:
+            # journal entries are encrypted to the pubkey, so rewrite everything
             self.modified = True
+            self._needs_compact = True
+
+    def set_binary_tables(self, enable):
+        ''' Have the transactions, txi, txo, verified_tx3 and addr_history
+        tables saved in the compact binary form of storage_tables.py (which
+        this and later versions read regardless), or as plain JSON again. The
+        file is rewritten in the new form on the next write(). '''
+        enable = bool(enable)
+        with self.lock:
+            if enable != bool(self.data.get('binary_tables')):
+                self.put('binary_tables', enable or None)
+                self._needs_compact = True
 
     def get(self, key, default=None):
         with self.lock:
@@ -164,12 +238,39 @@ class WalletStorage(PrintError):
     def put(self, key, value):
         with self.lock:
             if value is not None:
-                if self.data.get(key) != value:
-                    self.modified = True
+                old = self.data.get(key)
+                if old == value:
+                    return
+                if type(old) is dict and type(value) is dict:
+                    # Large dicts like 'transactions' and 'verified_tx3' mostly
+                    # change a few entries at a time, so only copy (and later
+                    # journal) those.
+                    changed = [k for k, v in value.items() if k not in old or old[k] != v]
+                    removed = [k for k in old if k not in value]
+                    for k in changed:
+                        old[k] = copy.deepcopy(value[k])
+                    for k in removed:
+                        del old[k]
+                    self._set_dirty(key, changed + removed)
+                else:
                     self.data[key] = copy.deepcopy(value)
+                    self._set_dirty(key)
             elif key in self.data:
-                self.modified = True
                 self.data.pop(key)
+                self._set_dirty(key)
+
+    def _set_dirty(self, key, subkeys=None):
+        self.modified = True
+        if type(key) is not str:
+            # json.dumps would turn it into a str, replaying it would not
+            self._needs_compact = True
+            return
+        if key in self._dirty and self._dirty[key] is None:
+            return
+        if subkeys is None or any(type(k) is not str for k in subkeys):
+            self._dirty[key] = None
+        else:
+            self._dirty.setdefault(key, set()).update(subkeys)
 
     @profiler
     def write(self):
@@ -178,13 +279,160 @@ class WalletStorage(PrintError):
         with self.lock:
             self._write()
 
+    def compact(self):
+        '''Fold the journal back into the wallet file, so that the file alone
+        holds the whole wallet again. Call before copying the file elsewhere.'''
+        if self._in_memory_only:
+            return
+        with self.lock:
+            if self._journal_base is not None or self._needs_compact:
+                self._needs_compact = True
+                self.modified = True
+            self._write()
+
     def _write(self):
         if threading.currentThread().isDaemon():
             self.print_error('warning: daemon thread cannot write wallet')
             return
         if not self.modified:
             return
-        s = json.dumps(self.data,
+        if not self._append_journal():
+            self._write_full()
+        self._dirty.clear()
+        self.modified = False
+
+    def _journal_path(self):
+        return self.path + JOURNAL_SUFFIX
+
+    def _raw_digest(self):
+        return hashlib.sha256(self.raw.encode('utf8')).hexdigest()
+
+    def _remove_journal(self):
+        try:
+            os.remove(self._journal_path())
+        except FileNotFoundError:
+            pass
+
+    def _append_journal(self):
+        '''Write only the keys changed since the last write, as one line
+        appended to the journal. Returns False if a full write is due
+        instead.'''
+        if self._needs_compact or not self._dirty or self.raw is None or not self.file_exists():
+            return False
+        records = []
+        for key, subkeys in self._dirty.items():
+            if key not in self.data:
+                records.append([key])
+                continue
+            value = self.data[key]
+            if subkeys is None or type(value) is not dict:
+                records.append([key, value])
+            else:
+                records.append([key, {k: value[k] for k in subkeys if k in value},
+                                [k for k in subkeys if k not in value]])
+        entry = json.dumps(records).encode('utf8')
+        if self.pubkey:
+            entry = bitcoin.encrypt_message(zlib.compress(entry), self.pubkey)
+        entry += b'\n'
+
+        limit = max(JOURNAL_COMPACT_MIN_BYTES, len(self.raw) // 2)
+        journal_path = self._journal_path()
+        if self._journal_base is None:
+            # Start a new journal. It is created whole, like the wallet file,
+            # so that it never exists without its header.
+            digest = self._raw_digest()
+            header = json.dumps({'base': digest}).encode('utf8') + b'\n'
+            if len(header) + len(entry) > limit:
+                return False
+            temp_path = journal_path + TMP_SUFFIX
+            with open(temp_path, "wb") as f:
+                f.write(header + entry)
+                f.flush()
+                os.fsync(f.fileno())
+            os.replace(temp_path, journal_path)
+            os.chmod(journal_path, stat.S_IREAD | stat.S_IWRITE)
+            self._journal_base = digest
+            self._journal_size = len(header) + len(entry)
+        else:
+            if self._journal_size + len(entry) > limit:
+                return False
+            with open(journal_path, "ab") as f:
+                if f.tell() != self._journal_size:
+                    # not the journal we last wrote, don't extend it
+                    self.print_error("journal changed on disk, rewriting", self.path)
+                    return False
+                # A torn line from a failed append is dropped on load, but
+                # nothing may follow it, so compact next time unless all is well.
+                self._needs_compact = True
+                f.write(entry)
+                f.flush()
+                os.fsync(f.fileno())
+                self._needs_compact = False
+            self._journal_size += len(entry)
+        self.print_error("journaled", len(records), "keys to", journal_path)
+        return True
+
+    def _replay_journal(self, ec_key):
+        '''Apply the journal on disk, if it extends the wallet file we just read.'''
+        if self._in_memory_only or self.raw is None:
+            return
+        journal_path = self._journal_path()
+        try:
+            with open(journal_path, "rb") as f:
+                journal = f.read()
+        except FileNotFoundError:
+            return
+        lines = journal.split(b'\n')
+        torn = lines.pop()  # non-empty only if the last append did not complete
+        digest = self._raw_digest()
+        try:
+            current = json.loads(lines[0].decode('utf8')).get('base') == digest
+        except Exception:
+            current = False
+        if not current:
+            # left behind by a compaction that did not get to remove it
+            self.print_error("ignoring stale journal", journal_path)
+            self._needs_compact = True
+            return
+        self._journal_base = digest
+        self._journal_size = len(journal)
+        if torn:
+            self._needs_compact = True
+        applied = 0
+        for line in lines[1:]:
+            try:
+                if ec_key:
+                    line = zlib.decompress(ec_key.decrypt_message(line))
+                records = json.loads(line.decode('utf8'))
+            except Exception as e:
+                self.print_error("dropping unreadable journal entries:", repr(e))
+                self._needs_compact = True
+                break
+            for record in records:
+                key = record[0]
+                if len(record) == 1:
+                    self.data.pop(key, None)
+                elif len(record) == 2:
+                    self.data[key] = record[1]
+                else:
+                    d = self.data.get(key)
+                    if type(d) is not dict:
+                        d = self.data[key] = {}
+                    d.update(record[1])
+                    for k in record[2]:
+                        d.pop(k, None)
+            applied += 1
+        self.print_error("replayed", applied, "journal entries from", journal_path)
+
+    def _write_full(self):
+        data = self.data
+        if data.get('binary_tables') and data.get('seed_version') == FINAL_SEED_VERSION:
+            blob, names = storage_tables.encode(data)
+            if blob is not None:
+                data = {k: v for k, v in data.items() if k not in names}
+                data[BINARY_TABLES_KEY] = base64.b64encode(blob).decode('ascii')
+                data['seed_version'] = BINARY_TABLES_SEED_VERSION
+        s = json.dumps(data,
                        indent=None if self.pubkey else 4,  # Fast settings if encrypted,
                        sort_keys=not self.pubkey)          # readable settings otherwise.
         if self.pubkey:
@@ -209,12 +457,24 @@ class WalletStorage(PrintError):
         if not self.file_exists():
             # See: https://github.com/spesmilo/electrum/issues/5082
             assert not os.path.exists(self.path)
+        # The journal only applies on top of the file it was started from. Drop
+        # it after the new file is in place, so a crash in between leaves the
+        # old file and journal intact. If the new file is byte-identical to
+        # that old one, or the journal was never valid, drop it first instead.
+        drop_first = (self._journal_base is None
+                      or self._journal_base == hashlib.sha256(s.encode('utf8')).hexdigest())
+        if drop_first:
+            self._remove_journal()
         os.replace(temp_path, self.path)
         os.chmod(self.path, mode)
+        if not drop_first:
+            self._remove_journal()
+        self._journal_base = None
+        self._journal_size = 0
+        self._needs_compact = False
         self.raw = s
         self._file_exists = True
         self.print_error("saved", self.path)
-        self.modified = False
 
     def requires_split(self):
         d = self.get('accounts', {})
@@ -0,0 +1,280 @@
+#!/usr/bin/env python3
+#
+# Electron Cash - lightweight Bitcoin client
+# Copyright (C) 2017-2022 The Electron Cash Developers
+#
+# Permission is hereby granted, free of charge, to any person
+# obtaining a copy of this software and associated documentation files
+# (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge,
+# publish, distribute, sublicense, and/or sell copies of the Software,
+# and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be
+# included in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+# BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+# ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+'''
+Compact binary encoding of the large tables of a wallet file, used by
+WalletStorage when the wallet has 'binary_tables' set.
+
+In JSON, every txid of every table is a 64-char string and every address is
+spelled out again in each txi/txo/history entry it appears in, and the parser
+builds all of those strings. Here each distinct address and txid is stored
+once, in a pool, and the tables are arrays of fixed-width little-endian
+records referring to the pools by index, read back with struct.iter_unpack
+over a memoryview of the blob. Raw transactions are stored as bytes.
+
+The blob has a small header followed by sections:
+
+    b'ECWT' version:u8
+    then per section: name_len:u8 name count:u32 payload_len:u32 payload
+
+with the 'addresses' and 'txids' pools first and then the tables. Decoding
+gives exactly the dicts of lists that json.loads would have, so nothing
+above WalletStorage can tell the difference. A table whose contents don't
+fit the expected shape is simply left out, and stays in the JSON.
+'''
+
+import gc
+import struct
+
+MAGIC = b'ECWT'
+VERSION = 1
+
+TABLES = ('transactions', 'txi', 'txo', 'verified_tx3', 'addr_history')
+
+_SECTION = struct.Struct('<II')  # count, payload length
+_TX = struct.Struct('<II')  # txid, raw length
+_TXI = struct.Struct('<IIIIq')  # txid, address, prevout txid, prevout n, value
+_TXO = struct.Struct('<IIIqB')  # txid, address, n, value, is_coinbase
+_VERIFIED = struct.Struct('<Iiqi')  # txid, height, timestamp, position
+_HIST_ADDR = struct.Struct('<II')  # address, number of entries
+_HIST = struct.Struct('<Ii')  # txid, height
+
+
+class _Pool:
+    ''' Interns values, giving each distinct one an index. `check` is called
+    on each new value, and should raise ValueError if it can't be stored. '''
+    def __init__(self, check, index=()):
+        self.check = check
+        self.index = dict(index)
+
+    def __call__(self, value):
+        i = self.index.get(value)
+        if i is None:
+            self.check(value)
+            i = self.index[value] = len(self.index)
+        return i
+
+
+def _is_int(v):
+    return type(v) is int  # not bool
+
+
+def _txid_bytes(txid):
+    b = bytes.fromhex(txid)
+    if len(b) != 32 or b.hex() != txid:
+        raise ValueError('not a txid')
+    return b
+
+
+def _check_address(address):
+    if len(address.encode('utf8')) > 255:
+        raise ValueError('address too long')
+
+
+def _encode_transactions(table, txid):
+    recs, raws = [], []
+    for tx_hash, raw in table.items():
+        b = bytes.fromhex(raw)
+        if b.hex() != raw:
+            raise ValueError('not lowercase hex')
+        recs.append(_TX.pack(txid(tx_hash), len(b)))
+        raws.append(b)
+    return len(recs), b''.join(recs) + b''.join(raws)
+
+
+def _encode_txi(table, txid, addr):
+    recs = []
+    for tx_hash, d in table.items():
+        t = txid(tx_hash)
+        if not d:
+            raise ValueError('empty entry')
+        for a, items in d.items():
+            ai = addr(a)
+            if not items:
+                raise ValueError('empty entry')
+            for ser, v in items:
+                prev_hash, n = ser.split(':')
+                if str(int(n)) != n or not _is_int(v):
+                    raise ValueError('bad txi entry')
+                recs.append(_TXI.pack(t, ai, txid(prev_hash), int(n), v))
+    return len(recs), b''.join(recs)
+
+
+def _encode_txo(table, txid, addr):
+    recs = []
+    for tx_hash, d in table.items():
+        t = txid(tx_hash)
+        if not d:
+            raise ValueError('empty entry')
+        for a, items in d.items():
+            ai = addr(a)
+            if not items:
+                raise ValueError('empty entry')
+            for n, v, is_cb in items:
+                if not _is_int(n) or not _is_int(v) or type(is_cb) is not bool:
+                    raise ValueError('bad txo entry')
+                recs.append(_TXO.pack(t, ai, n, v, is_cb))
+    return len(recs), b''.join(recs)
+
+
+def _encode_verified(table, txid):
+    recs = []
+    for tx_hash, (height, timestamp, pos) in table.items():
+        if not (_is_int(height) and _is_int(timestamp) and _is_int(pos)):
+            raise ValueError('bad verified_tx3 entry')
+        recs.append(_VERIFIED.pack(txid(tx_hash), height, timestamp, pos))
+    return len(recs), b''.join(recs)
+
+
+def _encode_history(table, txid, addr):
+    heads, recs = [], []
+    for a, items in table.items():
+        heads.append(_HIST_ADDR.pack(addr(a), len(items)))
+        for tx_hash, height in items:
+            if not _is_int(height):
+                raise ValueError('bad history entry')
+            recs.append(_HIST.pack(txid(tx_hash), height))
+    return len(heads), b''.join(heads) + b''.join(recs)
+
+
+def _section(name, count, payload):
+    name = name.encode('ascii')
+    return bytes([len(name)]) + name + _SECTION.pack(count, len(payload)) + payload
+
+
+def encode(data):
+    ''' Encodes the tables of the wallet dict `data` that fit the format.
+    Returns (blob, names of the tables in it), or (None, ()) if none do. '''
+    txids, addrs = _Pool(_txid_bytes), _Pool(_check_address)
+    sections, names = [], []
+    for name in TABLES:
+        table = data.get(name)
+        if type(table) is not dict or not table:
+            continue
+        # Encode into copies of the pools, kept only if the whole table made it
+        t_pool, a_pool = _Pool(_txid_bytes, txids.index), _Pool(_check_address, addrs.index)
+        try:
+            if name == 'transactions':
+                count, payload = _encode_transactions(table, t_pool)
+            elif name == 'txi':
+                count, payload = _encode_txi(table, t_pool, a_pool)
+            elif name == 'txo':
+                count, payload = _encode_txo(table, t_pool, a_pool)
+            elif name == 'verified_tx3':
+                count, payload = _encode_verified(table, t_pool)
+            else:
+                count, payload = _encode_history(table, t_pool, a_pool)
+        except (ValueError, TypeError, AttributeError, struct.error):
+            continue
+        txids, addrs = t_pool, a_pool
+        sections.append(_section(name, count, payload))
+        names.append(name)
+    if not names:
+        return None, ()
+    addr_payload = b''.join(bytes([len(b)]) + b for b in (a.encode('utf8') for a in addrs.index))
+    txid_payload = b''.join(_txid_bytes(t) for t in txids.index)
+    head = [MAGIC + bytes([VERSION]),
+            _section('addresses', len(addrs.index), addr_payload),
+            _section('txids', len(txids.index), txid_payload)]
+    return b''.join(head + sections), tuple(names)
+
+
+def _sections(blob):
+    mv = memoryview(blob)
+    if bytes(mv[:4]) != MAGIC or mv[4] != VERSION:
+        raise ValueError('not a binary tables blob')
+    pos = 5
+    while pos < len(mv):
+        n = mv[pos]
+        name = bytes(mv[pos + 1:pos + 1 + n]).decode('ascii')
+        pos += 1 + n
+        count, length = _SECTION.unpack_from(mv, pos)
+        pos += _SECTION.size
+        if pos + length > len(mv):
+            raise ValueError('truncated section ' + name)
+        yield name, count, mv[pos:pos + length]
+        pos += length
+
+
+def decode(blob):
+    ''' Returns {table name: table} for the tables in blob. '''
+    # Building a few million small lists would otherwise set off the cyclic
+    # garbage collector over and over, for nothing since none of them can be
+    # garbage yet; this alone takes decoding from slower than json to faster
+    enabled = gc.isenabled()
+    gc.disable()
+    try:
+        return _decode(blob)
+    finally:
+        if enabled:
+            gc.enable()
+
+
+def _decode(blob):
+    addrs, txids, tables = [], [], {}
+    for name, count, mv in _sections(blob):
+        if name == 'addresses':
+            pos = 0
+            for _ in range(count):
+                n = mv[pos]
+                addrs.append(bytes(mv[pos + 1:pos + 1 + n]).decode('utf8'))
+                pos += 1 + n
+        elif name == 'txids':
+            raw = mv.hex()
+            txids = [raw[i:i + 64] for i in range(0, 64 * count, 64)]
+        elif name == 'transactions':
+            end = count * _TX.size
+            pos = end
+            table = {}
+            for t, n in _TX.iter_unpack(mv[:end]):
+                table[txids[t]] = mv[pos:pos + n].hex()
+                pos += n
+            tables[name] = table
+        elif name in ('txi', 'txo'):
+            # Records were written grouped by txid and then address, so only
+            # look the dicts up when those change
+            table, last, items = {}, None, None
+            txi = name == 'txi'
+            for rec in (_TXI if txi else _TXO).iter_unpack(mv):
+                if rec[:2] != last:
+                    last = rec[:2]
+                    d = table.get(txids[rec[0]])
+                    if d is None:
+                        d = table[txids[rec[0]]] = {}
+                    items = d.setdefault(addrs[rec[1]], [])
+                if txi:
+                    items.append([txids[rec[2]] + ':' + str(rec[3]), rec[4]])
+                else:
+                    items.append([rec[2], rec[3], rec[4] == 1])
+            tables[name] = table
+        elif name == 'verified_tx3':
+            tables[name] = {txids[t]: [h, ts, p] for t, h, ts, p in _VERIFIED.iter_unpack(mv)}
+        elif name == 'addr_history':
+            end = count * _HIST_ADDR.size
+            entries = _HIST.iter_unpack(mv[end:])
+            table = {}
+            for a, n in _HIST_ADDR.iter_unpack(mv[:end]):
+                table[addrs[a]] = [[txids[t], h] for t, h in (next(entries) for _ in range(n))]
+            tables[name] = table
+    return tables
@@ -36,7 +36,7 @@ import warnings
 
 from .address import Address
 from .transaction import Transaction
-from .util import ThreadJob, bh2u, Monotonic
+from .util import ThreadJob, bfh, bh2u, Monotonic, batch_responses
 from . import networks
 from .bitcoin import InvalidXKeyFormat
 
@@ -49,12 +49,21 @@ class Synchronizer(ThreadJob):
     we don't have the full history of, and requests binary transaction
     data of any transactions the wallet doesn't have.
 
-    External interface: __init__() and add() member functions."""
+    External interface: __init__() and add() member functions.
 
-    def __init__(self, wallet, network):
+    If a util.JobWorker is given, the synchronizer runs as one of its jobs,
+    and the network responses are handled from its thread too, rather than
+    from the Network thread."""
+
+    def __init__(self, wallet, network, worker=None):
         self.wallet = wallet
         self.network = network
+        self.worker = worker
         assert self.wallet and self.wallet.storage and self.network
+        # Our requests take turns with those of other wallets, see Network.send
+        self.owner = wallet.diagnostic_name()
+        self._on_address_status_cb = self._callback(self._on_address_status)
+        self._on_address_history_cb = self._callback(self._on_address_history)
         self.cleaned_up = False
         self._need_release = False
         self.new_addresses: Set[Address] = set()
@@ -71,6 +80,9 @@ class Synchronizer(ThreadJob):
         # Mapping of scripthash -> set of requested tx_hashes
         self.requested_tx_by_sh: DefaultDict[str, Set[str]] = defaultdict(set)
         self.requested_histories = {}
+        # (tx_hash, scripthash, raw bytes) found in the network's tx store, to
+        # be processed from run() in the network thread
+        self.stored_txs = []
         self.requested_hashes = set()
         self.change_sh_ctr = Monotonic(locking=True)
         # all known change address scripthashes -> their order seen
@@ -102,6 +114,9 @@ class Synchronizer(ThreadJob):
     def diagnostic_name(self):
         return f"{__class__.__name__}/{self.wallet.diagnostic_name()}"
 
+    def _callback(self, func):
+        return self.worker.callback(func) if self.worker else func
+
     def _parse_response(self, response):
         error = True
         try:
@@ -116,20 +131,22 @@ class Synchronizer(ThreadJob):
         return not self.requested_tx and not self.requested_histories and not self.requested_hashes
 
     def _release(self):
-        """ Called from the Network (DaemonThread) -- to prevent race conditions
-        with network, we remove data structures related to the network and
-        unregister ourselves as a job from within the Network thread itself. """
+        """ Called from the Network (DaemonThread) or our worker -- to prevent
+        race conditions, we remove data structures related to the network and
+        unregister ourselves as a job from within the thread we run in. The
+        network's own structures are left to the network thread (see
+        Network.post). """
         self._need_release = False
         self.cleaned_up = True
-        self.network.unsubscribe_from_scripthashes(self.h2addr.keys(), self._on_address_status)
-        self.network.cancel_requests(self._on_address_status)
-        self.network.cancel_requests(self._on_address_history)
-        self.network.cancel_requests(self._tx_response)
-        self.network.remove_jobs([self])
+        self.network.post(self.network.unsubscribe_from_scripthashes, list(self.h2addr.keys()), self._on_address_status_cb)
+        self.network.post(self.network.cancel_requests, self._on_address_status_cb)
+        self.network.post(self.network.cancel_requests, self._on_address_history_cb)
+        self.network.post(self.network.cancel_requests, self._tx_response)
+        (self.worker or self.network).remove_jobs([self])
 
     def release(self):
         """ Called from main thread, enqueues a 'release' to happen in the
-        Network thread. """
+        thread we run in. """
         self._need_release = True
 
     def add(self, address, *, for_change=False):
@@ -165,7 +182,7 @@ class Synchronizer(ThreadJob):
             self.print_error(f"change_subs limit reached ({self.limit_change_subs}), unsubscribing from"
                              f" {len(unsubs)} old change scripthashes,"
                              f" change scripthash subs ct now: {len(self.change_subs)}")
-            self.network.unsubscribe_from_scripthashes(unsubs, self._on_address_status)
+            self.network.post(self.network.unsubscribe_from_scripthashes, unsubs, self._on_address_status_cb)
 
     def _subscribe_to_addresses(self, addresses: Iterable[Address], *, for_change=False):
         hashes2addr = {addr.to_scripthash_hex(): addr for addr in addresses}
@@ -187,7 +204,7 @@ class Synchronizer(ThreadJob):
             self.change_subs |= hashes_set
         self.requested_hashes |= hashes_set
         # Nit: we use hashes2addr.keys() here to preserve order
-        self.network.subscribe_to_scripthashes(hashes2addr.keys(), self._on_address_status)
+        self.network.subscribe_to_scripthashes(hashes2addr.keys(), self._on_address_status_cb, owner=self.owner)
         if for_change:
             self._check_change_subs_limits()
             if skipped_ct:
@@ -231,33 +248,52 @@ class Synchronizer(ThreadJob):
             # Not a candidate for expiry
             self.change_subs_expiry_candidates.discard(sh)
 
-    def _on_address_status(self, response):
+    @batch_responses
+    def _on_address_status(self, responses):
         if self.cleaned_up:
-            self.print_error("Already cleaned-up, ignoring stale reponse:", response)
+            self.print_error("Already cleaned-up, ignoring stale reponses:", responses)
             # defensive programming: make doubly sure we aren't registered to receive any callbacks from network class
             # and cancel subscriptions again.
             self._release()
             return
+        # Histories for all changed scripthashes go out in a single send
+        history_requests = []
+        for response in responses:
+            scripthash = self._process_address_status(response)
+            if scripthash is not None:
+                history_requests.append(('blockchain.scripthash.get_history', [scripthash]))
+        if history_requests:
+            self.network.send(history_requests, self._on_address_history_cb, owner=self.owner)
+
+    def _process_address_status(self, response) -> Optional[str]:
+        """ Returns the scripthash if its history needs to be requested. """
         params, result, error = self._parse_response(response)
         if error:
-            return
+            return None
         scripthash = params[0]
         addr = self.h2addr.get(scripthash, None)
         if not addr:
-            return  # Bad server response?
+            return None  # Bad server response?
+        need_history = False
         history = self.wallet.get_address_history(addr)
         if self.get_status(history) != result:
             if self.requested_histories.get(scripthash) is None:
                 self.requested_histories[scripthash] = result
-                self.network.request_scripthash_history(scripthash, self._on_address_history)
+                need_history = True
         # remove addr from list only after it is added to requested_histories
         self.requested_hashes.discard(scripthash)  # Notifications won't be in
         # See if now the change address needs to be recategorized
         self._check_change_scripthash(scripthash)
+        return scripthash if need_history else None
 
-    def _on_address_history(self, response):
+    @batch_responses
+    def _on_address_history(self, responses):
         if self.cleaned_up:
             return
+        for response in responses:
+            self._process_address_history(response)
+
+    def _process_address_history(self, response):
         params, result, error = self._parse_response(response)
         if error:
             return
@@ -327,6 +363,8 @@ class Synchronizer(ThreadJob):
             del chk_txid
             # /Paranoia
             self.wallet.receive_tx_callback(tx_hash, tx, tx_height)
+            if self.network.tx_store and self.wallet.may_store_txs():
+                self.network.tx_store.put(bfh(tx.raw))
             self.print_error("received tx %s height: %d bytes: %d" %
                              (tx_hash, tx_height, len(tx.raw)))
             # callbacks
@@ -342,19 +380,33 @@ class Synchronizer(ThreadJob):
     def _request_missing_txs(self, hist: Iterable[Tuple[str, int]], scripthash: Optional[str]) -> bool:
         # "hist" is a list of [tx_hash, tx_height] lists
         requests = []
+        found = False
+        tx_store = self.network.tx_store
         for tx_hash, tx_height in hist:
             if tx_hash in self.requested_tx:
                 continue
             if tx_hash in self.wallet.transactions:
                 continue
-            requests.append(('blockchain.transaction.get', [tx_hash]))
+            raw = tx_store and tx_store.get(tx_hash)
+            if raw:
+                # Another wallet (or an earlier session) already downloaded it
+                self.stored_txs.append((tx_hash, scripthash, raw))
+                found = True
+            else:
+                requests.append(('blockchain.transaction.get', [tx_hash]))
             self.requested_tx[tx_hash] = tx_height
             if self.limit_change_subs and scripthash is not None:
                 self.requested_tx_by_sh[scripthash].add(tx_hash)
         if requests:
-            self.network.send(requests, lambda response: self._tx_response(response, scripthash))
-            return True
-        return False
+            self.network.send(requests, self._callback(lambda response: self._tx_response(response, scripthash)),
+                              owner=self.owner)
+        return bool(requests) or found
+
+    def _process_stored_txs(self):
+        stored, self.stored_txs = self.stored_txs, []
+        for tx_hash, scripthash, raw in stored:
+            # Same checks as for a server response, the txid check included
+            self._tx_response({'params': [tx_hash], 'result': raw.hex()}, scripthash)
 
     def _initialize(self):
         """ Check the initial state of the wallet.  Subscribe to all its
@@ -404,7 +456,7 @@ class Synchronizer(ThreadJob):
         return addresses, addresses_for_change
 
     def run(self):
-        """ Called from the network proxy thread main loop. """
+        """ Called from the network proxy thread main loop, or our worker's. """
         if self._need_release:
             self._release()
         if self.cleaned_up:
@@ -418,6 +470,10 @@ class Synchronizer(ThreadJob):
             # 1. Create new addresses
             self.wallet.synchronize()
 
+            # 1b. Take in the tx's found in the tx store
+            if self.stored_txs:
+                self._process_stored_txs()
+
             # 2. Subscribe to new addresses
             addresses, addresses_for_change = self._pop_new_addresses()
             if addresses:
@@ -6,13 +6,17 @@ from ecdsa.util import number_to_string
 from ..address import Address
 from ..bitcoin import (
     generator_secp256k1, point_to_ser, public_key_to_p2pkh, EC_KEY, bip32_root,
-    bip32_public_derivation, bip32_private_derivation, pw_encode, pw_decode,
-    Hash, public_key_from_private_key, address_from_private_key, is_private_key,
-    xpub_from_xprv, var_int, op_push, push_script, regenerate_key, verify_message,
+    bip32_public_derivation, bip32_private_derivation, pw_encode, pw_decode, PwDecoder,
+    Hash, Hash_64_multi, public_key_from_private_key, public_keys_from_private_keys,
+    CKD_pub, CKD_pub_range, deserialize_xpub,
+    address_from_private_key, is_private_key,
+    xpub_from_xprv, var_int, op_push, push_script, regenerate_key, verify_message, verify_messages,
     deserialize_privkey, serialize_privkey, is_minikey, is_compressed, is_xpub,
     xpub_type, is_xprv, is_bip32_derivation, Bip38Key, OpCodes)
+from .. import ecc_fast
+from .. import secp256k1
 from ..networks import set_mainnet, set_testnet
-from ..util import bfh, bh2u
+from ..util import bfh, bh2u, InvalidPassword
 
 try:
     import ecdsa
@@ -53,6 +57,31 @@ class Test_bitcoin(unittest.TestCase):
         #print signature
         EC_KEY.verify_message(eck, signature, message)
 
+    def test_crypto_native(self):
+        if not secp256k1.has_ecies():
+            self.skipTest("secp256k1 lib lacks secp256k1_ecies_derive_keys")
+        from .. import bitcoin
+        G = generator_secp256k1
+        eck = EC_KEY(number_to_string(ecdsa.util.randrange(G.order()), G.order()))
+        pubkey = bfh(eck.get_public_key(True))
+        saved = bitcoin.ECIES_CHUNK, secp256k1._secp256k1_ecies_derive_keys
+        bitcoin.ECIES_CHUNK = 64  # so the messages below span several pieces
+        try:
+            for message in [b'', b'x' * 15, b'y' * 16, b'z' * 64, bytes(range(256)) * 3]:
+                native = EC_KEY.encrypt_message(message, pubkey)
+                secp256k1._secp256k1_ecies_derive_keys = None
+                python = EC_KEY.encrypt_message(message, pubkey)
+                # each side decrypts what the other encrypted
+                self.assertEqual(message, eck.decrypt_message(native))
+                secp256k1._secp256k1_ecies_derive_keys = saved[1]
+                self.assertEqual(message, eck.decrypt_message(python))
+                tampered = bytearray(base64.b64decode(native))
+                tampered[40] ^= 1
+                with self.assertRaises(InvalidPassword):
+                    eck.decrypt_message(base64.b64encode(tampered))
+        finally:
+            bitcoin.ECIES_CHUNK, secp256k1._secp256k1_ecies_derive_keys = saved
+
     def test_msg_signing(self):
         msg1 = b'Chancellor on brink of second bailout for banks'
         msg2 = b'Electrum'
@@ -116,6 +145,32 @@ class Test_bitcoin(unittest.TestCase):
         self.assertFalse(verify_message(addr1, sig2, msg1))
         self.assertFalse(verify_message(addr2, sig1, msg2))
 
+    def _do_test_verify_messages(self):
+        addr1, msg1 = '15hETetDmcXm1mM4sEf7U2KXC9hDHFMSzz', b'Chancellor on brink of second bailout for banks'
+        addr2, msg2 = '1GPHVTY8UD9my6jyP4tb2TYJwUbDetyNC6', b'Electrum'
+        # one signature by each key and nonce, compressed for addr1 and uncompressed for addr2
+        sig1a, sig1b, sig2a, sig2b = map(base64.b64decode, (
+            'H/9jMOnj4MFbH3d7t4yCQ9i7DgZU/VZ278w3+ySv2F4yIsdqjsc5ng3kmN8OZAThgyfCZOQxZCWza9V5XzlVY0Y=',
+            'IA+oq/uGz4kKA2bNgxPcM+T216abyUiBhofMg1J8fC5BLAbbIpF2toCHaO7/LQAxhQBtu5D6ROq1JjXiRwPAASg=',
+            'G84dmJ8TKIDKMT9qBRhpX2sNmR0y5t+POcYnFFJCs66lJmAs3T8A6Sbpx7KA6yTQ9djQMabwQXRrDomOkIKGn18=',
+            'HP+MT0B/Ga++0DEXDJE0oBb1DEsBMX0j+i2mbyEI4nwVMZkwc/pHgL2KlntotC+k8uU8y/M4YAdO4n7vfuUVL8A='))
+        items = [(addr1, sig1a, msg1), (addr2, sig2a, msg2), (addr1, sig1b, msg1), (addr2, sig2b, msg2),
+                 (addr1, sig2a, msg2), (addr2, sig1a, msg1), (addr1, sig1a, msg2)]
+        self.assertEqual(verify_messages(items), [True] * 4 + [False] * 3)
+        self.assertEqual(verify_messages([]), [])
+        self.assertEqual([verify_message(*item) for item in items], [True] * 4 + [False] * 3)
+        self.assertRaises(Exception, verify_messages, items[:1] + [(addr1, b'wrong', msg1)])
+
+    def test_verify_messages(self):
+        self._do_test_verify_messages()
+        if secp256k1.has_fast_recover_batch():
+            saved = secp256k1._secp256k1_ecdsa_recover_batch
+            secp256k1._secp256k1_ecdsa_recover_batch = None
+            try:
+                self._do_test_verify_messages()
+            finally:
+                secp256k1._secp256k1_ecdsa_recover_batch = saved
+
     def test_aes_homomorphic(self):
         """Make sure AES is homomorphic."""
         payload = u'\u66f4\u7a33\u5b9a\u7684\u4ea4\u6613\u5e73\u53f0'
@@ -144,6 +199,23 @@ class Test_bitcoin(unittest.TestCase):
         enc = pw_encode(payload, password)
         self.assertRaises(Exception, pw_decode, enc, wrong_password)
 
+    def test_pw_decoder(self):
+        """A PwDecoder session decodes like pw_decode until it is closed."""
+        password = u'secret'
+        payloads = [u'one', u'two', u'\u66f4\u7a33\u5b9a']
+        encs = [pw_encode(p, password) for p in payloads]
+        with PwDecoder(password) as pw:
+            self.assertEqual(payloads, pw.decode_many(encs))
+            self.assertEqual(payloads[0], pw_decode(encs[0], pw))
+        self.assertRaises(PwDecoder.Expired, pw_decode, encs[0], pw)
+        self.assertIsNone(pw.key)
+        with PwDecoder(u'wrong') as pw:
+            self.assertRaises(InvalidPassword, pw.decode, encs[0])
+        with PwDecoder(None) as pw:
+            self.assertEqual(u'plain', pw.decode(u'plain'))
+        pw = PwDecoder(password, lifetime=-1)
+        self.assertRaises(PwDecoder.Expired, pw.decode, encs[0])
+
     def test_hash(self):
         """Make sure the Hash function does sha256 twice"""
         payload = u"test"
@@ -152,6 +224,76 @@ class Test_bitcoin(unittest.TestCase):
         result = Hash(payload)
         self.assertEqual(expected, result)
 
+    def test_Hash_64_multi(self):
+        data = bytes(range(256)) * 5
+        expected = [Hash(data[i:i+64]) for i in range(0, len(data), 64)]
+        self.assertEqual(expected, Hash_64_multi(data))
+        self.assertEqual([], Hash_64_multi(b''))
+        self.assertRaises(ValueError, Hash_64_multi, data[:-1])
+
+    def test_Hash_64_multi_fallback(self):
+        saved = ecc_fast._secp256k1_sha256d64_multi
+        ecc_fast._secp256k1_sha256d64_multi = None
+        try:
+            self.test_Hash_64_multi()
+        finally:
+            ecc_fast._secp256k1_sha256d64_multi = saved
+
+    def test_ecpoint(self):
+        if not secp256k1.secp256k1:
+            self.skipTest("secp256k1 lib not available")
+        ECPoint = secp256k1.ECPoint
+        G = ECPoint.generator_mul(1)
+        self.assertEqual(G, ECPoint(bfh('0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798')))
+        G2 = ECPoint(bfh('02c6047f9441ed7d6d3045406e95c07cd85c778e4b8cef3ca7abac09b95c709ee5'))
+        self.assertEqual(G + G, G2)
+        self.assertEqual(2 * G, G2)
+        self.assertEqual(G * 3 - G, G2)
+        self.assertEqual(ECPoint.sum([G, G, G2]), ECPoint.generator_mul(4))
+        self.assertEqual(G2.to_bytes(False)[1:33], G2.to_bytes()[1:])
+        self.assertEqual(G2.x(), int.from_bytes(G2.to_bytes()[1:], 'big'))
+        self.assertTrue((G + -G).is_infinity())
+        self.assertTrue((G * ECPoint.ORDER).is_infinity())
+        self.assertEqual(ECPoint.INFINITY + G2, G2)
+        self.assertEqual(hash(ECPoint(G2.to_bytes(False))), hash(G2))
+        with self.assertRaises(ValueError):
+            ECPoint.INFINITY.to_bytes()
+        with self.assertRaises(ValueError):
+            ECPoint(b'\x02' + b'\x00' * 32)
+
+    def test_pubkey_tweak_mul_batch(self):
+        if not ecc_fast.has_fast_pubkey_tweak_mul_batch():
+            self.skipTest("secp256k1 lib lacks secp256k1_ec_pubkey_tweak_mul_batch")
+        from ctypes import create_string_buffer
+        import random
+        ECPoint = secp256k1.ECPoint
+        n = ECPoint.ORDER
+        P = ECPoint.generator_mul(0x1234567890abcdef)
+        pubkey = P.to_bytes(False)
+        def tweak_mul(tweak):
+            ''' One secp256k1_ec_pubkey_tweak_mul call, as ECPoint does; None
+            where it fails. '''
+            buf = create_string_buffer(P._buf.raw, 64)
+            if not secp256k1.secp256k1.secp256k1_ec_pubkey_tweak_mul(secp256k1.thread_context(), buf, tweak):
+                return None
+            return ECPoint._wrap(buf)
+        rng = random.Random(67)
+        scalars = [1, 2, 3, n - 1, n - 2, n // 2, 1 << 255] + [rng.randrange(1, n) for _ in range(60)]
+        tweaks = [k.to_bytes(32, 'big') for k in scalars]
+        expected = [tweak_mul(t) for t in tweaks]
+        self.assertEqual(expected[3], -P)
+        for compressed in (True, False):
+            self.assertEqual(ecc_fast.pubkey_tweak_mul_batch(pubkey, tweaks, compressed),
+                             [Q.to_bytes(compressed) for Q in expected])
+        # Zero and tweaks of n and above fail both ways; one of them fails the batch
+        for bad in (0, n, n + 1, (1 << 256) - 1):
+            bad = bad.to_bytes(32, 'big')
+            self.assertIsNone(tweak_mul(bad))
+            self.assertIsNone(ecc_fast.pubkey_tweak_mul_batch(pubkey, [bad], True))
+            self.assertIsNone(ecc_fast.pubkey_tweak_mul_batch(pubkey, tweaks[:5] + [bad] + tweaks[5:], True))
+        self.assertIsNone(ecc_fast.pubkey_tweak_mul_batch(pubkey, [bytes(31)], True))
+        self.assertIsNone(ecc_fast.pubkey_tweak_mul_batch(b'\x02' + bytes(32), tweaks, True))
+
     def test_var_int(self):
         for i in range(0xfd):
             self.assertEqual(var_int(i), "{:02x}".format(i))
@@ -261,6 +403,23 @@ class Test_xprv_xpub(unittest.TestCase):
         self.assertEqual("xpub6FnCn6nSzZAw5Tw7cgR9bi15UV96gLZhjDstkXXxvCLsUXBGXPdSnLFbdpq8p9HmGsApME5hQTZ3emM2rnY5agb9rXpVGyy3bdW6EEgAtqt", xpub)
         self.assertEqual("xprvA2nrNbFZABcdryreWet9Ea4LvTJcGsqrMzxHx98MMrotbir7yrKCEXw7nadnHM8Dq38EGfSh6dqA9QWTyefMLEcBYJUuekgW4BYPJcr9E7j", xprv)
 
+    def test_CKD_pub_range(self):
+        for xprv_details in self.xprv_xpub:
+            _, _, _, _, c, cK = deserialize_xpub(xprv_details['xpub'])
+            expected = [CKD_pub(cK, c, n) for n in range(5, 25)]
+            self.assertEqual(expected, CKD_pub_range(cK, c, 5, 20))
+            self.assertEqual([], CKD_pub_range(cK, c, 0, 0))
+            with self.assertRaises(ValueError):
+                CKD_pub_range(cK, c, 0x7fffffff, 2)
+
+    def test_CKD_pub_range_fallback(self):
+        saved = ecc_fast._secp256k1_ec_pubkey_tweak_add_batch
+        ecc_fast._secp256k1_ec_pubkey_tweak_add_batch = None
+        try:
+            self.test_CKD_pub_range()
+        finally:
+            ecc_fast._secp256k1_ec_pubkey_tweak_add_batch = saved
+
     def test_xpub_from_xprv(self):
         """We can derive the xpub key from a xprv."""
         for xprv_details in self.xprv_xpub:
@@ -335,6 +494,28 @@ class Test_keyImport(unittest.TestCase):
             self.assertEqual(priv_details['txin_type'], txin_type)
             self.assertEqual(priv_details['compressed'], compressed)
 
+    def test_public_keys_from_private_keys(self):
+        for compressed in (True, False):
+            privkeys, expected = [], []
+            for priv_details in self.priv_pub_addr:
+                privkey = deserialize_privkey(priv_details['priv'])[1]
+                privkeys.append(privkey)
+                expected.append(public_key_from_private_key(privkey, compressed))
+            self.assertEqual(expected, public_keys_from_private_keys(privkeys, compressed))
+            self.assertEqual([], public_keys_from_private_keys([], compressed))
+            # an invalid key in the batch makes the native call fail; we must
+            # fall back to the per-key path, which raises for the bad key
+            with self.assertRaises(Exception):
+                public_keys_from_private_keys(privkeys + [bytes(32)], compressed)
+
+    def test_public_keys_from_private_keys_fallback(self):
+        saved = ecc_fast._secp256k1_ec_pubkey_create_batch
+        ecc_fast._secp256k1_ec_pubkey_create_batch = None
+        try:
+            self.test_public_keys_from_private_keys()
+        finally:
+            ecc_fast._secp256k1_ec_pubkey_create_batch = saved
+
     def test_address_from_private_key(self):
         for priv_details in self.priv_pub_addr:
             addr2 = address_from_private_key(priv_details['priv'])
@@ -1,5 +1,9 @@
+import os
+import shutil
+import tempfile
 import unittest
 from .. import blockchain as bc
+from .. import networks
 
 
 class MyBlockchain(bc.Blockchain):
@@ -15,6 +19,19 @@ class MyBlockchain(bc.Blockchain):
         self.local_height = 0
 
 
+class ChunkBlockchain(MyBlockchain):
+    """Serves the headers preceding a chunk from memory."""
+
+    def __init__(self, headers):
+        super().__init__()
+        self.stored = {h['block_height']: h for h in headers}
+
+    def read_header(self, height, chunk=None):
+        if chunk is not None and chunk.contains_height(height):
+            return chunk.get_header_at_height(height)
+        return self.stored.get(height)
+
+
 def get_block(prior, time_interval, bits):
     return {
         'version': prior['version'],
@@ -115,3 +132,128 @@ class TestBlockchain(unittest.TestCase):
             bc.bits_to_target(0x04923456)
         with self.assertRaises(Exception):  # overflow
             bc.bits_to_target(0xff123456)
+
+    def _asert_chunk(self):
+        anchor = networks.net.asert_daa.anchor
+        z = '00' * 32
+        prior = {
+            'version': 4,
+            'prev_block_hash': z,
+            'merkle_root': z,
+            'timestamp': anchor.prev_time + 100 * 300,
+            'bits': anchor.bits,
+            'nonce': 0,
+            'block_height': anchor.height + 100
+        }
+        stored = [prior]
+        for n in range(10):
+            stored.append(get_block(stored[-1], 300, anchor.bits))
+        chain = ChunkBlockchain(stored)
+        chunk_base_height = stored[-1]['block_height'] + 1
+        blocks = [stored[-1]]
+        chunk_bytes = b''
+        for n in range(20):
+            block = get_block(blocks[-1], 250, 0)
+            block['bits'] = chain.get_bits(block, bc.HeaderChunk(chunk_base_height, chunk_bytes))
+            blocks.append(block)
+            chunk_bytes += bytes.fromhex(bc.serialize_header(block))
+        return chain, chunk_base_height, chunk_bytes
+
+    def test_verify_chunk(self):
+        chain, chunk_base_height, chunk_bytes = self._asert_chunk()
+        # The made up headers have no proof of work, so even the first one fails.
+        self.assertEqual(0, chain.verify_chunk_fast(chunk_base_height, chunk_bytes,
+                                                    bc.HeaderChunk(chunk_base_height, chunk_bytes)))
+        with self.assertRaisesRegex(bc.VerifyError, 'insufficient proof of work'):
+            chain.verify_chunk(chunk_base_height, chunk_bytes)
+        broken = bytearray(chunk_bytes)
+        broken[4] ^= 1
+        with self.assertRaisesRegex(bc.VerifyError, 'prev hash mismatch'):
+            chain.verify_chunk(chunk_base_height, bytes(broken))
+
+    def test_verify_proven_chunk_difficulty(self):
+        chain, chunk_base_height, chunk_bytes = self._asert_chunk()
+        # As if proven without any of the headers preceding it.
+        proven_base_height = chunk_base_height - 11
+        proven_bytes = b''.join(bytes.fromhex(bc.serialize_header(chain.stored[h]))
+                                for h in range(proven_base_height, chunk_base_height)) + chunk_bytes
+        prover = ChunkBlockchain([])
+        # The bits are all right, but the made up headers have no proof of work.
+        with self.assertRaisesRegex(bc.VerifyError, 'insufficient proof of work'):
+            prover.verify_proven_chunk_difficulty(proven_base_height, proven_bytes)
+        broken = bytearray(proven_bytes)
+        broken[11 * bc.HEADER_SIZE + 72] ^= 1  # the bits of the first header checked
+        with self.assertRaisesRegex(bc.VerifyError, 'bits mismatch'):
+            prover.verify_proven_chunk_difficulty(proven_base_height, bytes(broken))
+        with self.assertRaisesRegex(bc.VerifyError, 'no known ASERT anchor'):
+            prover.verify_proven_chunk_difficulty(networks.net.asert_daa.anchor.height, proven_bytes)
+
+    def test_verify_chunk_fallback(self):
+        saved = bc._secp256k1_headers_verify_chunk
+        bc._secp256k1_headers_verify_chunk = None
+        try:
+            self.test_verify_chunk()
+        finally:
+            bc._secp256k1_headers_verify_chunk = saved
+
+
+class TestHeadersFile(unittest.TestCase):
+
+    class Config:
+        path = None
+
+    def setUp(self):
+        self.config = self.Config()
+        self.config.path = tempfile.mkdtemp()
+        os.mkdir(os.path.join(self.config.path, 'forks'))
+        open(os.path.join(self.config.path, 'blockchain_headers'), 'wb').close()
+        self.saved_blockchains = dict(bc.blockchains)
+        bc.blockchains.clear()
+
+    def tearDown(self):
+        for b in bc.blockchains.values():
+            with b.lock:
+                b.close_mmap()
+        bc.blockchains.clear()
+        bc.blockchains.update(self.saved_blockchains)
+        shutil.rmtree(self.config.path)
+
+    @staticmethod
+    def make_blocks(prior, count):
+        blocks = [prior]
+        for n in range(count):
+            blocks.append(get_block(blocks[-1], 300, prior['bits']))
+        return blocks[1:]
+
+    def test_hash_index_and_swap(self):
+        z = '00' * 32
+        genesis = {'version': 4, 'prev_block_hash': z, 'merkle_root': z, 'timestamp': 1269211443,
+                   'bits': 0x1d00ffff, 'nonce': 0, 'block_height': 0}
+        main_blocks = [genesis] + self.make_blocks(genesis, 99)
+        main = bc.blockchains[0] = bc.Blockchain(self.config, 0, None)
+        main.save_chunk(0, b''.join(bytes.fromhex(bc.serialize_header(b)) for b in main_blocks))
+        self.assertEqual(99, main.height())
+        for b in main_blocks[1:]:
+            self.assertEqual(b, main.read_header(b['block_height']))
+            self.assertEqual(bc.hash_header(b), main.get_hash(b['block_height']))
+        self.assertEqual(57, main.get_height_of_hash(bc.hash_header(main_blocks[57])))
+        self.assertIsNone(main.get_height_of_hash('11' * 32))
+
+        # A fork at height 90 that outgrows the main chain swaps with it.
+        prior = dict(main_blocks[89], merkle_root='22' * 32)
+        fork_blocks = self.make_blocks(prior, 15)
+        fork = bc.blockchains[90] = main.fork(fork_blocks[0])
+        for b in fork_blocks[1:]:
+            fork.save_header(b)
+        self.assertIs(fork, bc.blockchains[0])
+        self.assertIs(main, bc.blockchains[90])
+        self.assertEqual(104, fork.height())
+        for b in main_blocks[1:90] + fork_blocks:
+            self.assertEqual(b, fork.read_header(b['block_height']))
+            self.assertEqual(bc.hash_header(b), fork.get_hash(b['block_height']))
+        for b in main_blocks[90:]:
+            self.assertEqual(b, main.read_header(b['block_height']))
+            self.assertEqual(bc.hash_header(b), main.get_hash(b['block_height']))
+        self.assertEqual(100, fork.get_height_of_hash(bc.hash_header(fork_blocks[10])))
+        self.assertIsNone(fork.get_height_of_hash(bc.hash_header(main_blocks[95])))
+        self.assertEqual(95, main.get_height_of_hash(bc.hash_header(main_blocks[95])))
@@ -26,6 +26,9 @@ Cash Accounts tests.
 '''
 import unittest
 import random
+import threading
+import time
+from unittest import mock
 
 from .. import cashacct
 from ..address import Address
@@ -146,6 +149,19 @@ class TestCashAccounts(unittest.TestCase):
             self.assertRaises(cashacct.ArgumentError, cashacct.ScriptOutput.from_script, b)
             self.assertRaises(cashacct.ArgumentError, cashacct.ScriptOutput.parse_script, b)
 
+    def test_protocol_factory(self):
+        '''Scripts are only handed to cashacct.ScriptOutput if they are valid
+        registrations, whatever else is in ScriptOutput.protocol_classes'''
+        from ..address import ScriptOutput
+        self.assertIn(cashacct.ScriptOutput, ScriptOutput.protocol_classes)
+        so = ScriptOutput.protocol_factory(bytes.fromhex('6a040101010103627631150190c0cbaefcd5f3b93b8214074e645e39d7aae4ad'))
+        self.assertIs(type(so), cashacct.ScriptOutput)
+        self.assertEqual(so.name, 'bv1')
+        for h in ('6a040101010103627631',  # right prefix, bad registration
+                  '6a040102010103627631150190c0cbaefcd5f3b93b8214074e645e39d7aae4ad',  # other lokad id
+                  '6a', '', '76a914'):
+            self.assertIs(type(ScriptOutput.protocol_factory(bytes.fromhex(h))), ScriptOutput)
+
     def test_collision_hash_and_emoji_and_number(self):
         ''' Tests collision_hash code and other stuff. '''
         bh = '000000000000000002abbeff5f6fb22a0b3b5c2685c6ef4ed2d2257ed54e9dcb'
@@ -197,3 +213,114 @@ class TestCashAccounts(unittest.TestCase):
         d = cashacct.CashAcct._calc_minimal_chashes_for_sorted_lcased_tups(sorted(l))
         self.assertEqual(sum(len(v) for k,v in d.items()), len(set(l)))
         self.assertEqual(d[myname][my_collision_hash], '03')
+
+
+class FakeStorage(dict):
+    def put(self, key, value):
+        self[key] = value
+
+    def write(self):
+        pass
+
+
+class FakeWallet:
+    def __init__(self):
+        self.storage = FakeStorage()
+
+    def diagnostic_name(self):
+        return 'test_wallet'
+
+
+class TestLookupsAndProcessedBlocks(unittest.TestCase):
+
+    nilac = '6a04010101010c4e696c61635468654772696d15017ee7b62fa98a985c5553ff66120a91b8189f6581'
+    txid = '731cdf537f6f10c142d4fc3a3d787986a783123c34727f53deaa5aa67be61911'
+    bhash = '000000000000000002e5216ece231134437e29a837937a90f374807b76fdbb1b'
+    bheight = 565806
+
+    def setUp(self):
+        cashacct._lookup_cache.d = {}
+        self.calls = []  # (number, name, success_cb, error_cb) per lookup gone out to the servers
+        def fake_lookup_all(number, success_cb, error_cb=None, name=None, **kwargs):
+            self.calls.append((number, name, success_cb, error_cb))
+        patcher = mock.patch.object(cashacct, '_lookup_asynch_all', fake_lookup_all)
+        patcher.start()
+        self.addCleanup(patcher.stop)
+        self.addCleanup(setattr, cashacct._lookup_cache, 'd', {})
+
+    def test_lookups_coalesce(self):
+        results = []
+        for name in ('Calin', 'calin', ' CALIN '):
+            cashacct.lookup_asynch_all(100, lambda res, server: results.append((res, server)), name=name)
+        self.assertEqual(len(self.calls), 1)
+        self.calls[0][2]('res', 'server')
+        self.assertEqual(results, [('res', 'server')] * 3)
+        # Asked again: from the cache, on another thread
+        done = threading.Event()
+        cashacct.lookup_asynch_all(100, lambda res, server: (results.append((res, server)), done.set()), name='calin')
+        self.assertTrue(done.wait(5.0))
+        self.assertEqual(len(self.calls), 1)
+        self.assertEqual(len(results), 4)
+        # A different query, and the same one once forgotten, go out again
+        cashacct.lookup_asynch_all(101, lambda res, server: None, name='calin')
+        self.assertEqual(len(self.calls), 2)
+        cashacct._forget_lookup(100, 'calin')
+        cashacct.lookup_asynch_all(100, lambda res, server: None, name='Calin')
+        self.assertEqual(len(self.calls), 3)
+
+    def test_lookup_errors_reach_everyone(self):
+        errors = []
+        cashacct.lookup_asynch_all(100, lambda res, server: None, errors.append)
+        cashacct.lookup_asynch_all(100, lambda res, server: None, errors.append)
+        cashacct.lookup_asynch_all(100, lambda res, server: None)  # no error_cb
+        self.assertEqual(len(self.calls), 1)
+        exc = RuntimeError('all servers failed')
+        self.calls[0][3](exc)
+        self.assertEqual(errors, [exc, exc])
+        # Failures aren't cached
+        cashacct.lookup_asynch_all(100, lambda res, server: None)
+        self.assertEqual(len(self.calls), 2)
+
+    def _make_cashacct(self, wallet, *, t=None, verified_in=None):
+        ca = cashacct.CashAcct(wallet)
+        script = cashacct.ScriptOutput.from_script(self.nilac, block_hash=self.bhash, txid=self.txid, block_height=self.bheight)
+        rtx = ca.RegTx(self.txid, script)
+        ca.ext_reg_tx[self.txid] = rtx
+        ca._add_vtx(ca.VerifTx(self.txid, self.bheight, verified_in or self.bhash), script)
+        ca.processed_blocks.put(self.bheight, cashacct.ProcessedBlock(hash=self.bhash, height=self.bheight, reg_txs={self.txid: rtx}))
+        ca.processed_block_times[self.bheight] = time.time() if t is None else t
+        return ca
+
+    def test_processed_blocks_saved(self):
+        wallet = FakeWallet()
+        ca = self._make_cashacct(wallet)
+        pb = ca.processed_blocks.get(self.bheight)
+        ca.save()
+        ca2 = cashacct.CashAcct(wallet)
+        ca2.load()
+        self.assertEqual(ca2.processed_blocks.get(self.bheight), pb)
+        self.assertEqual(list(ca2.processed_blocks.get(self.bheight).reg_txs), [self.txid])
+        self.assertEqual(ca2.processed_block_times[self.bheight], ca.processed_block_times[self.bheight])
+
+    def test_processed_blocks_dropped(self):
+        # Too old to save
+        wallet = FakeWallet()
+        self._make_cashacct(wallet, t=time.time() - cashacct.CashAcct.processed_block_ttl - 1).save()
+        ca2 = cashacct.CashAcct(wallet)
+        ca2.load()
+        self.assertIsNone(ca2.processed_blocks.get(self.bheight))
+        # Saved, but expired by the time it is loaded
+        wallet = FakeWallet()
+        ca = self._make_cashacct(wallet)
+        ca.save()
+        wallet.storage['cash_accounts_data']['processed_blocks'][0][-1] -= cashacct.CashAcct.processed_block_ttl
+        ca2 = cashacct.CashAcct(wallet)
+        ca2.load()
+        self.assertIsNone(ca2.processed_blocks.get(self.bheight))
+        # Its registration since verified in another block
+        wallet = FakeWallet()
+        self._make_cashacct(wallet, verified_in='00' * 32).save()
+        ca2 = cashacct.CashAcct(wallet)
+        ca2.load()
+        self.assertIsNone(ca2.processed_blocks.get(self.bheight))
+        self.assertIn(self.txid, ca2.v_tx)
@@ -179,5 +179,22 @@ class TestCashAddrAddress(unittest.TestCase):
             self.assertEqual(kind, cashaddr.PUBKEY_TYPE)
             self.assertEqual(addr_hash, hashbytes)
 
+    def test_convertbits(self):
+        """Test the base32 shortcuts of _convertbits against a bit-by-bit
+        reference, for every length of the final group."""
+        def reference(data, frombits, tobits, pad):
+            bits = ''.join(format(v, '0{}b'.format(frombits)) for v in data)
+            if pad:
+                bits += '0' * (-len(bits) % tobits)
+            return bytearray(int(bits[i:i + tobits], 2)
+                             for i in range(0, len(bits) - tobits + 1, tobits))
+        for length in range(0, 70):
+            data = bytes(random.getrandbits(8) for i in range(length))
+            self.assertEqual(cashaddr._convertbits(data, 8, 5, True),
+                             reference(data, 8, 5, True))
+            values = bytes(random.getrandbits(5) for i in range(length))
+            self.assertEqual(cashaddr._convertbits(values, 5, 8, False),
+                             reference(values, 5, 8, False))
+
 if __name__ == '__main__':
     unittest.main()
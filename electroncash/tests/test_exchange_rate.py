@@ -0,0 +1,57 @@
+import os
+import shutil
+import tempfile
+import unittest
+from datetime import date, datetime
+
+from ..exchange_rate import RateHistory
+
+
+class TestRateHistory(unittest.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.dir = tempfile.mkdtemp()
+        self.h = RateHistory.from_dict({'2021-01-03': 3.5, '2021-01-01': 1.25, '2021-01-02': None,
+                                        '2021-01-05': '5.0'})
+
+    def tearDown(self):
+        shutil.rmtree(self.dir)
+        super().tearDown()
+
+    def test_lookup(self):
+        day = date(2021, 1, 1).toordinal()
+        self.assertEqual(list(self.h.days), [day, day + 2, day + 4])
+        self.assertEqual(self.h.get(day), 1.25)
+        self.assertIsNone(self.h.get(day + 1))
+        self.assertIsNone(self.h.get(day + 5))
+        days = [day + 4, day - 1, day, day + 2, day + 4, day + 3]
+        self.assertEqual(self.h.get_many(days), [self.h.get(d) for d in days])
+        self.assertEqual(self.h.get(datetime(2021, 1, 5, 23, 59).toordinal()), 5.0)
+
+    def test_write_and_read(self):
+        filename = os.path.join(self.dir, 'rates')
+        self.h.write(filename)
+        self.assertEqual(os.stat(filename).st_size, 3 * RateHistory._record.size)
+        cached = RateHistory.read(filename)
+        self.assertEqual((cached.days, cached.rates), (self.h.days, self.h.rates))
+
+        # A newer history changing the last day and adding one only rewrites those
+        newer = RateHistory(self.h.days, self.h.rates)
+        newer.rates[-1] = 5.5
+        newer.days.append(newer.days[-1] + 1)
+        newer.rates.append(6.0)
+        start = newer.common_prefix(cached)
+        self.assertEqual(start, 2)
+        newer.write(filename, start)
+        back = RateHistory.read(filename)
+        self.assertEqual((back.days, back.rates), (newer.days, newer.rates))
+
+        # A partially written last record is ignored
+        with open(filename, 'ab') as f:
+            f.write(b'\0\1\2')
+        self.assertEqual(len(RateHistory.read(filename)), 4)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -36,3 +36,65 @@ class TestInterface(unittest.TestCase):
         self.assertFalse(i.check_host_name(
             peercert={'subject': ((('commonName', '*.bar.com'),),)},
             name='sub.foo.bar.com'))
+
+    def test_batched_requests(self):
+        import json
+        import socket
+        a, b = socket.socketpair()
+        try:
+            i = interface.Interface('foo.bar.com:50001:t', a)
+            for n in range(3):
+                i.queue_request('blockchain.scripthash.subscribe', ['sh%d' % n], n)
+            self.assertTrue(i.send_requests())
+            self.assertEqual(3, len(i.unanswered_requests))
+            # All three requests went out as a single JSON-RPC batch array
+            line = b.recv(65536)
+            self.assertEqual(1, line.count(b'\n'))
+            batch = json.loads(line.decode('utf8'))
+            self.assertEqual([0, 1, 2], [r['id'] for r in batch])
+            # Reply out of order, followed by a notification
+            reply = [{'id': 2, 'result': 'c'}, {'id': 0, 'result': 'a'}, {'id': 1, 'result': 'b'}]
+            notif = {'method': 'blockchain.scripthash.subscribe', 'params': ['sh0', 'd']}
+            b.sendall((json.dumps(reply) + '\n' + json.dumps(notif) + '\n').encode('utf8'))
+            responses = i.get_responses()
+            self.assertEqual(['c', 'a', 'b'], [r['result'] for _, r in responses[:3]])
+            self.assertEqual([2, 0, 1], [req[2] for req, _ in responses[:3]])
+            self.assertEqual((None, notif), responses[3])
+            self.assertEqual(4, len(responses))
+            self.assertFalse(i.unanswered_requests)
+        finally:
+            a.close()
+            b.close()
+
+    def test_json_pipe_streaming(self):
+        import socket
+        from .. import util
+        a, b = socket.socketpair()
+        try:
+            pipe = util.JSONSocketPipe(a, max_message_bytes=64)
+            # A message split across reads, a bad line that gets skipped, and
+            # several messages arriving at once
+            b.sendall(b'{"id": 1, "res')
+            self.assertRaises(util.timeout, pipe.get)
+            b.sendall(b'ult": "x"}\nnot json\n{"id": 2}\n[{"id": 3}]\n')
+            self.assertEqual({'id': 1, 'result': 'x'}, pipe.get())
+            self.assertEqual({'id': 2}, pipe.get())
+            self.assertEqual([{'id': 3}], pipe.get())
+            self.assertRaises(util.timeout, pipe.get)
+            self.assertEqual(0, len(pipe.recv_buf))
+            # The size limit applies per message, not to everything buffered
+            b.sendall((('{"id": 4}\n' * 20) + '"' + 'x' * 100).encode('ascii'))
+            for _ in range(20):
+                self.assertEqual({'id': 4}, pipe.get())
+            self.assertRaises(pipe.Closed, pipe.get)
+        finally:
+            a.close()
+            b.close()
+
+    def test_header_chunk_decoded(self):
+        response = {'id': 1, 'result': {'hex': '00ff' * 80, 'count': 1, 'max': 2016}}
+        interface.Interface._decode_header_chunk(response)
+        self.assertEqual(b'\x00\xff' * 80, response['result']['hex'])
+        response = {'id': 1, 'result': {'hex': 'zz'}}
+        interface.Interface._decode_header_chunk(response)
+        self.assertEqual('zz', response['result']['hex'])
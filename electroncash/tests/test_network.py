@@ -0,0 +1,192 @@
+import queue
+import threading
+import unittest
+from unittest import mock
+
+from .. import networks
+from ..interface import Interface
+from ..network import Network, FAST_SYNC_TIMEOUT
+
+
+class FakeInterface:
+    def __init__(self, server, blockchain, tip, latency, load=0):
+        self.server = server
+        self.blockchain = blockchain
+        self.tip = tip
+        self.latency = latency
+        self.mode = Interface.MODE_DEFAULT
+        self._load = load
+
+    def load(self):
+        return self._load
+
+    def set_mode(self, mode):
+        self.mode = mode
+
+    def print_error(self, *args):
+        pass
+
+
+def make_network(interfaces, *, spread_reads=True, proxy=None):
+    """A Network with just the state the code under test reads, so that no
+    threads or sockets are started."""
+    network = Network.__new__(Network)
+    network.interface_lock = threading.RLock()
+    network.interfaces = {i.server: i for i in interfaces}
+    network.spread_reads = spread_reads
+    network.proxy = proxy
+    network.posted_calls = queue.Queue()
+    return network
+
+
+class TestSpreadReads(unittest.TestCase):
+
+    def setUp(self):
+        chain = object()
+        self.primary = FakeInterface('a:50002:s', chain, 100, 0.9)
+        self.fast = FakeInterface('b:50002:s', chain, 100, 0.1)
+        self.behind = FakeInterface('c:50002:s', chain, 99, 0.01)
+        self.fork = FakeInterface('d:50002:s', object(), 100, 0.01)
+        self.all = [self.primary, self.fast, self.behind, self.fork]
+
+    def test_picks_fastest_on_same_chain(self):
+        network = make_network(self.all)
+        self.assertIs(self.fast, network._pick_read_interface(self.primary))
+        self.fast._load = 10
+        self.assertIs(self.primary, network._pick_read_interface(self.primary))
+
+    def test_off_by_config(self):
+        network = make_network(self.all, spread_reads=False)
+        self.assertIs(self.primary, network._pick_read_interface(self.primary))
+
+    def test_off_through_proxy(self):
+        network = make_network(self.all, proxy={'mode': 'socks5', 'host': 'localhost', 'port': '9050'})
+        self.assertIs(self.primary, network._pick_read_interface(self.primary))
+
+
+class TestPost(unittest.TestCase):
+
+    def test_post_from_another_thread(self):
+        network = make_network([])
+        calls = []
+        network.post(calls.append, 1)
+        network.post(lambda: 1 / 0)  # logged, and doesn't stop the others
+        network.post(calls.append, 2)
+        self.assertEqual(calls, [])  # not on the network thread: queued
+        network.run_posted_calls()
+        self.assertEqual(calls, [1, 2])
+        network.run_posted_calls()
+        self.assertEqual(calls, [1, 2])
+
+
+class FakeChain:
+    def __init__(self, height):
+        self._height = height
+
+    def height(self):
+        return self._height
+
+
+class TestFastSync(unittest.TestCase):
+    """Fast header sync against servers that lie about their tip or root, or
+    don't answer: it must end up verifying against the hardcoded checkpoint."""
+
+    checkpoint = 18144
+    honest_tip = 100000
+    fast_height = (honest_tip - 100) // 2016 * 2016 - 1
+
+    def setUp(self):
+        for name, value in (('VERIFICATION_BLOCK_HEIGHT', self.checkpoint),
+                            ('VERIFICATION_BLOCK_MERKLE_ROOT', '11' * 32)):
+            patcher = mock.patch.object(networks.net, name, value)
+            patcher.start()
+            self.addCleanup(patcher.stop)
+        self.interfaces = [FakeInterface('%s:50002:s' % c, None, 0, 0.1) for c in 'abcd']
+        for i in self.interfaces:
+            i.mode = Interface.MODE_VERIFICATION
+        network = self.network = make_network(self.interfaces)
+        network.num_server = 10
+        network.fast_header_sync = True
+        network.fast_sync_tips = {}
+        network.fast_sync_deadline = None
+        network.fast_sync_off = False
+        network.checkpoint_height = self.checkpoint
+        network.checkpoint_servers_verified = {}
+        network.requested_chunks = set()
+        network.blockchains = {0: FakeChain(self.checkpoint)}
+        network.config = mock.Mock()
+        network.init_headers_file = mock.Mock()
+        self.requests = {}  # server -> checkpoint height of its verification request
+        network._request_headers = lambda i, base, count, cp: self.requests.__setitem__(i.server, cp)
+        network.connection_down = mock.Mock()
+
+    def notify_tips(self, *tips):
+        for i, tip in zip(self.interfaces, tips):
+            i.tip = tip
+            self.network.request_initial_proof_and_headers(i)
+
+    def verify(self, i, root):
+        return self.network.apply_successful_verification(i, self.requests[i.server], root)
+
+    def assertFellBack(self):
+        self.assertEqual(self.network.checkpoint_height, self.checkpoint)
+        self.assertTrue(self.network.fast_sync_off)
+        self.assertEqual(set(self.requests.values()), {self.checkpoint})
+
+    def test_median_tip(self):
+        a, b, c, d = self.interfaces
+        self.notify_tips(self.honest_tip, 10 ** 8)
+        self.assertEqual(self.requests, {})  # waiting on a third tip
+        self.notify_tips(self.honest_tip, 10 ** 8, self.honest_tip + 1, self.honest_tip)
+        self.assertEqual(self.network.checkpoint_height, self.fast_height)
+        self.assertEqual(self.requests, {i.server: self.fast_height for i in self.interfaces})
+        self.assertFalse(self.verify(a, '22' * 32))
+        self.assertFalse(self.verify(b, '22' * 32))
+        self.assertTrue(self.verify(c, '22' * 32))
+        self.assertEqual(networks.net.VERIFICATION_BLOCK_HEIGHT, self.fast_height)
+        self.assertIsNone(self.network.fast_sync_deadline)
+
+    def test_lying_root(self):
+        a, b, c, d = self.interfaces
+        self.notify_tips(self.honest_tip, self.honest_tip, self.honest_tip)
+        self.assertFalse(self.verify(a, '22' * 32))
+        self.assertFalse(self.verify(b, '33' * 32))
+        self.assertFellBack()
+        self.assertEqual(len(self.requests), 3)
+        # The answer to the abandoned request is ignored, not held against c
+        request = ('blockchain.block.headers', [self.fast_height - 146, 147, self.fast_height])
+        self.network.on_block_headers(c, request, {'params': request[1], 'result': {'hex': b''}})
+        self.network.connection_down.assert_not_called()
+        d.tip = self.honest_tip
+        self.network.request_initial_proof_and_headers(d)
+        self.assertEqual(self.requests[d.server], self.checkpoint)
+
+    def test_error_response(self):
+        self.notify_tips(self.honest_tip, self.honest_tip, self.honest_tip)
+        request = ('blockchain.block.headers', [self.fast_height - 146, 147, self.fast_height])
+        self.network.on_block_headers(self.interfaces[0], request, {'error': 'no', 'params': request[1]})
+        self.assertFellBack()
+
+    def test_silent_proposer(self):
+        a, b, c, d = self.interfaces
+        self.notify_tips(self.honest_tip, self.honest_tip, self.honest_tip)
+        self.assertFalse(self.verify(a, '22' * 32))
+        self.assertFalse(self.verify(b, '22' * 32))
+        self.network.maintain_fast_sync()
+        self.assertEqual(self.network.checkpoint_height, self.fast_height)
+        with mock.patch('time.time', return_value=self.network.fast_sync_deadline + 1):
+            self.network.maintain_fast_sync()
+        self.assertFellBack()
+
+    def test_too_few_tips(self):
+        self.notify_tips(self.honest_tip, self.honest_tip)
+        self.assertEqual(self.requests, {})
+        with mock.patch('time.time', return_value=self.network.fast_sync_deadline + 1):
+            self.network.maintain_fast_sync()
+        self.assertFellBack()
+        self.assertEqual(len(self.requests), 2)
+
+    def test_not_worth_it(self):
+        self.notify_tips(self.checkpoint + 200, self.honest_tip, self.checkpoint + 300)
+        self.assertFellBack()
+        self.assertEqual(len(self.requests), 3)
@@ -0,0 +1,78 @@
+import secrets
+import threading
+import unittest
+
+from .. import schnorr
+from ..rpa import paycode
+
+
+class TestPaycodeSharedSecret(unittest.TestCase):
+
+    private_key = 0x12b004fff7f4b69ef8650e767f18f11ede158148b425660723b9f9a66e61f747
+    public_key = bytes.fromhex("0271e16c9194961c1d5c0441f636fc5f8616ba547c145dbe2a08a8a8b619b0c55e")
+    outpoint = "b52ecd1e5bd9338f486ab13b54d4b3b7b5b2d4cab1a6e1f79f1b8f6da84c9b7a1"
+    shared_secret = bytes.fromhex("26f65221fc7591df48dd5763df483162e1aaab3f660b34bd61641ebeef10a8ed")
+
+    def do_it(self):
+        self.assertEqual(self.shared_secret,
+                         paycode._calculate_paycode_shared_secret(self.private_key, self.public_key, self.outpoint))
+
+        pairs = [(self.public_key, self.outpoint + str(n)) for n in range(4)] + [(self.public_key, self.outpoint)]
+        expected = [paycode._calculate_paycode_shared_secret(self.private_key, pk, op) for pk, op in pairs]
+        self.assertEqual(expected[-1], self.shared_secret)
+        self.assertEqual(expected, paycode._calculate_paycode_shared_secrets(self.private_key, pairs))
+        self.assertEqual([], paycode._calculate_paycode_shared_secrets(self.private_key, []))
+
+    def test_slow(self):
+        saved = (paycode._secp256k1_rpa_shared_secret, paycode._secp256k1_rpa_shared_secret_batch)
+        paycode._secp256k1_rpa_shared_secret, paycode._secp256k1_rpa_shared_secret_batch = None, None
+        try:
+            self.do_it()
+        finally:
+            paycode._secp256k1_rpa_shared_secret, paycode._secp256k1_rpa_shared_secret_batch = saved
+
+    def test_fast(self):
+        if not paycode.has_fast_shared_secret():
+            self.skipTest("secp256k1 lib lacks secp256k1_rpa_shared_secret")
+        self.do_it()
+
+
+
+class TestPaycodeGrind(unittest.TestCase):
+
+    private_key = bytes.fromhex("12b004fff7f4b69ef8650e767f18f11ede158148b425660723b9f9a66e61f747")
+    public_key = bytes.fromhex("030b4c866585dd868a9d62348a9cd008d6a312937048fff31670e7e920cfc7a744")
+    paycode_hex = "0110" + "02" * 33
+
+    def setUp(self):
+        if not paycode.has_fast_grind():
+            self.skipTest("secp256k1 lib lacks secp256k1_rpa_grind")
+        self.pre_hash = secrets.token_bytes(32)
+        # outpoint, script length, push, signature, sighash type, pubkey push, sequence
+        self.serialized_input = secrets.token_bytes(36) + b'\x64\x41' + bytes(64) + b'\x41\x21' + self.public_key + b'\xff' * 4
+        self.sigpos = 38
+
+    def hash_with(self, sig):
+        return paycode.sha256(paycode.sha256(self.serialized_input[:self.sigpos] + sig + self.serialized_input[self.sigpos + 64:]))
+
+    def test_matches_python(self):
+        # the first candidate of thread 0 is what the Python loop signs first
+        sig = schnorr.sign(self.private_key, self.pre_hash, ndata=paycode.sha256(self.paycode_hex + "0" + "1"))
+        prefix = self.hash_with(sig)[:2]
+        self.assertEqual(sig, paycode._grind_signature_native(self.private_key, self.pre_hash, self.serialized_input, self.sigpos,
+                                                              self.paycode_hex, "1", prefix, 16, nthreads=1))
+
+    def test_threads(self):
+        progress = []
+        for bits in (4, 12):
+            sig = paycode._grind_signature_native(self.private_key, self.pre_hash, self.serialized_input, self.sigpos,
+                                                  self.paycode_hex, "1", b'\xa5\xc3', bits, progress_callback=progress.append, nthreads=4)
+            self.assertTrue(schnorr.verify(self.public_key, sig, self.pre_hash))
+            self.assertEqual(self.hash_with(sig).hex()[:bits // 4], "a5c3"[:bits // 4])
+        self.assertEqual(progress, sorted(progress))
+
+    def test_cancel(self):
+        exit_event = threading.Event()
+        exit_event.set()
+        self.assertIsNone(paycode._grind_signature_native(self.private_key, self.pre_hash, self.serialized_input, self.sigpos,
+                                                          self.paycode_hex, "1", b'\xa5\xc3\x99\x00', 32, exit_event=exit_event))
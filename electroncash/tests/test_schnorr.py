@@ -4,8 +4,10 @@
 # This file (c) 2019 Mark Lundeberg & Calin Culianu
 # Part of the Electron Cash SPV Wallet
 # License: MIT
+import threading
 import unittest
 from .. import schnorr
+from .. import secp256k1
 
 import hashlib
 import secrets
@@ -51,12 +53,141 @@ class TestSchnorr(unittest.TestCase):
             schnorr._secp256k1_schnorr_sign, schnorr._secp256k1_schnorr_verify = saved
             self.do_it()
 
-class TestBlind(unittest.TestCase):
+class TestSchnorrBatch(unittest.TestCase):
+
+    def do_it(self):
+        privkeys = [secrets.token_bytes(32) for _ in range(8)]
+        pubkeys = [regenerate_key(privkey).GetPubKey(True) for privkey in privkeys]
+        msghashes = [secrets.token_bytes(32) for _ in privkeys]
+        sigs = [schnorr.sign(privkey, msghash) for privkey, msghash in zip(privkeys, msghashes)]
+
+        self.assertTrue(schnorr.verify_batch([], [], []))
+        self.assertTrue(schnorr.verify_batch(pubkeys, sigs, msghashes))
+        self.assertTrue(schnorr.verify_batch(pubkeys[:1], sigs[:1], msghashes[:1]))
+
+        # swapping two messages must break the batch
+        swapped = msghashes[1:2] + msghashes[0:1] + msghashes[2:]
+        self.assertFalse(schnorr.verify_batch(pubkeys, sigs, swapped))
+
+        # so must a single flipped bit in one of the s values
+        bad = bytearray(sigs[5])
+        bad[-1] ^= 1
+        self.assertFalse(schnorr.verify_batch(pubkeys, sigs[:5] + [bytes(bad)] + sigs[6:], msghashes))
+
+        with self.assertRaises(ValueError):
+            schnorr.verify_batch(pubkeys, sigs[:-1], msghashes)
+
+    def test_fast(self):
+        if not schnorr.has_fast_verify_batch():
+            self.skipTest("secp256k1 lib lacks secp256k1_schnorr_verify_batch")
+        self.do_it()
+
+    def test_threads(self):
+        if not schnorr.has_fast_verify_batch():
+            self.skipTest("secp256k1 lib lacks secp256k1_schnorr_verify_batch")
+        privkeys = [secrets.token_bytes(32) for _ in range(8)]
+        pubkeys = [regenerate_key(privkey).GetPubKey(True) for privkey in privkeys]
+        msghashes = [secrets.token_bytes(32) for _ in privkeys]
+        sigs = [schnorr.sign(privkey, msghash) for privkey, msghash in zip(privkeys, msghashes)]
+        results, contexts = [], []
+        # keep every worker alive until all have their context, so that none
+        # is freed and its address handed to the next
+        barrier = threading.Barrier(4)
+
+        def worker():
+            ctx = secp256k1.thread_context()
+            contexts.append(ctx)
+            barrier.wait()
+            results.extend(schnorr.verify_batch(pubkeys, sigs, msghashes) for _ in range(20))
+            # and keeps it for later calls
+            results.append(secp256k1.thread_context() == ctx)
+
+        threads = [threading.Thread(target=worker) for _ in range(4)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        self.assertEqual(results, [True] * 84)
+        # each worker got its own context, none of them the global one
+        self.assertEqual(len(set(contexts)), 4)
+        self.assertNotIn(secp256k1.secp256k1.ctx, contexts)
+
+    def test_slow(self):
+        saved = schnorr._secp256k1_schnorr_verify_batch
+        schnorr._secp256k1_schnorr_verify_batch = None
+        try:
+            self.do_it()
+        finally:
+            schnorr._secp256k1_schnorr_verify_batch = saved
+
+class TestSchnorrVerifyCached(unittest.TestCase):
+
+    def setUp(self):
+        if not schnorr._secp256k1_schnorr_verify_cached:
+            self.skipTest("secp256k1 lib lacks secp256k1_schnorr_verify_cached")
+        secp256k1.set_pubkey_cache_size(4)
+
+    def tearDown(self):
+        secp256k1.set_pubkey_cache_size(0)
+
+    def test_verify(self):
+        privkeys = [secrets.token_bytes(32) for _ in range(6)]
+        pubkeys = [regenerate_key(privkey).GetPubKey(i & 1 == 0) for i, privkey in enumerate(privkeys)]
+        # more keys than the cache holds, each used often enough to turn hot
+        for _ in range(4):
+            for privkey, pubkey in zip(privkeys, pubkeys):
+                msghash = secrets.token_bytes(32)
+                sig = schnorr.sign(privkey, msghash)
+                self.assertTrue(schnorr.verify(pubkey, sig, msghash))
+                self.assertFalse(schnorr.verify(pubkey, sig, secrets.token_bytes(32)))
+                self.assertFalse(schnorr.verify(pubkeys[0] if pubkey != pubkeys[0] else pubkeys[1], sig, msghash))
+        # an unparseable pubkey is still reported as such
+        with self.assertRaises(ValueError):
+            schnorr.verify(b'\x02' + b'\xff' * 32, sig, msghash)
+
+class TestSchnorrSignBatch(unittest.TestCase):
 
     def do_it(self):
-        # signer
         privkey = secrets.token_bytes(32)
         pubkey = regenerate_key(privkey).GetPubKey(True)
+        other_pubkey = regenerate_key(secrets.token_bytes(32)).GetPubKey(True)
+        msghashes = [secrets.token_bytes(32) for _ in range(8)]
+        ndata = secrets.token_bytes(32)
+
+        self.assertEqual(schnorr.sign_batch(privkey, []), [])
+        sigs = schnorr.sign_batch(privkey, msghashes, pubkey=pubkey)
+        self.assertEqual(sigs, [schnorr.sign(privkey, msghash) for msghash in msghashes])
+        self.assertTrue(schnorr.verify_batch([pubkey] * len(sigs), sigs, msghashes))
+        sigs = schnorr.sign_batch(privkey, msghashes, ndata=ndata)
+        self.assertEqual(sigs, [schnorr.sign(privkey, msghash, ndata=ndata) for msghash in msghashes])
+
+        # a pubkey that is not privkey's must never be signed for
+        with self.assertRaises(ValueError):
+            schnorr.sign_batch(privkey, msghashes, pubkey=other_pubkey)
+        with self.assertRaises(ValueError):
+            schnorr.sign_batch(bytes(32), msghashes)
+        with self.assertRaises(ValueError):
+            schnorr.sign_batch(privkey, msghashes[:1] + [b'\x00' * 31])
+
+    def test_fast(self):
+        if not schnorr.has_fast_sign_batch():
+            self.skipTest("secp256k1 lib lacks secp256k1_schnorr_sign_batch")
+        self.do_it()
+
+    def test_slow(self):
+        saved = schnorr._secp256k1_schnorr_sign_batch
+        schnorr._secp256k1_schnorr_sign_batch = None
+        try:
+            self.do_it()
+        finally:
+            schnorr._secp256k1_schnorr_sign_batch = saved
+
+class TestBlind(unittest.TestCase):
+
+    def do_it(self, privkey=None):
+        # signer
+        privkey = privkey or secrets.token_bytes(32)
+        pubkey = regenerate_key(privkey).GetPubKey(True)
         signer = schnorr.BlindSigner()
         R = signer.get_R()
 
@@ -83,6 +214,31 @@ class TestBlind(unittest.TestCase):
             self.skipTest("accelerated ECC library not available")
         self.do_it()
 
+    def test_fast_without_native(self):
+        if not schnorr.seclib:
+            self.skipTest("accelerated ECC library not available")
+        saved = schnorr._secp256k1_schnorr_blind_request_create
+        schnorr._secp256k1_schnorr_blind_request_create = None
+        try:
+            self.do_it()
+        finally:
+            schnorr._secp256k1_schnorr_blind_request_create = saved
+
+    def test_native_matches(self):
+        if not schnorr.has_fast_blind():
+            self.skipTest("secp256k1 lib lacks secp256k1_schnorr_blind_request_create")
+        pubkey = regenerate_key(secrets.token_bytes(32)).GetPubKey(False)
+        R = schnorr.BlindSigner().get_R()
+        requester = schnorr.BlindSignatureRequest(pubkey, R, secrets.token_bytes(32))
+        attrs = ('c', 'Rxnew', 'pubkey_compressed', 'enew')
+        native = [getattr(requester, attr) for attr in attrs]
+        # redo the same request, with the same blinding factors, step by step
+        requester._calc_initial_fast()
+        ehash = hashlib.sha256(requester.Rxnew + requester.pubkey_compressed + requester.message_hash).digest()
+        requester.enew = int.from_bytes(ehash, 'big') % requester.order
+        self.assertEqual([getattr(requester, attr) for attr in attrs], native)
+        self.assertEqual(requester.e, (requester.c * int.from_bytes(ehash, 'big') + requester.b) % requester.order)
+
     def test_slow(self):
         saved = schnorr.seclib
         schnorr.seclib = None
@@ -91,6 +247,23 @@ class TestBlind(unittest.TestCase):
         finally:
             schnorr.seclib = saved
 
+    def test_fixed_table(self):
+        if not schnorr.seclib or not secp256k1.has_fixed_table():
+            self.skipTest("secp256k1 lib lacks secp256k1_ecmult_fixed_table_create")
+        saved = schnorr._FIXED_TABLE_MIN_USES
+        schnorr._FIXED_TABLE_MIN_USES = 2
+        try:
+            # one signer key, so all but the first request use its table
+            privkey = secrets.token_bytes(32)
+            for _ in range(4):
+                self.do_it(privkey)
+            pubkey = regenerate_key(privkey).GetPubKey(True)
+            self.assertIn(pubkey, schnorr._fixed_tables)
+        finally:
+            schnorr._FIXED_TABLE_MIN_USES = saved
+            schnorr._fixed_tables.clear()
+            schnorr._fixed_table_uses.clear()
+
     def test_jacobi(self):
         """ test the faster jacobi implementation against ecdsa package"""
         alist = [-2,-1,0,1,2,3,4] + [secrets.randbits(256) for _ in range(100)]
@@ -614,3 +614,54 @@ class SLPTests(unittest.TestCase):
 
         print("Completed %d OP_RETURN *build* tests"%ctr)
 
+
+    def test_validation(self):
+        from ..bitcoin import TYPE_ADDRESS
+        from ..slp import validation
+        from ..transaction import Transaction
+        addr = address.Address.from_string('qqy9myvyt7qffgye5a2mn2vn8ry95qm6asy40ptgx2')
+        def tx(op_return, spends, n_outputs):
+            inputs = [{'prevout_hash': h, 'prevout_n': n} for h, n in spends]
+            outputs = [op_return] + [(TYPE_ADDRESS, addr, 546)] * n_outputs
+            return Transaction.from_io(inputs, outputs)
+        G, S1, S2, M, M_bad, P, S3, S4, U, S5 = (bytes([i]).hex() * 32 for i in range(1, 11))
+        txs = {
+            G: tx(slp.Build.GenesisOpReturnOutput_V1('TOK', 'Token', '', '', 0, 2, 100), [(P, 1)], 2),
+            S1: tx(slp.Build.SendOpReturnOutput_V1(G, [60, 40]), [(G, 1)], 2),
+            S2: tx(slp.Build.SendOpReturnOutput_V1(G, [70]), [(S1, 1)], 1),  # spends 60
+            M: tx(slp.Build.MintOpReturnOutput_V1(G, None, 5), [(G, 2)], 1),  # spends the baton
+            M_bad: tx(slp.Build.MintOpReturnOutput_V1(G, None, 5), [(G, 1)], 1),
+            P: tx((TYPE_ADDRESS, addr, 1000), [], 1),
+            S3: tx(slp.Build.SendOpReturnOutput_V1(G, [1]), [(P, 1)], 1),
+            S4: tx(slp.Build.SendOpReturnOutput_V1(G, [1]), [(U, 1)], 1),  # U can't be fetched
+            S5: tx(slp.Build.SendOpReturnOutput_V1(G, [30, 10]), [(S1, 2)], 2),  # spends 40
+        }
+        fetched = []
+        def fetch(txids):
+            fetched.extend(txids)
+            return {t: txs[t] for t in txids if t in txs}
+        results = {}
+        v = validation.Validator(results, fetch)
+        self.assertEqual(v.validate([S2, M, M_bad, S3, S4, S1]),
+                         {S1: validation.VALID, S2: validation.INVALID_DAG, M: validation.VALID,
+                          M_bad: validation.INVALID_DAG, S3: validation.INVALID_DAG, S4: validation.UNKNOWN})
+        self.assertEqual(results[G].amounts, (0, 100))
+        self.assertEqual(results[P], validation.NOT_SLP)
+        self.assertNotIn(S4, results)
+        self.assertEqual(len(fetched), len(set(fetched)))  # each tx was fetched once
+        # The walk stops at what is already known, and the results survive a round trip through JSON
+        results = {k: validation.Result.from_json(json.loads(json.dumps(r.to_json()))) for k, r in results.items()}
+        del fetched[:]
+        self.assertEqual(validation.Validator(results, fetch).validate([S5]), {S5: validation.VALID})
+        self.assertEqual(fetched, [S5])
+        # An unexpected error is not taken for a spec failure: the tx is left
+        # unknown, not cached, and judged again next time
+        results = {}
+        v = validation.Validator(results, fetch)
+        def broken(*args):
+            raise KeyError('bug')
+        v._judge_one = broken
+        self.assertEqual(v.validate([S1]), {S1: validation.UNKNOWN})
+        self.assertNotIn(S1, results)
+        del v._judge_one
+        self.assertEqual(v.validate([S1]), {S1: validation.VALID})
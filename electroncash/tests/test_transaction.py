@@ -1,9 +1,12 @@
 import unittest
+from ctypes import byref, c_size_t, create_string_buffer
 from pprint import pprint
 
+from .. import ecc_fast
 from .. import transaction
+from ..caches import ByteBudgetCache
 from ..address import Address, ScriptOutput, PublicKey
-from ..bitcoin import TYPE_ADDRESS, TYPE_PUBKEY, TYPE_SCRIPT
+from ..bitcoin import TYPE_ADDRESS, TYPE_PUBKEY, TYPE_SCRIPT, Hash, bfh
 
 from ..keystore import xpubkey_to_address
 
@@ -130,6 +133,53 @@ class TestTransaction(unittest.TestCase):
 
         self.assertEqual(tx.estimated_size(), 191)
 
+    def _check_sighashes(self):
+        tx = transaction.Transaction(unsigned_blob)
+        tx.deserialize()
+        self.assertEqual(tx.calc_sighashes([0]), [bfh('8d730afba59f2e398901326b9a7d92d4ded7c1ffed4cb2b85f5890a114d4cc03')])
+
+        inputs = []
+        for n in range(5):
+            txin = dict(tx.inputs()[0])
+            txin['prevout_n'] = n
+            txin['value'] += n
+            inputs.append(txin)
+        tx = transaction.Transaction.from_io(inputs, tx.outputs(), locktime=tx.locktime)
+        expected = [Hash(bfh(tx.serialize_preimage(i))) for i in range(5)]
+        self.assertEqual(tx.calc_sighashes(range(5)), expected)
+        self.assertEqual(tx.calc_sighashes([3, 1], use_cache=True), [expected[3], expected[1]])
+        self.assertEqual(tx.calc_sighashes([]), [])
+
+    def test_calc_sighashes(self):
+        self._check_sighashes()
+
+    def test_calc_sighashes_slow(self):
+        saved = ecc_fast._secp256k1_sha256d_affixed_multi
+        ecc_fast._secp256k1_sha256d_affixed_multi = None
+        try:
+            self._check_sighashes()
+        finally:
+            ecc_fast._secp256k1_sha256d_affixed_multi = saved
+
+    def test_ecdsa_sign_grind(self):
+        if not ecc_fast.has_fast_ecdsa_sign_grind():
+            self.skipTest("secp256k1 lib lacks secp256k1_ecdsa_sign_grind")
+        lib = ecc_fast.secp256k1.secp256k1
+        sec = bytes(range(1, 33))
+        for n in range(16):
+            pre_hash = Hash(bytes([n]))
+            # a bound every signature fits in leaves the deterministic signature alone
+            sig = create_string_buffer(64)
+            self.assertTrue(lib.secp256k1_ecdsa_sign(lib.ctx, sig, pre_hash, sec, None, None))
+            der, derlen = create_string_buffer(72), c_size_t(72)
+            lib.secp256k1_ecdsa_signature_serialize_der(lib.ctx, der, byref(derlen), sig)
+            self.assertEqual(ecc_fast.ecdsa_sign_grind(sec, pre_hash, 72), der.raw[:derlen.value])
+            low_r = ecc_fast.ecdsa_sign_grind(sec, pre_hash)
+            self.assertLessEqual(len(low_r), 70)
+            self.assertLess(low_r[4], 0x80)  # r needs no sign padding
+            self.assertLessEqual(len(ecc_fast.ecdsa_sign_grind(sec, pre_hash, 69)), 69)
+        self.assertIsNone(ecc_fast.ecdsa_sign_grind(bytes(32), pre_hash))
+
     def test_tx_nonminimal_scriptSig(self):
         # The nonminimal push is the '4c41...' (PUSHDATA1 length=0x41 [...]) at
         # the start of the scriptSig. Minimal is '41...' (PUSH0x41 [...]).
@@ -177,6 +227,39 @@ class TestTransaction(unittest.TestCase):
         res = xpubkey_to_address('fe4e13b0f311a55b8a5db9a32e959da9f011b131019d4cebe6141b9e2c93edcbfc0954c358b062a9f94111548e50bde5847a3096b8b7872dcffadb0e9579b9017b01000200')
         self.assertEqual(res, ('04ee98d63800824486a1cf5b4376f2f574d86e0a3009a6448105703453f3368e8e1d8d090aaecdd626a45cc49876709a3bbb6dc96a4311b3cac03e225df5f63dfc', Address.from_string('19h943e4diLc68GXW7G75QNe2KWuMu7BaJ')))
 
+    def test_deserialize_fast(self):
+        if not transaction.has_fast_deserialize():
+            self.skipTest("secp256k1 lib lacks secp256k1_tx_parse")
+        for blob in (signed_blob, v2_blob, nonmin_blob):
+            raw = bfh(blob)
+            d, txid = transaction._deserialize_fast(raw)
+            saved = transaction._secp256k1_tx_parse
+            transaction._secp256k1_tx_parse = None
+            try:
+                self.assertEqual(d, transaction.deserialize(blob))
+            finally:
+                transaction._secp256k1_tx_parse = saved
+            self.assertEqual(txid, transaction.Transaction._txid(blob))
+            # truncated or padded txs are left to the BCDataStream path
+            self.assertIsNone(transaction._deserialize_fast(raw[:-1]))
+            self.assertIsNone(transaction._deserialize_fast(raw + b'\x00'))
+        # as are partially signed ones, whose inputs carry their value
+        self.assertIsNone(transaction._deserialize_fast(bfh(unsigned_blob)))
+
+        tx = transaction.Transaction(signed_blob)
+        tx.deserialize()
+        self.assertEqual(tx.txid_fast(), tx._txid(signed_blob))
+
+    def test_lazy(self):
+        full = transaction.Transaction(signed_blob)
+        tx = transaction.Transaction(signed_blob, lazy=True)
+        self.assertEqual(tx.outputs(), full.outputs())
+        self.assertEqual(tx.locktime, full.locktime)
+        if transaction.has_fast_deserialize():
+            self.assertIsNone(tx._inputs)
+        self.assertEqual(tx.inputs(), full.inputs())
+        self.assertEqual(tx.serialize(), signed_blob)
+
     def test_version_field(self):
         tx = transaction.Transaction(v2_blob)
         self.assertEqual(tx.txid(), "b97f9180173ab141b61b9f944d841e60feec691d6daab4d4d932b24dd36606fe")
@@ -296,6 +379,97 @@ class TestTransaction(unittest.TestCase):
         self.assertEqual("", tx.outputs()[0][1].to_ui_string())
         self.assertEqual('50fa7bd4e5e2d3220fd2e84effec495b9845aba379d853408779d59a4b0b4f59', tx.txid())
 
+class TestTxCache(unittest.TestCase):
+
+    def test_byte_budget(self):
+        cache = ByteBudgetCache(max_bytes=3 * (ByteBudgetCache.overhead + 2 + 10), name="test")
+        for key in ('t1', 't2', 't3'):
+            cache.put(key, bytes(10))
+        self.assertEqual(len(cache), 3)
+        self.assertIsNotNone(cache.get('t1'))  # t2 is now the least recently used
+        cache.put('t4', bytes(10))
+        self.assertIsNone(cache.get('t2'))
+        self.assertEqual(cache.get('t1'), bytes(10))
+        # replacing an entry charges only the new value
+        cache.put('t1', bytes(10))
+        self.assertEqual(len(cache), 3)
+        self.assertEqual(cache.size_bytes(), cache.max_bytes)
+        # an entry larger than the whole budget is not cached
+        cache.put('t5', bytes(cache.max_bytes))
+        self.assertIsNone(cache.get('t5'))
+        stats = cache.stats()
+        self.assertEqual((stats['items'], stats['hits'], stats['misses'], stats['evictions']), (3, 2, 2, 1))
+        cache.set_max_bytes(ByteBudgetCache.overhead + 2 + 10)
+        self.assertEqual(len(cache), 1)
+        self.assertEqual(cache.stats()['evictions'], 3)
+
+    def test_tx_cache(self):
+        tx = transaction.Transaction(signed_blob)
+        txid = tx.txid_fast()
+        transaction.Transaction.tx_cache_put(tx)
+        cached = transaction.Transaction.tx_cache_get(txid)
+        self.assertIsNot(cached, tx)
+        self.assertEqual(cached.raw, signed_blob)
+        self.assertTrue(cached.is_memory_compact())
+        self.assertIsNone(transaction.Transaction.tx_cache_get('00' * 32))
+        self.assertGreaterEqual(transaction.Transaction.tx_cache_stats()['hits'], 1)
+
+    def test_tx_store(self):
+        import os, tempfile
+        from ..tx_store import RawTxStore
+        raw = bytes.fromhex(signed_blob)
+        txid = transaction.Transaction(signed_blob).txid_fast()
+        with tempfile.TemporaryDirectory() as path:
+            store = RawTxStore(path)
+            self.assertEqual(store.put(raw), txid)
+            self.assertEqual(store.put(raw), txid)  # no duplicates
+            self.assertEqual(len(store), 1)
+            self.assertEqual(store.get(txid), raw)
+            self.assertIsNone(store.get('00' * 32))
+            # enough junk "txs" to make the index grow
+            others = [i.to_bytes(4, 'little') * 30 for i in range(RawTxStore.MIN_SLOTS)]
+            other_ids = [store.put(o) for o in others]
+            self.assertEqual(len(store), len(others) + 1)
+            store.close()
+            # records appended without an index update, plus a torn one, are
+            # picked up when the store is opened again
+            with open(os.path.join(path, 'data'), 'ab') as f:
+                f.write(RawTxStore.RECORD.pack(b'\x01' * 32, 3) + b'abc')
+                f.write(RawTxStore.RECORD.pack(b'\x02' * 32, 100) + b'ab')
+            store = RawTxStore(path)
+            self.assertEqual(store.get('01' * 32), b'abc')
+            self.assertEqual(store.get(txid), raw)
+            store.close()
+            # a damaged index is rebuilt from the data file
+            with open(os.path.join(path, 'index'), 'r+b') as f:
+                f.write(b'garbage')
+            store = RawTxStore(path)
+            self.assertEqual(store.get(txid), raw)
+            self.assertEqual(store.get(other_ids[-1]), others[-1])
+            self.assertEqual(len(store), len(others) + 2)
+            store.close()
+
+    def test_tx_store_shared(self):
+        import tempfile
+        from ..tx_store import RawTxStore
+        raw = bytes.fromhex(signed_blob)
+        with tempfile.TemporaryDirectory() as path:
+            # as if opened by two processes on the same config dir
+            a, b = RawTxStore(path), RawTxStore(path)
+            txid = a.put(raw)
+            self.assertEqual(b.get(txid), raw)
+            self.assertEqual(b.put(raw), txid)
+            # a rebuilds the index at twice the size; b follows it there
+            others = [i.to_bytes(4, 'little') * 30 for i in range(RawTxStore.MIN_SLOTS)]
+            other_ids = [a.put(o) for o in others]
+            self.assertEqual(b.get(other_ids[-1]), others[-1])
+            self.assertEqual(b.put(b'written by b'), a.put(b'written by b'))
+            self.assertEqual(len(a), len(b))
+            self.assertEqual(len(a), len(others) + 2)
+            a.close()
+            b.close()
+            b.close()
+
 class NetworkMock(object):
 
     def __init__(self, unspent):
@@ -1,5 +1,7 @@
 import unittest
-from ..util import format_satoshis
+import threading
+
+from ..util import format_satoshis, profiler, profiler_stats, JobWorker, ThreadJob, batch_responses
 from ..web import parse_URI
 
 class TestUtil(unittest.TestCase):
@@ -110,3 +112,53 @@ class TestUtil(unittest.TestCase):
 
     def test_parse_URI_parameter_polution(self):
         self.assertRaises(Exception, parse_URI, 'bitcoincash:15mKKb2eos1hWa6tisdPwwDC1a5J1y9nma?amount=0.0003&label=test&amount=30.0')
+
+    def test_profiler_stats(self):
+        @profiler
+        def profiled(x):
+            if x < 0:
+                raise ValueError(x)
+            return x * 2
+        self.assertEqual(profiled.__name__, 'profiled')
+        for i in range(10):
+            self.assertEqual(profiled(i), i * 2)
+        with self.assertRaises(ValueError):
+            profiled(-1)
+        name = 'test_util.TestUtil.test_profiler_stats.<locals>.profiled'
+        stats = profiler_stats(reset=True)[name]
+        self.assertEqual(stats['count'], 11)
+        self.assertLessEqual(stats['p50'], stats['p99'])
+        self.assertLessEqual(stats['p99'], stats['max'])
+        self.assertAlmostEqual(stats['mean'] * 11, stats['total'])
+        self.assertNotIn(name, profiler_stats())
+
+    def test_job_worker(self):
+        worker = JobWorker('test_job_worker')
+        ran, done = [], threading.Event()
+
+        class Job(ThreadJob):
+            def run(self):
+                ran.append(threading.current_thread())
+                done.set()
+
+        @batch_responses
+        def on_responses(responses):
+            ran.append(responses)
+
+        cb = worker.callback(on_responses)
+        # Network.cancel_requests etc. compare callbacks
+        self.assertEqual(cb, worker.callback(on_responses))
+        self.assertNotEqual(cb, JobWorker('other').callback(on_responses))
+        self.assertTrue(cb.batch_responses)
+        cb([1, 2])  # posted before the worker runs, called once it does
+        job = Job()
+        worker.add_jobs([job])
+        worker.start()
+        try:
+            self.assertTrue(done.wait(5))
+        finally:
+            worker.stop()
+            worker.join(5)
+        self.assertEqual(ran[0], [1, 2])
+        self.assertIs(ran[1], worker)
+        self.assertEqual(worker.get_stats()['calls'], 1)
@@ -0,0 +1,43 @@
+import os
+import random
+import unittest
+
+from .. import ecc_fast
+from ..bitcoin import Hash, hash_encode
+from ..verifier import SPV
+
+
+class TestMerkleRoots(unittest.TestCase):
+
+    def test_hash_merkle_roots(self):
+        rng = random.Random(42)
+        items = []
+        for n in range(200):
+            depth = rng.randrange(16)
+            branch = [hash_encode(os.urandom(32)) for _ in range(depth)]
+            items.append((branch, hash_encode(os.urandom(32)), rng.randrange(1 << depth)))
+        expected = [SPV.hash_merkle_root(*item) for item in items]
+        self.assertEqual(expected, SPV.hash_merkle_roots(items))
+        self.assertEqual([], SPV.hash_merkle_roots([]))
+
+    def test_hash_merkle_roots_known(self):
+        a, b = os.urandom(32), os.urandom(32)
+        # Position 1 is the right child, so the branch hash goes first
+        self.assertEqual([hash_encode(Hash(b + a)), hash_encode(Hash(a + b))],
+                         SPV.hash_merkle_roots([([hash_encode(b)], hash_encode(a), 1),
+                                                ([hash_encode(b)], hash_encode(a), 0)]))
+
+    def test_hash_merkle_roots_malformed(self):
+        with self.assertRaises(ValueError):
+            SPV.hash_merkle_roots([(['00' * 31], '00' * 32, 0)])
+
+    def test_hash_merkle_roots_fallback(self):
+        saved = ecc_fast._secp256k1_merkle_roots, ecc_fast._secp256k1_sha256d64_multi
+        try:
+            ecc_fast._secp256k1_merkle_roots = None
+            self.test_hash_merkle_roots()
+            ecc_fast._secp256k1_sha256d64_multi = None
+            self.test_hash_merkle_roots()
+            self.test_hash_merkle_roots_known()
+        finally:
+            ecc_fast._secp256k1_merkle_roots, ecc_fast._secp256k1_sha256d64_multi = saved
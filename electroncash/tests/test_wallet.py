@@ -4,13 +4,17 @@ import sys
 import unittest
 import os
 import json
+import threading
 
 from io import StringIO
+from unittest import mock
 from ..storage import WalletStorage, FINAL_SEED_VERSION
+from .. import storage as storage_module
 from .. import wallet
 from ..wallet import create_new_wallet, restore_wallet_from_text
 from ..simple_config import SimpleConfig
 from ..address import Address
+from ..util import JobWorker, ThreadJob
 
 
 class FakeSynchronizer(object):
@@ -22,6 +26,18 @@ class FakeSynchronizer(object):
         self.store.append(address)
 
 
+class FakeNetwork(object):
+
+    def __init__(self, local_height):
+        self.local_height = local_height
+
+    def get_local_height(self):
+        return self.local_height
+
+    def trigger_callback(self, event, *args):
+        pass
+
+
 class WalletTestCase(unittest.TestCase):
 
     def setUp(self):
@@ -41,6 +57,28 @@ class WalletTestCase(unittest.TestCase):
         # Restore the "real" stdout
         sys.stdout = self._saved_stdout
 
+    def restore_address_wallet(self):
+        ''' Restores a wallet watching two addresses; returns it and them. '''
+        text = 'qr2q6aadv6nxmqwjt8qmax76yqp09mlqzq5jsz5fe9 qzrseeup3rhehuaf9e6nr3sgm6t5eegufu96l404mu'
+        w = restore_wallet_from_text(text, path=self.wallet_path, config=self.config)['wallet']
+        return (w,) + tuple(w.get_receiving_addresses())
+
+    def receive_history(self, w, history, txo, txi={}):
+        ''' Hands w the address histories in history the way the synchronizer
+        does. The raw txs are left out, so their txo and txi entries, which
+        add_transaction would work out, are given instead. '''
+        for addr, hist in history.items():
+            w.receive_history_callback(addr, hist, {})
+        with w.lock:
+            w.txo.update(txo)
+            w.txi.update(txi)
+
+    def verify_tx(self, w, tx_hash, info):
+        ''' Confirms tx_hash in w as the SPV verifier does; info is
+        (height, timestamp, pos). '''
+        with mock.patch.object(w, 'network', FakeNetwork(w.get_local_height())):
+            w.add_verified_tx(tx_hash, info, None)
+
 
 class TestWalletStorage(WalletTestCase):
 
@@ -73,6 +111,126 @@ class TestWalletStorage(WalletTestCase):
             contents = f.read()
         self.assertEqual(some_dict, json.loads(contents))
 
+    def _journaled_storage(self):
+        storage = WalletStorage(self.wallet_path)
+        storage.put('transactions', {'aa': '01', 'bb': '02', 'cc': '03'})
+        storage.put('labels', {'aa': 'first'})
+        storage.write()
+        return storage
+
+    def test_write_appends_changes_to_journal(self):
+        storage = self._journaled_storage()
+        with open(self.wallet_path, "r") as f:
+            contents = f.read()
+
+        storage.put('transactions', {'aa': '01', 'cc': '33', 'dd': '04'})
+        storage.put('labels', None)
+        storage.put('fiat_value', {'aa': [1, 2]})
+        storage.write()
+        storage.put('transactions', {'aa': '01', 'cc': '33', 'dd': '44'})
+        storage.write()
+
+        # the wallet file itself is untouched, the changes are in the journal
+        with open(self.wallet_path, "r") as f:
+            self.assertEqual(contents, f.read())
+        self.assertTrue(os.path.exists(self.wallet_path + storage_module.JOURNAL_SUFFIX))
+
+        storage2 = WalletStorage(self.wallet_path, manual_upgrades=True)
+        self.assertEqual({'aa': '01', 'cc': '33', 'dd': '44'}, storage2.get('transactions'))
+        self.assertIsNone(storage2.get('labels'))
+        self.assertEqual({'aa': [1, 2]}, storage2.get('fiat_value'))
+        self.assertEqual(storage.data, storage2.data)
+
+    def test_compact_folds_journal_into_file(self):
+        storage = self._journaled_storage()
+        storage.put('transactions', {'aa': '01'})
+        storage.write()
+        storage.compact()
+
+        self.assertFalse(os.path.exists(self.wallet_path + storage_module.JOURNAL_SUFFIX))
+        with open(self.wallet_path, "r") as f:
+            self.assertEqual(storage.data, json.loads(f.read()))
+
+    def test_journal_compacts_when_large(self):
+        storage = self._journaled_storage()
+        saved = storage_module.JOURNAL_COMPACT_MIN_BYTES
+        storage_module.JOURNAL_COMPACT_MIN_BYTES = 0
+        try:
+            storage.put('transactions', {'aa': '01'})
+            storage.write()
+        finally:
+            storage_module.JOURNAL_COMPACT_MIN_BYTES = saved
+        self.assertFalse(os.path.exists(self.wallet_path + storage_module.JOURNAL_SUFFIX))
+        with open(self.wallet_path, "r") as f:
+            self.assertEqual({'aa': '01'}, json.loads(f.read())['transactions'])
+
+    def test_torn_journal_entry_is_dropped(self):
+        storage = self._journaled_storage()
+        storage.put('transactions', {'aa': '01'})
+        storage.write()
+        with open(self.wallet_path + storage_module.JOURNAL_SUFFIX, "ab") as f:
+            f.write(b'[["transactions", {"zz"')
+
+        storage2 = WalletStorage(self.wallet_path, manual_upgrades=True)
+        self.assertEqual({'aa': '01'}, storage2.get('transactions'))
+        # the next write starts over from a full wallet file
+        storage2.put('labels', {'aa': 'second'})
+        storage2.write()
+        self.assertFalse(os.path.exists(self.wallet_path + storage_module.JOURNAL_SUFFIX))
+        storage3 = WalletStorage(self.wallet_path, manual_upgrades=True)
+        self.assertEqual(storage2.data, storage3.data)
+
+    def test_stale_journal_is_ignored(self):
+        storage = self._journaled_storage()
+        storage.put('transactions', {'aa': '01'})
+        storage.write()
+        # a journal left over from a wallet file that has since been replaced
+        with open(self.wallet_path, "w") as f:
+            f.write(json.dumps({'seed_version': FINAL_SEED_VERSION, 'labels': {}}))
+
+        storage2 = WalletStorage(self.wallet_path, manual_upgrades=True)
+        self.assertIsNone(storage2.get('transactions'))
+        self.assertEqual({}, storage2.get('labels'))
+
+    def test_binary_tables_roundtrip(self):
+        tx1, tx2 = 'ab' * 32, 'cd' * 32
+        tables = {
+            'transactions': {tx1: '0100', tx2: '0200ff'},
+            'txi': {tx2: {'1addr': [[tx1 + ':0', 5000]]}},
+            'txo': {tx1: {'1addr': [[0, 5000, False]], '1other': [[1, 7, True]]}},
+            'verified_tx3': {tx1: [100, 1600000000, 3]},
+            'addr_history': {'1addr': [[tx1, 100], [tx2, 0]], '1other': [[tx1, 100]]},
+        }
+        storage = WalletStorage(self.wallet_path)
+        storage.put('seed_version', FINAL_SEED_VERSION)
+        for key, value in tables.items():
+            storage.put(key, value)
+        storage.set_binary_tables(True)
+        storage.write()
+
+        with open(self.wallet_path, "r") as f:
+            on_disk = json.loads(f.read())
+        self.assertEqual(storage_module.BINARY_TABLES_SEED_VERSION, on_disk['seed_version'])
+        self.assertIn(storage_module.BINARY_TABLES_KEY, on_disk)
+        self.assertFalse(set(tables) & set(on_disk))
+
+        storage2 = WalletStorage(self.wallet_path, manual_upgrades=True)
+        self.assertEqual(storage.data, storage2.data)
+        self.assertEqual(FINAL_SEED_VERSION, storage2.get('seed_version'))
+
+        # later changes still go to the journal, and switching back to JSON
+        # rewrites the file
+        storage2.put('verified_tx3', {})
+        storage2.write()
+        storage3 = WalletStorage(self.wallet_path, manual_upgrades=True)
+        self.assertEqual({}, storage3.get('verified_tx3'))
+        storage3.set_binary_tables(False)
+        storage3.write()
+        with open(self.wallet_path, "r") as f:
+            on_disk = json.loads(f.read())
+        self.assertEqual(FINAL_SEED_VERSION, on_disk['seed_version'])
+        self.assertEqual(tables['txo'], on_disk['txo'])
+
 class TestCreateRestoreWallet(WalletTestCase):
 
     def test_create_new_wallet(self):
@@ -136,4 +294,189 @@ class TestCreateRestoreWallet(WalletTestCase):
         self.assertEqual(Address.from_string('qzrseeup3rhehuaf9e6nr3sgm6t5eegufu96l404mu'), addr0)
         self.assertEqual('Kz7FS9Adyj6RgSVGx5YLjZPanUhuze4yvcziZ1qLA24a3GJJZvBr',
                          wallet.export_private_key(addr0, password=None))
-        self.assertEqual(1, len(wallet.get_receiving_addresses()))
\ No newline at end of file
+        self.assertEqual(1, len(wallet.get_receiving_addresses()))
+
+class TestJobWorkerWrites(WalletTestCase):
+
+    def test_sync_on_worker_writes_wallet(self):
+        # The synchronizer runs on the wallet's JobWorker; when it finishes
+        # set_up_to_date() must get the synced state onto disk from there.
+        d = restore_wallet_from_text('qr2q6aadv6nxmqwjt8qmax76yqp09mlqzq5jsz5fe9',
+                                     path=self.wallet_path, config=self.config)
+        w = d['wallet']
+        done = threading.Event()
+
+        class SyncDone(ThreadJob):
+            def run(self):
+                if not done.is_set():
+                    w.storage.put('stored_height', 1234)
+                    w.set_up_to_date(True)
+                    done.set()
+
+        worker = JobWorker('test_worker_writes')
+        worker.add_jobs([SyncDone()])
+        worker.start()
+        try:
+            self.assertTrue(done.wait(5))
+        finally:
+            worker.stop()
+            worker.join(5)
+        self.assertEqual(1234, WalletStorage(self.wallet_path, manual_upgrades=True).get('stored_height'))
+
+
+class TestAddressBalanceIndex(WalletTestCase):
+
+    def test_balance_index(self):
+        w, addr0, addr1 = self.restore_address_wallet()
+        a, b = 'aa' * 32, 'bb' * 32
+        # a confirmed coin on addr0, and a confirmed plus an unconfirmed one on addr1
+        self.receive_history(w, {addr0: [(a, 100)], addr1: [(a, 100), (b, 0)]},
+                             {a: {addr0: [(0, 1000, False)], addr1: [(1, 200, False)]},
+                              b: {addr1: [(0, 30, False)]}})
+        self.assertEqual(w.get_balance(), (1200, 30, 0))
+        # the index totals agree with adding up the addresses one by one
+        self.assertEqual(w.get_balance([addr0, addr1]), (1200, 30, 0))
+        self.assertEqual(w.get_addr_balance(addr1), (200, 30, 0))
+
+        # freezing a coin changes its address' entry; the totals follow
+        w.set_frozen_coin_state([b + ':0'], True)
+        self.assertEqual(w.get_balance(exclude_frozen_coins=True), (1200, 0, 0))
+        self.assertEqual(w.get_addr_balance(addr1, exclude_frozen_coins=True), (200, 0, 0))
+        self.assertEqual(w.get_frozen_balance(), (0, 30, 0))
+        w.set_frozen_state([addr0], True)
+        self.assertEqual(w.get_balance(exclude_frozen_addresses=True), (200, 30, 0))
+        self.assertEqual(w.get_balance(exclude_frozen_coins=True, exclude_frozen_addresses=True), (200, 0, 0))
+
+        # the snapshot leaves out the entry with a frozen coin, and a reload
+        # gives the same balances
+        w.save_transactions(write=True)
+        index = WalletStorage(self.wallet_path).get('addr_balance_index')
+        self.assertEqual(set(index['entries']), {addr0.to_storage_string()})
+        w2 = wallet.Wallet(WalletStorage(self.wallet_path))
+        self.assertEqual(w2.get_balance(), (1200, 30, 0))
+        self.assertEqual(w2.get_balance(exclude_frozen_coins=True), (1200, 0, 0))
+
+        # a reloaded wallet takes its balances from the snapshot, unless the
+        # snapshot was of other transactions
+        for ntx, balance in ((index['ntx'], (5, 0, 0)), (index['ntx'] + 1, (1000, 0, 0))):
+            storage = WalletStorage(self.wallet_path)
+            storage.put('addr_balance_index', {'ntx': ntx, 'entries': {addr0.to_storage_string(): [5, 0, 0, 0, 0, 0]}})
+            storage.write()
+            self.assertEqual(wallet.Wallet(WalletStorage(self.wallet_path)).get_addr_balance(addr0), balance)
+
+
+class TestHistoryCache(WalletTestCase):
+
+    def assertHistoryMatches(self, w):
+        # the cached whole-wallet history is the one computed over all addresses
+        for reverse in (False, True):
+            for rbs in (False, True):
+                h = w.get_history(w.get_addresses(), reverse=reverse, receives_before_sends=rbs)
+                self.assertEqual(w.get_history(reverse=reverse, receives_before_sends=rbs), h)
+                self.assertEqual(w.get_history_page(1, 3, reverse=reverse, receives_before_sends=rbs), (len(h), h[1:3]))
+
+    def test_history_cache(self):
+        w, addr0, addr1 = self.restore_address_wallet()
+        a, b, c, d = ('%02x' % i * 32 for i in range(4))
+        # a pays addr0, b spends that to addr1 with a fee, c is unconfirmed
+        self.receive_history(w, {addr0: [(a, 100), (b, 101)], addr1: [(b, 101), (c, 0)]},
+                             {a: {addr0: [(0, 1000, False)]},
+                              b: {addr1: [(0, 600, False)]},
+                              c: {addr1: [(0, 50, False)]}},
+                             {b: {addr0: [(a + ':0', 1000)]}})
+        self.verify_tx(w, a, (100, 1, 1))
+        self.verify_tx(w, b, (101, 2, 0))
+        self.assertHistoryMatches(w)
+        self.assertEqual([(item.tx_hash, item.amount, item.balance) for item in w.get_history()],
+                         [(a, 1000, 1000), (b, -400, 600), (c, 50, 650)])
+
+        # c is mined in a's block; until it is verified its position in the
+        # block is unknown, so it sorts first, and verifying it moves it
+        self.receive_history(w, {addr1: [(b, 101), (c, 100)]}, {c: {addr1: [(0, 50, False)]}})
+        self.assertHistoryMatches(w)
+        self.assertEqual([item.tx_hash for item in w.get_history()], [c, a, b])
+        self.verify_tx(w, c, (100, 1, 2))
+        self.assertHistoryMatches(w)
+        self.assertEqual([item.tx_hash for item in w.get_history()], [a, c, b])
+
+        # d arrives unconfirmed, then confirms before all the others
+        self.receive_history(w, {addr1: [(b, 101), (c, 100), (d, 0)]},
+                             {d: {addr1: [(1, 7, False)]}})
+        self.assertHistoryMatches(w)
+        self.assertEqual([item.tx_hash for item in w.get_history()], [a, c, b, d])
+        self.receive_history(w, {addr1: [(b, 101), (c, 100), (d, 100)]}, {d: {addr1: [(1, 7, False)]}})
+        self.verify_tx(w, d, (100, 1, 0))
+        self.assertHistoryMatches(w)
+        self.assertEqual([(item.tx_hash, item.balance) for item in w.get_history()],
+                         [(d, 7), (a, 1007), (c, 1057), (b, 657)])
+
+        # b's delta becomes unknown, and so do the balances before it
+        w.pruned_txo_values.add(b)
+        self.assertHistoryMatches(w)
+        self.assertEqual([item.balance for item in w.get_history()], [None, None, None, 657])
+        w.pruned_txo_values.discard(b)
+        w.clear_history()
+        self.assertEqual(w.get_history(), [])
+
+
+class TestLazyTxTable(unittest.TestCase):
+
+    def test_lazy_tx_table(self):
+        raws = {'%064x' % i: '%02x' % i * 10 for i in range(10)}
+        hashes = list(raws)
+        t = wallet.LazyTxTable(raws, max_live=3)
+        with mock.patch.object(wallet, 'Transaction', side_effect=wallet.Transaction) as Transaction:
+            self.assertEqual(len(t), 10)
+            self.assertEqual(t.raw_items(), list(raws.items()))
+            self.assertEqual(t.get_raw(hashes[0]), raws[hashes[0]])
+            self.assertEqual(Transaction.call_count, 0)  # nothing materialized yet
+            txs = [t[h] for h in hashes]
+            self.assertEqual(Transaction.call_count, 10)
+        self.assertEqual([tx.raw for tx in txs], list(raws.values()))
+        # the last 3 looked at are still live, the others were evicted and
+        # come back as new objects, each evicting the least recently used
+        self.assertIs(t[hashes[9]], txs[9])
+        self.assertIs(t[hashes[7]], txs[7])
+        self.assertIsNot(t[hashes[0]], txs[0])
+        self.assertEqual(t[hashes[0]].raw, raws[hashes[0]])
+        self.assertIsNot(t[hashes[8]], txs[8])
+        self.assertIs(t[hashes[7]], txs[7])
+        self.assertEqual(t.get_raw(hashes[9]), raws[hashes[9]])
+        del t[hashes[9]]
+        self.assertNotIn(hashes[9], t)
+        self.assertIsNone(t.get(hashes[9]))
+        self.assertEqual(len(t), 9)
+        t.clear()
+        self.assertEqual(len(t), 0)
+
+
+class TestUtxoIndex(WalletTestCase):
+
+    def test_iter_utxos(self):
+        w, addr0, addr1 = self.restore_address_wallet()
+        a, b = 'aa' * 32, 'bb' * 32
+        self.receive_history(w, {addr0: [(a, 100)], addr1: [(a, 100), (b, 0)]},
+                             {a: {addr0: [(0, 1000, False), (1, 20, False)], addr1: [(2, 300, False)]},
+                              b: {addr1: [(0, 5, False)]}})
+        self.verify_tx(w, a, (100, 1, 0))
+        def txos(coins):
+            return [c['prevout_hash'] + ':%d' % c['prevout_n'] for c in coins]
+        self.assertEqual(txos(w.get_utxos()), [a + ':0', a + ':1', a + ':2', b + ':0'])
+        self.assertEqual(txos(w.iter_utxos(min_value=100)), [a + ':0', a + ':2'])
+        self.assertEqual(txos(w.iter_utxos(min_height=1)), [a + ':0', a + ':1', a + ':2'])
+        self.assertEqual(txos(w.iter_utxos(max_height=0)), [b + ':0'])
+        self.assertEqual(txos(w.get_utxos(confirmed_only=True)), txos(w.iter_utxos(min_height=1)))
+        addrs = set()
+        self.assertEqual(txos(w.iter_utxos(min_value=500, addr_set_out=addrs)), [a + ':0'])
+        self.assertEqual(addrs, {addr0})
+
+        # frozen state needs no invalidation
+        w.set_frozen_coin_state([a + ':0'], True)
+        self.assertEqual(txos(w.get_utxos(exclude_frozen=True)), [a + ':1', a + ':2', b + ':0'])
+        self.assertTrue(w.get_utxos()[0]['is_frozen_coin'])
+        w.set_frozen_state([addr1], True)
+        self.assertEqual(txos(w.get_utxos(exclude_frozen=True)), [a + ':1'])
+
+        # a history change does
+        self.receive_history(w, {addr0: [(a, 100), (b, 0)]}, {}, {b: {addr0: [(a + ':1', 20)]}})
+        self.assertEqual(txos(w.get_utxos()), [a + ':0', a + ':2', b + ':0'])
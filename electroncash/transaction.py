@@ -28,14 +28,18 @@
 # Note: The deserialization code originally comes from ABE.
 
 from .util import print_error, profiler
-from .caches import ExpiringCache
+from .caches import ByteBudgetCache
 
 from .bitcoin import *
 from .address import (PublicKey, Address, Script, ScriptOutput, hash160,
                       UnknownAddress, OpCodes as opcodes,
                       P2PKH_prefix, P2PKH_suffix, P2SH_prefix, P2SH_suffix)
+from . import ecc_fast
 from . import schnorr
+from . import secp256k1
 from . import util
+from ctypes import byref, c_char_p, c_size_t, c_void_p, create_string_buffer
+import hashlib
 import struct
 import warnings
 
@@ -297,11 +301,20 @@ def get_address_from_output_script(_bytes):
 
 
 def parse_input(vds):
-    d = {}
-    prevout_hash = hash_encode(vds.read_bytes(32))
+    prevout_hash = vds.read_bytes(32)
     prevout_n = vds.read_uint32()
     scriptSig = vds.read_bytes(vds.read_compact_size())
     sequence = vds.read_uint32()
+    d = make_input(prevout_hash, prevout_n, scriptSig, sequence)
+    if not Transaction.is_txin_complete(d):
+        del d['scriptSig']
+        d['value'] = vds.read_uint64()
+    return d
+
+
+def make_input(prevout_hash_bytes, prevout_n, scriptSig, sequence):
+    d = {}
+    prevout_hash = hash_encode(prevout_hash_bytes)
     d['prevout_hash'] = prevout_hash
     d['prevout_n'] = prevout_n
     d['sequence'] = sequence
@@ -328,16 +341,18 @@ def parse_input(vds):
             # override these once more just to make sure
             d['address'] = UnknownAddress()
             d['type'] = 'unknown'
-        if not Transaction.is_txin_complete(d):
-            del d['scriptSig']
-            d['value'] = vds.read_uint64()
     return d
 
 
 def parse_output(vds, i):
-    d = {}
-    d['value'] = vds.read_int64()
+    value = vds.read_int64()
     scriptPubKey = vds.read_bytes(vds.read_compact_size())
+    return make_output(value, scriptPubKey, i)
+
+
+def make_output(value, scriptPubKey, i):
+    d = {}
+    d['value'] = value
     d['type'], d['address'] = get_address_from_output_script(scriptPubKey)
     d['scriptPubKey'] = bh2u(scriptPubKey)
     d['prevout_n'] = i
@@ -345,8 +360,18 @@ def parse_output(vds, i):
 
 
 def deserialize(raw):
+    return _deserialize(bfh(raw))[0]
+
+
+def _deserialize(raw_bytes, *, inputs=True):
+    ''' Returns the deserialized dict and the txid of raw_bytes if it was
+    computed along the way, else None. With inputs=False, d['inputs'] is None
+    if the inputs could be skipped. '''
+    res = _deserialize_fast(raw_bytes, inputs=inputs)
+    if res is not None:
+        return res
     vds = BCDataStream()
-    vds.write(bfh(raw))
+    vds.write(raw_bytes)
     d = {}
     start = vds.read_cursor
     d['version'] = vds.read_int32()
@@ -357,7 +382,54 @@ def deserialize(raw):
     d['lockTime'] = vds.read_uint32()
     if vds.can_read_more():
         raise SerializationError('extra junk at the end')
-    return d
+    return d, None
+
+
+_secp256k1_tx_parse = secp256k1.bind('secp256k1_tx_parse', [ c_void_p, c_void_p, c_void_p, c_void_p, c_size_t, c_char_p, c_char_p, c_size_t ])
+
+def has_fast_deserialize():
+    """Does deserialize() find the fields of a tx natively?"""
+    return bool(_secp256k1_tx_parse)
+
+def _deserialize_fast(raw_bytes, *, inputs=True):
+    ''' deserialize using the field offsets secp256k1_tx_parse finds in
+    raw_bytes, reading scripts straight out of it rather than through a
+    BCDataStream. Returns (d, txid), or None if the lib lacks the function or
+    raw_bytes is not a plain serialized tx. Our own partially signed txs are
+    not: their incomplete inputs carry a value, which only parse_input knows
+    how to read. '''
+    if not _secp256k1_tx_parse:
+        return None
+    nfields = len(raw_bytes) // 3 + 3
+    fields = (c_size_t * nfields)()
+    ninputs, noutputs = c_size_t(0), c_size_t(0)
+    txid = create_string_buffer(32)
+    if not _secp256k1_tx_parse(secp256k1.secp256k1.ctx, byref(ninputs), byref(noutputs),
+                               fields, nfields, txid, raw_bytes, len(raw_bytes)):
+        return None
+    ninputs, noutputs = ninputs.value, noutputs.value
+    fields = fields[:3 * (ninputs + noutputs)]  # as a list, which indexes much faster
+    unpack_from = struct.unpack_from
+    d = {}
+    d['version'], = unpack_from('<i', raw_bytes, 0)
+    if inputs:
+        d['inputs'] = []
+        for k in range(0, 3 * ninputs, 3):
+            start, script_start, script_end = fields[k], fields[k+1], fields[k+1] + fields[k+2]
+            txin = make_input(raw_bytes[start:start+32], unpack_from('<I', raw_bytes, start+32)[0],
+                              raw_bytes[script_start:script_end], unpack_from('<I', raw_bytes, script_end)[0])
+            if not Transaction.is_txin_complete(txin):
+                return None
+            d['inputs'].append(txin)
+    else:
+        d['inputs'] = None
+    d['outputs'] = []
+    for i, k in enumerate(range(3 * ninputs, 3 * (ninputs + noutputs), 3)):
+        start, script_start, script_end = fields[k], fields[k+1], fields[k+1] + fields[k+2]
+        d['outputs'].append(make_output(unpack_from('<q', raw_bytes, start)[0],
+                                        raw_bytes[script_start:script_end], i))
+    d['lockTime'], = unpack_from('<I', raw_bytes, len(raw_bytes) - 4)
+    return d, bh2u(txid.raw[::-1])
 
 
 # pay & redeem scripts
@@ -381,7 +453,7 @@ class Transaction:
             self.raw = self.serialize()
         return self.raw
 
-    def __init__(self, raw, sign_schnorr=False):
+    def __init__(self, raw, sign_schnorr=False, *, lazy=False):
         if raw is None:
             self.raw = None
         elif isinstance(raw, str):
@@ -395,6 +467,12 @@ class Transaction:
         self.locktime = 0
         self.version = 1
         self._sign_schnorr = sign_schnorr
+        # With lazy set, outputs() decodes only the outputs, leaving the
+        # inputs (whose scriptSigs are the costly part) for when they are
+        # asked for. Only meant for txs that are read, never modified.
+        self._lazy = lazy
+        # (raw, txid) as found by the last native deserialize, see txid_fast
+        self._raw_txid = None
 
         # attribute used by HW wallets to tell the hw keystore about any outputs
         # in the tx that are to self (change), etc. See wallet.py add_hw_info
@@ -436,9 +514,16 @@ class Transaction:
 
     def outputs(self):
         if self._outputs is None:
-            self.deserialize()
+            if self._lazy and self.raw is not None and self._inputs is None:
+                self._deserialize_outputs()
+            else:
+                self.deserialize()
         return self._outputs
 
+    def _deserialize_outputs(self):
+        d, txid = _deserialize(bfh(self.raw), inputs=False)
+        self._set_deserialized(d, txid)
+
     @classmethod
     def get_sorted_pubkeys(self, txin):
         # sort pubkeys and x_pubkeys, using the order of pubkeys
@@ -520,7 +605,11 @@ class Transaction:
             return
         if self._inputs is not None:
             return
-        d = deserialize(self.raw)
+        d, txid = _deserialize(bfh(self.raw))
+        self._set_deserialized(d, txid)
+        return d
+
+    def _set_deserialized(self, d, txid):
         self.invalidate_common_sighash_cache()
         self._inputs = d['inputs']
         self._outputs = [(x['type'], x['address'], x['value']) for x in d['outputs']]
@@ -528,7 +617,8 @@ class Transaction:
                    for output in self._outputs)
         self.locktime = d['lockTime']
         self.version = d['version']
-        return d
+        if txid is not None:
+            self._raw_txid = self.raw, txid
 
     @classmethod
     def from_io(klass, inputs, outputs, locktime=0, sign_schnorr=False):
@@ -756,13 +846,49 @@ class Transaction:
 
     def serialize_preimage(self, i, nHashType=0x00000041, use_cache = False):
         """ See `.calc_common_sighash` for explanation of use_cache feature """
+        prefix, suffix = self._preimage_affixes(nHashType, use_cache=use_cache)
+        return bh2u(prefix + self._preimage_middle(i) + suffix)
+
+    def calc_sighashes(self, indices, nHashType=0x00000041, use_cache=False):
+        """ Return the signature hashes (the sha256d of `serialize_preimage`) of
+        the inputs at `indices`, as a list of 32-long bytes objects.
+
+        The preimages of all inputs share their first and last parts, so the
+        hash state after the shared prefix is computed once and reused for
+        every input. See `.calc_common_sighash` for explanation of use_cache
+        feature """
+        prefix, suffix = self._preimage_affixes(nHashType, use_cache=use_cache)
+        middles = [self._preimage_middle(i) for i in indices]
+        hashes = ecc_fast.sha256d_affixed_multi(prefix, middles, suffix)
+        if hashes is None:
+            midstate = hashlib.sha256(prefix)
+            hashes = []
+            for middle in middles:
+                h = midstate.copy()
+                h.update(middle)
+                h.update(suffix)
+                hashes.append(hashlib.sha256(h.digest()).digest())
+        return hashes
+
+    def _preimage_affixes(self, nHashType, use_cache=False):
+        """ The parts of the sighash preimage that are the same for every
+        input, as bytes: (prefix, suffix) """
         if (nHashType & 0xff) != 0x41:
             raise ValueError("other hashtypes not supported; submit a PR to fix this!")
 
-        nVersion = int_to_hex(self.version, 4)
-        nHashType = int_to_hex(nHashType, 4)
-        nLocktime = int_to_hex(self.locktime, 4)
+        hashPrevouts, hashSequence, hashOutputHashes, hashOutputs = self.calc_common_sighash(use_cache = use_cache)
+
+        nVersion = bfh(int_to_hex(self.version, 4))
+        nLocktime = bfh(int_to_hex(self.locktime, 4))
+        nHashType = bfh(int_to_hex(nHashType, 4))
 
+        prefix = nVersion + hashPrevouts + hashSequence
+        suffix = hashOutputHashes + hashOutputs + nLocktime + nHashType
+        return prefix, suffix
+
+    def _preimage_middle(self, i):
+        """ The part of the sighash preimage that is specific to input i, as
+        bytes """
         txin = self.inputs()[i]
         outpoint = self.serialize_outpoint(txin)
         preimage_script = self.get_preimage_script(txin)
@@ -772,11 +898,7 @@ class Transaction:
         except KeyError:
             raise InputValueMissing
         nSequence = int_to_hex(txin.get('sequence', 0xffffffff - 1), 4)
-
-        hashPrevouts, hashSequence, hashOutputHashes, hashOutputs = self.calc_common_sighash(use_cache = use_cache)
-
-        preimage = nVersion + bh2u(hashPrevouts) + bh2u(hashSequence) + outpoint + scriptCode + amount + nSequence + bh2u(hashOutputHashes) + bh2u(hashOutputs) + nLocktime + nHashType
-        return preimage
+        return bfh(outpoint + scriptCode + amount + nSequence)
 
 
     def rpa_paycode_swap_dummy_for_destination(self, rpa_dummy_address, rpa_destination_address):
@@ -832,6 +954,9 @@ class Transaction:
         (The is_complete check is also not performed here because that
         potentially can lead to unwanted tx deserialization). '''
         if self.raw:
+            if self._raw_txid is not None and self._raw_txid[0] is self.raw:
+                # hashed while deserializing this very raw
+                return self._raw_txid[1]
             return self._txid(self.raw)
         return self.txid()
 
@@ -937,12 +1062,17 @@ class Transaction:
 
 
     @staticmethod
-    def _ecdsa_sign(sec, pre_hash):
+    def _ecdsa_sign(sec, pre_hash, *, grind=None):
         pkey = regenerate_key(sec)
         secexp = pkey.secret
         private_key = MySigningKey.from_secret_exponent(secexp, curve = SECP256k1)
         public_key = private_key.get_verifying_key()
-        sig = private_key.sign_digest_deterministic(pre_hash, hashfunc=hashlib.sha256, sigencode = ecdsa.util.sigencode_der)
+        # grind: True for a low R, or the largest DER length to accept. Without
+        # native grinding the signature is made as usual; it is just bigger.
+        sig = grind and ecc_fast.ecdsa_sign_grind(
+            sec, pre_hash, ecc_fast.GRIND_LOW_R_DER_LEN if grind is True else grind)
+        if not sig:
+            sig = private_key.sign_digest_deterministic(pre_hash, hashfunc=hashlib.sha256, sigencode = ecdsa.util.sigencode_der)
         assert public_key.verify_digest(sig, pre_hash, sigdecode = ecdsa.util.sigdecode_der)
         return sig
 
@@ -954,11 +1084,16 @@ class Transaction:
         return sig
 
 
-    def sign(self, keypairs, *, use_cache=False, ndata=None):
+    def sign(self, keypairs, *, use_cache=False, ndata=None, grind=None):
+        # Schnorr signatures are queued per key and made in one
+        # schnorr.sign_batch call, so that each key is only loaded once.
+        # grind only applies to ECDSA; Schnorr signatures are always 64 bytes.
+        schnorr_jobs = {}
         for i, txin in enumerate(self.inputs()):
             pubkeys, x_pubkeys = self.get_sorted_pubkeys(txin)
+            queued = 0
             for j, (pubkey, x_pubkey) in enumerate(zip(pubkeys, x_pubkeys)):
-                if self.is_txin_complete(txin):
+                if self.is_txin_complete(txin) or (queued and self._txin_sig_count(txin) + queued >= txin.get('num_sig', 1)):
                     # txin is complete
                     break
                 if pubkey in keypairs:
@@ -971,20 +1106,50 @@ class Transaction:
                     continue
                 print_error(f"adding signature for input#{i} sig#{j}; {kname}: {_pubkey} schnorr: {self._sign_schnorr}")
                 sec, compressed = keypairs.get(_pubkey)
-                self._sign_txin(i, j, sec, compressed, use_cache=use_cache,ndata=ndata)
+                if self._sign_schnorr:
+                    schnorr_jobs.setdefault((sec, compressed), []).append((i, j))
+                    queued += 1
+                else:
+                    self._sign_txin(i, j, sec, compressed, use_cache=use_cache,ndata=ndata, grind=grind)
+        for (sec, compressed), jobs in schnorr_jobs.items():
+            self._schnorr_sign_txins(jobs, sec, compressed, use_cache=use_cache, ndata=ndata)
         print_error("is_complete", self.is_complete())
         self.raw = self.serialize()
 
-    def _sign_txin(self, i, j, sec, compressed, *, use_cache=False,ndata=None):
+    @staticmethod
+    def _txin_sig_count(txin):
+        return len(list(filter(None, txin.get('signatures', []))))
+
+    def _schnorr_sign_txins(self, jobs, sec, compressed, *, use_cache=False, ndata=None):
+        '''Schnorr-sign the (input index, signature index) pairs in `jobs`, all
+        with the key `sec`, in one batch. Same result as calling _sign_txin on
+        each of them with the tx set to sign Schnorr.'''
+        pubkey = public_key_from_private_key(sec, compressed)
+        pubkey_bytes = bfh(pubkey)
+        nHashType = 0x00000041 # hardcoded, perhaps should be taken from unsigned input dict
+        pre_hashes = self.calc_sighashes([i for i, j in jobs], nHashType, use_cache=use_cache)
+        sigs = schnorr.sign_batch(sec, pre_hashes, ndata=ndata, pubkey=pubkey_bytes)
+        # verify what we just signed; only look at each one if the batch fails
+        all_good = schnorr.verify_batch([pubkey_bytes] * len(sigs), sigs, pre_hashes)
+        for (i, j), sig, pre_hash in zip(jobs, sigs, pre_hashes):
+            reason = []
+            if not all_good and not self.verify_signature(pubkey_bytes, sig, pre_hash, reason=reason):
+                print_error(f"Signature verification failed for input#{i} sig#{j}, reason: {str(reason)}")
+                continue
+            txin = self._inputs[i]
+            txin['signatures'][j] = bh2u(sig + bytes((nHashType & 0xff,)))
+            txin['pubkeys'][j] = pubkey # needed for fd keys
+
+    def _sign_txin(self, i, j, sec, compressed, *, use_cache=False,ndata=None, grind=None):
         '''Note: precondition is self._inputs is valid (ie: tx is already deserialized)'''
         pubkey = public_key_from_private_key(sec, compressed)
         # add signature
         nHashType = 0x00000041 # hardcoded, perhaps should be taken from unsigned input dict
-        pre_hash = Hash(bfh(self.serialize_preimage(i, nHashType, use_cache=use_cache)))
+        pre_hash = self.calc_sighashes([i], nHashType, use_cache=use_cache)[0]
         if self._sign_schnorr:
             sig = self._schnorr_sign(pubkey, sec, pre_hash, ndata=ndata)
         else:
-            sig = self._ecdsa_sign(sec, pre_hash)
+            sig = self._ecdsa_sign(sec, pre_hash, grind=grind)
         reason = []
         if not self.verify_signature(bfh(pubkey), sig, pre_hash, reason=reason):
             print_error(f"Signature verification failed for input#{i} sig#{j}, reason: {str(reason)}")
@@ -1025,19 +1190,16 @@ class Transaction:
         return out
 
     # This cache stores foreign (non-wallet) tx's we fetched from the network
-    # for the purposes of the "fetch_input_data" mechanism. Its max size has
-    # been thoughtfully calibrated to provide a decent tradeoff between
-    # memory consumption and UX.
-    #
-    # In even aggressive/pathological cases this cache won't ever exceed
-    # 100MB even when full. [see ExpiringCache.size_bytes() to test it].
-    # This is acceptable considering this is Python + Qt and it eats memory
-    # anyway.. and also this is 2019 ;). Note that all tx's in this cache
-    # are in the non-deserialized state (hex encoded bytes only) as a memory
-    # savings optimization.  Please maintain that invariant if you modify this
-    # code, otherwise the cache may grow to 10x memory consumption if you
-    # put deserialized tx's in here.
-    _fetched_tx_cache = ExpiringCache(maxlen=1000, name="TransactionFetchCache")
+    # for the purposes of the "fetch_input_data" mechanism, as raw bytes keyed
+    # on txid. It is bounded by the bytes it holds, not by the number of tx's,
+    # so a few huge tx's can't blow it up and many small ones can all fit.
+    # Its hit/miss/eviction counts are reported by the `txcachestats`
+    # command, to help size it (see tx_cache_set_max_bytes) for big wallets.
+    # Please keep deserialized tx's out of this cache.
+    _fetched_tx_cache = ByteBudgetCache(max_bytes=16 * 1024 * 1024, name="TransactionFetchCache")
+    # Behind the in-memory cache sits the on-disk RawTxStore shared by all
+    # wallets, if the Network opened one (see tx_cache_set_store).
+    _tx_store = None
 
     def fetch_input_data(self, wallet, done_callback=None, done_args=tuple(),
                          prog_callback=None, *, force=False, use_network=True):
@@ -1137,10 +1299,12 @@ class Transaction:
                             # several times the memory when deserialized due to
                             # Python's memory use being less efficient than the
                             # binary-only raw bytes.  So if you modify this code
-                            # do bear that in mind.
-                            tx = Transaction(tx.raw)
+                            # do bear that in mind. Only the outputs are
+                            # needed, so the copy is lazy and never decodes
+                            # its inputs.
+                            tx = Transaction(tx.raw, lazy=True)
                             try:
-                                tx.deserialize()
+                                tx.outputs()
                                 # The below txid check is commented-out as
                                 # we trust wallet tx's and the network
                                 # tx's that fail this check are never
@@ -1202,7 +1366,7 @@ class Transaction:
                             tx = Transaction(r['result'])
                             txid = r['params'][0]
                             assert txid == cls._txid(tx.raw), "txid-is-sane-check"  # protection against phony responses
-                            cls.tx_cache_put(tx=tx, txid=txid)  # save tx to cache here
+                            cls.tx_cache_put(tx=tx, txid=txid, persist=wallet.may_store_txs())  # save tx to cache here
                         except Exception as e:
                             # response was not valid, ignore (don't cache)
                             if txid:  # txid may be '' if KeyError from r['result'] above
@@ -1323,23 +1487,45 @@ class Transaction:
     def tx_cache_get(cls, txid : str) -> object:
         ''' Attempts to retrieve txid from the tx cache that this class
         keeps in-memory.  Returns None on failure. The returned tx is
-        not deserialized, and is a copy of the one in the cache. '''
-        tx = cls._fetched_tx_cache.get(txid)
-        if tx is not None and tx.raw:
-            # make sure to return a copy of the transaction from the cache
-            # so that if caller does .deserialize(), *his* instance will
-            # use up 10x memory consumption, and not the cached instance which
-            # should just be an undeserialized raw tx.
-            return Transaction(tx.raw)
+        not deserialized, and is a new instance made from the cached raw
+        bytes. '''
+        raw = cls._fetched_tx_cache.get(txid)
+        if raw is None and cls._tx_store is not None:
+            raw = cls._tx_store.get(txid)
+            if raw is not None:
+                cls._fetched_tx_cache.put(txid, raw)
+        if raw is not None:
+            return Transaction(raw.hex())
         return None
 
     @classmethod
-    def tx_cache_put(cls, tx : object, txid : str = None):
-        ''' Puts a non-deserialized copy of tx into the tx_cache. '''
+    def tx_cache_put(cls, tx : object, txid : str = None, *, persist : bool = True):
+        ''' Puts the raw bytes of tx into the tx_cache, and into the on-disk
+        store if there is one and persist is True. '''
         if not tx or not tx.raw:
             raise ValueError('Please pass a tx which has a valid .raw attribute!')
         txid = txid or cls._txid(tx.raw)  # optionally, caller can pass-in txid to save CPU time for hashing
-        cls._fetched_tx_cache.put(txid, Transaction(tx.raw))
+        raw = bfh(tx.raw)
+        cls._fetched_tx_cache.put(txid, raw)
+        if persist and cls._tx_store is not None:
+            cls._tx_store.put(raw)
+
+    @classmethod
+    def tx_cache_set_store(cls, store):
+        ''' Sets the on-disk RawTxStore consulted on tx_cache misses and
+        written through by tx_cache_put. Pass None to detach it. '''
+        cls._tx_store = store
+
+    @classmethod
+    def tx_cache_stats(cls) -> dict:
+        ''' Returns the size and hit/miss/eviction counts of the tx_cache. '''
+        return cls._fetched_tx_cache.stats()
+
+    @classmethod
+    def tx_cache_set_max_bytes(cls, max_bytes : int):
+        ''' Changes the memory budget of the tx_cache, evicting the least
+        recently used tx's if it is now over it. '''
+        cls._fetched_tx_cache.set_max_bytes(max_bytes)
 
 
 def tx_from_str(txt):
@@ -0,0 +1,299 @@
+#!/usr/bin/env python3
+#
+# Electron Cash - lightweight Bitcoin client
+# Copyright (C) 2017-2022 The Electron Cash Developers
+#
+# Permission is hereby granted, free of charge, to any person
+# obtaining a copy of this software and associated documentation files
+# (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge,
+# publish, distribute, sublicense, and/or sell copies of the Software,
+# and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be
+# included in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+# BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+# ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+import mmap
+import os
+import struct
+import threading
+from contextlib import contextmanager
+from typing import Optional
+
+from .bitcoin import Hash
+from .util import PrintError
+
+if os.name == 'nt':
+    import msvcrt
+
+    def _lock_file(f):
+        f.seek(0)
+        msvcrt.locking(f.fileno(), msvcrt.LK_LOCK, 1)
+
+    def _unlock_file(f):
+        f.seek(0)
+        msvcrt.locking(f.fileno(), msvcrt.LK_UNLCK, 1)
+else:
+    import fcntl
+
+    def _lock_file(f):
+        fcntl.flock(f.fileno(), fcntl.LOCK_EX)
+
+    def _unlock_file(f):
+        fcntl.flock(f.fileno(), fcntl.LOCK_UN)
+
+
+class RawTxStore(PrintError):
+    ''' An on-disk, append-only store of raw transactions keyed on txid, shared
+    by every wallet open in this process (see Network.tx_store). Only the
+    txs of wallets without storage encryption are put in it.
+
+    Three files live in `path`:
+
+        data  - records of <txid:32><length:uint32 LE><raw tx>, only ever
+                appended to.
+        index - an open-addressing hash table of <txid:32><offset+1:uint64 LE>
+                slots behind a small header, accessed through mmap. It is
+                grown (rebuilt at twice the size) when half full.
+        lock  - empty; locked around every access, so that several processes
+                may share the store (e.g. a daemon and a GUI started on the
+                same config dir). On taking the lock, a process picks up an
+                index that another one rebuilt and data it appended.
+
+    The store is content-addressed: put() computes the txid itself, so a
+    record can only ever hold the tx that hashes to it. The index is only a
+    hint; get() checks the txid in the data record it points to. Should the
+    index be missing or damaged it is rebuilt from the data file, and data
+    appended after the last index update (e.g. on a crash) is re-indexed on
+    open. '''
+
+    MAGIC = b'ECTXIDX1'
+    HEADER = struct.Struct('<8sQQ')  # magic, number of entries, bytes of data indexed
+    SLOT = struct.Struct('<32sQ')
+    RECORD = struct.Struct('<32sI')
+    MIN_SLOTS = 4096
+
+    def __init__(self, path):
+        self.path = path
+        self.lock = threading.Lock()
+        os.makedirs(path, exist_ok=True)
+        self.data_path = os.path.join(path, 'data')
+        self.index_path = os.path.join(path, 'index')
+        self.lock_file = open(os.path.join(path, 'lock'), 'a+b')
+        self.data = open(self.data_path, 'a+b')
+        self.index_file = None
+        self.index = None
+        self.nslots = self.count = self.data_end = 0
+        with self._locked():
+            self._open_index()
+            self._catch_up()
+
+    def diagnostic_name(self):
+        return self.__class__.__name__
+
+    @contextmanager
+    def _locked(self):
+        ''' Holds self.lock and the inter-process lock on the lock file. '''
+        with self.lock:
+            _lock_file(self.lock_file)
+            try:
+                yield
+            finally:
+                _unlock_file(self.lock_file)
+
+    def _sync(self):
+        ''' Catch up with what other processes wrote since we last held the
+        lock: a rebuilt index file (see _create_index), and records appended
+        to the data file. '''
+        try:
+            replaced = not os.path.samestat(os.fstat(self.index_file.fileno()), os.stat(self.index_path))
+        except OSError:
+            replaced = True
+        if replaced:
+            self._close_index()
+            self._open_index()
+        else:
+            _, self.count, self.data_end = self.HEADER.unpack_from(self.index, 0)
+        self._catch_up()
+
+    # -- index file
+
+    def _open_index(self):
+        try:
+            f = open(self.index_path, 'r+b')
+        except FileNotFoundError:
+            self._create_index(self.MIN_SLOTS)
+            return
+        size = os.fstat(f.fileno()).st_size
+        nslots = (size - self.HEADER.size) // self.SLOT.size
+        ok = nslots >= self.MIN_SLOTS and not nslots & (nslots - 1) \
+            and size == self.HEADER.size + nslots * self.SLOT.size
+        if ok:
+            self.index_file, self.index = f, mmap.mmap(f.fileno(), size)
+            magic, self.count, self.data_end = self.HEADER.unpack_from(self.index, 0)
+            self.nslots = nslots
+            ok = magic == self.MAGIC and self.count < nslots and self.data_end <= self._data_size()
+            if ok:
+                return
+            self._close_index()
+        else:
+            f.close()
+        self.print_error("index is damaged, rebuilding it")
+        self._create_index(self.MIN_SLOTS)
+
+    def _create_index(self, nslots, *, data_end=0):
+        ''' Replace the index with an empty one of nslots slots, covering the
+        data file up to data_end. '''
+        self._close_index()
+        tmp = self.index_path + '.tmp'
+        with open(tmp, 'wb') as f:
+            f.write(self.HEADER.pack(self.MAGIC, 0, data_end))
+            f.truncate(self.HEADER.size + nslots * self.SLOT.size)
+        os.replace(tmp, self.index_path)
+        self.index_file = open(self.index_path, 'r+b')
+        self.index = mmap.mmap(self.index_file.fileno(), 0)
+        self.nslots, self.count, self.data_end = nslots, 0, data_end
+
+    def _close_index(self):
+        if self.index is not None:
+            self.index.close()
+            self.index = None
+        if self.index_file is not None:
+            self.index_file.close()
+            self.index_file = None
+
+    def _write_header(self):
+        self.HEADER.pack_into(self.index, 0, self.MAGIC, self.count, self.data_end)
+
+    def _find_slot(self, txid: bytes):
+        ''' Returns (slot number, offset or None) for txid: its own slot if
+        present, otherwise the empty slot it would go in. '''
+        mask = self.nslots - 1
+        i = int.from_bytes(txid[:8], 'little') & mask  # txids are uniformly distributed
+        while True:
+            key, off = self.SLOT.unpack_from(self.index, self.HEADER.size + i * self.SLOT.size)
+            if not off:
+                return i, None
+            if key == txid:
+                return i, off - 1
+            i = (i + 1) & mask
+
+    def _index_put(self, txid: bytes, offset: int):
+        if (self.count + 1) * 2 > self.nslots:
+            self._grow()
+        i, old = self._find_slot(txid)
+        if old is None:
+            self.count += 1
+        self.SLOT.pack_into(self.index, self.HEADER.size + i * self.SLOT.size, txid, offset + 1)
+
+    def _grow(self):
+        entries = []
+        for i in range(self.nslots):
+            key, off = self.SLOT.unpack_from(self.index, self.HEADER.size + i * self.SLOT.size)
+            if off:
+                entries.append((key, off))
+        self._create_index(self.nslots * 2, data_end=self.data_end)
+        for key, off in entries:
+            i, _ = self._find_slot(key)
+            self.SLOT.pack_into(self.index, self.HEADER.size + i * self.SLOT.size, key, off)
+        self.count = len(entries)
+        self._write_header()
+
+    # -- data file
+
+    def _data_size(self):
+        return os.fstat(self.data.fileno()).st_size
+
+    def _catch_up(self):
+        ''' Index any records past data_end, dropping a torn record at the end
+        of the data file if there is one. '''
+        size = self._data_size()
+        if self.data_end >= size:
+            return
+        self.data.seek(self.data_end)
+        pos, n = self.data_end, 0
+        while pos + self.RECORD.size <= size:
+            txid, length = self.RECORD.unpack(self.data.read(self.RECORD.size))
+            if pos + self.RECORD.size + length > size:
+                break
+            self.data.seek(length, os.SEEK_CUR)
+            self._index_put(txid, pos)
+            pos += self.RECORD.size + length
+            n += 1
+        if pos < size:
+            self.print_error(f"dropping {size - pos} bytes of incomplete data")
+            self.data.truncate(pos)
+        self.data_end = pos
+        self._write_header()
+        if n:
+            self.print_error(f"indexed {n} new records")
+
+    # -- public interface
+
+    def get(self, txid_hex: str) -> Optional[bytes]:
+        ''' Returns the raw bytes of the tx with this txid, or None. '''
+        try:
+            txid = bytes.fromhex(txid_hex)[::-1]
+        except (TypeError, ValueError):
+            return None
+        if len(txid) != 32:
+            return None
+        with self._locked():
+            if self.index is None:
+                return None
+            self._sync()
+            _, off = self._find_slot(txid)
+            if off is None:
+                return None
+            self.data.seek(off)
+            header = self.data.read(self.RECORD.size)
+            if len(header) != self.RECORD.size:
+                return None
+            key, length = self.RECORD.unpack(header)
+            if key != txid:
+                return None
+            raw = self.data.read(length)
+        return raw if len(raw) == length else None
+
+    def __contains__(self, txid_hex: str) -> bool:
+        return self.get(txid_hex) is not None
+
+    def put(self, raw: bytes) -> str:
+        ''' Stores raw (bytes of a serialized tx) if not already present and
+        returns its txid. '''
+        txid = Hash(raw)
+        with self._locked():
+            if self.index is not None:
+                self._sync()
+                _, off = self._find_slot(txid)
+                if off is None:
+                    self.data.seek(0, os.SEEK_END)
+                    pos = self.data.tell()
+                    self.data.write(self.RECORD.pack(txid, len(raw)) + raw)
+                    self.data.flush()
+                    self._index_put(txid, pos)
+                    self.data_end = pos + self.RECORD.size + len(raw)
+                    self._write_header()
+        return txid[::-1].hex()
+
+    def __len__(self):
+        return self.count
+
+    def close(self):
+        if self.lock_file.closed:
+            return
+        with self._locked():
+            if self.index is not None:
+                self.index.flush()
+            self._close_index()
+            self.data.close()
+        self.lock_file.close()
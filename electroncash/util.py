@@ -26,6 +26,7 @@ import os, sys, re, json, time
 from collections import defaultdict
 from datetime import datetime
 from decimal import Decimal as PyDecimal  # Qt 5.12 also exports Decimal
+import functools
 from functools import lru_cache
 import traceback
 import threading
@@ -258,6 +259,102 @@ class DaemonThread(threading.Thread, PrintError):
         self.print_error("stopped")
 
 
+class JobWorker(DaemonThread):
+    """ A thread of its own for ThreadJobs that would otherwise run from the
+    Network thread's main loop, e.g. the synchronizer of one wallet, so that
+    one busy wallet doesn't hold up the network or other wallets.
+
+    Network responses for these jobs must be handed to the worker: pass
+    callback(func) instead of func to Network.send() and friends. So all of a
+    job's code still runs on a single thread, as it did on the Network's. """
+
+    interval = 0.1  # seconds between runs of the jobs, as in the Network loop
+
+    class _Callback:
+        """ Calls func from the worker thread. Compares equal to the same for
+        the same func so that Network.cancel_requests() etc. find it. """
+        __slots__ = ('worker', 'func', 'batch_responses')
+
+        def __init__(self, worker, func):
+            self.worker = worker
+            self.func = func
+            self.batch_responses = getattr(func, 'batch_responses', False)
+
+        def __call__(self, *args):
+            self.worker.post(self.func, *args)
+
+        def __eq__(self, other):
+            return (isinstance(other, JobWorker._Callback)
+                    and self.worker is other.worker and self.func == other.func)
+
+        def __hash__(self):
+            return hash(self.func)
+
+    def __init__(self, name):
+        super().__init__()
+        self.name = name
+        # Not a daemon thread: the jobs' wallet writes are refused from
+        # daemon threads (see WalletStorage._write).
+        self.inbox = queue.Queue()
+        self.stats_lock = threading.Lock()
+        self.n_calls = 0
+        self.call_wait = 0.0  # total seconds posted calls waited to be run
+        self.max_call_wait = 0.0
+        self.busy = 0.0  # total seconds spent running calls and jobs
+
+    def diagnostic_name(self):
+        return self.name
+
+    def callback(self, func):
+        return self._Callback(self, func)
+
+    def post(self, func, *args):
+        """ Have func(*args) called from this thread. """
+        self.inbox.put((time.time(), func, args))
+
+    def _run_posted(self, timeout):
+        deadline = time.time() + timeout
+        while True:
+            try:
+                t, func, args = self.inbox.get(timeout=max(deadline - time.time(), 0.0))
+            except queue.Empty:
+                return
+            t0 = time.time()
+            try:
+                func(*args)
+            except Exception:
+                traceback.print_exc(file=sys.stderr)
+            t1 = time.time()
+            with self.stats_lock:
+                self.n_calls += 1
+                self.call_wait += t0 - t
+                self.max_call_wait = max(self.max_call_wait, t0 - t)
+                self.busy += t1 - t0
+            if t1 >= deadline:
+                return
+
+    def run(self):
+        while self.is_running():
+            self._run_posted(self.interval)
+            t0 = time.time()
+            self.run_jobs()
+            with self.stats_lock:
+                self.busy += time.time() - t0
+        # One last run, for the jobs to release() themselves from the network
+        self.run_jobs()
+        self.on_stop()
+
+    def get_stats(self):
+        with self.stats_lock:
+            return {
+                'calls': self.n_calls,
+                'queued_calls': self.inbox.qsize(),
+                'avg_call_wait_ms': round(1e3 * self.call_wait / self.n_calls, 3) if self.n_calls else None,
+                'max_call_wait_ms': round(1e3 * self.max_call_wait, 3),
+                'busy_secs': round(self.busy, 3),
+            }
+
+
 # TODO: disable
 is_verbose = True
 verbose_timestamps = True
@@ -347,14 +444,93 @@ def constant_time_compare(val1, val2):
 
 
 # decorator that prints execution time
+class ProfilerStats:
+    """ Timings of one @profiler function: exact call count, total and max,
+    plus the most recent RING_SIZE durations in a ring buffer, from which
+    percentiles are computed when the stats are read. """
+
+    RING_SIZE = 512
+
+    __slots__ = ('lock', 'count', 'total', 'max', 'ring', 'pos')
+
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.reset()
+
+    def reset(self):
+        self.count = 0
+        self.total = self.max = 0.0
+        self.ring = [0.0] * self.RING_SIZE
+        self.pos = 0
+
+    def add(self, t):
+        with self.lock:
+            self.count += 1
+            self.total += t
+            if t > self.max:
+                self.max = t
+            self.ring[self.pos] = t
+            self.pos = (self.pos + 1) % self.RING_SIZE
+
+    def summary(self, reset=False):
+        with self.lock:
+            count, total, max_t = self.count, self.total, self.max
+            recent = sorted(self.ring[:min(count, self.RING_SIZE)])
+            if reset:
+                self.reset()
+        def pct(p):
+            return recent[min(len(recent) - 1, int(p * len(recent)))] if recent else 0.0
+        return {
+            'count': count,
+            'total': total,
+            'mean': total / count if count else 0.0,
+            'p50': pct(0.50),
+            'p99': pct(0.99),
+            'max': max_t,
+        }
+
+
+_profiler_stats = defaultdict(ProfilerStats)
+_profiler_stats_lock = threading.Lock()
+
 def profiler(func):
-    def do_profile(args, kw_args):
-        t0 = time.time()
-        o = func(*args, **kw_args)
-        t = time.time() - t0
-        print_error("[profiler]", func.__qualname__, "%.4f"%t)
-        return o
-    return lambda *args, **kw_args: do_profile(args, kw_args)
+    """ Decorator that times each call to func. The time is printed (when
+    verbose) and aggregated into a ProfilerStats; see profiler_stats(). """
+    name = func.__module__.rsplit('.', 1)[-1] + '.' + func.__qualname__
+    with _profiler_stats_lock:
+        stats = _profiler_stats[name]
+    @functools.wraps(func)
+    def do_profile(*args, **kw_args):
+        t0 = time.perf_counter()
+        try:
+            return func(*args, **kw_args)
+        finally:
+            t = time.perf_counter() - t0
+            stats.add(t)
+            print_error("[profiler]", func.__qualname__, "%.4f"%t)
+    return do_profile
+
+def profiler_stats(reset=False):
+    """ Returns {function name: {count, total, mean, p50, p99, max}} (times
+    in seconds; the percentiles are over the most recent calls) for every
+    @profiler function that has been called, optionally resetting them. """
+    with _profiler_stats_lock:
+        items = list(_profiler_stats.items())
+    ret = {}
+    for name, stats in sorted(items):
+        summary = stats.summary(reset)
+        if summary['count']:
+            ret[name] = summary
+    return ret
+
+
+# decorator for Network request callbacks that want a list of responses
+def batch_responses(func):
+    """Marks a network callback as taking a list of responses. The Network
+    will then hand it every consecutive response it has read for that
+    callback in one call, instead of one call per response."""
+    func.batch_responses = True
+    return func
 
 
 @lru_cache()
@@ -704,6 +880,8 @@ class JSONSocketPipe(PrintError):
     class Closed(RuntimeError):
         ''' Raised if socket is closed '''
 
+    recv_size = 65536
+
     def __init__(self, socket, *, max_message_bytes=0):
         ''' A max_message_bytes of <= 0 means unlimited, otherwise a positive
         value indicates this many bytes to limit the message size by. This is
@@ -714,6 +892,8 @@ class JSONSocketPipe(PrintError):
         self.recv_time = time.time()
         self.max_message_bytes = max_message_bytes
         self.recv_buf = bytearray()
+        self.recv_pos = 0  # start of the first unconsumed message in recv_buf
+        self.scan_pos = 0  # offset up to which recv_buf has no newline past recv_pos
         self.send_buf = bytearray()
 
     def idle_time(self):
@@ -741,14 +921,19 @@ class JSONSocketPipe(PrintError):
         If no message is currently available, this raises util.timeout and you
         should retry once data becomes available to read. If connection is bad for
         some known reason, raises .Closed; other errors will raise other exceptions.
+
+        Messages are parsed in place from the receive buffer: the newline scan
+        resumes where the previous one stopped, consumed bytes are only
+        compacted away once in a while, and max_message_bytes applies to the
+        message currently being received, not to the whole buffer.
         '''
         while True:
-            response, self.recv_buf = parse_json(self.recv_buf)
+            response = self._parse_buffered()
             if response is not None:
                 return response
 
             try:
-                data = self.socket.recv(1024)
+                data = self.socket.recv(self.recv_size)
             except (socket.timeout, BlockingIOError, ssl.SSLWantReadError):
                 raise timeout
             except OSError as exc:
@@ -772,8 +957,31 @@ class JSONSocketPipe(PrintError):
             self.recv_buf.extend(data)
             self.recv_time = time.time()
 
-            if self.max_message_bytes > 0 and len(self.recv_buf) > self.max_message_bytes:
-                raise self.Closed(f"Message limit is: {self.max_message_bytes}; receive buffer exceeded this limit!")
+    def _parse_buffered(self):
+        ''' Returns the next complete message in recv_buf, or None. Lines that
+        are not valid JSON are consumed and ignored. Raises .Closed if the
+        incomplete message at the end of the buffer is over the size limit. '''
+        buf = self.recv_buf
+        while True:
+            n = buf.find(b'\n', self.scan_pos)
+            if n == -1:
+                self.scan_pos = len(buf)
+                if self.recv_pos:
+                    # Drop consumed data, keeping only the partial message
+                    del buf[:self.recv_pos]
+                    self.scan_pos -= self.recv_pos
+                    self.recv_pos = 0
+                if self.max_message_bytes > 0 and len(buf) > self.max_message_bytes:
+                    raise self.Closed(f"Message limit is: {self.max_message_bytes}; receive buffer exceeded this limit!")
+                return None
+            start = self.recv_pos
+            self.recv_pos = self.scan_pos = n + 1
+            try:
+                # json accepts utf-8 bytes directly, saving a decode() copy
+                return json.loads(buf[start:n])
+            except Exception:
+                # just consume the line and ignore error.
+                continue
 
     def send(self, request):
         out = json.dumps(request) + '\n'
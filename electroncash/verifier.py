@@ -22,7 +22,8 @@
 # SOFTWARE.
 from abc import ABC, abstractmethod
 from .util import ThreadJob, bh2u
-from .bitcoin import Hash, hash_decode, hash_encode
+from .bitcoin import Hash, Hash_64_multi, hash_decode, hash_encode
+from . import ecc_fast
 from . import networks
 from .transaction import Transaction
 
@@ -92,6 +93,7 @@ class SPV(ThreadJob):
         self.blockchain = network.blockchain()
         self.merkle_roots = {}  # txid -> merkle root (once it has been verified)
         self.requested_merkle = set()  # txid set of pending requests
+        self.pending_merkle = []  # (txid, merkle) responses awaiting verification in run()
         self.qbusy = False
         self.cleaned_up = False
         self._need_release = False
@@ -120,6 +122,9 @@ class SPV(ThreadJob):
         if self.cleaned_up:
             return
 
+        if self.pending_merkle:
+            self.verify_pending_merkles()
+
         if not self._tick_ct:
             self.print_error("started")
         self._tick_ct += 1
@@ -200,17 +205,40 @@ class SPV(ThreadJob):
             self.print_error("verify_merkle:", str(e))
             return
 
+        # Hashing is deferred to run() so that all the branches which arrived
+        # since the last tick get hashed together.
+        self.pending_merkle.append((tx_hash, merkle))
+
+    def verify_pending_merkles(self):
+        pending, self.pending_merkle = self.pending_merkle, []
         try:
             # Verify the hash of the server-provided merkle branch to a
             # transaction matches the merkle root of its block
-            tx_height = merkle['block_height']
-            pos = merkle['pos']
-            merkle_root = self.hash_merkle_root(merkle['merkle'], tx_hash, pos)
-        except Exception as e:
-            self.print_error(f"exception while verifying tx {tx_hash}: {repr(e)}")
-            self.wallet.verification_failed(tx_hash, self.failure_reasons[4])
-            return
+            merkle_roots = self.hash_merkle_roots([(merkle['merkle'], tx_hash, merkle['pos'])
+                                                   for tx_hash, merkle in pending])
+        except Exception:
+            # Some response is malformed; redo them one by one to find out which.
+            merkle_roots = []
+            for tx_hash, merkle in pending:
+                try:
+                    merkle_roots.append(self.hash_merkle_root(merkle['merkle'], tx_hash, merkle['pos']))
+                except Exception as e:
+                    self.print_error(f"exception while verifying tx {tx_hash}: {repr(e)}")
+                    self.wallet.verification_failed(tx_hash, self.failure_reasons[4])
+                    merkle_roots.append(None)
+        verified = False
+        for (tx_hash, merkle), merkle_root in zip(pending, merkle_roots):
+            if merkle_root is not None:
+                verified = self.verify_merkle_root(tx_hash, merkle, merkle_root) or verified
+        # Save once for the whole batch
+        if verified and self.is_up_to_date() and self.wallet.is_up_to_date() and not self.qbusy:
+            self.wallet.save_verified_tx(write=True)
+            self.network.trigger_callback('wallet_updated', self.wallet)  # This callback will happen very rarely.. mostly right as the last tx is verified. It's to ensure GUI is updated fully.
 
+    def verify_merkle_root(self, tx_hash, merkle, merkle_root):
+        ''' Returns True if the tx verified. '''
+        tx_height = merkle['block_height']
+        pos = merkle['pos']
         header = self.network.blockchain().read_header(tx_height)
         # FIXME: if verification fails below,
         # we should make a fresh connection to a server to
@@ -220,13 +248,13 @@ class SPV(ThreadJob):
                 "merkle verification failed for {} (missing header {})"
                 .format(tx_hash, tx_height))
             self.wallet.verification_failed(tx_hash, self.failure_reasons[1])
-            return
+            return False
         if header.get('merkle_root') != merkle_root:
             self.print_error(
                 "merkle verification failed for {} (merkle root mismatch {} != {})"
                 .format(tx_hash, header.get('merkle_root'), merkle_root))
             self.wallet.verification_failed(tx_hash, self.failure_reasons[2])
-            return
+            return False
         # we passed all the tests
         self.merkle_roots[tx_hash] = merkle_root
         # note: we could pop in the beginning, but then we would request
@@ -234,9 +262,32 @@ class SPV(ThreadJob):
         self.requested_merkle.discard(tx_hash)
         self.print_error("verified %s" % tx_hash)
         self.wallet.add_verified_tx(tx_hash, (tx_height, header.get('timestamp'), pos), header)
-        if self.is_up_to_date() and self.wallet.is_up_to_date() and not self.qbusy:
-            self.wallet.save_verified_tx(write=True)
-            self.network.trigger_callback('wallet_updated', self.wallet)  # This callback will happen very rarely.. mostly right as the last tx is verified. It's to ensure GUI is updated fully.
+        return True
+
+    @classmethod
+    def hash_merkle_roots(cls, items):
+        ''' Like hash_merkle_root, but for a list of (merkle_s, target_hash,
+        pos) tuples. All of them are hashed in one native call if possible,
+        otherwise with one Hash_64_multi call per tree level. Returns the list
+        of hex merkle roots. '''
+        hashes = [hash_decode(target_hash) for _, target_hash, _ in items]
+        branches = [[hash_decode(item) for item in merkle_s] for merkle_s, _, _ in items]
+        if any(len(h) != 32 for h in hashes) or any(len(h) != 32 for b in branches for h in b):
+            # Would misalign every other branch hashed with it
+            raise ValueError("merkle branch hashes must be 32 bytes")
+        if not all(0 <= pos < (1 << 32) for _, _, pos in items):
+            raise ValueError("merkle branch position out of range")
+        roots = ecc_fast.merkle_roots(hashes, branches, [pos for _, _, pos in items])
+        if roots is not None:
+            return [hash_encode(h) for h in roots]
+        depth = max((len(b) for b in branches), default=0)
+        for i in range(depth):
+            todo = [j for j, b in enumerate(branches) if i < len(b)]
+            data = b''.join(branches[j][i] + hashes[j] if (items[j][2] >> i) & 1 else hashes[j] + branches[j][i]
+                            for j in todo)
+            for j, h in zip(todo, Hash_64_multi(data)):
+                hashes[j] = h
+        return [hash_encode(h) for h in hashes]
 
     @classmethod
     def hash_merkle_root(cls, merkle_s, target_hash, pos):
@@ -40,14 +40,16 @@ import queue
 import random
 import threading
 import time
-from collections import defaultdict, namedtuple
+from bisect import bisect_left
+from collections import OrderedDict, defaultdict, namedtuple
+from collections.abc import MutableMapping
 from enum import Enum, auto
 from functools import partial
 from typing import ItemsView, List, Optional, Set, Tuple, Union, ValuesView
 
 from .i18n import ngettext
 from .util import (NotEnoughFunds, ExcessiveFee, PrintError, UserCancelled, profiler, format_satoshis, format_time,
-                   finalization_print_error, to_string, TimeoutException)
+                   finalization_print_error, to_string, TimeoutException, JobWorker)
 
 from .address import Address, Script, ScriptOutput, PublicKey, OpCodes
 from .bitcoin import *
@@ -179,6 +181,325 @@ def sweep(privkeys, network, config, recipient, fee=None, imax=100, sign_schnorr
     return tx
 
 
+class AddressBalanceIndex:
+    ''' Address -> balance index of a wallet. Each entry is the 6-tuple
+    (c, u, x, fc, fu, fx) of the (confirmed_matured, unconfirmed, unmatured)
+    balance of an address followed by the part of it held in frozen coins.
+
+    Running totals over all entries are kept as entries come and go, so that
+    the balance of the whole wallet is a lookup rather than a walk over every
+    address. The wallet drops the entry of an address whenever its history or
+    the frozen state of one of its coins changes, and get_addr_balance puts
+    it back when next asked.
+
+    Unlike the plain dict this replaces, updates take a (cheap, private) lock,
+    since every put and pop also touches the totals. '''
+
+    def __init__(self):
+        self._lock = threading.Lock()
+        self._entries = {}
+        self._totals = (0,) * 6
+
+    def get(self, address):
+        return self._entries.get(address)
+
+    def put(self, address, entry):
+        with self._lock:
+            old = self._entries.get(address)
+            self._entries[address] = entry
+            if old is None:
+                self._totals = tuple(t + e for t, e in zip(self._totals, entry))
+            else:
+                self._totals = tuple(t + e - o for t, e, o in zip(self._totals, entry, old))
+
+    def pop(self, address, default=None):
+        with self._lock:
+            old = self._entries.pop(address, None)
+            if old is None:
+                return default
+            self._totals = tuple(t - o for t, o in zip(self._totals, old))
+            return old
+
+    def clear(self):
+        with self._lock:
+            self._entries.clear()
+            self._totals = (0,) * 6
+
+    def totals(self):
+        ''' Returns (totals, n): the sum of all entries and how many there
+        are, as of the same instant. '''
+        with self._lock:
+            return self._totals, len(self._entries)
+
+    def __contains__(self, address):
+        return address in self._entries
+
+    def __len__(self):
+        return len(self._entries)
+
+    def snapshot(self):
+        ''' Returns {address: entry} of the entries without frozen coins.
+        Frozen state is saved separately and may change without the index
+        being snapshotted again, so those entries are always recomputed. '''
+        with self._lock:
+            return {address: entry for address, entry in self._entries.items()
+                    if not any(entry[3:])}
+
+    def restore(self, entries):
+        with self._lock:
+            self._entries = dict(entries)
+            totals = [0] * 6
+            for entry in self._entries.values():
+                for i, e in enumerate(entry):
+                    totals[i] += e
+            self._totals = tuple(totals)
+
+
+class LazyTxTable(MutableMapping):
+    ''' tx_hash -> Transaction mapping of a wallet's transactions that keeps
+    each one as its raw hex until it is asked for. Materialized Transaction
+    objects are kept in an LRU of at most max_live entries; when one drops out
+    of it, only its raw hex is kept again. Loading a wallet therefore costs a
+    string per tx rather than an object, and memory stays bounded however
+    many of them are looked at.
+
+    A Transaction handed out may thus be a new object on the next lookup;
+    it is meant to be read, like the plain dict this replaces was. A tx that
+    has no raw form (never the case for wallet txs) is never evicted. '''
+
+    DEFAULT_MAX_LIVE = 2000
+
+    def __init__(self, raw_txs=None, max_live=DEFAULT_MAX_LIVE):
+        self._lock = threading.Lock()
+        self._data = dict(raw_txs or {})  # tx_hash -> raw hex str or Transaction
+        self._live = OrderedDict()  # materialized tx_hashes, least recently used first
+        self.max_live = max_live
+
+    def __getitem__(self, tx_hash):
+        with self._lock:
+            v = self._data[tx_hash]
+            if isinstance(v, str):
+                v = self._data[tx_hash] = Transaction(v)
+                self._live[tx_hash] = None
+                self._evict()
+            else:
+                self._live.move_to_end(tx_hash)
+            return v
+
+    def __setitem__(self, tx_hash, tx):
+        with self._lock:
+            self._data[tx_hash] = tx
+            self._live[tx_hash] = None
+            self._live.move_to_end(tx_hash)
+            self._evict()
+
+    def __delitem__(self, tx_hash):
+        with self._lock:
+            del self._data[tx_hash]
+            self._live.pop(tx_hash, None)
+
+    def _evict(self):
+        while len(self._live) > self.max_live:
+            tx_hash, _ = self._live.popitem(last=False)
+            raw = self._data[tx_hash].raw
+            if raw:
+                self._data[tx_hash] = raw
+            else:
+                self._live[tx_hash] = None  # can't be rebuilt; keep it
+                break
+
+    def __contains__(self, tx_hash):
+        return tx_hash in self._data
+
+    def __iter__(self):
+        return iter(list(self._data))
+
+    def __len__(self):
+        return len(self._data)
+
+    def clear(self):
+        with self._lock:
+            self._data.clear()
+            self._live.clear()
+
+    def get_raw(self, tx_hash):
+        ''' Returns the raw hex of tx_hash (or None), without materializing
+        a Transaction. '''
+        with self._lock:
+            v = self._data.get(tx_hash)
+        return v if v is None or isinstance(v, str) else str(v)
+
+    def raw_items(self):
+        ''' Returns a list of (tx_hash, raw hex) for every tx, without
+        materializing any. '''
+        with self._lock:
+            items = list(self._data.items())
+        return [(tx_hash, v if isinstance(v, str) else str(v)) for tx_hash, v in items]
+
+
+class HistoryCache:
+    ''' The whole-wallet history of get_history(), kept sorted oldest first
+    along with the running sum of the tx deltas, so that it can be returned
+    again, or a page of it, without being recomputed.
+
+    The wallet reports the addresses whose history changed (invalidate_address)
+    and the transactions whose height or position in the block changed
+    (invalidate_tx). On the next read only the deltas of those addresses are
+    recomputed, and the sorted history is kept up to the lowest position any
+    affected tx had or now has; only what comes after it is re-sorted.
+
+    All reads must happen with the wallet lock held. Invalidation can happen
+    from any thread; it only takes a private lock. '''
+
+    class _Order:
+        ''' One sort order of the history, oldest first. '''
+        def __init__(self):
+            self.keys = []  # sort keys
+            self.txs = []  # tx hashes
+            self.deltas = []  # tx deltas, None if unknown
+            self.psums = []  # running sum of the deltas, counting None as 0
+            self.nones = []  # ascending indices of the None deltas
+            self.key_of = {}  # tx_hash -> sort key
+
+    def __init__(self):
+        self._lock = threading.Lock()
+        self.clear()
+
+    def clear(self):
+        self._addr_deltas = None  # Address -> {tx_hash: delta}
+        self._tx_addrs = {}  # tx_hash -> set of Address
+        self._dirty_addrs = set()
+        self._dirty_txs = set()
+        self._pruned = frozenset()
+        self._orders = {}  # receives_before_sends -> _Order
+
+    def invalidate_address(self, address):
+        with self._lock:
+            self._dirty_addrs.add(address)
+
+    def invalidate_tx(self, tx_hash):
+        with self._lock:
+            self._dirty_txs.add(tx_hash)
+
+    def _tx_delta(self, tx_hash):
+        delta = 0
+        for addr in self._tx_addrs[tx_hash]:
+            d = self._addr_deltas[addr][tx_hash]
+            if d is None:
+                return None
+            delta += d
+        return delta
+
+    def _refresh_deltas(self, wallet):
+        ''' Brings the deltas up to date, returning the set of tx's whose
+        delta or position may have changed, or None if everything was
+        recomputed. '''
+        addresses = wallet.get_addresses()
+        # a tx whose prevouts are pruned has no delta at all (get_tx_delta)
+        full = self._addr_deltas is None or wallet.pruned_txo_values != self._pruned
+        with self._lock:
+            dirty_addrs, self._dirty_addrs = self._dirty_addrs, set()
+            dirty_txs, self._dirty_txs = self._dirty_txs, set()
+        if full:
+            self._addr_deltas, self._tx_addrs, self._orders = {}, {}, {}
+            dirty_addrs = addresses
+        changed = set(dirty_txs)
+        for addr in dirty_addrs:
+            for tx_hash in self._addr_deltas.pop(addr, ()):
+                changed.add(tx_hash)
+                s = self._tx_addrs[tx_hash]
+                s.discard(addr)
+                if not s:
+                    del self._tx_addrs[tx_hash]
+            if not full and not wallet.is_mine(addr):
+                continue
+            deltas = self._addr_deltas[addr] = {}
+            for tx_hash, height in wallet.get_address_history(addr):
+                deltas[tx_hash] = wallet.get_tx_delta(tx_hash, addr)
+                changed.add(tx_hash)
+                self._tx_addrs.setdefault(tx_hash, set()).add(addr)
+        self._pruned = frozenset(wallet.pruned_txo_values)
+        if not full and len(self._addr_deltas) != len(addresses):
+            # an address came or went without being reported; start over
+            self._addr_deltas = None
+            return self._refresh_deltas(wallet)
+        return None if full else changed
+
+    def _sort_key(self, wallet, tx_hash, delta, receives_before_sends):
+        height, pos = wallet.get_txpos(tx_hash)
+        if receives_before_sends:
+            # Guard against delta == None by forcing None -> 0
+            return height, -(delta or 0), pos, tx_hash
+        return height, pos, tx_hash
+
+    def _update_order(self, wallet, order, changed, receives_before_sends):
+        new_keys = {}
+        for tx_hash in changed:
+            if tx_hash in self._tx_addrs:
+                new_keys[tx_hash] = self._sort_key(wallet, tx_hash, self._tx_delta(tx_hash), receives_before_sends)
+        old_keys = [order.key_of[tx_hash] for tx_hash in changed if tx_hash in order.key_of]
+        if not new_keys and not old_keys:
+            return
+        i = bisect_left(order.keys, min(itertools.chain(new_keys.values(), old_keys)))
+        # the tx's after the cut that did not change keep their key
+        tail = [(order.key_of[tx_hash], tx_hash, delta) for tx_hash, delta in zip(order.txs[i:], order.deltas[i:])
+                if tx_hash not in changed]
+        tail.extend((key, tx_hash, self._tx_delta(tx_hash)) for tx_hash, key in new_keys.items())
+        tail.sort()
+        for tx_hash in changed:
+            order.key_of.pop(tx_hash, None)
+        del order.keys[i:], order.txs[i:], order.deltas[i:], order.psums[i:]
+        del order.nones[bisect_left(order.nones, i):]
+        psum = order.psums[-1] if order.psums else 0
+        for key, tx_hash, delta in tail:
+            if delta is None:
+                order.nones.append(len(order.txs))
+            else:
+                psum += delta
+            order.keys.append(key)
+            order.txs.append(tx_hash)
+            order.deltas.append(delta)
+            order.psums.append(psum)
+            order.key_of[tx_hash] = key
+
+    def _get_order(self, wallet, receives_before_sends):
+        changed = self._refresh_deltas(wallet)
+        if changed:
+            for rbs, order in self._orders.items():
+                self._update_order(wallet, order, changed, rbs)
+        order = self._orders.get(receives_before_sends)
+        if order is None:
+            order = self._orders[receives_before_sends] = self._Order()
+            self._update_order(wallet, order, self._tx_addrs.keys(), receives_before_sends)
+        return order
+
+    def get_page(self, wallet, start, stop, reverse, receives_before_sends):
+        ''' Returns (n, history[start:stop]) of the n item whole-wallet
+        history. '''
+        order = self._get_order(wallet, receives_before_sends)
+        n = len(order.txs)
+        start, stop, _ = slice(start, stop).indices(n)
+        if start >= stop:
+            return n, []
+        c, u, x = wallet.get_balance()
+        balance = c + u + x
+        # An item's balance is the current balance less the deltas of all the
+        # newer items, unknown if any of those is unknown.
+        last_none = order.nones[-1] if order.nones else -1
+        total = order.psums[-1]
+        if reverse:
+            indices = range(n - 1 - start, n - 1 - stop, -1)
+        else:
+            indices = range(start, stop)
+        out = []
+        for i in indices:
+            tx_hash = order.txs[i]
+            height, conf, timestamp = wallet.get_tx_height(tx_hash)
+            bal = balance - (total - order.psums[i]) if i >= last_none else None
+            out.append(wallet.TxHistory(tx_hash, height, conf, timestamp, order.deltas[i], bal))
+        return n, out
+
+
 class Abstract_Wallet(PrintError, SPVDelegate):
     """
     Wallet classes are created to handle various address generation methods.
@@ -196,6 +517,8 @@ class Abstract_Wallet(PrintError, SPVDelegate):
         self.verifier: Optional[SPV] = None
         self.synchronizer: Optional[Synchronizer] = None
         self.rpa_manager = None
+        # Runs the synchronizer and rpa_manager, see util.JobWorker
+        self.job_worker: Optional[JobWorker] = None
         self.weak_window = None  # Some of the GUI classes, such as the Qt ElectrumWindow, use this to refer back to themselves.  This should always be a weakref.ref (Weak.ref), or None
         # CashAccounts subsystem. Its network-dependent layer is started in
         # start_threads. Note: object instantiation should be lightweight here.
@@ -211,17 +534,29 @@ class Abstract_Wallet(PrintError, SPVDelegate):
         # Removes defunct entries from self.pruned_txo asynchronously
         self.pruned_txo_cleaner_thread = None
 
-        # Cache of Address -> (c,u,x) balance. This cache is used by
-        # get_addr_balance to significantly speed it up (it is called a lot).
-        # Cache entries are invalidated when tx's are seen involving this
-        # address (address history chages). Entries to this cache are added
-        # only inside get_addr_balance.
+        # Index of Address -> balance (see AddressBalanceIndex). This is used
+        # by get_addr_balance and get_balance to significantly speed them up
+        # (they are called a lot). Entries are invalidated when tx's are seen
+        # involving this address (address history chages) or when its coins
+        # are frozen/unfrozen. Entries to this index are added only inside
+        # get_addr_balance, and it is snapshotted to storage along with the
+        # transactions it was computed from.
         # Note that this data structure is touched by the network and GUI
-        # thread concurrently without the use of locks, because Python GIL
-        # allows us to get away with such things. As such do not iterate over
-        # this dict, but simply add/remove items to/from it in 1-liners (which
-        # Python's GIL makes thread-safe implicitly).
-        self._addr_bal_cache = {}
+        # thread concurrently; it does its own (fine-grained) locking.
+        self._addr_bal_cache = AddressBalanceIndex()
+
+        # The whole-wallet get_history() (see HistoryCache), invalidated along
+        # with the above.
+        self._history_cache = HistoryCache()
+
+        # Cache of Address -> list of that address' unspent coins, each a
+        # (txo, height, value, is_coinbase) tuple, used by iter_utxos so that
+        # it needs no get_addr_io walk per address on every call. Frozen and
+        # SLP status are looked up per coin as it is returned, so entries are
+        # only invalidated (in _invalidate_address) when the address history
+        # changes. Like the above, this is touched by the network and GUI
+        # thread concurrently, so only get/put/pop it in 1-liners.
+        self._utxo_cache = {}
 
         # We keep a set of the wallet and receiving addresses so that is_mine()
         # checks are O(logN) rather than O(N). This creates/resets that cache.
@@ -262,6 +597,10 @@ class Abstract_Wallet(PrintError, SPVDelegate):
         # (such as self.transactions, history, etc) need to be synchronized
         # using this mutex.
         self.lock = threading.RLock()
+        # Serializes the commands that change the wallet (see commands.py)
+        # when the daemon's JSON-RPC server runs several at once. Held across
+        # a whole command, unlike self.lock.
+        self.command_lock = threading.RLock()
 
         # load requests
         requests = self.storage.get('payment_requests', {})
@@ -297,6 +636,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
         self.load_keystore_wrapper()
         self.load_addresses()
         self.load_transactions()
+        self.load_addr_balance_index()
         self.build_reverse_history()
 
         self.check_history()
@@ -413,10 +753,9 @@ class Abstract_Wallet(PrintError, SPVDelegate):
         self.pruned_txo = self.storage.get('pruned_txo', {})
         self.pruned_txo_values = set(self.pruned_txo.values())
         tx_list = self.storage.get('transactions', {})
-        self.transactions = {}
-        for tx_hash, raw in tx_list.items():
-            tx = Transaction(raw)
-            self.transactions[tx_hash] = tx
+        # Kept raw; only the txs actually looked at become Transactions
+        self.transactions = LazyTxTable(tx_list)
+        for tx_hash in tx_list:
             if not self.txi.get(tx_hash) and not self.txo.get(tx_hash) and (tx_hash not in self.pruned_txo_values):
                 self.print_error("removing unreferenced tx", tx_hash)
                 self.transactions.pop(tx_hash)
@@ -426,10 +765,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
     @profiler
     def save_transactions(self, write=False):
         with self.lock:
-            tx = {}
-            for k,v in self.transactions.items():
-                tx[k] = str(v)
-            self.storage.put('transactions', tx)
+            self.storage.put('transactions', dict(self.transactions.raw_items()))
             txi = {tx_hash: self.from_Address_dict(value)
                    for tx_hash, value in self.txi.items()
                    # skip empty entries to save memory and disk space
@@ -444,10 +780,42 @@ class Abstract_Wallet(PrintError, SPVDelegate):
             self.storage.put('pruned_txo', self.pruned_txo)
             history = self.from_Address_dict(self._history)
             self.storage.put('addr_history', history)
+            self.storage.put('addr_balance_index', {
+                'ntx': len(self.transactions),
+                'entries': {address.to_storage_string(): entry
+                            for address, entry in self._addr_bal_cache.snapshot().items()},
+            })
             self.slp.save()
             if write:
                 self.storage.write()
 
+    def _invalidate_address(self, address):
+        ''' Drops what is cached about address after its history changed. '''
+        self._addr_bal_cache.pop(address, None)
+        self._history_cache.invalidate_address(address)
+        self._utxo_cache.pop(address, None)
+
+    def load_addr_balance_index(self):
+        ''' Restores the balance index snapshotted by save_transactions, so
+        that a freshly opened wallet need not walk every address to show its
+        balance. The snapshot is trusted only if it was taken with the
+        transactions just loaded. '''
+        d = self.storage.get('addr_balance_index')
+        if not isinstance(d, dict) or d.get('ntx') != len(self.transactions):
+            return
+        # a coin frozen since the snapshot was taken changes its address' entry
+        frozen_addrs = {self._get_txo_address(txo) for txo in self.frozen_coins}
+        entries = {}
+        try:
+            for addr_str, entry in d.get('entries', {}).items():
+                address = Address.from_string(addr_str)
+                if len(entry) == 6 and address not in frozen_addrs and self.is_mine(address):
+                    entries[address] = tuple(int(e) for e in entry)
+        except Exception as e:
+            self.print_error("ignoring bad addr_balance_index:", repr(e))
+            return
+        self._addr_bal_cache.restore(entries)
+
     def save_verified_tx(self, write=False):
         with self.lock:
             self.storage.put('verified_tx3', self.verified_tx)
@@ -471,7 +839,9 @@ class Abstract_Wallet(PrintError, SPVDelegate):
             self.pruned_txo_values = set()
             self.slp.clear()
             self.save_transactions()
-            self._addr_bal_cache = {}
+            self._addr_bal_cache.clear()
+            self._history_cache.clear()
+            self._utxo_cache = {}
             self._history = {}
             self.tx_addr_hist = defaultdict(set)
             self.cashacct.on_clear_history()
@@ -650,6 +1020,18 @@ class Abstract_Wallet(PrintError, SPVDelegate):
         pk, compressed = self.keystore.get_private_key(index, password)
         return bitcoin.serialize_privkey(pk, compressed, self.txin_type)
 
+    def export_private_keys(self, addresses, password):
+        """ Returns a dict of address -> export_private_key(address). The
+        password is checked and turned into a decryption key only once for
+        the lot (see bitcoin.PwDecoder). Raises InvalidPassword. """
+        addresses = list(addresses)
+        if not addresses:
+            return {}
+        with bitcoin.PwDecoder(password) as pw:
+            if not self.is_watching_only():
+                self.check_password(pw)
+            return {addr: self.export_private_key(addr, pw) for addr in addresses}
+
     def get_public_keys(self, address):
         sequence = self.get_address_index(address)
         return self.get_pubkeys(*sequence)
@@ -663,6 +1045,8 @@ class Abstract_Wallet(PrintError, SPVDelegate):
 
             # tx will be verified only if height > 0
             if tx_hash not in self.verified_tx:
+                if self.unverified_tx.get(tx_hash) != tx_height:
+                    self._history_cache.invalidate_tx(tx_hash)
                 self.unverified_tx[tx_hash] = tx_height
                 self.cashacct.add_unverified_tx_hook(tx_hash, tx_height)
 
@@ -671,6 +1055,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
         with self.lock:
             self.unverified_tx.pop(tx_hash, None)
             self.verified_tx[tx_hash] = info  # (tx_height, timestamp, pos)
+            self._history_cache.invalidate_tx(tx_hash)
             height, conf, timestamp = self.get_tx_height(tx_hash)
             self.cashacct.add_verified_tx_hook(tx_hash, info, header)
         self.network.trigger_callback('verified2', self, tx_hash, height, conf, timestamp)
@@ -706,7 +1091,9 @@ class Abstract_Wallet(PrintError, SPVDelegate):
                         txs.add(tx_hash)
             if txs: self.cashacct.undo_verifications_hook(txs)
         if txs:
-            self._addr_bal_cache = {}  # this is probably not necessary -- as the receive_history_callback will invalidate bad cache items -- but just to be paranoid we clear the whole balance cache on reorg anyway as a safety measure
+            self._addr_bal_cache.clear()  # this is probably not necessary -- as the receive_history_callback will invalidate bad cache items -- but just to be paranoid we clear the whole balance cache on reorg anyway as a safety measure
+            self._history_cache.clear()
+            self._utxo_cache = {}
         for tx_hash in txs:
             self._update_request_statuses_touched_by_tx(tx_hash)
         return txs
@@ -956,8 +1343,10 @@ class Abstract_Wallet(PrintError, SPVDelegate):
         for txi in spent:
             coins.pop(txi)
             # cleanup/detect if the 'frozen coin' was spent and remove it from the frozen coin set
-            self.frozen_coins.discard(txi)
-            self.frozen_coins_tmp.discard(txi)
+            if txi in self.frozen_coins or txi in self.frozen_coins_tmp:
+                self.frozen_coins.discard(txi)
+                self.frozen_coins_tmp.discard(txi)
+                self._addr_bal_cache.pop(address, None)  # invalidate cache entry
         out = {}
         for txo, v in coins.items():
             tx_height, value, is_cb = v
@@ -986,34 +1375,42 @@ class Abstract_Wallet(PrintError, SPVDelegate):
             Note that 'exclude_frozen_coins = True' only checks for coin-level
             freezing, not address-level. '''
         assert isinstance(address, Address)
+        entry = self._get_addr_balance_entry(address)
+        if exclude_frozen_coins:
+            return entry[0] - entry[3], entry[1] - entry[4], entry[2] - entry[5]
+        return entry[:3]
+
+    def _get_addr_balance_entry(self, address):
+        ''' Returns the AddressBalanceIndex entry of address, computing (and
+        caching) it if need be. '''
+        cached = self._addr_bal_cache.get(address)
+        if cached is not None:
+            return cached
         mempoolHeight = self.get_local_height() + 1
-        if not exclude_frozen_coins:  # we do not use the cache when excluding frozen coins as frozen status is a dynamic quantity that can change at any time in the UI
-            cached = self._addr_bal_cache.get(address)
-            if cached is not None:
-                return cached
         received, sent = self.get_addr_io(address)
-        c = u = x = 0
+        # (c, u, x) of unfrozen coins at 0..2, of frozen coins at 3..5
+        bal = [0] * 6
         had_cb = False
         for txo, (tx_height, v, is_cb) in received.items():
-            if exclude_frozen_coins and (txo in self.frozen_coins or txo in self.frozen_coins_tmp):
-                continue
+            i = 3 if txo in self.frozen_coins or txo in self.frozen_coins_tmp else 0
             had_cb = had_cb or is_cb  # remember if this address has ever seen a coinbase txo
             if is_cb and tx_height + COINBASE_MATURITY > mempoolHeight:
-                x += v
+                bal[i + 2] += v
             elif tx_height > 0:
-                c += v
+                bal[i] += v
             else:
-                u += v
+                bal[i + 1] += v
             if txo in sent:
                 if sent[txo] > 0:
-                    c -= v
+                    bal[i] -= v
                 else:
-                    u -= v
-        result = c, u, x
-        if not exclude_frozen_coins and not had_cb:
+                    bal[i + 1] -= v
+        c, u, x, fc, fu, fx = bal
+        result = c + fc, u + fu, x + fx, fc, fu, fx
+        if not had_cb and self.is_mine(address):
             # Cache the results.
             # Cache needs to be invalidated if a transaction is added to/
-            # removed from addr history.  (See self._addr_bal_cache calls
+            # removed from addr history.  (See self._invalidate_address calls
             # related to this littered throughout this file).
             #
             # Note that as a performance tweak we don't ever cache balances for
@@ -1043,7 +1440,10 @@ class Abstract_Wallet(PrintError, SPVDelegate):
             # consequence of this policy, all the other addresses that are
             # non-coinbase can benefit from a cache that stays valid for longer
             # than 1 block (so long as their balances haven't changed).
-            self._addr_bal_cache[address] = result
+            #
+            # Only our own addresses go in, so that the index totals are
+            # exactly the balance of the wallet (see get_balance).
+            self._addr_bal_cache.put(address, result)
         return result
 
     def get_spendable_coins(self, domain, config, isInvoice = False):
@@ -1063,34 +1463,76 @@ class Abstract_Wallet(PrintError, SPVDelegate):
         Optional kw-only arg `addr_set_out` specifies a set in which to add all
         addresses encountered in the utxos returned. '''
         with self.lock:
-            mempoolHeight = self.get_local_height() + 1
-            coins = []
-            if domain is None:
-                domain = self.get_addresses()
-            if exclude_frozen:
-                domain = set(domain) - self.frozen_addresses
-            for addr in domain:
-                utxos = self.get_addr_utxo(addr)
-                len_before = len(coins)
-                for x in utxos.values():
-                    if exclude_slp and x['slp_token']:
+            return list(self.iter_utxos(domain, exclude_frozen, mature, confirmed_only,
+                                        addr_set_out=addr_set_out, exclude_slp=exclude_slp))
+
+    def iter_utxos(self, domain = None, exclude_frozen = False, mature = False, confirmed_only = False,
+                   *, addr_set_out = None, exclude_slp = True, min_value = 0, min_height = None,
+                   max_height = None):
+        '''Yields the coins get_utxos() with the same arguments returns, one
+        at a time and in the same order, leaving out those worth less than
+        `min_value` and, if given, those outside of the (inclusive) height
+        window `min_height`..`max_height`. Note that unconfirmed coins have
+        a height <= 0.
+
+        Coins are only turned into coin dicts once they pass all the filters,
+        so asking for, say, the coins above some value costs little more than
+        the coins returned. The wallet lock is taken per address rather than
+        across the whole iteration, so the caller may stop early, or go slow,
+        without holding up the network thread. '''
+        if domain is None:
+            domain = self.get_addresses()
+        if exclude_frozen and self.frozen_addresses:
+            domain = [addr for addr in domain if addr not in self.frozen_addresses]
+        for addr in domain:
+            with self.lock:
+                mempoolHeight = self.get_local_height() + 1
+                out = []
+                for txo, height, value, is_cb in self._get_addr_coins(addr):
+                    if value < min_value:
                         continue
-                    if exclude_frozen and x['is_frozen_coin']:
+                    if (min_height is not None and height < min_height) or (max_height is not None and height > max_height):
                         continue
-                    if confirmed_only and x['height'] <= 0:
+                    if confirmed_only and height <= 0:
                         continue
                     # A note about maturity: Previous versions of Electrum
                     # and Electron Cash were off by one. Maturity is
                     # calculated based off mempool height (chain tip height + 1).
                     # See bitcoind consensus/tx_verify.cpp Consensus::CheckTxInputs
                     # and also txmempool.cpp  CTxMemPool::removeForReorg.
-                    if mature and x['coinbase'] and mempoolHeight - x['height'] < COINBASE_MATURITY:
+                    if mature and is_cb and mempoolHeight - height < COINBASE_MATURITY:
                         continue
-                    coins.append(x)
-                if addr_set_out is not None and len(coins) > len_before:
-                    # add this address to the address set if it has results
-                    addr_set_out.add(addr)
-            return coins
+                    is_frozen_coin = txo in self.frozen_coins or txo in self.frozen_coins_tmp
+                    if exclude_frozen and is_frozen_coin:
+                        continue
+                    slp_token = self.slp.token_info_for_txo(txo)  # (token_id_hex, qty) tuple or None
+                    if exclude_slp and slp_token:
+                        continue
+                    prevout_hash, prevout_n = txo.split(':')
+                    out.append({
+                        'address':addr,
+                        'value':value,
+                        'prevout_n':int(prevout_n),
+                        'prevout_hash':prevout_hash,
+                        'height':height,
+                        'coinbase':is_cb,
+                        'is_frozen_coin':is_frozen_coin,
+                        'slp_token':slp_token,
+                    })
+            if out and addr_set_out is not None:
+                # add this address to the address set if it has results
+                addr_set_out.add(addr)
+            yield from out
+
+    def _get_addr_coins(self, address):
+        ''' Returns the _utxo_cache entry of address, computing (and caching)
+        it if need be. Call with self.lock held. '''
+        coins = self._utxo_cache.get(address)
+        if coins is None:
+            coins = [(txo, x['height'], x['value'], x['coinbase'])
+                     for txo, x in self.get_addr_utxo(address).items()]
+            self._utxo_cache[address] = coins
+        return coins
 
     def dummy_address(self):
         return self.get_receiving_addresses()[0]
@@ -1113,6 +1555,9 @@ class Abstract_Wallet(PrintError, SPVDelegate):
 
     def get_balance(self, domain=None, exclude_frozen_coins=False, exclude_frozen_addresses=False):
         if domain is None:
+            result = self._get_wallet_balance(exclude_frozen_coins, exclude_frozen_addresses)
+            if result is not None:
+                return result
             domain = self.get_addresses()
         if exclude_frozen_addresses:
             domain = set(domain) - self.frozen_addresses
@@ -1124,6 +1569,35 @@ class Abstract_Wallet(PrintError, SPVDelegate):
             xx += x
         return cc, uu, xx
 
+    def _get_wallet_balance(self, exclude_frozen_coins, exclude_frozen_addresses):
+        ''' get_balance() of all of the wallet's addresses, from the balance
+        index totals. Only the addresses missing from the index (and the few
+        frozen ones, if excluded) are looked at one by one. Returns None if
+        the index holds anything other than exactly our addresses, in which
+        case the caller must add them up itself. '''
+        with self.lock:
+            addresses = self.get_addresses()
+            uncached = [0] * 6
+            n_uncached = 0
+            for addr in addresses:
+                if addr not in self._addr_bal_cache:
+                    entry = self._get_addr_balance_entry(addr)
+                    if addr not in self._addr_bal_cache:
+                        # coinbase addresses are never cached
+                        n_uncached += 1
+                        for i, e in enumerate(entry):
+                            uncached[i] += e
+            totals, n = self._addr_bal_cache.totals()
+            if n + n_uncached != len(addresses):
+                return None
+            cc, uu, xx, fc, fu, fx = (t + e for t, e in zip(totals, uncached))
+            if exclude_frozen_coins:
+                cc, uu, xx = cc - fc, uu - fu, xx - fx
+            if exclude_frozen_addresses and self.frozen_addresses:
+                c, u, x = self.get_balance(self.frozen_addresses & set(addresses), exclude_frozen_coins)
+                cc, uu, xx = cc - c, uu - u, xx - x
+            return cc, uu, xx
+
     def get_address_history(self, address):
         assert isinstance(address, Address)
         return self._history.get(address, [])
@@ -1227,7 +1701,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
                             # .txid()) which ensures the tx from the server
                             # is not junk.
                             assert prevout_hash == tx.txid(), "txid mismatch"
-                            Transaction.tx_cache_put(tx, prevout_hash)  # will cache a copy
+                            Transaction.tx_cache_put(tx, prevout_hash, persist=self.may_store_txs())  # will cache a copy
                     except Exception as e:
                         self.print_error(f"{me.name}: Error retrieving txid", prevout_hash, ":", repr(e))
                         if not keep_running():  # in case we got a network timeout *and* the wallet was closed
@@ -1338,7 +1812,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
                         # the spend for when the receive tx will arrive into
                         # this function later.
                         put_pruned_txo(ser, tx_hash)
-                    self._addr_bal_cache.pop(addr, None)  # invalidate cache entry
+                    self._invalidate_address(addr)  # invalidate cache entry
                     del dd, prevout_hash, prevout_n, ser
                 elif addr is None:
                     # Unknown/unparsed address.. may be a strange p2sh scriptSig
@@ -1349,7 +1823,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
                     addr2, v = find_in_self_txo(prevout_hash, prevout_n)
                     if addr2 is not None and self.is_mine(addr2):
                         add_to_self_txi(tx_hash, addr2, ser, v)
-                        self._addr_bal_cache.pop(addr2, None)  # invalidate cache entry
+                        self._invalidate_address(addr2)  # invalidate cache entry
                     else:
                         # Not found in self.txo. It may still be one of ours
                         # however since tx's can come in out of order due to
@@ -1401,7 +1875,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
                         d[addr] = l = []
                     l.append((n, v, is_coinbase))
                     del l
-                    self._addr_bal_cache.pop(addr, None)  # invalidate cache entry
+                    self._invalidate_address(addr)  # invalidate cache entry
                 # give v to txi that spends me
                 next_tx = pop_pruned_txo(ser)
                 if next_tx is not None and mine:
@@ -1445,7 +1919,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
                         ser, v = item
                         prev_hash, prev_n = ser.split(':')
                         if prev_hash == tx_hash:
-                            self._addr_bal_cache.pop(addr, None)  # invalidate cache entry
+                            self._invalidate_address(addr)  # invalidate cache entry
                             l.remove(item)
                             self.pruned_txo[ser] = next_tx
                             self.pruned_txo_values.add(next_tx)
@@ -1457,7 +1931,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
             # invalidate addr_bal_cache for outputs involving this tx
             d = self.txo.get(tx_hash, {})
             for addr in d:
-                self._addr_bal_cache.pop(addr, None)  # invalidate cache entry
+                self._invalidate_address(addr)  # invalidate cache entry
 
             try: self.txi.pop(tx_hash)
             except KeyError: self.print_error("tx was not in input history", tx_hash)
@@ -1503,7 +1977,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
                         # storage, it merely removes it from the self.txi
                         # and self.txo dicts
                         self.remove_transaction(tx_hash)
-            self._addr_bal_cache.pop(addr, None)  # unconditionally invalidate cache entry
+            self._invalidate_address(addr)  # unconditionally invalidate cache entry
             self._history[addr] = hist
 
             for tx_hash, tx_height in hist:
@@ -1529,13 +2003,16 @@ class Abstract_Wallet(PrintError, SPVDelegate):
                 if not any(True for x in cur_hist if x[0] == txid):
                     cur_hist.append((txid, 0))
                     self._history[addr] = cur_hist
+                    self._invalidate_address(addr)
 
     TxHistory = namedtuple("TxHistory", "tx_hash, height, conf, timestamp, amount, balance")
 
     def get_history(self, domain=None, *, reverse=False, receives_before_sends=False) -> List[TxHistory]:
         # get domain
         if domain is None:
-            domain = self.get_addresses()
+            # the whole wallet's history is kept up to date in _history_cache
+            with self.lock:
+                return self._history_cache.get_page(self, 0, None, reverse, receives_before_sends)[1]
         # 1. Get the history of each address in the domain, maintain the
         #    delta of a tx as the sum of its deltas on domain addresses
         tx_deltas = defaultdict(int)
@@ -1583,6 +2060,15 @@ class Abstract_Wallet(PrintError, SPVDelegate):
 
         return h2
 
+    def get_history_page(self, start, stop, *, reverse=False, receives_before_sends=False) -> Tuple[int, List[TxHistory]]:
+        ''' Returns (n, items): the length of get_history() of the whole
+        wallet, and its items from index start up to (not including) stop,
+        ordered as get_history() with the same arguments. Only the returned
+        items are built, so a UI or RPC client may ask for just what it
+        shows. '''
+        with self.lock:
+            return self._history_cache.get_page(self, start, stop, reverse, receives_before_sends)
+
     def export_history(self, domain=None, from_timestamp=None, to_timestamp=None, fx=None,
                        show_addresses=False, decimal_point=8,
                        *, fee_calc_timeout=10.0, download_inputs=False,
@@ -1685,6 +2171,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
         # grab history
         h = self.get_history(domain, reverse=True, receives_before_sends=receives_before_sends)
         out = []
+        fiat_todo = []  # (item, value, balance, fee, date), looked up together at the end
 
         n, l = 0, max(1, float(len(h)))
         for tx_hash, height, conf, timestamp, value, balance in h:
@@ -1739,11 +2226,14 @@ class Abstract_Wallet(PrintError, SPVDelegate):
                 item['input_addresses'] = input_addresses
                 item['output_addresses'] = output_addresses
             if fx is not None:
-                date = timestamp_to_datetime(timestamp_safe)
-                item['fiat_value'] = fx.historical_value_str(value, date)
-                item['fiat_balance'] = fx.historical_value_str(balance, date)
-                item['fiat_fee'] = fx.historical_value_str(fee, date)
+                fiat_todo.append((item, value, balance, fee, timestamp_to_datetime(timestamp_safe)))
             out.append(item)
+        if fiat_todo:
+            items, values, balances, fees, dates = zip(*fiat_todo)
+            n = len(items)
+            texts = fx.historical_value_strs(values + balances + fees, dates * 3)
+            for i, item in enumerate(items):
+                item['fiat_value'], item['fiat_balance'], item['fiat_fee'] = texts[i], texts[n + i], texts[2*n + i]
         if progress_callback:
             progress_callback(1.0)  # indicate done, just in case client code expects a 1.0 in order to detect completion
         return out
@@ -2073,6 +2563,16 @@ class Abstract_Wallet(PrintError, SPVDelegate):
             return True
         return False
 
+    def _get_txo_address(self, txo):
+        ''' Returns the Address of our "prevout_hash:n" coin txo, or None if
+        we know no such coin. '''
+        prevout_hash, prevout_n = txo.rsplit(':', 1)
+        for addr, outputs in self.txo.get(prevout_hash, {}).items():
+            for n, v, is_cb in outputs:
+                if str(n) == prevout_n:
+                    return addr
+        return None
+
     def set_frozen_coin_state(self, utxos, freeze, *, temporary=False):
         """Set frozen state of the `utxos` to `freeze`, True or False. `utxos`
         is a (possibly mixed) list of either "prevout:n" strings and/or
@@ -2105,6 +2605,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
             for utxo in utxos:
                 if isinstance(utxo, str):
                     apply_operation(utxo)
+                    self._addr_bal_cache.pop(self._get_txo_address(utxo), None)  # invalidate cache entry
                     ok += 1
                 elif isinstance(utxo, dict):
                     # Note: we could do an is_mine check here for each coin dict here,
@@ -2115,6 +2616,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
                     # where M = number of coins and N = number of addresses.
                     txo = "{}:{}".format(utxo['prevout_hash'], utxo['prevout_n'])
                     apply_operation(txo)
+                    self._addr_bal_cache.pop(utxo['address'], None)  # invalidate cache entry
                     utxo['is_frozen_coin'] = bool(freeze)
                     ok += 1
             if original_size != len(self.frozen_coins):
@@ -2143,16 +2645,25 @@ class Abstract_Wallet(PrintError, SPVDelegate):
         if self.network:
             self.start_pruned_txo_cleaner_thread()
             self.prepare_for_verifier()
+            # The synchronizer (and address derivation, tx deserialization
+            # etc. with it) get a thread per wallet, so that a wallet being
+            # restored doesn't stall the others. The verifier is light and
+            # works with the network's interfaces directly, so it stays on the
+            # network thread.
+            self.job_worker = JobWorker(f"{self.diagnostic_name()}.JobWorker")
+            self.job_worker.start()
             self.verifier = SPV(self.network, self)
-            self.synchronizer = Synchronizer(self, network)
+            self.synchronizer = Synchronizer(self, network, self.job_worker)
             finalization_print_error(self.verifier)
             finalization_print_error(self.synchronizer)
+            network.add_jobs([self.verifier])
             if self.wallet_type == 'rpa':
-                self.rpa_manager = Rpa_manager(self,network)
-                network.add_jobs([self.verifier, self.synchronizer,self.rpa_manager])
+                self.rpa_manager = Rpa_manager(self, network, self.job_worker)
+                self.job_worker.add_jobs([self.synchronizer, self.rpa_manager])
             else:
-                network.add_jobs([self.verifier, self.synchronizer])
+                self.job_worker.add_jobs([self.synchronizer])
             self.cashacct.start(self.network)  # start cashacct network-dependent subsystem, nework.add_jobs, etc
+            self.slp.start(self.network)  # validates the wallet's SLP txs
         else:
             self.verifier = None
             self.synchronizer = None
@@ -2168,17 +2679,28 @@ class Abstract_Wallet(PrintError, SPVDelegate):
             # thread-safe fashion from within the thread where they normally
             # operate on their data structures.
             self.cashacct.stop()
+            self.slp.stop()
             self.synchronizer.save()
             self.synchronizer.release()
             self.verifier.release()
+            if self.rpa_manager:
+                self.rpa_manager.release()
             self.synchronizer = None
             self.verifier = None
             self.rpa_manager = None
+            # the worker runs its jobs one last time for them to release()
+            self.job_worker.stop()
+            if threading.current_thread() is not self.job_worker:
+                self.job_worker.join()
+            self.job_worker = None
             self.stop_pruned_txo_cleaner_thread()
             # Now no references to the syncronizer or verifier
             # remain so they will be GC-ed
             self.storage.put('stored_height', self.get_local_height())
         self.save_network_state()
+        # Leave the whole wallet in its file once closed, for backups and
+        # older versions that do not know about the journal.
+        self.storage.compact()
 
     def save_network_state(self):
         """Save all the objects which are updated by the network thread. This is called
@@ -2296,7 +2818,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
         # First look up an input transaction in the wallet where it
         # will likely be.  If co-signing a transaction it may not have
         # all the input txs, in which case we ask the network.
-        tx = self.transactions.get(tx_hash)
+        tx = self.transactions.get(tx_hash) or Transaction.tx_cache_get(tx_hash)
         if not tx and self.network:
             request = ('blockchain.transaction.get', [tx_hash])
             tx = Transaction(self.network.synchronous_get(request))
@@ -2622,7 +3144,7 @@ class Abstract_Wallet(PrintError, SPVDelegate):
         assert isinstance(address, Address)
         # paranoia, not really necessary -- just want to maintain the invariant that when we modify address history
         # below we invalidate cache.
-        self._addr_bal_cache.pop(address, None)
+        self._invalidate_address(address)
         self.invalidate_address_set_cache()
         if address not in self._history:
             self._history[address] = []
@@ -2633,6 +3155,11 @@ class Abstract_Wallet(PrintError, SPVDelegate):
     def has_password(self):
         return self.storage.get('use_encryption', False)
 
+    def may_store_txs(self):
+        ''' Whether this wallet's txs may go in the shared, unencrypted
+        Network.tx_store: not if the wallet file itself is encrypted. '''
+        return not (self.storage and self.storage.pubkey)
+
     def check_password(self, password):
         self.keystore.check_password(password)
 
@@ -2813,6 +3340,7 @@ class ImportedWalletBase(Simple_Wallet):
                         transactions_new.add(tx_hash)
             transactions_to_remove -= transactions_new
             self._history.pop(address, None)
+            self._invalidate_address(address)
 
             for tx_hash in transactions_to_remove:
                 self.remove_transaction(tx_hash)
@@ -2820,7 +3348,7 @@ class ImportedWalletBase(Simple_Wallet):
                 self.verified_tx.pop(tx_hash, None)
                 self.unverified_tx.pop(tx_hash, None)
                 self.transactions.pop(tx_hash, None)
-                self._addr_bal_cache.pop(address, None)  # not strictly necessary, above calls also have this side-effect. but here to be safe. :)
+                self._invalidate_address(address)  # not strictly necessary, above calls also have this side-effect. but here to be safe. :)
                 if self.verifier:
                     # TX is now gone. Toss its SPV proof in case we have it
                     # in memory. This allows user to re-add PK again and it
@@ -3251,12 +3779,30 @@ class Deterministic_Wallet(Abstract_Wallet):
             self.add_address(address, for_change=for_change)
             return address
 
+    def create_new_addresses(self, for_change, count, save=True):
+        """ Like create_new_address, but derives all count pubkeys at once. """
+        for_change = bool(for_change)
+        with self.lock:
+            addr_list = self.change_addresses if for_change else self.receiving_addresses
+            n = len(addr_list)
+            new_addresses = [self.pubkeys_to_address(x)
+                             for x in self.derive_pubkeys_range(for_change, n, count)]
+            for address in new_addresses:
+                addr_list.append(address)
+                self.add_address(address, for_change=for_change)
+            if save:
+                self.save_addresses()
+            return new_addresses
+
+    def derive_pubkeys_range(self, c, start, count):
+        return [self.derive_pubkeys(c, i) for i in range(start, start + count)]
+
     def synchronize_sequence(self, for_change):
         limit = self.gap_limit_for_change if for_change else self.gap_limit
         while True:
             addresses = self.get_change_addresses() if for_change else self.get_receiving_addresses()
             if len(addresses) < limit:
-                self.create_new_address(for_change, save=False)
+                self.create_new_addresses(for_change, limit - len(addresses), save=False)
                 continue
             if all(map(lambda a: not self.address_is_old(a), addresses[-limit:] )):
                 break
@@ -3333,6 +3879,9 @@ class Simple_Deterministic_Wallet(Simple_Wallet, Deterministic_Wallet):
     def derive_pubkeys(self, c, i):
         return self.keystore.derive_pubkey(c, i)
 
+    def derive_pubkeys_range(self, c, start, count):
+        return self.keystore.derive_pubkey_range(c, start, count)
+
 
 
 
@@ -3368,6 +3917,10 @@ class Multisig_Wallet(Deterministic_Wallet):
     def derive_pubkeys(self, c, i):
         return [k.derive_pubkey(c, i) for k in self.get_keystores()]
 
+    def derive_pubkeys_range(self, c, start, count):
+        ranges = [k.derive_pubkey_range(c, start, count) for k in self.get_keystores()]
+        return [list(pubkeys) for pubkeys in zip(*ranges)]
+
     def load_keystore(self):
         self.keystores = {}
         for i in range(self.n):
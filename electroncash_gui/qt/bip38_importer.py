@@ -20,6 +20,7 @@ class Bip38Importer(WindowModalDialog, util.PrintError):
     RuntimeError on instantiation. '''
 
     decrypted_sig = pyqtSignal(object, object)  # Decrypt thread emits this with _decrypt_thread.self, (decrypted_wif, Address) or _decrypt_thread.self, () on failure due to bad password
+    others_decrypted_sig = pyqtSignal(object, object)  # Decrypt thread emits this with _decrypt_thread.self, dict of bip38key -> (decrypted_wif, Address) for the other keys a good password also worked on
 
     def __init__(self, bip38_keys, *,
                  parent=None, title=None,
@@ -61,6 +62,7 @@ class Bip38Importer(WindowModalDialog, util.PrintError):
         self.show_count = show_count
 
         self.decrypted_sig.connect(self.on_decrypted)
+        self.others_decrypted_sig.connect(self.on_others_decrypted)
 
         self._setup_ui(message)
 
@@ -198,6 +200,11 @@ class Bip38Importer(WindowModalDialog, util.PrintError):
                 QTimer.singleShot(250, lambda: self.success_cb(self.decoded_keys.copy()))
         else:
             self.clear()
+            # This key may already have been decrypted with the password of an
+            # earlier one, in which case just show the result
+            tup = self.decoded_keys.get(self.bip38_keys[self.cur])
+            if tup:
+                self.decoded_wif, self.decoded_address = tup
             self.refresh()
 
     def reject(self):
@@ -222,22 +229,43 @@ class Bip38Importer(WindowModalDialog, util.PrintError):
             self.decoded_keys[b38key] = (wif, adr)
             self.decoded_wif = wif
             self.decoded_address = adr
+            # Keys to be imported together often share a password, so try this
+            # one on the keys still to come while the user looks at the result
+            others = [k for k in self.bip38_keys[self.cur+1:] if k not in self.decoded_keys]
+            if others:
+                _decrypt_thread(self, others, sender.pw, many=True)
         else:
             self.decoded_keys.pop(b38key, None)
             self.decoded_wif = 'bad'
             self.decoded_address = 'bad'
         self.refresh()
 
+    def on_others_decrypted(self, sender, results):
+        if not self.isVisible():
+            return
+        for b38key, tup in results.items():
+            if b38key in self.bip38_keys[self.cur:]:
+                self.decoded_keys.setdefault(b38key, tup)
+        cur_key = self.bip38_keys[self.cur]
+        if cur_key in results and not self.pw_le.text():
+            # the user moved on to this key before we were done with it
+            self.decoded_wif, self.decoded_address = self.decoded_keys[cur_key]
+            self.refresh()
+
 class _decrypt_thread(threading.Thread, util.PrintError):
     ''' Helper for the above Bip38Importer class. Does the computationally
     expensive scrypt-based decode of a bip38 key in another thread in order to
     keep the GUI responsive. Note that we create a new one of these each time
     the user edits the password text edit, and the old ones continue to run
     until they complete, at which point they emit the decrypted_sig.  Only
-    the most recent decrypt_thread's results are accepted by the dialog, however.'''
+    the most recent decrypt_thread's results are accepted by the dialog, however.
 
-    def __init__(self, w, key, pw):
-        super().__init__(daemon=True, target=self.decrypt)
+    With many=True, `key` is a list of keys to try the password on all at once
+    with bitcoin.bip38_decrypt_many, and others_decrypted_sig is emitted with
+    a dict of the keys it worked on.'''
+
+    def __init__(self, w, key, pw, *, many=False):
+        super().__init__(daemon=True, target=self.decrypt_many if many else self.decrypt)
         self.w = util.Weak.ref(w)  # We keep a weak ref to parent because parent may die while we are still running. In which case we don't want to call into parent when it's already closed/done executing
         self.key = key
         self.pw = pw
@@ -250,3 +278,10 @@ class _decrypt_thread(threading.Thread, util.PrintError):
             parent.decrypted_sig.emit(self, result)
         else:
             self.print_error("parent widget was no longer alive, silently ignoring...")
+
+    def decrypt_many(self):
+        results = bitcoin.bip38_decrypt_many(self.key, self.pw)
+        decrypted = {k: tup for k, tup in zip(self.key, results) if tup}
+        parent = self.w()
+        if parent and decrypted:
+            parent.others_decrypted_sig.emit(self, decrypted)
@@ -76,8 +76,9 @@ class HistoryList(MyTreeWidget):
         self.update_headers(headers)
 
     def get_domain(self):
-        '''Replaced in address_dialog.py'''
-        return self.wallet.get_addresses()
+        '''Replaced in address_dialog.py. None is the whole wallet, whose
+        history the wallet keeps cached.'''
+        return None
 
     @rate_limited(1.0, classlevel=True, ts_after=True) # We rate limit the history list refresh no more than once every second, app-wide
     def update(self):
@@ -120,6 +121,7 @@ class HistoryList(MyTreeWidget):
         self.has_unknown_balances = False
         fx = self.parent.fx
         if fx: fx.history_used_spot = False
+        fiat = self._get_fiat_texts(h, fx)
         for h_item in h:
             tx_hash, height, conf, timestamp, value, balance = h_item
             label = self.wallet.get_label(tx_hash)
@@ -143,10 +145,11 @@ class HistoryList(MyTreeWidget):
             balance_str = self.parent.format_amount(balance, whitespaces=True)
             entry = ['', tx_hash, status_str, label, v_str, balance_str]
             if fx and fx.show_history():
-                date = timestamp_to_datetime(time.time() if conf <= 0 else timestamp)
-                for amount in [value, balance]:
-                    text = fx.historical_value_str(amount, date)
-                    entry.append(text)
+                texts = fiat.get(tx_hash)
+                if texts is None:
+                    date = timestamp_to_datetime(time.time() if conf <= 0 else timestamp)
+                    texts = [fx.historical_value_str(amount, date) for amount in [value, balance]]
+                entry.extend(texts)
             item = SortableTreeWidgetItem(entry)
             if icon: item.setIcon(0, icon)
             item.setToolTip(0, str(conf) + " confirmation" + ("s" if conf != 1 else ""))
@@ -171,6 +174,23 @@ class HistoryList(MyTreeWidget):
                 # which must do a linear search in the tree (wastefully)
                 item.setSelected(True)
 
+    @staticmethod
+    def _get_fiat_texts(h, fx):
+        ''' Looks up the historical rates of the whole history at once.
+        Returns a dict of tx_hash -> fiat amount and balance texts. '''
+        if not h or not fx or not fx.show_history():
+            return {}
+        now = time.time()
+        todo, dates = [], []
+        for h_item in h:
+            tx_hash, height, conf, timestamp, value, balance = h_item
+            date = timestamp_to_datetime(now if conf <= 0 else timestamp)
+            if date is not None:
+                todo.append(h_item)
+                dates.append(date)
+        texts = fx.historical_value_strs([h_item[4] for h_item in todo] + [h_item[5] for h_item in todo], dates * 2)
+        return {h_item[0]: (texts[i], texts[len(todo) + i]) for i, h_item in enumerate(todo)}
+
     def on_doubleclick(self, item, column):
         if self.permit_edit(item, column):
             super(HistoryList, self).on_doubleclick(item, column)
@@ -18,6 +18,7 @@ from electroncash.util import UserCancelled, InvalidPassword, finalization_print
 from electroncash.base_wizard import BaseWizard
 from electroncash.i18n import _
 from electroncash.wallet import Standard_Wallet
+from electroncash.storage import delete_wallet_file
 
 from .seed_dialog import SeedLayout, KeysLayout
 from .network_dialog import NetworkChoiceLayout
@@ -256,7 +257,7 @@ class InstallWizard(QDialog, MessageBoxMixin, BaseWizard):
             file_list = '\n'.join(self.storage.split_accounts())
             msg = _('Your accounts have been moved to') + ':\n' + file_list + '\n\n'+ _('Do you want to delete the old file') + ':\n' + path
             if self.question(msg):
-                os.remove(path)
+                delete_wallet_file(path)
                 self.show_warning(_('The file was removed'))
             return
 
@@ -276,7 +277,7 @@ class InstallWizard(QDialog, MessageBoxMixin, BaseWizard):
                     "Do you want to complete its creation now?").format(path)
             if not self.question(msg):
                 if self.question(_("Do you want to delete '{}'?").format(path)):
-                    os.remove(path)
+                    delete_wallet_file(path)
                     self.show_warning(_('The file was removed'))
                 return
             self.show()
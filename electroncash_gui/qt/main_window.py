@@ -44,7 +44,7 @@ from PyQt5.QtWidgets import *
 
 from electroncash import keystore, get_config
 from electroncash.address import Address, AddressError, ScriptOutput
-from electroncash.bitcoin import COIN, TYPE_ADDRESS, TYPE_SCRIPT
+from electroncash.bitcoin import COIN, TYPE_ADDRESS, TYPE_SCRIPT, PwDecoder
 from electroncash import networks
 from electroncash.plugins import run_hook
 from electroncash.i18n import _, ngettext, pgettext
@@ -590,7 +590,7 @@ class ElectrumWindow(QMainWindow, MessageBoxMixin, PrintError):
 
 
     def backup_wallet(self):
-        self.wallet.storage.write()  # make sure file is committed to disk
+        self.wallet.storage.compact()  # make sure the whole wallet is in the file
         path = self.wallet.storage.path
         wallet_folder = os.path.dirname(path)
         filename, __ = QFileDialog.getSaveFileName(self, _('Enter a filename for the copy of your wallet'), wallet_folder)
@@ -3612,6 +3612,17 @@ class ElectrumWindow(QMainWindow, MessageBoxMixin, PrintError):
         addresses = self.wallet.get_addresses()
         stop = False
         def privkeys_thread():
+            # Derive the decryption key once for all addresses; the session
+            # outlives the artificial per-key delay below.
+            with PwDecoder(password, lifetime=60.0 + 0.2 * len(addresses)) as pw:
+                privkeys_loop(pw)
+            if stop:
+                return
+            strong_d = weak_d()
+            if strong_d:
+                strong_d.show_privkeys_signal.emit()
+
+        def privkeys_loop(password):
             for addr in addresses:
                 if not bip38:
                     # This artificial sleep is likely a security / paranoia measure
@@ -3637,11 +3648,6 @@ class ElectrumWindow(QMainWindow, MessageBoxMixin, PrintError):
                         return
                 finally:
                     del strong_d
-            if stop:
-                return
-            strong_d = weak_d()
-            if strong_d:
-                strong_d.show_privkeys_signal.emit()
 
         def show_privkeys():
             nonlocal stop
@@ -3805,10 +3811,8 @@ class ElectrumWindow(QMainWindow, MessageBoxMixin, PrintError):
     def plot_history_dialog(self):
         if plot_history is None:
             return
-        wallet = self.wallet
-        history = wallet.get_history()
-        if len(history) > 0:
-            plt = plot_history(self.wallet, history)
+        if self.wallet.get_history_page(0, 0)[0] > 0:
+            plt = plot_history(self.wallet)
             plt.show()
 
     def is_fetch_input_data(self):
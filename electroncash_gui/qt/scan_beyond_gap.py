@@ -21,14 +21,16 @@
 # ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 # CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 # SOFTWARE.
+import queue
 import threading
+import time
 
 from PyQt5.QtGui import *
 from PyQt5.QtCore import *
 from PyQt5.QtWidgets import *
 
 from .util import *
-from electroncash.util import PrintError, ServerError
+from electroncash.util import PrintError, ServerError, TimeoutException
 from electroncash.i18n import _
 
 class ScanBeyondGap(WindowModalDialog, PrintError):
@@ -65,6 +67,16 @@ class ScanBeyondGap(WindowModalDialog, PrintError):
         hbox.addWidget(self.which_cb)
         hbox.addStretch(1)
         vbox.addLayout(hbox)
+        hbox = QHBoxLayout()
+        l = QLabel(_("Stop after this many unused addresses in a row:"))
+        hbox.addWidget(l)
+        self.gap_sb = QSpinBox(); self.gap_sb.setMinimum(0); self.gap_sb.setMaximum(1000000);
+        self.gap_sb.setSpecialValueText(_("Never"))
+        self.gap_sb.setValue(0)
+        self.gap_sb.setToolTip(_("Once this many addresses after the last one found have no history, stop scanning that address sequence early"))
+        hbox.addWidget(self.gap_sb)
+        hbox.addStretch(1)
+        vbox.addLayout(hbox)
         self.prog = QProgressBar(); self.prog.setMinimum(0); self.prog.setMaximum(100);
         vbox.addWidget(self.prog)
         self.prog_label = QLabel()
@@ -80,7 +92,7 @@ class ScanBeyondGap(WindowModalDialog, PrintError):
         self.scan_but.clicked.connect(self.scan)
 
         self.thread = threading.Thread(target=self.scan_thread, daemon=True)
-        self._thread_args = (None,) * 2
+        self._thread_args = (None,) * 3
         self.stop_flag = False
         self.canceling = False
         self.stage2 = False
@@ -124,10 +136,12 @@ class ScanBeyondGap(WindowModalDialog, PrintError):
         self.found_label.setVisible(False)
         self.which_cb.setDisabled(True)
         self.num_sb.setDisabled(True)
+        self.gap_sb.setDisabled(True)
         self.found_label.setText('')
         total = self.num_sb.value()
         which = self.which_cb.currentIndex()
-        self._thread_args = (total, which)
+        stop_gap = self.gap_sb.value()
+        self._thread_args = (total, which, stop_gap)
         self.thread.start()
 
     def progress_slot(self, pct, scanned, total, found):
@@ -181,17 +195,49 @@ class ScanBeyondGap(WindowModalDialog, PrintError):
             self.progress_sig.emit(added*100//total, added, total, None)
         return added
 
-    def _addr_has_history(self, address, network):
-        return bool(network.synchronous_get(('blockchain.scripthash.get_history', [address.to_scripthash_hex()]), timeout=5))
+    # Addresses derived, and whose histories are asked for, at a time for each
+    # of the receiving/change sequences. The requests of a window are all
+    # queued at once, so the interface sends them in JSON-RPC batches, and
+    # the next window is queued before waiting on the answers to the last.
+    window = 200
+
+    def _request_histories(self, addresses, network):
+        ''' Queues a get_history request for each of addresses. Returns the
+        queue the responses arrive on. '''
+        q = queue.Queue()
+        network.send([('blockchain.scripthash.get_history', [address.to_scripthash_hex()])
+                      for address in addresses], q.put)
+        return q
+
+    def _wait_for_histories(self, addresses, q, timeout=30):
+        ''' Returns whether each of addresses has a history, or None if the
+        scan was stopped in the meantime. '''
+        index = {address.to_scripthash_hex(): i for i, address in enumerate(addresses)}
+        has_history = [None] * len(addresses)
+        deadline = time.time() + timeout
+        for _ in addresses:
+            while True:
+                if self.stop_flag:
+                    return None
+                try:
+                    r = q.get(True, 0.25)
+                    break
+                except queue.Empty:
+                    if time.time() > deadline:
+                        raise TimeoutException('Server did not answer')
+            if r.get('error'):
+                raise ServerError(r.get('error'))
+            has_history[index[r.get('params')[0]]] = bool(r.get('result'))
+            deadline = time.time() + timeout
+        return has_history
 
     def scan_thread(self):
-        total, which = self._thread_args
-        assert total is not None and which is not None
+        total, which, stop_gap = self._thread_args
+        assert total is not None and which is not None and stop_gap is not None
         wallet = self.main_window.wallet
         network = wallet.network
         assert network
         found = []
-        searched = 0
         recv_begin = len(wallet.get_receiving_addresses())
         change_begin = len(wallet.get_change_addresses())
         paths = (False, recv_begin), (True, change_begin)
@@ -200,24 +246,54 @@ class ScanBeyondGap(WindowModalDialog, PrintError):
             paths = paths[:1]
         elif which == 2:
             paths = paths[1:]
-        total *= len(paths)  # if change & addresses, will be * 2, otherwise * 1
-        i, ct = 0, 0
+        per_path = total
+        # How far each sequence will be scanned, less than per_path for one
+        # stopped early because of stop_gap
+        ends = {is_change: per_path for is_change, _ in paths}
+        runs = {is_change: 0 for is_change, _ in paths}  # addresses without history since the last found
+
+        def request_window(i):
+            requests = []
+            for is_change, start in paths:
+                if i >= ends[is_change]:
+                    continue
+                count = min(self.window, ends[is_change] - i)
+                addresses = [wallet.pubkeys_to_address(pks)
+                             for pks in wallet.derive_pubkeys_range(is_change, start + i, count)]
+                self.print_error("Scanning:", len(addresses), "(Change)" if is_change else "(Receiving)", "addresses from", start + i)
+                requests.append((is_change, i, start + i, addresses, self._request_histories(addresses, network)))
+            return requests
+
+        ct = 0
         try:
-            self.progress_sig.emit(0, 0, total, 0)  # initial clear of status text to indicate we began
-            while not self.stop_flag and ct < total:
-                for is_change, start in paths:
-                    n = start + i
-                    pks = wallet.derive_pubkeys(is_change, n)
-                    addr = wallet.pubkeys_to_address(pks)
-                    self.print_error("Scanning:", addr, "(Change)" if is_change else "(Receiving)", n)
-                    if self.stop_flag:
+            self.progress_sig.emit(0, 0, sum(ends.values()), 0)  # initial clear of status text to indicate we began
+            i = 0
+            pending = request_window(i)
+            while pending and not self.stop_flag:
+                i += self.window
+                next_pending = request_window(i)
+                for is_change, i_window, n, addresses, q in pending:
+                    has_history = self._wait_for_histories(addresses, q)
+                    if has_history is None:
                         return
-                    if self._addr_has_history(addr, network):
-                        self.print_error("FOUND:", addr, "(Change)" if is_change else "(Receiving)", n)
-                        found.append((is_change, n))
-                    ct += 1
+                    for k, hist in enumerate(has_history):
+                        if hist:
+                            self.print_error("FOUND:", addresses[k], "(Change)" if is_change else "(Receiving)", n + k)
+                            found.append((is_change, n + k))
+                            runs[is_change] = 0
+                        else:
+                            runs[is_change] += 1
+                    ct += len(addresses)
+                    if stop_gap and runs[is_change] >= stop_gap and ends[is_change] > i_window + len(addresses):
+                        # The last stop_gap addresses, in order, had no history. Any
+                        # window already requested beyond this one is still looked at.
+                        self.print_error("Stopping early,", runs[is_change], "unused", "(Change)" if is_change else "(Receiving)", "addresses in a row")
+                        ends[is_change] = max(i_window + len(addresses), min(ends[is_change], i + self.window))
+                    total = sum(ends.values())
                     self.progress_sig.emit(ct*100//total, ct, total, len(found))
-                i += 1
+                pending = next_pending
+            if self.stop_flag:
+                return
             added = 0
             if found:
                 added = self._add_addresses(found)
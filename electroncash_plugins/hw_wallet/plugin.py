@@ -24,6 +24,8 @@
 # CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 # SOFTWARE.
 
+from concurrent.futures import ThreadPoolExecutor
+
 from electroncash.plugins import BasePlugin, hook
 from electroncash.i18n import _, ngettext
 from electroncash import Transaction
@@ -124,6 +126,42 @@ def validate_op_return_output_and_get_data(output: tuple,        # tuple(typ, 'a
 
     return data
 
+def show_signing_progress(handler, i, n, message=None):
+    ''' Tells the user input i (0-based) of n is being worked on. Handlers
+    that can do so update the message already shown rather than opening a
+    new dialog for each input. '''
+    if handler is None:
+        return
+    msg = (message or _('Signing input {} of {}...')).format(i + 1, n)
+    update = getattr(handler, 'update_message', None)
+    if update:
+        update(msg)
+    else:
+        handler.show_message(msg)
+
+
+def pipelined(items, prepare, *, handler=None, message=None):
+    ''' Yields (item, prepare(item)) for each of items, in order, calling
+    prepare() for the next item on a background thread while the caller
+    works on the current one. The host side work of signing an input
+    (parsing its previous tx, serializing its preimage, ...) thus overlaps
+    the device round trip of the input before it, rather than adding to it.
+
+    If handler is given, progress is reported on it as each item is reached
+    (see show_signing_progress). prepare() must not talk to the device. '''
+    items = list(items)
+    if not items:
+        return
+    with ThreadPoolExecutor(max_workers=1, thread_name_prefix='hw_prepare') as executor:
+        future = executor.submit(prepare, items[0])
+        for i, item in enumerate(items):
+            prepared = future.result()
+            if i + 1 < len(items):
+                future = executor.submit(prepare, items[i + 1])
+            show_signing_progress(handler, i, len(items), message)
+            yield item, prepared
+
+
 def only_hook_if_libraries_available(func):
     # note: this decorator must wrap @hook, not the other way around,
     # as 'hook' uses the name of the function it wraps
@@ -48,6 +48,7 @@ class QtHandlerBase(QObject, PrintError):
     query_signal = pyqtSignal(object, object)
     yes_no_signal = pyqtSignal(object)
     status_signal = pyqtSignal(object)
+    update_message_signal = pyqtSignal(object)
 
     def __init__(self, win, device):
         super(QtHandlerBase, self).__init__()
@@ -55,6 +56,7 @@ class QtHandlerBase(QObject, PrintError):
         self.error_signal.connect(self.error_dialog)
         self.warning_signal.connect(self.warning_dialog)
         self.message_signal.connect(self.message_dialog)
+        self.update_message_signal.connect(self.update_message_dialog)
         self.passphrase_signal.connect(self.passphrase_dialog)
         self.word_signal.connect(self.word_dialog)
         self.query_signal.connect(self.win_query_choice)
@@ -63,6 +65,7 @@ class QtHandlerBase(QObject, PrintError):
         self.win = win
         self.device = device
         self.dialog = None
+        self.dialog_label = None
         self.done = threading.Event()
 
     def top_level_window(self):
@@ -91,6 +94,9 @@ class QtHandlerBase(QObject, PrintError):
     def show_message(self, msg, on_cancel=None):
         self.message_signal.emit(msg, on_cancel)
 
+    def update_message(self, msg):
+        self.update_message_signal.emit(msg)
+
     def show_error(self, msg):
         self.error_signal.emit(msg)
 
@@ -152,7 +158,7 @@ class QtHandlerBase(QObject, PrintError):
         self.clear_dialog()
         title = _('Please check your {} device').format(self.device)
         self.dialog = dialog = WindowModalDialog(self.top_level_window(), title)
-        l = QLabel(msg)
+        self.dialog_label = l = QLabel(msg)
         vbox = QVBoxLayout(dialog)
         vbox.addWidget(l)
         if on_cancel:
@@ -160,6 +166,16 @@ class QtHandlerBase(QObject, PrintError):
             vbox.addLayout(Buttons(CancelButton(dialog)))
         dialog.show()
 
+    def update_message_dialog(self, msg):
+        # Called for each input while signing; reuses the dialog if it is up
+        if self.dialog and self.dialog_label:
+            try:
+                self.dialog_label.setText(msg)
+                return
+            except RuntimeError:
+                pass  # the label was already deleted
+        self.message_dialog(msg, None)
+
     def error_dialog(self, msg):
         self.win.show_error(msg, parent=self.top_level_window())
 
@@ -172,6 +188,7 @@ class QtHandlerBase(QObject, PrintError):
             try: self.dialog.accept()
             except RuntimeError: pass  # closes #1437. Yes, this is a band-aid but it's clean-up code anyway and so it doesn't matter. I also was unable to track down how it could ever happen.
             self.dialog = None
+        self.dialog_label = None
 
     def win_query_choice(self, msg, labels):
         self.choice = self.win.query_choice(msg, labels)
@@ -327,6 +327,7 @@ class KeepKeyPlugin(HW_PluginBase):
 
     def sign_transaction(self, keystore, tx, prev_tx, xpub_path):
         self.prev_tx = prev_tx
+        self.prev_txtype = {}
         self.xpub_path = xpub_path
         client = self.get_client(keystore)
         inputs = self.tx_inputs(tx, True)
@@ -503,7 +504,10 @@ class KeepKeyPlugin(HW_PluginBase):
             o.script_pubkey = bfh(vout['scriptPubKey'])
         return t
 
-    # This function is called from the TREZOR libraries (via tx_api)
+    # This function is called from the TREZOR libraries (via tx_api), once
+    # per input spending tx_hash, so the conversion is done only once
     def get_tx(self, tx_hash):
-        tx = self.prev_tx[tx_hash]
-        return self.electrum_tx_to_txtype(tx)
+        t = self.prev_txtype.get(tx_hash)
+        if t is None:
+            t = self.prev_txtype[tx_hash] = self.electrum_tx_to_txtype(self.prev_tx[tx_hash])
+        return t
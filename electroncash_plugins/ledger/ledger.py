@@ -12,7 +12,8 @@ from electroncash.plugins import BasePlugin
 from electroncash.keystore import Hardware_KeyStore
 from electroncash.transaction import Transaction
 from ..hw_wallet import HW_PluginBase
-from ..hw_wallet.plugin import is_any_tx_output_on_change_branch, validate_op_return_output_and_get_data
+from ..hw_wallet.plugin import (is_any_tx_output_on_change_branch, validate_op_return_output_and_get_data,
+                                pipelined, show_signing_progress)
 from electroncash.util import print_error, is_verbose, bfh, bh2u, versiontuple
 
 try:
@@ -444,20 +445,29 @@ class Ledger_KeyStore(Hardware_KeyStore):
                 else:
                     output = address
 
-        self.handler.show_message(_('Confirm Transaction on your {}...').format(self.device))
+        confirm_msg = _('Confirm Transaction on your {}...').format(self.device)
+        self.handler.show_message(confirm_msg)
         try:
-            # Get trusted inputs from the original transactions
-            for utxo in inputs:
+            # Get trusted inputs from the original transactions. Each of them
+            # is parsed once however many of its outputs are spent, and the
+            # next one is parsed while the device works on the current one.
+            parsed = {}
+            def parse_prev_tx(utxo):
+                txtmp = parsed.get(utxo[3])
+                if txtmp is None:
+                    txtmp = parsed[utxo[3]] = bitcoinTransaction(bfh(utxo[0]))
+                return txtmp
+            trusted = self.get_client_electrum().requires_trusted_inputs()
+            for utxo, txtmp in pipelined(inputs, parse_prev_tx, handler=trusted and self.handler or None,
+                                         message=_('Reading input {} of {}...')):
                 sequence = int_to_hex(utxo[5], 4)
-                if not self.get_client_electrum().requires_trusted_inputs():
-                    txtmp = bitcoinTransaction(bfh(utxo[0]))
+                if not trusted:
                     tmp = bfh(utxo[3])[::-1]
                     tmp += bfh(int_to_hex(utxo[1], 4))
                     tmp += txtmp.outputs[utxo[1]].amount
                     chipInputs.append({'value' : tmp, 'witness' : True, 'sequence' : sequence})
                     redeemScripts.append(bfh(utxo[2]))
                 else:
-                    txtmp = bitcoinTransaction(bfh(utxo[0]))
                     trustedInput = self.get_client().getTrustedInput(txtmp, utxo[1])
                     trustedInput['sequence'] = sequence
                     trustedInput['witness'] = True
@@ -467,6 +477,9 @@ class Ledger_KeyStore(Hardware_KeyStore):
                     else:
                         redeemScripts.append(txtmp.outputs[utxo[1]].script)
 
+            if trusted:
+                self.handler.show_message(confirm_msg)
+
             # Sign all inputs
             inputIndex = 0
             self.get_client().enableAlternate2fa(False)
@@ -490,6 +503,7 @@ class Ledger_KeyStore(Hardware_KeyStore):
                     raise UserWarning()
                 self.handler.show_message(_('Confirmed. Signing Transaction...'))
             while inputIndex < len(inputs):
+                show_signing_progress(self.handler, inputIndex, len(inputs))
                 singleInput = [ chipInputs[inputIndex] ]
                 if cashaddr and self.get_client_electrum().supports_cashaddr():
                     self.get_client().startUntrustedTransaction(False, 0, singleInput,
@@ -20,6 +20,7 @@ from electroncash.bitcoin import serialize_xpub
 from electroncash_gui.qt.qrcodewidget import QRCodeWidget, QRDialog
 
 from ..hw_wallet import HW_PluginBase
+from ..hw_wallet.plugin import pipelined
 
 try:
     #pysatochip
@@ -369,111 +370,121 @@ class Satochip_KeyStore(Hardware_KeyStore):
         self.print_error('sign_transaction(): outputs= ', txOutputs) #debugSatochip
 
         # Fetch inputs of the transaction to sign
-        derivations = self.get_tx_derivations(tx)
-        for i,txin in enumerate(tx.inputs()):
-            self.print_error('sign_transaction(): input =', i) #debugSatochip
-            self.print_error('sign_transaction(): input[type]:', txin['type']) #debugSatochip
-            if txin['type'] == 'coinbase':
-                self.give_error("Coinbase not supported")     # should never happen
-
-            if txin['type'] in ['p2sh']:
-                p2shTransaction = True
-
-
-            pubkeys, x_pubkeys = tx.get_sorted_pubkeys(txin)
-            for j, x_pubkey in enumerate(x_pubkeys):
-                self.print_error('sign_transaction(): forforloop: j=', j) #debugSatochip
-                if tx.is_txin_complete(txin):
-                    break
-
-                if x_pubkey in derivations:
-                    signingPos = j
-                    s = derivations.get(x_pubkey)
-                    address_path = "%s/%d/%d" % (self.get_derivation()[2:], s[0], s[1])
-
-                    # get corresponing extended key
-                    (depth, bytepath)= bip32path2bytes(address_path)
-                    (key, chaincode)=client.cc.card_bip32_get_extendedkey(bytepath)
-
-                    # parse tx
-                    pre_tx_hex= tx.serialize_preimage(i)
-                    pre_tx= bytes.fromhex(pre_tx_hex)# hex representation => converted to bytes
-                    pre_hash = Hash(bfh(pre_tx_hex))
-                    pre_hash_hex= pre_hash.hex()
-                    self.print_error('sign_transaction(): pre_tx_hex=', pre_tx_hex) #debugSatochip
-                    self.print_error('sign_transaction(): pre_hash=', pre_hash_hex) #debugSatochip
-                    #(response, sw1, sw2) = client.cc.card_parse_transaction(pre_tx, True) # use 'True' since BCH use BIP143 as in Segwit...
-                    #print_error('[satochip] sign_transaction(): response= '+str(response)) #debugSatochip
-                    #(tx_hash, needs_2fa) = client.parser.parse_parse_transaction(response)
-                    (response, sw1, sw2, tx_hash, needs_2fa) = client.cc.card_parse_transaction(pre_tx, True) # use 'True' since BCH use BIP143 as in Segwit...
-                    tx_hash_hex= bytearray(tx_hash).hex()
-                    if pre_hash_hex!= tx_hash_hex:
-                        raise RuntimeError(f"[Satochip_KeyStore] Tx preimage mismatch: {pre_hash_hex} vs {tx_hash_hex}")
-
-                    # sign tx
-                    keynbr= 0xFF #for extended key
-                    if needs_2fa:
-                        # format & encrypt msg
-                        import json
-                        coin_type= 145 #see https://github.com/satoshilabs/slips/blob/master/slip-0044.md
-                        test_net= networks.net.TESTNET
-                        msg= {'action':"sign_tx", 'tx':pre_tx_hex, 'ct':coin_type, 'sw':True, 'tn':test_net, 'txo':txOutputs, 'ty':txin['type']}
-                        msg=  json.dumps(msg)
-                        (id_2FA, msg_out)= client.cc.card_crypt_transaction_2FA(msg, True)
-                        d={}
-                        d['msg_encrypt']= msg_out
-                        d['id_2FA']= id_2FA
-                        # self.print_error("encrypted message: "+msg_out)
-                        self.print_error("id_2FA:", id_2FA)
-
-                        #do challenge-response with 2FA device...
-                        client.handler.show_message('2FA request sent! Approve or reject request on your second device.')
-                        Satochip2FA.do_challenge_response(d)
-                        # decrypt and parse reply to extract challenge response
-                        try:
-                            reply_encrypt= None  # init it in case of exc below
-                            reply_encrypt= d['reply_encrypt']
-                        except Exception as e:
-                            # Note: give_error here will raise again.. :/
-                            self.give_error("No response received from 2FA!", True)
-                            break
-                        if reply_encrypt is None:
-                            #todo: abort tx
-                            break
-                        reply_decrypt= client.cc.card_crypt_transaction_2FA(reply_encrypt, False)
-                        self.print_error("challenge:response=", reply_decrypt)
-                        reply_decrypt= reply_decrypt.split(":")
-                        rep_pre_hash_hex= reply_decrypt[0][0:64]
-                        if rep_pre_hash_hex!= pre_hash_hex:
-                            #todo: abort tx or retry?
-                            self.print_error("Abort transaction: tx mismatch:",rep_pre_hash_hex,"!=",pre_hash_hex)
-                            self.give_error("Transaction aborted: wrong 2FA authorization code!", True)
-                            break
-                        chalresponse=reply_decrypt[1]
-                        if chalresponse=="00"*20:
-                            #todo: abort tx?
-                            self.print_error("Abort transaction: rejected by 2FA!")
-                            self.give_error("Transaction aborted: rejected by 2FA!", True)
-                            break
-                        chalresponse= list(bytes.fromhex(chalresponse))
-                    else:
-                        chalresponse= None
-                    (tx_sig, sw1, sw2) = client.cc.card_sign_transaction(keynbr, tx_hash, chalresponse)
-                    #self.print_error('sign_transaction(): sig=', bytes(tx_sig).hex()) #debugSatochip
-                    #todo: check sw1sw2 for error (0x9c0b if wrong challenge-response)
-                    # enforce low-S signature (BIP 62)
-                    tx_sig = bytearray(tx_sig)
-                    r,s= get_r_and_s_from_der_sig(tx_sig)
-                    if s > CURVE_ORDER//2:
-                        s = CURVE_ORDER - s
-                    tx_sig=der_sig_from_r_and_s(r, s)
-                    #update tx with signature
-                    tx_sig = tx_sig.hex()+'41'
-                    #tx.add_signature_to_txin(i,j,tx_sig)
-                    txin['signatures'][j] = tx_sig
-                    break
-            else:
-                self.give_error("No matching x_key for sign_transaction") # should never happen
+        try:
+            derivations = self.get_tx_derivations(tx)
+            # The preimage of the next input is serialized while the card signs
+            # the current one, sharing the hashes common to all of them
+            tx.calc_common_sighash(use_cache=True)
+            def serialize_preimage(item):
+                i, txin = item
+                return None if tx.is_txin_complete(txin) else tx.serialize_preimage(i, use_cache=True)
+            for (i,txin), pre_tx_hex in pipelined(enumerate(tx.inputs()), serialize_preimage, handler=client.handler):
+                self.print_error('sign_transaction(): input =', i) #debugSatochip
+                self.print_error('sign_transaction(): input[type]:', txin['type']) #debugSatochip
+                if txin['type'] == 'coinbase':
+                    self.give_error("Coinbase not supported")     # should never happen
+
+                if txin['type'] in ['p2sh']:
+                    p2shTransaction = True
+
+
+                pubkeys, x_pubkeys = tx.get_sorted_pubkeys(txin)
+                for j, x_pubkey in enumerate(x_pubkeys):
+                    self.print_error('sign_transaction(): forforloop: j=', j) #debugSatochip
+                    if tx.is_txin_complete(txin):
+                        break
+
+                    if x_pubkey in derivations:
+                        signingPos = j
+                        s = derivations.get(x_pubkey)
+                        address_path = "%s/%d/%d" % (self.get_derivation()[2:], s[0], s[1])
+
+                        # get corresponing extended key
+                        (depth, bytepath)= bip32path2bytes(address_path)
+                        (key, chaincode)=client.cc.card_bip32_get_extendedkey(bytepath)
+
+                        # parse tx
+                        pre_tx= bytes.fromhex(pre_tx_hex)# hex representation => converted to bytes
+                        pre_hash = Hash(bfh(pre_tx_hex))
+                        pre_hash_hex= pre_hash.hex()
+                        self.print_error('sign_transaction(): pre_tx_hex=', pre_tx_hex) #debugSatochip
+                        self.print_error('sign_transaction(): pre_hash=', pre_hash_hex) #debugSatochip
+                        #(response, sw1, sw2) = client.cc.card_parse_transaction(pre_tx, True) # use 'True' since BCH use BIP143 as in Segwit...
+                        #print_error('[satochip] sign_transaction(): response= '+str(response)) #debugSatochip
+                        #(tx_hash, needs_2fa) = client.parser.parse_parse_transaction(response)
+                        (response, sw1, sw2, tx_hash, needs_2fa) = client.cc.card_parse_transaction(pre_tx, True) # use 'True' since BCH use BIP143 as in Segwit...
+                        tx_hash_hex= bytearray(tx_hash).hex()
+                        if pre_hash_hex!= tx_hash_hex:
+                            raise RuntimeError(f"[Satochip_KeyStore] Tx preimage mismatch: {pre_hash_hex} vs {tx_hash_hex}")
+
+                        # sign tx
+                        keynbr= 0xFF #for extended key
+                        if needs_2fa:
+                            # format & encrypt msg
+                            import json
+                            coin_type= 145 #see https://github.com/satoshilabs/slips/blob/master/slip-0044.md
+                            test_net= networks.net.TESTNET
+                            msg= {'action':"sign_tx", 'tx':pre_tx_hex, 'ct':coin_type, 'sw':True, 'tn':test_net, 'txo':txOutputs, 'ty':txin['type']}
+                            msg=  json.dumps(msg)
+                            (id_2FA, msg_out)= client.cc.card_crypt_transaction_2FA(msg, True)
+                            d={}
+                            d['msg_encrypt']= msg_out
+                            d['id_2FA']= id_2FA
+                            # self.print_error("encrypted message: "+msg_out)
+                            self.print_error("id_2FA:", id_2FA)
+
+                            #do challenge-response with 2FA device...
+                            client.handler.show_message('2FA request sent! Approve or reject request on your second device.')
+                            Satochip2FA.do_challenge_response(d)
+                            # decrypt and parse reply to extract challenge response
+                            try:
+                                reply_encrypt= None  # init it in case of exc below
+                                reply_encrypt= d['reply_encrypt']
+                            except Exception as e:
+                                # Note: give_error here will raise again.. :/
+                                self.give_error("No response received from 2FA!", True)
+                                break
+                            if reply_encrypt is None:
+                                #todo: abort tx
+                                break
+                            reply_decrypt= client.cc.card_crypt_transaction_2FA(reply_encrypt, False)
+                            self.print_error("challenge:response=", reply_decrypt)
+                            reply_decrypt= reply_decrypt.split(":")
+                            rep_pre_hash_hex= reply_decrypt[0][0:64]
+                            if rep_pre_hash_hex!= pre_hash_hex:
+                                #todo: abort tx or retry?
+                                self.print_error("Abort transaction: tx mismatch:",rep_pre_hash_hex,"!=",pre_hash_hex)
+                                self.give_error("Transaction aborted: wrong 2FA authorization code!", True)
+                                break
+                            chalresponse=reply_decrypt[1]
+                            if chalresponse=="00"*20:
+                                #todo: abort tx?
+                                self.print_error("Abort transaction: rejected by 2FA!")
+                                self.give_error("Transaction aborted: rejected by 2FA!", True)
+                                break
+                            chalresponse= list(bytes.fromhex(chalresponse))
+                        else:
+                            chalresponse= None
+                        (tx_sig, sw1, sw2) = client.cc.card_sign_transaction(keynbr, tx_hash, chalresponse)
+                        #self.print_error('sign_transaction(): sig=', bytes(tx_sig).hex()) #debugSatochip
+                        #todo: check sw1sw2 for error (0x9c0b if wrong challenge-response)
+                        # enforce low-S signature (BIP 62)
+                        tx_sig = bytearray(tx_sig)
+                        r,s= get_r_and_s_from_der_sig(tx_sig)
+                        if s > CURVE_ORDER//2:
+                            s = CURVE_ORDER - s
+                        tx_sig=der_sig_from_r_and_s(r, s)
+                        #update tx with signature
+                        tx_sig = tx_sig.hex()+'41'
+                        #tx.add_signature_to_txin(i,j,tx_sig)
+                        txin['signatures'][j] = tx_sig
+                        break
+                else:
+                    self.give_error("No matching x_key for sign_transaction") # should never happen
+
+        finally:
+            if client.handler:
+                client.handler.finished()
 
         self.print_error("is_complete", tx.is_complete())
         tx.raw = tx.serialize()
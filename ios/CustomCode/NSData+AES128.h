@@ -20,6 +20,33 @@ NS_ASSUME_NONNULL_BEGIN
 // Decrypts but doesn't strip the PKCS#7 padding from the returned data.
 - (NSData *)AES128DecryptWithKey:(NSData * __nonnull)key initializationVector:(NSData * __nullable)iv keepPadding:(BOOL)keepPadding;
 
+// Streams everything readable from input through AES, writing the result to output, chunkSize
+// bytes at a time (0 for a default of 64KiB). The streams are opened if they aren't already, and
+// left open. With padding, PKCS#7 padding is added when encrypting and stripped when decrypting.
+// Memory use is bounded by chunkSize whatever the size of the data. Returns NO on error.
++ (BOOL)AES128Encrypt:(BOOL)encrypt key:(NSData * __nonnull)key initializationVector:(NSData * __nullable)iv
+              padding:(BOOL)padding input:(NSInputStream * __nonnull)input output:(NSOutputStream * __nonnull)output
+            chunkSize:(NSUInteger)chunkSize;
+
+@end
+
+// An AES-CBC (or ECB, without an IV) CommonCrypto cryptor fed a piece at a time, so that large
+// data can be processed in fixed-size chunks, from any thread, without a copy of the whole of it.
+@interface AES128Cryptor : NSObject
+
+// Returns nil if the key or IV has a bad length or the cryptor can't be created.
+- (nullable instancetype)initForEncryption:(BOOL)encrypt key:(NSData * __nonnull)key
+                      initializationVector:(NSData * __nullable)iv padding:(BOOL)padding;
+
+// Processes the next piece of the data, returning the output it completes (possibly empty), or nil
+// on error. Without padding, the total length fed must be a multiple of 16 bytes.
+- (nullable NSData *)cryptData:(NSData * __nonnull)data;
+- (nullable NSData *)cryptBytes:(const void *)bytes length:(size_t)length;
+
+// Returns the remaining output (the final padded block, when encrypting with padding), or nil on
+// error, such as bad padding when decrypting. The cryptor can't be used afterwards.
+- (nullable NSData *)finish;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -100,4 +100,114 @@
     return [self AES128DecryptWithKey:key initializationVector:iv keepPadding:NO];
 }
 
+static BOOL writeAll(NSOutputStream *output, NSData *data) {
+    const uint8_t *bytes = data.bytes;
+    NSUInteger left = data.length;
+    while (left) {
+        const NSInteger n = [output write:bytes maxLength:left];
+        if (n <= 0) return NO;
+        bytes += n;
+        left -= (NSUInteger)n;
+    }
+    return YES;
+}
+
++ (BOOL)AES128Encrypt:(BOOL)encrypt key:(NSData * __nonnull)key initializationVector:(NSData * __nullable)iv
+              padding:(BOOL)padding input:(NSInputStream * __nonnull)input output:(NSOutputStream * __nonnull)output
+            chunkSize:(NSUInteger)chunkSize {
+    AES128Cryptor *cryptor = [[AES128Cryptor alloc] initForEncryption:encrypt key:key initializationVector:iv padding:padding];
+    if (!cryptor) return NO;
+    if (!chunkSize) chunkSize = 64*1024;
+    if (input.streamStatus == NSStreamStatusNotOpen) [input open];
+    if (output.streamStatus == NSStreamStatusNotOpen) [output open];
+    uint8_t *buffer = malloc(chunkSize);
+    BOOL ok = buffer != NULL;
+    while (ok) {
+        const NSInteger n = [input read:buffer maxLength:chunkSize];
+        if (n < 0) {
+            NSLog(@"AES128Encrypt: read error: %@", input.streamError);
+            ok = NO;
+        } else if (n == 0) {
+            break;
+        } else {
+            NSData *out = [cryptor cryptBytes:buffer length:(size_t)n];
+            ok = out && writeAll(output, out);
+        }
+    }
+    free(buffer);
+    if (ok) {
+        NSData *out = [cryptor finish];
+        ok = out && writeAll(output, out);
+    }
+    return ok;
+}
+
+@end
+
+@implementation AES128Cryptor {
+    CCCryptorRef cryptor;
+}
+
+- (nullable instancetype)initForEncryption:(BOOL)encrypt key:(NSData * __nonnull)key
+                      initializationVector:(NSData * __nullable)iv padding:(BOOL)padding {
+    const size_t keyLength = key.length;
+    if (keyLength != 16 && keyLength != 24 && keyLength != 32) {
+        NSLog(@"AES128Cryptor: key must be exactly 16, 24, or 32 bytes! (got: %d)",(int)keyLength);
+        return nil;
+    }
+    if (iv && iv.length != 16) {
+        NSLog(@"AES128Cryptor: initializationVector must be exactly 16 bytes!");
+        return nil;
+    }
+    if (!(self = [super init])) return nil;
+    CCOptions options = padding ? kCCOptionPKCS7Padding : 0;
+    if (!iv) options |= kCCOptionECBMode;
+    CCCryptorStatus status = CCCryptorCreate(encrypt ? kCCEncrypt : kCCDecrypt, kCCAlgorithmAES128, options,
+                                             key.bytes, keyLength, iv.bytes, &cryptor);
+    if (status != kCCSuccess) {
+        NSLog(@"AES128Cryptor: CCCryptorCreate error (%d)",(int)status);
+        cryptor = NULL;
+        return nil;
+    }
+    return self;
+}
+
+- (void)dealloc {
+    if (cryptor) CCCryptorRelease(cryptor);
+}
+
+- (nullable NSData *)cryptData:(NSData * __nonnull)data {
+    return [self cryptBytes:data.bytes length:data.length];
+}
+
+- (nullable NSData *)cryptBytes:(const void *)bytes length:(size_t)length {
+    if (!cryptor) return nil;
+    const size_t bufferSize = CCCryptorGetOutputLength(cryptor, length, false);
+    NSMutableData *out = [NSMutableData dataWithLength:bufferSize];
+    size_t moved = 0;
+    CCCryptorStatus status = CCCryptorUpdate(cryptor, bytes, length, out.mutableBytes, bufferSize, &moved);
+    if (status != kCCSuccess) {
+        NSLog(@"AES128Cryptor: CCCryptorUpdate error (%d)",(int)status);
+        return nil;
+    }
+    out.length = moved;
+    return out;
+}
+
+- (nullable NSData *)finish {
+    if (!cryptor) return nil;
+    const size_t bufferSize = CCCryptorGetOutputLength(cryptor, 0, true);
+    NSMutableData *out = [NSMutableData dataWithLength:bufferSize];
+    size_t moved = 0;
+    CCCryptorStatus status = CCCryptorFinal(cryptor, out.mutableBytes, bufferSize, &moved);
+    CCCryptorRelease(cryptor);
+    cryptor = NULL;
+    if (status != kCCSuccess) {
+        NSLog(@"AES128Cryptor: CCCryptorFinal error (%d)",(int)status);
+        return nil;
+    }
+    out.length = moved;
+    return out;
+}
+
 @end
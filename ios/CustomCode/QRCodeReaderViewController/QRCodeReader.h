@@ -174,6 +174,28 @@
  */
 @property (readonly) AVCaptureMetadataOutput * _Nonnull metadataOutput;
 
+#pragma mark - Restricting the Scan Area
+/** @name Restricting the Scan Area */
+
+/**
+ * @abstract The area of the preview layer, in its coordinates, where codes
+ * are searched for (typically the viewfinder overlay).
+ * @discussion It is converted to the `rectOfInterest` of the metadata output
+ * each time it is set and when the scan starts, so set it again when the
+ * preview layer is laid out. `CGRectNull` (the default) scans the whole frame.
+ * @since 4.2.0
+ */
+@property (assign, nonatomic) CGRect scanRect;
+
+/**
+ * @abstract The time, in seconds, during which a code equal to the last one
+ * scanned is not reported again. Defaults to 1 second.
+ * @discussion Codes are detected on a private serial queue; only the ones
+ * that pass this filter reach the completion block, on the main queue.
+ * @since 4.2.0
+ */
+@property (assign, nonatomic) NSTimeInterval debounceInterval;
+
 #pragma mark - Managing the Orientation
 /** @name Managing the Orientation */
 
@@ -39,7 +39,14 @@
 
 @end
 
-@implementation QRCodeReader
+@implementation QRCodeReader {
+  // Metadata is delivered and de-bounced on metadataQueue; the session is
+  // started and stopped on sessionQueue since startRunning blocks.
+  dispatch_queue_t _metadataQueue;
+  dispatch_queue_t _sessionQueue;
+  NSString         *_lastResult;     // only touched on _metadataQueue
+  CFAbsoluteTime   _lastResultTime;  // only touched on _metadataQueue
+}
 
 - (id)init
 {
@@ -72,6 +79,11 @@
 
 - (void)setupAVComponents
 {
+  _metadataQueue    = dispatch_queue_create("QRCodeReader.metadata", DISPATCH_QUEUE_SERIAL);
+  _sessionQueue     = dispatch_queue_create("QRCodeReader.session", DISPATCH_QUEUE_SERIAL);
+  _debounceInterval = 1.0;
+  _scanRect         = CGRectNull;
+
   self.defaultDevice = [AVCaptureDevice defaultDeviceWithMediaType:AVMediaTypeVideo];
 
   if (_defaultDevice) {
@@ -117,7 +129,7 @@
     [_session addInput:_defaultDeviceInput];
   }
 
-  [_metadataOutput setMetadataObjectsDelegate:self queue:dispatch_get_main_queue()];
+  [_metadataOutput setMetadataObjectsDelegate:self queue:_metadataQueue];
   NSMutableSet *available = [NSMutableSet setWithArray:[_metadataOutput availableMetadataObjectTypes]];
   NSSet *desired = [NSSet setWithArray:_metadataObjectTypes];
   [available intersectSet:desired];
@@ -169,22 +181,63 @@
 
 - (void)startScanning
 {
-  if (![self.session isRunning]) {
-    [self.session startRunning];
-  }
+  AVCaptureSession *session = self.session;
+  __weak __typeof__(self) weakSelf = self;
+
+  dispatch_async(_sessionQueue, ^{
+    if (![session isRunning]) {
+      [session startRunning];
+    }
+    // The preview layer can only map a rect to the output once frames flow
+    dispatch_async(dispatch_get_main_queue(), ^{
+      [weakSelf applyScanRect];
+    });
+  });
 }
 
 - (void)stopScanning
 {
-  if ([self.session isRunning]) {
-    [self.session stopRunning];
-  }
+  // Don't capture self: this is also called from dealloc of the controller
+  AVCaptureSession *session = self.session;
+
+  dispatch_async(_sessionQueue, ^{
+    if ([session isRunning]) {
+      [session stopRunning];
+    }
+  });
 }
 
 - (BOOL)running {
   return self.session.running;
 }
 
+#pragma mark - Restricting the Scan Area
+
+- (void)setScanRect:(CGRect)scanRect
+{
+  _scanRect = scanRect;
+
+  [self applyScanRect];
+}
+
+- (void)applyScanRect
+{
+  CGRect rectOfInterest = CGRectMake(0, 0, 1, 1);
+
+  if (!CGRectIsNull(_scanRect) && !CGRectIsEmpty(_previewLayer.bounds)) {
+    rectOfInterest = CGRectIntersection([_previewLayer metadataOutputRectOfInterestForRect:_scanRect],
+                                        CGRectMake(0, 0, 1, 1));
+    if (CGRectIsEmpty(rectOfInterest)) {
+      // Not running yet (or the rect is off screen): scan the whole frame for now
+      rectOfInterest = CGRectMake(0, 0, 1, 1);
+    }
+  }
+
+  if (!CGRectEqualToRect(_metadataOutput.rectOfInterest, rectOfInterest)) {
+    _metadataOutput.rectOfInterest = rectOfInterest;
+  }
+}
+
 #pragma mark - Managing the Orientation
 
 + (AVCaptureVideoOrientation)videoOrientationFromInterfaceOrientation:(UIInterfaceOrientation)interfaceOrientation
@@ -270,10 +323,29 @@
         && [_metadataObjectTypes containsObject:current.type]) {
       NSString *scannedResult = [(AVMetadataMachineReadableCodeObject *)current stringValue];
 
-      if (_completionBlock) {
-        _completionBlock(scannedResult);
+      // The same code stays in view for many frames; report it once per
+      // debounceInterval. A different code (e.g. the next frame of an
+      // animated QR) goes through right away.
+      const CFAbsoluteTime now = CFAbsoluteTimeGetCurrent();
+      const BOOL repeated      = scannedResult && [scannedResult isEqualToString:_lastResult]
+                                 && now - _lastResultTime < _debounceInterval;
+      _lastResult     = scannedResult;
+      _lastResultTime = now;
+
+      if (repeated || scannedResult == nil) {
+        break;
       }
 
+      __weak __typeof__(self) weakSelf = self;
+
+      dispatch_async(dispatch_get_main_queue(), ^{
+        void (^completionBlock)(NSString *) = weakSelf.completionBlock;
+
+        if (completionBlock) {
+          completionBlock(scannedResult);
+        }
+      });
+
       break;
     }
   }
@@ -33,4 +33,10 @@
  */
 @interface QRCodeReaderView : UIView
 
+/**
+ * @abstract The square of the overlay, in the view coordinates.
+ * @since 4.2.0
+ */
+@property (nonatomic, readonly) CGRect overlayRect;
+
 @end
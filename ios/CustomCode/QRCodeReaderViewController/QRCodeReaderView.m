@@ -44,7 +44,12 @@
 
 - (void)drawRect:(CGRect)rect
 {
-  CGRect innerRect = CGRectInset(rect, 50, 50);
+  _overlay.path = [UIBezierPath bezierPathWithRoundedRect:self.overlayRect cornerRadius:5].CGPath;
+}
+
+- (CGRect)overlayRect
+{
+  CGRect innerRect = CGRectInset(self.bounds, 50, 50);
 
   CGFloat minSize = MIN(innerRect.size.width, innerRect.size.height);
   if (innerRect.size.width != minSize) {
@@ -56,10 +61,7 @@
     innerRect.size.height = minSize;
   }
 
-  CGRect offsetRect = CGRectOffset(innerRect, 0, 15);
-
-
-  _overlay.path = [UIBezierPath bezierPathWithRoundedRect:offsetRect cornerRadius:5].CGPath;
+  return CGRectOffset(innerRect, 0, 15);
 }
 
 #pragma mark - Private Methods
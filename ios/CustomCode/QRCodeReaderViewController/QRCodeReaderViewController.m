@@ -172,6 +172,14 @@
   _codeReader.previewLayer.frame = self.view.bounds;
 }
 
+- (void)viewDidLayoutSubviews
+{
+  [super viewDidLayoutSubviews];
+
+  // Only look for codes inside the viewfinder square
+  _codeReader.scanRect = [_cameraView.layer convertRect:_cameraView.overlayRect toLayer:_codeReader.previewLayer];
+}
+
 - (BOOL)shouldAutorotate
 {
   return YES;
@@ -23,6 +23,8 @@ typedef NSBezierPath BEZIER_PATH_TYPE;
 
 @property (nonatomic, readonly) CGFloat width;
 @property (nonatomic, readonly) CGFloat height;
+// In SVG units. Instances loaded from the same file, string or data share the parsed paths, so
+// treat them as immutable: scale them with a transform (as UIImage+SVG does) rather than in place.
 @property (nonatomic, readonly) NSArray *beziers;
 
 - (id) initFromSVGFile: (NSString *) filename;
@@ -15,52 +15,94 @@
 #import "RaptureXML/RXMLElement.h"
 
 
-#pragma mark - Token class interface
-
-@interface Token : NSObject {
-	@private
-	unichar        _command;
-	NSMutableArray *_values;
-}
-
-- (id)initWithCommand:(unichar)commandChar;
-- (void)addValue:(CGFloat)value;
-- (CGFloat)parameter:(NSInteger)index;
-- (NSInteger)valence;
-@property(nonatomic, assign) unichar command;
-@end
-
-
-#pragma mark - Token class implementation
-
-@implementation Token
-
-@synthesize command = _command;
-
-
-- (id)initWithCommand:(unichar)commandChar {
-	self = [self init];
-    if (self) {
-		_command = commandChar;
-		_values = [[NSMutableArray alloc] init];
-	}
-	return self;
+#pragma mark - path commands
+
+// One command of a <path> 'd' attribute: its letter, and where its parameters start in the
+// path's values buffer
+typedef struct {
+    char       command;
+    NSUInteger start;
+    NSUInteger count;
+} PathCommand;
+
+// The commands and all their parameters, in two flat growable C buffers
+typedef struct {
+    PathCommand *commands;
+    NSUInteger  ncommands, commandsCapacity;
+    CGFloat     *values;
+    NSUInteger  nvalues, valuesCapacity;
+} PathTokens;
+
+static void pathTokensFree(PathTokens *t)
+{
+    free(t->commands);
+    free(t->values);
+    memset(t, 0, sizeof(*t));
 }
 
-- (void)addValue:(CGFloat)value {
-	[_values addObject:[NSNumber numberWithDouble:value]];
+static void pathTokensAddCommand(PathTokens *t, char command)
+{
+    if (t->ncommands == t->commandsCapacity) {
+        t->commandsCapacity = t->commandsCapacity ? 2 * t->commandsCapacity : 16;
+        t->commands = realloc(t->commands, t->commandsCapacity * sizeof(PathCommand));
+        if (!t->commands) { NSLog(@"*** PocketSVG Error: out of memory"); exit(EXIT_FAILURE); }
+    }
+    PathCommand *c = &t->commands[t->ncommands++];
+    c->command = command;
+    c->start = t->nvalues;
+    c->count = 0;
 }
 
-- (CGFloat)parameter:(NSInteger)index {
-	return [[_values objectAtIndex:index] doubleValue];
+static void pathTokensAddValue(PathTokens *t, CGFloat value)
+{
+    if (t->nvalues == t->valuesCapacity) {
+        t->valuesCapacity = t->valuesCapacity ? 2 * t->valuesCapacity : 64;
+        t->values = realloc(t->values, t->valuesCapacity * sizeof(CGFloat));
+        if (!t->values) { NSLog(@"*** PocketSVG Error: out of memory"); exit(EXIT_FAILURE); }
+    }
+    t->values[t->nvalues++] = value;
+    t->commands[t->ncommands - 1].count++;
 }
 
-- (NSInteger)valence {
-	return [_values count];
+// Scans an SVG number (sign, digits, fraction, exponent) at *p, independently of the locale,
+// advancing *p past it. Returns NO, leaving *p alone, if there is no number there.
+static BOOL scanNumber(const char **p, CGFloat *out)
+{
+    const char *s = *p;
+    double sign = 1, mantissa = 0;
+    int exponent = 0, digits = 0;
+    if (*s == '+' || *s == '-') {
+        if (*s == '-') sign = -1;
+        s++;
+    }
+    for (; *s >= '0' && *s <= '9'; s++, digits++) mantissa = 10 * mantissa + (*s - '0');
+    if (*s == '.') {
+        for (s++; *s >= '0' && *s <= '9'; s++, digits++) {
+            mantissa = 10 * mantissa + (*s - '0');
+            exponent--;
+        }
+    }
+    if (!digits) return NO;
+    if (*s == 'e' || *s == 'E') {
+        const char *e = s + 1;
+        int esign = 1, evalue = 0, edigits = 0;
+        if (*e == '+' || *e == '-') {
+            if (*e == '-') esign = -1;
+            e++;
+        }
+        for (; *e >= '0' && *e <= '9'; e++, edigits++) {
+            if (evalue < 10000) evalue = 10 * evalue + (*e - '0');
+        }
+        if (edigits) {
+            exponent += esign * evalue;
+            s = e;
+        }
+    }
+    *out = (CGFloat)(sign * mantissa * pow(10, exponent));
+    *p = s;
+    return YES;
 }
 
-@end
-
 
 #pragma mark - PocketSVG class private interface
 
@@ -69,30 +111,44 @@
     CGPoint        _lastPoint;
     CGPoint        _lastControlPoint;
     BOOL           _validLastControlPoint;
-    NSCharacterSet *_commandSet;
-    NSMutableArray *_tokens;
 }
 
 - (void)reset;
 
 - (void) parseSVG: (RXMLElement *) rootXML;
+- (BOOL) loadCached: (id) key;
+- (void) storeCached: (id) key;
 
 - (NSArray *) strokesFromXML: (RXMLElement *) root;
 - (BEZIER_PATH_TYPE *) bezierFromPathElement: (RXMLElement *) pathElement;
-- (NSMutableArray *)parsePath:(NSString *)attr;
-- (BEZIER_PATH_TYPE *) generateBezierFromTokens: (NSArray *) tokens;
+- (void)parsePath:(NSString *)attr into:(PathTokens *)tokens;
+- (BEZIER_PATH_TYPE *) generateBezierFromTokens: (const PathTokens *) tokens;
 
-- (void)appendSVGMCommand:(Token *)token toBezier: (BEZIER_PATH_TYPE *) bezier;
-- (void)appendSVGLCommand:(Token *)token toBezier: (BEZIER_PATH_TYPE *) bezier;
-- (void)appendSVGCCommand:(Token *)token toBezier: (BEZIER_PATH_TYPE *) bezier;
-- (void)appendSVGSCommand:(Token *)token toBezier: (BEZIER_PATH_TYPE *) bezier;
+- (void)appendSVGMCommand:(const PathCommand *)token values:(const CGFloat *)values toBezier: (BEZIER_PATH_TYPE *) bezier;
+- (void)appendSVGLCommand:(const PathCommand *)token values:(const CGFloat *)values toBezier: (BEZIER_PATH_TYPE *) bezier;
+- (void)appendSVGCCommand:(const PathCommand *)token values:(const CGFloat *)values toBezier: (BEZIER_PATH_TYPE *) bezier;
+- (void)appendSVGSCommand:(const PathCommand *)token values:(const CGFloat *)values toBezier: (BEZIER_PATH_TYPE *) bezier;
 
 @end
 
 
 #pragma mark - PocketSVG class implementation
 
-NSString* const kCommandCharString = @"CcMmLlHhVvZzqQaAsS";
+static const char kCommandChars[] = "CcMmLlHhVvZzqQaAsS";
+
+// The parsed geometry of each SVG resource (file name, string or data) loaded so far, so that an
+// icon requested in several sizes and colors is parsed once: the paths are in SVG units and are
+// scaled by the renderer with a transform. Values are @[width, height, beziers].
+static NSCache *parsedSVGCache(void)
+{
+    static dispatch_once_t pred;
+    static NSCache *cache = nil;
+    dispatch_once(&pred, ^{
+        cache = [[NSCache alloc] init];
+        cache.countLimit = 64;
+    });
+    return cache;
+}
 
 @implementation PocketSVG
 
@@ -108,12 +164,15 @@ NSString* const kCommandCharString = @"CcMmLlHhVvZzqQaAsS";
     self = [super init];
     if (self)
     {
-		_commandSet = [NSCharacterSet characterSetWithCharactersInString:kCommandCharString];
         [self reset];
-        
-        RXMLElement *rootXML = [RXMLElement elementFromXMLFilename: filename fileExtension: @"svg"];
 
-        [self parseSVG: rootXML];
+        NSString *key = [NSString stringWithFormat:@"file:%@.svg", filename];
+        if (![self loadCached: key]) {
+            RXMLElement *rootXML = [RXMLElement elementFromXMLFilename: filename fileExtension: @"svg"];
+
+            [self parseSVG: rootXML];
+            [self storeCached: key];
+        }
     }
     return self;
 }
@@ -123,12 +182,15 @@ NSString* const kCommandCharString = @"CcMmLlHhVvZzqQaAsS";
     self = [super init];
     if (self)
     {
-		_commandSet = [NSCharacterSet characterSetWithCharactersInString:kCommandCharString];
         [self reset];
-        
-        RXMLElement *rootXML = [RXMLElement elementFromXMLFilename: filename fileExtension: fileExtension];
-        
-        [self parseSVG: rootXML];
+
+        NSString *key = [NSString stringWithFormat:@"file:%@.%@", filename, fileExtension];
+        if (![self loadCached: key]) {
+            RXMLElement *rootXML = [RXMLElement elementFromXMLFilename: filename fileExtension: fileExtension];
+
+            [self parseSVG: rootXML];
+            [self storeCached: key];
+        }
     }
     return self;
 }
@@ -138,7 +200,6 @@ NSString* const kCommandCharString = @"CcMmLlHhVvZzqQaAsS";
     self = [super init];
     if (self)
     {
-		_commandSet = [NSCharacterSet characterSetWithCharactersInString:kCommandCharString];
         [self reset];
         
         [self parseSVG: rootXML];
@@ -151,12 +212,14 @@ NSString* const kCommandCharString = @"CcMmLlHhVvZzqQaAsS";
     self = [super init];
     if (self)
     {
-		_commandSet = [NSCharacterSet characterSetWithCharactersInString:kCommandCharString];
         [self reset];
-        
-        RXMLElement *rootXML = [RXMLElement elementFromXMLData: data];
-        
-        [self parseSVG: rootXML];
+
+        if (![self loadCached: data]) {
+            RXMLElement *rootXML = [RXMLElement elementFromXMLData: data];
+
+            [self parseSVG: rootXML];
+            [self storeCached: data];
+        }
     }
     return self;
 }
@@ -166,18 +229,39 @@ NSString* const kCommandCharString = @"CcMmLlHhVvZzqQaAsS";
     self = [super init];
     if (self)
     {
-		_commandSet = [NSCharacterSet characterSetWithCharactersInString:kCommandCharString];
         [self reset];
-        
-        // we're making an assumption here about string encoding
-        RXMLElement *rootXML = [RXMLElement elementFromXMLString: svgString encoding: NSUTF8StringEncoding];
-        
-        [self parseSVG: rootXML];
+
+        // an SVG document starts with '<', so it can't be mistaken for a "file:" key
+        if (![self loadCached: svgString]) {
+            // we're making an assumption here about string encoding
+            RXMLElement *rootXML = [RXMLElement elementFromXMLString: svgString encoding: NSUTF8StringEncoding];
+
+            [self parseSVG: rootXML];
+            [self storeCached: svgString];
+        }
     }
     return self;
 }
 
 
+// take the geometry parsed earlier from the same resource, if it is still cached
+- (BOOL) loadCached: (id) key
+{
+    NSArray *cached = key ? [parsedSVGCache() objectForKey: key] : nil;
+    if (!cached) return NO;
+    _width = [cached[0] doubleValue];
+    _height = [cached[1] doubleValue];
+    _beziers = cached[2];
+    return YES;
+}
+
+- (void) storeCached: (id) key
+{
+    if (key && _beziers) {
+        [parsedSVGCache() setObject: @[@(_width), @(_height), _beziers] forKey: [key copy]];
+    }
+}
+
 // get ready to parse another path
 - (void) reset
 {
@@ -383,141 +467,68 @@ NSString* const kCommandCharString = @"CcMmLlHhVvZzqQaAsS";
     // get the <path> 'd' attribute
     NSString *pathString = [pathElement attribute: @"d"];
     
-    // parse them into an array of Token objects
-    // one Token for each path command
-    NSArray *tokens = [self parsePath: pathString];
+    // parse it into commands and their parameters
+    PathTokens tokens = {0};
+    [self parsePath: pathString into: &tokens];
     
-    // build a bezier path from the Tokens
-    BEZIER_PATH_TYPE *bezier = [self generateBezierFromTokens: tokens];
+    // build a bezier path from the commands
+    BEZIER_PATH_TYPE *bezier = [self generateBezierFromTokens: &tokens];
+    pathTokensFree(&tokens);
     
     return bezier;
 }
 
-// parse the <path> 'd' attribute
-- (NSMutableArray *)parsePath:(NSString *)attr
+// parse the <path> 'd' attribute, in a single pass over its UTF-8 bytes: a command letter starts a
+// command, and the numbers up to the next one are its parameters, separated by whitespace, commas,
+// or nothing at all where a sign or a second decimal point makes that unambiguous ("1-2", ".5.5")
+- (void)parsePath:(NSString *)attr into:(PathTokens *)tokens
 {
-    //NSLog(@"attributes: %@", attr);
-    
-    // *** first, clean up the 'd' attribute ***
-    // replace all non-space whitespace and commas with space
-    NSError *error = NULL;
-    NSRegularExpression *regex = [NSRegularExpression regularExpressionWithPattern: @"([\t\r\n\f,])" 
-                                                                           options: NSRegularExpressionCaseInsensitive | NSRegularExpressionDotMatchesLineSeparators
-                                                                             error: &error];
-    NSString *newAttr = [regex stringByReplacingMatchesInString: attr
-                                                        options: 0
-                                                          range: NSMakeRange(0, [attr length])
-                                                   withTemplate: @" "];
-    
-    // replace all minus signs with space and minus sign
-    NSRegularExpression *minusRegex = [NSRegularExpression regularExpressionWithPattern: @"(.)-" 
-                                                                                options: NSRegularExpressionCaseInsensitive
-                                                                                  error: &error];    
-    newAttr = [minusRegex stringByReplacingMatchesInString: newAttr
-                                                   options: 0
-                                                     range: NSMakeRange(0, [attr length])
-                                              withTemplate: @"$1 -"];
-    
-    // *** next, match the commands and each command's parameters ***
-    // match command followed by numbers and spaces
-    NSRegularExpression *stringTokenRegex = [NSRegularExpression regularExpressionWithPattern: @"([A-Za-z][0-9-. ]+)"
-                                                                                      options: NSRegularExpressionCaseInsensitive 
-                                                                                        error: &error];
-    NSArray *matches = [stringTokenRegex matchesInString: newAttr
-                                                 options: 0
-                                                   range: NSMakeRange(0, [newAttr length])];
-    
-	if ([matches count] == 0) {
-		NSLog(@"*** PocketSVG Error: No valid path commands found in the \'d\' attribute");
-		exit(EXIT_FAILURE);
-	}
-    
-    // get the matching command strings
-    NSMutableArray *stringTokens = [NSMutableArray arrayWithCapacity: [matches count]];
-    for (NSTextCheckingResult *match in matches) {
-        NSString *result = [newAttr substringWithRange: match.range];
-        [stringTokens addObject: result];
-    }
-
-	/*
-    NSLog(@"tokens:");
-    for (NSString *string in stringTokens)
-    {
-        NSLog(@"%@", string);
-    }
-	 */
-
-	// turn the command strings into Tokens, checking validity of the commands as we go
-	NSMutableArray *tokens = [[NSMutableArray alloc] init];
-    
-    for (NSString *stringToken in stringTokens)
-    {
-        //NSLog(@"parsing: %@", stringToken);
-        
-        // get the command
-        unichar command = [stringToken characterAtIndex:0];
-		if (![_commandSet characterIsMember:command]) {
-			NSLog(@"*** PocketSVG Error: unexpected command %c", command);
-            exit(EXIT_FAILURE);
-		}
-        
-        // get the parameters
-        NSString *parameterString = [stringToken substringFromIndex: 1];
-        NSArray *parameters = [parameterString componentsSeparatedByString: @" "];
-        
-        if ([parameters count] == 0) {
-            NSLog(@"*** PocketSVG Error: no parameters for command %c", command);
-            exit(EXIT_FAILURE);
-        }
-        
-        // create the Token object
-        Token *token = [[Token alloc] initWithCommand:command];
-        
-        //NSLog(@"command: %c", command);
-        
-        // parse the parameters
-        // should be a series of floats
-        for (NSString *parameterString in parameters)
-        {
-            // skip if there was more than one space in a row
-            if ([parameterString length] == 0) {
-                continue;
+    const char *p = [attr UTF8String];
+    if (!p) p = "";
+
+    while (*p) {
+        const char c = *p;
+        if (c == ' ' || c == ',' || c == '\t' || c == '\r' || c == '\n' || c == '\f') {
+            p++;
+        } else if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')) {
+            if (!strchr(kCommandChars, c)) {
+                NSLog(@"*** PocketSVG Error: unexpected command %c", c);
+                exit(EXIT_FAILURE);
             }
-            
-			NSScanner *floatScanner = [NSScanner scannerWithString: parameterString];
-			float value;
-			if (![floatScanner scanFloat:&value]) {
-				NSLog(@"*** PocketSVG Error: Path string parse error: expected float (but found %@).", parameterString);
+            pathTokensAddCommand(tokens, c);
+            p++;
+        } else {
+            CGFloat value;
+            if (!tokens->ncommands || !scanNumber(&p, &value)) {
+                NSLog(@"*** PocketSVG Error: Path string parse error: expected float (but found %c).", c);
                 exit(EXIT_FAILURE);
-			}
-            
-            //NSLog(@"parameter: %f", value);
-            
-            // save the parameter in the Token
-			[token addValue:value];
+            }
+            pathTokensAddValue(tokens, value);
         }
+    }
 
-		[tokens	addObject:token];
+    if (!tokens->ncommands) {
+        NSLog(@"*** PocketSVG Error: No valid path commands found in the \'d\' attribute");
+        exit(EXIT_FAILURE);
     }
-    
-	return [tokens copy];
 }
 
-// build a bezier path from the Tokens
-- (BEZIER_PATH_TYPE *) generateBezierFromTokens: (NSArray *) tokens
+// build a bezier path from the commands
+- (BEZIER_PATH_TYPE *) generateBezierFromTokens: (const PathTokens *) tokens
 {
     BEZIER_PATH_TYPE *bezier = [[BEZIER_PATH_TYPE alloc] init];
     
     // reset the path parsing variables
 	[self reset];
     
-    // parse the commands from each Token
-	for (Token *thisToken in tokens) {
-		unichar command = [thisToken command];
-		switch (command) {
+    // append each command to the path
+	for (NSUInteger i = 0; i < tokens->ncommands; i++) {
+		const PathCommand *thisToken = &tokens->commands[i];
+		const CGFloat *values = tokens->values + thisToken->start;
+		switch (thisToken->command) {
 			case 'M':
 			case 'm':
-				[self appendSVGMCommand:thisToken toBezier: bezier];
+				[self appendSVGMCommand:thisToken values:values toBezier: bezier];
 				break;
 			case 'L':
 			case 'l':
@@ -525,22 +536,22 @@ NSString* const kCommandCharString = @"CcMmLlHhVvZzqQaAsS";
 			case 'h':
 			case 'V':
 			case 'v':
-				[self appendSVGLCommand:thisToken toBezier: bezier];
+				[self appendSVGLCommand:thisToken values:values toBezier: bezier];
 				break;
 			case 'C':
 			case 'c':
-				[self appendSVGCCommand:thisToken toBezier: bezier];
+				[self appendSVGCCommand:thisToken values:values toBezier: bezier];
 				break;
 			case 'S':
 			case 's':
-				[self appendSVGSCommand:thisToken toBezier: bezier];
+				[self appendSVGSCommand:thisToken values:values toBezier: bezier];
 				break;
 			case 'Z':
 			case 'z':
 				[bezier closePath];
 				break;
 			default:
-				NSLog(@"*** PocketSVG Error: Cannot process command : '%c'", command);
+				NSLog(@"*** PocketSVG Error: Cannot process command : '%c'", thisToken->command);
 				break;
 		}
 	}
@@ -550,18 +561,18 @@ NSString* const kCommandCharString = @"CcMmLlHhVvZzqQaAsS";
 
 #pragma mark - build bezier path from svg path commands
 
-- (void)appendSVGMCommand:(Token *)token toBezier: (BEZIER_PATH_TYPE *) bezier
+- (void)appendSVGMCommand:(const PathCommand *)token values:(const CGFloat *)values toBezier: (BEZIER_PATH_TYPE *) bezier
 {
 	_validLastControlPoint = NO;
 	NSInteger index = 0;
 	BOOL first = YES;
-	while (index < [token valence]) {
-		CGFloat x = [token parameter:index] + ([token command] == 'm' ? _lastPoint.x : 0);
-		if (++index == [token valence]) {
+	while (index < (NSInteger)token->count) {
+		CGFloat x = values[index] + (token->command == 'm' ? _lastPoint.x : 0);
+		if (++index == (NSInteger)token->count) {
 			NSLog(@"*** PocketSVG Error: Invalid parameter count in M style token");
 			return;
 		}
-		CGFloat y = [token parameter:index] + ([token command] == 'm' ? _lastPoint.y : 0);
+		CGFloat y = values[index] + (token->command == 'm' ? _lastPoint.y : 0);
 		_lastPoint = CGPointMake(x, y);
 		if (first) {
 			[bezier moveToPoint:_lastPoint];
@@ -578,35 +589,35 @@ NSString* const kCommandCharString = @"CcMmLlHhVvZzqQaAsS";
 	}
 }
 
-- (void)appendSVGLCommand:(Token *)token toBezier: (BEZIER_PATH_TYPE *) bezier
+- (void)appendSVGLCommand:(const PathCommand *)token values:(const CGFloat *)values toBezier: (BEZIER_PATH_TYPE *) bezier
 {
 	_validLastControlPoint = NO;
 	NSInteger index = 0;
-	while (index < [token valence]) {
+	while (index < (NSInteger)token->count) {
 		CGFloat x = 0;
 		CGFloat y = 0;
-		switch ( [token command] ) {
+		switch ( token->command ) {
 			case 'l':
 				x = _lastPoint.x;
 				y = _lastPoint.y;
 			case 'L':
-				x += [token parameter:index];
-				if (++index == [token valence]) {
+				x += values[index];
+				if (++index == (NSInteger)token->count) {
 					NSLog(@"*** PocketSVG Error: Invalid parameter count in L style token");
 					return;
 				}
-				y += [token parameter:index];
+				y += values[index];
 				break;
 			case 'h' :
 				x = _lastPoint.x;				
 			case 'H' :
-				x += [token parameter:index];
+				x += values[index];
 				y = _lastPoint.y;
 				break;
 			case 'v' :
 				y = _lastPoint.y;
 			case 'V' :
-				y += [token parameter:index];
+				y += values[index];
 				x = _lastPoint.x;
 				break;
 			default:
@@ -623,16 +634,16 @@ NSString* const kCommandCharString = @"CcMmLlHhVvZzqQaAsS";
 	}
 }
 
-- (void)appendSVGCCommand:(Token *)token toBezier: (BEZIER_PATH_TYPE *) bezier
+- (void)appendSVGCCommand:(const PathCommand *)token values:(const CGFloat *)values toBezier: (BEZIER_PATH_TYPE *) bezier
 {
 	NSInteger index = 0;
-	while ((index + 5) < [token valence]) {  // we must have 6 floats here (x1, y1, x2, y2, x, y).
-		CGFloat x1 = [token parameter:index++] + ([token command] == 'c' ? _lastPoint.x : 0);
-		CGFloat y1 = [token parameter:index++] + ([token command] == 'c' ? _lastPoint.y : 0);
-		CGFloat x2 = [token parameter:index++] + ([token command] == 'c' ? _lastPoint.x : 0);
-		CGFloat y2 = [token parameter:index++] + ([token command] == 'c' ? _lastPoint.y : 0);
-		CGFloat x  = [token parameter:index++] + ([token command] == 'c' ? _lastPoint.x : 0);
-		CGFloat y  = [token parameter:index++] + ([token command] == 'c' ? _lastPoint.y : 0);
+	while ((index + 5) < (NSInteger)token->count) {  // we must have 6 floats here (x1, y1, x2, y2, x, y).
+		CGFloat x1 = values[index++] + (token->command == 'c' ? _lastPoint.x : 0);
+		CGFloat y1 = values[index++] + (token->command == 'c' ? _lastPoint.y : 0);
+		CGFloat x2 = values[index++] + (token->command == 'c' ? _lastPoint.x : 0);
+		CGFloat y2 = values[index++] + (token->command == 'c' ? _lastPoint.y : 0);
+		CGFloat x  = values[index++] + (token->command == 'c' ? _lastPoint.x : 0);
+		CGFloat y  = values[index++] + (token->command == 'c' ? _lastPoint.y : 0);
 		_lastPoint = CGPointMake(x, y);
 #ifdef TARGET_OS_IPHONE
 		[bezier addCurveToPoint:_lastPoint 
@@ -651,19 +662,19 @@ NSString* const kCommandCharString = @"CcMmLlHhVvZzqQaAsS";
 	}
 }
 
-- (void)appendSVGSCommand:(Token *)token toBezier: (BEZIER_PATH_TYPE *) bezier
+- (void)appendSVGSCommand:(const PathCommand *)token values:(const CGFloat *)values toBezier: (BEZIER_PATH_TYPE *) bezier
 {
 	if (!_validLastControlPoint) {
 		NSLog(@"*** PocketSVG Error: Invalid last control point in S command");
 	}
 	NSInteger index = 0;
-	while ((index + 3) < [token valence]) {  // we must have 4 floats here (x2, y2, x, y).
-		CGFloat x1 = _lastPoint.x + (_lastPoint.x - _lastControlPoint.x); // + ([token command] == 's' ? lastPoint.x : 0);
-		CGFloat y1 = _lastPoint.y + (_lastPoint.y - _lastControlPoint.y); // + ([token command] == 's' ? lastPoint.y : 0);
-		CGFloat x2 = [token parameter:index++] + ([token command] == 's' ? _lastPoint.x : 0);
-		CGFloat y2 = [token parameter:index++] + ([token command] == 's' ? _lastPoint.y : 0);
-		CGFloat x  = [token parameter:index++] + ([token command] == 's' ? _lastPoint.x : 0);
-		CGFloat y  = [token parameter:index++] + ([token command] == 's' ? _lastPoint.y : 0);
+	while ((index + 3) < (NSInteger)token->count) {  // we must have 4 floats here (x2, y2, x, y).
+		CGFloat x1 = _lastPoint.x + (_lastPoint.x - _lastControlPoint.x); // + (token->command == 's' ? lastPoint.x : 0);
+		CGFloat y1 = _lastPoint.y + (_lastPoint.y - _lastControlPoint.y); // + (token->command == 's' ? lastPoint.y : 0);
+		CGFloat x2 = values[index++] + (token->command == 's' ? _lastPoint.x : 0);
+		CGFloat y2 = values[index++] + (token->command == 's' ? _lastPoint.y : 0);
+		CGFloat x  = values[index++] + (token->command == 's' ? _lastPoint.x : 0);
+		CGFloat y  = values[index++] + (token->command == 's' ? _lastPoint.y : 0);
 		_lastPoint = CGPointMake(x, y);
 #ifdef TARGET_OS_IPHONE
 		[bezier addCurveToPoint:_lastPoint 
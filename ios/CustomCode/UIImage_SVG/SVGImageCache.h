@@ -9,17 +9,28 @@
 #import <Foundation/Foundation.h>
 #import <UIKit/UIKit.h>
 
+/* A thread-safe least-recently-used cache of rendered images. Each image costs its bitmap size in
+ * bytes (pixel width * pixel height * 4); when either limit is exceeded the least recently used
+ * images are evicted. The whole cache is purged on memory warnings. */
 @interface SVGImageCache : NSObject
 
-@property (nonatomic, readwrite) NSMutableDictionary *cachedImages;
 @property (nonatomic, readwrite) NSUInteger limit; /* limit cache to this many images.. if 0, no limit */
+@property (nonatomic, readwrite) NSUInteger costLimit; /* limit cache to this many bytes of bitmaps.. if 0, no limit. Default 16MB */
+@property (nonatomic, readonly) NSUInteger count;
+@property (nonatomic, readonly) NSUInteger totalCost;
 
 + (instancetype)sharedImageCache;
 
 - (void)clearImageCache:(NSDictionary *)key;
+- (void)removeAllImages;
 
 - (UIImage *)cachedImageWithKey:(NSDictionary *)key;
 
 - (void)addImageToCache:(UIImage *)anImage forKey:(NSDictionary *)key;
 
+/* Calls completion on the main queue with the image cached for key, rendering it first with render()
+ * on a background queue on a miss. Concurrent misses for the same key share a single render. On a
+ * hit completion is called right away, before this returns. */
+- (void)imageWithKey:(NSDictionary *)key render:(UIImage *(^)(void))render completion:(void (^)(UIImage *image))completion;
+
 @end
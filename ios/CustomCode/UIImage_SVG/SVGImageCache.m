@@ -8,7 +8,29 @@
 
 #import "SVGImageCache.h"
 
-@implementation SVGImageCache
+/* A node of the recency list; the most recently used image is at the head. */
+@interface SVGImageCacheEntry : NSObject {
+    @public
+    NSDictionary *key;
+    UIImage *image;
+    NSUInteger cost;
+    __unsafe_unretained SVGImageCacheEntry *prev; /* owned by the entries dictionary */
+    __unsafe_unretained SVGImageCacheEntry *next;
+}
+@end
+
+@implementation SVGImageCacheEntry
+@end
+
+@implementation SVGImageCache {
+    NSMutableDictionary<NSDictionary *, SVGImageCacheEntry *> *entries;
+    __unsafe_unretained SVGImageCacheEntry *head, *tail;
+    NSUInteger totalCost;
+    NSLock *lock;
+    /* key -> completion blocks waiting on the render of a missing image */
+    NSMutableDictionary<NSDictionary *, NSMutableArray *> *inFlight;
+    dispatch_queue_t renderQueue;
+}
 
 + (instancetype)sharedImageCache
 {
@@ -27,30 +49,173 @@
 	self = [super init];
 
 	if (self) {
-		self.cachedImages = [[NSMutableDictionary alloc] init];
+        entries = [[NSMutableDictionary alloc] init];
+        inFlight = [[NSMutableDictionary alloc] init];
+        lock = [[NSLock alloc] init];
+        renderQueue = dispatch_queue_create("SVGImageCache.render", DISPATCH_QUEUE_CONCURRENT);
         self.limit = 0;
+        self.costLimit = 16*1024*1024;
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(removeAllImages)
+                                                     name:UIApplicationDidReceiveMemoryWarningNotification object:nil];
 	}
 
 	return self;
 }
 
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+static NSUInteger costOfImage(UIImage *image)
+{
+    const CGFloat scale = image.scale;
+    return (NSUInteger)(image.size.width * scale) * (NSUInteger)(image.size.height * scale) * 4;
+}
+
+/* The list helpers below are called with the lock held. */
+
+- (void)unlink:(SVGImageCacheEntry *)e
+{
+    if (e->prev) e->prev->next = e->next; else head = e->next;
+    if (e->next) e->next->prev = e->prev; else tail = e->prev;
+    e->prev = e->next = nil;
+}
+
+- (void)pushFront:(SVGImageCacheEntry *)e
+{
+    e->next = head;
+    e->prev = nil;
+    if (head) head->prev = e;
+    head = e;
+    if (!tail) tail = e;
+}
+
+- (void)removeEntry:(SVGImageCacheEntry *)e
+{
+    [self unlink:e];
+    totalCost -= e->cost;
+    [entries removeObjectForKey:e->key];
+}
+
+- (void)evictOverLimits
+{
+    while (tail && tail != head && ((self.limit > 0 && entries.count > self.limit)
+                                    || (self.costLimit > 0 && totalCost > self.costLimit))) {
+        [self removeEntry:tail];
+    }
+}
+
+- (NSUInteger)count
+{
+    [lock lock];
+    const NSUInteger n = entries.count;
+    [lock unlock];
+    return n;
+}
+
+- (NSUInteger)totalCost
+{
+    [lock lock];
+    const NSUInteger n = totalCost;
+    [lock unlock];
+    return n;
+}
+
+- (void)setLimit:(NSUInteger)limit
+{
+    [lock lock];
+    _limit = limit;
+    [self evictOverLimits];
+    [lock unlock];
+}
+
+- (void)setCostLimit:(NSUInteger)costLimit
+{
+    [lock lock];
+    _costLimit = costLimit;
+    [self evictOverLimits];
+    [lock unlock];
+}
+
 - (void)clearImageCache:(NSDictionary *)key
 {
-	[self.cachedImages removeObjectForKey:key];
+    [lock lock];
+    SVGImageCacheEntry *e = entries[key];
+    if (e) [self removeEntry:e];
+    [lock unlock];
+}
+
+- (void)removeAllImages
+{
+    [lock lock];
+    [entries removeAllObjects];
+    head = tail = nil;
+    totalCost = 0;
+    [lock unlock];
 }
 
 - (UIImage *)cachedImageWithKey:(NSDictionary *)key
 {
-	return [self.cachedImages objectForKey:key];
+    UIImage *image = nil;
+    [lock lock];
+    SVGImageCacheEntry *e = entries[key];
+    if (e) {
+        [self unlink:e];
+        [self pushFront:e];
+        image = e->image;
+    }
+    [lock unlock];
+    return image;
 }
 
 - (void)addImageToCache:(UIImage *)image forKey:(NSDictionary *)key
 {
-    while (self.limit > 0 && ! [self.cachedImages objectForKey:key] && self.cachedImages.count >= self.limit) {
-        NSArray *keys = self.cachedImages.allKeys;
-        [self.cachedImages removeObjectForKey:keys.lastObject];
+    if (!image || !key) return;
+    [lock lock];
+    SVGImageCacheEntry *e = entries[key];
+    if (e) {
+        [self unlink:e];
+        totalCost -= e->cost;
+    } else {
+        e = [[SVGImageCacheEntry alloc] init];
+        e->key = [key copy];
+        entries[e->key] = e;
     }
-	[self.cachedImages setObject:image forKey:key];
+    e->image = image;
+    e->cost = costOfImage(image);
+    totalCost += e->cost;
+    [self pushFront:e];
+    [self evictOverLimits];
+    [lock unlock];
+}
+
+- (void)imageWithKey:(NSDictionary *)key render:(UIImage *(^)(void))render completion:(void (^)(UIImage *image))completion
+{
+    UIImage *image = [self cachedImageWithKey:key];
+    if (image) {
+        if (completion) completion(image);
+        return;
+    }
+    [lock lock];
+    NSMutableArray *waiting = inFlight[key];
+    const BOOL first = waiting == nil;
+    if (first) waiting = inFlight[key] = [NSMutableArray array];
+    if (completion) [waiting addObject:[completion copy]];
+    [lock unlock];
+    if (!first) return;
+
+    dispatch_async(renderQueue, ^{
+        UIImage *rendered = render();
+        [self addImageToCache:rendered forKey:key];
+        [self->lock lock];
+        NSArray *blocks = self->inFlight[key];
+        [self->inFlight removeObjectForKey:key];
+        [self->lock unlock];
+        dispatch_async(dispatch_get_main_queue(), ^{
+            for (void (^block)(UIImage *) in blocks) block(rendered);
+        });
+    });
 }
 
 @end
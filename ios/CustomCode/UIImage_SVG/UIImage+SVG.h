@@ -38,4 +38,20 @@
                          fillColor:(UIColor*)fillColor
                         cachedName:(NSString *)cachedName;
 
+/**
+ * Asynchronous, cached variants of the above: a missing image is rendered on a
+ * background queue, once however many callers ask for it meanwhile, and passed to
+ * completion on the main queue. A cached image is passed to completion right away.
+ */
++ (void)imageWithSVGNamed:(NSString*)svgName
+               targetSize:(CGSize)targetSize
+                fillColor:(UIColor*)fillColor
+               completion:(void (^)(UIImage *image))completion;
+
++ (void)imageWithSVGString:(NSString*)svgString
+                targetSize:(CGSize)targetSize
+                 fillColor:(UIColor*)fillColor
+                cachedName:(NSString *)cachedName
+                completion:(void (^)(UIImage *image))completion;
+
 @end
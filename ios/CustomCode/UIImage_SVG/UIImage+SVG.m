@@ -10,6 +10,41 @@
 #import "SVGImageCache.h"
 #import "PocketSVG.h"
 
+/* Renders the paths of svg, scaled to fit targetSize, filled with fillColor. Safe to call off the
+ * main thread, given the screen scale. */
+static UIImage *renderSVG(PocketSVG *svg, CGSize targetSize, UIColor *fillColor, CGFloat screenScale)
+{
+	CGFloat boundingBoxAspectRatio = svg.width / svg.height;
+	CGFloat targetAspectRatio = targetSize.width / targetSize.height;
+	CGFloat scaleFactor = 1.0f;
+	CGAffineTransform transform;
+
+	if (boundingBoxAspectRatio > targetAspectRatio) {
+		scaleFactor = targetSize.width / svg.width;
+	} else {
+		scaleFactor = targetSize.height / svg.height;
+	}
+
+	transform = CGAffineTransformIdentity;
+	transform = CGAffineTransformScale(transform, scaleFactor, scaleFactor);
+
+	UIGraphicsBeginImageContextWithOptions(targetSize, NO, screenScale);
+	CGContextRef context = UIGraphicsGetCurrentContext();
+	CGContextSetFillColorWithColor(context, [fillColor CGColor]);
+
+	for (UIBezierPath *path in svg.beziers) {
+		CGPathRef scaledPath = CGPathCreateCopyByTransformingPath([path CGPath], &transform);
+		CGContextAddPath(context, scaledPath);
+		CGPathRelease(scaledPath);
+	}
+
+	CGContextFillPath(context);
+
+	UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+	UIGraphicsEndImageContext();
+	return image;
+}
+
 @implementation UIImage (SVG)
 
 + (instancetype)imageWithSVGNamed:(NSString*)svgName
@@ -34,36 +69,8 @@
 	UIImage *image = [[SVGImageCache sharedImageCache] cachedImageWithKey: cacheKey];
 
 	if (image == nil) {
-
 		PocketSVG *svg = [[PocketSVG alloc] initFromSVGFile: svgName];
-		CGFloat boundingBoxAspectRatio = svg.width / svg.height;
-		CGFloat targetAspectRatio = targetSize.width / targetSize.height;
-		CGFloat scaleFactor = 1.0f;
-		CGAffineTransform transform;
-
-		if (boundingBoxAspectRatio > targetAspectRatio) {
-			scaleFactor = targetSize.width / svg.width;
-		} else {
-			scaleFactor = targetSize.height / svg.height;
-        }
-
-		transform = CGAffineTransformIdentity;
-		transform = CGAffineTransformScale(transform, scaleFactor, scaleFactor);
-
-		UIGraphicsBeginImageContextWithOptions(targetSize, NO, [[UIScreen mainScreen] scale]);
-		CGContextRef context = UIGraphicsGetCurrentContext();
-		CGContextSetFillColorWithColor(context, [fillColor CGColor]);
-
-		for (UIBezierPath *path in svg.beziers) {
-			CGPathRef scaledPath = CGPathCreateCopyByTransformingPath([path CGPath], &transform);
-			CGContextAddPath(context, scaledPath);
-			CGPathRelease(scaledPath);
-		}
-
-		CGContextFillPath(context);
-
-		image = UIGraphicsGetImageFromCurrentImageContext();
-		UIGraphicsEndImageContext();
+		image = renderSVG(svg, targetSize, fillColor, [[UIScreen mainScreen] scale]);
 
 		if (cacheImage) {
 			[[SVGImageCache sharedImageCache] addImageToCache:image forKey:cacheKey];
@@ -73,6 +80,21 @@
 	return image;
 }
 
++ (void)imageWithSVGNamed:(NSString*)svgName
+               targetSize:(CGSize)targetSize
+                fillColor:(UIColor*)fillColor
+               completion:(void (^)(UIImage *image))completion
+{
+    NSDictionary *cacheKey = @{@"name" : svgName,
+                               @"size" : [NSValue valueWithCGSize: targetSize],
+                               @"color" : fillColor};
+    const CGFloat screenScale = [[UIScreen mainScreen] scale];
+    [[SVGImageCache sharedImageCache] imageWithKey:cacheKey render:^UIImage *{
+        PocketSVG *svg = [[PocketSVG alloc] initFromSVGFile: svgName];
+        return renderSVG(svg, targetSize, fillColor, screenScale);
+    } completion:completion];
+}
+
 + (instancetype)imageWithSVGString:(NSString*)svgString
                         targetSize:(CGSize)targetSize
                          fillColor:(UIColor*)fillColor
@@ -90,35 +112,8 @@
 
     if (image == nil) {
         PocketSVG *svg = [[PocketSVG alloc] initFromSVGString: svgString];
-        CGFloat boundingBoxAspectRatio = svg.width / svg.height;
-        CGFloat targetAspectRatio = targetSize.width / targetSize.height;
-        CGFloat scaleFactor = 1.0f;
-        CGAffineTransform transform;
-
-        if (boundingBoxAspectRatio > targetAspectRatio) {
-            scaleFactor = targetSize.width / svg.width;
-        } else {
-            scaleFactor = targetSize.height / svg.height;
-        }
-
-        transform = CGAffineTransformIdentity;
-        transform = CGAffineTransformScale(transform, scaleFactor, scaleFactor);
-
-        UIGraphicsBeginImageContextWithOptions(targetSize, NO, [[UIScreen mainScreen] scale]);
-        CGContextRef context = UIGraphicsGetCurrentContext();
-        CGContextSetFillColorWithColor(context, [fillColor CGColor]);
-
-        for (UIBezierPath *path in svg.beziers) {
-            CGPathRef scaledPath = CGPathCreateCopyByTransformingPath([path CGPath], &transform);
-            CGContextAddPath(context, scaledPath);
-            CGPathRelease(scaledPath);
-        }
-
-        CGContextFillPath(context);
+        image = renderSVG(svg, targetSize, fillColor, [[UIScreen mainScreen] scale]);
 
-        image = UIGraphicsGetImageFromCurrentImageContext();
-        UIGraphicsEndImageContext();
-        
         if (cacheKey) {
             [[SVGImageCache sharedImageCache] addImageToCache:image forKey:cacheKey];
         }
@@ -127,5 +122,30 @@
     return image;
 }
 
++ (void)imageWithSVGString:(NSString*)svgString
+                targetSize:(CGSize)targetSize
+                 fillColor:(UIColor*)fillColor
+                cachedName:(NSString *)cachedName
+                completion:(void (^)(UIImage *image))completion
+{
+    const CGFloat screenScale = [[UIScreen mainScreen] scale];
+    UIImage *(^render)(void) = ^UIImage *{
+        PocketSVG *svg = [[PocketSVG alloc] initFromSVGString: svgString];
+        return renderSVG(svg, targetSize, fillColor, screenScale);
+    };
+    if (!cachedName) {
+        /* nothing to share the render with, or keep it under */
+        dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+            UIImage *image = render();
+            dispatch_async(dispatch_get_main_queue(), ^{ if (completion) completion(image); });
+        });
+        return;
+    }
+    NSDictionary *cacheKey = @{@"name" : cachedName,
+                               @"size" : [NSValue valueWithCGSize: targetSize],
+                               @"color" : fillColor};
+    [[SVGImageCache sharedImageCache] imageWithKey:cacheKey render:render completion:completion];
+}
+
 
 @end
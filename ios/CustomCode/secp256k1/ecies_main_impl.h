@@ -0,0 +1,138 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef SECP256K1_MODULE_ECIES_MAIN
+#define SECP256K1_MODULE_ECIES_MAIN
+
+#include "secp256k1_ecies.h"
+
+/* SHA-512 (FIPS 180-4) of a short message. ECIES only ever hashes a 33-byte
+ * point, so this is the one-shot form, without a streaming interface. */
+
+static const uint64_t secp256k1_ecies_sha512_k[80] = {
+    0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+    0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+    0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+    0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+    0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+    0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+    0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+    0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+    0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+    0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+    0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+    0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+    0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+    0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+    0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+    0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+    0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+    0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+    0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+    0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
+#define ECIES_ROTR64(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
+
+static void secp256k1_ecies_sha512_transform(uint64_t *s, const unsigned char *block) {
+    uint64_t w[80];
+    uint64_t a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+    int i, j;
+
+    for (i = 0; i < 16; i++) {
+        w[i] = 0;
+        for (j = 0; j < 8; j++) {
+            w[i] = (w[i] << 8) | block[8 * i + j];
+        }
+    }
+    for (i = 16; i < 80; i++) {
+        uint64_t s0 = ECIES_ROTR64(w[i - 15], 1) ^ ECIES_ROTR64(w[i - 15], 8) ^ (w[i - 15] >> 7);
+        uint64_t s1 = ECIES_ROTR64(w[i - 2], 19) ^ ECIES_ROTR64(w[i - 2], 61) ^ (w[i - 2] >> 6);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    for (i = 0; i < 80; i++) {
+        uint64_t t1 = h + (ECIES_ROTR64(e, 14) ^ ECIES_ROTR64(e, 18) ^ ECIES_ROTR64(e, 41))
+                      + ((e & f) ^ (~e & g)) + secp256k1_ecies_sha512_k[i] + w[i];
+        uint64_t t2 = (ECIES_ROTR64(a, 28) ^ ECIES_ROTR64(a, 34) ^ ECIES_ROTR64(a, 39))
+                      + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    s[0] += a; s[1] += b; s[2] += c; s[3] += d;
+    s[4] += e; s[5] += f; s[6] += g; s[7] += h;
+}
+
+#undef ECIES_ROTR64
+
+static void secp256k1_ecies_sha512(unsigned char *output64, const unsigned char *data, size_t len) {
+    uint64_t s[8] = {
+        0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+        0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+    };
+    unsigned char block[128];
+    size_t rest = len, i;
+    int j;
+
+    while (rest >= 128) {
+        secp256k1_ecies_sha512_transform(s, data);
+        data += 128;
+        rest -= 128;
+    }
+    /* Pad with 0x80, zeros and the 128-bit big-endian bit length. */
+    memset(block, 0, sizeof(block));
+    memcpy(block, data, rest);
+    block[rest] = 0x80;
+    if (rest >= 112) {
+        secp256k1_ecies_sha512_transform(s, block);
+        memset(block, 0, sizeof(block));
+    }
+    for (j = 0; j < 8; j++) {
+        block[127 - j] = (unsigned char)(((uint64_t)len << 3) >> (8 * j));
+    }
+    block[119] = (unsigned char)((uint64_t)len >> 61);
+    secp256k1_ecies_sha512_transform(s, block);
+    for (i = 0; i < 8; i++) {
+        for (j = 0; j < 8; j++) {
+            output64[8 * i + j] = (unsigned char)(s[i] >> (56 - 8 * j));
+        }
+    }
+    memset(s, 0, sizeof(s));
+    memset(block, 0, sizeof(block));
+}
+
+int secp256k1_ecies_derive_keys(const secp256k1_context* ctx, unsigned char *output64, unsigned char *ephemeral33, const unsigned char *seckey, const unsigned char *pubkey, size_t pubkeylen) {
+    secp256k1_ge pt;
+    secp256k1_gej res;
+    secp256k1_scalar s;
+    unsigned char shared[33];
+    size_t len = 33;
+    int overflow = 0;
+    int ret = 0;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(output64 != NULL);
+    ARG_CHECK(seckey != NULL);
+    ARG_CHECK(pubkey != NULL);
+    ARG_CHECK(ephemeral33 == NULL || secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+
+    secp256k1_scalar_set_b32(&s, seckey, &overflow);
+    if (!overflow && !secp256k1_scalar_is_zero(&s) && secp256k1_eckey_pubkey_parse(&pt, pubkey, pubkeylen)) {
+        secp256k1_ecmult_const(&res, &pt, &s);
+        secp256k1_ge_set_gej(&pt, &res);
+        secp256k1_eckey_pubkey_serialize(&pt, shared, &len, 1);
+        secp256k1_ecies_sha512(output64, shared, sizeof(shared));
+        memset(shared, 0, sizeof(shared));
+        if (ephemeral33 != NULL) {
+            secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &res, &s);
+            secp256k1_ge_set_gej(&pt, &res);
+            len = 33;
+            secp256k1_eckey_pubkey_serialize(&pt, ephemeral33, &len, 1);
+        }
+        ret = 1;
+    }
+    secp256k1_scalar_clear(&s);
+    return ret;
+}
+
+#endif
@@ -16,6 +16,10 @@
 
 static int secp256k1_eckey_pubkey_parse(secp256k1_ge *elem, const unsigned char *pub, size_t size);
 static int secp256k1_eckey_pubkey_serialize(secp256k1_ge *elem, unsigned char *pub, size_t *size, int compressed);
+/** Serialize n Jacobian points, none of which may be infinity, to pub with consecutive keys
+ *  stride bytes apart. All n affine conversions share a single field inversion. zs must have
+ *  room for n field elements. */
+static void secp256k1_eckey_pubkey_serialize_batch(const secp256k1_gej *a, secp256k1_fe *zs, size_t n, unsigned char *pub, size_t stride, int compressed);
 
 static int secp256k1_eckey_privkey_tweak_add(secp256k1_scalar *key, const secp256k1_scalar *tweak);
 static int secp256k1_eckey_pubkey_tweak_add(const secp256k1_ecmult_context *ctx, secp256k1_ge *key, const secp256k1_scalar *tweak);
@@ -52,6 +52,40 @@ static int secp256k1_eckey_pubkey_serialize(secp256k1_ge *elem, unsigned char *p
     return 1;
 }
 
+static void secp256k1_eckey_pubkey_serialize_batch(const secp256k1_gej *a, secp256k1_fe *zs, size_t n, unsigned char *pub, size_t stride, int compressed) {
+    secp256k1_fe zi, zit;
+    secp256k1_ge p;
+    size_t i, size;
+    int ret;
+
+    if (n == 0) {
+        return;
+    }
+    VERIFY_CHECK(!a[0].infinity);
+    /* zs[i] = a[0].z * ... * a[i].z */
+    zs[0] = a[0].z;
+    for (i = 1; i < n; i++) {
+        VERIFY_CHECK(!a[i].infinity);
+        secp256k1_fe_mul(&zs[i], &zs[i - 1], &a[i].z);
+    }
+    /* The Z coordinates of freshly computed keys depend on secret data, so use the
+     * constant time inverse. */
+    secp256k1_fe_inv(&zi, &zs[n - 1]);
+    for (i = n - 1; i > 0; i--) {
+        /* zi = 1/(a[0].z * ... * a[i].z), so 1/a[i].z = zi * zs[i - 1]. */
+        secp256k1_fe_mul(&zit, &zi, &zs[i - 1]);
+        secp256k1_fe_mul(&zi, &zi, &a[i].z);
+        secp256k1_ge_set_gej_zinv(&p, &a[i], &zit);
+        ret = secp256k1_eckey_pubkey_serialize(&p, pub + i * stride, &size, compressed);
+        VERIFY_CHECK(ret);
+        (void)ret;
+    }
+    secp256k1_ge_set_gej_zinv(&p, &a[0], &zi);
+    ret = secp256k1_eckey_pubkey_serialize(&p, pub, &size, compressed);
+    VERIFY_CHECK(ret);
+    (void)ret;
+}
+
 static int secp256k1_eckey_privkey_tweak_add(secp256k1_scalar *key, const secp256k1_scalar *tweak) {
     secp256k1_scalar_add(key, key, tweak);
     if (secp256k1_scalar_is_zero(key)) {
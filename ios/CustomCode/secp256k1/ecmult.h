@@ -9,6 +9,8 @@
 
 #include "num.h"
 #include "group.h"
+#include "scalar.h"
+#include "scratch.h"
 
 typedef struct {
     /* For accelerating the computation of a*P + b*G: */
@@ -28,4 +30,36 @@ static int secp256k1_ecmult_context_is_built(const secp256k1_ecmult_context *ctx
 /** Double multiply: R = na*A + ng*G */
 static void secp256k1_ecmult(const secp256k1_ecmult_context *ctx, secp256k1_gej *r, const secp256k1_gej *a, const secp256k1_scalar *na, const secp256k1_scalar *ng);
 
+/** Precomputed odd multiples of one point, for repeated double multiplies
+ *  with it. Callers that see the same point often (secp256k1_pubkey_cache)
+ *  build this once and skip that step of secp256k1_ecmult on every call. */
+typedef struct secp256k1_ecmult_point_table_struct secp256k1_ecmult_point_table;
+
+/** Fill table with odd multiples of a, which must not be infinity. */
+static void secp256k1_ecmult_point_table_build(secp256k1_ecmult_point_table *table, const secp256k1_ge *a);
+
+/** Double multiply: R = na*A + ng*G, where table was built for A. */
+static void secp256k1_ecmult_point_table_mul(const secp256k1_ecmult_context *ctx, secp256k1_gej *r, const secp256k1_ecmult_point_table *table, const secp256k1_scalar *na, const secp256k1_scalar *ng);
+
+typedef int (secp256k1_ecmult_multi_callback)(secp256k1_scalar *sc, secp256k1_ge *pt, size_t idx, void *data);
+
+/**
+ * Multi-multiply: R = inp_g_sc * G + sum_i ni * Ai.
+ * Chooses the right algorithm for a given number of points and scratch space
+ * size: Strauss' wNAF interleaving for small batches, Pippenger's bucket
+ * method for large ones. Resets and overwrites the given scratch space. If
+ * the points do not fit in the scratch space the algorithm is repeatedly run
+ * with batches of points. If no scratch space is given then a simple
+ * algorithm is used that multiplies the points with the corresponding scalars
+ * one by one and adds them up.
+ * Returns: 1 on success (including when inp_g_sc is NULL and n is 0)
+ *          0 if there is not enough scratch space for a single point or
+ *          callback returns 0
+ */
+static int secp256k1_ecmult_multi_var(const secp256k1_callback* error_callback, const secp256k1_ecmult_context *ctx, secp256k1_scratch *scratch, secp256k1_gej *r, const secp256k1_scalar *inp_g_sc, secp256k1_ecmult_multi_callback cb, void *cbdata, size_t n);
+
+/** Size of the scratch space secp256k1_ecmult_multi_var needs to handle n
+ *  points in a single batch. */
+static size_t secp256k1_ecmult_multi_scratch_size(size_t n);
+
 #endif /* SECP256K1_ECMULT_H */
@@ -10,6 +10,33 @@
 #include "scalar.h"
 #include "group.h"
 
+/** Window of the constant-time wNAF (see libsecp256k1-config.h). */
+#ifndef ECMULT_CONST_WINDOW
+#  define ECMULT_CONST_WINDOW 5
+#endif
+#if ECMULT_CONST_WINDOW < 2 || ECMULT_CONST_WINDOW > 8
+#  error "Set ECMULT_CONST_WINDOW to an integer in range [2..8]."
+#endif
+
+/** Odd multiples of one point, for multiplying it by several scalars in
+ *  constant time without rebuilding them for each. The point is public; only
+ *  the scalars are treated as secret. */
+typedef struct {
+    secp256k1_ge pre_a[1 << (ECMULT_CONST_WINDOW - 2)];
+#ifdef USE_ENDOMORPHISM
+    secp256k1_ge pre_a_lam[1 << (ECMULT_CONST_WINDOW - 2)];
+#endif
+    secp256k1_fe z;  /* the common Z denominator of pre_a */
+    secp256k1_ge a;  /* the point itself, and its double, for the skew correction */
+    secp256k1_ge a2;
+} secp256k1_ecmult_const_table;
+
+/** Set up t for the point a, which must not be infinity. */
+static void secp256k1_ecmult_const_table_build(secp256k1_ecmult_const_table *t, const secp256k1_ge *a);
+
+/** r = q*A in constant time, where A is the point t was built for. */
+static void secp256k1_ecmult_const_table_mul(secp256k1_gej *r, const secp256k1_ecmult_const_table *t, const secp256k1_scalar *q);
+
 static void secp256k1_ecmult_const(secp256k1_gej *r, const secp256k1_ge *a, const secp256k1_scalar *q);
 
 #endif /* SECP256K1_ECMULT_CONST_H */
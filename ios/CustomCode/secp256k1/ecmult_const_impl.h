@@ -11,6 +11,7 @@
 #include "group.h"
 #include "ecmult_const.h"
 #include "ecmult_impl.h"
+#include "stats.h"
 
 #ifdef USE_ENDOMORPHISM
     #define WNAF_BITS 128
@@ -120,16 +121,44 @@ static int secp256k1_wnaf_const(int *wnaf, secp256k1_scalar s, int w) {
 }
 
 
-static void secp256k1_ecmult_const(secp256k1_gej *r, const secp256k1_ge *a, const secp256k1_scalar *scalar) {
-    secp256k1_ge pre_a[ECMULT_TABLE_SIZE(WINDOW_A)];
+static void secp256k1_ecmult_const_table_build(secp256k1_ecmult_const_table *t, const secp256k1_ge *a) {
+    secp256k1_gej prej[ECMULT_TABLE_SIZE(ECMULT_CONST_WINDOW)];
+    secp256k1_fe zr[ECMULT_TABLE_SIZE(ECMULT_CONST_WINDOW)];
+    secp256k1_gej aj;
+    int i;
+
+    /* Calculate odd multiples of a.
+     * All multiples are brought to the same Z 'denominator', which is stored
+     * in Z. Due to secp256k1' isomorphism we can do all operations pretending
+     * that the Z coordinate was 1, use affine addition formulae, and correct
+     * the Z coordinate of the result once at the end.
+     */
+    secp256k1_gej_set_ge(&aj, a);
+    secp256k1_ecmult_odd_multiples_table(ECMULT_TABLE_SIZE(ECMULT_CONST_WINDOW), prej, zr, &aj);
+    secp256k1_ge_globalz_set_table_gej(ECMULT_TABLE_SIZE(ECMULT_CONST_WINDOW), t->pre_a, &t->z, prej, zr);
+    for (i = 0; i < ECMULT_TABLE_SIZE(ECMULT_CONST_WINDOW); i++) {
+        secp256k1_fe_normalize_weak(&t->pre_a[i].y);
+    }
+#ifdef USE_ENDOMORPHISM
+    for (i = 0; i < ECMULT_TABLE_SIZE(ECMULT_CONST_WINDOW); i++) {
+        secp256k1_ge_mul_lambda(&t->pre_a_lam[i], &t->pre_a[i]);
+    }
+#endif
+
+    /* The skew correction subtracts a or 2a; a is public, so 2a is made
+     * affine here once rather than for every scalar. */
+    t->a = *a;
+    secp256k1_gej_double_var(&aj, &aj, NULL);
+    secp256k1_ge_set_gej(&t->a2, &aj);
+}
+
+static void secp256k1_ecmult_const_table_mul(secp256k1_gej *r, const secp256k1_ecmult_const_table *t, const secp256k1_scalar *scalar) {
     secp256k1_ge tmpa;
-    secp256k1_fe Z;
 
     int skew_1;
-    int wnaf_1[1 + WNAF_SIZE(WINDOW_A - 1)];
+    int wnaf_1[1 + WNAF_SIZE(ECMULT_CONST_WINDOW - 1)];
 #ifdef USE_ENDOMORPHISM
-    secp256k1_ge pre_a_lam[ECMULT_TABLE_SIZE(WINDOW_A)];
-    int wnaf_lam[1 + WNAF_SIZE(WINDOW_A - 1)];
+    int wnaf_lam[1 + WNAF_SIZE(ECMULT_CONST_WINDOW - 1)];
     int skew_lam;
     secp256k1_scalar q_1, q_lam;
 #endif
@@ -141,81 +170,60 @@ static void secp256k1_ecmult_const(secp256k1_gej *r, const secp256k1_ge *a, cons
 #ifdef USE_ENDOMORPHISM
     /* split q into q_1 and q_lam (where q = q_1 + q_lam*lambda, and q_1 and q_lam are ~128 bit) */
     secp256k1_scalar_split_lambda(&q_1, &q_lam, &sc);
-    skew_1   = secp256k1_wnaf_const(wnaf_1,   q_1,   WINDOW_A - 1);
-    skew_lam = secp256k1_wnaf_const(wnaf_lam, q_lam, WINDOW_A - 1);
+    skew_1   = secp256k1_wnaf_const(wnaf_1,   q_1,   ECMULT_CONST_WINDOW - 1);
+    skew_lam = secp256k1_wnaf_const(wnaf_lam, q_lam, ECMULT_CONST_WINDOW - 1);
 #else
-    skew_1   = secp256k1_wnaf_const(wnaf_1, sc, WINDOW_A - 1);
-#endif
-
-    /* Calculate odd multiples of a.
-     * All multiples are brought to the same Z 'denominator', which is stored
-     * in Z. Due to secp256k1' isomorphism we can do all operations pretending
-     * that the Z coordinate was 1, use affine addition formulae, and correct
-     * the Z coordinate of the result once at the end.
-     */
-    secp256k1_gej_set_ge(r, a);
-    secp256k1_ecmult_odd_multiples_table_globalz_windowa(pre_a, &Z, r);
-    for (i = 0; i < ECMULT_TABLE_SIZE(WINDOW_A); i++) {
-        secp256k1_fe_normalize_weak(&pre_a[i].y);
-    }
-#ifdef USE_ENDOMORPHISM
-    for (i = 0; i < ECMULT_TABLE_SIZE(WINDOW_A); i++) {
-        secp256k1_ge_mul_lambda(&pre_a_lam[i], &pre_a[i]);
-    }
+    skew_1   = secp256k1_wnaf_const(wnaf_1, sc, ECMULT_CONST_WINDOW - 1);
 #endif
 
     /* first loop iteration (separated out so we can directly set r, rather
      * than having it start at infinity, get doubled several times, then have
      * its new value added to it) */
-    i = wnaf_1[WNAF_SIZE(WINDOW_A - 1)];
+    i = wnaf_1[WNAF_SIZE(ECMULT_CONST_WINDOW - 1)];
     VERIFY_CHECK(i != 0);
-    ECMULT_CONST_TABLE_GET_GE(&tmpa, pre_a, i, WINDOW_A);
+    ECMULT_CONST_TABLE_GET_GE(&tmpa, t->pre_a, i, ECMULT_CONST_WINDOW);
     secp256k1_gej_set_ge(r, &tmpa);
 #ifdef USE_ENDOMORPHISM
-    i = wnaf_lam[WNAF_SIZE(WINDOW_A - 1)];
+    i = wnaf_lam[WNAF_SIZE(ECMULT_CONST_WINDOW - 1)];
     VERIFY_CHECK(i != 0);
-    ECMULT_CONST_TABLE_GET_GE(&tmpa, pre_a_lam, i, WINDOW_A);
+    ECMULT_CONST_TABLE_GET_GE(&tmpa, t->pre_a_lam, i, ECMULT_CONST_WINDOW);
     secp256k1_gej_add_ge(r, r, &tmpa);
 #endif
     /* remaining loop iterations */
-    for (i = WNAF_SIZE(WINDOW_A - 1) - 1; i >= 0; i--) {
+    for (i = WNAF_SIZE(ECMULT_CONST_WINDOW - 1) - 1; i >= 0; i--) {
         int n;
         int j;
-        for (j = 0; j < WINDOW_A - 1; ++j) {
+        for (j = 0; j < ECMULT_CONST_WINDOW - 1; ++j) {
             secp256k1_gej_double_nonzero(r, r, NULL);
         }
 
         n = wnaf_1[i];
-        ECMULT_CONST_TABLE_GET_GE(&tmpa, pre_a, n, WINDOW_A);
+        ECMULT_CONST_TABLE_GET_GE(&tmpa, t->pre_a, n, ECMULT_CONST_WINDOW);
         VERIFY_CHECK(n != 0);
         secp256k1_gej_add_ge(r, r, &tmpa);
 #ifdef USE_ENDOMORPHISM
         n = wnaf_lam[i];
-        ECMULT_CONST_TABLE_GET_GE(&tmpa, pre_a_lam, n, WINDOW_A);
+        ECMULT_CONST_TABLE_GET_GE(&tmpa, t->pre_a_lam, n, ECMULT_CONST_WINDOW);
         VERIFY_CHECK(n != 0);
         secp256k1_gej_add_ge(r, r, &tmpa);
 #endif
     }
 
-    secp256k1_fe_mul(&r->z, &r->z, &Z);
+    secp256k1_fe_mul(&r->z, &r->z, &t->z);
 
     {
         /* Correct for wNAF skew */
-        secp256k1_ge correction = *a;
+        secp256k1_ge correction;
         secp256k1_ge_storage correction_1_stor;
 #ifdef USE_ENDOMORPHISM
         secp256k1_ge_storage correction_lam_stor;
 #endif
         secp256k1_ge_storage a2_stor;
-        secp256k1_gej tmpj;
-        secp256k1_gej_set_ge(&tmpj, &correction);
-        secp256k1_gej_double_var(&tmpj, &tmpj, NULL);
-        secp256k1_ge_set_gej(&correction, &tmpj);
-        secp256k1_ge_to_storage(&correction_1_stor, a);
+        secp256k1_ge_to_storage(&correction_1_stor, &t->a);
 #ifdef USE_ENDOMORPHISM
-        secp256k1_ge_to_storage(&correction_lam_stor, a);
+        secp256k1_ge_to_storage(&correction_lam_stor, &t->a);
 #endif
-        secp256k1_ge_to_storage(&a2_stor, &correction);
+        secp256k1_ge_to_storage(&a2_stor, &t->a2);
 
         /* For odd numbers this is 2a (so replace it), for even ones a (so no-op) */
         secp256k1_ge_storage_cmov(&correction_1_stor, &a2_stor, skew_1 == 2);
@@ -237,4 +245,12 @@ static void secp256k1_ecmult_const(secp256k1_gej *r, const secp256k1_ge *a, cons
     }
 }
 
+static void secp256k1_ecmult_const(secp256k1_gej *r, const secp256k1_ge *a, const secp256k1_scalar *scalar) {
+    SECP256K1_STATS_BEGIN(ticks)
+    secp256k1_ecmult_const_table t;
+    secp256k1_ecmult_const_table_build(&t, a);
+    secp256k1_ecmult_const_table_mul(r, &t, scalar);
+    SECP256K1_STATS_END(ECMULT_CONST, ticks);
+}
+
 #endif /* SECP256K1_ECMULT_CONST_IMPL_H */
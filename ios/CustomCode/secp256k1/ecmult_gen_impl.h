@@ -9,10 +9,18 @@
 
 #include "scalar.h"
 #include "group.h"
+#include "field4.h"
+#ifdef SECP256K1_FE4_VECTOR
+#include "group4_impl.h"
+#endif
 #include "ecmult_gen.h"
 #include "hash_impl.h"
+#include "stats.h"
 #ifdef USE_ECMULT_STATIC_PRECOMPUTATION
 #include "ecmult_static_context.h"
+#if ECMULT_GEN_PREC_BITS != ECMULT_STATIC_GEN_PREC_BITS
+#error "ECMULT_GEN_PREC_BITS differs from the comb of ecmult_static_context.h; regenerate it with gen_secp256k1_context.c"
+#endif
 #endif
 static void secp256k1_ecmult_gen_context_init(secp256k1_ecmult_gen_context *ctx) {
     ctx->prec = NULL;
@@ -20,7 +28,7 @@ static void secp256k1_ecmult_gen_context_init(secp256k1_ecmult_gen_context *ctx)
 
 static void secp256k1_ecmult_gen_context_build(secp256k1_ecmult_gen_context *ctx, const secp256k1_callback* cb) {
 #ifndef USE_ECMULT_STATIC_PRECOMPUTATION
-    secp256k1_ge prec[1024];
+    secp256k1_ge *prec;
     secp256k1_gej gj;
     secp256k1_gej nums_gej;
     int i, j;
@@ -30,7 +38,7 @@ static void secp256k1_ecmult_gen_context_build(secp256k1_ecmult_gen_context *ctx
         return;
     }
 #ifndef USE_ECMULT_STATIC_PRECOMPUTATION
-    ctx->prec = (secp256k1_ge_storage (*)[64][16])checked_malloc(cb, sizeof(*ctx->prec));
+    ctx->prec = (secp256k1_ge_storage (*)[ECMULT_GEN_PREC_N][ECMULT_GEN_PREC_G])secp256k1_shared_malloc(cb, sizeof(*ctx->prec));
 
     /* get the generator */
     secp256k1_gej_set_ge(&gj, &secp256k1_ge_const_g);
@@ -52,41 +60,45 @@ static void secp256k1_ecmult_gen_context_build(secp256k1_ecmult_gen_context *ctx
         secp256k1_gej_add_ge_var(&nums_gej, &nums_gej, &secp256k1_ge_const_g, NULL);
     }
 
-    /* compute prec. */
+    /* compute prec. On the heap, as with 8-bit teeth it is over a megabyte. */
+    prec = (secp256k1_ge *)checked_malloc(cb, sizeof(secp256k1_ge) * ECMULT_GEN_PREC_N * ECMULT_GEN_PREC_G);
     {
-        secp256k1_gej precj[1024]; /* Jacobian versions of prec. */
+        secp256k1_gej *precj; /* Jacobian versions of prec. */
         secp256k1_gej gbase;
         secp256k1_gej numsbase;
-        gbase = gj; /* 16^j * G */
+        precj = (secp256k1_gej *)checked_malloc(cb, sizeof(secp256k1_gej) * ECMULT_GEN_PREC_N * ECMULT_GEN_PREC_G);
+        gbase = gj; /* PREC_G^j * G */
         numsbase = nums_gej; /* 2^j * nums. */
-        for (j = 0; j < 64; j++) {
-            /* Set precj[j*16 .. j*16+15] to (numsbase, numsbase + gbase, ..., numsbase + 15*gbase). */
-            precj[j*16] = numsbase;
-            for (i = 1; i < 16; i++) {
-                secp256k1_gej_add_var(&precj[j*16 + i], &precj[j*16 + i - 1], &gbase, NULL);
+        for (j = 0; j < ECMULT_GEN_PREC_N; j++) {
+            /* Set precj[j*PREC_G .. j*PREC_G+(PREC_G-1)] to (numsbase, numsbase + gbase, ..., numsbase + (PREC_G-1)*gbase). */
+            precj[j*ECMULT_GEN_PREC_G] = numsbase;
+            for (i = 1; i < ECMULT_GEN_PREC_G; i++) {
+                secp256k1_gej_add_var(&precj[j*ECMULT_GEN_PREC_G + i], &precj[j*ECMULT_GEN_PREC_G + i - 1], &gbase, NULL);
             }
-            /* Multiply gbase by 16. */
-            for (i = 0; i < 4; i++) {
+            /* Multiply gbase by PREC_G. */
+            for (i = 0; i < ECMULT_GEN_PREC_B; i++) {
                 secp256k1_gej_double_var(&gbase, &gbase, NULL);
             }
             /* Multiply numbase by 2. */
             secp256k1_gej_double_var(&numsbase, &numsbase, NULL);
-            if (j == 62) {
+            if (j == ECMULT_GEN_PREC_N - 2) {
                 /* In the last iteration, numsbase is (1 - 2^j) * nums instead. */
                 secp256k1_gej_neg(&numsbase, &numsbase);
                 secp256k1_gej_add_var(&numsbase, &numsbase, &nums_gej, NULL);
             }
         }
-        secp256k1_ge_set_all_gej_var(prec, precj, 1024, cb);
+        secp256k1_ge_set_all_gej_var(prec, precj, ECMULT_GEN_PREC_N * ECMULT_GEN_PREC_G, cb);
+        free(precj);
     }
-    for (j = 0; j < 64; j++) {
-        for (i = 0; i < 16; i++) {
-            secp256k1_ge_to_storage(&(*ctx->prec)[j][i], &prec[j*16 + i]);
+    for (j = 0; j < ECMULT_GEN_PREC_N; j++) {
+        for (i = 0; i < ECMULT_GEN_PREC_G; i++) {
+            secp256k1_ge_to_storage(&(*ctx->prec)[j][i], &prec[j*ECMULT_GEN_PREC_G + i]);
         }
     }
+    free(prec);
 #else
     (void)cb;
-    ctx->prec = (secp256k1_ge_storage (*)[64][16])secp256k1_ecmult_static_context;
+    ctx->prec = (secp256k1_ge_storage (*)[ECMULT_GEN_PREC_N][ECMULT_GEN_PREC_G])secp256k1_ecmult_static_context;
 #endif
     secp256k1_ecmult_gen_blind(ctx, NULL);
 }
@@ -97,14 +109,14 @@ static int secp256k1_ecmult_gen_context_is_built(const secp256k1_ecmult_gen_cont
 
 static void secp256k1_ecmult_gen_context_clone(secp256k1_ecmult_gen_context *dst,
                                                const secp256k1_ecmult_gen_context *src, const secp256k1_callback* cb) {
+    /* The comb table is shared, read-only data; only the blinding is copied. */
+    (void)cb;
     if (src->prec == NULL) {
         dst->prec = NULL;
     } else {
 #ifndef USE_ECMULT_STATIC_PRECOMPUTATION
-        dst->prec = (secp256k1_ge_storage (*)[64][16])checked_malloc(cb, sizeof(*dst->prec));
-        memcpy(dst->prec, src->prec, sizeof(*dst->prec));
+        dst->prec = (secp256k1_ge_storage (*)[ECMULT_GEN_PREC_N][ECMULT_GEN_PREC_G])secp256k1_shared_ref(src->prec);
 #else
-        (void)cb;
         dst->prec = src->prec;
 #endif
         dst->initial = src->initial;
@@ -114,7 +126,7 @@ static void secp256k1_ecmult_gen_context_clone(secp256k1_ecmult_gen_context *dst
 
 static void secp256k1_ecmult_gen_context_clear(secp256k1_ecmult_gen_context *ctx) {
 #ifndef USE_ECMULT_STATIC_PRECOMPUTATION
-    free(ctx->prec);
+    secp256k1_shared_free(ctx->prec);
 #endif
     secp256k1_scalar_clear(&ctx->blind);
     secp256k1_gej_clear(&ctx->initial);
@@ -122,6 +134,7 @@ static void secp256k1_ecmult_gen_context_clear(secp256k1_ecmult_gen_context *ctx
 }
 
 static void secp256k1_ecmult_gen(const secp256k1_ecmult_gen_context *ctx, secp256k1_gej *r, const secp256k1_scalar *gn) {
+    SECP256K1_STATS_BEGIN(ticks)
     secp256k1_ge add;
     secp256k1_ge_storage adds;
     secp256k1_scalar gnb;
@@ -132,9 +145,9 @@ static void secp256k1_ecmult_gen(const secp256k1_ecmult_gen_context *ctx, secp25
     /* Blind scalar/point multiplication by computing (n-b)G + bG instead of nG. */
     secp256k1_scalar_add(&gnb, gn, &ctx->blind);
     add.infinity = 0;
-    for (j = 0; j < 64; j++) {
-        bits = secp256k1_scalar_get_bits(&gnb, j * 4, 4);
-        for (i = 0; i < 16; i++) {
+    for (j = 0; j < ECMULT_GEN_PREC_N; j++) {
+        bits = secp256k1_scalar_get_bits(&gnb, j * ECMULT_GEN_PREC_B, ECMULT_GEN_PREC_B);
+        for (i = 0; i < ECMULT_GEN_PREC_G; i++) {
             /** This uses a conditional move to avoid any secret data in array indexes.
              *   _Any_ use of secret indexes has been demonstrated to result in timing
              *   sidechannels, even when the cache-line access patterns are uniform.
@@ -153,6 +166,60 @@ static void secp256k1_ecmult_gen(const secp256k1_ecmult_gen_context *ctx, secp25
     bits = 0;
     secp256k1_ge_clear(&add);
     secp256k1_scalar_clear(&gnb);
+    SECP256K1_STATS_END(ECMULT_GEN, ticks);
+}
+
+#ifdef SECP256K1_FE4_VECTOR
+/* Four secp256k1_ecmult_gen in lockstep: the table lookups stay per lane, the
+ * additions run on all four lanes at once. Only worth it with the vector
+ * kernels; the portable fe4 fallback is slower than four plain runs. */
+static void secp256k1_ecmult_gen4(const secp256k1_ecmult_gen_context *ctx, secp256k1_gej *r, const secp256k1_scalar *gn) {
+    secp256k1_gej4 r4;
+    secp256k1_ge4 add4;
+    secp256k1_ge_storage adds;
+    secp256k1_scalar gnb[4];
+    int bits;
+    int i, j, l;
+    memset(&adds, 0, sizeof(adds));
+    for (l = 0; l < 4; l++) {
+        secp256k1_gej4_set_gej(&r4, l, &ctx->initial);
+        secp256k1_scalar_add(&gnb[l], &gn[l], &ctx->blind);
+    }
+    for (j = 0; j < ECMULT_GEN_PREC_N; j++) {
+        for (l = 0; l < 4; l++) {
+            bits = secp256k1_scalar_get_bits(&gnb[l], j * ECMULT_GEN_PREC_B, ECMULT_GEN_PREC_B);
+            for (i = 0; i < ECMULT_GEN_PREC_G; i++) {
+                /* See secp256k1_ecmult_gen on why this is a cmov and not an index. */
+                secp256k1_ge_storage_cmov(&adds, &(*ctx->prec)[j][i], i == bits);
+            }
+            secp256k1_ge4_set_ge_storage(&add4, l, &adds);
+        }
+        secp256k1_gej4_add_ge(&r4, &r4, &add4);
+    }
+    for (l = 0; l < 4; l++) {
+        secp256k1_gej4_get_gej(&r[l], &r4, l);
+        secp256k1_scalar_clear(&gnb[l]);
+    }
+    bits = 0;
+    memset(&adds, 0, sizeof(adds));
+    memset(&add4, 0, sizeof(add4));
+    memset(&r4, 0, sizeof(r4));
+#ifdef ENABLE_STATS
+    SECP256K1_STATS_ADD(secp256k1_stats_counts[SECP256K1_STAT_ECMULT_GEN], 4);
+#endif
+}
+#endif
+
+static void secp256k1_ecmult_gen_many(const secp256k1_ecmult_gen_context *ctx, secp256k1_gej *r, const secp256k1_scalar *a, size_t n) {
+    size_t i = 0;
+#ifdef SECP256K1_FE4_VECTOR
+    for (; i + 4 <= n; i += 4) {
+        secp256k1_ecmult_gen4(ctx, &r[i], &a[i]);
+    }
+#endif
+    for (; i < n; i++) {
+        secp256k1_ecmult_gen(ctx, &r[i], &a[i]);
+    }
 }
 
 /* Setup blinding values for secp256k1_ecmult_gen. */
@@ -12,6 +12,8 @@
 #include "group.h"
 #include "scalar.h"
 #include "ecmult.h"
+#include "scratch_impl.h"
+#include "stats.h"
 
 #if defined(EXHAUSTIVE_TEST_ORDER)
 /* We need to lower these values for exhaustive tests because
@@ -30,20 +32,35 @@
 #else
 /* optimal for 128-bit and 256-bit exponents. */
 #define WINDOW_A 5
-/** larger numbers may result in slightly better performance, at the cost of
-    exponentially larger precomputed tables. */
-#ifdef USE_ENDOMORPHISM
-/** Two tables for window size 15: 1.375 MiB. */
-#define WINDOW_G 15
-#else
-/** One table for window size 16: 1.375 MiB. */
-#define WINDOW_G 16
+/** Larger values of ECMULT_WINDOW_SIZE (set in libsecp256k1-config.h) give
+ *  slightly better verification performance, at the cost of exponentially
+ *  larger precomputed tables: each table holds 2^(ECMULT_WINDOW_SIZE-2)
+ *  points of 64 bytes, and endomorphism builds keep two of them. */
+#ifndef ECMULT_WINDOW_SIZE
+#  ifdef USE_ENDOMORPHISM
+/** Two tables for window size 15: 1 MiB. */
+#    define ECMULT_WINDOW_SIZE 15
+#  else
+/** One table for window size 16: 1 MiB. */
+#    define ECMULT_WINDOW_SIZE 16
+#  endif
+#endif
+#if ECMULT_WINDOW_SIZE < 2 || ECMULT_WINDOW_SIZE > 24
+#  error "Set ECMULT_WINDOW_SIZE to an integer in range [2..24]."
 #endif
+#define WINDOW_G ECMULT_WINDOW_SIZE
 #endif
 
 /** The number of entries a table with precomputed multiples needs to have. */
 #define ECMULT_TABLE_SIZE(w) (1 << ((w)-2))
 
+#ifdef USE_ECMULT_STATIC_PRECOMPUTATION
+#include "ecmult_static_context.h"
+#if WINDOW_G > ECMULT_STATIC_WINDOW_G
+#error "WINDOW_G is larger than the window of ecmult_static_context.h; regenerate it with gen_secp256k1_context.c"
+#endif
+#endif
+
 /** Fill a table 'prej' with precomputed odd multiples of a. Prej will contain
  *  the values [1*a,3*a,...,(2*n-1)*a], so it space for n values. zr[0] will
  *  contain prej[0].z / a.z. The other zr[i] values = prej[i].z / prej[i-1].z.
@@ -109,6 +126,7 @@ static void secp256k1_ecmult_odd_multiples_table_globalz_windowa(secp256k1_ge *p
     secp256k1_ge_globalz_set_table_gej(ECMULT_TABLE_SIZE(WINDOW_A), pre, globalz, prej, zr);
 }
 
+#ifndef USE_ECMULT_STATIC_PRECOMPUTATION
 static void secp256k1_ecmult_odd_multiples_table_storage_var(int n, secp256k1_ge_storage *pre, const secp256k1_gej *a, const secp256k1_callback *cb) {
     secp256k1_gej *prej = (secp256k1_gej*)checked_malloc(cb, sizeof(secp256k1_gej) * n);
     secp256k1_ge *prea = (secp256k1_ge*)checked_malloc(cb, sizeof(secp256k1_ge) * n);
@@ -128,6 +146,7 @@ static void secp256k1_ecmult_odd_multiples_table_storage_var(int n, secp256k1_ge
     free(prej);
     free(zr);
 }
+#endif
 
 /** The following two macro retrieves a particular odd multiple from a table
  *  of precomputed multiples. */
@@ -162,16 +181,19 @@ static void secp256k1_ecmult_context_init(secp256k1_ecmult_context *ctx) {
 }
 
 static void secp256k1_ecmult_context_build(secp256k1_ecmult_context *ctx, const secp256k1_callback *cb) {
+#ifndef USE_ECMULT_STATIC_PRECOMPUTATION
     secp256k1_gej gj;
+#endif
 
     if (ctx->pre_g != NULL) {
         return;
     }
 
+#ifndef USE_ECMULT_STATIC_PRECOMPUTATION
     /* get the generator */
     secp256k1_gej_set_ge(&gj, &secp256k1_ge_const_g);
 
-    ctx->pre_g = (secp256k1_ge_storage (*)[])checked_malloc(cb, sizeof((*ctx->pre_g)[0]) * ECMULT_TABLE_SIZE(WINDOW_G));
+    ctx->pre_g = (secp256k1_ge_storage (*)[])secp256k1_shared_malloc(cb, sizeof((*ctx->pre_g)[0]) * ECMULT_TABLE_SIZE(WINDOW_G));
 
     /* precompute the tables with odd multiples */
     secp256k1_ecmult_odd_multiples_table_storage_var(ECMULT_TABLE_SIZE(WINDOW_G), *ctx->pre_g, &gj, cb);
@@ -181,7 +203,7 @@ static void secp256k1_ecmult_context_build(secp256k1_ecmult_context *ctx, const
         secp256k1_gej g_128j;
         int i;
 
-        ctx->pre_g_128 = (secp256k1_ge_storage (*)[])checked_malloc(cb, sizeof((*ctx->pre_g_128)[0]) * ECMULT_TABLE_SIZE(WINDOW_G));
+        ctx->pre_g_128 = (secp256k1_ge_storage (*)[])secp256k1_shared_malloc(cb, sizeof((*ctx->pre_g_128)[0]) * ECMULT_TABLE_SIZE(WINDOW_G));
 
         /* calculate 2^128*generator */
         g_128j = gj;
@@ -191,25 +213,30 @@ static void secp256k1_ecmult_context_build(secp256k1_ecmult_context *ctx, const
         secp256k1_ecmult_odd_multiples_table_storage_var(ECMULT_TABLE_SIZE(WINDOW_G), *ctx->pre_g_128, &g_128j, cb);
     }
 #endif
+#else
+    /* The tables are shared, read-only data: nothing to allocate or compute. */
+    (void)cb;
+    ctx->pre_g = (secp256k1_ge_storage (*)[])secp256k1_ecmult_static_pre_g;
+#ifdef USE_ENDOMORPHISM
+    ctx->pre_g_128 = (secp256k1_ge_storage (*)[])secp256k1_ecmult_static_pre_g_128;
+#endif
+#endif
 }
 
 static void secp256k1_ecmult_context_clone(secp256k1_ecmult_context *dst,
                                            const secp256k1_ecmult_context *src, const secp256k1_callback *cb) {
-    if (src->pre_g == NULL) {
-        dst->pre_g = NULL;
-    } else {
-        size_t size = sizeof((*dst->pre_g)[0]) * ECMULT_TABLE_SIZE(WINDOW_G);
-        dst->pre_g = (secp256k1_ge_storage (*)[])checked_malloc(cb, size);
-        memcpy(dst->pre_g, src->pre_g, size);
-    }
+    /* The tables are never written after being built, so the clone shares them. */
+    (void)cb;
+#ifndef USE_ECMULT_STATIC_PRECOMPUTATION
+    dst->pre_g = (secp256k1_ge_storage (*)[])secp256k1_shared_ref(src->pre_g);
 #ifdef USE_ENDOMORPHISM
-    if (src->pre_g_128 == NULL) {
-        dst->pre_g_128 = NULL;
-    } else {
-        size_t size = sizeof((*dst->pre_g_128)[0]) * ECMULT_TABLE_SIZE(WINDOW_G);
-        dst->pre_g_128 = (secp256k1_ge_storage (*)[])checked_malloc(cb, size);
-        memcpy(dst->pre_g_128, src->pre_g_128, size);
-    }
+    dst->pre_g_128 = (secp256k1_ge_storage (*)[])secp256k1_shared_ref(src->pre_g_128);
+#endif
+#else
+    dst->pre_g = src->pre_g;
+#ifdef USE_ENDOMORPHISM
+    dst->pre_g_128 = src->pre_g_128;
+#endif
 #endif
 }
 
@@ -218,9 +245,11 @@ static int secp256k1_ecmult_context_is_built(const secp256k1_ecmult_context *ctx
 }
 
 static void secp256k1_ecmult_context_clear(secp256k1_ecmult_context *ctx) {
-    free(ctx->pre_g);
+#ifndef USE_ECMULT_STATIC_PRECOMPUTATION
+    secp256k1_shared_free(ctx->pre_g);
 #ifdef USE_ENDOMORPHISM
-    free(ctx->pre_g_128);
+    secp256k1_shared_free(ctx->pre_g_128);
+#endif
 #endif
     secp256k1_ecmult_context_init(ctx);
 }
@@ -283,12 +312,41 @@ static int secp256k1_ecmult_wnaf(int *wnaf, int len, const secp256k1_scalar *a,
     return last_set_bit + 1;
 }
 
-static void secp256k1_ecmult(const secp256k1_ecmult_context *ctx, secp256k1_gej *r, const secp256k1_gej *a, const secp256k1_scalar *na, const secp256k1_scalar *ng) {
+/** The odd multiples of a point that secp256k1_ecmult builds for it on every
+ *  call, kept in actually affine form so they can be reused across calls. */
+struct secp256k1_ecmult_point_table_struct {
     secp256k1_ge pre_a[ECMULT_TABLE_SIZE(WINDOW_A)];
-    secp256k1_ge tmpa;
-    secp256k1_fe Z;
 #ifdef USE_ENDOMORPHISM
     secp256k1_ge pre_a_lam[ECMULT_TABLE_SIZE(WINDOW_A)];
+#endif
+};
+
+static void secp256k1_ecmult_point_table_build(secp256k1_ecmult_point_table *table, const secp256k1_ge *a) {
+    secp256k1_gej prej[ECMULT_TABLE_SIZE(WINDOW_A)];
+    secp256k1_fe zr[ECMULT_TABLE_SIZE(WINDOW_A)];
+    secp256k1_gej aj;
+#ifdef USE_ENDOMORPHISM
+    int i;
+#endif
+
+    VERIFY_CHECK(!secp256k1_ge_is_infinity(a));
+    secp256k1_gej_set_ge(&aj, a);
+    secp256k1_ecmult_odd_multiples_table(ECMULT_TABLE_SIZE(WINDOW_A), prej, zr, &aj);
+    secp256k1_ge_set_table_gej_var(table->pre_a, prej, zr, ECMULT_TABLE_SIZE(WINDOW_A));
+#ifdef USE_ENDOMORPHISM
+    for (i = 0; i < ECMULT_TABLE_SIZE(WINDOW_A); i++) {
+        secp256k1_ge_mul_lambda(&table->pre_a_lam[i], &table->pre_a[i]);
+    }
+#endif
+}
+
+/** The main loop of secp256k1_ecmult, given the odd multiples of A. If Z is
+ *  not NULL, the pre_a points are only affine on the isomorphism where the
+ *  common Z denominator Z is dropped (see secp256k1_ecmult); otherwise they
+ *  are actually affine. */
+static void secp256k1_ecmult_with_table(const secp256k1_ecmult_context *ctx, secp256k1_gej *r, const secp256k1_ge *pre_a, const secp256k1_ge *pre_a_lam, const secp256k1_fe *Z, const secp256k1_scalar *na, const secp256k1_scalar *ng) {
+    secp256k1_ge tmpa;
+#ifdef USE_ENDOMORPHISM
     secp256k1_scalar na_1, na_lam;
     /* Splitted G factors. */
     secp256k1_scalar ng_1, ng_128;
@@ -322,28 +380,6 @@ static void secp256k1_ecmult(const secp256k1_ecmult_context *ctx, secp256k1_gej
     if (bits_na_lam > bits) {
         bits = bits_na_lam;
     }
-#else
-    /* build wnaf representation for na. */
-    bits_na     = secp256k1_ecmult_wnaf(wnaf_na,     256, na,      WINDOW_A);
-    bits = bits_na;
-#endif
-
-    /* Calculate odd multiples of a.
-     * All multiples are brought to the same Z 'denominator', which is stored
-     * in Z. Due to secp256k1' isomorphism we can do all operations pretending
-     * that the Z coordinate was 1, use affine addition formulae, and correct
-     * the Z coordinate of the result once at the end.
-     * The exception is the precomputed G table points, which are actually
-     * affine. Compared to the base used for other points, they have a Z ratio
-     * of 1/Z, so we can use secp256k1_gej_add_zinv_var, which uses the same
-     * isomorphism to efficiently add with a known Z inverse.
-     */
-    secp256k1_ecmult_odd_multiples_table_globalz_windowa(pre_a, &Z, a);
-
-#ifdef USE_ENDOMORPHISM
-    for (i = 0; i < ECMULT_TABLE_SIZE(WINDOW_A); i++) {
-        secp256k1_ge_mul_lambda(&pre_a_lam[i], &pre_a[i]);
-    }
 
     /* split ng into ng_1 and ng_128 (where gn = gn_1 + gn_128*2^128, and gn_1 and gn_128 are ~128 bit) */
     secp256k1_scalar_split_128(&ng_1, &ng_128, ng);
@@ -358,6 +394,11 @@ static void secp256k1_ecmult(const secp256k1_ecmult_context *ctx, secp256k1_gej
         bits = bits_ng_128;
     }
 #else
+    (void)pre_a_lam;
+    /* build wnaf representation for na. */
+    bits_na     = secp256k1_ecmult_wnaf(wnaf_na,     256, na,      WINDOW_A);
+    bits = bits_na;
+
     bits_ng     = secp256k1_ecmult_wnaf(wnaf_ng,     256, ng,      WINDOW_G);
     if (bits_ng > bits) {
         bits = bits_ng;
@@ -380,17 +421,239 @@ static void secp256k1_ecmult(const secp256k1_ecmult_context *ctx, secp256k1_gej
         }
         if (i < bits_ng_1 && (n = wnaf_ng_1[i])) {
             ECMULT_TABLE_GET_GE_STORAGE(&tmpa, *ctx->pre_g, n, WINDOW_G);
-            secp256k1_gej_add_zinv_var(r, r, &tmpa, &Z);
+            if (Z != NULL) {
+                secp256k1_gej_add_zinv_var(r, r, &tmpa, Z);
+            } else {
+                secp256k1_gej_add_ge_var(r, r, &tmpa, NULL);
+            }
         }
         if (i < bits_ng_128 && (n = wnaf_ng_128[i])) {
             ECMULT_TABLE_GET_GE_STORAGE(&tmpa, *ctx->pre_g_128, n, WINDOW_G);
-            secp256k1_gej_add_zinv_var(r, r, &tmpa, &Z);
+            if (Z != NULL) {
+                secp256k1_gej_add_zinv_var(r, r, &tmpa, Z);
+            } else {
+                secp256k1_gej_add_ge_var(r, r, &tmpa, NULL);
+            }
         }
 #else
         if (i < bits_na && (n = wnaf_na[i])) {
             ECMULT_TABLE_GET_GE(&tmpa, pre_a, n, WINDOW_A);
             secp256k1_gej_add_ge_var(r, r, &tmpa, NULL);
         }
+        if (i < bits_ng && (n = wnaf_ng[i])) {
+            ECMULT_TABLE_GET_GE_STORAGE(&tmpa, *ctx->pre_g, n, WINDOW_G);
+            if (Z != NULL) {
+                secp256k1_gej_add_zinv_var(r, r, &tmpa, Z);
+            } else {
+                secp256k1_gej_add_ge_var(r, r, &tmpa, NULL);
+            }
+        }
+#endif
+    }
+
+    if (Z != NULL && !r->infinity) {
+        secp256k1_fe_mul(&r->z, &r->z, Z);
+    }
+}
+
+static void secp256k1_ecmult(const secp256k1_ecmult_context *ctx, secp256k1_gej *r, const secp256k1_gej *a, const secp256k1_scalar *na, const secp256k1_scalar *ng) {
+    SECP256K1_STATS_BEGIN(ticks)
+    secp256k1_ge pre_a[ECMULT_TABLE_SIZE(WINDOW_A)];
+    secp256k1_fe Z;
+#ifdef USE_ENDOMORPHISM
+    secp256k1_ge pre_a_lam[ECMULT_TABLE_SIZE(WINDOW_A)];
+    int i;
+#endif
+
+    /* Calculate odd multiples of a.
+     * All multiples are brought to the same Z 'denominator', which is stored
+     * in Z. Due to secp256k1' isomorphism we can do all operations pretending
+     * that the Z coordinate was 1, use affine addition formulae, and correct
+     * the Z coordinate of the result once at the end.
+     * The exception is the precomputed G table points, which are actually
+     * affine. Compared to the base used for other points, they have a Z ratio
+     * of 1/Z, so we can use secp256k1_gej_add_zinv_var, which uses the same
+     * isomorphism to efficiently add with a known Z inverse.
+     */
+    secp256k1_ecmult_odd_multiples_table_globalz_windowa(pre_a, &Z, a);
+
+#ifdef USE_ENDOMORPHISM
+    for (i = 0; i < ECMULT_TABLE_SIZE(WINDOW_A); i++) {
+        secp256k1_ge_mul_lambda(&pre_a_lam[i], &pre_a[i]);
+    }
+    secp256k1_ecmult_with_table(ctx, r, pre_a, pre_a_lam, &Z, na, ng);
+#else
+    secp256k1_ecmult_with_table(ctx, r, pre_a, NULL, &Z, na, ng);
+#endif
+    SECP256K1_STATS_END(ECMULT, ticks);
+}
+
+static void secp256k1_ecmult_point_table_mul(const secp256k1_ecmult_context *ctx, secp256k1_gej *r, const secp256k1_ecmult_point_table *table, const secp256k1_scalar *na, const secp256k1_scalar *ng) {
+#ifdef USE_ENDOMORPHISM
+    secp256k1_ecmult_with_table(ctx, r, table->pre_a, table->pre_a_lam, NULL, na, ng);
+#else
+    secp256k1_ecmult_with_table(ctx, r, table->pre_a, NULL, NULL, na, ng);
+#endif
+}
+
+#ifdef USE_ENDOMORPHISM
+    #define ECMULT_WNAF_SPLITS 2
+    #define ECMULT_WNAF_SPLIT_LEN 130
+    #define ECMULT_PIPPENGER_BITS 129
+    /** Number of points from which Pippenger beats Strauss. */
+    #define ECMULT_PIPPENGER_THRESHOLD 88
+#else
+    #define ECMULT_WNAF_SPLITS 1
+    #define ECMULT_WNAF_SPLIT_LEN 256
+    #define ECMULT_PIPPENGER_BITS 256
+    #define ECMULT_PIPPENGER_THRESHOLD 160
+#endif
+
+/** Largest bucket window Pippenger will use: 2^11 buckets. */
+#define PIPPENGER_MAX_BUCKET_WINDOW 12
+
+/** Number of scratch space allocations each algorithm needs. */
+#define STRAUSS_SCRATCH_OBJECTS 6
+#define PIPPENGER_SCRATCH_OBJECTS 4
+
+struct secp256k1_strauss_point_state {
+    int wnaf_na[ECMULT_WNAF_SPLITS][ECMULT_WNAF_SPLIT_LEN];
+    int bits_na[ECMULT_WNAF_SPLITS];
+    size_t input_pos;
+};
+
+struct secp256k1_strauss_state {
+    secp256k1_gej* prej;
+    secp256k1_fe* zr;
+    secp256k1_ge* pre_a;
+    struct secp256k1_strauss_point_state* ps;
+};
+
+/** Strauss' algorithm for computing sum(na[i]*a[i]) + ng*G. Every point gets
+ *  its own WINDOW_A odd-multiples table, and all tables are brought to a
+ *  single global Z, so that the main loop can use affine additions for all of
+ *  them and share the doublings. Points that are infinity or have a zero
+ *  scalar are skipped. state must have room for num points, ng may be NULL.
+ */
+static void secp256k1_ecmult_strauss_wnaf(const secp256k1_ecmult_context *ctx, const struct secp256k1_strauss_state *state, secp256k1_gej *r, size_t num, const secp256k1_gej *a, const secp256k1_scalar *na, const secp256k1_scalar *ng) {
+#ifdef USE_ENDOMORPHISM
+    secp256k1_scalar ng_1, ng_128;
+    int wnaf_ng_1[129];
+    int bits_ng_1 = 0;
+    int wnaf_ng_128[129];
+    int bits_ng_128 = 0;
+#else
+    int wnaf_ng[256];
+    int bits_ng = 0;
+#endif
+    const size_t ts = ECMULT_TABLE_SIZE(WINDOW_A);
+    secp256k1_ge tmpa;
+    secp256k1_fe Z;
+    size_t np, no = 0;
+    int i, bits = 0;
+
+    for (np = 0; np < num; np++) {
+        struct secp256k1_strauss_point_state *ps = &state->ps[no];
+        int k;
+#ifdef USE_ENDOMORPHISM
+        secp256k1_scalar split[2];
+#endif
+        if (secp256k1_scalar_is_zero(&na[np]) || secp256k1_gej_is_infinity(&a[np])) {
+            continue;
+        }
+#ifdef USE_ENDOMORPHISM
+        /* split na into na_1 and na_lam (where na = na_1 + na_lam*lambda, and na_1 and na_lam are ~128 bit) */
+        secp256k1_scalar_split_lambda(&split[0], &split[1], &na[np]);
+        for (k = 0; k < 2; k++) {
+            ps->bits_na[k] = secp256k1_ecmult_wnaf(ps->wnaf_na[k], ECMULT_WNAF_SPLIT_LEN, &split[k], WINDOW_A);
+        }
+#else
+        ps->bits_na[0] = secp256k1_ecmult_wnaf(ps->wnaf_na[0], ECMULT_WNAF_SPLIT_LEN, &na[np], WINDOW_A);
+#endif
+        for (k = 0; k < ECMULT_WNAF_SPLITS; k++) {
+            VERIFY_CHECK(ps->bits_na[k] <= ECMULT_WNAF_SPLIT_LEN);
+            if (ps->bits_na[k] > bits) {
+                bits = ps->bits_na[k];
+            }
+        }
+        ps->input_pos = np;
+        no++;
+    }
+
+    if (no > 0) {
+        /* Compute the odd multiples in Jacobian form. Every point after the
+         * first is rescaled by the last Z of the table before it, so that its
+         * table's first z-ratio (times its own Z) chains onto that table. */
+        secp256k1_ecmult_odd_multiples_table((int)ts, state->prej, state->zr, &a[state->ps[0].input_pos]);
+        for (np = 1; np < no; np++) {
+            secp256k1_gej tmp = a[state->ps[np].input_pos];
+#ifdef VERIFY
+            secp256k1_fe_normalize_var(&state->prej[np * ts - 1].z);
+#endif
+            secp256k1_gej_rescale(&tmp, &state->prej[np * ts - 1].z);
+            secp256k1_ecmult_odd_multiples_table((int)ts, state->prej + np * ts, state->zr + np * ts, &tmp);
+            secp256k1_fe_mul(&state->zr[np * ts], &state->zr[np * ts], &a[state->ps[np].input_pos].z);
+        }
+        /* Bring them to the same Z denominator. */
+        secp256k1_ge_globalz_set_table_gej(ts * no, state->pre_a, &Z, state->prej, state->zr);
+#ifdef USE_ENDOMORPHISM
+        /* The lambda tables live right after the regular ones. */
+        for (np = 0; np < ts * no; np++) {
+            secp256k1_ge_mul_lambda(&state->pre_a[ts * no + np], &state->pre_a[np]);
+        }
+#endif
+    } else {
+        secp256k1_fe_set_int(&Z, 1);
+    }
+
+    if (ng != NULL) {
+#ifdef USE_ENDOMORPHISM
+        /* split ng into ng_1 and ng_128 (where gn = gn_1 + gn_128*2^128, and gn_1 and gn_128 are ~128 bit) */
+        secp256k1_scalar_split_128(&ng_1, &ng_128, ng);
+        bits_ng_1   = secp256k1_ecmult_wnaf(wnaf_ng_1,   129, &ng_1,   WINDOW_G);
+        bits_ng_128 = secp256k1_ecmult_wnaf(wnaf_ng_128, 129, &ng_128, WINDOW_G);
+        if (bits_ng_1 > bits) {
+            bits = bits_ng_1;
+        }
+        if (bits_ng_128 > bits) {
+            bits = bits_ng_128;
+        }
+#else
+        bits_ng = secp256k1_ecmult_wnaf(wnaf_ng, 256, ng, WINDOW_G);
+        if (bits_ng > bits) {
+            bits = bits_ng;
+        }
+#endif
+    }
+
+    secp256k1_gej_set_infinity(r);
+
+    for (i = bits - 1; i >= 0; i--) {
+        int n;
+        secp256k1_gej_double_var(r, r, NULL);
+        for (np = 0; np < no; np++) {
+            const struct secp256k1_strauss_point_state *ps = &state->ps[np];
+            if (i < ps->bits_na[0] && (n = ps->wnaf_na[0][i])) {
+                ECMULT_TABLE_GET_GE(&tmpa, state->pre_a + np * ts, n, WINDOW_A);
+                secp256k1_gej_add_ge_var(r, r, &tmpa, NULL);
+            }
+#ifdef USE_ENDOMORPHISM
+            if (i < ps->bits_na[1] && (n = ps->wnaf_na[1][i])) {
+                ECMULT_TABLE_GET_GE(&tmpa, state->pre_a + ts * no + np * ts, n, WINDOW_A);
+                secp256k1_gej_add_ge_var(r, r, &tmpa, NULL);
+            }
+#endif
+        }
+#ifdef USE_ENDOMORPHISM
+        if (i < bits_ng_1 && (n = wnaf_ng_1[i])) {
+            ECMULT_TABLE_GET_GE_STORAGE(&tmpa, *ctx->pre_g, n, WINDOW_G);
+            secp256k1_gej_add_zinv_var(r, r, &tmpa, &Z);
+        }
+        if (i < bits_ng_128 && (n = wnaf_ng_128[i])) {
+            ECMULT_TABLE_GET_GE_STORAGE(&tmpa, *ctx->pre_g_128, n, WINDOW_G);
+            secp256k1_gej_add_zinv_var(r, r, &tmpa, &Z);
+        }
+#else
         if (i < bits_ng && (n = wnaf_ng[i])) {
             ECMULT_TABLE_GET_GE_STORAGE(&tmpa, *ctx->pre_g, n, WINDOW_G);
             secp256k1_gej_add_zinv_var(r, r, &tmpa, &Z);
@@ -403,4 +666,352 @@ static void secp256k1_ecmult(const secp256k1_ecmult_context *ctx, secp256k1_gej
     }
 }
 
+/** R = ng*G, using the precomputed G tables (no scratch space needed). */
+static void secp256k1_ecmult_strauss_g_var(const secp256k1_ecmult_context *ctx, secp256k1_gej *r, const secp256k1_scalar *ng) {
+    struct secp256k1_strauss_state state;
+    state.prej = NULL;
+    state.zr = NULL;
+    state.pre_a = NULL;
+    state.ps = NULL;
+    secp256k1_ecmult_strauss_wnaf(ctx, &state, r, 0, NULL, NULL, ng);
+}
+
+static size_t secp256k1_strauss_scratch_size(size_t n_points) {
+    static const size_t point_size = (sizeof(secp256k1_gej) + sizeof(secp256k1_fe) + sizeof(secp256k1_ge) * ECMULT_WNAF_SPLITS) * ECMULT_TABLE_SIZE(WINDOW_A) + sizeof(struct secp256k1_strauss_point_state) + sizeof(secp256k1_gej) + sizeof(secp256k1_scalar);
+    return n_points * point_size;
+}
+
+static size_t secp256k1_strauss_max_points(const secp256k1_callback* error_callback, const secp256k1_scratch *scratch) {
+    return secp256k1_scratch_max_allocation(error_callback, scratch, STRAUSS_SCRATCH_OBJECTS) / secp256k1_strauss_scratch_size(1);
+}
+
+static int secp256k1_ecmult_strauss_batch(const secp256k1_callback* error_callback, const secp256k1_ecmult_context *ctx, secp256k1_scratch *scratch, secp256k1_gej *r, const secp256k1_scalar *inp_g_sc, secp256k1_ecmult_multi_callback cb, void *cbdata, size_t n_points, size_t cb_offset) {
+    const size_t ts = ECMULT_TABLE_SIZE(WINDOW_A);
+    secp256k1_gej* points;
+    secp256k1_scalar* scalars;
+    struct secp256k1_strauss_state state;
+    size_t i;
+    const size_t scratch_checkpoint = secp256k1_scratch_checkpoint(error_callback, scratch);
+
+    secp256k1_gej_set_infinity(r);
+    if (inp_g_sc == NULL && n_points == 0) {
+        return 1;
+    }
+
+    points = (secp256k1_gej*)secp256k1_scratch_alloc(error_callback, scratch, n_points * sizeof(secp256k1_gej));
+    scalars = (secp256k1_scalar*)secp256k1_scratch_alloc(error_callback, scratch, n_points * sizeof(secp256k1_scalar));
+    state.prej = (secp256k1_gej*)secp256k1_scratch_alloc(error_callback, scratch, n_points * ts * sizeof(secp256k1_gej));
+    state.zr = (secp256k1_fe*)secp256k1_scratch_alloc(error_callback, scratch, n_points * ts * sizeof(secp256k1_fe));
+    state.pre_a = (secp256k1_ge*)secp256k1_scratch_alloc(error_callback, scratch, n_points * ts * ECMULT_WNAF_SPLITS * sizeof(secp256k1_ge));
+    state.ps = (struct secp256k1_strauss_point_state*)secp256k1_scratch_alloc(error_callback, scratch, n_points * sizeof(struct secp256k1_strauss_point_state));
+
+    if (points == NULL || scalars == NULL || state.prej == NULL || state.zr == NULL || state.pre_a == NULL || state.ps == NULL) {
+        secp256k1_scratch_apply_checkpoint(error_callback, scratch, scratch_checkpoint);
+        return 0;
+    }
+
+    for (i = 0; i < n_points; i++) {
+        secp256k1_ge point;
+        if (!cb(&scalars[i], &point, i + cb_offset, cbdata)) {
+            secp256k1_scratch_apply_checkpoint(error_callback, scratch, scratch_checkpoint);
+            return 0;
+        }
+        secp256k1_gej_set_ge(&points[i], &point);
+    }
+    secp256k1_ecmult_strauss_wnaf(ctx, &state, r, n_points, points, scalars, inp_g_sc);
+    secp256k1_scratch_apply_checkpoint(error_callback, scratch, scratch_checkpoint);
+    return 1;
+}
+
+/** Recode s into n_wnd signed digits of w bits each, so that
+ *  s = sum(digits[j] * 2^(w*j)), with every digit in [-2^(w-1), 2^(w-1)).
+ *  Only the lowest `bits` bits of s may be set. */
+static void secp256k1_ecmult_pippenger_recode(int *digits, int n_wnd, const secp256k1_scalar *s, int w, int bits) {
+    int j;
+    int carry = 0;
+    for (j = 0; j < n_wnd; j++) {
+        int offset = j * w;
+        int v = carry;
+        if (offset < bits) {
+            int count = w;
+            if (count > bits - offset) {
+                count = bits - offset;
+            }
+            v += secp256k1_scalar_get_bits_var(s, offset, count);
+        }
+        carry = v >= (1 << (w - 1));
+        digits[j] = v - (carry << w);
+    }
+    VERIFY_CHECK(carry == 0);
+}
+
+/** Number of w-bit windows needed for a `bits`-bit scalar, plus one for the
+ *  carry out of the top window. */
+static int secp256k1_pippenger_n_wnd(int w) {
+    return (ECMULT_PIPPENGER_BITS + w - 1) / w + 1;
+}
+
+/** Pick the bucket window that minimises the number of group additions for
+ *  n points: every window costs one addition per point plus two per bucket. */
+static int secp256k1_pippenger_bucket_window(size_t n) {
+    int w, best_w = 2;
+    size_t best_cost = (size_t)-1;
+    size_t entries = n * ECMULT_WNAF_SPLITS;
+    for (w = 2; w <= PIPPENGER_MAX_BUCKET_WINDOW; w++) {
+        size_t cost = (size_t)secp256k1_pippenger_n_wnd(w) * (entries + ((size_t)2 << (w - 1))) + (size_t)ECMULT_PIPPENGER_BITS;
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_w = w;
+        }
+    }
+    return best_w;
+}
+
+static size_t secp256k1_pippenger_scratch_size(size_t n_points, int bucket_window) {
+    size_t entries = n_points * ECMULT_WNAF_SPLITS;
+    size_t entry_size = sizeof(secp256k1_ge) + sizeof(secp256k1_scalar) + sizeof(int) * secp256k1_pippenger_n_wnd(bucket_window);
+    return entries * entry_size + sizeof(secp256k1_gej) * ((size_t)1 << (bucket_window - 1));
+}
+
+/** Returns the largest n such that a batch of any size up to n fits in the
+ *  scratch space. A batch picks its window from its own size, and smaller
+ *  windows take more digits per point, so the counts picking each window are
+ *  checked in turn. */
+static size_t secp256k1_pippenger_max_points(const secp256k1_callback* error_callback, const secp256k1_scratch *scratch) {
+    size_t max_alloc = secp256k1_scratch_max_allocation(error_callback, scratch, PIPPENGER_SCRATCH_OBJECTS);
+    size_t res = 0;
+    int w;
+    for (w = 2; w <= PIPPENGER_MAX_BUCKET_WINDOW; w++) {
+        size_t buckets = sizeof(secp256k1_gej) * ((size_t)1 << (w - 1));
+        size_t per_point = secp256k1_pippenger_scratch_size(1, w) - buckets;
+        size_t n, lo, hi;
+        if (max_alloc <= buckets) {
+            break;
+        }
+        /* The most points that fit with window w. If they all pick w or
+         * less, the counts above them don't fit. */
+        n = (max_alloc - buckets) / per_point;
+        if (secp256k1_pippenger_bucket_window(n) <= w) {
+            return n > res ? n : res;
+        }
+        /* Else every count picking w fits; go on from the largest. */
+        lo = res;
+        hi = n;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo + 1) / 2;
+            if (secp256k1_pippenger_bucket_window(mid) <= w) {
+                lo = mid;
+            } else {
+                hi = mid - 1;
+            }
+        }
+        res = lo;
+    }
+    return res;
+}
+
+/** Pippenger's bucket method: for each w-bit window (from the top), every
+ *  point is added into the bucket of its digit, and the buckets are then
+ *  summed with weights 1..2^(w-1) using a running sum. */
+static void secp256k1_ecmult_pippenger_wnaf(secp256k1_gej *buckets, int bucket_window, const int *digits, int n_wnd, secp256k1_gej *r, const secp256k1_ge *pt, size_t num) {
+    const int n_buckets = 1 << (bucket_window - 1);
+    int j, k;
+    size_t i;
+
+    secp256k1_gej_set_infinity(r);
+    for (j = n_wnd - 1; j >= 0; j--) {
+        secp256k1_gej running_sum, window_sum;
+
+        for (k = 0; k < bucket_window && !secp256k1_gej_is_infinity(r); k++) {
+            secp256k1_gej_double_var(r, r, NULL);
+        }
+        for (k = 0; k < n_buckets; k++) {
+            secp256k1_gej_set_infinity(&buckets[k]);
+        }
+        for (i = 0; i < num; i++) {
+            int d = digits[i * n_wnd + j];
+            if (d > 0) {
+                secp256k1_gej_add_ge_var(&buckets[d - 1], &buckets[d - 1], &pt[i], NULL);
+            } else if (d < 0) {
+                secp256k1_ge neg;
+                secp256k1_ge_neg(&neg, &pt[i]);
+                secp256k1_gej_add_ge_var(&buckets[-d - 1], &buckets[-d - 1], &neg, NULL);
+            }
+        }
+        secp256k1_gej_set_infinity(&running_sum);
+        secp256k1_gej_set_infinity(&window_sum);
+        for (k = n_buckets - 1; k >= 0; k--) {
+            secp256k1_gej_add_var(&running_sum, &running_sum, &buckets[k], NULL);
+            secp256k1_gej_add_var(&window_sum, &window_sum, &running_sum, NULL);
+        }
+        secp256k1_gej_add_var(r, r, &window_sum, NULL);
+    }
+}
+
+static int secp256k1_ecmult_pippenger_batch(const secp256k1_callback* error_callback, const secp256k1_ecmult_context *ctx, secp256k1_scratch *scratch, secp256k1_gej *r, const secp256k1_scalar *inp_g_sc, secp256k1_ecmult_multi_callback cb, void *cbdata, size_t n_points, size_t cb_offset) {
+    const size_t scratch_checkpoint = secp256k1_scratch_checkpoint(error_callback, scratch);
+    const int bucket_window = secp256k1_pippenger_bucket_window(n_points);
+    const int n_wnd = secp256k1_pippenger_n_wnd(bucket_window);
+    const size_t entries = n_points * ECMULT_WNAF_SPLITS;
+    secp256k1_ge *points;
+    secp256k1_scalar *scalars;
+    secp256k1_gej *buckets;
+    int *digits;
+    size_t i, no = 0;
+
+    secp256k1_gej_set_infinity(r);
+    if (inp_g_sc == NULL && n_points == 0) {
+        return 1;
+    }
+
+    points = (secp256k1_ge*)secp256k1_scratch_alloc(error_callback, scratch, entries * sizeof(secp256k1_ge));
+    scalars = (secp256k1_scalar*)secp256k1_scratch_alloc(error_callback, scratch, entries * sizeof(secp256k1_scalar));
+    digits = (int*)secp256k1_scratch_alloc(error_callback, scratch, entries * n_wnd * sizeof(int));
+    buckets = (secp256k1_gej*)secp256k1_scratch_alloc(error_callback, scratch, ((size_t)1 << (bucket_window - 1)) * sizeof(secp256k1_gej));
+    if (points == NULL || scalars == NULL || digits == NULL || buckets == NULL) {
+        secp256k1_scratch_apply_checkpoint(error_callback, scratch, scratch_checkpoint);
+        return 0;
+    }
+
+    for (i = 0; i < n_points; i++) {
+        secp256k1_ge point;
+        secp256k1_scalar scalar;
+        int k;
+        if (!cb(&scalar, &point, i + cb_offset, cbdata)) {
+            secp256k1_scratch_apply_checkpoint(error_callback, scratch, scratch_checkpoint);
+            return 0;
+        }
+        if (secp256k1_scalar_is_zero(&scalar) || secp256k1_ge_is_infinity(&point)) {
+            continue;
+        }
+#ifdef USE_ENDOMORPHISM
+        secp256k1_scalar_split_lambda(&scalars[no], &scalars[no + 1], &scalar);
+        points[no] = point;
+        secp256k1_ge_mul_lambda(&points[no + 1], &point);
+#else
+        scalars[no] = scalar;
+        points[no] = point;
+#endif
+        /* Make every scalar "low", negating the point instead, so that all
+         * of them fit in ECMULT_PIPPENGER_BITS. */
+        for (k = 0; k < ECMULT_WNAF_SPLITS; k++) {
+            if (secp256k1_scalar_is_high(&scalars[no + k])) {
+                secp256k1_scalar_negate(&scalars[no + k], &scalars[no + k]);
+                secp256k1_ge_neg(&points[no + k], &points[no + k]);
+            }
+            secp256k1_ecmult_pippenger_recode(&digits[(no + k) * n_wnd], n_wnd, &scalars[no + k], bucket_window, ECMULT_PIPPENGER_BITS);
+        }
+        no += ECMULT_WNAF_SPLITS;
+    }
+
+    secp256k1_ecmult_pippenger_wnaf(buckets, bucket_window, digits, n_wnd, r, points, no);
+
+    if (inp_g_sc != NULL) {
+        /* The generator term goes through the precomputed G tables. */
+        secp256k1_gej gj;
+        secp256k1_ecmult_strauss_g_var(ctx, &gj, inp_g_sc);
+        secp256k1_gej_add_var(r, r, &gj, NULL);
+    }
+
+    secp256k1_scratch_apply_checkpoint(error_callback, scratch, scratch_checkpoint);
+    return 1;
+}
+
+/** Computes ecmult_multi by simply multiplying and adding each point. Does not
+ *  require a scratch space. */
+static int secp256k1_ecmult_multi_simple_var(const secp256k1_ecmult_context *ctx, secp256k1_gej *r, const secp256k1_scalar *inp_g_sc, secp256k1_ecmult_multi_callback cb, void *cbdata, size_t n_points) {
+    size_t point_idx;
+    secp256k1_scalar szero;
+    secp256k1_gej tmpj;
+
+    secp256k1_scalar_set_int(&szero, 0);
+    secp256k1_gej_set_infinity(r);
+    secp256k1_gej_set_infinity(&tmpj);
+    /* r = inp_g_sc*G */
+    if (inp_g_sc != NULL) {
+        secp256k1_ecmult_strauss_g_var(ctx, r, inp_g_sc);
+    }
+    for (point_idx = 0; point_idx < n_points; point_idx++) {
+        secp256k1_ge point;
+        secp256k1_gej pointj;
+        secp256k1_scalar scalar;
+        if (!cb(&scalar, &point, point_idx, cbdata)) {
+            return 0;
+        }
+        if (secp256k1_ge_is_infinity(&point)) {
+            continue;
+        }
+        /* r += scalar*point */
+        secp256k1_gej_set_ge(&pointj, &point);
+        secp256k1_ecmult(ctx, &tmpj, &pointj, &scalar, &szero);
+        secp256k1_gej_add_var(r, r, &tmpj, NULL);
+    }
+    return 1;
+}
+
+static size_t secp256k1_ecmult_multi_scratch_size(size_t n) {
+    if (n >= ECMULT_PIPPENGER_THRESHOLD) {
+        return secp256k1_pippenger_scratch_size(n, secp256k1_pippenger_bucket_window(n)) + PIPPENGER_SCRATCH_OBJECTS * ALIGNMENT;
+    }
+    return secp256k1_strauss_scratch_size(n) + STRAUSS_SCRATCH_OBJECTS * ALIGNMENT;
+}
+
+typedef int (*secp256k1_ecmult_multi_func)(const secp256k1_callback* error_callback, const secp256k1_ecmult_context*, secp256k1_scratch*, secp256k1_gej*, const secp256k1_scalar*, secp256k1_ecmult_multi_callback cb, void*, size_t, size_t);
+
+/** Splits n points into equally sized batches of at most max_points each.
+ *  Returns 0 if max_points is 0. */
+static int secp256k1_ecmult_multi_batch_size_helper(size_t *n_batches, size_t *n_batch_points, size_t max_points, size_t n) {
+    if (max_points == 0) {
+        return 0;
+    }
+    *n_batches = (n + max_points - 1) / max_points;
+    *n_batch_points = (n + *n_batches - 1) / *n_batches;
+    return 1;
+}
+
+static int secp256k1_ecmult_multi_var(const secp256k1_callback* error_callback, const secp256k1_ecmult_context *ctx, secp256k1_scratch *scratch, secp256k1_gej *r, const secp256k1_scalar *inp_g_sc, secp256k1_ecmult_multi_callback cb, void *cbdata, size_t n) {
+    size_t i;
+    size_t n_batches;
+    size_t n_batch_points;
+    secp256k1_ecmult_multi_func f;
+
+    secp256k1_gej_set_infinity(r);
+    if (inp_g_sc == NULL && n == 0) {
+        return 1;
+    } else if (n == 0) {
+        secp256k1_ecmult_strauss_g_var(ctx, r, inp_g_sc);
+        return 1;
+    }
+    if (scratch == NULL) {
+        return secp256k1_ecmult_multi_simple_var(ctx, r, inp_g_sc, cb, cbdata, n);
+    }
+
+    /* Use Pippenger if the batches that fit in the scratch space are large
+     * enough for it to win, else Strauss. A scratch space too small for
+     * either still gives the right answer, one point at a time. */
+    f = NULL;
+    if (n >= ECMULT_PIPPENGER_THRESHOLD &&
+        secp256k1_ecmult_multi_batch_size_helper(&n_batches, &n_batch_points, secp256k1_pippenger_max_points(error_callback, scratch), n) &&
+        n_batch_points >= ECMULT_PIPPENGER_THRESHOLD) {
+        f = secp256k1_ecmult_pippenger_batch;
+    } else if (secp256k1_ecmult_multi_batch_size_helper(&n_batches, &n_batch_points, secp256k1_strauss_max_points(error_callback, scratch), n)) {
+        f = secp256k1_ecmult_strauss_batch;
+    }
+    if (f == NULL) {
+        return secp256k1_ecmult_multi_simple_var(ctx, r, inp_g_sc, cb, cbdata, n);
+    }
+
+    for (i = 0; i < n_batches; i++) {
+        size_t nbp = n < n_batch_points ? n : n_batch_points;
+        size_t offset = n_batch_points * i;
+        secp256k1_gej tmp;
+        if (!f(error_callback, ctx, scratch, &tmp, i == 0 ? inp_g_sc : NULL, cb, cbdata, nbp, offset)) {
+            return 0;
+        }
+        secp256k1_gej_add_var(r, r, &tmp, NULL);
+        n -= nbp;
+    }
+    return 1;
+}
+
 #endif /* SECP256K1_ECMULT_IMPL_H */
@@ -0,0 +1,3220 @@
+/* This file was automatically generated by gen_secp256k1_context.c. */
+#ifndef SECP256K1_ECMULT_STATIC_CONTEXT_H
+#define SECP256K1_ECMULT_STATIC_CONTEXT_H
+#include "group.h"
+#define SC SECP256K1_GE_STORAGE_CONST
+/* Tooth size (ECMULT_GEN_PREC_BITS) the comb below was generated for. */
+#define ECMULT_STATIC_GEN_PREC_BITS 4
+static const secp256k1_ge_storage secp256k1_ecmult_static_context[64][16] = {
+{
+    SC(983487347u, 1861041900u, 2599115456u, 565528146u, 1451326239u, 148794576u, 4224640328u, 3120843701u, 2076989736u, 3184115747u, 3754320824u, 2656004457u, 2876577688u, 2388659905u, 3527541004u, 1170708298u),
+    SC(3830281845u, 3284871255u, 1309883393u, 2806991612u, 1558611192u, 1249416977u, 1614773327u, 1353445208u, 633124399u, 4264439010u, 426432620u, 167800352u, 2355417627u, 2991792291u, 3042397084u, 505150283u),
+    SC(1792710820u, 2165839471u, 3876070801u, 3603801374u, 2437636273u, 1231643248u, 860890267u, 4002236272u, 3258245037u, 4085545079u, 2695347418u, 288209541u, 484302592u, 139267079u, 14621978u, 2750167787u),
+    SC(11094760u, 1663454715u, 3104893589u, 1290390142u, 1334245677u, 2671416785u, 3982578986u, 2050971459u, 2136209393u, 1792200847u, 367473428u, 114820199u, 1096121039u, 425028623u, 3983611854u, 923011107u),
+    SC(3063072592u, 3527226996u, 3276923831u, 3785926779u, 346414977u, 2234429237u, 547163845u, 1847763663u, 2978762519u, 623753375u, 2207114031u, 3006533282u, 3147176505u, 1421052999u, 4188545436u, 1210097867u),
+    SC(1763690305u, 2162645845u, 1202943473u, 469109438u, 1159538654u, 390308918u, 1603161004u, 2906790921u, 2394291613u, 4089459264u, 1827402608u, 2166723935u, 3207526147u, 1197293526u, 436375990u, 1773481373u),
+    SC(1882939156u, 2815960179u, 295089455u, 2929502411u, 2990911492u, 2056857815u, 3502518067u, 957616604u, 1591168682u, 1240626880u, 1298264859u, 1839469436u, 3185927997u, 2386526557u, 4025121105u, 260593756u),
+    SC(699984967u, 3527536033u, 3843799838u, 958940236u, 927446270u, 2095887205u, 733758855u, 793790581u, 2288595512u, 2237855935u, 4158071588u, 103726164u, 1804839263u, 2006149890u, 3944535719u, 3558448075u),
+    SC(1145702317u, 3893958345u, 851308226u, 566580932u, 1803510929u, 244954233u, 754894895u, 1321302288u, 772295727u, 4004336128u, 2009158070u, 4026087258u, 1899732245u, 1392930957u, 3019192545u, 149625039u),
+    SC(3772604811u, 577564124u, 4116730494u, 548732504u, 241159976u, 965811878u, 3286803623u, 3781136673u, 2690883927u, 863484863u, 463101630u, 2948469162u, 1712070245u, 3742601912u, 2535479384u, 1015456764u),
+    SC(2610513434u, 780361970u, 4072278968u, 3165566617u, 362677842u, 1775830058u, 4195110448u, 2813784845u, 1072168452u, 1018450691u, 1028609376u, 2101464438u, 2419500187u, 2190549840u, 1837865365u, 625038589u),
+    SC(1347265449u, 3654928411u, 3255194520u, 1322421425u, 3049188507u, 1827004342u, 3467202132u, 4261348427u, 3419671838u, 2239837129u, 3441474020u, 268041876u, 4157379961u, 971431753u, 2053887746u, 2038404815u),
+    SC(3723233964u, 515696298u, 2908946645u, 1626400003u, 2191461318u, 1201029625u, 186243574u, 1212380923u, 858781105u, 4236445790u, 1936144063u, 1009147468u, 2407567966u, 1865959325u, 1701035060u, 241151649u),
+    SC(3696430315u, 3089900654u, 1103438577u, 3528924465u, 1259662835u, 2438429227u, 1692672370u, 2989843137u, 1446894995u, 2239587625u, 2340544036u, 434491102u, 128239031u, 2734594294u, 2667284742u, 1865591178u),
+    SC(1980028431u, 1099813170u, 2013628738u, 4214038867u, 3231891435u, 3896266769u, 2756820145u, 1490749299u, 951981230u, 3655451652u, 1676645053u, 3593230746u, 3010864552u, 405419875u, 1336073872u, 1398624425u),
+    SC(3414779716u, 2008156201u, 4125277506u, 2287126283u, 2446053551u, 212726297u, 2794923956u, 3421277562u, 1460719994u, 552209919u, 2551004934u, 953727248u, 3096710400u, 3712627263u, 3614955842u, 557715603u)
+},
+{
+    SC(461660907u, 483260338u, 3090624303u, 3468817529u, 2869411999u, 3408320195u, 157674611u, 1298485121u, 103769941u, 3030878493u, 1440637991u, 4223892787u, 3840844824u, 2730509202u, 2748389383u, 214732837u),
+    SC(4143598594u, 459898515u, 2922648667u, 1209678535u, 1176716252u, 1612841999u, 2202917330u, 13015901u, 1575346251u, 891263272u, 3091905261u, 3543244385u, 3935435865u, 2372913859u, 1075649255u, 201888830u),
+    SC(3481295448u, 3640243220u, 2859715852u, 3846556079u, 1065182531u, 2330293896u, 2178091110u, 3893510868u, 4099261975u, 2577582684u, 4207143791u, 589834100u, 2090766670u, 4242818989u, 2413240316u, 1338191979u),
+    SC(1222367653u, 2295459885u, 1856816550u, 918616911u, 3733449540u, 288527426u, 308654335u, 175301747u, 2585816357u, 1572985110u, 3820086017u, 3400646033u, 3928615806u, 2543586180u, 1619974000u, 1257448912u),
+    SC(3467862907u, 681146163u, 2909728989u, 83906098u, 2626131995u, 3872919971u, 2290108548u, 1697087700u, 1793941143u, 3236443826u, 1940064764u, 1563989881u, 527371209u, 610869743u, 1604941439u, 3670721525u),
+    SC(2302729378u, 1391194029u, 1641771531u, 3876177737u, 1929557473u, 2752989331u, 2519109900u, 1131448856u, 3786463166u, 506905989u, 2345013855u, 2144715811u, 1583628159u, 291930150u, 3243470493u, 4130365181u),
+    SC(2855519179u, 3147287790u, 1536116015u, 1784764672u, 959281397u, 3099717666u, 86403980u, 3409201632u, 3921301684u, 2101228153u, 575924517u, 1382150904u, 641478876u, 3860064926u, 1937521554u, 2358132463u),
+    SC(972265053u, 3025511526u, 2467192450u, 4011934802u, 4015820825u, 3179306985u, 1744647725u, 423238442u, 2406064939u, 901607195u, 3316491016u, 4128592049u, 1397491632u, 439641584u, 90500461u, 2834580417u),
+    SC(1730532518u, 2821193463u, 2700804628u, 2416923244u, 3795632308u, 2799866320u, 3434703577u, 3883111373u, 1777933228u, 2963254493u, 3042948878u, 1746288680u, 2832145340u, 544625602u, 3633879343u, 2300858165u),
+    SC(62331695u, 2228442612u, 3527845246u, 2989876118u, 3995298903u, 3601545798u, 4170931516u, 445717530u, 1981201926u, 94264130u, 2668647577u, 953251412u, 3322279962u, 3837653687u, 3116466555u, 3369796531u),
+    SC(2739333573u, 3637259489u, 443756582u, 825678124u, 2455706402u, 2994548791u, 3653546249u, 2584145078u, 1245698352u, 89066746u, 1738138166u, 2916153640u, 1850062717u, 3472193431u, 2110631011u, 1214009088u),
+    SC(2386327178u, 3993497770u, 1051345891u, 4137183237u, 3078790224u, 3598213568u, 3344610192u, 1517270932u, 869515922u, 2057215060u, 2792454282u, 4228826509u, 3425305972u, 2708629086u, 880185559u, 1356729037u),
+    SC(2989561710u, 3550122639u, 1990591383u, 2036612756u, 3588709655u, 595888062u, 4189293408u, 1955008963u, 987876526u, 542093629u, 1953520395u, 2315684331u, 2929815182u, 3270759899u, 393611756u, 1677885197u),
+    SC(2331762734u, 371120497u, 1141333410u, 3466824114u, 4113916626u, 3698793791u, 2483365276u, 4265751258u, 3804325409u, 4085909553u, 3531838853u, 2629626707u, 625187055u, 3045263564u, 198131065u, 3993694760u),
+    SC(27419592u, 3267954699u, 2966738458u, 3143461717u, 3869766944u, 2163162934u, 1886283869u, 2052225367u, 958768216u, 2006727717u, 2069130137u, 1939449196u, 3015752138u, 258766841u, 3290132621u, 4163970366u),
+    SC(903383785u, 2983456345u, 4269392462u, 3731664159u, 1837248343u, 1888413004u, 652691803u, 897487558u, 3732206419u, 3625013640u, 1917594162u, 967935585u, 1804564817u, 883883125u, 2389854768u, 2347234078u)
+},
+{
+    SC(1793692126u, 406948681u, 23075151u, 2805328754u, 3264854407u, 427926777u, 2859563730u, 198037267u, 2129133850u, 1089701106u, 3842694445u, 2533380467u, 663211132u, 2312829798u, 807127373u, 38506815u),
+    SC(571890638u, 3882751380u, 1536180709u, 3437159763u, 3953528399u, 516828575u, 3769463872u, 1449076325u, 4270798907u, 3135758980u, 3520630973u, 1452980147u, 3957715387u, 3054428574u, 2391664223u, 2297670550u),
+    SC(2724204046u, 2456139736u, 265045669u, 1367810338u, 1722635060u, 1306450931u, 2894913322u, 3094293390u, 3490680992u, 2550020195u, 3028635086u, 4200216295u, 1066664286u, 4170330175u, 777827015u, 183484181u),
+    SC(947228665u, 1559209921u, 3080864826u, 3123295835u, 2934045313u, 1590990229u, 2766960143u, 3113606941u, 1136432319u, 3758046297u, 2054046144u, 1377389889u, 3244301201u, 127071274u, 1752358610u, 2783507663u),
+    SC(1460807831u, 3649051054u, 2799484569u, 1231562901u, 3377754600u, 3577118892u, 1234337315u, 380370215u, 3272388869u, 3656237932u, 2653126291u, 786263023u, 1028996455u, 4274234235u, 4225822550u, 10734444u),
+    SC(2071087047u, 1934036755u, 611830132u, 2015415885u, 1373497691u, 3709112893u, 3810392851u, 1519037663u, 779113716u, 2738053543u, 2754096050u, 2121500804u, 982626833u, 1064427872u, 1627071029u, 1799421889u),
+    SC(490669665u, 331510235u, 927653097u, 4010558541u, 1341899186u, 2739641489u, 1436050289u, 1379364712u, 441190387u, 3816107121u, 4151493979u, 3530159022u, 2848669857u, 2894763699u, 1938279708u, 3206735972u),
+    SC(1164630680u, 735028522u, 1426163473u, 1764145219u, 2188722839u, 2599797011u, 2331123230u, 996298865u, 2803113036u, 1732133918u, 4135374745u, 1403496102u, 61305906u, 1982207767u, 35608603u, 680731708u),
+    SC(3097030574u, 2239944926u, 3004506636u, 3698971324u, 438440050u, 806226289u, 3299217652u, 2137747676u, 2376642592u, 2372355096u, 1444993877u, 4198291752u, 3194432604u, 579432496u, 3143260503u, 58153128u),
+    SC(3073570790u, 2457870973u, 3254087300u, 132589961u, 3090464363u, 4031655485u, 3397735349u, 3738272915u, 2438408586u, 1610016484u, 3607490511u, 1979839295u, 1993157220u, 1628966973u, 2566520843u, 2415504793u),
+    SC(2516700697u, 2521039798u, 2777488721u, 3196543385u, 3593950703u, 2445108602u, 4227515375u, 3361503440u, 3741757104u, 1367007706u, 4282009789u, 2127358709u, 2970274265u, 108953332u, 1376097231u, 3612352600u),
+    SC(2841122028u, 289695603u, 908429972u, 1449591303u, 3496532142u, 430811028u, 1377898285u, 198605765u, 702014643u, 1582973696u, 1654127041u, 4145703462u, 294032334u, 4235431914u, 3438393459u, 865474483u),
+    SC(3545445168u, 3333415739u, 2928811023u, 1435493501u, 3112072977u, 3466119300u, 61597844u, 839813414u, 3787328278u, 1928915478u, 3046796186u, 549615137u, 3862451403u, 1325262296u, 3520760105u, 1333228419u),
+    SC(1325790793u, 3907821545u, 4134901119u, 1951705246u, 3223387882u, 561480379u, 1136389443u, 2963679361u, 3722857515u, 626885912u, 3665060294u, 2975869036u, 1378007717u, 1212143055u, 3672021732u, 2520983812u),
+    SC(436660944u, 1593040065u, 2835874356u, 3054866405u, 1746716106u, 2901130226u, 3275156703u, 889550475u, 1667636846u, 2171317649u, 477876339u, 169193861u, 3301423024u, 2923695575u, 1084572294u, 981889567u),
+    SC(3803276281u, 4055280968u, 3904809427u, 186227966u, 932166956u, 2399165660u, 3851784532u, 3001852135u, 813014380u, 4116676373u, 2706810629u, 527442580u, 120296772u, 3128162880u, 662936789u, 1729392771u)
+},
+{
+    SC(1686440452u, 1988561476u, 754604000u, 1313277943u, 3972816537u, 316394247u, 994407191u, 1904170630u, 2086644946u, 2443632379u, 2709748921u, 1003213045u, 3157743406u, 1758245536u, 3227689301u, 1181052876u),
+    SC(1258105424u, 4154135555u, 2219123623u, 3901620566u, 4152326230u, 2255006844u, 2043811343u, 3401743053u, 1077175625u, 4217078864u, 23446180u, 3296093630u, 2983403379u, 483875022u, 1821322007u, 933769937u),
+    SC(4094896192u, 2631249021u, 2047644402u, 1580854103u, 3103587285u, 3577080832u, 2726417365u, 309664155u, 1801899606u, 2578001137u, 150353312u, 1950478529u, 895600852u, 3405805048u, 2316670682u, 3067768105u),
+    SC(443311827u, 441757202u, 1505167796u, 3339695156u, 4080303377u, 2032258566u, 4249816510u, 3524388084u, 3057881006u, 1951550910u, 755229308u, 2331249069u, 1739558582u, 2222328965u, 511821487u, 2764767310u),
+    SC(989753134u, 2338266356u, 549068233u, 4113024610u, 2746193091u, 2634969710u, 3079940655u, 3384912157u, 143838693u, 4047635856u, 4286586687u, 149695182u, 1777393012u, 52209639u, 2932952119u, 3267437714u),
+    SC(682610480u, 2717190045u, 3874701500u, 2657184992u, 2055845501u, 1316949440u, 1867841182u, 3514766617u, 3083609836u, 2586162565u, 866399081u, 1085717952u, 3259379257u, 575055971u, 3866877694u, 451222497u),
+    SC(328731030u, 2942825188u, 1841689481u, 3492191519u, 967390237u, 99172838u, 3036642267u, 3931425637u, 933459735u, 3523655044u, 2662830483u, 2533317360u, 1151283556u, 1285468956u, 15891850u, 3194406721u),
+    SC(3082245252u, 2305218459u, 2853219703u, 1279555698u, 3695999195u, 2225441691u, 2702374346u, 2002979755u, 3394310641u, 1438568303u, 441738339u, 2319547123u, 745721770u, 3663132780u, 3613740038u, 3163545587u),
+    SC(3109530474u, 209548946u, 1705898345u, 1227555051u, 1300903197u, 521706788u, 1046889791u, 392785355u, 1195852439u, 1128202903u, 589172095u, 3844020294u, 989062243u, 3765536158u, 3601935109u, 563198009u),
+    SC(1408383323u, 2941773350u, 4185382573u, 3662857379u, 4172908289u, 4118722458u, 1935569844u, 1296819381u, 439467796u, 917888253u, 1573015538u, 2875181025u, 22626495u, 313409715u, 121133518u, 1579603291u),
+    SC(838355261u, 2323744266u, 929233883u, 1533162328u, 2939669145u, 1021427197u, 2448693967u, 1568998094u, 455286333u, 2516902543u, 1708158744u, 278073872u, 978123683u, 2512836694u, 3972232382u, 1433020779u),
+    SC(2010810703u, 4018381427u, 571706262u, 1692351234u, 4256546562u, 1231266051u, 268479287u, 2820752911u, 2261632188u, 845795375u, 3555293251u, 4247559674u, 3383569817u, 4149228066u, 180667610u, 1402241180u),
+    SC(3525485702u, 3451430050u, 2349871300u, 60510511u, 4165534527u, 3431222792u, 4244473672u, 526926602u, 763199050u, 672899723u, 1978849638u, 489006191u, 1575850086u, 1948428588u, 201110001u, 2038136322u),
+    SC(3829603224u, 567257667u, 2324557421u, 3080821304u, 1922441927u, 1741539649u, 2023385976u, 3349327437u, 1997432110u, 3734074051u, 1330703636u, 3180299184u, 1913578229u, 141656008u, 2692604045u, 1602929664u),
+    SC(29051889u, 27392875u, 2013870801u, 1608859787u, 4192290684u, 944038467u, 2706126772u, 4086572363u, 3654238115u, 631287070u, 4277765317u, 2361271762u, 4170133585u, 2022489410u, 2834765713u, 1378478404u),
+    SC(2835113470u, 3839837803u, 3596950757u, 2129670392u, 1881028173u, 4057879348u, 2459142230u, 3736551989u, 3032996358u, 1333513239u, 3006303259u, 3885122327u, 4228039994u, 134788219u, 3631677646u, 450886807u)
+},
+{
+    SC(2450731413u, 2768047193u, 2114778718u, 2363611449u, 3811833768u, 1142236074u, 836975073u, 719658637u, 89564040u, 2055034782u, 2279505737u, 2354364196u, 748992674u, 2341838369u, 3471590741u, 3103440079u),
+    SC(464369172u, 1784969737u, 2303680721u, 1699015058u, 1839678160u, 53342253u, 3929309179u, 3713202491u, 1764215120u, 2190365769u, 3137266333u, 3919018972u, 3446276485u, 1027535494u, 3649392538u, 1979045036u),
+    SC(3689697965u, 1535268856u, 4095087266u, 1879342666u, 1901613989u, 4062220771u, 1231692686u, 3479254943u, 517178359u, 3704348661u, 3200159500u, 592930780u, 3995209641u, 2367381241u, 1790597847u, 2276745810u),
+    SC(1563410665u, 2779883331u, 320555798u, 143478861u, 1984047202u, 2486036480u, 1819096593u, 876845470u, 4160262809u, 1685665332u, 1096211683u, 3396846267u, 1079209808u, 1622135728u, 2746449213u, 2258485533u),
+    SC(1981422448u, 2212169687u, 873443773u, 3576733408u, 3923794933u, 1875069523u, 3053667173u, 4292418240u, 2192702144u, 1027092432u, 278807989u, 2315740043u, 485097259u, 4099751129u, 1350843241u, 1137138810u),
+    SC(3929635582u, 2647315129u, 1255145681u, 2059161179u, 1939751218u, 2574940312u, 1013734441u, 3958841903u, 615021475u, 1092396560u, 1516857705u, 4167743313u, 744612233u, 1609870616u, 1905505775u, 2106400820u),
+    SC(1036005687u, 2272703162u, 2208830030u, 2182996589u, 441615709u, 3591433922u, 3586649797u, 164179585u, 3077875769u, 1792522157u, 2657252843u, 657567108u, 656390324u, 1816007391u, 3075467586u, 3873231707u),
+    SC(1236896749u, 2895887291u, 1978987518u, 822801819u, 516389325u, 1102535042u, 1787993035u, 3557481093u, 3231661433u, 991180576u, 3686912074u, 1297456949u, 3327185778u, 308709174u, 495078044u, 2969592590u),
+    SC(2019907021u, 744703189u, 2139199843u, 518542186u, 3124680574u, 142934434u, 551498542u, 3021773546u, 4091561632u, 1051317147u, 825719313u, 3707224763u, 335483791u, 4028731434u, 1335000639u, 4102709448u),
+    SC(1093818871u, 985937516u, 327542691u, 2046117782u, 1264752065u, 697293694u, 1615263505u, 1156460629u, 2812684388u, 1192736815u, 3019618111u, 4209127823u, 2556369187u, 2112950523u, 637809851u, 2176824541u),
+    SC(1687299893u, 3728297084u, 490922479u, 3634470646u, 250826345u, 3692215527u, 3273717576u, 965983458u, 2226919381u, 1460789800u, 2122435754u, 2519058236u, 1620196106u, 4066817802u, 1130044433u, 3889340415u),
+    SC(852530522u, 3312783835u, 1596416107u, 1741549460u, 2684468674u, 3424816114u, 2501858342u, 1775689041u, 2140910620u, 3593295971u, 3269455071u, 2386348485u, 3506744308u, 1454965514u, 1429132807u, 1936823584u),
+    SC(606602909u, 3019871883u, 3512048756u, 3287518999u, 3877975051u, 3914786486u, 3870177904u, 1340649290u, 520571284u, 3028797996u, 2616337132u, 1103844529u, 3133726039u, 1357152000u, 1508799653u, 31330228u),
+    SC(2817743510u, 2877820134u, 3034826170u, 1694674814u, 3472934533u, 2992700940u, 940570741u, 734740020u, 2101869811u, 3976806699u, 3986671415u, 556491401u, 2336314226u, 3375597171u, 2706276162u, 2068498899u),
+    SC(2875346415u, 3996130283u, 2530370154u, 2292821435u, 1717542531u, 4166402291u, 2045046397u, 210928306u, 1305773764u, 891667924u, 1720475570u, 2097400197u, 3748242244u, 1645769622u, 3986372109u, 4259524466u),
+    SC(258680563u, 3407077353u, 3701760456u, 1531445568u, 3746171918u, 2983392727u, 1490964851u, 3947644742u, 2779475335u, 3867487462u, 2573576052u, 3434694262u, 2755711440u, 3366989652u, 566303708u, 3091229946u)
+},
+{
+    SC(2925506593u, 3911544000u, 1647760999u, 3077282783u, 810174083u, 3532746750u, 1218244633u, 1800164995u, 3882366571u, 1552758454u, 417617232u, 3581187042u, 1107218813u, 308444727u, 2996521844u, 3546298006u),
+    SC(2766498247u, 1567718891u, 906631353u, 1539374134u, 2937267715u, 3075423755u, 466239025u, 348294756u, 2802746156u, 3822638356u, 2215866298u, 2676073175u, 2327206803u, 3701444736u, 533673746u, 1949565232u),
+    SC(779912645u, 2120746348u, 3775586707u, 1719694388u, 3225985094u, 1124933767u, 2466028289u, 3688916232u, 2352972448u, 3100332066u, 3699049642u, 105143046u, 3528587757u, 3202351686u, 3275195870u, 2542878955u),
+    SC(4208701680u, 3032319563u, 1934783333u, 1683344422u, 1898255641u, 1818484420u, 1090856325u, 4203146066u, 3166734039u, 1425051511u, 411614967u, 1272168350u, 905464202u, 2860309946u, 2899721999u, 4016531256u),
+    SC(1252276677u, 705548877u, 3321309972u, 2587486609u, 1841091772u, 1176108340u, 2483104333u, 1124739854u, 1417860124u, 2145011089u, 1095816787u, 561231448u, 3047186502u, 2188442748u, 782343512u, 2073487869u),
+    SC(773625401u, 1399854511u, 2112273744u, 3798562401u, 2328245221u, 4053035765u, 884849756u, 2543299151u, 3064173848u, 3322400978u, 2493736578u, 4109781307u, 3356431908u, 2033183790u, 3916558464u, 937192909u),
+    SC(1676839026u, 1837563838u, 681907940u, 1979087218u, 3861274680u, 1004821519u, 3526269549u, 3587326189u, 4130121750u, 5876755u, 277168273u, 3347389376u, 1295078502u, 3055055655u, 988901279u, 1750695367u),
+    SC(1466696987u, 793586382u, 3395028606u, 688541023u, 227515247u, 433349930u, 1151320534u, 2638968365u, 2730052118u, 2419949779u, 4184196159u, 3075595332u, 1762597117u, 3208522231u, 3793454426u, 2205574333u),
+    SC(2271935805u, 2221340650u, 4006866556u, 3892925071u, 3300102857u, 4023132062u, 1966820825u, 193229358u, 3829742367u, 3288127030u, 2999566231u, 1746318860u, 611198282u, 1740582489u, 586692015u, 272371975u),
+    SC(1512874083u, 1683202061u, 3100471136u, 875884760u, 2252521753u, 3056609126u, 2397470151u, 3238829627u, 398340158u, 1086173909u, 2650682699u, 3851040891u, 267796754u, 1063916466u, 134772391u, 616879617u),
+    SC(1190901836u, 3498895828u, 121518848u, 4122627266u, 4044339275u, 3929319666u, 3725675569u, 2249645810u, 1648430039u, 805152867u, 604009597u, 428134903u, 3660078748u, 1495738811u, 2912743026u, 3529964664u),
+    SC(1098872981u, 3803982233u, 1184687675u, 1724685244u, 1166128174u, 3324080552u, 2889006549u, 591614595u, 442372335u, 2188313994u, 392144341u, 559497602u, 2786744839u, 1080958720u, 963196350u, 4153188088u),
+    SC(2439538370u, 4080798018u, 3371249236u, 2272355420u, 3780648680u, 116755088u, 1743646150u, 3071185844u, 3348389643u, 3506488228u, 3592742183u, 3935997343u, 3470563636u, 4177761627u, 2879753187u, 203653531u),
+    SC(3278048310u, 2898758456u, 2355004932u, 2165371155u, 909690763u, 4208028121u, 3529336571u, 120122699u, 1468577489u, 2088039937u, 3804192119u, 4005659309u, 496708233u, 114985314u, 4186471387u, 1516837088u),
+    SC(1694326758u, 3482448156u, 2533790413u, 3535432659u, 1293417127u, 2007819995u, 3512854075u, 2476797465u, 936262398u, 4149678787u, 807292055u, 1683402105u, 3767740082u, 682769936u, 2956180563u, 2800734304u),
+    SC(804843744u, 1565609957u, 1986774659u, 4163563545u, 1192892219u, 2967653559u, 1407927717u, 134508609u, 2584983666u, 3798685912u, 1759632157u, 1938927553u, 3974685712u, 2763800386u, 3702401831u, 3969543832u)
+},
+{
+    SC(2016238746u, 3648008750u, 3741265531u, 1468285316u, 3314132186u, 3225615603u, 2260838904u, 650230459u, 666608997u, 1079817106u, 1685466519u, 3417306450u, 465799968u, 1454367507u, 1432699603u, 4060146438u),
+    SC(1761873323u, 2175765323u, 123320402u, 1086415744u, 3425420197u, 3163463272u, 2096010147u, 892174421u, 3834451486u, 191088153u, 650609666u, 1384830375u, 430440180u, 1275312435u, 936713210u, 3964237847u),
+    SC(3490530311u, 4154571850u, 1473147571u, 1874492814u, 3394183939u, 690761407u, 1765847887u, 4254640890u, 3957252213u, 852293459u, 403059579u, 1419995731u, 373422976u, 1691953324u, 1513498303u, 3782064719u),
+    SC(2587537765u, 1727580331u, 2067598687u, 2050934719u, 1018600463u, 825517190u, 281367288u, 396667874u, 2125440864u, 2142555808u, 3739024155u, 471264185u, 2298783646u, 926505635u, 485317745u, 4237064052u),
+    SC(4177694527u, 1331122857u, 2632274962u, 2272030823u, 2711200568u, 493910969u, 64158788u, 2976239616u, 2805230971u, 1856476899u, 706343172u, 883417303u, 3085501222u, 2167885061u, 2608970459u, 1305891290u),
+    SC(3887930902u, 1612140391u, 329833229u, 737708613u, 660227298u, 2588285981u, 3429746116u, 4247477263u, 2536670475u, 1091054728u, 1521783433u, 4262529359u, 3261855757u, 453613765u, 484850910u, 3619344637u),
+    SC(3635973664u, 4002263582u, 683484955u, 1188525929u, 3024525647u, 1588813480u, 3496033065u, 109022234u, 2342061519u, 1416918501u, 2207158673u, 948640868u, 637445219u, 508491813u, 3897434662u, 680054967u),
+    SC(1039851594u, 403130855u, 3868498597u, 1611578944u, 2942424644u, 2874427101u, 1261647069u, 261871566u, 2520758170u, 2840740989u, 3799279215u, 381717039u, 3582347301u, 2025353438u, 2948438214u, 2918501540u),
+    SC(81851588u, 3029358979u, 3777821133u, 2109529880u, 3684139703u, 3572137489u, 2624799u, 2076188243u, 53500651u, 2606703535u, 3206313372u, 346558880u, 465806762u, 434266486u, 1902707603u, 4080110534u),
+    SC(3612241613u, 1917140707u, 4136616607u, 4041104182u, 2193790431u, 801466537u, 3599423303u, 3561003895u, 1189069231u, 8494816u, 4244955339u, 451969883u, 3908494655u, 517115239u, 1812731691u, 777430858u),
+    SC(3522137911u, 2027939004u, 2210696271u, 3920541975u, 875695915u, 2825269477u, 687289812u, 4252564584u, 1824925315u, 507608234u, 2614820601u, 2462525050u, 3886866857u, 668083682u, 2768243607u, 3293579201u),
+    SC(1682273922u, 1330912967u, 3636074852u, 840196898u, 1025234484u, 1557176067u, 2837118766u, 3109038869u, 594323342u, 3200796742u, 1959017554u, 1440926582u, 3021668826u, 3738492638u, 446292405u, 2414347832u),
+    SC(4116164451u, 4091036540u, 474505628u, 1269644927u, 3643568118u, 1673027873u, 1438360759u, 4022285580u, 4024623082u, 1654730750u, 1581385912u, 3853471495u, 335076979u, 2185560806u, 2494598452u, 3520671279u),
+    SC(4099595861u, 2215053464u, 488918654u, 2772869965u, 2247823716u, 1588093320u, 1138185172u, 732569291u, 247618738u, 1702163570u, 1772683376u, 1056938600u, 1997535786u, 2064838561u, 3705150691u, 1453615480u),
+    SC(3809909081u, 1962152573u, 3909100601u, 1479514000u, 1615313752u, 3569344372u, 997113509u, 3043376485u, 3480943705u, 4021042580u, 2284195092u, 2749518560u, 3037939132u, 3554704413u, 185068622u, 683070990u),
+    SC(3163624176u, 326387389u, 438403431u, 1924575191u, 1706136937u, 2432230714u, 4175139676u, 713582699u, 175432919u, 505729353u, 375905517u, 3179239595u, 2233296987u, 472507277u, 1822318909u, 3059447908u)
+},
+{
+    SC(3955300819u, 2390314746u, 8780989u, 1526705205u, 4147934248u, 1494146575u, 1667625450u, 2277923659u, 406493586u, 957460913u, 3449491434u, 912766689u, 1387230361u, 2368913075u, 3538729245u, 2943257094u),
+    SC(2095358020u, 3831852940u, 1752942227u, 477088929u, 2503091779u, 898077u, 2215106688u, 1298885808u, 352224250u, 3952364758u, 3669616566u, 664714721u, 1826685582u, 1576488055u, 2121138397u, 1442223205u),
+    SC(1378268686u, 187975558u, 3210161726u, 870689300u, 1860632239u, 902013623u, 571573600u, 25414363u, 3412397724u, 3841538145u, 215707661u, 324367139u, 2323478150u, 3794355190u, 1128115053u, 2519022352u),
+    SC(566244395u, 2591175241u, 2926679038u, 2852174582u, 200192886u, 521908517u, 2098042185u, 3563798587u, 1529741033u, 1248315044u, 233787221u, 2706044694u, 2870731528u, 3970719810u, 4167465378u, 525407392u),
+    SC(2196340159u, 4056996284u, 1702457669u, 2086317410u, 3933566271u, 3751624213u, 4023204768u, 677196918u, 2137509058u, 4037704026u, 2299370032u, 1748548051u, 3326874481u, 1974512389u, 1751264060u, 266112293u),
+    SC(1812114662u, 524787647u, 285577300u, 3638318945u, 3389691808u, 585441476u, 145370930u, 1149989778u, 1314386440u, 3471672106u, 908522311u, 4171434326u, 329350743u, 2954206373u, 856961382u, 2008618089u),
+    SC(2318825510u, 3826102862u, 687747522u, 4263777564u, 2387018418u, 1135189382u, 1414060091u, 217356911u, 2998889592u, 698204196u, 801530770u, 3479982231u, 1117806357u, 154519605u, 960816747u, 3149429798u),
+    SC(3250819610u, 351683992u, 296382659u, 4149667465u, 2183346760u, 1485561783u, 2218034265u, 420633334u, 1869679065u, 1205517989u, 3666184780u, 1975151679u, 371905540u, 367504198u, 1917294142u, 2403996454u),
+    SC(3958230362u, 3773825115u, 783748416u, 1243337893u, 4032003144u, 3908441244u, 201600922u, 2000451013u, 728826842u, 3533421010u, 3229478766u, 278198864u, 3933272000u, 1331731276u, 3202405750u, 1474627286u),
+    SC(3181836998u, 2581633616u, 3993055681u, 4020956268u, 2094932060u, 3551878275u, 393027783u, 2154269634u, 2283536956u, 2260289773u, 832949759u, 2403309662u, 3488387345u, 1652392255u, 393935478u, 2309058441u),
+    SC(4141036972u, 1727820200u, 832481848u, 1055621047u, 1091666560u, 1393833209u, 3406509646u, 2428157250u, 2974564551u, 2286298667u, 3776410458u, 815994971u, 1241023789u, 775596275u, 1035618310u, 3934253771u),
+    SC(206932164u, 4239023187u, 2046365950u, 2616857124u, 4246776524u, 4059028269u, 129664965u, 907402684u, 3859465657u, 4204192080u, 91453633u, 301171900u, 385561248u, 2689085222u, 1614465584u, 3977451005u),
+    SC(3683171878u, 3148577689u, 4042394721u, 1085044656u, 682611813u, 2857177748u, 2417075323u, 2983755657u, 3777418770u, 2448398967u, 3909780770u, 4000218621u, 4227580585u, 2425908645u, 1704039191u, 3712924954u),
+    SC(290465694u, 3921687099u, 2971845338u, 1854613741u, 1583022754u, 371222458u, 1744154613u, 3918664956u, 1960343256u, 1291903121u, 4010470137u, 1525668440u, 4091170130u, 1370665614u, 3468958243u, 1262617601u),
+    SC(469638518u, 1129475898u, 3766065538u, 1777952666u, 2589258222u, 3182239596u, 2626554219u, 1853296675u, 2912212627u, 2518041806u, 2743002885u, 3765128027u, 851537937u, 2059010589u, 1827964742u, 3630398912u),
+    SC(2458599023u, 2699477701u, 2305781427u, 2536499567u, 2118412162u, 1356010449u, 1426052710u, 725853717u, 1358092245u, 4196538471u, 66159936u, 4076320019u, 3065284443u, 2664736186u, 1943959552u, 939016920u)
+},
+{
+    SC(3159079334u, 690659487u, 1550245019u, 1719420482u, 1795694879u, 2846363486u, 15987067u, 569538014u, 1561199762u, 967336684u, 3110376818u, 1863433225u, 3468533545u, 3644881587u, 369296717u, 3652676359u),
+    SC(3207794512u, 2847938045u, 2415472979u, 1444858769u, 666387488u, 1660608279u, 1038886882u, 10876848u, 2468284561u, 2494495733u, 2622688628u, 2362399325u, 2213804831u, 3448783854u, 3958704532u, 3639349832u),
+    SC(54374990u, 186360229u, 3420619566u, 1356363720u, 2768151763u, 3862789233u, 4270651882u, 2681019589u, 2332931746u, 928338209u, 3968478928u, 3908570621u, 923281930u, 2285715383u, 3620920276u, 130031468u),
+    SC(4009596626u, 493238747u, 1786722937u, 653638870u, 1636723425u, 1884625267u, 2113708566u, 1448416211u, 3613674959u, 239497564u, 404863679u, 1521570751u, 2819432609u, 623319225u, 3073321373u, 565867032u),
+    SC(1220575379u, 4235426741u, 1889734996u, 43054857u, 879216917u, 3299856237u, 2922851906u, 1054251029u, 693641076u, 1704223409u, 961665328u, 2828086835u, 2727513652u, 1580557310u, 4169876178u, 682569510u),
+    SC(1757813477u, 22814395u, 3549822650u, 2254547303u, 372100012u, 1555116803u, 2587184145u, 3995169383u, 2645743307u, 188252331u, 3723854483u, 2138484090u, 1895504984u, 3538655836u, 1183003060u, 1439034601u),
+    SC(2578441833u, 3136721732u, 380864696u, 817462912u, 2257087586u, 2256998015u, 93155068u, 930999672u, 2793712092u, 2223512111u, 3157527446u, 1098951014u, 3490358734u, 1362531303u, 2421324125u, 1961922428u),
+    SC(1049179776u, 2969815936u, 3869567708u, 2883407597u, 1876243265u, 3498929528u, 2248008570u, 1231166427u, 3544374122u, 2839689583u, 1991744998u, 2798946627u, 736844268u, 1293771673u, 153373649u, 1931110485u),
+    SC(3785289356u, 1913060964u, 169967200u, 3348219956u, 3732729076u, 987877186u, 3063387163u, 3310757163u, 3480818987u, 1991307039u, 2882756981u, 1215305494u, 855630497u, 1471153868u, 1338946323u, 398364632u),
+    SC(1356154057u, 3013675057u, 3810909135u, 1796458190u, 2691409967u, 3963509663u, 2487357466u, 2764459334u, 2828737787u, 378542508u, 427318427u, 2412936991u, 393927878u, 3384382899u, 1135834101u, 3447900619u),
+    SC(3813669196u, 1922867812u, 483725924u, 518662823u, 3954558327u, 1908218112u, 2258643690u, 2093138355u, 1162728847u, 205977116u, 821018600u, 1237824238u, 2980682686u, 1821003630u, 3221633606u, 2717269894u),
+    SC(1353035942u, 2442753208u, 348196860u, 2355246066u, 2218279077u, 2203055542u, 1964199656u, 1329637142u, 1824193111u, 3965017045u, 795175573u, 1029253807u, 3915633667u, 1084707851u, 1682462202u, 2090124205u),
+    SC(190807548u, 1133131805u, 249542006u, 2858611426u, 304500253u, 2183315108u, 4145782890u, 2998333644u, 962888949u, 974441750u, 1484862994u, 801464190u, 2311388331u, 114769498u, 4260362972u, 1017092877u),
+    SC(1311406963u, 465174990u, 1760870095u, 883652788u, 1015674641u, 840236175u, 3124632038u, 2756294642u, 178804852u, 3164952754u, 241649187u, 1040890173u, 82588907u, 1771630815u, 1058353446u, 2473824375u),
+    SC(943051847u, 4107933890u, 535438460u, 2683519853u, 3177219980u, 3711205196u, 3390138615u, 2920849102u, 3747455519u, 4138118615u, 400899690u, 4278329560u, 2602463649u, 808685972u, 136036034u, 1078020636u),
+    SC(2185570356u, 3896907774u, 3620938057u, 1790823508u, 720763411u, 2404776615u, 3257162972u, 1221107462u, 3223154083u, 2528715719u, 688766234u, 1813423773u, 2324112952u, 83241050u, 4119437520u, 552112812u)
+},
+{
+    SC(3370489298u, 1718569235u, 523721575u, 2176389434u, 218587365u, 2490878487u, 2288222859u, 812943600u, 2821517993u, 3626217235u, 1545838667u, 3155352961u, 741681736u, 669093936u, 2382929309u, 2620482966u),
+    SC(40739723u, 469402467u, 1810137291u, 109375068u, 1888845715u, 2140810583u, 1053250454u, 3220064762u, 2539857789u, 4089587896u, 1364971662u, 2996699084u, 3939034030u, 2020251221u, 1606532641u, 3453095239u),
+    SC(1376139558u, 886121026u, 3003069127u, 3500718919u, 4223467610u, 3212808910u, 126355621u, 2065481301u, 218954382u, 1236555811u, 2283280895u, 4256918831u, 1550185311u, 896721211u, 4286247506u, 2515527710u),
+    SC(2942433244u, 2364220023u, 3675668782u, 3695614763u, 4041312428u, 2311531471u, 543507321u, 1902188023u, 1380686629u, 2455468346u, 2346421766u, 2211296276u, 3675221499u, 3890242164u, 3592353914u, 323566438u),
+    SC(971323999u, 4115912859u, 3703400072u, 2662062035u, 2355087034u, 610373016u, 2293984834u, 2456129286u, 2927901115u, 1832014620u, 1168920846u, 552716242u, 3101454502u, 1707155244u, 3450287619u, 2546358284u),
+    SC(3062358608u, 1394539264u, 4158727824u, 1704721957u, 1117692646u, 4057908715u, 1958466020u, 2309578289u, 271836599u, 2617957229u, 202314495u, 2948978715u, 1423414031u, 4128837100u, 1937488702u, 3301405882u),
+    SC(1276638700u, 885904232u, 3686149920u, 3283641475u, 619290126u, 2510808612u, 1691008630u, 573145513u, 506979295u, 3062936948u, 2703005699u, 4056634904u, 3460956977u, 3783023797u, 1215556973u, 3726733337u),
+    SC(3145485089u, 2008513183u, 2407056102u, 633050174u, 2634406893u, 2883313710u, 1233018283u, 3273507959u, 174012667u, 2126243450u, 2258342097u, 2857351925u, 3446764464u, 1187986524u, 3004835628u, 3228122242u),
+    SC(991481464u, 1720231754u, 1918287975u, 2752686681u, 1174123782u, 4227334584u, 1634945718u, 1074218184u, 3572504705u, 1199611126u, 1378243227u, 2901862427u, 2145083550u, 1055786253u, 3960418624u, 587771424u),
+    SC(3060872990u, 789280525u, 184089463u, 1784976524u, 344050594u, 2949751745u, 3173202246u, 3813443247u, 1247337895u, 4000924548u, 76989753u, 2093985529u, 265772293u, 3310477933u, 717631968u, 1024610284u),
+    SC(3399834097u, 2964304651u, 3593395714u, 2850196125u, 2344305533u, 3920139836u, 937580696u, 1116439644u, 4147778799u, 544787491u, 2461636418u, 2647550544u, 1451408824u, 3266700679u, 829974548u, 2625074193u),
+    SC(645329496u, 2808202504u, 1366740717u, 2841442794u, 1298546911u, 2730798019u, 3834987045u, 3258634143u, 4257492959u, 2976079952u, 1735944512u, 988426767u, 2395072762u, 3103996991u, 730963792u, 4206896923u),
+    SC(3457675112u, 4140282966u, 1286302693u, 575230857u, 2270112110u, 3056424235u, 1835144711u, 421529065u, 2499621064u, 1907217915u, 1365357672u, 2875249236u, 1193490885u, 644367230u, 2115448516u, 2507997379u),
+    SC(70240820u, 3745431832u, 1098747160u, 82118642u, 2446590634u, 851446619u, 2715739022u, 2142293045u, 2689000746u, 4219383621u, 3140617705u, 1457579904u, 2541485894u, 3932513084u, 3406615220u, 2746135210u),
+    SC(2576508439u, 3244150028u, 2516535555u, 3986514000u, 2903382402u, 2225326585u, 1780804949u, 1164188435u, 1682143109u, 2949153515u, 1249412173u, 349674695u, 3467452794u, 1021028584u, 1194554595u, 1296132950u),
+    SC(1028084134u, 2577983628u, 184499631u, 1037888434u, 1676727662u, 1831883333u, 1276555462u, 4161670547u, 372201005u, 844715673u, 24290758u, 1268964661u, 297554992u, 4061435345u, 719976096u, 1670144314u)
+},
+{
+    SC(1239892635u, 3772349433u, 1058531752u, 1409211242u, 2847698653u, 2391143499u, 2637108329u, 3000217976u, 4288568828u, 658925470u, 2552628125u, 1468771377u, 3230644908u, 2692030796u, 7587087u, 1951830015u),
+    SC(488413080u, 1055864530u, 1967623060u, 3973308786u, 2745059783u, 477755698u, 544732176u, 3786002606u, 1569550024u, 2935491988u, 1047898991u, 1749060996u, 1828274710u, 2943223535u, 3716062834u, 1253889972u),
+    SC(1626917485u, 492893476u, 2371366539u, 3928996000u, 3710769983u, 1237244931u, 1562679102u, 2930576193u, 2085522193u, 2968039733u, 3202113740u, 4250144171u, 3666251088u, 2016963274u, 293320478u, 3775462481u),
+    SC(3337977767u, 1831658883u, 1096680294u, 2436280860u, 119870062u, 1444445305u, 1467566544u, 2038307180u, 661842797u, 2493843529u, 3851219498u, 3941720925u, 1848373617u, 4051739727u, 1120765529u, 1101800264u),
+    SC(929493756u, 2211014659u, 3851484027u, 3468182176u, 147674626u, 3850162187u, 1517171722u, 907705770u, 3997080856u, 3666272567u, 659948161u, 2282159142u, 429200635u, 2563204390u, 1422415938u, 1688129608u),
+    SC(551422730u, 1797390513u, 2828310972u, 97463725u, 131839682u, 3917501017u, 566617767u, 700714239u, 3061891811u, 856175415u, 1072683059u, 1754819408u, 3533865753u, 2568134802u, 4226648923u, 32646755u),
+    SC(3538971706u, 2916601269u, 2891999350u, 3825811373u, 2355258376u, 2876141009u, 3940019347u, 1309282440u, 2567828520u, 1367177503u, 2910098023u, 1986452448u, 1802584940u, 1360144734u, 2877029236u, 3033303547u),
+    SC(3313753312u, 261894832u, 3637017242u, 3699232915u, 3508549542u, 3960876382u, 582644479u, 3199091169u, 3644395252u, 2675904765u, 2072396219u, 4071523208u, 3976776729u, 1025403411u, 2178466200u, 1107450603u),
+    SC(2163612584u, 2845646977u, 4033161886u, 2723908899u, 1902990762u, 3375716497u, 2588626243u, 513179480u, 3101622846u, 1458272618u, 3875706546u, 3028150894u, 3612001457u, 2583302957u, 3385091312u, 3719047138u),
+    SC(1256280924u, 3685139058u, 1853414115u, 3160743702u, 3455476559u, 2505590918u, 2308735646u, 3742507036u, 4016470170u, 330769483u, 3470077232u, 3383715347u, 1440115354u, 2667395648u, 1883060415u, 3332144245u),
+    SC(558087170u, 3027059128u, 1986900497u, 1642930671u, 5966195u, 3083778816u, 3199769457u, 1248728791u, 2110460619u, 327014118u, 2524517189u, 1776442925u, 1472982408u, 3459887088u, 1029172283u, 2232815594u),
+    SC(1544258748u, 3397993939u, 2721410152u, 2948125157u, 3562231734u, 3011402493u, 3266317933u, 527195819u, 369665170u, 3216603774u, 1952585925u, 258420856u, 3339671680u, 3733846143u, 2326118329u, 2310291176u),
+    SC(4140585488u, 4198875250u, 3415599245u, 3398679011u, 4155727512u, 331520374u, 785987151u, 146809315u, 2929041163u, 1558279570u, 1346822944u, 4167931729u, 2800498595u, 2809390575u, 3295157947u, 4121566122u),
+    SC(3571413466u, 1596401972u, 140853088u, 3137527478u, 204556611u, 4111255020u, 3835120334u, 3048525996u, 399176328u, 3005771198u, 780994070u, 3747160103u, 3136546207u, 508755537u, 2521091931u, 1715747893u),
+    SC(1156063870u, 393984449u, 1521183961u, 3649564442u, 183535572u, 3139859119u, 445469714u, 2815871833u, 1268459010u, 355340626u, 2465929503u, 750513297u, 1590602217u, 3983872541u, 97286792u, 110438349u),
+    SC(2549125874u, 1976691716u, 2532749644u, 279085303u, 633988261u, 3513450026u, 1057503157u, 1110164955u, 317735960u, 3241215082u, 3855084900u, 4137511567u, 3550729054u, 819799870u, 1929320159u, 2825290282u)
+},
+{
+    SC(2585638847u, 1394876113u, 3750575776u, 4144761638u, 1991524028u, 3165938218u, 158354186u, 812072970u, 3814951634u, 2507408645u, 1163603486u, 3566585210u, 1424854671u, 3326584505u, 3332079056u, 1901915986u),
+    SC(1520752595u, 1952396314u, 3263601295u, 3458083478u, 3797830135u, 509407552u, 3232598095u, 1205382790u, 2667815610u, 2560349365u, 2472625295u, 2883979179u, 554514567u, 2376619906u, 638138357u, 2568018129u),
+    SC(2442202610u, 2091297602u, 25025777u, 3622813695u, 3869161931u, 614884494u, 984078136u, 3345125623u, 3918959025u, 227030161u, 3885929851u, 1281751413u, 1612359075u, 2958486463u, 2884267132u, 3619290927u),
+    SC(3048700207u, 2570072469u, 1076153001u, 3767270422u, 1408579070u, 2076435276u, 2224129615u, 1962182553u, 1823335118u, 1499162388u, 1563913085u, 2068011578u, 1991334162u, 1665201834u, 1756239294u, 648108494u),
+    SC(2337582449u, 1819429591u, 3833487099u, 3870804287u, 2300831739u, 2232929806u, 1869816966u, 4084965807u, 4220168543u, 1248736546u, 924637940u, 73528534u, 2319796252u, 3657850751u, 2794932350u, 4220430348u),
+    SC(3028904021u, 2992718647u, 2354594543u, 3084902105u, 3127673085u, 783373559u, 3896264500u, 3984439851u, 820119108u, 4253719169u, 2623678017u, 3039126654u, 2922756242u, 2436956481u, 442364253u, 918876081u),
+    SC(1539558451u, 2306960255u, 1095386938u, 770368485u, 2906552323u, 3075682102u, 3534951832u, 2083903147u, 1308495764u, 2261904633u, 2112467113u, 1044610889u, 3222649255u, 1736090274u, 1954974285u, 1361850096u),
+    SC(587984395u, 1588261189u, 4052666242u, 512106258u, 651085942u, 2768947530u, 1250487652u, 1245674804u, 857176247u, 3594046498u, 647658046u, 2882585491u, 259918032u, 3698728358u, 632752990u, 351374374u),
+    SC(2404749839u, 3296323382u, 805352255u, 3954906457u, 3558496371u, 2470613864u, 2024150378u, 3564550335u, 2499521206u, 2051669779u, 607498894u, 3748811695u, 1128400961u, 3072401950u, 3042994760u, 811721793u),
+    SC(3595493043u, 1889077187u, 1981480426u, 4189336058u, 2081249554u, 2321560592u, 971543366u, 358725627u, 3595364674u, 3986924883u, 2193763710u, 4189195361u, 3121216309u, 1140981210u, 3226790033u, 353586077u),
+    SC(2871195936u, 2843651834u, 635723881u, 287569049u, 2067429609u, 2943584978u, 644639896u, 1264563774u, 670309272u, 2690274713u, 246950668u, 933865226u, 4053660195u, 1381269871u, 462688690u, 5420925u),
+    SC(977313734u, 4104230969u, 3334283655u, 1580178205u, 1578158646u, 1460773045u, 1728595474u, 3957344726u, 553676110u, 966612385u, 1786516334u, 2979157051u, 921122693u, 911238485u, 3922067113u, 1046213221u),
+    SC(91424183u, 123813459u, 1667146297u, 3387121372u, 438965888u, 4260725592u, 154972710u, 3237027664u, 3006360433u, 2505005588u, 2902337724u, 2660287100u, 1901200613u, 2646189902u, 2780155597u, 49560303u),
+    SC(3586622617u, 925349590u, 415005474u, 1260234539u, 30249250u, 2179523979u, 3475887768u, 3019952034u, 3517624902u, 4230850494u, 3734868171u, 742624613u, 822822789u, 3974379285u, 3711572581u, 3366701706u),
+    SC(329275906u, 1905371123u, 4004795330u, 2339811253u, 353091905u, 548998992u, 3687895576u, 356859438u, 2494263562u, 926298666u, 3983230019u, 2882391620u, 2824170047u, 2247742371u, 1881005652u, 1386887463u),
+    SC(1046492158u, 2680429213u, 1614272999u, 4010933686u, 2479992689u, 595409283u, 765550354u, 2852655093u, 1983575334u, 3910696497u, 2308266592u, 3012641543u, 2582478313u, 14949228u, 60656360u, 1955264759u)
+},
+{
+    SC(1355623958u, 2575138117u, 2562403739u, 1638722303u, 1523970956u, 2189861089u, 3498071469u, 1919711232u, 231840827u, 3230371223u, 143629793u, 1497495034u, 1677900731u, 1608282251u, 3485501508u, 3944969019u),
+    SC(1317209868u, 3823870608u, 3335344652u, 3702793515u, 2425890570u, 1442662397u, 4007605978u, 2976935239u, 1444558882u, 3449074340u, 523287240u, 1767769527u, 1776192231u, 1111610095u, 4035220013u, 3434023407u),
+    SC(1286632782u, 1751340143u, 184421370u, 3989392405u, 1838859918u, 3681550977u, 707040060u, 2695037953u, 1828105102u, 812532736u, 1115387936u, 1381188966u, 1389542552u, 621856846u, 1135930465u, 831833090u),
+    SC(2741542793u, 3565635943u, 455105161u, 2389444906u, 2966273581u, 4048751601u, 2569017914u, 1796095397u, 1515760827u, 3870103158u, 2737365395u, 818096507u, 2179280538u, 1254083919u, 2114706477u, 1413209953u),
+    SC(2036431795u, 3313380793u, 2996275588u, 625273343u, 1627738147u, 2163909313u, 2645773664u, 3066825866u, 3862562238u, 3189614065u, 3074707667u, 1611214266u, 689055345u, 1845962762u, 3616153367u, 98214289u),
+    SC(1783057147u, 1095836105u, 952581152u, 665189523u, 4159236737u, 3621720388u, 2768968806u, 1541462219u, 1550070665u, 2946487171u, 3084327270u, 3528580128u, 3683323170u, 2326350340u, 681502936u, 611874814u),
+    SC(2075965546u, 3954443814u, 3457426695u, 3100575745u, 795895906u, 2051458923u, 4220432661u, 3191956430u, 2978441632u, 1935083482u, 1260223004u, 1989210512u, 708452144u, 1742032782u, 412060225u, 942058976u),
+    SC(1554952802u, 1148928548u, 435577880u, 1218016814u, 774531999u, 4171943086u, 2728379380u, 1755428421u, 3096769247u, 551470356u, 663936617u, 2259245103u, 3605128160u, 4254582248u, 2543346251u, 2641240630u),
+    SC(2834055303u, 3779347324u, 986655417u, 1060344853u, 1961336735u, 3444096071u, 3402507696u, 1296975131u, 4013745799u, 318316127u, 3012349080u, 1543913977u, 3581569730u, 3073345556u, 1048961320u, 3338742347u),
+    SC(1917475623u, 1573453706u, 3775608035u, 1560651154u, 3305702627u, 840251936u, 2021694407u, 1567223161u, 1217097878u, 4101089784u, 1480235880u, 823763473u, 1860062290u, 3212933927u, 305432786u, 2664137512u),
+    SC(488290329u, 2159084342u, 1977681447u, 3072933047u, 2133970307u, 2904163387u, 2929381044u, 2852811875u, 3486789427u, 3312981159u, 2897952520u, 3716688458u, 3312599340u, 2231560239u, 2736260178u, 2100166993u),
+    SC(2561748569u, 2171003952u, 3930314290u, 4171544961u, 4084487200u, 1829909478u, 4190664042u, 1205662930u, 1332053018u, 3102835265u, 2758716514u, 3094681405u, 890009818u, 1835725787u, 3657145276u, 2012429206u),
+    SC(1490727773u, 2663703693u, 1786667419u, 3911642156u, 1173781475u, 1032437218u, 949369190u, 3379245680u, 3855657643u, 102309733u, 3862169655u, 1953708469u, 2899532678u, 2185103023u, 2246792392u, 2140300644u),
+    SC(1105179994u, 3403119551u, 2151897995u, 2133026531u, 4095632628u, 1958582421u, 3756551819u, 1353448323u, 343568827u, 940163873u, 3647008605u, 2675342302u, 2020863909u, 3314608025u, 3678853306u, 2350764749u),
+    SC(3610890660u, 7527132u, 3948519712u, 999155044u, 1566318108u, 1592356541u, 1395933920u, 3725362820u, 1628394109u, 2361449910u, 3407340106u, 1370203307u, 1521539242u, 166450716u, 1562824595u, 815891091u),
+    SC(4169640806u, 3985781662u, 2412370154u, 452406588u, 105016225u, 176939651u, 3796204183u, 875428687u, 2497589429u, 82221910u, 4277856341u, 1375558239u, 286683641u, 3316069361u, 519521869u, 2295715438u)
+},
+{
+    SC(1272080061u, 1249052793u, 3406223580u, 3180222548u, 3305857569u, 3627944464u, 989639337u, 2790050407u, 2758101533u, 2203734512u, 1518825984u, 392742217u, 2425492197u, 2028188113u, 3750975833u, 2472872035u),
+    SC(23055961u, 3145183377u, 2430976923u, 2926141735u, 1297155725u, 3931229778u, 1820665319u, 2985180446u, 3042883880u, 2460902302u, 3663963302u, 4048537328u, 3995357361u, 2497655514u, 2584741032u, 1771542440u),
+    SC(3555045486u, 1984442910u, 1340694232u, 3778110580u, 1134128670u, 754930307u, 645413801u, 419876731u, 718672506u, 2655370853u, 650960778u, 1175245889u, 3468383881u, 2671574337u, 44753822u, 3359158981u),
+    SC(289419990u, 2387037467u, 2851881154u, 4063189789u, 1829943773u, 2629576813u, 942097665u, 562844855u, 2647906183u, 117874787u, 202211775u, 3519990636u, 3082138694u, 1836881245u, 583992800u, 2183831281u),
+    SC(2721107251u, 1807232970u, 3202569269u, 3708638735u, 3532027994u, 4114767065u, 2764680156u, 135914892u, 1473879964u, 2935607101u, 4201045944u, 3202280567u, 3793176244u, 41830505u, 969791663u, 1519485648u),
+    SC(1497249350u, 1416277963u, 4236912956u, 1827689230u, 1595876921u, 792380080u, 2973128767u, 43523726u, 365213078u, 1703541227u, 1608568996u, 2447861933u, 4236202627u, 2270952660u, 996772411u, 1327926083u),
+    SC(930257564u, 986864131u, 3788206015u, 4282936823u, 3575152799u, 1711906087u, 3523467955u, 1026809541u, 3754676659u, 126901401u, 34761162u, 674497989u, 546239979u, 3916171265u, 4169565745u, 1773808675u),
+    SC(1188611875u, 4038625723u, 846346399u, 3124471166u, 3540873247u, 133640400u, 3354116939u, 2182269853u, 3158440321u, 538434017u, 508437111u, 2461460484u, 1662547818u, 3578959375u, 209001526u, 3335522863u),
+    SC(4264155336u, 4248354463u, 3273048757u, 2876562537u, 4290560912u, 509206354u, 1722430555u, 1796475043u, 864985283u, 4161684480u, 1401260098u, 2472895218u, 2342429930u, 827590760u, 300446032u, 2313806596u),
+    SC(2581459341u, 3429172659u, 2024065972u, 4099664542u, 1148350145u, 3444652410u, 3577141975u, 2981349935u, 4203645620u, 3053918552u, 3258443245u, 1577847138u, 1635931506u, 873577721u, 2391948063u, 3880308298u),
+    SC(348781524u, 168814463u, 525438717u, 333282992u, 3413546488u, 563982782u, 3571937262u, 2168075485u, 2567967190u, 4135534212u, 2773230423u, 2560090101u, 4070935767u, 1086323696u, 2826348049u, 1398744384u),
+    SC(1019826995u, 663251023u, 3152709102u, 4103744231u, 1372971676u, 1214523997u, 1159949230u, 2703418845u, 786011241u, 2156179212u, 1156040729u, 3454726929u, 1928366760u, 4000343119u, 4288863167u, 3214674902u),
+    SC(2681260382u, 4128008241u, 2510236484u, 1511367526u, 1684226652u, 979685907u, 2954161581u, 3173181201u, 2348267479u, 1347783270u, 1149362033u, 739573388u, 2484197607u, 335176176u, 4239049161u, 739872951u),
+    SC(2990421330u, 2634202447u, 3179573376u, 2783566953u, 2521510477u, 3781882024u, 2239710944u, 2912891640u, 4089020966u, 4152247187u, 3694477470u, 1764138981u, 2507816564u, 3857045441u, 3960587447u, 1062920229u),
+    SC(2607237939u, 3082469982u, 2290705462u, 3066564076u, 3196897175u, 4248068159u, 2751492888u, 1096521131u, 1350638971u, 3209282660u, 3725272910u, 717966828u, 1468400702u, 1807609199u, 332456241u, 3283231722u),
+    SC(752680913u, 2889161941u, 555836002u, 2587892579u, 793746532u, 2681266768u, 719050347u, 3803221u, 1422540107u, 1615046554u, 1724888503u, 923959013u, 3231965435u, 2753642578u, 1839210672u, 3344430910u)
+},
+{
+    SC(35118683u, 172484830u, 3416100291u, 3700412376u, 540823883u, 3117923166u, 4211300427u, 2853939967u, 3346783680u, 988896867u, 2435731911u, 431849862u, 1744411117u, 2614624696u, 297543835u, 4045956333u),
+    SC(2040009399u, 3617093372u, 1922089948u, 419196583u, 488784755u, 779735420u, 2537006207u, 704283906u, 1092151363u, 2578829348u, 2820670194u, 2121866485u, 3135057501u, 2561548080u, 1838738028u, 3520705790u),
+    SC(2347233873u, 2021920507u, 3747005552u, 3302704092u, 1421533666u, 2091592699u, 3349570591u, 3813605549u, 115030445u, 3350012162u, 2428670067u, 3833734570u, 1834087037u, 3648785167u, 3795974654u, 230561124u),
+    SC(3166315679u, 1499753232u, 1332394568u, 512254231u, 3188709397u, 2787249743u, 4120940214u, 2887173650u, 3906489413u, 2295240998u, 2578634494u, 1588397589u, 1261609842u, 547227344u, 3285763119u, 2699176838u),
+    SC(2920964533u, 3740093834u, 2438698186u, 1924062654u, 745692322u, 2251363856u, 1198363872u, 1945834517u, 3791006786u, 4021475876u, 1202959856u, 137650558u, 3764418806u, 2028729507u, 3549185474u, 4085572018u),
+    SC(2715838951u, 1959655040u, 1103474341u, 961883214u, 3220165814u, 946461598u, 3310562057u, 3895921046u, 3423737504u, 3466676673u, 4053794032u, 4003999722u, 704282430u, 186242539u, 1929875533u, 2743489242u),
+    SC(3863164996u, 1689760206u, 3183192577u, 2929742795u, 2741898431u, 3788088914u, 2356234821u, 7039846u, 36640443u, 397902308u, 1207730645u, 450227359u, 3243815017u, 2084858847u, 1390053102u, 1800322698u),
+    SC(2899288970u, 284742850u, 4164169257u, 657423444u, 1943078242u, 2187671316u, 2338824812u, 1463135135u, 2886625321u, 272841068u, 3193451269u, 275059886u, 893727404u, 1588413844u, 3713690958u, 858582046u),
+    SC(220208151u, 2716463025u, 2076296789u, 1220608226u, 1158026410u, 3025895717u, 2670689841u, 80726308u, 1182245224u, 514737744u, 1549626516u, 2794996864u, 1140029757u, 2873715616u, 2877687374u, 2336796195u),
+    SC(1712499527u, 3009254442u, 159655935u, 3126441867u, 4265886590u, 3094626983u, 2035167860u, 2311303989u, 3444838362u, 2596170866u, 3801673179u, 1837914686u, 3231006463u, 1247923284u, 584065013u, 4147287941u),
+    SC(900839097u, 216650153u, 2150488455u, 1952211291u, 2276027011u, 3518121564u, 3433005808u, 477320989u, 4007917006u, 2860081630u, 3686269191u, 921073036u, 3922496269u, 1487331039u, 3974930220u, 2054391386u),
+    SC(3348685354u, 1508268709u, 1715972206u, 4188610176u, 2563479521u, 2178972493u, 3288192040u, 3754144178u, 1173914019u, 454089507u, 3398639886u, 574196980u, 135948897u, 105476021u, 2877469782u, 2140775314u),
+    SC(60661201u, 2505799644u, 1330476086u, 2641855913u, 3370908611u, 3545887069u, 2369313011u, 278373074u, 1677987717u, 2174519857u, 2497481396u, 1568231376u, 3671812134u, 1893623337u, 1526376990u, 3328774765u),
+    SC(2836826686u, 3566150450u, 1220364883u, 3711427451u, 3528155780u, 2723292785u, 3326692341u, 2222164977u, 1858144237u, 1869912598u, 665154087u, 1299959695u, 2415334423u, 2100885199u, 1677986979u, 848478053u),
+    SC(2293836559u, 1740853836u, 1031472293u, 3209927466u, 2722427870u, 1686533972u, 3134525842u, 43165427u, 4133377528u, 4179858803u, 3614537390u, 3380004165u, 2699323023u, 2351902646u, 3408173486u, 2494501357u),
+    SC(1820258417u, 3371479244u, 1743152481u, 953496909u, 4267482844u, 97428203u, 2755286865u, 830318058u, 1082737155u, 2096588114u, 869939293u, 1138867599u, 3414628151u, 3300388932u, 2755674787u, 886356844u)
+},
+{
+    SC(1981590337u, 957784565u, 3778147127u, 3909235993u, 1637480329u, 2280601867u, 1059949562u, 2968107974u, 4043469535u, 4159249472u, 895867525u, 402468881u, 3186079639u, 86430659u, 4027560590u, 4067278225u),
+    SC(174847206u, 2629171882u, 2333280466u, 3666750170u, 1365991192u, 1932613341u, 769674425u, 2870677148u, 3091982589u, 717533940u, 691292429u, 746447527u, 2346750954u, 2424023836u, 2489851473u, 1000862947u),
+    SC(1294470925u, 420276534u, 18534679u, 2910625938u, 3592407247u, 3676292946u, 91786365u, 2630448437u, 4060747756u, 3372072880u, 766751258u, 2899531047u, 631745164u, 3523898915u, 3168717447u, 2801541394u),
+    SC(4228902076u, 3340600279u, 3364406353u, 4167190351u, 39030410u, 2148305555u, 4106423272u, 4019775241u, 1048613489u, 896239533u, 2278643848u, 649090509u, 1858593869u, 1017004108u, 2725922618u, 2362479567u),
+    SC(3279186701u, 4095625861u, 3191586341u, 3252046177u, 4161721618u, 2329134038u, 751155705u, 2989611709u, 942304573u, 3648059604u, 2883823407u, 1492175829u, 54393633u, 3106238944u, 429976962u, 1435978615u),
+    SC(3849622377u, 2984399872u, 690474125u, 61954906u, 3671421106u, 3429544548u, 2830056933u, 4242121816u, 952897126u, 3854066003u, 462125754u, 3261473627u, 4248077119u, 2601130223u, 2596495819u, 1081964366u),
+    SC(3544595842u, 126020837u, 2577264196u, 3433073867u, 496013073u, 2132398305u, 2482253446u, 1347711182u, 3954364337u, 261394336u, 1107608476u, 3443266300u, 104305688u, 870955527u, 3446753045u, 646876293u),
+    SC(164137956u, 1354687087u, 347069906u, 2162313159u, 2097666782u, 2177194309u, 1083298213u, 1791764705u, 445921337u, 2034078155u, 2254058003u, 1297019339u, 2457505957u, 3923390662u, 3364713163u, 2092921u),
+    SC(2010686846u, 2180989257u, 2265174665u, 208481647u, 547071646u, 2570387552u, 227431381u, 3946252713u, 1802054573u, 2876468168u, 3435214380u, 619729504u, 96719536u, 601795828u, 1679578869u, 3266813859u),
+    SC(1689091897u, 2850488954u, 85895902u, 2363909390u, 557966933u, 189022184u, 4135255025u, 2090271113u, 2804992462u, 2897353835u, 3129164865u, 2671868525u, 1204434986u, 2421048110u, 1069687644u, 573230363u),
+    SC(1864118934u, 1742326766u, 130305247u, 3848358018u, 448383585u, 389136808u, 676464280u, 133776905u, 3973153497u, 15653017u, 4189644276u, 1910866015u, 4017185152u, 3100723612u, 137322886u, 3499754296u),
+    SC(2165760230u, 1978556390u, 4038887110u, 3280144759u, 2755863878u, 1292009146u, 4196675347u, 2883653205u, 2360229279u, 2940095236u, 4183119698u, 122598923u, 483221264u, 2336117478u, 1200036442u, 1470973u),
+    SC(22625049u, 2110942382u, 3865539390u, 3568657648u, 4280364838u, 467068956u, 1638706151u, 934686603u, 1016938107u, 1378881668u, 2052861738u, 969631954u, 3114829317u, 2704079673u, 4202235721u, 1896331078u),
+    SC(1272877817u, 322275610u, 2048255u, 3828419764u, 283292018u, 656555904u, 1730883898u, 407673382u, 3259565233u, 3319282763u, 829721223u, 1466466546u, 121051626u, 1142159685u, 3894622225u, 1384264827u),
+    SC(3763136398u, 3055118026u, 3433748869u, 930030556u, 2135841826u, 2075894041u, 2845381068u, 3086878324u, 257833966u, 160279206u, 524657374u, 1855318297u, 1760771791u, 1248968332u, 2414205221u, 2464430473u),
+    SC(3809273981u, 900900763u, 2895572448u, 3283497701u, 1349213062u, 580961411u, 3299214221u, 3628519825u, 3643683404u, 3319374656u, 3868217535u, 427844533u, 3841842588u, 2749654710u, 2681210929u, 1051800659u)
+},
+{
+    SC(1622151271u, 634353693u, 3884689189u, 1079019159u, 1060108012u, 22091029u, 115446660u, 534633082u, 1649201031u, 4042006969u, 137296836u, 1833810040u, 1562442638u, 3756418044u, 1181092791u, 160208619u),
+    SC(1041667920u, 3037209402u, 1477404634u, 1440610569u, 2797465015u, 2054982250u, 3391499235u, 3605494419u, 3639198696u, 1933432209u, 1915711520u, 2741088986u, 3869566747u, 1879175626u, 717801628u, 458685614u),
+    SC(2768417957u, 2138940313u, 1896672548u, 1414723957u, 827016389u, 745281061u, 1045174332u, 3577682097u, 2169383377u, 1730416479u, 712654956u, 3155052928u, 1776219501u, 3353461099u, 711436547u, 1497369655u),
+    SC(1896697766u, 3621973902u, 926548253u, 4069206549u, 2297004301u, 3251063401u, 993943014u, 1270589313u, 3281589988u, 588955836u, 2429665887u, 1734915238u, 3409902793u, 2578722241u, 654727507u, 3216225031u),
+    SC(2536890957u, 2554531636u, 2109372546u, 2649000077u, 358086224u, 3391808161u, 1211714614u, 2605265326u, 2606629887u, 206756474u, 1092207840u, 3362434504u, 3945886373u, 4232252600u, 2886868947u, 3532954370u),
+    SC(65718672u, 4071991225u, 2060698395u, 2198173427u, 3957878549u, 4022831630u, 3461473682u, 419893418u, 779469249u, 2019627177u, 2019172804u, 3609556656u, 2681069216u, 2978123659u, 1249817695u, 2366599297u),
+    SC(2811735153u, 3049657771u, 1390752797u, 1411409994u, 2127695318u, 3083850245u, 787626821u, 1929564189u, 855492837u, 4008216334u, 1809444437u, 2182869717u, 813270534u, 2247412174u, 1161082081u, 1381922858u),
+    SC(3920648469u, 503487540u, 2083562080u, 327383264u, 2785608988u, 867359286u, 1036950980u, 431152821u, 1419040671u, 2665230771u, 2455357484u, 351717207u, 3187759581u, 3348793239u, 2511298896u, 1213040259u),
+    SC(2396309679u, 670711827u, 2849604206u, 3201137057u, 818618388u, 2531623890u, 3805810347u, 1463443182u, 79508933u, 3480790940u, 3579218280u, 263259195u, 3368747551u, 3044188079u, 1352272344u, 3090026690u),
+    SC(337838342u, 789695791u, 185502398u, 1517725636u, 783544345u, 2877621235u, 2946546356u, 1215973672u, 1208860651u, 725001171u, 1289736233u, 3756237869u, 1654092362u, 364807179u, 4279861158u, 4016003402u),
+    SC(1113567525u, 3780565260u, 836674522u, 1827009520u, 756906197u, 2663480421u, 3902552087u, 3507352398u, 774509259u, 224530498u, 2361577079u, 3744385228u, 3961162378u, 2586454589u, 3040342450u, 332039963u),
+    SC(3041171145u, 1474749273u, 2282851768u, 649990155u, 2952549483u, 1360702019u, 1809905451u, 544396952u, 68636355u, 2878101257u, 1478326650u, 2199663643u, 320705780u, 628185476u, 2087425498u, 3828181698u),
+    SC(3988280964u, 459019854u, 4007245269u, 1946776277u, 125932076u, 3922945473u, 608655237u, 759981570u, 1458494773u, 3686363491u, 3746534866u, 3692063331u, 290340676u, 486223220u, 3313127929u, 2280570810u),
+    SC(233319658u, 3886064320u, 853251650u, 1236563554u, 538386922u, 1967845333u, 3003439052u, 2872751142u, 150287328u, 2176354561u, 3956114759u, 3858039u, 2003618785u, 4212993191u, 2956509701u, 3196752221u),
+    SC(2121593903u, 3906201458u, 1137774967u, 3978600103u, 780659717u, 3484790562u, 769856015u, 36405780u, 695767695u, 3397748350u, 3377872749u, 1577340836u, 783581424u, 3804923626u, 2896998870u, 1723843622u),
+    SC(2572703671u, 2154230449u, 1195305676u, 4208655231u, 922600921u, 448134411u, 986012643u, 2442352758u, 1662902878u, 1367546113u, 2863017129u, 59878996u, 2111442975u, 648834983u, 865532037u, 1000323350u)
+},
+{
+    SC(2802315204u, 2299944053u, 2128407100u, 3463617348u, 2448441666u, 1070000794u, 1884246751u, 210372176u, 4075251068u, 1818330260u, 3223083664u, 3496698459u, 3376508259u, 4156094473u, 3718580079u, 1962552466u),
+    SC(3866141502u, 1978128229u, 2646349807u, 2688968712u, 1012393569u, 2539553175u, 2230158790u, 2206981245u, 3747509223u, 1243575365u, 3510697084u, 4007723917u, 859148499u, 1713821117u, 199178654u, 2644187203u),
+    SC(1964672019u, 297703434u, 1518880848u, 3373273121u, 959853764u, 2251122694u, 723413077u, 800337307u, 648287930u, 2947400245u, 1113383775u, 3610122168u, 1829970570u, 2892296971u, 1554744636u, 494969279u),
+    SC(4031050415u, 1835549397u, 2490029791u, 1131956513u, 1204048760u, 1914510905u, 3436953651u, 3943499769u, 1759802551u, 3820069122u, 4025269834u, 2717988015u, 2671631612u, 1159803272u, 1951365142u, 4085381442u),
+    SC(606110736u, 4064038873u, 70240913u, 2494945854u, 3729188113u, 2063877878u, 3912150605u, 3215847250u, 2977890044u, 3389766053u, 356841724u, 356991784u, 2228722660u, 3145515298u, 2594559598u, 1158432841u),
+    SC(1794017518u, 25183950u, 1671020817u, 785574353u, 95301808u, 1715172822u, 2718673424u, 1470113919u, 1142251437u, 2499778479u, 4281783303u, 1325560741u, 2913926884u, 3804531669u, 3139007483u, 1406557472u),
+    SC(2970751291u, 2450850294u, 545967636u, 1959629374u, 3303894193u, 455065073u, 41447235u, 1831795469u, 3594460859u, 4077235761u, 722461030u, 598330044u, 192707446u, 509790368u, 1051867275u, 1446366645u),
+    SC(1959543921u, 1887295052u, 3154544834u, 487969766u, 2252004301u, 996805128u, 2018864848u, 597352487u, 1136669046u, 533675042u, 981364938u, 2653382923u, 1408807893u, 2742559841u, 1833041360u, 1912794731u),
+    SC(2721713526u, 3549551325u, 601974093u, 2790584575u, 3951999363u, 4215366345u, 2845142034u, 4218934731u, 1726020765u, 823952138u, 3809833u, 4233069287u, 1129914456u, 1399496316u, 1915356031u, 4169077603u),
+    SC(3926695685u, 1849292395u, 1522137139u, 1552827989u, 4109112844u, 2060253220u, 2853920191u, 801241282u, 3422535773u, 1693187125u, 2113050221u, 2708536698u, 2777027446u, 4174902187u, 1811957361u, 3772547370u),
+    SC(3930825929u, 747327770u, 2505687587u, 2880650279u, 583976081u, 3834434841u, 1957901663u, 82062519u, 1246607062u, 4096185443u, 1298601955u, 3551964017u, 2293924654u, 2316870880u, 1326950040u, 3135743003u),
+    SC(2476396705u, 2790106263u, 443544224u, 2802435205u, 819417773u, 177556618u, 4130535785u, 2505448107u, 2591437865u, 1610510350u, 3815578981u, 4114533339u, 2461835810u, 3856846001u, 1439644255u, 3343979676u),
+    SC(4065627430u, 2927818196u, 950831561u, 4171626868u, 1177734694u, 150634338u, 2487656862u, 796691698u, 2119716392u, 2975402883u, 833495592u, 2179672277u, 346833760u, 3054174076u, 3573945862u, 3318693908u),
+    SC(2752867821u, 4203551149u, 1685153083u, 1110714758u, 1962211454u, 2837810663u, 1792364454u, 4089022191u, 3967274249u, 192406218u, 3350506767u, 1577386058u, 1497165592u, 1817646171u, 1066733732u, 617241273u),
+    SC(307712584u, 3903562077u, 681601120u, 3047177738u, 2486055863u, 3842609448u, 3660507009u, 2553494609u, 3174736607u, 3482954246u, 1496988826u, 1025695462u, 3184242644u, 1095387068u, 949053977u, 2083266597u),
+    SC(3022399010u, 1538609936u, 2420072227u, 990220729u, 2914167049u, 3768364162u, 1346299210u, 1681335666u, 2574961060u, 4053930867u, 303191498u, 2606902764u, 726562386u, 2306023171u, 939416980u, 608183941u)
+},
+{
+    SC(1862109024u, 2933191225u, 198801920u, 104305860u, 4011109577u, 4122560610u, 1283427153u, 1072910968u, 1957473321u, 1766609671u, 2854361911u, 4075423370u, 2724854995u, 3336067759u, 2831739585u, 400030103u),
+    SC(3665137971u, 362515859u, 3613170351u, 1634568159u, 2407386812u, 2769867978u, 3661728638u, 966943982u, 2329232814u, 928287686u, 386060431u, 2380767940u, 993235698u, 994357638u, 4262826729u, 789587319u),
+    SC(700222805u, 4205189715u, 1681820282u, 2408317852u, 3145763515u, 149703318u, 2996102375u, 2778856747u, 1243021847u, 118692771u, 660320701u, 2037909966u, 3471407521u, 3539034550u, 2338530850u, 798101514u),
+    SC(202761792u, 3072251152u, 936980226u, 2112028598u, 55725596u, 545941282u, 2866544613u, 2541609642u, 2986914411u, 250525398u, 494419489u, 904338436u, 448237071u, 2519815520u, 3547503723u, 3479815920u),
+    SC(2591263445u, 2313710919u, 2225850186u, 2907469855u, 1923973028u, 2439332754u, 1359667863u, 1147453888u, 591668157u, 1802961428u, 2115337573u, 3814501239u, 1652114003u, 3286770823u, 2320492326u, 1627762005u),
+    SC(915583786u, 1541647557u, 857793588u, 1120457139u, 593298997u, 1235522530u, 3835902793u, 4029633796u, 2892088014u, 950803214u, 2067553664u, 3466102617u, 417988445u, 1721721291u, 2995105031u, 1833135847u),
+    SC(3713015457u, 984220366u, 1636921821u, 69668826u, 2853588756u, 3372417728u, 1514016965u, 3165630303u, 549067200u, 2237752955u, 3528219045u, 2819816242u, 2536477233u, 430232621u, 1219272797u, 2682238494u),
+    SC(4158909478u, 628504302u, 1961569314u, 3701318609u, 1298978065u, 2797817112u, 2778611026u, 2986972418u, 2728592083u, 1350107926u, 261737783u, 1726357156u, 2342206098u, 3937750792u, 3688276065u, 1598643893u),
+    SC(673033353u, 989709407u, 1304069795u, 4233856570u, 603282839u, 3834722266u, 3349356388u, 2690783748u, 318351191u, 3370905692u, 2347975280u, 2009518842u, 2234183321u, 2940030960u, 2623873751u, 1542240694u),
+    SC(2380479990u, 2443937714u, 165899369u, 1753008008u, 3688956092u, 2346743686u, 143829732u, 3830274100u, 446444093u, 1705814492u, 2316415254u, 1337109896u, 3093454689u, 1928322219u, 2296006624u, 2093435857u),
+    SC(4072133379u, 1665275533u, 1975626640u, 3338948757u, 3639875020u, 2527617364u, 2537708733u, 3825629008u, 3956434656u, 2047924528u, 2149850378u, 563001677u, 1364815414u, 2503665164u, 637530147u, 630327427u),
+    SC(2169035971u, 3667715128u, 133026623u, 1213164483u, 1858042667u, 1566345391u, 3257221880u, 1553218197u, 1494901497u, 2543246705u, 3407410762u, 149097838u, 2595763051u, 3921913476u, 3975713216u, 1013875562u),
+    SC(4285039888u, 3972750160u, 2508056116u, 3828502305u, 1554885499u, 2478771653u, 3465835374u, 2839338634u, 936668484u, 3860842840u, 1796057260u, 539213045u, 1979230663u, 2637220243u, 3822691920u, 124051918u),
+    SC(4008482152u, 442930842u, 3844390262u, 1477377511u, 2570068482u, 380269897u, 3550124210u, 1507268577u, 1690622835u, 1216029693u, 2876552462u, 1409060125u, 862828291u, 1145788484u, 2966975851u, 3091998876u),
+    SC(992351977u, 3038251247u, 1125019979u, 3468273479u, 2933515034u, 2848650947u, 3581678949u, 3449520008u, 3870604714u, 2854135121u, 1257402460u, 1206940695u, 2996845551u, 725641056u, 3899090423u, 600507448u),
+    SC(1594814264u, 3363681343u, 1687711901u, 1220822433u, 2890970125u, 4169329849u, 1095390946u, 3969022672u, 2174219653u, 1940964660u, 1237339498u, 2965031440u, 1016584643u, 2590104317u, 4235803743u, 3748725935u)
+},
+{
+    SC(770670183u, 2030489407u, 913827766u, 28354808u, 2556411291u, 589717159u, 413516142u, 20574376u, 1695189435u, 3750527782u, 3546610407u, 1435363367u, 2770958348u, 2608593137u, 3331479090u, 2086258508u),
+    SC(386282669u, 3729286075u, 814752142u, 1413230862u, 2616133966u, 2483044279u, 1602859126u, 1971292416u, 3070813417u, 3451205972u, 735409142u, 4007950155u, 2905395594u, 2869625175u, 3709680291u, 2952203732u),
+    SC(3404816958u, 563114856u, 2100979818u, 2101934521u, 2503989815u, 1063833326u, 1723163772u, 3130704072u, 2515274210u, 1396315966u, 393457735u, 2691705207u, 828877164u, 3349330754u, 122605524u, 2602269000u),
+    SC(3709941627u, 592327138u, 2051205206u, 810649302u, 871212350u, 1541388603u, 4163983787u, 2631105522u, 665062813u, 2612020092u, 3229205070u, 3819479307u, 3310127863u, 1843015221u, 2875318880u, 3723951791u),
+    SC(1567440489u, 946197176u, 1275093448u, 4236630568u, 3990268727u, 196525149u, 15396621u, 1859637416u, 3138749279u, 3859238173u, 3227404352u, 2720346799u, 3006927153u, 2147957966u, 397899810u, 870180302u),
+    SC(1039540230u, 838590221u, 2330450212u, 923346890u, 4067788704u, 3619481496u, 3864357516u, 1659963629u, 3299501842u, 1079788777u, 949881347u, 2502746723u, 3228809289u, 247884983u, 3118597092u, 302086001u),
+    SC(3566621623u, 1671359399u, 3923258138u, 1638982085u, 325268348u, 4006635798u, 1207442469u, 3002539627u, 4047574291u, 2011583803u, 1713508996u, 1060703309u, 4012225302u, 3776068377u, 2784459927u, 3025510009u),
+    SC(4215947449u, 1997878089u, 1026649407u, 646510252u, 850804277u, 1871694871u, 3390738440u, 3114862405u, 3567086852u, 195428920u, 1556755650u, 1851670178u, 2207687769u, 3388294264u, 4058594964u, 4248126948u),
+    SC(45480372u, 1361999478u, 2195192123u, 956464540u, 1294436548u, 3045580134u, 2390633033u, 757048237u, 1350268583u, 862465366u, 1780970485u, 3285033794u, 559081924u, 163710122u, 3170983363u, 2626972150u),
+    SC(90053239u, 741607095u, 3003181022u, 3546281037u, 1996206866u, 2019149839u, 2216417072u, 1170259974u, 4159879668u, 130215053u, 2605146665u, 3967236653u, 1930867601u, 2409157952u, 3775975830u, 1489883331u),
+    SC(40478381u, 3873592210u, 35609037u, 272986081u, 3051595606u, 504620408u, 1019656134u, 250693036u, 942133950u, 156032543u, 3738710122u, 1712961843u, 2888111563u, 1171258741u, 645705716u, 511104714u),
+    SC(239657447u, 2278853730u, 2391081998u, 746810345u, 3484552464u, 1369592268u, 2655434121u, 1213868536u, 2934523673u, 3058111393u, 4281279490u, 3966376385u, 1307651904u, 1645528218u, 3652190772u, 1126527756u),
+    SC(123809694u, 110218531u, 117547539u, 2035819815u, 3596140063u, 1382818318u, 3664758070u, 3019339789u, 2719299822u, 3892472009u, 2876096109u, 412140786u, 2578091481u, 2196346764u, 3068803053u, 1395690512u),
+    SC(880155357u, 791542602u, 112062960u, 2175792069u, 531560395u, 3155859615u, 1042526138u, 680268271u, 1355330482u, 2485441305u, 148200464u, 964096786u, 3215229166u, 2660485876u, 3076499838u, 353883041u),
+    SC(2388114644u, 1552848777u, 1649071283u, 2325568488u, 3165393822u, 2695611152u, 2713875122u, 898903657u, 2377088931u, 1138573339u, 3366910425u, 3238180215u, 676550680u, 1043832292u, 1583145576u, 3925456200u),
+    SC(3116588854u, 731097341u, 35427079u, 152855963u, 655343116u, 2522648040u, 3048497137u, 3838372571u, 777022751u, 2851975543u, 235569549u, 3020787559u, 727642795u, 120522014u, 2406411931u, 4235508200u)
+},
+{
+    SC(2533741935u, 4150033708u, 3133949860u, 2798619408u, 806119564u, 266064305u, 1385120185u, 1697466874u, 3309272849u, 2305765083u, 4237655511u, 751372374u, 3319766406u, 1139025033u, 1880631363u, 2216696728u),
+    SC(531691765u, 3457214584u, 2884896024u, 292273176u, 250051106u, 4144042126u, 176967583u, 4132839552u, 2406879878u, 872979134u, 3029052987u, 2283805120u, 2613859206u, 553294045u, 1245122721u, 3840523078u),
+    SC(1249934121u, 993078438u, 2897493833u, 1681305911u, 57100476u, 365202891u, 2111004277u, 4247410280u, 1628827737u, 3793711703u, 3364391257u, 3510640052u, 3346661510u, 885793286u, 3903378618u, 356572920u),
+    SC(680178688u, 1413780236u, 356581993u, 2539116542u, 3091268161u, 952393142u, 3601213640u, 3759147734u, 3201912600u, 2029303323u, 3233109971u, 3469579370u, 4191225303u, 2727922547u, 4241219026u, 1108397896u),
+    SC(581424072u, 2231376178u, 2556335427u, 507971440u, 4133814232u, 3831053002u, 2090051536u, 2682264467u, 1696017056u, 2590078109u, 3496563305u, 1242917226u, 2491190071u, 2058502209u, 3614091208u, 50680464u),
+    SC(1148224059u, 3153210519u, 1979896166u, 3699990000u, 2774705970u, 4177914488u, 1097495713u, 3943642621u, 28438271u, 1936652546u, 2951976972u, 917798112u, 3345031007u, 3414386063u, 2086388059u, 3336786964u),
+    SC(3207879285u, 3245056275u, 2753912038u, 3444068917u, 3619101580u, 301796681u, 469710494u, 37792426u, 2324375961u, 3765435021u, 2308122387u, 186365381u, 1748483921u, 2929955002u, 2507797221u, 1450081310u),
+    SC(2628113752u, 657975440u, 4188527535u, 3642824575u, 1167948061u, 570005820u, 1209373950u, 3114955026u, 2156903999u, 3426648275u, 258877187u, 4116394669u, 3424577769u, 1876755024u, 3610721045u, 137959590u),
+    SC(1295746957u, 2893879416u, 2731249393u, 43796623u, 1509060380u, 3580712054u, 2063633991u, 246915731u, 245935590u, 2758600953u, 1174591025u, 3759438209u, 874703696u, 3900497366u, 2032803558u, 741576512u),
+    SC(737124188u, 2899307081u, 1769647158u, 617077642u, 1659909664u, 278863054u, 4232490889u, 625515113u, 3013249184u, 3621100329u, 3078044036u, 1407642415u, 2069197169u, 551433765u, 2836890938u, 3978268035u),
+    SC(1956698332u, 1096426127u, 1006277939u, 3889489220u, 4030026180u, 3579514159u, 4250029335u, 2203857202u, 3553085216u, 3293255490u, 1237506477u, 1050435484u, 3944172449u, 3169627003u, 1477888937u, 2421667267u),
+    SC(867315816u, 669003983u, 4033294932u, 3994270030u, 1836283861u, 4220295811u, 3981502955u, 1254544883u, 2953929766u, 3399467612u, 2767815501u, 1837724890u, 359769422u, 525366934u, 2275330754u, 1596174485u),
+    SC(2757381304u, 618201396u, 1587888624u, 1754675322u, 309402992u, 1862772816u, 1766295424u, 776578164u, 3139660404u, 2518031939u, 4144540600u, 2162413735u, 2788510259u, 3413511116u, 1497090248u, 130610227u),
+    SC(4221771265u, 792248867u, 928054053u, 140258355u, 1340321712u, 917602285u, 1586319677u, 1429062327u, 3604542914u, 1952132240u, 3586261493u, 1380920077u, 1224870626u, 1321897505u, 3109874655u, 2938496454u),
+    SC(2321281375u, 3760646295u, 420407446u, 4154009512u, 2825227525u, 4188075686u, 2041350513u, 1285713851u, 1670924786u, 1104780793u, 3524777730u, 1315724274u, 2655303597u, 1675669649u, 3173211461u, 1286635196u),
+    SC(1138423224u, 1326909178u, 3451890502u, 3840823688u, 3093921534u, 4140902218u, 2007985143u, 2980979703u, 3539657192u, 1914000311u, 3861983402u, 1995841174u, 2739822780u, 4269529997u, 1752802206u, 3674790048u)
+},
+{
+    SC(1529327297u, 3326406825u, 3128910982u, 2593525414u, 42156971u, 3661621938u, 1244490461u, 1967679138u, 1025455708u, 720268318u, 2871990393u, 1117479541u, 1562094725u, 697888549u, 2324777980u, 3391621955u),
+    SC(1194208642u, 570517940u, 3796480395u, 3996975496u, 1891180536u, 2012913508u, 2586036803u, 2779419249u, 2424448764u, 654631266u, 3378681847u, 1794600320u, 850887774u, 2610529382u, 3440406071u, 442629809u),
+    SC(3922776395u, 1021134129u, 4161953411u, 3695042522u, 416696694u, 3141869998u, 2208946602u, 2248782897u, 3791212714u, 2183092330u, 2442693998u, 3821686193u, 359924765u, 1313892u, 732537261u, 3441185514u),
+    SC(3832647873u, 4126820624u, 1633739521u, 1776853127u, 1990846870u, 2931750872u, 723350088u, 2100866125u, 1353427778u, 3735236517u, 2936890827u, 1037652209u, 3538242522u, 1205440750u, 2681851721u, 3428134171u),
+    SC(3715940368u, 3100195993u, 139205042u, 933899119u, 508675941u, 2073279390u, 3838896736u, 762162827u, 2670162920u, 363468845u, 4142816880u, 2331633868u, 1859516459u, 2571514805u, 1415575689u, 3310370398u),
+    SC(1850103477u, 2861511197u, 2158258814u, 1914352173u, 4112609179u, 1613408074u, 2229142795u, 2743410061u, 386541358u, 4131835227u, 238820765u, 350328321u, 796595210u, 325800094u, 1477199872u, 130087432u),
+    SC(3503083399u, 2168288449u, 3773780757u, 707691176u, 2640783803u, 600372304u, 3521490788u, 1266639681u, 3049849833u, 3696342843u, 1559948576u, 3113774976u, 2979720549u, 3508429388u, 1393959701u, 716360542u),
+    SC(2281167118u, 2404489970u, 874916137u, 3296730075u, 4266077966u, 1052198560u, 3487426822u, 379036992u, 918125804u, 3064034925u, 3007906638u, 2843799763u, 13395259u, 1525101299u, 3917909303u, 323214095u),
+    SC(4272733253u, 1134926458u, 1071872991u, 1594198106u, 2743911342u, 1759781849u, 3909986783u, 357998405u, 4054491364u, 588230484u, 3248723140u, 4206364217u, 407716541u, 1660843258u, 3535395038u, 735131513u),
+    SC(3679104282u, 2103136756u, 3192389130u, 3635496721u, 3762160259u, 813057806u, 1922167568u, 196643685u, 1370854030u, 2657803320u, 3197001343u, 2838705898u, 1256322653u, 3731470140u, 1658864516u, 4241135314u),
+    SC(4138122573u, 1064712956u, 1914688217u, 3980579663u, 234064841u, 1340868250u, 2408246134u, 2334390091u, 3574856083u, 4185747404u, 2592066932u, 72932352u, 1132443153u, 3084950430u, 2850577555u, 531426487u),
+    SC(2552518597u, 1814188589u, 3771797408u, 1688271073u, 1392417060u, 1864411028u, 2178912172u, 2411760311u, 772279774u, 2791980611u, 2940533230u, 3149501999u, 370215731u, 2968115262u, 942881455u, 2310941126u),
+    SC(751991992u, 3546574605u, 2773077774u, 2498170045u, 3288367839u, 3030402134u, 1196921751u, 3823185297u, 3245569995u, 3802879953u, 493640893u, 3321821285u, 1141758187u, 3411864659u, 306737884u, 2761165281u),
+    SC(1865741334u, 706283811u, 2318095713u, 1419794148u, 2504644337u, 1922210484u, 263491957u, 3084520625u, 705689999u, 2554474009u, 3818190952u, 2133768662u, 3690402460u, 3381523320u, 831084441u, 1146769937u),
+    SC(831531101u, 3633896804u, 1996958159u, 636851001u, 4007892767u, 380666960u, 2826737942u, 4021398986u, 1411635481u, 515161969u, 4199924051u, 371116192u, 1868116156u, 397223417u, 972171737u, 2331326509u),
+    SC(974457928u, 3569708670u, 2643527780u, 699675161u, 2627045402u, 3565281489u, 1504374419u, 2979851122u, 688725044u, 4064400308u, 4156347928u, 4119156622u, 2098702491u, 2615488234u, 1090654007u, 3790938610u)
+},
+{
+    SC(1397828129u, 1248172308u, 2194412927u, 3657598991u, 2085616102u, 1202270518u, 3253032741u, 2632389423u, 1019922267u, 332153082u, 1521672215u, 2163564334u, 3102124007u, 582149809u, 329417494u, 188520915u),
+    SC(2484409087u, 165527253u, 332794704u, 523511269u, 3524328119u, 4077596669u, 3681267981u, 2969751460u, 3456338723u, 628364217u, 4089156990u, 1135761223u, 1241363911u, 2843043452u, 1927162020u, 1187988850u),
+    SC(3424784620u, 4001207648u, 1967060425u, 33527184u, 588161341u, 2216089406u, 1194534688u, 3972415390u, 3430941953u, 3671974564u, 355464831u, 2638417624u, 987848314u, 3854256447u, 2513703271u, 847178398u),
+    SC(944122325u, 1095537200u, 1611102749u, 3845108718u, 3985128242u, 1188491807u, 3783427529u, 722821803u, 2594736624u, 4038805042u, 2146959275u, 3199724336u, 3631416672u, 3989329185u, 1113423723u, 925573746u),
+    SC(536468163u, 2790961065u, 141113925u, 985919057u, 2438788330u, 374449238u, 2980068000u, 621714839u, 2454037345u, 2810385667u, 3189321079u, 794373297u, 4178743943u, 2630861151u, 1229894711u, 2665151675u),
+    SC(71889345u, 3684655732u, 3834974630u, 40555081u, 3804280840u, 423207811u, 1620826812u, 3717508581u, 1813258849u, 713714932u, 491517868u, 2389605511u, 767769458u, 2826892693u, 3923819122u, 3331321015u),
+    SC(3333750894u, 150650636u, 3555142699u, 1161199649u, 3068475424u, 1509735584u, 1033908609u, 3073273527u, 3313105177u, 3410735718u, 2770838598u, 2161939200u, 1654309303u, 1247727621u, 4123284974u, 3218452135u),
+    SC(4107359918u, 3667881557u, 4099213325u, 905728122u, 3167924799u, 3731720507u, 1537227227u, 659110227u, 2101733778u, 2731849932u, 1103266972u, 887588276u, 2413509058u, 3876926094u, 2675347623u, 834362982u),
+    SC(3178393694u, 2636806389u, 1832500758u, 186297941u, 3662837586u, 3282938029u, 1064394039u, 2117567716u, 95811670u, 1968831533u, 3070787872u, 2658254448u, 3676980228u, 3909574788u, 2135784404u, 3803100103u),
+    SC(2624310917u, 420491519u, 3322620679u, 3357048697u, 614451586u, 1196461215u, 41516451u, 3256616699u, 3715883496u, 2257787428u, 2455669147u, 880443853u, 2246776764u, 3074399406u, 278369115u, 1177356599u),
+    SC(439711555u, 2231299488u, 1079942678u, 677737570u, 563039018u, 2032266501u, 3704274118u, 1877323449u, 2386821791u, 2066266240u, 2520835526u, 1611863315u, 3800297318u, 2553770190u, 1751820038u, 2175904420u),
+    SC(3515911639u, 4055231138u, 2717511782u, 6831543u, 3016647759u, 2007513585u, 1217171617u, 3815960975u, 2720128636u, 364849140u, 4285658094u, 4211508323u, 127732138u, 997100418u, 3152669382u, 146802488u),
+    SC(3082714386u, 513166810u, 2182067081u, 798923178u, 921230382u, 1956178560u, 883901335u, 4290259857u, 2290170782u, 3274942148u, 2025203706u, 2950735447u, 3706997198u, 979032741u, 1714061744u, 1756952042u),
+    SC(1785121933u, 665679939u, 3927612276u, 926826810u, 456860581u, 4247102861u, 1802871345u, 3111467239u, 2947918463u, 4090223916u, 2765919892u, 3848356305u, 2236940933u, 2379663516u, 2033761836u, 170415812u),
+    SC(723418419u, 3083992977u, 2885930256u, 4084559514u, 3550295439u, 795067132u, 3902666387u, 98659646u, 3559229619u, 3518103022u, 3093345450u, 3504265473u, 3135355783u, 1746911831u, 3896748938u, 1982334610u),
+    SC(4151598450u, 129451956u, 3923175367u, 306344029u, 336516292u, 3560777935u, 2695409605u, 934056748u, 4131395595u, 112767211u, 3377236273u, 797539933u, 516899453u, 2089210576u, 1999558205u, 4107023428u)
+},
+{
+    SC(87353816u, 3198238907u, 1232123158u, 3291424375u, 3695263554u, 2608617182u, 3798070797u, 3966302680u, 3847946128u, 278442153u, 3929504461u, 3056452729u, 3658519828u, 643043450u, 684101279u, 121314490u),
+    SC(4041434108u, 1283940781u, 3208791522u, 2974918612u, 861706326u, 3183082284u, 508820598u, 682206875u, 1177134745u, 1065833400u, 1830916342u, 1348337823u, 1877305145u, 2647094535u, 2714586296u, 2450197741u),
+    SC(2726369020u, 1580548584u, 150986819u, 369792970u, 2983651480u, 3064179956u, 3511715342u, 1538695618u, 3829066845u, 578378703u, 2038030944u, 3732775932u, 1174552062u, 2377418012u, 375009203u, 1203897576u),
+    SC(3480144388u, 847968760u, 3831609064u, 2454845771u, 827762235u, 3561019074u, 3068061128u, 2125290281u, 500142325u, 2613926927u, 908976630u, 461018064u, 1790330457u, 2138554260u, 3099515250u, 2668195629u),
+    SC(1153226571u, 752634643u, 4102962367u, 2953166708u, 3172028384u, 1546019245u, 73810680u, 2123706323u, 2289283451u, 1736737040u, 4246735980u, 196740994u, 886758605u, 1893565373u, 3405498929u, 3744937024u),
+    SC(768993978u, 3888906052u, 3538251248u, 352204151u, 4022234611u, 1471705290u, 4243963811u, 2027117811u, 1763868778u, 1322271979u, 3608278288u, 3888498758u, 3465093513u, 3125049811u, 2129222282u, 295188310u),
+    SC(2552844131u, 1588346847u, 4175462227u, 3528353039u, 48525488u, 1810438463u, 342094266u, 3279671133u, 111165134u, 1329165912u, 4063411685u, 1911765579u, 2818934337u, 3808545183u, 3789526924u, 1948478023u),
+    SC(3331030119u, 905985030u, 3533623355u, 799989600u, 1593247216u, 4044824934u, 3057376453u, 1132187407u, 2788031862u, 3252641138u, 1745792893u, 1362467427u, 2194538589u, 4207162080u, 1731158987u, 3426969514u),
+    SC(282742454u, 1925220542u, 3537150606u, 1044967349u, 4104410814u, 3036747834u, 2170951116u, 4063975818u, 2876870249u, 40785387u, 3225638952u, 2818597718u, 1556539976u, 2301588618u, 2800555653u, 916700871u),
+    SC(607531008u, 2820787318u, 1270007122u, 63140951u, 2489460286u, 3749254552u, 3480926448u, 2300022433u, 3335552281u, 3577740253u, 4083676266u, 1879037356u, 3793973091u, 653990091u, 981292091u, 2669230849u),
+    SC(1168110979u, 889306226u, 331429321u, 3194220363u, 4271486769u, 2440942709u, 3008822642u, 561011853u, 2621371879u, 1149493671u, 1110535664u, 2670803472u, 394628735u, 4014155619u, 3742604108u, 1418371877u),
+    SC(1139004104u, 1152838795u, 3053437035u, 3533998804u, 965296070u, 2842987726u, 3847937142u, 3591812355u, 1659887171u, 3058851485u, 1843832825u, 2284970388u, 153709291u, 2147381595u, 1241923942u, 3246474482u),
+    SC(2372841964u, 95150550u, 785345036u, 3777509922u, 3777338585u, 1256811659u, 530593057u, 2218391448u, 163045439u, 4110451435u, 940149273u, 3289892018u, 1950559815u, 2046468986u, 785769535u, 229305669u),
+    SC(4222560409u, 1251917359u, 3419952330u, 3518946758u, 2125025139u, 840904710u, 2104865575u, 3206919775u, 407519472u, 2004634252u, 1712650404u, 3590313236u, 840286442u, 2628712493u, 3254945248u, 1148702071u),
+    SC(3313735124u, 1648160975u, 2356873919u, 1752134136u, 1812666743u, 1155388994u, 2048656880u, 513774477u, 495906662u, 2103152333u, 2943961999u, 735251223u, 2523783965u, 2210023145u, 1945848363u, 2437613245u),
+    SC(1086803487u, 4028294733u, 2247710942u, 1830793111u, 1634316303u, 2935377055u, 600165818u, 1578619540u, 2988076738u, 457218665u, 4176910460u, 454493682u, 1199052867u, 1940805269u, 347367761u, 1212452462u)
+},
+{
+    SC(3715433378u, 171840999u, 971741983u, 2238541363u, 3192426674u, 4094492328u, 467620204u, 194258737u, 3399274574u, 3279461044u, 1351137305u, 2503870624u, 193649547u, 2998335432u, 1712991547u, 2208648311u),
+    SC(2715750837u, 1950207216u, 2432412079u, 3161034889u, 3163700758u, 2527560734u, 1574123740u, 2830017576u, 1235654592u, 1173758764u, 3503805913u, 3353556737u, 1972267538u, 2593804497u, 4050894516u, 1536909338u),
+    SC(4252707359u, 3437282014u, 3776749445u, 203710275u, 463138159u, 2772620289u, 1182212975u, 1132575015u, 2008846240u, 1446588540u, 1178588185u, 2810502365u, 3189501211u, 3192046357u, 3703545124u, 2781338651u),
+    SC(127281203u, 3251296097u, 4229877600u, 1655402395u, 2971465573u, 744237737u, 3839563968u, 1414447733u, 2055975912u, 547297398u, 3544526703u, 1086573241u, 4145442250u, 370020177u, 2948813570u, 1970539713u),
+    SC(3163465607u, 792227545u, 605650287u, 3454430637u, 4436412u, 957261079u, 2917570432u, 3199157324u, 317922439u, 2607400867u, 3201779931u, 1812841573u, 973872378u, 3838606231u, 3221928943u, 461831659u),
+    SC(246719913u, 1498935408u, 1945961723u, 1327338499u, 2917210822u, 1660082997u, 597934446u, 1244971072u, 662537876u, 3851981101u, 2064803568u, 1228771649u, 4273868614u, 3144280868u, 3367923741u, 2660003700u),
+    SC(958115915u, 3015255252u, 3159655209u, 1681296573u, 2092702329u, 3275820278u, 1666603934u, 3861667140u, 2501203189u, 4234907638u, 1084271161u, 60369385u, 1104875606u, 3495688315u, 3738262066u, 4032927728u),
+    SC(1265262733u, 3131514218u, 237040963u, 4104455196u, 2691347880u, 3487609649u, 1785135800u, 1176579745u, 4089650722u, 3141152552u, 3206481300u, 1333364227u, 276607745u, 113027050u, 176916027u, 1602590030u),
+    SC(2774594376u, 3129694750u, 2287032514u, 2766750820u, 29083039u, 1069500497u, 840365222u, 3485333678u, 2555809577u, 3972967703u, 629036427u, 3011729266u, 1526288233u, 1119437732u, 917067812u, 194168105u),
+    SC(592881983u, 3318575349u, 4127058062u, 1732571107u, 3503756272u, 837953701u, 482225210u, 1269788935u, 1504556881u, 1896976655u, 165783184u, 328929494u, 4077662490u, 1253488686u, 3518656631u, 977900779u),
+    SC(4160682596u, 2908983358u, 1718640008u, 3588190607u, 1505225185u, 4179103009u, 1685793395u, 115536342u, 817223934u, 1402206707u, 3062750872u, 450873212u, 3409531894u, 2142975045u, 1392180850u, 3108320562u),
+    SC(1943394512u, 2513880371u, 1620134863u, 1529322591u, 4060169700u, 3770293993u, 1183592156u, 3047089385u, 1457468150u, 3671110754u, 1216162597u, 2044466392u, 888112901u, 3589252991u, 523705271u, 1679814981u),
+    SC(2715251449u, 70744868u, 3381212136u, 1205646623u, 2056792384u, 3523601635u, 3273403565u, 2609964048u, 1635414738u, 3927671477u, 2002719738u, 17329846u, 673666863u, 4128776449u, 1023303890u, 2113317599u),
+    SC(678583802u, 2909193903u, 1603800869u, 1698604501u, 292539447u, 3194048567u, 1222053939u, 4292027072u, 1744031112u, 463670025u, 1002183205u, 880963334u, 2427537891u, 2521706813u, 3815796576u, 836594698u),
+    SC(945238598u, 3719965767u, 2849528520u, 3282124488u, 1093917226u, 3479450861u, 2561471910u, 139299258u, 3917471374u, 1798050709u, 2851226278u, 2410252745u, 1571541746u, 2877491529u, 1276119582u, 4206041035u),
+    SC(3869162698u, 1114491339u, 1196187395u, 1533960773u, 3407411925u, 765004505u, 1831463563u, 3761422880u, 841664315u, 226257499u, 2314441323u, 2186776430u, 2801566686u, 2703073796u, 3780881787u, 1370189991u)
+},
+{
+    SC(3356584800u, 529363654u, 613773845u, 1186481398u, 3211505163u, 123165303u, 4059481794u, 1428486699u, 3074915494u, 3726640351u, 881339493u, 977699355u, 1396125459u, 3984731327u, 1086458841u, 3721516733u),
+    SC(3675076449u, 3333909775u, 1262445603u, 3668028655u, 433069981u, 3324184640u, 206500128u, 2656010471u, 782457265u, 4053687660u, 3895856132u, 315252919u, 2755213770u, 922519354u, 2055252100u, 2429801305u),
+    SC(2756940336u, 2847978751u, 1709353190u, 1195969566u, 1965491900u, 3974470294u, 4065860779u, 457378802u, 2625680435u, 4168918960u, 912437805u, 1940496017u, 2831564708u, 2681452721u, 2977785501u, 178951684u),
+    SC(2809970073u, 2149172818u, 128792792u, 4173216994u, 3752778392u, 3547909179u, 2139546257u, 363162335u, 1029632619u, 226065897u, 1871318430u, 3511308809u, 4293432909u, 733440206u, 3154916386u, 2246758263u),
+    SC(731502074u, 2752951666u, 3348551978u, 3130709972u, 1526861742u, 2511266125u, 4044638365u, 215744304u, 1267320586u, 1960868675u, 3421832152u, 2257930073u, 2620941002u, 851383950u, 547951559u, 1340068454u),
+    SC(2684856551u, 174120198u, 1829892583u, 1225976594u, 2442169561u, 2751359631u, 1396256832u, 4190566994u, 616089248u, 1633732935u, 1633964885u, 3929429044u, 842800539u, 676918864u, 1428572539u, 219449459u),
+    SC(133428457u, 620472331u, 1882141266u, 1679319159u, 679060192u, 3481716513u, 213482586u, 3423863792u, 4201383258u, 1319777873u, 927348830u, 208213775u, 4087467606u, 3653264448u, 3835415188u, 3916570843u),
+    SC(1895413499u, 3284443662u, 1774671761u, 36215094u, 1302729892u, 3712548907u, 689399756u, 809699792u, 1542256887u, 1010909539u, 1793915800u, 371041697u, 3719334021u, 1415418990u, 3304256413u, 1722896741u),
+    SC(4292037144u, 3413799593u, 431584770u, 554753321u, 1212891070u, 139387849u, 4633456u, 4145076332u, 2956733683u, 2226540590u, 257006677u, 3020881975u, 3400787219u, 587473979u, 260993303u, 3410840543u),
+    SC(4018910540u, 3254488333u, 2078930374u, 2245837925u, 2632570996u, 3139405325u, 1623001428u, 3612462970u, 2032232089u, 519993838u, 198517548u, 1752888302u, 2236384752u, 3428944014u, 3264747145u, 2955960571u),
+    SC(3519760330u, 3333709979u, 1048481536u, 1985059447u, 2643412116u, 3131942587u, 1137942580u, 1547604917u, 2831143240u, 2752062158u, 438973315u, 216212421u, 839130203u, 4170782680u, 1103599719u, 3606044489u),
+    SC(3979124118u, 943995448u, 2583700510u, 3458129573u, 1268799005u, 2693058918u, 2421470342u, 2310844252u, 4161944025u, 2910466020u, 1520150746u, 2594375360u, 1025693596u, 3356457299u, 1405172368u, 3357345029u),
+    SC(3608628529u, 1093067289u, 2172624909u, 336171229u, 1137437622u, 2177129887u, 3319848621u, 3625148145u, 940129946u, 3128586787u, 111536296u, 1792339610u, 2781599252u, 3659875306u, 872551800u, 2302213340u),
+    SC(1104919194u, 189973497u, 2565652941u, 2930155667u, 3463454839u, 2388313768u, 2445171637u, 16202936u, 1593006897u, 2191020511u, 2084184836u, 1467463398u, 2313657914u, 2691464051u, 4089268188u, 4294499481u),
+    SC(4188734592u, 3528391612u, 40836399u, 4036867171u, 4090825107u, 2939803682u, 140442162u, 2546416492u, 1084596508u, 3326586985u, 72576332u, 3780421002u, 3675044591u, 2008171921u, 3141075467u, 4288443118u),
+    SC(3852374110u, 4271371075u, 2076634991u, 3101716180u, 518739558u, 3284103928u, 1607286758u, 3505817896u, 42970787u, 1339303318u, 3280473330u, 1956150319u, 790791234u, 1449585627u, 3814185461u, 3901254732u)
+},
+{
+    SC(3892284764u, 2210224198u, 97085365u, 934022966u, 3120556498u, 264721182u, 4011343025u, 1936310374u, 2593930315u, 3833725723u, 4141640186u, 2218699022u, 3726005369u, 649732123u, 1594208266u, 3687592104u),
+    SC(2459115622u, 155132544u, 2344650987u, 2337329027u, 2478875455u, 1363777389u, 666384305u, 779524970u, 131624810u, 1099629813u, 755087667u, 1116544707u, 3462583113u, 1765615231u, 1221263451u, 345614861u),
+    SC(283432140u, 3102718597u, 937211953u, 3334135604u, 2242058317u, 3044145753u, 1441000856u, 2163904099u, 654999768u, 3976748269u, 4108102772u, 1209693616u, 3022484925u, 2592361118u, 3806239715u, 2457345174u),
+    SC(1983572202u, 34789206u, 3963513429u, 2661898079u, 3999779459u, 2657216026u, 2570146353u, 810465768u, 1310539449u, 3517224567u, 1830164911u, 2328664885u, 3323158486u, 200812613u, 1588943475u, 1631047872u),
+    SC(1996456687u, 665652044u, 360516388u, 3634015955u, 3932508085u, 3762889476u, 2869080596u, 2179691892u, 1880327422u, 3850327759u, 1653803674u, 236673399u, 2154944705u, 3229042401u, 2981554507u, 485288416u),
+    SC(264936494u, 3091907543u, 2050111855u, 2694936127u, 1954787063u, 722933256u, 3813405263u, 739130277u, 2256053561u, 3585156690u, 2029190911u, 3133350308u, 3458910883u, 3499638057u, 41852560u, 491183838u),
+    SC(2808085465u, 1288453772u, 2477084166u, 3837131567u, 1141955368u, 3112183866u, 1372456734u, 2203526963u, 2954171016u, 3969349716u, 2868857569u, 414601865u, 4013256181u, 468368341u, 1996835394u, 3658768313u),
+    SC(394302887u, 1097097404u, 3291468368u, 1194224926u, 1035172467u, 1541144594u, 3844885672u, 3479557309u, 3116596876u, 2815221788u, 2598284757u, 360029902u, 1618439794u, 2569763994u, 3258655905u, 2917038348u),
+    SC(2305403224u, 515881048u, 3401955316u, 2294640138u, 2523482065u, 2913659188u, 1840514079u, 1334322081u, 1545396585u, 4197671987u, 447162882u, 3846426473u, 2663235502u, 750784192u, 4164775689u, 2390294077u),
+    SC(2816642384u, 3952759529u, 3784236377u, 1797857230u, 1881467157u, 3886776601u, 754213935u, 2085935272u, 3814437883u, 3598631313u, 3014087408u, 1480756254u, 2838244491u, 132661795u, 909841870u, 675503551u),
+    SC(2053456581u, 627096201u, 3974668317u, 245144267u, 3845450294u, 1209560693u, 1003623636u, 3431474873u, 3952764341u, 3855863791u, 1357940588u, 3374805012u, 2942824193u, 2988435703u, 329942625u, 4139666589u),
+    SC(73006928u, 4068145413u, 2752900485u, 643186737u, 2386201439u, 296363448u, 2965535934u, 2202307569u, 1300692310u, 3766694667u, 2421404412u, 2295288621u, 1987219755u, 3682346025u, 885571108u, 1086202535u),
+    SC(3800801259u, 1729576293u, 2024334221u, 266315944u, 3877353536u, 2983817286u, 1164606138u, 2981999790u, 2626097845u, 3537364374u, 3559786635u, 2149380619u, 2137897542u, 2218263339u, 206251476u, 3754285811u),
+    SC(1009857555u, 1650586423u, 3853695002u, 1715580147u, 1146669099u, 1380681899u, 2219018152u, 1791877891u, 3247738482u, 1042579957u, 4035547117u, 2619207487u, 2408116465u, 3045899420u, 1771645449u, 1340019342u),
+    SC(2004305920u, 978372350u, 1705342765u, 503429310u, 3635208103u, 3659317811u, 3957481997u, 297103567u, 2521968324u, 599616959u, 1167498361u, 357125999u, 3158983160u, 3114128384u, 3086595483u, 2336612985u),
+    SC(4103187540u, 1182325894u, 97419735u, 1615223731u, 2031918136u, 2818146326u, 1038685355u, 1330155299u, 2657284062u, 4126074186u, 2871281156u, 2738191090u, 1922990674u, 2689532011u, 4040564095u, 99693623u)
+},
+{
+    SC(3639643416u, 3974502485u, 1527161781u, 180938703u, 2788643910u, 3418867931u, 2912046968u, 1776807950u, 1185488163u, 2433308651u, 3682797092u, 1938004308u, 753534320u, 795320477u, 3620835863u, 105275502u),
+    SC(2971894151u, 635573958u, 1662864280u, 3637757763u, 1966418418u, 2382544768u, 3521712538u, 4180511568u, 1216311665u, 1622710591u, 2836323703u, 1065095206u, 3046512769u, 2304432132u, 1370910091u, 3540050165u),
+    SC(3003078502u, 1266710982u, 63268125u, 3769826631u, 2161222028u, 1624738852u, 2999285769u, 2485757266u, 3350017650u, 1836975640u, 3947916645u, 3226839039u, 3416803572u, 2607406281u, 3224012241u, 1574498192u),
+    SC(2417128114u, 3148595382u, 316383238u, 491687931u, 3782721648u, 71265990u, 725842943u, 2574280796u, 2910592942u, 1266732336u, 3293910730u, 3812834954u, 758280869u, 2044998492u, 585388705u, 2220041893u),
+    SC(492257517u, 927280821u, 3326474467u, 3418658462u, 175063450u, 4228793954u, 2332128647u, 2793872080u, 3349562222u, 3060602442u, 1750735766u, 864506271u, 3021446456u, 1089650280u, 684313887u, 2273360774u),
+    SC(569437869u, 3392548160u, 448456633u, 786222873u, 1891470348u, 56622530u, 1988234620u, 1200550357u, 3540465428u, 1566012807u, 3682627310u, 3118219502u, 421481320u, 474517348u, 4276632114u, 3506654966u),
+    SC(200012878u, 1289466640u, 383837247u, 2978212823u, 641013196u, 1218428129u, 2429292619u, 1428313217u, 4155302101u, 1036892035u, 3775206351u, 778853475u, 3322870631u, 4195074838u, 3725481759u, 3550082329u),
+    SC(126839072u, 3914304851u, 1035784989u, 2867617428u, 1989254908u, 3724484330u, 1316610484u, 1040102649u, 1452719164u, 210631948u, 1224888518u, 1113840153u, 910511278u, 2297844676u, 797967535u, 283877762u),
+    SC(1244500121u, 2493482314u, 3779000024u, 2685901143u, 2759844693u, 2465008309u, 2989069530u, 1046572576u, 3374497605u, 2414541412u, 1726159904u, 3650454710u, 2872643374u, 1536622747u, 1381290537u, 3538573283u),
+    SC(1982773073u, 895953548u, 653968243u, 2944168854u, 1891156211u, 862699673u, 178384938u, 2122337777u, 3992617936u, 1827424625u, 1827918311u, 4247768891u, 2116109311u, 2389157370u, 3259962586u, 3018719650u),
+    SC(16401953u, 2306633926u, 2338480543u, 3225473112u, 3429377887u, 2444554167u, 3036218027u, 811186210u, 2350667613u, 3590742085u, 2594672781u, 575072326u, 272468093u, 997542396u, 3031146350u, 3776453205u),
+    SC(1784787552u, 1031272746u, 3302965053u, 805306745u, 3874552409u, 2790720051u, 483200429u, 1779723984u, 1097599486u, 1897611475u, 2456960784u, 1754250527u, 3808506348u, 3902842183u, 2596972722u, 2928554842u),
+    SC(2323692909u, 829274841u, 1103316386u, 1866432209u, 1938371795u, 4027514213u, 3989131198u, 2637747342u, 2193562562u, 1183535102u, 290853894u, 707762868u, 1909722738u, 2733745164u, 2354524179u, 94921256u),
+    SC(390966983u, 2005348047u, 1183001210u, 3460046175u, 1194344520u, 3385791048u, 306982602u, 876126480u, 3192052847u, 3055117485u, 1493712024u, 239443620u, 3677526258u, 3935077241u, 3195438491u, 2508943164u),
+    SC(3776157658u, 1760005001u, 3371368706u, 4151959572u, 4117952947u, 2782084300u, 3075220020u, 3130861900u, 3220322643u, 4251107806u, 2765944679u, 2454606920u, 3864173523u, 2241965276u, 1056706189u, 2253371852u),
+    SC(10455103u, 669421195u, 538798805u, 681593482u, 4243109638u, 2765550308u, 1560790187u, 2332940655u, 157674749u, 358872640u, 2549359913u, 811329072u, 318369228u, 2192271276u, 2616093049u, 3105543667u)
+},
+{
+    SC(3392929934u, 3483303263u, 1976307765u, 4193102460u, 1186037029u, 2559946979u, 3008510830u, 4008303279u, 2792795817u, 3991995u, 311426100u, 3736693519u, 1914150184u, 2000710916u, 1829538652u, 896726226u),
+    SC(1506989834u, 781231698u, 1423994091u, 932436763u, 2811140941u, 235158077u, 3312925598u, 1277169313u, 2161654787u, 95045550u, 2507009285u, 3400899479u, 1327874861u, 2641030305u, 845165129u, 3067306163u),
+    SC(81377829u, 4112377516u, 996390415u, 1466127523u, 1087938057u, 1370439327u, 2374941315u, 3221315808u, 35184362u, 4155013651u, 4157224703u, 3036174627u, 820839223u, 644204168u, 3814924360u, 2548030643u),
+    SC(1091124676u, 3446444543u, 108918031u, 285417020u, 1457053816u, 2518578419u, 3204558864u, 1447981867u, 3090612039u, 774503865u, 3344583272u, 2737274269u, 3562442510u, 1127429989u, 2804182977u, 1775681652u),
+    SC(2318905039u, 2047942274u, 566069924u, 123115342u, 2915025724u, 2614503051u, 611479778u, 1680640702u, 111791999u, 3565934367u, 3623017458u, 358904698u, 718271833u, 2594429479u, 2455462208u, 1049889789u),
+    SC(2072590390u, 2994175732u, 776612573u, 3305897523u, 938985307u, 4037860099u, 405398386u, 312125617u, 834030222u, 4269222652u, 3952042783u, 188369721u, 969558599u, 2241466312u, 1494637662u, 3640394545u),
+    SC(793329188u, 1680204464u, 4194525713u, 1397937237u, 2203558613u, 193170132u, 590149348u, 3837254789u, 2629901211u, 1547324833u, 4256276761u, 178627910u, 1204782838u, 3049171442u, 2847310157u, 1633221731u),
+    SC(1445130399u, 3305816299u, 706740166u, 1986021205u, 2637844550u, 1419078314u, 1678054887u, 2432697110u, 870544859u, 890225672u, 4294515721u, 4251895411u, 1276311012u, 1177847908u, 2958585231u, 4245816799u),
+    SC(4225912221u, 703507803u, 1922376483u, 3748563847u, 841832204u, 937238929u, 1762562329u, 2321245641u, 3396851205u, 4196168123u, 2898493537u, 4105193320u, 3913075709u, 3714213782u, 3736794417u, 1813506206u),
+    SC(473058800u, 1281200026u, 2096535567u, 1916392924u, 2499055699u, 1592813861u, 1665248526u, 1352252079u, 2539722497u, 3800235497u, 2456011531u, 2486813252u, 2969323588u, 2786889819u, 264256920u, 4162650714u),
+    SC(4093970658u, 1112717313u, 4105391438u, 692152127u, 3191447576u, 765356874u, 3774754898u, 3659714922u, 1417146611u, 4116649329u, 2382824064u, 4091923584u, 2943998996u, 2572469258u, 2350556732u, 4055180934u),
+    SC(4241530692u, 3958450744u, 2400383404u, 466315350u, 35062538u, 2419973666u, 1574066566u, 718969713u, 2103427683u, 1844215170u, 377438369u, 3472936858u, 4219642124u, 2727593550u, 2415179286u, 530554266u),
+    SC(1717990860u, 490767589u, 4104938990u, 1912533482u, 1727757083u, 4081637760u, 2971627803u, 4227474711u, 2482396781u, 1077462396u, 1040490667u, 188422725u, 1078987146u, 1905877850u, 3465315863u, 3779881072u),
+    SC(2343360099u, 2602377036u, 540592495u, 3215700530u, 2276091252u, 330543342u, 1521140429u, 3101043196u, 1353643940u, 4257187260u, 3766970644u, 3977679607u, 2139641066u, 2691703488u, 1191064988u, 3899819176u),
+    SC(4020334744u, 3662481612u, 4168714619u, 3391835711u, 3785299560u, 71469795u, 2493742903u, 3412561168u, 3292204549u, 1481564183u, 2157273751u, 477496008u, 931448839u, 2827709521u, 2133135454u, 3513095854u),
+    SC(1821292885u, 77067071u, 2713776553u, 2767520127u, 1059460035u, 985220275u, 2884538737u, 221640066u, 2657382407u, 232264137u, 3155923068u, 3788271780u, 2919723565u, 1308585734u, 3615447351u, 9588952u)
+},
+{
+    SC(2320406161u, 892569437u, 3092616448u, 1707673477u, 2810327980u, 4012118332u, 4142748730u, 3869507620u, 92116036u, 2366184953u, 1613655167u, 3287845172u, 3562699894u, 416962379u, 1296831910u, 1764080884u),
+    SC(220529260u, 249394787u, 707093586u, 3327680194u, 3905189366u, 612327964u, 3292761054u, 3030686883u, 1334491337u, 3207860077u, 3280619568u, 1041320647u, 2483468975u, 1479881667u, 3211575507u, 3039423798u),
+    SC(2075210586u, 859890386u, 3979249840u, 1571749934u, 1787834945u, 3779262932u, 3834468444u, 2848979155u, 3949299214u, 3265482052u, 521566179u, 4090178483u, 2634506734u, 537774764u, 1760986104u, 1885781444u),
+    SC(2157623553u, 1245488719u, 2108443037u, 4226304849u, 1701247415u, 4110744868u, 1746909616u, 3191493799u, 846028927u, 3826268145u, 3155840342u, 1303740777u, 3325552898u, 2580884535u, 3592783405u, 4209959030u),
+    SC(535271984u, 3867256577u, 2621667187u, 479852461u, 3031868718u, 681291605u, 3866870888u, 975222367u, 189285295u, 2489945122u, 4002580885u, 1631683077u, 2806354223u, 990581176u, 3013857114u, 805874285u),
+    SC(4221232460u, 3061114345u, 3434676469u, 1406782470u, 155821803u, 124504941u, 3888697140u, 2788501814u, 1026476732u, 2216503728u, 3089015914u, 2063998098u, 272392246u, 1587339314u, 677528523u, 2432699241u),
+    SC(3643892943u, 4282202220u, 2100563362u, 826776443u, 1365722925u, 2702305724u, 679208928u, 3149950187u, 1446692720u, 2990196076u, 3121167752u, 25041546u, 1204401671u, 3950457476u, 478874733u, 4191001246u),
+    SC(1002796340u, 395169719u, 3087599283u, 10336612u, 2123927609u, 504611529u, 4163730275u, 706425703u, 1588733263u, 4149509341u, 1952228143u, 3819719132u, 766367752u, 1435203845u, 1906598194u, 3492363785u),
+    SC(1774340829u, 3089482890u, 2870005976u, 919794943u, 2035504962u, 4034646005u, 3486869666u, 3458779364u, 2688966610u, 4246698276u, 241215855u, 1193302498u, 1307583268u, 129792487u, 301354381u, 2759318534u),
+    SC(1993945167u, 2379081822u, 2587040362u, 3154537819u, 1926143939u, 2749781524u, 935556830u, 4138641196u, 1781637476u, 2939621229u, 45782825u, 4247420511u, 1775642409u, 3169645376u, 1224651656u, 1411268824u),
+    SC(4099217380u, 332485632u, 702660355u, 2932600301u, 2644542769u, 1705216342u, 2043283695u, 2373746705u, 2092217219u, 1660104946u, 3159676245u, 3674605841u, 226100099u, 3987250021u, 2436672589u, 1083744721u),
+    SC(775618835u, 2173251804u, 4192653515u, 3582997173u, 3769245096u, 484007740u, 503088416u, 1360222738u, 586791868u, 3760447547u, 3490651251u, 3534666198u, 2531156474u, 1207301882u, 832959081u, 3020069982u),
+    SC(298341207u, 1349761730u, 1369831393u, 1101983922u, 2409775356u, 3892600618u, 3875266737u, 3482966490u, 4002034047u, 2018792567u, 1932407387u, 1184232926u, 3015567427u, 301694942u, 437132459u, 3636206614u),
+    SC(4090425889u, 2348669465u, 2575850637u, 3995997864u, 3040420324u, 1615191584u, 2490849366u, 2670494936u, 2841563080u, 3763919842u, 3580970157u, 3864708123u, 187158351u, 2199194387u, 4160227448u, 2176418944u),
+    SC(3040328915u, 1001466289u, 3676795030u, 2946692141u, 3593888463u, 2224708622u, 4148397123u, 4253879884u, 1993280384u, 1176406404u, 3148404923u, 4180061590u, 1786680964u, 4036906941u, 1164279397u, 3562714780u),
+    SC(1286200509u, 4232891464u, 1656861418u, 3412215448u, 1086562483u, 2512121988u, 2650588176u, 3097245464u, 3192968944u, 2220731064u, 3414522916u, 4204353060u, 3690514744u, 3688465060u, 2246470987u, 498255717u)
+},
+{
+    SC(1167035839u, 2632944828u, 1562396359u, 1120559767u, 244303722u, 181546963u, 2941229710u, 561240151u, 1460096143u, 346254175u, 110249239u, 1849542582u, 1293066381u, 147850597u, 3876457633u, 1458739232u),
+    SC(3571928080u, 2436259038u, 1291130511u, 4109706148u, 535321895u, 223400632u, 1981907545u, 281269666u, 3986674262u, 1137333737u, 1403128295u, 1607985509u, 1996916063u, 3564990547u, 3398899933u, 2822030993u),
+    SC(4187142002u, 2183119934u, 1635192887u, 2899344980u, 2532710469u, 3583070294u, 1537984623u, 296183513u, 2324170481u, 3475303187u, 3887648540u, 634736823u, 1254765115u, 3808584578u, 3772430219u, 561684376u),
+    SC(513372587u, 1759503751u, 4262413842u, 2894839952u, 1546497784u, 1634597484u, 3075497476u, 1112503488u, 1318854936u, 1645523550u, 1808408161u, 1471049890u, 1607196116u, 1989192912u, 3845591311u, 3230210229u),
+    SC(4281800629u, 256065360u, 161761292u, 2162610453u, 3289868207u, 803664088u, 1737988317u, 3468667062u, 1313091619u, 3871261661u, 4163576187u, 3519070773u, 663580583u, 2181685257u, 1282501745u, 373224564u),
+    SC(1305532007u, 4040631353u, 3016994284u, 364840424u, 312087064u, 2832713285u, 813363164u, 1634515727u, 2857968226u, 2482770921u, 2702964276u, 1457003903u, 4233117491u, 978467573u, 454990490u, 2451215822u),
+    SC(3309788844u, 1373644165u, 2568421202u, 4021050421u, 3214613315u, 3179866441u, 2282215282u, 4192353052u, 766132975u, 1427735093u, 3905164154u, 3510365574u, 3650419996u, 1208798186u, 2311177541u, 3425106727u),
+    SC(1485656607u, 1872571460u, 3807266779u, 3227427836u, 1367154025u, 2087101352u, 2787930808u, 1683647111u, 611621831u, 1033465938u, 1055561737u, 1718623444u, 3674681330u, 3643294293u, 3841507882u, 2950124804u),
+    SC(3583452191u, 43558840u, 2702416786u, 2831018419u, 4179535508u, 3293628424u, 3781032090u, 4272940814u, 1561835153u, 3434531879u, 2033417772u, 143682419u, 2206689113u, 2885101743u, 3330838914u, 3213033967u),
+    SC(1563269339u, 3268845808u, 481878529u, 1366255066u, 188999428u, 2024859095u, 3740130866u, 1902201859u, 3294724532u, 3498902869u, 2063801661u, 3851840419u, 1697955856u, 1216829830u, 2472036433u, 2158918739u),
+    SC(3706632627u, 1854832685u, 4075722340u, 3009760070u, 1947919686u, 1613829674u, 3359356634u, 160149010u, 3211678034u, 1403957074u, 2395316449u, 232911190u, 3595342115u, 593590477u, 4003146812u, 1042747586u),
+    SC(3566751331u, 1293366329u, 237055278u, 781035984u, 3490518265u, 471671502u, 3279573882u, 4088428685u, 3341570902u, 1660948465u, 2602036180u, 3189056267u, 1448251311u, 3378653995u, 367559448u, 1247557023u),
+    SC(332188181u, 124235367u, 2908363616u, 57405667u, 3860321591u, 2915594808u, 3193053797u, 3103490367u, 2893876952u, 791722516u, 2759950240u, 2647310599u, 1060814304u, 1104815755u, 3283917665u, 954167246u),
+    SC(3633439037u, 1737408037u, 3240746577u, 2032524778u, 210349431u, 1157873376u, 3552462955u, 3068823u, 2593869163u, 1645741574u, 2624282012u, 1595174943u, 3150496822u, 2635369792u, 3670346328u, 1317499755u),
+    SC(3066163224u, 734815666u, 3189326611u, 2603442644u, 551273493u, 3201260612u, 896218759u, 1203901890u, 3082479753u, 4206490018u, 1615910957u, 3112412856u, 3354260034u, 1776181406u, 227950091u, 2452682654u),
+    SC(2235295503u, 3336503999u, 656069002u, 1855251063u, 1400966644u, 100804460u, 3316705750u, 794158471u, 3220130150u, 1524496317u, 4024763824u, 915138624u, 1872936127u, 829155670u, 1406327784u, 3285915916u)
+},
+{
+    SC(3539989726u, 2664422354u, 3717852078u, 3493347675u, 431408204u, 2534904428u, 166307432u, 1071633271u, 2817060747u, 2307358268u, 3433391820u, 2071844151u, 219511979u, 303896099u, 3062367591u, 2892429963u),
+    SC(4169968731u, 2129799654u, 437437237u, 369342547u, 1225909990u, 105177072u, 378686654u, 1403688950u, 3897807924u, 3252342965u, 1215424641u, 560413328u, 1897408132u, 317929004u, 3828647679u, 1630564758u),
+    SC(2120346993u, 1574861569u, 4055542703u, 3156063114u, 2155135979u, 3395705935u, 3607950162u, 1649229112u, 1891339524u, 2871189526u, 475543260u, 4035849276u, 919486311u, 4103998043u, 2581732188u, 3337457769u),
+    SC(2650342494u, 2112594502u, 300482146u, 4214370423u, 3712572735u, 2394678491u, 944484075u, 2859174140u, 1298074617u, 4123981874u, 2931863188u, 4060402101u, 408241016u, 1141274074u, 2343754010u, 2412599648u),
+    SC(1561545950u, 3513590208u, 46110254u, 2131948246u, 1318148204u, 2154872738u, 1632214749u, 3758828119u, 3082206346u, 1424038120u, 2361241545u, 845137641u, 307971779u, 1724404993u, 861282060u, 1237934782u),
+    SC(2774909901u, 771645224u, 1285073837u, 2193431137u, 1992145786u, 1323638656u, 695741715u, 2225025760u, 1506694954u, 4281622541u, 648809495u, 1264275594u, 2179049970u, 2134563430u, 1143161913u, 1676304803u),
+    SC(146493114u, 1026262009u, 3602767471u, 2183478058u, 1903997235u, 4037497130u, 232766761u, 3333583275u, 4037065903u, 338762279u, 3658077565u, 3465013868u, 2987748329u, 1503145496u, 1553131083u, 2250198737u),
+    SC(2341715858u, 2700579248u, 3859696179u, 2395756825u, 1875611477u, 3083700335u, 3413235310u, 1368601544u, 2011324934u, 2489277894u, 3393073269u, 1479863073u, 1546719681u, 1270920228u, 832404816u, 4096637834u),
+    SC(3098090164u, 3937526885u, 3922595589u, 3117243593u, 3619511456u, 687964457u, 2049777986u, 2737216841u, 904576627u, 2497431372u, 3782524472u, 2176150332u, 3538905622u, 1249874595u, 386091287u, 597337724u),
+    SC(653517061u, 2613638042u, 3043803086u, 3430911227u, 3939946327u, 3394071887u, 1634025406u, 422896314u, 2056719107u, 2825344479u, 4064697313u, 3122017483u, 3752686726u, 3984230999u, 2989927946u, 36279219u),
+    SC(2977387875u, 1756856293u, 2305658602u, 3898809838u, 2022534013u, 3053356239u, 1719149320u, 1006974664u, 3980567886u, 911250528u, 3970581037u, 4208855094u, 2375475175u, 3461024498u, 4207299460u, 172606632u),
+    SC(2123341088u, 2610619360u, 3636249805u, 2405928311u, 194895330u, 4166746397u, 1666551241u, 3089845290u, 830253287u, 1769367456u, 492844122u, 2898915009u, 1465071417u, 1748645392u, 3136192983u, 3149049830u),
+    SC(182090295u, 2773063932u, 2875617227u, 2014878906u, 4034576690u, 3504190878u, 648632813u, 578906269u, 3395653562u, 3622802446u, 1642118462u, 1105217635u, 3484288771u, 4187487776u, 3066363798u, 3248936252u),
+    SC(154149828u, 3967951687u, 1435057545u, 77065166u, 3232269485u, 3912916706u, 592527655u, 4277917673u, 3417904405u, 3905839920u, 1437307359u, 2532079592u, 1386597940u, 4043192840u, 828125384u, 1712244674u),
+    SC(4144828863u, 1262971610u, 2738002832u, 3848745747u, 554156666u, 3660926287u, 1405749523u, 293551868u, 956195932u, 2061195588u, 3476646641u, 1003448777u, 4182963546u, 1462193925u, 2827901865u, 1370898532u),
+    SC(287054389u, 4206061741u, 3909899140u, 2957058664u, 2712205523u, 1231432323u, 1252507865u, 2198483068u, 3163354130u, 595880373u, 2050058791u, 535083586u, 4093274722u, 251534866u, 1425149793u, 2349787856u)
+},
+{
+    SC(3015000623u, 325176924u, 3212623969u, 1014540936u, 2686878702u, 3453922035u, 257234635u, 689320672u, 395365200u, 3425465866u, 3351439740u, 3293249321u, 2261203941u, 1504215424u, 2365812346u, 2486464854u),
+    SC(2802351214u, 1019547153u, 1581443183u, 2237644987u, 2316167912u, 1277137594u, 922833639u, 1775757119u, 2259030628u, 3320484395u, 3474839377u, 3039388985u, 3157017009u, 701728799u, 45087422u, 1375130067u),
+    SC(1408178651u, 332882372u, 2572930650u, 1429622838u, 3740348959u, 3769865143u, 1102404486u, 2395773863u, 2055053046u, 1642858333u, 434575788u, 1458579645u, 1077283311u, 3435370625u, 412513198u, 1108997u),
+    SC(166351317u, 1290556120u, 1492697218u, 3828755332u, 1787027698u, 2627329842u, 818520792u, 3844511768u, 1093689215u, 2840813230u, 4268955351u, 1793367442u, 1197897289u, 1467402002u, 558600125u, 4039642298u),
+    SC(2618143148u, 4195387407u, 3571081448u, 176847982u, 3021045559u, 2151239299u, 4216918791u, 349987936u, 1438071630u, 2148079477u, 510134808u, 1844452199u, 3473619148u, 3775643892u, 3701006526u, 2069649956u),
+    SC(2536827719u, 256373429u, 82685205u, 2031847695u, 1685669223u, 3749398630u, 3100433967u, 2559626296u, 2614261735u, 2095898325u, 2650411530u, 4139725354u, 2433652522u, 1465137472u, 3074463995u, 2942034210u),
+    SC(950856594u, 2511634642u, 447889167u, 3271534101u, 3998181635u, 850059409u, 1500318444u, 2845728509u, 2319192144u, 1285732158u, 3307511706u, 1860111207u, 106597122u, 1317987028u, 3909997475u, 2833499319u),
+    SC(197466102u, 106471666u, 3969627291u, 425148315u, 2088018812u, 3287551129u, 2083642145u, 386904296u, 2967132086u, 417456225u, 2418726206u, 2685222098u, 3920069151u, 388803267u, 1008714223u, 4223482981u),
+    SC(1730602173u, 1587573223u, 1136504786u, 801576255u, 1239639300u, 3897044404u, 2640640405u, 3098571739u, 2095045418u, 1782771792u, 2216047065u, 2006450887u, 1019963460u, 450135304u, 1704523436u, 4178916267u),
+    SC(3045516080u, 2837283309u, 3652809443u, 3617799274u, 2953845221u, 1870697859u, 1987277049u, 671334013u, 2347392220u, 1637733040u, 408564290u, 531095235u, 1714215546u, 2668823252u, 4291679007u, 1499030154u),
+    SC(1785804164u, 3771923969u, 1688952513u, 4078905240u, 4219818381u, 2140263698u, 3560443409u, 1027592498u, 981877075u, 1273450409u, 1808708945u, 366130160u, 1509712333u, 1419790056u, 3592515372u, 1023304152u),
+    SC(689558936u, 2052202277u, 1573780309u, 1046114431u, 1768897198u, 1193436549u, 613072153u, 961650488u, 3203433527u, 2587127126u, 2088764244u, 3898254742u, 1779313411u, 2448405043u, 2102013432u, 2635393468u),
+    SC(2025692259u, 905848568u, 1759010770u, 1792571870u, 4118995060u, 266283808u, 4139640706u, 3438115348u, 2780184652u, 3445643695u, 656585512u, 181166262u, 2272629776u, 370943424u, 1751557846u, 2309122167u),
+    SC(267180733u, 424783777u, 1080203254u, 2661909603u, 1424050736u, 3737445342u, 2397112235u, 1140319020u, 3540605726u, 1560404816u, 714090654u, 3305695922u, 4001926073u, 4235374954u, 2250613806u, 603974704u),
+    SC(244840167u, 1554020100u, 3702066775u, 2862773506u, 3785435454u, 3651035430u, 218349583u, 1404753202u, 3766478445u, 2586133471u, 1533117238u, 4149938439u, 2210912076u, 3594357012u, 575816505u, 525962129u),
+    SC(4146528898u, 2136081288u, 1410528199u, 2682243562u, 3659634297u, 3884779676u, 1276188622u, 3650143718u, 2534539131u, 69352587u, 4188728680u, 4144009400u, 528573366u, 1948891771u, 2778384350u, 3961787045u)
+},
+{
+    SC(771871546u, 3238832643u, 2874232693u, 1176661863u, 1772130049u, 1442937700u, 2722327092u, 1148976574u, 4122834849u, 744616687u, 1621674295u, 3475628518u, 2284524224u, 1048213347u, 4058663310u, 153122870u),
+    SC(2125145888u, 3034373129u, 148397811u, 141146887u, 2520820550u, 761993323u, 2298029094u, 2891332110u, 2829144983u, 2531560926u, 2167918181u, 3311166313u, 1986747894u, 2110826144u, 1833688282u, 2697250572u),
+    SC(3869871954u, 4004844136u, 2445592287u, 191554676u, 1824322074u, 1934754654u, 1806989779u, 631655906u, 1640478312u, 3779394326u, 3878618879u, 1897296401u, 116845712u, 1282189569u, 1638341398u, 253193742u),
+    SC(869049848u, 3185853214u, 1086566153u, 574813225u, 768296876u, 2336838903u, 1037196762u, 3581040974u, 1545806877u, 1185761684u, 533220394u, 2594450382u, 518321105u, 3416686830u, 2271268151u, 3918676320u),
+    SC(3856331543u, 2684505765u, 649861433u, 2052378851u, 4281491040u, 1056350427u, 1268888422u, 3791019043u, 2372988231u, 1754646015u, 3964172838u, 3080977165u, 1940074122u, 2762476976u, 3389041795u, 1131517310u),
+    SC(1630655860u, 1949945516u, 3883647184u, 3029959080u, 1311781856u, 408642488u, 2800393690u, 3410356207u, 115351401u, 3420630797u, 2709679468u, 2872316445u, 1790203899u, 1997501520u, 3278242062u, 551284298u),
+    SC(2323279372u, 1575922229u, 4047150033u, 1372010426u, 3148623809u, 2453870821u, 2339486538u, 2280451262u, 2466099576u, 2994948921u, 132102763u, 1776872552u, 3906687848u, 1416385780u, 2716658831u, 3839935313u),
+    SC(1482060017u, 4064599659u, 4201421603u, 1862488009u, 1206323034u, 1506270647u, 4148487892u, 2940354206u, 221477839u, 2184047858u, 1052602625u, 1800724448u, 2376949890u, 1248004043u, 4042069004u, 1001474649u),
+    SC(1973975072u, 2109156381u, 895285550u, 2806725496u, 4257596779u, 2294716595u, 2126073388u, 4029509053u, 2287557214u, 3863235224u, 910675328u, 3403565516u, 2460443864u, 4145068647u, 1675629270u, 2972605807u),
+    SC(3067953236u, 2487048107u, 1053067642u, 2406833819u, 1120120518u, 2019615106u, 2151977185u, 2444444329u, 3698388134u, 2675794597u, 2346696087u, 3691916163u, 416413840u, 2548582733u, 2519917531u, 3323365251u),
+    SC(4258867839u, 1450083676u, 3423817219u, 2338254228u, 956448310u, 2038800503u, 2270893323u, 23474499u, 4001071451u, 434241187u, 4225947271u, 3009484949u, 1212186223u, 3021170789u, 3408787844u, 4241328442u),
+    SC(544425045u, 2335106449u, 1970249987u, 676962447u, 2451092807u, 3397085111u, 644609608u, 622894566u, 3012162452u, 742316904u, 1183695331u, 1942632009u, 3993963459u, 2025380463u, 2934502595u, 2424729664u),
+    SC(489227787u, 2064607364u, 749046162u, 1223089239u, 4103152782u, 944881113u, 2156101348u, 2809656549u, 2750173639u, 2290439348u, 455194332u, 3662094961u, 2388553957u, 2373693996u, 3087294434u, 714908241u),
+    SC(844100070u, 1293873339u, 240400805u, 2741251793u, 4185619158u, 3756747900u, 2600026127u, 4095003808u, 2551250677u, 1982555415u, 1538344606u, 2598805396u, 1759235723u, 1251966u, 1750681115u, 626531732u),
+    SC(3996016258u, 3876613311u, 1191787057u, 3901742282u, 1577096572u, 270596184u, 3165567618u, 4061944625u, 3613068329u, 3912630805u, 2056061785u, 2568706449u, 2343664228u, 1807908509u, 1314728487u, 1028342757u),
+    SC(2729604648u, 2866824008u, 1921075953u, 959207538u, 460881358u, 1786258799u, 989199155u, 1140694999u, 3534517067u, 1671080238u, 1077292982u, 69981150u, 2456995550u, 2177711190u, 3355630373u, 505438766u)
+},
+{
+    SC(2470971363u, 1622646280u, 3521284388u, 611900249u, 53592433u, 1667691553u, 3986964859u, 3228144262u, 4160240678u, 1357358974u, 796266088u, 2135382104u, 2999113584u, 425466269u, 866665252u, 3795780335u),
+    SC(1943673032u, 163567132u, 2998325065u, 4151760187u, 4286963295u, 2037110896u, 4023804057u, 2843670454u, 4267379728u, 470850548u, 1360194572u, 542908383u, 117354082u, 3909600634u, 3301531838u, 585104523u),
+    SC(421763950u, 3621776882u, 1804759030u, 1922063749u, 28357531u, 2718763721u, 3528327041u, 2594458380u, 1745913977u, 1705774731u, 3785007083u, 1889010688u, 4275556992u, 2808027536u, 1706627542u, 967259307u),
+    SC(3761989171u, 2069950976u, 953323220u, 30139149u, 3360357391u, 466334029u, 1085748790u, 717259079u, 3822910993u, 1348849055u, 4159668773u, 3924702853u, 4257335520u, 1714446370u, 3394938265u, 2541598048u),
+    SC(2132231371u, 3951042779u, 332537683u, 2179456991u, 3112576172u, 2873883577u, 502046554u, 4014018248u, 4272356370u, 2124475345u, 3140973257u, 1234959848u, 3468807232u, 3812306463u, 2768101189u, 3493652974u),
+    SC(2983624056u, 158967077u, 546553405u, 3473936990u, 3742593866u, 3986716933u, 2905591308u, 285301696u, 2640868047u, 3062221467u, 70156428u, 150492378u, 3977001273u, 1087159682u, 1233481348u, 3391921638u),
+    SC(3432795737u, 4256529583u, 3151717298u, 4190687875u, 1563633254u, 158068428u, 685294219u, 733826550u, 2829744078u, 4225504275u, 2375584227u, 1429440840u, 2192098666u, 1015042413u, 840775854u, 41702830u),
+    SC(3231767315u, 1865273494u, 1093659663u, 1873962287u, 1664376931u, 1435837948u, 31100007u, 316783664u, 996300708u, 334486049u, 1648124912u, 3615910102u, 2480590997u, 2253624363u, 548978494u, 3975730498u),
+    SC(1923874249u, 3947343158u, 2264687656u, 1121555015u, 3593673308u, 289357572u, 3048054908u, 3707221766u, 2043411687u, 1708537123u, 3350208529u, 2939237811u, 2793137666u, 3370678100u, 1405378414u, 2235087472u),
+    SC(139882711u, 1304366355u, 1276034712u, 2139658031u, 2197726287u, 3663457902u, 2357615523u, 1611719773u, 2323318078u, 260257531u, 2850134214u, 3099029628u, 553263652u, 173876122u, 2118167747u, 1771928540u),
+    SC(566458485u, 3545725305u, 2257836680u, 2245189792u, 1605297549u, 245844769u, 2016071772u, 1896412522u, 821618527u, 1870442187u, 3958912319u, 4032980189u, 2069248247u, 4226059888u, 3345680132u, 1791157180u),
+    SC(4148097755u, 2486537082u, 4003164230u, 2318687306u, 2491702264u, 229564758u, 4126839602u, 211561653u, 3452304873u, 2572510204u, 1630441069u, 3167885411u, 4175966562u, 1295680948u, 161732432u, 107333173u),
+    SC(1923252062u, 311708286u, 1678166990u, 3717252154u, 3161198614u, 1069601573u, 4091259962u, 359278439u, 3768419820u, 2520693990u, 650972975u, 383288062u, 1217231824u, 2559091429u, 4278580592u, 2250271391u),
+    SC(510621576u, 1629846927u, 3397488683u, 961386517u, 653633283u, 1754007094u, 2769834941u, 2247122605u, 2701964981u, 3912616774u, 3406969249u, 63999109u, 3141040146u, 2619453260u, 1468121925u, 4171492447u),
+    SC(3961993547u, 1155134029u, 1496861029u, 1279080034u, 2846121209u, 3483514199u, 2468398271u, 505281559u, 3532558643u, 2311328115u, 2310583909u, 3085705085u, 2999958380u, 2683778623u, 32663880u, 1366954658u),
+    SC(3799286526u, 1580228485u, 2766986278u, 586308614u, 2894037718u, 587959438u, 1301020570u, 2323176208u, 3827747523u, 2955860540u, 455053544u, 124753776u, 703403555u, 1658788582u, 3867772588u, 3276199889u)
+},
+{
+    SC(2899222640u, 2858879423u, 4023946212u, 3203519621u, 2698675175u, 2895781552u, 3987224702u, 3120457323u, 2482773149u, 4275634169u, 1626305806u, 2497520450u, 1604357181u, 2396667630u, 133501825u, 425754851u),
+    SC(373198437u, 4218322088u, 1482670194u, 928038760u, 4272261342u, 1584479871u, 2503531505u, 354736840u, 303523947u, 2146627908u, 2295709985u, 233918502u, 3061152653u, 3878359811u, 3090216214u, 1263334344u),
+    SC(2076294749u, 898460940u, 2754527139u, 2099281956u, 3551675677u, 4195211229u, 3603181913u, 1984445192u, 1121699734u, 573102875u, 2187911072u, 656800898u, 1477748883u, 3685470532u, 3965328576u, 4253954499u),
+    SC(1876288412u, 2267864341u, 434083874u, 1779401913u, 2781669786u, 3073195348u, 669142308u, 3636028767u, 127310509u, 372075961u, 2537369503u, 2705808591u, 971889633u, 2718294671u, 1415139024u, 276903675u),
+    SC(3596445084u, 2918342013u, 1827011883u, 3900260359u, 1783558754u, 1921301616u, 3293933601u, 1111091218u, 3238604202u, 967515902u, 1208493040u, 1614341552u, 903992012u, 480937886u, 28823639u, 2379076161u),
+    SC(1968094521u, 1600813704u, 2958098796u, 909224758u, 1752381729u, 3115930502u, 3643078327u, 2863416031u, 2510423171u, 2162796973u, 1796627662u, 3678673773u, 239312629u, 2457874359u, 3809753210u, 2494718541u),
+    SC(1731463174u, 4265769542u, 194787641u, 1036371942u, 1745836602u, 660344840u, 1082796561u, 3963871960u, 4001246025u, 3118794916u, 3886266100u, 1928084049u, 3032262555u, 2306541818u, 3921311698u, 2426451176u),
+    SC(4018285402u, 658949239u, 1329629679u, 2738829796u, 776877685u, 1774949833u, 2797031752u, 3236392582u, 2542061420u, 1832249084u, 183211998u, 1840198657u, 1314474881u, 3361925365u, 3440999944u, 974653576u),
+    SC(1671164742u, 4271520021u, 1517391404u, 3289979834u, 1233503784u, 3050636514u, 3728319521u, 2919957525u, 3518724155u, 1272537958u, 3303667759u, 3864284110u, 234069183u, 1495943844u, 1989482539u, 3056780355u),
+    SC(1575547612u, 2187321001u, 2701011625u, 2761636008u, 1864623673u, 3995428494u, 1950725639u, 3749309698u, 2711714857u, 3743669273u, 3222519898u, 621366782u, 2554696188u, 176315043u, 1467854493u, 1806812435u),
+    SC(1182422499u, 3354985654u, 814715964u, 4226927046u, 3360200226u, 2503195953u, 1526762508u, 3747376732u, 1505823655u, 3718914053u, 2708056196u, 1868291203u, 1664951819u, 1982491563u, 751360443u, 1075645602u),
+    SC(101076600u, 386741863u, 2955045918u, 1653351871u, 1070602553u, 321875967u, 3200546966u, 2632915072u, 225765461u, 1759013254u, 4169466720u, 3880757831u, 1769634729u, 2642211393u, 4245887731u, 3909815727u),
+    SC(2379322656u, 1554830911u, 1971754317u, 1058862290u, 623917994u, 2775317172u, 3261049248u, 1667374591u, 3883068608u, 3752131736u, 2607464936u, 1251402973u, 4056909038u, 937468613u, 309280197u, 1804321090u),
+    SC(395093976u, 2154850233u, 624748058u, 3473623511u, 530005996u, 1656467301u, 451942772u, 3238178099u, 691726480u, 2563588439u, 3675387583u, 3294893253u, 1205949092u, 3844564019u, 114533547u, 4193437592u),
+    SC(1241354591u, 1121646490u, 1686974686u, 3373490541u, 1189649937u, 2948191343u, 2978671156u, 3827318062u, 3377194192u, 3805066092u, 3271994064u, 2484020181u, 549626522u, 1166583694u, 3299399570u, 764854172u),
+    SC(2808929206u, 427994673u, 2338143204u, 3942895356u, 2304289727u, 1468778908u, 1350679341u, 3972686632u, 2399853022u, 2097821409u, 3799931826u, 2500883276u, 1352425312u, 3372587055u, 596007302u, 2017539287u)
+},
+{
+    SC(172527491u, 737404283u, 1378219848u, 1967891125u, 3449182151u, 391223470u, 304889116u, 3996348146u, 1311927616u, 1686958697u, 766780722u, 1429807050u, 1546340567u, 1151984543u, 3172111324u, 2189332513u),
+    SC(3269764283u, 1288133244u, 1314904801u, 996741356u, 1884733412u, 1544206289u, 558284137u, 1518251699u, 1924323147u, 1635892959u, 1275016917u, 3776324356u, 1705865502u, 202621081u, 499067715u, 3311904259u),
+    SC(2660619816u, 3307703068u, 1451637465u, 3851776926u, 2364760323u, 1977782632u, 1515607226u, 1445106389u, 2327693248u, 2319920969u, 1115274896u, 1834441597u, 402374626u, 1205432354u, 1396686295u, 491780324u),
+    SC(1996097434u, 731516361u, 974312078u, 3421366629u, 3812294134u, 3978884039u, 3352635742u, 1797690428u, 13489496u, 1642706934u, 3128398168u, 106641350u, 4016459895u, 2470770670u, 115922099u, 2925890710u),
+    SC(2686884812u, 2748914055u, 1937433663u, 756783569u, 413219250u, 1566264233u, 3400883298u, 1726270584u, 1877719428u, 1988282262u, 4210071735u, 1623567192u, 186026227u, 1235988261u, 878101455u, 3591361377u),
+    SC(4053231115u, 4124107153u, 3534184341u, 1110486344u, 81952807u, 4125498697u, 1693462482u, 2990125452u, 3439709895u, 1055710168u, 4246237022u, 1943085528u, 719511299u, 700284484u, 1082914808u, 1529874921u),
+    SC(1481485493u, 1935423659u, 913226612u, 2395711383u, 1541429099u, 2771316424u, 3338417471u, 399999946u, 26796724u, 1562275554u, 2290450886u, 1574607684u, 2722372873u, 1229315759u, 1998792801u, 1299123352u),
+    SC(3949810665u, 1328858449u, 2680298883u, 4060684833u, 1165923991u, 2656262528u, 835037267u, 1633040358u, 3109606689u, 3612027263u, 1850965274u, 2501035455u, 1956880692u, 2989837601u, 2991272131u, 514909703u),
+    SC(3542886422u, 2995653583u, 3564619313u, 2091503271u, 1371789218u, 2765269616u, 3068810600u, 1666719265u, 2118314133u, 3335278251u, 3361418207u, 807286765u, 899334530u, 3994904643u, 2747385847u, 3528707340u),
+    SC(3132681349u, 3533155425u, 2330764867u, 3555018576u, 1500828005u, 1243623897u, 1071818853u, 2130356426u, 4099162373u, 1333917673u, 445413180u, 915835391u, 3998951530u, 3932499234u, 2014496944u, 1476384528u),
+    SC(2104877156u, 1430391164u, 3607724722u, 2456386351u, 3275987562u, 653382938u, 360082336u, 281545563u, 2556998173u, 802173963u, 1898654040u, 2873697709u, 3526274706u, 30023701u, 1532464389u, 335648001u),
+    SC(1216717657u, 3420164715u, 1026103527u, 2814363815u, 3399248527u, 2265457834u, 4230549954u, 3191596424u, 2096767009u, 197782440u, 661821193u, 3129199915u, 3603027595u, 571989255u, 3350141303u, 902722054u),
+    SC(86788496u, 2319129483u, 1051755765u, 871757145u, 3910221139u, 2373267495u, 991927221u, 3506242540u, 2918237538u, 555183593u, 3050652275u, 2550066259u, 1935622924u, 1141386013u, 1915989302u, 1193809339u),
+    SC(2961067645u, 912271025u, 3829956364u, 976054309u, 2426360429u, 3756714048u, 860863671u, 2976390123u, 651422564u, 3348472580u, 4062622529u, 3566918328u, 1262646615u, 526922344u, 336090107u, 3690353753u),
+    SC(1104160934u, 638409761u, 4090697585u, 3951520784u, 412890746u, 3037968225u, 623962484u, 1861465265u, 4172453316u, 2731726287u, 468253494u, 2636411583u, 2233875405u, 976659501u, 1885152597u, 441456529u),
+    SC(228814647u, 3127034711u, 536841111u, 970423620u, 335496573u, 1496573821u, 3839638808u, 2076574157u, 3960354230u, 1830746438u, 2136594363u, 1397484405u, 335074021u, 421124372u, 4043995000u, 1296743377u)
+},
+{
+    SC(2759056966u, 2773771898u, 915395955u, 378399267u, 1065424189u, 3786627878u, 2430240867u, 1910948145u, 1268823138u, 2460932406u, 2049702377u, 3729301642u, 2270156417u, 2935515669u, 1488232015u, 333167852u),
+    SC(3963231590u, 2717344665u, 3330507643u, 2069094492u, 1576271806u, 844971343u, 3725773593u, 3293220801u, 1933125411u, 1106657228u, 3650404527u, 3511000962u, 3309805512u, 23235466u, 884265026u, 3867812812u),
+    SC(2380535986u, 2007649740u, 291610222u, 4151143005u, 2330231880u, 3336494284u, 4079710776u, 3045731925u, 300175272u, 1753290057u, 2323446107u, 2448133203u, 1897525100u, 62520621u, 938748110u, 2483424933u),
+    SC(3941565796u, 4020457560u, 536627435u, 849338423u, 1622694903u, 2253013822u, 1890968103u, 2458058141u, 2431563444u, 3273994144u, 2920282564u, 2871620844u, 315460419u, 2331615405u, 105614140u, 3825521500u),
+    SC(1770365960u, 436268948u, 2889892729u, 3688514673u, 3952720709u, 1774783907u, 605504449u, 2947048934u, 38294098u, 846447109u, 2199988078u, 482652009u, 58745901u, 1043251865u, 1692020085u, 2977904741u),
+    SC(3749156389u, 3930496686u, 342096417u, 2961755248u, 1791611872u, 2622150301u, 1430397623u, 2049694734u, 1457522946u, 1307567328u, 1594457791u, 2920040322u, 2838823131u, 3221083429u, 2327375059u, 307491364u),
+    SC(439175999u, 704562179u, 1530705937u, 343762620u, 1895613568u, 82869187u, 23704978u, 3831637605u, 1611450850u, 923617677u, 3571146990u, 2520538539u, 2376639038u, 2377370369u, 3624250410u, 3615349574u),
+    SC(764309941u, 395778606u, 890380761u, 1156064327u, 244397938u, 560614464u, 4033284221u, 1090955901u, 3643294611u, 2912576497u, 772374999u, 2861631454u, 564730390u, 3124994653u, 646536012u, 3616789797u),
+    SC(3040822479u, 2767342245u, 2776280569u, 3485527708u, 3592541314u, 980436690u, 2153312390u, 215781809u, 2169043418u, 2501125521u, 3698439429u, 3999324854u, 2793459908u, 501030861u, 3583683133u, 3712651293u),
+    SC(4078810936u, 708788696u, 3557269243u, 3488736225u, 3893932756u, 4164798985u, 1241795187u, 3595203666u, 2393791384u, 3416169943u, 714289829u, 1522223608u, 2613922570u, 3640037692u, 3871460094u, 693107847u),
+    SC(2095442944u, 4280954881u, 166522183u, 982064125u, 4072843681u, 2413289870u, 966372633u, 3054322365u, 3306439070u, 657208192u, 175957468u, 411297739u, 771116169u, 1596617487u, 3454202820u, 2489020407u),
+    SC(1474971529u, 4158663721u, 2047384831u, 2598838221u, 256974012u, 2456523417u, 631366020u, 3323296862u, 3331748634u, 1360209248u, 3346726166u, 365777010u, 1290850614u, 2085594058u, 2979720197u, 2832663037u),
+    SC(1555709774u, 2326491405u, 2273744879u, 2585453209u, 2182701308u, 3405285511u, 2624534747u, 1273093088u, 862771016u, 2571185727u, 2627816705u, 753650915u, 1122934423u, 1670176575u, 3747348599u, 2369664950u),
+    SC(90900628u, 2102730721u, 781890942u, 2802660398u, 1018645876u, 4115262915u, 4149550831u, 3399458752u, 3886843346u, 2763694604u, 1310436099u, 1905281291u, 3814148817u, 4190880658u, 4069475791u, 3679310561u),
+    SC(2090876031u, 2877257381u, 2723690078u, 1430728835u, 1519931567u, 1820574481u, 3028789440u, 1269332520u, 487867652u, 423473929u, 386546855u, 57358783u, 1188070806u, 1428826466u, 1782333616u, 177182180u),
+    SC(1560550296u, 3093603077u, 293048812u, 568213435u, 3420818052u, 2217333393u, 3134601365u, 71485947u, 1184987600u, 3737951852u, 162939585u, 1604396734u, 102336303u, 398862141u, 820178097u, 490472018u)
+},
+{
+    SC(1198357412u, 890731121u, 697460724u, 351217501u, 1219769569u, 940317437u, 2678867462u, 4175440864u, 2131908090u, 1470497863u, 3243074932u, 494367929u, 1767796005u, 457609517u, 3543955443u, 4149669314u),
+    SC(3330984275u, 2556191310u, 3686726368u, 344917147u, 3386773283u, 2065247867u, 3908122913u, 3695674005u, 2012204991u, 2693522884u, 103992040u, 209624682u, 1376640025u, 3686868767u, 2902487256u, 913177313u),
+    SC(51667624u, 2920015049u, 3017253519u, 1071812123u, 2571723173u, 2160964558u, 1290623835u, 537361271u, 825729747u, 1392761590u, 1142623949u, 609149740u, 478665972u, 658807909u, 3553467330u, 1636424506u),
+    SC(3616504574u, 1808500084u, 668829693u, 946464586u, 1979729368u, 406956181u, 4175922839u, 412791377u, 2386664246u, 1192624407u, 2943858119u, 2548487829u, 1705793661u, 3457595727u, 202485393u, 1924721832u),
+    SC(2189382710u, 4186169698u, 1109472631u, 1983920883u, 3607145598u, 92147950u, 1402492489u, 429006982u, 2674194346u, 4283195956u, 1593180543u, 3760708566u, 643378372u, 4031840072u, 3394015175u, 1558737750u),
+    SC(1805700700u, 1754525187u, 1654624487u, 2216136944u, 68436239u, 2233918826u, 2968997668u, 4123197178u, 634669625u, 2517670383u, 3007433093u, 3522650191u, 696793327u, 1110232330u, 152147442u, 726198231u),
+    SC(742639492u, 3149716575u, 880320409u, 4630949u, 1505653181u, 1071542118u, 3069898832u, 2578767084u, 1314905164u, 2213468220u, 3680194608u, 2445142726u, 2802637025u, 3977804516u, 1184600151u, 419058566u),
+    SC(1336605659u, 403108152u, 2724587657u, 3679190711u, 2874389193u, 1647236788u, 3333657299u, 528273159u, 3515102004u, 947876802u, 3658623910u, 174276546u, 653934448u, 3828171172u, 1444811038u, 2933240663u),
+    SC(339431464u, 3233735983u, 2646677300u, 43177515u, 392637796u, 1436471495u, 1239428896u, 2348305406u, 2289915967u, 3084305790u, 3250948245u, 178888356u, 2146779246u, 4234024427u, 1032696742u, 3905672369u),
+    SC(961540617u, 2841143833u, 962675692u, 4171962245u, 2791421965u, 2368576296u, 3328980779u, 2916707843u, 1558316022u, 134331787u, 2460382133u, 1215270659u, 146717643u, 3198704598u, 2091590890u, 2460305557u),
+    SC(1042706599u, 2034894580u, 690504458u, 2345543782u, 4005260856u, 2432547988u, 112379796u, 3543073874u, 835904670u, 2590827554u, 918469413u, 3408148837u, 1789043194u, 1729294718u, 1834822488u, 2928788408u),
+    SC(3301658713u, 837504950u, 1727706187u, 1845900341u, 896114239u, 2352826711u, 3111232113u, 2017659422u, 2679415011u, 2370224692u, 3953323203u, 2250773775u, 1103871456u, 1933857783u, 3328123972u, 3307902309u),
+    SC(1767706194u, 3006067357u, 35851140u, 3240494485u, 2221989856u, 1899667734u, 6385932u, 2363969169u, 4105037265u, 1831329288u, 2027489194u, 884350865u, 1094001278u, 159320441u, 4110377537u, 68569781u),
+    SC(1525490260u, 665735034u, 2452169880u, 171203360u, 1236274187u, 676156893u, 1374080130u, 357190845u, 1839504596u, 1514713169u, 4060710869u, 1096636593u, 2588809028u, 3627704311u, 1809407212u, 476953361u),
+    SC(957000182u, 26105440u, 3440739633u, 2098069989u, 1584380370u, 2860012851u, 1732766592u, 212521659u, 3179187407u, 887560394u, 2490695882u, 2732057577u, 1018218231u, 3635922188u, 2062474881u, 2513446682u),
+    SC(1107263183u, 578424674u, 37103195u, 466969755u, 2523291988u, 291121216u, 3279675483u, 2003600853u, 4199013737u, 2715326244u, 4169142308u, 3686083459u, 3512922856u, 3093381668u, 1195683747u, 1393205701u)
+},
+{
+    SC(1331866444u, 3086683411u, 308412705u, 2554456370u, 2967351597u, 1733087234u, 827692265u, 2178921377u, 289799640u, 3318834771u, 2836568844u, 972864473u, 1500041772u, 4280362943u, 2447939655u, 904037199u),
+    SC(2575383612u, 3753748540u, 2811819999u, 1587868018u, 1038431720u, 790984055u, 3731301644u, 1846621966u, 951964491u, 415041564u, 2200992348u, 4272384400u, 296027191u, 4287888493u, 2854418940u, 3573682726u),
+    SC(1970740379u, 2607713160u, 3470587124u, 930264002u, 1173824281u, 122965335u, 3335069900u, 326806848u, 3632692886u, 129472919u, 3226625539u, 2728837633u, 416887061u, 1130551300u, 356705234u, 1369994655u),
+    SC(4223755401u, 2079062379u, 3389104769u, 4073338565u, 3689225172u, 440818499u, 856809827u, 381405275u, 127244068u, 376610605u, 2598268701u, 2534766433u, 2820385475u, 4294123141u, 330930335u, 318185845u),
+    SC(761419527u, 3536226585u, 2328998689u, 3591334816u, 1578134205u, 1103093801u, 3418753973u, 3588283844u, 1530820786u, 2684864777u, 924992522u, 3557568163u, 1869705595u, 3313643247u, 841618349u, 1632346896u),
+    SC(3475240082u, 1688964704u, 2950217939u, 2829510968u, 4218043142u, 1723444205u, 599182149u, 3585292920u, 1201476124u, 1461631424u, 3796636907u, 3015591958u, 325310290u, 4221903599u, 2685464188u, 843835594u),
+    SC(3270571096u, 3849271420u, 2838244847u, 4029431364u, 3703574760u, 3266810236u, 1964057057u, 1045028730u, 3535646880u, 4117469088u, 268273252u, 28527135u, 616206627u, 3498685014u, 1783632491u, 2430589238u),
+    SC(1270864764u, 2335784868u, 3187652054u, 3487500065u, 3514696661u, 4279511860u, 2691960889u, 1283768022u, 3239440117u, 3088430000u, 3270700109u, 2562105500u, 920167200u, 797042551u, 4008345612u, 1713652205u),
+    SC(1233553764u, 2449552413u, 3139739949u, 2886523083u, 3648218127u, 435238208u, 231513377u, 3598351734u, 1003225207u, 1550611030u, 4262337852u, 2819804714u, 3244463273u, 2073740987u, 855086785u, 975917304u),
+    SC(2715954175u, 3495328708u, 4029028922u, 3684471179u, 2815956881u, 3599669751u, 4163140273u, 33191313u, 2635890672u, 3683103094u, 1579697202u, 287936530u, 2496546027u, 832886459u, 1241267398u, 3564329642u),
+    SC(718666875u, 1628061148u, 3834972005u, 11037458u, 3790987439u, 2312775807u, 3375415349u, 3089087440u, 2679862136u, 918687461u, 3176925215u, 1435039099u, 1342114588u, 1906963252u, 3488735014u, 1611160706u),
+    SC(4216184459u, 1084561028u, 249927207u, 3584932419u, 1355984265u, 990857900u, 1870305536u, 582023708u, 1966962179u, 1733088207u, 1190083164u, 3785297292u, 1004947745u, 1784159416u, 1841702516u, 180335137u),
+    SC(4084089742u, 2441136551u, 426220168u, 1375299216u, 1841338030u, 1250354698u, 2728864721u, 2959990011u, 1071025467u, 1691914484u, 2858760972u, 1516700275u, 2771651049u, 607063247u, 4219381388u, 3373946171u),
+    SC(2146554811u, 2380633398u, 431356428u, 2501496525u, 4195490782u, 4281443977u, 1707183170u, 3515016439u, 43334925u, 2064458077u, 4149827026u, 2544422546u, 1259302114u, 1919625668u, 729425798u, 2757346641u),
+    SC(2475010648u, 501654469u, 1262984133u, 2284058265u, 3864896735u, 3216144340u, 3043718887u, 3290359029u, 2513504704u, 1583873907u, 787550022u, 889877880u, 4155285556u, 2519357244u, 1887123831u, 2544852082u),
+    SC(1329107374u, 3899397847u, 1931705980u, 3537599611u, 2074239136u, 1267070685u, 2447524924u, 3173107761u, 2842541385u, 924561908u, 2664553616u, 395476463u, 813764142u, 3107511895u, 179660379u, 2380654703u)
+},
+{
+    SC(286197159u, 1217476806u, 1373931377u, 3573925838u, 1757245025u, 108852419u, 959661087u, 2721509987u, 123823405u, 395119964u, 4128806145u, 3492638840u, 789641269u, 663309689u, 1335091190u, 3909761814u),
+    SC(2458775681u, 3448095605u, 3846079069u, 1243939168u, 2712179703u, 2514528696u, 1400411181u, 3792085496u, 528921884u, 1230512228u, 4062090867u, 931590129u, 3669288723u, 1764179131u, 2650488188u, 764612514u),
+    SC(3981461254u, 1881876860u, 3861653384u, 1419940889u, 3890280301u, 225359362u, 3772709602u, 2406778923u, 1744011295u, 836946168u, 1547583643u, 2969842237u, 3997288340u, 2150480638u, 3129156617u, 1325216902u),
+    SC(3592470591u, 3671101194u, 2792523734u, 2070472959u, 1473838345u, 785123121u, 2721504084u, 2212009910u, 4070989896u, 1696639999u, 2859248441u, 3104578877u, 2309769016u, 4267049236u, 2484173427u, 1626540609u),
+    SC(4267160019u, 2981312649u, 344263087u, 698599319u, 1002907346u, 93565259u, 286808078u, 1804582990u, 3599771325u, 2181306538u, 1961279765u, 187428107u, 223299791u, 4043449191u, 587626985u, 2106033479u),
+    SC(501761768u, 2386293097u, 1180388710u, 1812775472u, 918601490u, 3009070794u, 1574279477u, 1505824867u, 3643095372u, 3370828988u, 832869144u, 404837899u, 3152252263u, 3925885097u, 69867335u, 3741018586u),
+    SC(2051920526u, 1020215512u, 2058830843u, 1611771091u, 2552120098u, 75944844u, 1802229404u, 915313553u, 2313215016u, 1745739579u, 443475191u, 2998247588u, 3289885130u, 1289464560u, 2961919458u, 3798282256u),
+    SC(1496487624u, 2215532014u, 4148657376u, 3923080315u, 216179279u, 3856996518u, 2014567019u, 880786726u, 2125033974u, 58008256u, 4039109547u, 402585883u, 2182540617u, 437175766u, 1441865826u, 1665450276u),
+    SC(3078919323u, 1109978808u, 3102316446u, 4252174800u, 1046362670u, 3864571927u, 2260100326u, 3682270765u, 2139319322u, 1066628173u, 240059747u, 1164853046u, 1454716611u, 512654137u, 1544275853u, 2556727566u),
+    SC(580428655u, 115762757u, 1593355348u, 2740341778u, 1504897999u, 975028678u, 2401832824u, 4197869940u, 3667767462u, 644880229u, 691878327u, 369150353u, 4026243769u, 737605979u, 2791271214u, 2620684209u),
+    SC(624678531u, 4114750403u, 1274989179u, 1531504358u, 3520816024u, 2554021149u, 1865577096u, 1362433716u, 1638936249u, 3016959317u, 2526207810u, 3033412199u, 695904139u, 2060012285u, 3230414132u, 860289224u),
+    SC(3442642063u, 1520946900u, 218826564u, 968761561u, 4098434233u, 3360677602u, 2204368028u, 486310067u, 2601372374u, 1399175099u, 2183933043u, 806379489u, 2424203087u, 2668736829u, 1664637882u, 3005713727u),
+    SC(700899790u, 1066183324u, 3546718434u, 998702102u, 2557230354u, 2084117292u, 2934243163u, 1545771642u, 3688392810u, 3908656537u, 3447657276u, 840000010u, 2955752477u, 44371204u, 3799655472u, 3734995825u),
+    SC(3265506533u, 942399325u, 173917125u, 161041810u, 2297418901u, 849604788u, 2703870825u, 2810175425u, 3617296913u, 1432689375u, 3133875354u, 1118654553u, 2616257301u, 495686053u, 4127407123u, 1943733376u),
+    SC(2005668850u, 485568946u, 2260461782u, 2622034876u, 2693998905u, 2811925574u, 2831747304u, 3217266392u, 2520502878u, 1176196783u, 2567958416u, 1525744035u, 2841811417u, 1157609637u, 3871707993u, 2765099676u),
+    SC(207989197u, 368293876u, 3237374184u, 1394768686u, 1254103141u, 935691540u, 375090092u, 2481205522u, 2920254212u, 492683984u, 2055637221u, 4291235240u, 3889542314u, 2465899605u, 1694380507u, 757371549u)
+},
+{
+    SC(136266275u, 1782161742u, 3530966629u, 586004249u, 4076565170u, 3312577895u, 876489815u, 1337331291u, 888213221u, 1813863938u, 1374206604u, 2668794769u, 1377764865u, 784024905u, 1937217146u, 3627318859u),
+    SC(3161427495u, 2344678392u, 1808682441u, 2396619894u, 3034006140u, 1044331129u, 4102609084u, 1058091322u, 1515502621u, 1258860285u, 1406233340u, 127619173u, 3057107171u, 225762630u, 1651671815u, 4285298193u),
+    SC(630785468u, 1344100570u, 1929331818u, 828088181u, 2313124884u, 1302120759u, 3180735860u, 313275450u, 1008942268u, 2707820177u, 4248947940u, 1732478629u, 3645496831u, 611830707u, 1937638387u, 61731419u),
+    SC(1347537282u, 2857000226u, 227299159u, 1108544547u, 1181072563u, 1291715943u, 3752803919u, 2688390945u, 2484326219u, 1350060758u, 452823659u, 2363636452u, 2152205190u, 1812507720u, 607624535u, 2319475408u),
+    SC(3222638329u, 3875752446u, 758301165u, 51152840u, 2430504171u, 1189996379u, 44948392u, 232960619u, 3026371583u, 2974537914u, 3244781723u, 3702394182u, 2835938901u, 663347918u, 3320069474u, 3071978352u),
+    SC(1947047272u, 3022037725u, 949698504u, 1728470528u, 283847009u, 1458268020u, 360012619u, 1579646653u, 4005878207u, 1765381301u, 20903539u, 2558445559u, 757888638u, 2604781527u, 2240457927u, 3990518442u),
+    SC(4281545336u, 1208697934u, 2578865021u, 2456188396u, 1796646478u, 3757714293u, 2622755030u, 1606025966u, 30472258u, 3850691354u, 1208779266u, 405050222u, 3807844323u, 3748806955u, 358470323u, 4212845387u),
+    SC(2041619043u, 3711576883u, 835794591u, 2392116351u, 2862318436u, 689502669u, 2866163103u, 2052898811u, 576580608u, 1144506306u, 542475550u, 474572979u, 4137279429u, 2221684538u, 331268239u, 1556318477u),
+    SC(705880713u, 2092991958u, 815360595u, 3449491044u, 1305192012u, 2057063005u, 3299868133u, 1114733861u, 730760330u, 1129737257u, 4233249504u, 1217580888u, 452658791u, 2612091783u, 1764043106u, 1669202162u),
+    SC(3689992902u, 700129090u, 282055655u, 756126609u, 382876308u, 4262209576u, 2436932760u, 484247369u, 1415138625u, 2340918814u, 3058199817u, 4145497883u, 334812059u, 461523021u, 2221122791u, 2995497332u),
+    SC(706669295u, 3007808000u, 3728730665u, 3241577762u, 3126001367u, 292940936u, 1126531898u, 3913205978u, 304146054u, 2548053118u, 3490807704u, 3465095661u, 3938930443u, 804039554u, 297557674u, 1669808877u),
+    SC(2395818908u, 3199065200u, 4060875213u, 1731284266u, 1022607637u, 1154299144u, 3879751917u, 384430926u, 86892497u, 2036004815u, 2668116514u, 901861508u, 2277490553u, 1312485879u, 562264334u, 170374972u),
+    SC(2192479620u, 3046309306u, 143307916u, 3468295982u, 3110013374u, 699221760u, 273412494u, 3153322038u, 2886126025u, 1296005576u, 2326933823u, 3713038344u, 919578907u, 258326637u, 1991591857u, 604405680u),
+    SC(3283196708u, 902217854u, 1295144146u, 503984315u, 566424671u, 1755595238u, 2455519229u, 120267530u, 1004363245u, 1611271287u, 1013059281u, 3646183010u, 183890924u, 188417891u, 1612883046u, 2255154239u),
+    SC(1231171449u, 2524105034u, 653815517u, 585754026u, 3098352226u, 866901449u, 4223318963u, 1071806142u, 3239364285u, 4077877700u, 423690458u, 2222266564u, 4117269051u, 1893556406u, 3304547745u, 215164118u),
+    SC(3229321461u, 3443938850u, 803179772u, 3340311630u, 2749197592u, 565049216u, 1674980657u, 45735981u, 3858875409u, 2208179057u, 2167864606u, 3853383863u, 3320158569u, 901453102u, 2505912317u, 1486241881u)
+},
+{
+    SC(768143995u, 3015559849u, 803917440u, 4076216623u, 2181646206u, 1394504907u, 4103550766u, 2586780259u, 2146132903u, 2528467950u, 4288774330u, 4277434230u, 4233079764u, 751685015u, 1689565875u, 271910800u),
+    SC(2894970956u, 471567486u, 2880252031u, 2717262342u, 4077383193u, 1268797362u, 4257261832u, 2560701319u, 2691453933u, 1607372210u, 2771176414u, 58794458u, 4272438220u, 2521311077u, 642919262u, 3613569198u),
+    SC(549667688u, 1635817891u, 3597742712u, 2133548191u, 983618585u, 1077056145u, 1016537981u, 3024916594u, 3788763915u, 2354027825u, 234019788u, 1129974745u, 3836449602u, 132091652u, 2429034711u, 3714188356u),
+    SC(3752023309u, 1237246457u, 810507218u, 1575719630u, 2984629402u, 1312110059u, 1532351529u, 3778270553u, 500991970u, 3016414634u, 2451804626u, 3116044735u, 2749076428u, 609078974u, 343845623u, 1628221103u),
+    SC(1079050562u, 537097107u, 2113045556u, 1216978919u, 795109794u, 494396817u, 3615304214u, 3016596136u, 1485503229u, 2246940765u, 2872639209u, 812577075u, 3970992077u, 816616346u, 4279493103u, 2696304890u),
+    SC(302016674u, 1709668681u, 88411267u, 3337357281u, 3061995584u, 3396993199u, 1858891069u, 2509301562u, 3807375387u, 3567949934u, 3737724046u, 4137514111u, 1709156749u, 1400722499u, 3253197246u, 830289695u),
+    SC(86642997u, 2517748533u, 1802616926u, 3224858276u, 667521935u, 294768443u, 3699185630u, 2619978653u, 1654256627u, 789295435u, 4056501046u, 2298266369u, 3425028365u, 3740463800u, 2064449616u, 423401599u),
+    SC(587205175u, 208206623u, 1253389730u, 3674422134u, 284316357u, 2112208954u, 1196434050u, 302049830u, 985808817u, 4037289748u, 2191325460u, 4289570719u, 592322138u, 3671063901u, 886295122u, 2540475213u),
+    SC(2164961127u, 4048157441u, 2790139366u, 1435011700u, 4142835891u, 3320410016u, 2681849481u, 1047872443u, 2885564134u, 874029678u, 2048520878u, 2934385850u, 1097367713u, 1997417466u, 2045706034u, 898129538u),
+    SC(3451958921u, 95403444u, 4056502814u, 671939501u, 2069116441u, 3101129770u, 553516228u, 1712496197u, 2639919391u, 3157824758u, 2182076931u, 2920510603u, 91421090u, 3496854290u, 1333938225u, 2005754623u),
+    SC(469295760u, 426796598u, 3855795018u, 970866434u, 856973549u, 2439780350u, 2385957015u, 2589908140u, 3781058972u, 4109407963u, 32316753u, 3931244779u, 68560366u, 1699148814u, 843806029u, 3772908229u),
+    SC(3846833357u, 4119412096u, 438094070u, 2645426661u, 884548695u, 2876447138u, 80918210u, 2029354870u, 135282137u, 3030947473u, 2960763605u, 1898348122u, 4127316996u, 2240743006u, 2934791826u, 887094286u),
+    SC(1897883656u, 1406242187u, 2434671426u, 2734794757u, 2714201131u, 3046668149u, 257451999u, 3794951424u, 152449195u, 3454838096u, 2737741298u, 821046884u, 2554260361u, 962889686u, 1262263641u, 2203109889u),
+    SC(1985684731u, 222483668u, 2849949193u, 1221492625u, 2084499056u, 1235444595u, 2655267198u, 1020186662u, 1447071023u, 3629752849u, 651251319u, 2167418603u, 2268535831u, 2985934672u, 2652239173u, 3259021212u),
+    SC(3062826974u, 1796450254u, 1939504794u, 476729966u, 3521076442u, 3086668105u, 234121934u, 986487065u, 1570879569u, 2820662853u, 1206879400u, 4271520206u, 4242315964u, 2749978648u, 3007865079u, 4114755771u),
+    SC(3649818358u, 3409857055u, 1537210569u, 2398557069u, 3130583052u, 536941530u, 3880813719u, 1419070102u, 1164730147u, 2533104753u, 2046210979u, 2821557175u, 2327264610u, 1639358616u, 2001893732u, 1524105344u)
+},
+{
+    SC(294473811u, 4198428764u, 2165111046u, 977342291u, 950658751u, 1362860671u, 1381568815u, 4165654500u, 2742156443u, 3373802792u, 668387394u, 853861450u, 2637359866u, 2230427693u, 2824878545u, 103849618u),
+    SC(3462974251u, 3960356708u, 3970663027u, 1911703734u, 2602955995u, 2496279357u, 210580885u, 3874806640u, 2822070051u, 4063068709u, 2061277285u, 1429537360u, 2349584518u, 2910686068u, 3963567776u, 3972103816u),
+    SC(2016723458u, 2541590237u, 3532225472u, 3001659539u, 112442257u, 922189826u, 2246032020u, 3487464820u, 1658786807u, 2276379919u, 1596562072u, 457926499u, 2193005220u, 2575074329u, 529788645u, 1519231207u),
+    SC(1572936313u, 886315817u, 1530415140u, 2311860166u, 3941188424u, 45807153u, 2483174955u, 1469805839u, 3162970586u, 2454510043u, 2417743140u, 2783896043u, 4229304966u, 1351489836u, 284407686u, 4050060666u),
+    SC(1089549454u, 2684562245u, 1059803961u, 224950790u, 58262787u, 3033299806u, 927475933u, 1400133226u, 3082832878u, 1490904482u, 3040968407u, 593844137u, 1569781919u, 798746464u, 1083127814u, 1590280691u),
+    SC(1538536818u, 1828650047u, 3754703497u, 985555578u, 1002045074u, 767791702u, 915104522u, 465342914u, 1114045622u, 3426575950u, 1922317875u, 1070157234u, 3077282627u, 509171365u, 1607316331u, 668038565u),
+    SC(3323765415u, 1224391265u, 2469548057u, 3722781348u, 3031269370u, 4289586349u, 2226931390u, 957179955u, 2298143215u, 388542993u, 1780793152u, 2112973240u, 1502081645u, 1973971844u, 934878133u, 1618693887u),
+    SC(3954817210u, 3380652139u, 2572526672u, 1228436929u, 465848053u, 3939966705u, 2398020514u, 2900599831u, 2007674400u, 2727714272u, 2337519533u, 1681172994u, 4089802218u, 142069883u, 4261364192u, 2856729470u),
+    SC(4248537414u, 694781904u, 571619480u, 3221145068u, 2970038253u, 3370542615u, 2832314379u, 1807587465u, 1411648700u, 1964173012u, 121911610u, 1134463822u, 2574507072u, 885427058u, 3741638072u, 3097389771u),
+    SC(2158675312u, 116080836u, 3333803512u, 3797833536u, 984464391u, 4149942538u, 1145746749u, 1195624987u, 426540232u, 1021913877u, 3121679962u, 3390873776u, 3273678689u, 3851165262u, 4274383191u, 1915176720u),
+    SC(1158541955u, 1843489443u, 998849897u, 969171492u, 1791167915u, 2484857096u, 1119081920u, 1901041264u, 2534183757u, 1529097558u, 2956376281u, 1260291681u, 1159207651u, 3441978306u, 2518693280u, 4253362775u),
+    SC(1690661001u, 2213259738u, 3615956917u, 105152953u, 308358176u, 1328282355u, 1666389191u, 1019854259u, 2059193948u, 4244545599u, 1952864052u, 329670934u, 3592985517u, 571024701u, 1172799188u, 3135874872u),
+    SC(1184018396u, 889004172u, 1920099477u, 1964506637u, 189152569u, 1805931691u, 3250067608u, 3446883320u, 1471577127u, 2315956523u, 1588897116u, 2470229082u, 3602241877u, 554726955u, 1644067322u, 87402371u),
+    SC(1360270758u, 326216664u, 3362619326u, 1255989535u, 4140691901u, 856602972u, 2084629207u, 3858539838u, 78510889u, 2277092409u, 3136284616u, 1772786459u, 3229606238u, 94732571u, 2598206327u, 492226777u),
+    SC(1257123658u, 2873597433u, 3001150814u, 421725801u, 236310867u, 582305583u, 3367057659u, 2102668336u, 153914902u, 4226436363u, 290094468u, 690656835u, 1748591179u, 3668885459u, 165028339u, 2139821087u),
+    SC(2349582063u, 631395785u, 941018791u, 1503410647u, 181331585u, 2473834542u, 2528647747u, 3710284323u, 2364124560u, 3901998444u, 3224972026u, 605068436u, 546878913u, 356944705u, 3829683853u, 160452346u)
+},
+{
+    SC(1451965994u, 766802222u, 1324674662u, 350355960u, 2823290314u, 951779387u, 2914020724u, 508533147u, 1932833685u, 1640746212u, 1238908653u, 542788672u, 3642566481u, 2475403216u, 1859773861u, 3791645308u),
+    SC(216282074u, 1906267522u, 1852437064u, 1010678235u, 3729121535u, 4197231849u, 4150055440u, 1128246703u, 3264673345u, 1375783733u, 3415088931u, 34309836u, 2603881793u, 3106237815u, 2950890176u, 505684202u),
+    SC(3927516830u, 2488673756u, 327917152u, 614182630u, 2355346359u, 730432873u, 88446505u, 4240960753u, 4121410433u, 1398090547u, 2262743232u, 651724036u, 4138228417u, 3106475766u, 4179362424u, 750466827u),
+    SC(434692713u, 3111300976u, 3323560909u, 3413395188u, 601658363u, 2967722170u, 1070605430u, 74966422u, 813799229u, 4061279746u, 1996953298u, 1765274397u, 4035137864u, 2359104373u, 3535793255u, 618634298u),
+    SC(1231617791u, 3545122377u, 2628213180u, 2391855988u, 3734909337u, 2705206020u, 681643510u, 368801430u, 691450613u, 2224147576u, 951972679u, 2767063862u, 3676868191u, 158497152u, 2165075628u, 2832330233u),
+    SC(3529008459u, 1174295398u, 55914117u, 2816083797u, 205887723u, 1756010196u, 1648915894u, 1477354329u, 86311333u, 3889682737u, 1098085375u, 3464880379u, 1139759451u, 542536350u, 186494667u, 2442759451u),
+    SC(3094023174u, 1995851063u, 4191388160u, 1722723757u, 1329293492u, 727282912u, 2669776257u, 2772951118u, 1386276034u, 3089621174u, 2303649396u, 2292749559u, 1467806712u, 266878652u, 2651863592u, 1006978704u),
+    SC(2450691869u, 3012269556u, 3887712993u, 4048656504u, 2160727935u, 1940770088u, 174916584u, 3472792113u, 2648524840u, 990354037u, 1957678544u, 3888925732u, 1168435347u, 3720532709u, 3528212798u, 2624020545u),
+    SC(69863181u, 2459013627u, 4217968964u, 2735851825u, 1081344097u, 737361378u, 2157825722u, 2900791120u, 1412000158u, 1206005337u, 3067055303u, 230632577u, 601427243u, 2760861753u, 3679310020u, 2091861010u),
+    SC(2304197829u, 1531316041u, 2716383108u, 434697890u, 508817514u, 2929310544u, 3751532879u, 3785491984u, 2716598214u, 3666495867u, 3150261948u, 1306653078u, 2283636929u, 2492138954u, 1527136744u, 3312103429u),
+    SC(3387483809u, 1095455990u, 3248396980u, 3181117152u, 2258888938u, 2053848664u, 2160875912u, 553275695u, 1752757914u, 1504034431u, 1046528434u, 1855690339u, 2425857774u, 2142030048u, 237252438u, 3919745098u),
+    SC(3690358562u, 221287988u, 2268047572u, 3655202989u, 756646724u, 68846869u, 1965143185u, 513684595u, 404949341u, 3706987369u, 15990563u, 3409604325u, 658214808u, 2112012281u, 1742449680u, 1802932879u),
+    SC(2972942716u, 4184192946u, 4124576773u, 3089123761u, 1179063207u, 2093485395u, 512951348u, 59239037u, 3674464770u, 787225894u, 1288484371u, 1987692265u, 3767465580u, 4044585132u, 2916653148u, 2297816723u),
+    SC(3784876742u, 1057734114u, 4078669159u, 2003536621u, 3146165592u, 3800656487u, 297129408u, 4248472894u, 3906942491u, 4017607636u, 1285879766u, 3310681130u, 2653159866u, 2524355569u, 84128323u, 2374174391u),
+    SC(1598027967u, 344901367u, 413901309u, 2414916476u, 417612014u, 1371467558u, 1499802638u, 967537237u, 1571117481u, 1088564682u, 3141693657u, 833402800u, 723113978u, 882224086u, 3586817872u, 3592950853u),
+    SC(513582137u, 3376206006u, 3649593908u, 274710963u, 395026609u, 3340190413u, 1543782101u, 90195397u, 4157807658u, 412153222u, 558068169u, 2001737608u, 3474337160u, 1679447360u, 12885220u, 843004632u)
+},
+{
+    SC(2083716311u, 321936583u, 1157386229u, 758210093u, 3570268096u, 833886820u, 3681471481u, 4249803963u, 2130717687u, 3101800692u, 172642091u, 421697598u, 4220526099u, 1506535732u, 2318522651u, 2076732404u),
+    SC(3635330426u, 3675180635u, 4282523718u, 1750526474u, 1682343466u, 1292539119u, 2893227939u, 2897346987u, 1855384826u, 3916002889u, 4211021149u, 3439442996u, 241993264u, 1634586947u, 29890244u, 2635163863u),
+    SC(2111268073u, 1081371355u, 3873218083u, 4044562588u, 2141674529u, 2107952064u, 3689043955u, 3423481956u, 2548188353u, 2697516682u, 4235866514u, 2985306600u, 3687062917u, 2383095614u, 206503719u, 2548448480u),
+    SC(961167287u, 839569057u, 3482959339u, 4268254472u, 364097642u, 1343091094u, 3226753483u, 2159507482u, 3968394805u, 2518014496u, 3451298154u, 38127252u, 267735247u, 3484363065u, 957363479u, 1698662790u),
+    SC(2744437828u, 3863759709u, 3010153901u, 3500431594u, 2624982656u, 875272695u, 1378345519u, 1791692262u, 3726226549u, 2682325366u, 3925052276u, 389591343u, 3869112658u, 650251545u, 6263093u, 860194434u),
+    SC(309822299u, 841707800u, 2661553828u, 3383039256u, 238699224u, 1100968507u, 3534897900u, 4177846894u, 3463859410u, 1435499569u, 2006933774u, 3007046995u, 2819231184u, 288756524u, 1854189890u, 3858081977u),
+    SC(2088052675u, 3396090720u, 416722812u, 2597822221u, 1176386826u, 3290882216u, 1002529034u, 2156491632u, 4202546863u, 1988253003u, 164033721u, 941800849u, 1186836065u, 2298291750u, 1863561032u, 1437279190u),
+    SC(2858016010u, 775169843u, 2706497878u, 2821546952u, 2660836656u, 2077717717u, 3498848893u, 658545289u, 4048269927u, 418273988u, 1144587321u, 3094511386u, 4122354470u, 4225741678u, 603926280u, 979427875u),
+    SC(1933550557u, 635706492u, 1314164193u, 391588743u, 834468642u, 1475393570u, 467867971u, 1271027212u, 2540684860u, 3801872764u, 1235100171u, 2159823063u, 532708943u, 665828867u, 4215955726u, 3885758496u),
+    SC(3602864699u, 4002116109u, 644187852u, 1895585048u, 2776091504u, 72205071u, 554242761u, 4049640413u, 3149249833u, 688714164u, 687706448u, 3680924185u, 2274039047u, 303853541u, 2977107717u, 1196398757u),
+    SC(3014099531u, 1302405838u, 17960870u, 4110705157u, 3801652109u, 2085339416u, 223612049u, 2870889264u, 3353629397u, 3527061798u, 674241336u, 3525864585u, 2278818471u, 2069831593u, 2885891701u, 1329881521u),
+    SC(943450806u, 3704544104u, 3603194299u, 3757910007u, 502151885u, 765197432u, 4190577627u, 771063523u, 2436865367u, 678307964u, 1498061278u, 4120830837u, 3369466394u, 3399332765u, 1670894068u, 2891073104u),
+    SC(501595739u, 1876059299u, 4182005344u, 160804770u, 962098784u, 2636270989u, 1828906496u, 1316975808u, 4088133273u, 2943366134u, 216957582u, 1003216568u, 4242258589u, 3505873185u, 2810125978u, 3429220861u),
+    SC(2021386647u, 4046435053u, 1951135097u, 3941871277u, 2261999657u, 3808836272u, 2028063026u, 3659044589u, 3595750274u, 34514326u, 1889867282u, 1898224864u, 1659225476u, 3153868894u, 1647148554u, 1185039302u),
+    SC(4119269244u, 1304843028u, 2354051818u, 2031439365u, 533555049u, 1418960734u, 214120313u, 4187370667u, 4256529561u, 2635160409u, 1836564249u, 3828261559u, 3235640513u, 181194540u, 4018312346u, 680914749u),
+    SC(1914329770u, 3317667974u, 1413160514u, 2952053282u, 3332782151u, 3751637695u, 2146129829u, 167804454u, 2499496888u, 4213150810u, 223599992u, 2197202825u, 2869811316u, 2635473358u, 952082661u, 1532017334u)
+},
+{
+    SC(701959589u, 2450082966u, 3801334037u, 1119476651u, 3004037339u, 2895659371u, 1706080091u, 3016377454u, 2829429308u, 3274085782u, 3716849048u, 2275653490u, 4020356712u, 1066046591u, 4286629474u, 835127193u),
+    SC(897324213u, 739161909u, 1962309113u, 3449528554u, 2634765108u, 226285020u, 2832650161u, 324642926u, 2242711487u, 162722959u, 2264531309u, 2307017293u, 4006636248u, 1035416591u, 2557266093u, 3957962218u),
+    SC(1912896448u, 699621778u, 2975109255u, 1580597872u, 2818493758u, 515803157u, 1642586345u, 785148275u, 2098287545u, 1424779842u, 1039209855u, 4238164284u, 4173562747u, 3569896384u, 1089361492u, 1858690350u),
+    SC(2757340308u, 2538321018u, 2388474793u, 379482919u, 882562385u, 3129659692u, 4216198588u, 3565768337u, 1772023241u, 2931080253u, 3451485646u, 748689895u, 562737327u, 663797632u, 3315310934u, 2629536884u),
+    SC(242169331u, 1243063456u, 175561111u, 2950276224u, 3213816292u, 692329775u, 3181354285u, 3015261169u, 1744760252u, 3733849950u, 4219512025u, 693702734u, 2844842003u, 722286940u, 2391355922u, 3564773447u),
+    SC(2291286292u, 966238959u, 506903622u, 2122264528u, 1392182009u, 3447321781u, 3873294792u, 1373792940u, 991667700u, 2332723711u, 2764968211u, 2471301595u, 649629323u, 783169152u, 1459916213u, 3846736182u),
+    SC(2664330880u, 1149932862u, 1416201114u, 318583284u, 4140857901u, 1128356267u, 1095497693u, 1624736741u, 761312690u, 241788645u, 2036924781u, 1946525101u, 3225208750u, 4156033061u, 2590150721u, 3771407135u),
+    SC(2862143077u, 233168744u, 2659004990u, 155440145u, 3918377979u, 1360152661u, 627903232u, 1469886352u, 2876841580u, 3955906097u, 580277652u, 3039511497u, 1597126708u, 1404269416u, 42059925u, 2098341602u),
+    SC(812381463u, 3272442363u, 496180006u, 1236237424u, 2267310113u, 2237850197u, 1113026387u, 716498059u, 3503382440u, 328287114u, 1410789607u, 477863076u, 1362085890u, 3569642059u, 2006757845u, 675415451u),
+    SC(747557402u, 4212477852u, 3286869720u, 3708058361u, 3240421074u, 1188732842u, 916816078u, 2444327052u, 2111479336u, 1745064524u, 3637408011u, 3599633029u, 4230973048u, 1160089497u, 1136388910u, 4138160782u),
+    SC(1255139572u, 1856599651u, 1458352865u, 3271906169u, 3410637086u, 2119040671u, 1680850868u, 413922813u, 2782309328u, 3561735700u, 3723648708u, 609378416u, 268989415u, 3293584485u, 3271843364u, 1954072630u),
+    SC(4155626312u, 931793228u, 1049414704u, 1037617746u, 265265177u, 616902615u, 844384832u, 3477591939u, 3106685802u, 2357099686u, 1845236259u, 3355104451u, 3327830357u, 3100545339u, 1162051156u, 2646331847u),
+    SC(514329180u, 948073745u, 1774920952u, 105860125u, 2811186644u, 1695131452u, 940976033u, 2019732362u, 309099076u, 1607914408u, 4118428245u, 1337868060u, 3952860679u, 2578427283u, 265792106u, 295755030u),
+    SC(3882528435u, 2629929072u, 1617404150u, 1421619579u, 2309432083u, 724299897u, 2666040048u, 1096383838u, 1836447402u, 426930713u, 3934220119u, 3232225281u, 1000075862u, 3631628825u, 3529619355u, 1219322120u),
+    SC(3335633324u, 4194223138u, 3901817518u, 1335914529u, 3871871049u, 3709757137u, 3499113177u, 235348888u, 781652835u, 1102256292u, 3754223033u, 833068853u, 4178470716u, 1807198743u, 2733399861u, 3740356601u),
+    SC(228568838u, 3126580587u, 4000897922u, 1303869372u, 3850020302u, 1548458239u, 2356371812u, 3570971356u, 2544858219u, 4220062752u, 2062616152u, 953792592u, 764216612u, 2052428514u, 2314665964u, 2792116584u)
+},
+{
+    SC(2022030201u, 622422758u, 4099630680u, 255591669u, 2746707126u, 492890866u, 1170945474u, 626140794u, 2553916130u, 3034177025u, 437361978u, 3530139681u, 3716731527u, 788732176u, 2733886498u, 780490151u),
+    SC(4207089618u, 3411945447u, 1960753704u, 3552759657u, 1130668432u, 848791484u, 3810908171u, 353148861u, 3312275539u, 2963747704u, 2966813687u, 2483733320u, 2880725255u, 463405312u, 3340834122u, 1292390014u),
+    SC(2664721153u, 4108676217u, 2604619822u, 775242570u, 636236518u, 2873717047u, 1857718302u, 2091477716u, 1586310695u, 2528697445u, 2256487867u, 2787362203u, 2741360704u, 496928924u, 601271512u, 3586110309u),
+    SC(1791685197u, 4242641311u, 3369628733u, 2052809939u, 806398185u, 3412279529u, 1946210627u, 1398934260u, 3077042954u, 2276630414u, 814388665u, 1749609309u, 3367688729u, 1959714965u, 2411157301u, 2263996211u),
+    SC(439326213u, 4256425445u, 876987216u, 1314194194u, 3010100734u, 1576065730u, 598365157u, 3705087566u, 3427486218u, 1877721147u, 358249820u, 410263983u, 1386735339u, 573015435u, 3312164843u, 1274000474u),
+    SC(1340417963u, 1112802360u, 10328826u, 706586684u, 2526013892u, 4135069035u, 3566832565u, 2945858092u, 107866747u, 2114273476u, 1970904771u, 965191541u, 1793617219u, 1453495760u, 4269949644u, 41605060u),
+    SC(123137558u, 4245690796u, 820317976u, 1443287541u, 4203849632u, 2954045926u, 714382464u, 3076066234u, 1293485113u, 2554869888u, 1663243834u, 1823619723u, 3832632037u, 2772671780u, 1362964704u, 558960720u),
+    SC(104412626u, 1897841881u, 4081037590u, 3456756312u, 3025873323u, 2036419348u, 663042483u, 1254379139u, 1882881825u, 3296543036u, 153313200u, 916960321u, 2276001640u, 759388499u, 1134495268u, 1699779658u),
+    SC(4218137867u, 889442133u, 2322944798u, 2659784159u, 2592614267u, 3345396604u, 3647495000u, 2837331949u, 75759322u, 2350992064u, 2461684340u, 2333444962u, 60872001u, 106935728u, 2095087192u, 2026584532u),
+    SC(818402121u, 2851948581u, 2197490142u, 4158011576u, 1665124994u, 3116095068u, 4019154383u, 478938546u, 1455910301u, 1844755722u, 2818772446u, 2743310120u, 1907022363u, 1639658700u, 517605614u, 2705809838u),
+    SC(335193145u, 4147885949u, 3527556636u, 2575925391u, 2530836608u, 2938195122u, 3771589905u, 2663025172u, 4017017665u, 2146447634u, 3974365403u, 2994000421u, 3198356067u, 3382731724u, 2593683495u, 3554902256u),
+    SC(1108422413u, 1982378939u, 2047758090u, 246779179u, 2568353687u, 279750626u, 1730233650u, 784289836u, 2712478714u, 3614283837u, 1824826964u, 2514128237u, 3308726345u, 3623735281u, 887459898u, 3896777957u),
+    SC(3527405352u, 290146745u, 125808293u, 735109902u, 1788801307u, 3306408847u, 822599754u, 3798637803u, 1514985656u, 2967186195u, 716984495u, 3386310843u, 3156794500u, 1007814159u, 1629566196u, 4265651874u),
+    SC(1178327293u, 565847309u, 518944000u, 3901419432u, 941693255u, 4276272755u, 3595637504u, 1831384538u, 553054976u, 3799273120u, 516961220u, 3048859574u, 1887176404u, 3648800625u, 2905989893u, 2971331974u),
+    SC(561598562u, 3812086269u, 2571795641u, 1946669885u, 4094345694u, 1247304730u, 725275648u, 2382611624u, 3912910386u, 3657806663u, 2347179560u, 3311073478u, 3031523768u, 2672297551u, 829774364u, 4138790294u),
+    SC(3908534093u, 41076189u, 4026661177u, 1264946070u, 3582612650u, 3167460834u, 3305185564u, 1828271691u, 1883569901u, 567401887u, 2154847219u, 3599749472u, 834678216u, 1517326104u, 465030801u, 2253777505u)
+},
+{
+    SC(69398569u, 525452511u, 2938319650u, 1880483009u, 3967907249u, 2829806383u, 1621746321u, 1916983616u, 1370370736u, 248894365u, 3788903479u, 221658457u, 404383926u, 1308961733u, 2635279776u, 2619294254u),
+    SC(4116760418u, 3197079795u, 2972456007u, 1278881079u, 1399016013u, 267334468u, 3129907813u, 468505870u, 1237093446u, 3810554944u, 1980244001u, 1830827024u, 4255330344u, 3556724451u, 2936427778u, 3969278111u),
+    SC(3989128687u, 604159041u, 3302470711u, 1703086807u, 4153485525u, 2444501021u, 449535888u, 2817157702u, 3967126593u, 3774839729u, 4230523164u, 1130105305u, 2419296875u, 560268503u, 173246097u, 1794638932u),
+    SC(1735434103u, 3810847770u, 4216841726u, 1126260487u, 1019034952u, 4140633019u, 3223272164u, 440162565u, 3864068825u, 3275406276u, 2196958479u, 4212485308u, 539037402u, 431338309u, 4061221107u, 4289896057u),
+    SC(1802752446u, 2780168117u, 1133399256u, 2599868866u, 3158418134u, 2848371717u, 2893014484u, 1878597835u, 139427334u, 1841937895u, 2016179766u, 2330806831u, 3849381146u, 2224326221u, 2296824272u, 3983748073u),
+    SC(1520559143u, 1690628296u, 1614953069u, 1422707415u, 257987514u, 3063997315u, 2652769123u, 3445956897u, 843436720u, 4264023440u, 365609354u, 2250088148u, 2769492081u, 59746990u, 1275187671u, 1973406172u),
+    SC(2823162534u, 2631304853u, 2485683334u, 33106529u, 243176015u, 492943806u, 489814307u, 4023911334u, 4139752347u, 4133120235u, 2455727203u, 1293330101u, 1838339727u, 4219498628u, 2131345625u, 3646653738u),
+    SC(4198202713u, 3167956639u, 2765023077u, 3652537372u, 1708707687u, 2324231909u, 1009881825u, 1679047879u, 2515346176u, 794145218u, 554048969u, 3173445869u, 2193645289u, 1271864237u, 1006139617u, 1072905092u),
+    SC(4273823033u, 1749314885u, 4263358248u, 538495360u, 4104454924u, 1997598205u, 3080563305u, 3238994582u, 3099819109u, 3162260128u, 1706963773u, 405274298u, 1894479347u, 1596497438u, 1094591269u, 1522128209u),
+    SC(2640931764u, 1304425992u, 2939922746u, 3918107623u, 1248692482u, 1121191585u, 2062140937u, 1807331998u, 3643560968u, 3236720945u, 2667270358u, 411521120u, 3664086365u, 2334989504u, 2668098536u, 3236026237u),
+    SC(2404161740u, 567514400u, 3895963765u, 1201374790u, 674719322u, 2894222365u, 467511362u, 3395036514u, 1038550674u, 2948454520u, 1518702565u, 1362236790u, 157238862u, 3475771959u, 1415257606u, 2714484334u),
+    SC(1831986705u, 588754101u, 4075551797u, 2767613701u, 2944855428u, 1912813036u, 1398542170u, 3440695634u, 2367865816u, 842155635u, 2602621363u, 2143763320u, 4256143529u, 1826541687u, 1851134007u, 2997377819u),
+    SC(3699972731u, 227995919u, 3067674252u, 477404832u, 847958753u, 893077929u, 2153170373u, 3057114881u, 1197132301u, 3330088847u, 2465660906u, 549749504u, 722435391u, 4124201578u, 3419977887u, 636305133u),
+    SC(3346980455u, 338882355u, 1940861469u, 2106574528u, 4065634984u, 939438415u, 880899904u, 173329243u, 3962520186u, 3417951565u, 2532850810u, 1158609417u, 1846710650u, 305050726u, 600225342u, 3684765712u),
+    SC(1932816778u, 3409537322u, 2445361402u, 1740774412u, 3661005378u, 2854030637u, 1914937560u, 1558250179u, 3808763123u, 1298026979u, 2417248681u, 899022004u, 847010236u, 506303181u, 1296472514u, 648957572u),
+    SC(600303058u, 722185115u, 3110060002u, 3818809602u, 1551617161u, 4208042174u, 526230670u, 1957951010u, 3160030963u, 3295123990u, 3121214191u, 1337066151u, 2200271451u, 1066776105u, 1163805043u, 2606444927u)
+},
+{
+    SC(1137648243u, 3815904636u, 35128896u, 1498158156u, 2482392993u, 1978830034u, 1585381051u, 335710867u, 529205549u, 1286325760u, 863511412u, 283835652u, 936788847u, 101075250u, 116973165u, 2483395918u),
+    SC(2210369250u, 711585268u, 1961210974u, 1353321439u, 1215935705u, 1641330999u, 11213011u, 2020212318u, 695107713u, 3413272123u, 1378074688u, 2790029989u, 658491086u, 1881545465u, 3409839898u, 2042086316u),
+    SC(1723393102u, 3373492622u, 3599711002u, 3748987970u, 1143620470u, 2663282777u, 2229588531u, 2674289435u, 2963045423u, 2234232397u, 4178299567u, 2791622546u, 4001934471u, 757990509u, 2858420658u, 605204372u),
+    SC(4272330873u, 3840847353u, 659917277u, 1664684318u, 1563018625u, 821178295u, 3329580379u, 794312951u, 2169136998u, 1706378889u, 3017987093u, 1159314572u, 2524368718u, 2444830959u, 898030098u, 68613446u),
+    SC(3172236096u, 1547478676u, 3467968131u, 1603626860u, 1411948645u, 2916654969u, 2891471305u, 2110051838u, 1733578576u, 2788816800u, 1613389791u, 759324595u, 3991538909u, 4073480091u, 3323038139u, 2043658072u),
+    SC(3011536148u, 2207224783u, 101813390u, 4149858178u, 961260436u, 3760245299u, 2099300570u, 3143747485u, 3209436103u, 902146054u, 3598885374u, 597299239u, 1369786353u, 2099087354u, 1506359374u, 1017249349u),
+    SC(3137350455u, 1622014086u, 2828880803u, 599881832u, 2213606365u, 4248974065u, 675350384u, 1446749674u, 1254778294u, 1745968946u, 409433048u, 1103126998u, 2370471436u, 1143685003u, 3341252280u, 1003299547u),
+    SC(2019014241u, 1108099665u, 1035538349u, 2878848993u, 2585673617u, 1565675366u, 2261830657u, 117854892u, 1965053814u, 2351841804u, 4065720752u, 3747135308u, 959541091u, 1629950401u, 4236240320u, 189693687u),
+    SC(3443026785u, 3216851941u, 278623472u, 1568038608u, 1548544711u, 2243949731u, 3359141033u, 1425753427u, 2934907774u, 2301245979u, 2216178210u, 153063705u, 1690071616u, 791861830u, 1201756636u, 1249732113u),
+    SC(2497506925u, 3815453805u, 1308318422u, 1061717857u, 710358190u, 3797004413u, 1870767051u, 2099598345u, 845543228u, 2941187056u, 1083282999u, 1311194087u, 3227025541u, 423673289u, 2634724972u, 3297305091u),
+    SC(1394185841u, 1653557808u, 2313575976u, 1732811292u, 2133445032u, 171245194u, 3242484287u, 2667183179u, 1165233778u, 997752293u, 501180123u, 2529762237u, 429212016u, 1660866777u, 1766992150u, 2066419882u),
+    SC(945381459u, 1085161105u, 3490034658u, 983140246u, 425352282u, 2175943302u, 1166850024u, 3968884285u, 1417959566u, 3386676357u, 3168826489u, 2984241621u, 3305143707u, 246924146u, 4113453679u, 123892017u),
+    SC(1498291154u, 979168666u, 2565114847u, 3722708999u, 3116533535u, 2044826765u, 118913881u, 2684275795u, 30932180u, 3147559151u, 3769605849u, 2376328043u, 753602217u, 3789763983u, 1247346722u, 4123341034u),
+    SC(3203969599u, 2514533821u, 1007395325u, 2063305304u, 520326691u, 3823758018u, 3095693832u, 1864628246u, 2586004821u, 4190638257u, 2952735262u, 2977139992u, 1124651421u, 295756268u, 3428261546u, 3110485030u),
+    SC(1663042556u, 4114384947u, 1430450710u, 3825340149u, 1051862436u, 3194752601u, 3106848742u, 1383208530u, 3142397378u, 4065704146u, 1545077688u, 2297695627u, 3152458457u, 4134880529u, 2187655177u, 3419805764u),
+    SC(3081663242u, 3880428040u, 2670880433u, 1398290076u, 1232125961u, 3862005121u, 1297357575u, 3334998678u, 1135063881u, 1723120988u, 2716095891u, 1113861429u, 3955845594u, 88397004u, 1699846421u, 887623013u)
+},
+{
+    SC(2668669863u, 1518051232u, 591131964u, 3625564717u, 2443152079u, 2589878039u, 747840157u, 1417298109u, 2236109461u, 625624150u, 2276484522u, 3671203634u, 3004642785u, 2519941048u, 286358016u, 3502187361u),
+    SC(1979235571u, 2198968296u, 3104128030u, 1368659294u, 3672213117u, 1391937809u, 2759329883u, 1389958836u, 2420411428u, 890766213u, 2707043165u, 2738550562u, 3382941095u, 378763942u, 3093409509u, 2964936317u),
+    SC(738589056u, 2116353374u, 2279888429u, 1705963022u, 828292114u, 896734726u, 2179570630u, 199574728u, 977051187u, 779668316u, 2330529056u, 3992755888u, 1000402439u, 2191612089u, 357145081u, 1441305104u),
+    SC(3372185571u, 1990378702u, 1181109789u, 3007260699u, 2430812419u, 1342872134u, 2198044770u, 1122343273u, 492870646u, 795688582u, 3226537448u, 1245881435u, 1071312339u, 1997541910u, 3829149062u, 1964864598u),
+    SC(3005241683u, 2859584860u, 2297396821u, 999606499u, 3964655188u, 3075624064u, 1368424820u, 847579236u, 744318941u, 1201524211u, 1104903258u, 3771742070u, 4093550286u, 53333408u, 659192149u, 3026115299u),
+    SC(3415227510u, 2060701016u, 1724277801u, 2661091313u, 215175235u, 1719160017u, 2940192603u, 1942243742u, 2398510742u, 4053370504u, 720436957u, 3760614784u, 2014232625u, 4199009336u, 2658914393u, 246186938u),
+    SC(446126854u, 165933106u, 2141828870u, 892600041u, 4146883601u, 2127439849u, 3431174989u, 2697318886u, 754216027u, 2671089369u, 1463409379u, 2826265846u, 334206028u, 1562078629u, 62819702u, 350080249u),
+    SC(3607678201u, 1305808009u, 3724583207u, 482185919u, 703873206u, 1075587326u, 1772056430u, 1356871295u, 4212601732u, 3762698616u, 2707284202u, 752961239u, 3089561250u, 1634547883u, 2919906767u, 31529502u),
+    SC(299389109u, 1252069111u, 2304374236u, 1252642323u, 2415535563u, 271885157u, 592252779u, 1178960198u, 53568246u, 3149254195u, 2937703855u, 1474069228u, 1764301842u, 954790502u, 4245417136u, 3132108431u),
+    SC(2094400513u, 3190829985u, 2239253067u, 2918833540u, 4106202305u, 2502268912u, 1731261142u, 2453877410u, 1861934729u, 934615026u, 3785479199u, 3605446967u, 3582056355u, 3042887218u, 1961855879u, 496882544u),
+    SC(3179454680u, 881405516u, 158640787u, 2790186672u, 162147899u, 376983910u, 3379568747u, 1408037207u, 1411174731u, 535638557u, 1510230718u, 2856041085u, 1958999115u, 3678347246u, 2958940834u, 520309445u),
+    SC(1870118851u, 1980314816u, 3987573623u, 4117586697u, 396136405u, 3149345244u, 70002589u, 2314836548u, 1713919226u, 3789182954u, 2123295507u, 3015665476u, 4069315088u, 3980795614u, 2021907367u, 4155874670u),
+    SC(4078777812u, 3708497519u, 1529048728u, 3747007128u, 2780224299u, 2728976580u, 3953400499u, 550363476u, 3812495996u, 3116459113u, 2211909765u, 3967732138u, 315888386u, 4202077281u, 1437542127u, 2815522910u),
+    SC(3236576167u, 3189780679u, 2030714184u, 2121402515u, 772212369u, 2193424420u, 1417920098u, 2031545011u, 4110769775u, 697022136u, 1206489717u, 1691036150u, 88940849u, 535864250u, 547921653u, 2569798466u),
+    SC(598120112u, 3876471191u, 3533286352u, 3003233155u, 1039593763u, 2148663879u, 2659932582u, 279051507u, 988977723u, 3458445518u, 2950275676u, 4048574808u, 3093122873u, 831143981u, 214208408u, 3935649503u),
+    SC(2893621405u, 3242329790u, 1948255717u, 4083664057u, 3803596193u, 740414223u, 4293576836u, 3875047642u, 667197150u, 2081112783u, 2447275650u, 242164299u, 706345359u, 1928593492u, 1774391838u, 3660333945u)
+},
+{
+    SC(3009793609u, 3525092161u, 3245586135u, 574145899u, 4034974232u, 2828949446u, 3457574134u, 1546193476u, 3883480541u, 1976722737u, 3557056370u, 994794948u, 106991499u, 1626704265u, 3534503938u, 3271872260u),
+    SC(2939511082u, 3508735083u, 975571643u, 1775005849u, 4144127005u, 706007446u, 420750190u, 1296964164u, 3061654480u, 2268588398u, 258119220u, 1152421762u, 2183948554u, 3016917902u, 1186604447u, 3147111215u),
+    SC(405897674u, 923178082u, 1575208079u, 3088321769u, 2214762612u, 3893926734u, 3167279390u, 3951912989u, 2709000001u, 2390687969u, 3858727239u, 866338457u, 2045181240u, 3217044625u, 2328560686u, 1861539550u),
+    SC(1277015638u, 1098202702u, 1559301990u, 2587773702u, 236499920u, 458659357u, 2353007333u, 2611100088u, 3428309717u, 2008274629u, 3647015407u, 268886847u, 2626192792u, 3341061984u, 1515395072u, 3708589435u),
+    SC(4042661445u, 3420460388u, 402520550u, 3677541300u, 2230979515u, 1273170666u, 2514471146u, 827498216u, 1259202696u, 3072082970u, 475301020u, 2118811945u, 3612811582u, 1387362670u, 2779447975u, 2265478999u),
+    SC(2229583001u, 1885758268u, 2744744533u, 2751282929u, 3032060674u, 1949605811u, 1570835257u, 793354274u, 1683039266u, 449593771u, 109462780u, 1941150268u, 1808732776u, 139050949u, 2225765509u, 1246293964u),
+    SC(2802845617u, 3765730171u, 462111640u, 590276976u, 2549490668u, 1227143343u, 384473299u, 1872236586u, 2432932105u, 2621627369u, 29218585u, 3541815309u, 3762320683u, 3470760231u, 2011203130u, 2527437401u),
+    SC(796052351u, 4037990088u, 4017471553u, 1320960316u, 561010825u, 3728618461u, 3540350568u, 1334322515u, 2252671868u, 3217596003u, 3122272084u, 3124892250u, 146022162u, 3584383023u, 2911266650u, 2958817688u),
+    SC(161418820u, 3776882969u, 4050624816u, 1522984750u, 3239766493u, 3767349571u, 782872272u, 4177710199u, 1140123311u, 211837022u, 1955996644u, 402816745u, 3326870942u, 1443720320u, 1645866695u, 3832886909u),
+    SC(452931871u, 3201459109u, 3989748495u, 3779670060u, 3234605835u, 2462489907u, 3541849378u, 3952908948u, 2234764749u, 2534999097u, 1221823414u, 2220662906u, 2593424893u, 3688122472u, 2131104831u, 243658822u),
+    SC(1244527825u, 1331697159u, 1126644730u, 922926684u, 1475975786u, 704282514u, 1718439968u, 1878820141u, 2509443841u, 2182928123u, 1663057853u, 2828328506u, 1475048880u, 791101245u, 3209045799u, 807262644u),
+    SC(1506123994u, 75559732u, 2487617790u, 2776679170u, 2522687136u, 3704896305u, 945074946u, 2943008309u, 1088584510u, 2469322363u, 1078526500u, 2073262975u, 691596720u, 2702927487u, 380178128u, 704842212u),
+    SC(1460389583u, 4274587105u, 1447626425u, 3957246995u, 1621878179u, 1643627976u, 4030517934u, 1056559397u, 1438644008u, 32976965u, 2197709285u, 3567855255u, 2001746745u, 2603748421u, 3462117821u, 903804357u),
+    SC(3179129705u, 2297226467u, 1646197352u, 950157362u, 2929140164u, 4242027992u, 1652798968u, 4193267428u, 3343133888u, 2499845914u, 423061238u, 3494957413u, 3637365392u, 784231823u, 595573026u, 2713123590u),
+    SC(2810225213u, 3951319549u, 1905650326u, 3909017486u, 2335763951u, 3772810842u, 2983632261u, 489145948u, 4173940274u, 2703192453u, 2654763363u, 4064871590u, 1399005653u, 257836626u, 831912020u, 895345820u),
+    SC(4037755568u, 3145789767u, 2141184942u, 4120133888u, 346636610u, 3895536529u, 2259736314u, 1057113066u, 595225270u, 3051392771u, 2813693848u, 3877775276u, 1832280309u, 1138362004u, 3061980317u, 858203300u)
+},
+{
+    SC(941124125u, 1620226392u, 1431256941u, 3336438938u, 540497787u, 766040889u, 373284400u, 2979905322u, 177008709u, 2625544842u, 1096614388u, 1196846420u, 4186360501u, 3945210662u, 1143943919u, 3412870088u),
+    SC(2868459499u, 3255324438u, 807131982u, 2853200483u, 3487859623u, 3501857558u, 3107820062u, 2163227213u, 2115527726u, 2346720657u, 2251713340u, 3377131273u, 3223650794u, 3766790266u, 177525458u, 4167009497u),
+    SC(311132793u, 3961991670u, 3475828441u, 4275227465u, 4114440759u, 287999228u, 3329759386u, 2384037498u, 4228771259u, 844254234u, 256179964u, 1796107218u, 3127243322u, 1425447302u, 1385509204u, 1101567113u),
+    SC(2084416542u, 1837746358u, 3915669193u, 60671540u, 2731498203u, 842785439u, 103116859u, 3404407266u, 2713222963u, 3049100113u, 368142082u, 2923502225u, 3018451818u, 2169399182u, 3017634865u, 1845463402u),
+    SC(1620925474u, 3368534446u, 555437218u, 4144603563u, 1969376145u, 213474605u, 1856420595u, 3939242692u, 1705488978u, 252956811u, 1258322279u, 1776729832u, 3988114536u, 3572272198u, 1383845751u, 1398527932u),
+    SC(1762997475u, 799707654u, 1609033889u, 2324053368u, 2951656833u, 2545022095u, 1325992886u, 2638191889u, 737853621u, 891297811u, 1613139572u, 594983169u, 2686965496u, 4040759974u, 1496585540u, 294269531u),
+    SC(3866323582u, 3807637640u, 654389167u, 993860478u, 3985490230u, 874636344u, 2342980699u, 1928023737u, 1520117329u, 644165140u, 150615609u, 199275733u, 463804864u, 310744654u, 2057873049u, 1169977839u),
+    SC(239011286u, 715635161u, 1855226016u, 2750348850u, 4059485278u, 800137564u, 3998891997u, 4048007508u, 1194893107u, 3761772527u, 273800027u, 653240081u, 1187997500u, 310579555u, 786511222u, 3092283411u),
+    SC(3036944959u, 3482022954u, 3739636749u, 3919006909u, 4266819119u, 1212326408u, 103856594u, 597427799u, 1319114089u, 4260737761u, 1982976744u, 741084092u, 689793522u, 4260038527u, 1319231386u, 1661185367u),
+    SC(3846585080u, 1572901113u, 2683774833u, 3251385733u, 3753876990u, 849242549u, 4245340911u, 1064393430u, 3309340124u, 2842098330u, 2556268102u, 2033409485u, 757257328u, 2031055308u, 487255243u, 3197919149u),
+    SC(273355511u, 2413549351u, 710350577u, 1361281890u, 2485522754u, 1210096318u, 3839671116u, 3619357718u, 3954210633u, 312725146u, 3792397974u, 3833954588u, 1779821907u, 2701218449u, 2422680647u, 3829673069u),
+    SC(379167192u, 3494512635u, 855436470u, 2928216366u, 4239059924u, 4254878455u, 3617218283u, 739826290u, 3488721213u, 1288540569u, 2623691196u, 4237777587u, 1234356449u, 2367467024u, 185343202u, 2198868227u),
+    SC(333398980u, 1306721698u, 1267933489u, 3888643170u, 2305763143u, 1886386521u, 2247721544u, 1287414137u, 497238456u, 1934421131u, 1960709128u, 2688614248u, 3637710577u, 3756130276u, 1929365309u, 2796038772u),
+    SC(772805737u, 461244658u, 3551164236u, 4177074918u, 3920537361u, 4259237061u, 3625379235u, 3715444221u, 3444473673u, 2576271136u, 2750230085u, 2167864295u, 2571239709u, 3663560660u, 743894391u, 703945624u),
+    SC(2955504442u, 4192737708u, 2813336533u, 2037901957u, 1563142269u, 620241136u, 3249364868u, 1805455553u, 422364625u, 3061329310u, 3824436397u, 1640020182u, 2540832302u, 2063844885u, 2982901072u, 2809011473u),
+    SC(4188085081u, 1849071252u, 4251112483u, 1368274267u, 2811635355u, 3535120523u, 478922770u, 1090405967u, 2358353504u, 2249592823u, 2367480425u, 1158857070u, 1979230110u, 3661225756u, 2903524693u, 1830110173u)
+},
+{
+    SC(3638948794u, 3243385178u, 2365114888u, 1084927340u, 2097158816u, 336310452u, 231393062u, 580838002u, 3851653288u, 568877195u, 3846156888u, 2754011062u, 3396743120u, 2639744892u, 1431686029u, 1903473537u),
+    SC(3268926613u, 1818698216u, 1862252109u, 1578913474u, 4289804840u, 1885759995u, 2888888373u, 2636129891u, 2360477693u, 1672434489u, 4188472821u, 2046052045u, 437371108u, 3454488779u, 2151384078u, 1514762405u),
+    SC(3140765176u, 3623124217u, 3204258419u, 1994235030u, 4141313973u, 3067394014u, 3891883464u, 3387486245u, 3254639322u, 1970078634u, 2106725210u, 2833086525u, 1670513208u, 472865524u, 2121280699u, 2548725819u),
+    SC(309446023u, 3610145983u, 678094472u, 3223511337u, 4188624231u, 2675209562u, 619208065u, 1214683627u, 307823706u, 3407147709u, 2103429213u, 3636822787u, 2441204583u, 1675916090u, 1444359140u, 2979809856u),
+    SC(1982287011u, 2286805587u, 3436767742u, 3002584758u, 477850697u, 439716674u, 3863581947u, 2155905635u, 220608999u, 1402913678u, 2974580099u, 1207717136u, 3265452095u, 2174870701u, 464004734u, 3218951674u),
+    SC(2374025586u, 3926883961u, 3555874460u, 1238670328u, 856489843u, 4258163476u, 977941661u, 3889087192u, 2262660846u, 1677408901u, 2922467369u, 1043137100u, 4279650771u, 3357788771u, 1512036754u, 2539641395u),
+    SC(1142842756u, 272648505u, 914080820u, 4056304706u, 1529598235u, 1542384711u, 898735874u, 77881967u, 1035144846u, 702992091u, 2075420139u, 2454875215u, 1266516833u, 2974932401u, 3666315911u, 2262316403u),
+    SC(282628724u, 2966722803u, 3533567779u, 2474391608u, 1236598744u, 3094620093u, 2714845907u, 369896328u, 366951725u, 2971547133u, 2753808137u, 618960857u, 2006195012u, 551749950u, 1402811398u, 3808228405u),
+    SC(962649761u, 2486282608u, 1808066694u, 2361174774u, 234593415u, 400975056u, 83848885u, 1091105486u, 1020816894u, 1838575736u, 2668167699u, 73800319u, 2028242253u, 2121917721u, 1921251529u, 2828854963u),
+    SC(2717497535u, 366873177u, 336873963u, 978494261u, 2877822089u, 2054875183u, 2521644031u, 4057807064u, 3713415744u, 3955164880u, 2229410320u, 3755022307u, 3363858805u, 1398106956u, 800395520u, 1799982442u),
+    SC(399227430u, 164572050u, 2101616757u, 962629850u, 1654784623u, 3459989194u, 2240801569u, 1986371042u, 1911756881u, 2723553175u, 2964071573u, 3609789600u, 3185432638u, 2208423303u, 2967147750u, 4279453877u),
+    SC(282950688u, 2418348758u, 1686423600u, 1392917024u, 3343336708u, 976718153u, 671781049u, 4166009090u, 371505957u, 2474457927u, 1126253569u, 3355537407u, 4151375790u, 2105071839u, 941370857u, 331122028u),
+    SC(2127306191u, 1587304141u, 1137651997u, 1529991785u, 1356564935u, 726775332u, 1952136309u, 4003891353u, 61741949u, 780292838u, 1136081573u, 1836882786u, 528077243u, 30578492u, 465809744u, 2709331701u),
+    SC(4118645416u, 3394012023u, 348789448u, 3808052591u, 1284813572u, 265335400u, 545565522u, 929596026u, 744207086u, 3837069751u, 130735480u, 1107476780u, 910486599u, 2623115273u, 1478462314u, 2130033795u),
+    SC(1955617954u, 1897311939u, 3110934223u, 4221780767u, 1556888759u, 3849614629u, 306928433u, 3178221670u, 2099698284u, 308858727u, 2221495536u, 1221057715u, 974275765u, 2399830054u, 3285960273u, 1758193777u),
+    SC(1309372774u, 3725783295u, 3135972452u, 3122681380u, 3898315320u, 1245625291u, 3684458552u, 2498694383u, 145248803u, 3480764710u, 874108791u, 2482726617u, 434324108u, 1522025692u, 3554266182u, 2125028368u)
+},
+{
+    SC(4095464112u, 3774124339u, 1954448156u, 2941024780u, 584234335u, 483707475u, 286644251u, 3027719344u, 2257880535u, 651454587u, 3313147574u, 3910046631u, 3169039651u, 2576160449u, 696031594u, 3062648739u),
+    SC(3459141530u, 1009969738u, 35229281u, 2373814441u, 355537356u, 4228991558u, 213496956u, 1669603654u, 1552983955u, 3304370832u, 604896268u, 499179421u, 2737968344u, 807678026u, 3567168353u, 2353882345u),
+    SC(2454671851u, 2184874449u, 831795291u, 1169825676u, 1084590471u, 1942690394u, 2762211706u, 3042637679u, 2365319338u, 3552008694u, 348752618u, 993280940u, 1178602031u, 1559708076u, 3354759347u, 972286478u),
+    SC(2677560697u, 4247966509u, 151962163u, 3310844434u, 2986095882u, 3914030856u, 3436387520u, 860446559u, 4289606749u, 2343453766u, 3218454181u, 293342071u, 1238022655u, 3938175190u, 1394478132u, 4256084776u),
+    SC(3033685698u, 1795086146u, 719843849u, 255984080u, 2447365525u, 874035973u, 313642533u, 1163634918u, 2316564524u, 1195940716u, 1914843207u, 3907025376u, 23457264u, 1278433300u, 3111232984u, 668125878u),
+    SC(2135745017u, 2899432034u, 1819124473u, 2109840859u, 3124696519u, 2070710502u, 990727745u, 2752134271u, 1963223245u, 866344359u, 606159585u, 3867224292u, 3038840373u, 3295910586u, 2433460716u, 3384811471u),
+    SC(1744070416u, 383286836u, 3000319326u, 3310329765u, 4062980155u, 2749127191u, 1895582230u, 439084228u, 1884304792u, 326674045u, 377650590u, 3363592478u, 2947641322u, 1784390018u, 1332541121u, 4203919218u),
+    SC(472957101u, 1135650637u, 4212757570u, 185931877u, 2096733734u, 4238795506u, 481917546u, 1405180051u, 925427330u, 1923351053u, 2204480714u, 3944038373u, 372144582u, 3395978522u, 3795034464u, 1074487901u),
+    SC(227727393u, 2219043153u, 2909459085u, 3082645761u, 1970114976u, 3426610084u, 35253812u, 3123666967u, 4231900027u, 2888054525u, 2744804820u, 1500359618u, 191232240u, 3239664209u, 1569663960u, 1330983134u),
+    SC(996304063u, 2759713926u, 1022152104u, 4268512678u, 2870837640u, 3507597858u, 1252922637u, 3276898019u, 3824649934u, 1524401760u, 2559990337u, 1660220688u, 2350855385u, 609332995u, 2406016501u, 2406242521u),
+    SC(3333888266u, 3838886221u, 3016467419u, 3341790649u, 3667104212u, 783789160u, 1310400762u, 3633793516u, 4105695306u, 2973076533u, 455893547u, 2864660063u, 3696934279u, 2872882056u, 2264350097u, 539812697u),
+    SC(3263458726u, 2820785414u, 3760367911u, 628854049u, 1473785327u, 426717862u, 2025377226u, 3498407835u, 3577945153u, 1319190911u, 1062047947u, 3346460201u, 2590672215u, 2723591074u, 1487439866u, 4217021014u),
+    SC(2076058913u, 33130418u, 1949000294u, 3536165044u, 31327487u, 1891010986u, 2347335564u, 1669503944u, 3753248202u, 881959988u, 3846164684u, 3636142472u, 208517894u, 3407391141u, 3485893709u, 1074365179u),
+    SC(2175348532u, 3463201667u, 168136052u, 2889266255u, 4105885613u, 3068947090u, 2279310533u, 2649966235u, 828612565u, 2017635648u, 1260407590u, 1970316631u, 2447304459u, 2893112079u, 2425504835u, 1197046834u),
+    SC(2653983058u, 1419924288u, 2320709126u, 3640188854u, 2683911962u, 2643927342u, 3261193464u, 3929873787u, 2878724355u, 3436083049u, 3424148509u, 1311037973u, 3116391362u, 2037892948u, 454042580u, 970415398u),
+    SC(16199673u, 2464180001u, 89776423u, 672570852u, 2291071982u, 3899998968u, 4262439281u, 412856039u, 3677249728u, 1182323568u, 3472045521u, 3554674668u, 819725249u, 4078699211u, 2037243914u, 4166444096u)
+},
+{
+    SC(1740919499u, 3877396933u, 2326751436u, 2985697421u, 1447445291u, 2255966095u, 1611141497u, 1834170313u, 3589822942u, 2703601378u, 299681739u, 3037417379u, 4014970727u, 2126073701u, 3064037855u, 2610138122u),
+    SC(2959647136u, 3814991611u, 764778261u, 1677371416u, 497556143u, 1000564042u, 4065791500u, 1027030318u, 2636763418u, 2469599275u, 839050056u, 4115114412u, 3982189672u, 2204140838u, 1747652790u, 3786215179u),
+    SC(3812425833u, 3703652912u, 1980699604u, 1506061914u, 2330998846u, 3874717363u, 20614012u, 1484655664u, 2896690261u, 1196646483u, 159078055u, 1300317512u, 2570981831u, 1267318554u, 3037645632u, 3117135345u),
+    SC(2012483448u, 279997059u, 1908492604u, 1638405820u, 284407565u, 1607271004u, 1423855670u, 3949669604u, 1635878907u, 4045715556u, 3600475894u, 3387647818u, 3950223476u, 3109131487u, 2524676171u, 3329048150u),
+    SC(3505120665u, 1999377488u, 158974979u, 636438923u, 1767149410u, 2424026197u, 532320013u, 3350230775u, 3506414357u, 999737675u, 3415715721u, 797201045u, 3439137094u, 3636888232u, 1001867404u, 1070514934u),
+    SC(803341976u, 972240723u, 2174569332u, 4037031657u, 720363583u, 1532359940u, 222173943u, 3948724459u, 669414977u, 446802288u, 4195328223u, 2316597014u, 3039478974u, 1217500351u, 1058613984u, 3974805650u),
+    SC(2497689022u, 832535973u, 4012390289u, 3862385792u, 473134599u, 855172718u, 3160709443u, 2946049581u, 1340978834u, 1282260619u, 3672935594u, 1114896253u, 1194768191u, 2151967837u, 3557909289u, 83919397u),
+    SC(2685697085u, 4183307820u, 393931333u, 2425217781u, 2950365274u, 2300063381u, 3990090983u, 1961757942u, 3357278228u, 2993935030u, 779960569u, 3652282828u, 1743505267u, 3193034940u, 2134245237u, 4042181132u),
+    SC(2449311128u, 4037657778u, 318968012u, 1098807866u, 3241626396u, 745989749u, 4126255071u, 850508142u, 4075976689u, 357235455u, 2000916706u, 3900438139u, 2804084317u, 3036848582u, 604252796u, 2006800965u),
+    SC(101955641u, 2732365617u, 2730133770u, 3908553062u, 2872853047u, 264325893u, 2086018926u, 546076667u, 582367640u, 2242336949u, 2223649162u, 1521240572u, 178342991u, 3408523296u, 2216853754u, 1636770650u),
+    SC(1697876449u, 998213608u, 2367869150u, 3635535434u, 3029347602u, 2697162358u, 300760335u, 3790588806u, 3127970813u, 157171921u, 2766714052u, 3441353031u, 3760111386u, 1962222723u, 1338315915u, 1705537099u),
+    SC(2069540711u, 3174156395u, 3834082852u, 2243125169u, 1332693007u, 1773075089u, 820191370u, 262117783u, 184405617u, 469065021u, 1286610377u, 946922506u, 2233109630u, 2803987975u, 489850357u, 3341265389u),
+    SC(3152895344u, 3190413328u, 1371373852u, 2133030998u, 2097773989u, 3484604561u, 3233580762u, 2103971308u, 580626917u, 3723142348u, 1233964596u, 2884246809u, 1451113068u, 2274332609u, 834566918u, 4166322862u),
+    SC(474309298u, 31198476u, 474732582u, 1614612386u, 2339718649u, 702598622u, 2007092771u, 1563921691u, 3096928870u, 2036801390u, 3171632090u, 2666464957u, 2581592302u, 84487705u, 4066440296u, 250703600u),
+    SC(2850943751u, 3355276358u, 3608928556u, 645558581u, 1754003398u, 2401097307u, 4007141515u, 2306720640u, 2585847442u, 2486681168u, 916961025u, 2906286711u, 2183350629u, 3403456959u, 1234360906u, 608407455u),
+    SC(3919397u, 2910764499u, 1130649170u, 2504839137u, 475960727u, 4198145923u, 3575554927u, 727034596u, 3487299979u, 2134210036u, 1295494166u, 1094003986u, 3153584442u, 1125501956u, 1050325095u, 3018071122u)
+},
+{
+    SC(1456510740u, 215912204u, 253318863u, 2775298218u, 3073705928u, 3154352632u, 3237812190u, 434409115u, 3593346865u, 3020727994u, 1910411353u, 2325723409u, 1818165255u, 3742118891u, 4111316616u, 4010457359u),
+    SC(2413332453u, 1353953544u, 4051432026u, 303594340u, 1259813651u, 366336945u, 3380747343u, 2634392445u, 2066562619u, 120707135u, 1398541407u, 502464084u, 2984999938u, 3829298149u, 1120989122u, 3373752257u),
+    SC(1681071159u, 120984332u, 2029459879u, 1382039080u, 3634662556u, 54408822u, 48099449u, 1179080842u, 2669759950u, 3169946602u, 1520730683u, 3878549631u, 1666070500u, 1804495215u, 1101808889u, 1988315741u),
+    SC(1810699040u, 1982264875u, 1311915666u, 268159494u, 1265118580u, 1494821999u, 2740360551u, 3403457379u, 2370002476u, 3663200326u, 1969174367u, 2988878975u, 2261867571u, 1896957751u, 4228495601u, 268030737u),
+    SC(3788031612u, 1459331879u, 4195039120u, 148760443u, 2710036304u, 3803193725u, 2316636996u, 1290739855u, 2078515077u, 1158390637u, 187516666u, 1165781180u, 3871854912u, 2887741280u, 3432370474u, 3017515415u),
+    SC(2660400581u, 1115514969u, 819611304u, 2438542525u, 1149450061u, 641570348u, 4195260176u, 114239580u, 3415942550u, 2418164759u, 3596450733u, 4170880111u, 3742333800u, 707266970u, 294392938u, 1502400257u),
+    SC(4244209414u, 4144723933u, 1206802017u, 3395049043u, 1534528858u, 212213384u, 273948964u, 2465871688u, 98513287u, 526054552u, 101003852u, 2178852720u, 1739213138u, 2000068838u, 3443316390u, 2907641948u),
+    SC(4170329393u, 2397160575u, 698736458u, 1726629095u, 2059726015u, 608224441u, 940962377u, 3160021800u, 2474105021u, 1418624931u, 3220142189u, 3165061177u, 609263259u, 3526248509u, 2451110984u, 882122082u),
+    SC(1803413035u, 2626850042u, 3923382679u, 2501640460u, 887077755u, 2970691407u, 3982443858u, 546345352u, 545064661u, 1905866916u, 4137411501u, 4293519422u, 399697152u, 2101209662u, 4081268472u, 3745325674u),
+    SC(3913855272u, 3324082002u, 2401043817u, 1769760109u, 2460560183u, 875956117u, 1942607787u, 1641754800u, 1964565342u, 442388011u, 1687580604u, 293988342u, 3046598358u, 2835075967u, 920490836u, 349604594u),
+    SC(2643665013u, 1607952309u, 2279132309u, 992705865u, 1231530495u, 2682680275u, 2340070945u, 1036310446u, 2160469638u, 3849593659u, 569936175u, 133751759u, 1309000826u, 3681058360u, 1289881501u, 385711414u),
+    SC(1190130845u, 2798968177u, 277741425u, 3875973536u, 2502592372u, 251555512u, 1825737360u, 462006518u, 2334535950u, 3997809264u, 2012251623u, 3408888487u, 2549759312u, 3379458376u, 2301581275u, 4171117892u),
+    SC(1923456093u, 1653002750u, 3279649712u, 4281661052u, 1248011568u, 933375742u, 2109342469u, 751470571u, 2742486580u, 2572871261u, 3296809419u, 4075155428u, 3182626853u, 3435860599u, 3916597057u, 245531435u),
+    SC(514908612u, 2222061780u, 506774061u, 381342968u, 789366883u, 3683832850u, 9270407u, 528428861u, 590313143u, 483933274u, 1128871308u, 2791400346u, 3033966006u, 2397900561u, 174539653u, 2363998101u),
+    SC(3558289816u, 1015432688u, 3960686128u, 2087286003u, 446928557u, 4028273076u, 3055038539u, 885707705u, 942001648u, 3175434773u, 3929872598u, 2961036794u, 1122092143u, 2142675404u, 4054255588u, 1958229328u),
+    SC(2852327378u, 1383667573u, 3763466478u, 3195889922u, 2107642962u, 1739908882u, 157313327u, 492435243u, 4236498733u, 1510923342u, 3227437908u, 1896980749u, 154410481u, 2958311799u, 3270353062u, 1889012642u)
+},
+{
+    SC(822693957u, 1703644293u, 3960229340u, 2092754577u, 3495958557u, 4288710741u, 4092815138u, 1275224613u, 2592916775u, 472063207u, 2931222331u, 2597044591u, 1261640449u, 1272207288u, 2040245568u, 1417421068u),
+    SC(57865933u, 2591783175u, 1332940705u, 2361514832u, 2842982424u, 2581566511u, 1328343723u, 3898369656u, 2090549923u, 2179715082u, 2370481583u, 775215786u, 3850307123u, 2489521783u, 3999750482u, 1014134079u),
+    SC(2011629934u, 1914036612u, 3406392133u, 1425412057u, 1338374071u, 683386303u, 3190457777u, 428137206u, 1251032257u, 3672462899u, 2593185313u, 1953316437u, 2123216916u, 3258622817u, 3197533388u, 3442579011u),
+    SC(265734183u, 884987600u, 2786263189u, 3536027957u, 3885575220u, 1854265340u, 3853595664u, 1987453181u, 2744740518u, 512197390u, 114481815u, 96285071u, 3293497789u, 4015333892u, 4092376929u, 3025411574u),
+    SC(612519829u, 3198151239u, 3191059512u, 226844204u, 3503855660u, 764021515u, 3628841562u, 3951882416u, 3622158804u, 3603368155u, 2780109382u, 822859403u, 25907739u, 3882220368u, 3789068172u, 1684074913u),
+    SC(3520260226u, 1656105499u, 1676578448u, 838040958u, 3130046810u, 995588852u, 3233766730u, 2629592527u, 3096399775u, 1659682138u, 1365617549u, 2450677843u, 1725372848u, 2623357383u, 1402837393u, 1993344168u),
+    SC(2434333993u, 2901722469u, 518468307u, 3322336116u, 3303354477u, 2422295273u, 3584734361u, 1255342255u, 2224600785u, 3752112711u, 3720624102u, 3425652159u, 3563799906u, 957522630u, 501907560u, 3362627156u),
+    SC(3271809032u, 2402529419u, 3935184016u, 3639910664u, 659985988u, 2584831332u, 1091987512u, 224789177u, 2944016703u, 3591574599u, 1273021052u, 967556634u, 1019501719u, 1864898605u, 3453844870u, 4011599553u),
+    SC(1326048883u, 3477092042u, 1799777609u, 296885426u, 1109310872u, 255028335u, 163456938u, 2108662143u, 3501831646u, 225777648u, 4099069764u, 3428610561u, 4069711767u, 3876386370u, 1215899260u, 369937558u),
+    SC(3466874302u, 1921411468u, 3753149186u, 3739960133u, 1909238781u, 2219053499u, 4040572016u, 1651280893u, 754573870u, 383500798u, 2400558032u, 922698902u, 2125517085u, 2541623325u, 2827334144u, 2773618829u),
+    SC(2040368526u, 2190975469u, 1347589661u, 1684817146u, 2021572959u, 1656810013u, 330975936u, 994237514u, 2596719101u, 3800849855u, 600269956u, 1857741551u, 3033366103u, 1496147464u, 2628189942u, 4210116847u),
+    SC(3076719908u, 2490548320u, 377911263u, 2002478742u, 2549252529u, 839159951u, 230337140u, 3095221595u, 1528132928u, 2083899038u, 2503451113u, 272698731u, 2624407067u, 161482016u, 4135914440u, 2519252428u),
+    SC(2556876861u, 2107629748u, 2377697213u, 1433609947u, 3343742332u, 3505415093u, 2690575000u, 2017949066u, 4133794057u, 4184820210u, 2960078982u, 1333558937u, 3733636790u, 3960011078u, 945143131u, 3343864106u),
+    SC(1801254589u, 1449097227u, 181948563u, 1034221031u, 1779862110u, 3141289560u, 3383585093u, 2578193674u, 554670851u, 2530857925u, 4076682145u, 2827602863u, 4244507626u, 2938597885u, 3223414171u, 2204001183u),
+    SC(291814305u, 2937237569u, 1434020428u, 3585179044u, 3677832974u, 2016114805u, 3981784693u, 538800869u, 2673738915u, 999373833u, 1457987857u, 3180983013u, 501300267u, 4103517997u, 997980659u, 1113009463u),
+    SC(3993610129u, 1037741502u, 330412440u, 2749687355u, 1555232145u, 1196959672u, 530284980u, 340384986u, 2298150586u, 3185141181u, 26985524u, 2219307959u, 2447245692u, 1065988754u, 1248620406u, 2208024308u)
+},
+{
+    SC(3660855132u, 3816892380u, 3431508003u, 1440179111u, 768988979u, 3652895254u, 2084463131u, 3991218655u, 323118457u, 3675476946u, 2157306354u, 2684850253u, 1543808805u, 744627428u, 1091926767u, 3538062578u),
+    SC(2810298495u, 3411171710u, 4062828084u, 3003344135u, 3264709694u, 1048068132u, 3549102117u, 1927032841u, 3841604555u, 1360558064u, 2204714588u, 1197341693u, 3768005385u, 2899352192u, 2849083812u, 3793398404u),
+    SC(3631867959u, 3146872034u, 420513606u, 2446059169u, 2652499910u, 429155541u, 748397809u, 3543114527u, 235482177u, 894763888u, 1086818023u, 3285579564u, 1810274445u, 1142434275u, 140188668u, 4059040723u),
+    SC(2682453748u, 1595694625u, 17869409u, 4001607469u, 759206176u, 3336900820u, 3693692341u, 2473365492u, 2714988574u, 637563477u, 4105755464u, 3161387095u, 2814461644u, 4283494186u, 3858290792u, 1516784203u),
+    SC(4062605051u, 1956634460u, 3701616314u, 2342355265u, 1267526896u, 464674235u, 2247549950u, 3633206724u, 296547100u, 2905295542u, 4077085273u, 2746567644u, 1803616500u, 918536622u, 2709233803u, 2413530101u),
+    SC(1383097263u, 1316928613u, 759541292u, 3793001510u, 257497874u, 3658838865u, 3213596633u, 3650670599u, 63812226u, 1947202098u, 3651967368u, 2399936732u, 2521262969u, 322630211u, 4004516883u, 1422335688u),
+    SC(2852550033u, 3224936812u, 733055828u, 3325391168u, 1930707186u, 731324754u, 3498518219u, 4117056191u, 2179511600u, 2761523161u, 4282458808u, 3042559735u, 2438675720u, 2532100345u, 3706723018u, 4059342362u),
+    SC(2048163474u, 1848349034u, 3258863528u, 3644103333u, 1151231486u, 3308192205u, 2814277731u, 4197063636u, 3510455851u, 1315219655u, 2185965649u, 3799505477u, 4254363720u, 3128925961u, 1852465545u, 4138612075u),
+    SC(960983998u, 3301464188u, 2737893955u, 1522861436u, 4164105020u, 1184099683u, 64022400u, 2368856028u, 326418376u, 2065332946u, 2081529277u, 3466798514u, 208026276u, 417986090u, 3587033208u, 2294843214u),
+    SC(2712989146u, 349068332u, 3978782854u, 1513755929u, 4281030368u, 4041238337u, 1631550267u, 936378809u, 3831648862u, 1780262732u, 3189639539u, 328937247u, 722753719u, 3671027558u, 215485348u, 294998383u),
+    SC(170533035u, 3100330628u, 2519007245u, 2729143680u, 1780483799u, 1771308699u, 777046078u, 1252661309u, 944830935u, 3219243484u, 2959537667u, 145170296u, 892161275u, 1151850054u, 2176346749u, 598783080u),
+    SC(3596882604u, 51304713u, 1277701547u, 3288737023u, 2143659411u, 1229626338u, 2504854740u, 2518260221u, 2909459409u, 3820898741u, 1076396276u, 3330086214u, 2070741501u, 1675949151u, 4169029889u, 2072266145u),
+    SC(3395707749u, 1912264784u, 839246291u, 1812660322u, 2590197689u, 3115125394u, 280633483u, 1476186344u, 2182942190u, 4022517575u, 1314348304u, 2211853573u, 1730367526u, 3842875309u, 1411362967u, 749836026u),
+    SC(822183119u, 2084092802u, 2957672615u, 1548122281u, 2555590320u, 4127903458u, 704941703u, 3216796016u, 1310798669u, 1681974379u, 2704001393u, 836064664u, 2498528840u, 2878347924u, 3344415063u, 1714110968u),
+    SC(3763417450u, 1647484613u, 2916400914u, 1340277384u, 3671023234u, 2962715012u, 2086976330u, 2356641838u, 861453503u, 2497852292u, 3384683911u, 2044029625u, 3423593678u, 602612346u, 1947876325u, 1071593133u),
+    SC(502143537u, 3800930061u, 289630048u, 2019675509u, 690814111u, 1395759030u, 2095320716u, 1658529388u, 2140950369u, 4113871752u, 2130755443u, 1184235968u, 2624156111u, 1053548247u, 1666584094u, 3436241707u)
+},
+{
+    SC(2819478132u, 2629026829u, 2945562911u, 1854605392u, 41922071u, 2531530491u, 2316774439u, 3550381961u, 1180787169u, 3914439365u, 3786421842u, 3441223373u, 494782102u, 2858003292u, 1448968751u, 2940369046u),
+    SC(1228705098u, 2320747717u, 1742025124u, 3358828738u, 1857762103u, 2669617968u, 2684123743u, 2427291148u, 3948024171u, 3841263454u, 3817968782u, 3617000488u, 3457510946u, 3443415072u, 3976288418u, 291039859u),
+    SC(1118114309u, 1364783097u, 3986370035u, 1058514953u, 3723130907u, 2966082807u, 1592373613u, 4029958112u, 1261460522u, 159904028u, 385928252u, 2962822321u, 213058425u, 39305506u, 3400567258u, 2953928339u),
+    SC(4004285350u, 3275325131u, 2912133301u, 482119944u, 699333459u, 1353300830u, 498723416u, 2738735797u, 3773472794u, 1167510524u, 1995708610u, 1872986795u, 1771998886u, 460328822u, 2566240531u, 3665251184u),
+    SC(870908870u, 249845288u, 3674648542u, 3670939624u, 3213883826u, 2765218754u, 3292181727u, 1765634472u, 2846619223u, 156162860u, 2158300764u, 3792761756u, 4248292998u, 1588571137u, 1696144875u, 2915693433u),
+    SC(1257645965u, 743351844u, 3299328612u, 1606739395u, 2242479072u, 526126122u, 3132670209u, 2327012389u, 1257540758u, 1688790030u, 864103666u, 1782879705u, 2344074317u, 878043196u, 569218289u, 3875319913u),
+    SC(676712446u, 2310487862u, 3297058723u, 154140360u, 1534807165u, 2207878247u, 4002312458u, 1195155314u, 3973562995u, 203866583u, 1307033594u, 1808951889u, 3485439766u, 2123920858u, 3400721970u, 628518531u),
+    SC(453432196u, 3506137302u, 962794710u, 2800823697u, 944975983u, 445662356u, 620440622u, 225699982u, 1038708892u, 3484553780u, 4174808994u, 3862318255u, 1961625058u, 2183421173u, 2682639230u, 3890472885u),
+    SC(3472048934u, 1436162338u, 4281682055u, 1419885595u, 1926695253u, 861477946u, 2586543901u, 2286266784u, 2854911092u, 1779735787u, 2994125983u, 2248840912u, 677288518u, 3593153557u, 3383199489u, 2094768467u),
+    SC(971218259u, 3653638590u, 3374334294u, 479058129u, 1331477004u, 2497262229u, 892109896u, 3651901580u, 1455849852u, 2738531309u, 14202660u, 1968080740u, 1927308794u, 897128363u, 3654300057u, 1275380700u),
+    SC(684658124u, 660984744u, 2929312783u, 1473333980u, 1562502960u, 656352357u, 338449257u, 2159155320u, 2425193686u, 930413364u, 2001285554u, 307432757u, 2238003500u, 1858295105u, 481986971u, 1067622012u),
+    SC(943383548u, 127299943u, 2909652237u, 1257655712u, 4123282405u, 78394323u, 1736026340u, 2126927829u, 296638455u, 1861436609u, 641299684u, 636649068u, 3331138991u, 1014270261u, 257248847u, 1556179874u),
+    SC(2668740334u, 4261010365u, 3376970497u, 2258271000u, 3369826513u, 906131732u, 12531263u, 2501581679u, 861444520u, 2059219969u, 3536488433u, 3392343056u, 3231250347u, 3425501702u, 4204845226u, 3883035310u),
+    SC(875006280u, 3061145215u, 799684212u, 4150716124u, 1344915012u, 1442298502u, 887378800u, 2722425542u, 4141895498u, 4068116328u, 601774281u, 3538746538u, 1671758462u, 3066546971u, 1116345758u, 554718074u),
+    SC(1149406575u, 702696847u, 505403366u, 331269161u, 664926760u, 2151357672u, 2890104906u, 3156886545u, 1199701084u, 1614409973u, 4222014462u, 1336462493u, 3214687968u, 1279434993u, 2285235388u, 2975474024u),
+    SC(2419658919u, 481424988u, 2207220911u, 2736159805u, 4086711147u, 477511738u, 1428567116u, 3971000648u, 429362137u, 3495313342u, 3653961670u, 4170077754u, 2057308114u, 1445981917u, 97057494u, 3847612010u)
+},
+{
+    SC(3017729014u, 3423125690u, 1534829496u, 1346803271u, 888659105u, 1661894766u, 4165031912u, 697485157u, 3575889724u, 1795181757u, 1507549874u, 1480154979u, 3565672142u, 830054113u, 1507719534u, 3652903656u),
+    SC(4123340423u, 2168639254u, 3491407759u, 395600125u, 2056091205u, 1233197217u, 2716612715u, 3263564356u, 2257286689u, 2753339767u, 2228663460u, 3584404544u, 3972978154u, 3637886739u, 3854541466u, 1603898424u),
+    SC(641806023u, 3776877383u, 3574980110u, 2564901152u, 1378226343u, 738790225u, 4030459977u, 2255719927u, 295765315u, 60094770u, 422069111u, 439158593u, 3956842123u, 1242303994u, 150522972u, 3682386439u),
+    SC(2385589330u, 2076597417u, 605447848u, 3200763641u, 3106877254u, 3374069827u, 3828392492u, 1315607291u, 3211667999u, 305089333u, 179172787u, 3225149656u, 1080822644u, 3286534940u, 2231515542u, 2699760148u),
+    SC(3983719183u, 1208009460u, 767048521u, 326825213u, 1087716958u, 3599826498u, 3107818740u, 2785268698u, 1304576537u, 1847155836u, 3250405674u, 2694326935u, 2163030471u, 3253944705u, 1698753082u, 3845065767u),
+    SC(2823293375u, 2790862099u, 1207038844u, 3886043838u, 3567640686u, 3799791258u, 1638354726u, 1428653770u, 2075289233u, 1582582790u, 213364421u, 2858522524u, 2809903954u, 1742449197u, 324107072u, 1051562955u),
+    SC(2291926834u, 1805734123u, 3420689573u, 1003089617u, 476535216u, 1334543097u, 2045923069u, 2990972415u, 1822043289u, 2128934150u, 3541372378u, 1912558832u, 2295908612u, 1500502429u, 3539272060u, 2641558214u),
+    SC(3069594753u, 3051481608u, 2339450545u, 2054924228u, 4282917353u, 65440790u, 2134400604u, 3588265957u, 2569563771u, 741034486u, 740973978u, 93172292u, 1583303041u, 2980574219u, 2969067524u, 1088571815u),
+    SC(78721532u, 1566330912u, 1219109269u, 3229207312u, 2345730495u, 3209647323u, 2033975193u, 1009666575u, 2794060854u, 4218956981u, 3379703631u, 2400336569u, 100401885u, 3519721431u, 4007729122u, 3851183625u),
+    SC(2344993313u, 2454241381u, 3071516966u, 4207668067u, 250885582u, 1733938903u, 1658948056u, 2192440210u, 1717829063u, 849763004u, 2334162093u, 3715296533u, 1757279167u, 3270001477u, 2677428083u, 4197601814u),
+    SC(2911676146u, 4069956071u, 3299890629u, 3133371278u, 3551760603u, 558967408u, 205243474u, 237180706u, 4227661901u, 390685951u, 658498389u, 225847327u, 3028263358u, 3941067795u, 1850521034u, 1584413524u),
+    SC(304549398u, 3089811378u, 549382137u, 2353383127u, 2278640956u, 781853185u, 1734676013u, 3311472816u, 957105351u, 1291924767u, 2025324585u, 3897237789u, 80455313u, 302089802u, 3496158310u, 4000611245u),
+    SC(1221283087u, 3865703766u, 1551786763u, 3208862988u, 2964616465u, 1429406173u, 2847895093u, 3047143885u, 3187847794u, 3875229246u, 2044093786u, 2855772466u, 2252977997u, 1253496627u, 1824313803u, 3492626272u),
+    SC(1435191953u, 2954553263u, 3689501374u, 3761866706u, 3160683386u, 2172174457u, 4033800334u, 2293562561u, 500568896u, 2877151546u, 112648553u, 2760351679u, 1976713840u, 2960166087u, 1364536484u, 4127293522u),
+    SC(2942286091u, 3570696800u, 2680748212u, 879905933u, 371824626u, 2796545677u, 2544287558u, 1654320774u, 3724452395u, 1875952433u, 1755420330u, 700510406u, 2122483560u, 357724466u, 2579725929u, 4152935597u),
+    SC(732269412u, 3045632405u, 947036931u, 2403831527u, 2919479301u, 2947112020u, 1653738112u, 2316444303u, 3103978479u, 2856978461u, 308282125u, 1154683958u, 2086296447u, 1288456128u, 528614237u, 2945631134u)
+},
+{
+    SC(3751554592u, 1759634227u, 4138518211u, 3130599659u, 3881948336u, 669688286u, 3672211577u, 695226401u, 1226786139u, 1855160209u, 905875552u, 2831529665u, 1625185017u, 3130043300u, 3227522138u, 3659203373u),
+    SC(399372699u, 529779700u, 1206056828u, 1867177702u, 196488961u, 2148657353u, 2522788662u, 2308787051u, 1566407979u, 857878238u, 2852634973u, 2131204123u, 2812808340u, 3651465982u, 1947448513u, 3757182587u),
+    SC(3732610632u, 1025396308u, 60450219u, 3075208965u, 2460440177u, 301478800u, 2020185415u, 2910424285u, 1627945543u, 473410099u, 4114096970u, 2440686062u, 3031404169u, 2099206907u, 1232790956u, 2248800462u),
+    SC(2343232878u, 1198836246u, 1270188071u, 2305538045u, 1841160260u, 1049160535u, 2935147928u, 3818293360u, 2128394208u, 692132409u, 3183837651u, 981952986u, 3501941431u, 1239605342u, 1265208179u, 225920797u),
+    SC(1958540456u, 418545838u, 1645667403u, 4203505141u, 81660142u, 351421726u, 2877676470u, 871152679u, 2804776066u, 431108218u, 927442607u, 3782508732u, 318483929u, 4079394971u, 1143889788u, 4195920424u),
+    SC(2351179626u, 1598459225u, 3579449038u, 4292231882u, 2911534527u, 3174868713u, 2883217980u, 1046921244u, 3074833211u, 117299980u, 3425406982u, 2813303717u, 879305153u, 3439142119u, 1270010014u, 2633468950u),
+    SC(3394012837u, 1133386629u, 2931266329u, 2512080059u, 3268046571u, 585832644u, 1151303760u, 4164956195u, 1787214290u, 3523549326u, 4139598868u, 530139359u, 2107355242u, 1401770006u, 4264627539u, 3014221080u),
+    SC(1988836761u, 3474599222u, 2535855552u, 3118306895u, 1953046625u, 30632894u, 8987922u, 1482010220u, 1585584845u, 441041520u, 3045700482u, 362734762u, 3723600227u, 1056985402u, 2472480517u, 3558297033u),
+    SC(4137318322u, 915055827u, 1432589840u, 3550795442u, 1919127293u, 1256417138u, 946345068u, 1353195020u, 2948635882u, 3916808200u, 3223857138u, 2259986522u, 636089773u, 2116476405u, 266813303u, 3992924481u),
+    SC(1294364269u, 2282087282u, 719947200u, 1065389577u, 67185303u, 600695627u, 3423704882u, 507439949u, 1464333499u, 954935833u, 1949391476u, 2146234814u, 640934838u, 2477152026u, 3767255766u, 2397668523u),
+    SC(1825548026u, 2780595753u, 282065873u, 3347141416u, 3152283414u, 1656153711u, 1047376382u, 3616949007u, 464657631u, 3299783240u, 1162505878u, 3862534742u, 3899846651u, 3980167606u, 2513773976u, 1803555687u),
+    SC(734708953u, 181663675u, 2018505992u, 1055015000u, 2266993350u, 3679506170u, 1032089726u, 2239152753u, 3271229362u, 257492591u, 519168390u, 890304984u, 594386284u, 933877218u, 2646719799u, 439652468u),
+    SC(1253204385u, 2215899770u, 848155650u, 1305331452u, 1831981169u, 4101626048u, 253253616u, 718148001u, 3846087699u, 2362703617u, 564971301u, 878503956u, 2792594154u, 3831500219u, 630060686u, 2654848235u),
+    SC(2082956373u, 965635733u, 1172460454u, 3057130868u, 485386699u, 558270142u, 2819896785u, 247008390u, 1884023798u, 3291747866u, 1725636793u, 1552257124u, 171155452u, 894504521u, 3157754944u, 4135144713u),
+    SC(3013624247u, 3479051648u, 3976465681u, 139584997u, 690715168u, 2972053528u, 2543659091u, 81834710u, 261064551u, 1476481099u, 2550215537u, 1381589752u, 3557508349u, 3578290922u, 1272133161u, 3008228265u),
+    SC(3507369103u, 1077600519u, 1522596015u, 3088783267u, 2852999673u, 751358577u, 733140212u, 3467225217u, 100497019u, 50410977u, 68742811u, 3090618848u, 1603912616u, 2272476179u, 1767751118u, 3249696448u)
+},
+{
+    SC(2950670644u, 1870384244u, 3964091927u, 4110714448u, 298132763u, 3177974896u, 3260855649u, 1258311080u, 2976836646u, 3581267654u, 3094482836u, 80535005u, 2024129606u, 168620678u, 4254285674u, 2577025593u),
+    SC(1515179601u, 3578614970u, 3088354879u, 797813018u, 1355130048u, 1083957563u, 119796717u, 2021253602u, 1525138732u, 4127381203u, 3062851977u, 4142386071u, 1213064952u, 3609844670u, 1484215992u, 3431673114u),
+    SC(1401099367u, 3953214819u, 830584870u, 2207781603u, 918659453u, 4293181358u, 4072336467u, 4282551694u, 262435288u, 1941569548u, 147995405u, 1811389750u, 4118444114u, 1252574507u, 578798636u, 1074483177u),
+    SC(2872591360u, 1058667772u, 16799222u, 688522560u, 3475129040u, 3433794124u, 1076991040u, 1425059515u, 2939587530u, 236447274u, 3960100164u, 1298525395u, 2761371754u, 4025787449u, 2464666072u, 3981743594u),
+    SC(3976786453u, 1358319886u, 3905641993u, 1405765539u, 2585003073u, 3447572652u, 741448872u, 3444688769u, 971292808u, 1486657617u, 3079335839u, 862424956u, 248802634u, 1703726921u, 2982469234u, 2682500687u),
+    SC(4273605693u, 2467118193u, 3538801384u, 3862847335u, 1065478730u, 1602785515u, 1071410798u, 2624755760u, 2768741032u, 2700950902u, 558848464u, 3400938789u, 1410632048u, 2094050860u, 1686695852u, 2101955993u),
+    SC(4124709913u, 3191744141u, 3038636619u, 2944952304u, 2687117769u, 1502766822u, 14738299u, 223780235u, 32298390u, 1195949618u, 1154476371u, 1873391152u, 273358443u, 2362272244u, 509120994u, 606974408u),
+    SC(3937286725u, 1520668653u, 941545039u, 3056942351u, 574018151u, 2549472282u, 82289937u, 374652507u, 619831005u, 2134744303u, 1462663193u, 2963006112u, 3726585674u, 1797461239u, 1470634776u, 3441417480u),
+    SC(2845288945u, 3925574221u, 1989126288u, 3105801567u, 210047271u, 1545005898u, 2572648420u, 2278643173u, 2633053858u, 3288168184u, 3566345146u, 165026071u, 191806458u, 4116335861u, 1768316231u, 3169297484u),
+    SC(253765755u, 2509241970u, 1926513613u, 3735004917u, 4188741775u, 2806800711u, 281300019u, 3635185u, 3462483807u, 2277745510u, 1708651892u, 1413928970u, 56262931u, 531946794u, 2864634184u, 3118504241u),
+    SC(4194010611u, 4232988065u, 1802432341u, 3448133339u, 3732370320u, 253801846u, 2726367450u, 3905836819u, 1373544282u, 2066678017u, 3439519431u, 3381452691u, 2754663978u, 535580478u, 2512241599u, 2720083475u),
+    SC(3589933363u, 4047249230u, 2311777188u, 270484672u, 1108190662u, 2080251561u, 1724842405u, 4014518744u, 1593608472u, 2342434397u, 4205240553u, 2166622191u, 3528923u, 1996089122u, 4284726332u, 989608730u),
+    SC(2475269743u, 4230552139u, 3917936952u, 3098769598u, 3209444661u, 4188126675u, 3974782724u, 3639917274u, 2711234947u, 1439392508u, 1127433801u, 478802541u, 4223040451u, 2268034322u, 2452212595u, 3508939070u),
+    SC(2413851784u, 190519100u, 3576747926u, 2710481928u, 2148944938u, 3984096005u, 2427227598u, 1001464024u, 2191178977u, 1139441673u, 3841324161u, 308061908u, 3976150834u, 1467800561u, 3226772030u, 1743883019u),
+    SC(281260179u, 1415659644u, 915707047u, 1662956706u, 911938094u, 3456789397u, 2082200558u, 947098788u, 4036848108u, 2455542339u, 1466205449u, 4158358953u, 586549709u, 850657486u, 61343079u, 2292663847u),
+    SC(3487862268u, 4116082621u, 1969417576u, 1466595601u, 3136251120u, 3697533272u, 438943523u, 1041892750u, 1141661777u, 435333448u, 3031876514u, 2121342186u, 209290199u, 256519609u, 1400190683u, 4260080502u)
+},
+{
+    SC(1406628534u, 2978091511u, 343468499u, 973866526u, 757277528u, 1142388839u, 2945536141u, 3759469101u, 3001571847u, 2170606364u, 1017327004u, 3120716036u, 468321128u, 3656061918u, 2331571461u, 1930702552u),
+    SC(3117811324u, 4230396490u, 526101390u, 3589443580u, 12282838u, 3055128772u, 453582536u, 750425919u, 87216299u, 1999749165u, 2446098001u, 1907762611u, 183870981u, 3643605669u, 4232900175u, 2946539195u),
+    SC(3903405291u, 1034986659u, 2587588236u, 1880077572u, 1696686560u, 1243434386u, 3746745675u, 2212912696u, 2031851135u, 575946730u, 2663616094u, 2706019532u, 2635197066u, 1942621203u, 3760379195u, 4173271368u),
+    SC(2892050679u, 1105289247u, 1519565685u, 2426902952u, 65580444u, 3373395323u, 2112756687u, 3658806066u, 2548718870u, 3586646888u, 3350821933u, 1921239811u, 4061525916u, 3520594550u, 1872307168u, 3464547908u),
+    SC(2889143489u, 489507550u, 788811400u, 1800916293u, 3249681744u, 1400920516u, 3917828215u, 1093821500u, 1905385813u, 2931012984u, 1800788801u, 1697549042u, 3133274419u, 3606456099u, 2156683634u, 3205410986u),
+    SC(2814687995u, 4053305746u, 484530004u, 410862009u, 246830045u, 3164065541u, 3723774424u, 3388961612u, 3438413619u, 3662326637u, 2178649434u, 3555798301u, 164350275u, 2341607004u, 3896269562u, 1591806179u),
+    SC(3226183767u, 3881369008u, 700458770u, 376569395u, 2607908019u, 1353553198u, 2636334721u, 1140283021u, 2632309194u, 1710844790u, 3031461719u, 4081969123u, 3326745889u, 4034909949u, 3950856167u, 3153389256u),
+    SC(2184243175u, 2166726232u, 3921103433u, 872887260u, 623636347u, 95935618u, 2766774027u, 697875047u, 164043041u, 993154257u, 4114304816u, 3500729957u, 409872172u, 3504722710u, 2806324915u, 717798207u),
+    SC(1913401183u, 1684394893u, 957780895u, 2366199383u, 3846687839u, 2225031745u, 50628017u, 764720583u, 2251658783u, 1601491318u, 3836612294u, 3836982164u, 1834686310u, 4239983357u, 2677791106u, 718595268u),
+    SC(641418698u, 3008658673u, 1590313857u, 1025261614u, 1545641278u, 883067087u, 405447843u, 251932751u, 890679795u, 1380695500u, 4259157180u, 4219905082u, 665298826u, 4240175069u, 1720908833u, 2268480568u),
+    SC(1323007329u, 2757671761u, 531677728u, 1863777888u, 1512057206u, 2416428007u, 297355401u, 2843988168u, 3028483811u, 4269951770u, 844221740u, 1060678479u, 2913804270u, 3550002834u, 1490208797u, 2041637686u),
+    SC(4098631786u, 3088674341u, 2277647863u, 546429701u, 239595915u, 96051385u, 2043858235u, 356783975u, 3081379864u, 1495630942u, 1713035648u, 2797737429u, 4252005067u, 1174473008u, 182861961u, 1284115192u),
+    SC(1497340893u, 2990980382u, 435071738u, 25048206u, 1369038540u, 2388914024u, 3985375113u, 3187649864u, 1375850783u, 2762762203u, 3714513839u, 1546363407u, 2343675571u, 416152492u, 1797618344u, 3540898582u),
+    SC(2184924310u, 2347360549u, 640504537u, 1253044800u, 1440674061u, 1666425671u, 3827600864u, 2022304946u, 2918906490u, 263308814u, 3892002350u, 1942380643u, 1520343008u, 1245225248u, 3081248535u, 2098883649u),
+    SC(2377054091u, 3295547231u, 2240796492u, 1757295037u, 62158041u, 1809272299u, 4005194159u, 1592984938u, 366675588u, 3144502911u, 2973082795u, 4105706826u, 2851896979u, 3262002710u, 3082369242u, 634669574u),
+    SC(729159370u, 3948971047u, 1511320403u, 3061460707u, 3090283349u, 1868816562u, 3759558902u, 3868199437u, 2438888892u, 1660478281u, 2415784493u, 3546303863u, 3144683831u, 3066258755u, 2228021651u, 3294706852u)
+}
+};
+/* Window size the odd-multiple tables below were generated for. Any
+ * WINDOW_G up to this value can use them, since a smaller table is a prefix. */
+#define ECMULT_STATIC_WINDOW_G 12
+static const secp256k1_ge_storage secp256k1_ecmult_static_pre_g[1024] = {
+    SC(2042521214u, 4191992748u, 1436574357u, 3464956679u, 43777243u, 768485593u, 1509065051u, 385357720u, 1211816567u, 648266853u, 1571093500u, 235997352u, 4246189128u, 2793755673u, 2621952143u, 4212184248u),
+    SC(4180707841u, 2455290640u, 1228164997u, 4171059753u, 3039938629u, 2205129136u, 2248274195u, 3168810745u, 948927247u, 1663952916u, 266549222u, 708309846u, 1694542233u, 885138203u, 1824128373u, 2226710130u),
+    SC(797695565u, 436674707u, 1437902629u, 173822248u, 3901457597u, 3697384119u, 3416839529u, 2990600164u, 3635159590u, 921035734u, 3571165661u, 2798240806u, 4152895259u, 2869782592u, 3702029626u, 2796315350u),
+    SC(1555951716u, 1851634922u, 2744709989u, 4075452942u, 1027709822u, 53535644u, 3911966189u, 3401906620u, 1793837632u, 3123009888u, 2736229741u, 2249872603u, 2819870904u, 335407029u, 2768774696u, 141714650u),
+    SC(2899608802u, 4039636563u, 162338698u, 2673187517u, 3768030871u, 1280829204u, 3277787405u, 4230466750u, 3425929505u, 2963790333u, 1681394033u, 1983603177u, 2916649124u, 929009167u, 97265194u, 3327106103u),
+    SC(2001397752u, 1487487262u, 1593058411u, 1892047532u, 1447663627u, 3854661777u, 3152811913u, 1570769099u, 3649347634u, 3949682201u, 38002006u, 3619140453u, 925741538u, 3757692584u, 807236809u, 3377710619u),
+    SC(4068963266u, 3648333963u, 3352416773u, 3279193681u, 2960522182u, 1628330189u, 3740131215u, 423647912u, 179343406u, 2374503049u, 1971458795u, 1707978567u, 974784218u, 1377806623u, 699779922u, 3674467713u),
+    SC(3616689487u, 2101602966u, 1514560227u, 157283345u, 837129327u, 1015412638u, 1152236792u, 3799910414u, 1478371442u, 2825679526u, 2206478018u, 684486127u, 3930107691u, 3633763237u, 3305430175u, 4137839448u),
+    SC(3741182540u, 3680991056u, 2753625832u, 132828961u, 3952646318u, 2042197639u, 1726282400u, 1244482100u, 1108454150u, 2489536872u, 3919032554u, 3534306734u, 3469866144u, 1251328246u, 3484522998u, 2656496503u),
+    SC(726573223u, 2544124882u, 2481937663u, 1146046841u, 4033531883u, 3622333735u, 1953850721u, 943217516u, 2246613952u, 932470163u, 3007514683u, 1511818771u, 436336140u, 1344706403u, 3044067412u, 3854605178u),
+    SC(892059466u, 1289556566u, 1335097907u, 753087280u, 496686082u, 1912082545u, 2167671535u, 633231829u, 840872967u, 1397290292u, 3583776805u, 2648325663u, 1243298606u, 1907426204u, 1740455307u, 3481377164u),
+    SC(799150157u, 1798885659u, 36700421u, 1502056740u, 3828005087u, 4025876265u, 3701267165u, 1321913407u, 48107624u, 694016101u, 3058002227u, 1540742528u, 404582636u, 4236781128u, 1111205739u, 1395359079u),
+    SC(2454202267u, 162846349u, 2871110064u, 1726864003u, 641482116u, 3767890658u, 1774849239u, 4114954004u, 1929473915u, 4063537886u, 1562027803u, 3735204351u, 1069604394u, 2289636095u, 3846845134u, 2546676738u),
+    SC(3672985387u, 3819487015u, 2389709615u, 2965288786u, 794234388u, 1274418624u, 2123984196u, 1039042345u, 2795359818u, 2104269032u, 3567365288u, 2130237184u, 1065599536u, 4088375078u, 2873156898u, 2428378197u),
+    SC(3293385415u, 106791214u, 2328832215u, 3417415568u, 300734953u, 4260528560u, 3869488616u, 2099439579u, 555328608u, 3459411164u, 1992579366u, 3380805036u, 235957894u, 517956037u, 2688091711u, 235824258u),
+    SC(1780767734u, 3697902852u, 3365544143u, 3738568787u, 355166547u, 918716515u, 3055314379u, 3530155700u, 3760377666u, 3267185264u, 2336182566u, 4050265261u, 2335423048u, 3494001518u, 4250821448u, 269322882u),
+    SC(379060134u, 4254983719u, 3229082578u, 4266922116u, 3457363979u, 200020294u, 4183483775u, 218879653u, 3116603633u, 2256564061u, 659952902u, 3830805555u, 2731480320u, 2655619815u, 2918096227u, 3491439510u),
+    SC(1616632577u, 2575397259u, 2557284103u, 3895773965u, 2649457504u, 4290246173u, 4186059870u, 4068111481u, 43461933u, 3841511942u, 2175241619u, 3969318435u, 3261856488u, 1337019828u, 989979113u, 90934345u),
+    SC(1657884075u, 1095810889u, 1946353092u, 1512136208u, 3702529077u, 1230614796u, 4264675305u, 3632263997u, 2164000445u, 2361765904u, 2550696473u, 1357828315u, 27923241u, 1739278114u, 905274404u, 2209504943u),
+    SC(2160462544u, 68102106u, 3730524934u, 3288917355u, 743500277u, 1805355842u, 1582652463u, 2251328367u, 473444415u, 482722575u, 652635053u, 2145857392u, 2791238988u, 3195020523u, 446701398u, 1124849018u),
+    SC(2056484269u, 1634184532u, 2859779636u, 2361740596u, 1288035476u, 2279098116u, 2640227248u, 4194552059u, 219037609u, 3970462313u, 156605965u, 2032570438u, 3183845025u, 208719403u, 47487468u, 575522807u),
+    SC(3576229081u, 3063330124u, 2423955152u, 1162115705u, 3141570243u, 2607341392u, 1270161221u, 2613313481u, 4006560037u, 825681401u, 2573660696u, 2180867438u, 3158525248u, 1548881340u, 104097205u, 557881651u),
+    SC(76771492u, 3052680210u, 3928356116u, 3907836624u, 1382420830u, 1249823507u, 2267224072u, 4172568931u, 1972322113u, 2950098242u, 2335211952u, 1362089514u, 1422128047u, 3143329636u, 3058894122u, 311729306u),
+    SC(2012360851u, 1860734139u, 3611162928u, 3594978031u, 2283634974u, 236230882u, 4055973553u, 4231290228u, 2509173802u, 2022094400u, 168306286u, 2611065720u, 2529776432u, 3648026571u, 3197023175u, 1729913046u),
+    SC(4074424721u, 3427591353u, 3930359934u, 1551633358u, 1489502324u, 2879212986u, 3945288475u, 2000287024u, 3772701851u, 992972205u, 1302459181u, 3961860575u, 2662726635u, 93906173u, 437353914u, 1882864695u),
+    SC(1178287519u, 1713775099u, 457959675u, 3190104082u, 1512139999u, 3386565598u, 3166324816u, 3331380315u, 1590964439u, 2351524917u, 1125204742u, 3716555479u, 3324174972u, 2534022627u, 481523632u, 452407422u),
+    SC(4050616386u, 1155821098u, 153300298u, 4282079639u, 1805187777u, 1126736593u, 2737084084u, 2576937543u, 3470441883u, 2183151486u, 332531452u, 3746444249u, 711742402u, 1851575846u, 3596065122u, 3303218678u),
+    SC(3405206567u, 768099683u, 2956274554u, 338762485u, 1562661653u, 2900524133u, 916329975u, 354238929u, 3410445920u, 4013290994u, 2753258559u, 2783207511u, 1599056311u, 2518823589u, 3274674307u, 413156470u),
+    SC(637585995u, 674019718u, 4166848279u, 160931211u, 1151376391u, 3414611905u, 608795592u, 1862803744u, 1092204679u, 1405180886u, 2794696767u, 3453727837u, 1522974324u, 2875133684u, 1259071815u, 1518226240u),
+    SC(1983236722u, 3622322988u, 864994620u, 3508674748u, 29656709u, 3796860360u, 3322062708u, 1771627573u, 152790166u, 155753825u, 1025334873u, 259581655u, 1322238049u, 3580905658u, 3655823152u, 744201313u),
+    SC(1968058937u, 4079310604u, 3686746759u, 3740174950u, 3086136116u, 2043963643u, 3248817987u, 3210136600u, 108264326u, 3854410511u, 3016560339u, 82463136u, 602813392u, 427452765u, 207460361u, 1012098691u),
+    SC(3823549712u, 1906436458u, 4283925916u, 2195026160u, 856162406u, 488412463u, 2682415430u, 2446965224u, 1506402491u, 2744444783u, 1086368344u, 932854966u, 2778867769u, 2481523777u, 1728064244u, 2450405365u),
+    SC(409684029u, 90833720u, 648967128u, 2406689157u, 3301749235u, 732127051u, 1287946204u, 4031424235u, 999632178u, 3330078590u, 773276782u, 541163691u, 570130576u, 2303801524u, 2762446840u, 1853917323u),
+    SC(3751637158u, 3112660197u, 1154057569u, 4106112882u, 1413670610u, 3073890761u, 444801394u, 1289786943u, 1441476015u, 3628952781u, 1602628472u, 1573100874u, 2975277607u, 552574370u, 397984860u, 4072285207u),
+    SC(1591565506u, 1012000890u, 1232906261u, 3588022520u, 2874299727u, 2225002649u, 1575373919u, 885944643u, 4021197965u, 3155432198u, 1642647232u, 818453200u, 3241961152u, 3514444037u, 3452372651u, 1939449960u),
+    SC(688363714u, 3058133040u, 3658677762u, 679386743u, 2057567137u, 3277173114u, 1915565615u, 2220969914u, 3817711469u, 3443787297u, 2559377596u, 4154126941u, 1529462932u, 3676971796u, 1828731645u, 1100234362u),
+    SC(2939961914u, 2514089395u, 88560879u, 2706418745u, 3442038063u, 3814729075u, 1658838734u, 4093983557u, 4186587096u, 837495668u, 2593370342u, 4082957120u, 3368901286u, 1738626433u, 3157257709u, 1234164166u),
+    SC(1986902820u, 3509905221u, 3435831948u, 2579441481u, 112944818u, 1842321631u, 2368728400u, 3632538778u, 1951076690u, 3939231203u, 2378991737u, 2161785016u, 2539145829u, 4194750173u, 747786135u, 3417069974u),
+    SC(1507587183u, 2358539675u, 2719119299u, 931460118u, 1173861455u, 1817799256u, 3465733734u, 421183038u, 3308563780u, 392150064u, 256812750u, 1686309280u, 1120826266u, 2031712652u, 3630047596u, 1244692334u),
+    SC(4047166101u, 272385335u, 811493662u, 1961469096u, 3714350705u, 446031676u, 3056453121u, 2365425592u, 3778549684u, 1323388390u, 1673481160u, 137633586u, 1766449690u, 1786102359u, 125321627u, 3673518909u),
+    SC(2002040058u, 243977936u, 1833002914u, 3315386956u, 3659033024u, 1857740726u, 1216696321u, 1518883372u, 820592262u, 1315347842u, 575379068u, 807450874u, 2367573557u, 191675589u, 933530455u, 2215732130u),
+    SC(2492320479u, 1502666824u, 2855826644u, 1790900695u, 25530261u, 3732947410u, 2793573529u, 3794150681u, 3834749989u, 938927511u, 3587344946u, 615627813u, 3750843631u, 3173970386u, 3417975982u, 1397216638u),
+    SC(2036482372u, 1355246614u, 2311566479u, 2181229623u, 4213329141u, 2886466069u, 1882360458u, 1031567275u, 269181198u, 3305092214u, 224141249u, 871329643u, 307264005u, 520399959u, 1622123954u, 2646094903u),
+    SC(890505336u, 882264916u, 2975536646u, 1155077448u, 1511430002u, 632849531u, 2967275601u, 938231754u, 4010474418u, 90309956u, 2383827652u, 2390829052u, 1614407548u, 365049739u, 2122126752u, 3727242001u),
+    SC(3553374381u, 1799896651u, 3348947657u, 3716924745u, 2481539051u, 2381809588u, 1117011263u, 2069003951u, 2335672866u, 3626444685u, 2311449022u, 2408908974u, 1009439842u, 2419426864u, 2947763632u, 1324212388u),
+    SC(371513415u, 2155030624u, 3457972476u, 3220168843u, 724140605u, 3105093193u, 964016655u, 4102321680u, 1751457017u, 3067777086u, 152323212u, 1826215114u, 2305325301u, 673965256u, 3423003300u, 67601781u),
+    SC(1933371405u, 2840963234u, 1761790294u, 870722200u, 1368541003u, 1525811162u, 1844950269u, 1606819028u, 4114831915u, 3535462269u, 1213877643u, 2377776334u, 1042217184u, 538854776u, 3309728700u, 499509789u),
+    SC(366560274u, 1419006052u, 3474594867u, 3151213727u, 2305213705u, 561112729u, 4012215802u, 3088843868u, 3580801803u, 1766211186u, 888476539u, 1941455223u, 1128792250u, 3468674693u, 4231511017u, 4024698637u),
+    SC(2714828018u, 3969771125u, 3054637934u, 1558646055u, 471941500u, 2636876458u, 2886960537u, 3497097536u, 3990323024u, 3166020554u, 3001616183u, 815163378u, 1679057573u, 1081144277u, 421604665u, 3247941161u),
+    SC(3794779669u, 3232730316u, 1468055667u, 1602542569u, 2811280094u, 3894696966u, 3351918387u, 481520000u, 176511915u, 2908542476u, 2293510310u, 2673058215u, 2743240981u, 1231321499u, 3829204695u, 2100419078u),
+    SC(823169501u, 2556487906u, 249640051u, 3239403359u, 1768119865u, 1191504551u, 1074349346u, 1188014515u, 1725654383u, 2278682703u, 4291948615u, 2294310960u, 2266940838u, 1341056645u, 3179344049u, 678265716u),
+    SC(885128452u, 3540106889u, 3004957762u, 3555109924u, 2285447348u, 1519599736u, 409457699u, 784522207u, 155272837u, 3917159257u, 1421690615u, 806830390u, 3581877486u, 3028763709u, 3308394583u, 3128142830u),
+    SC(4061784669u, 1800695836u, 471129691u, 1434367018u, 2366895019u, 3167783679u, 3425328747u, 77303139u, 1287215447u, 3896328368u, 4147835988u, 1288500913u, 4105211196u, 129138616u, 3636631082u, 1074226897u),
+    SC(3619189775u, 1957231530u, 2985722843u, 2403720742u, 1413108880u, 3165005576u, 1916178724u, 1772139592u, 4202141313u, 685361454u, 3774943027u, 2060743038u, 4279622494u, 3552594355u, 1092485909u, 3936639291u),
+    SC(852696098u, 797929230u, 4168055960u, 3550688094u, 2908474674u, 2883425320u, 2682573577u, 447227071u, 1596994293u, 2300663523u, 2630696313u, 364503514u, 778939550u, 1864821089u, 294458552u, 1177425505u),
+    SC(1952576369u, 2437591846u, 1896110613u, 1570255338u, 2274613116u, 3583349444u, 873432779u, 3246606261u, 2394995235u, 2341912256u, 3420314798u, 178537044u, 787357685u, 211316390u, 3013101491u, 3423154166u),
+    SC(3993475803u, 502367744u, 1949657637u, 2855805034u, 1836149548u, 1046955325u, 678860986u, 3618812630u, 2378318122u, 2950938204u, 1281308640u, 3972397558u, 2756090010u, 4031532581u, 3953837177u, 3961293854u),
+    SC(384603108u, 1206682608u, 1182472240u, 786833655u, 3864912689u, 2269945287u, 738035222u, 3130894005u, 1581658389u, 241367872u, 3504915111u, 3394765987u, 2639796330u, 1357158163u, 2519103374u, 632317773u),
+    SC(3936745856u, 3259365104u, 949453456u, 2946960235u, 3632617623u, 4186663588u, 2243518565u, 3577200025u, 4133444926u, 690761224u, 430254137u, 479807012u, 3615786653u, 2121180799u, 2977972482u, 1323042780u),
+    SC(126653447u, 1414185266u, 1764680081u, 167920537u, 1487799431u, 1901147182u, 2842446699u, 899981137u, 4091556241u, 1777048453u, 3577759637u, 1402625640u, 4196384088u, 1007045924u, 1656124913u, 2493767092u),
+    SC(1229933538u, 430024560u, 383572024u, 1125837312u, 30263470u, 2054145672u, 1919252697u, 1881692069u, 1109666454u, 2458101235u, 968523527u, 1580644906u, 4180004400u, 3613912430u, 1442099249u, 2282575404u),
+    SC(2778245123u, 229038188u, 1808265973u, 340698441u, 3531739626u, 1492821774u, 3209436774u, 1545595317u, 541810031u, 2223123504u, 2118863473u, 1081309932u, 603743158u, 1530263658u, 268594621u, 763776619u),
+    SC(3289978422u, 1522215773u, 152645471u, 767471596u, 546243087u, 307694104u, 1304091710u, 1482250647u, 82920273u, 3490217722u, 1238517171u, 681068937u, 3586849093u, 255115200u, 3977701739u, 1492818195u),
+    SC(2216517731u, 2777086535u, 1517438468u, 3657677915u, 2460147922u, 3768806095u, 3838261845u, 343156865u, 121137141u, 2617661928u, 419756449u, 3344184984u, 3861209814u, 1951143580u, 3886247392u, 445473108u),
+    SC(1586871097u, 2590601683u, 1979869511u, 4170964527u, 673919873u, 153665101u, 3977325252u, 3608027349u, 972177206u, 1745422427u, 4005545745u, 2167486325u, 2845612781u, 2106303371u, 370377927u, 1174480997u),
+    SC(920937498u, 1402245076u, 1992531850u, 2583533390u, 1589671268u, 3039911307u, 4187255228u, 2700029798u, 3527559963u, 448679608u, 373434288u, 2244586132u, 1458180937u, 1070949344u, 1876237557u, 1766619388u),
+    SC(53893150u, 2814360498u, 2428604834u, 4110918684u, 4116985922u, 386830671u, 2930452418u, 3313104678u, 3939574120u, 1499455934u, 2569347369u, 3068488499u, 2448927508u, 281878030u, 4091337899u, 3539837476u),
+    SC(2327353366u, 3672102582u, 2717016911u, 3472944260u, 58200101u, 3983052996u, 2224505456u, 1809071838u, 1876750089u, 4076261536u, 1155945646u, 4129559407u, 1346192796u, 1049199704u, 1487174289u, 701354574u),
+    SC(506720679u, 1187628407u, 2167616589u, 2459565226u, 548443022u, 2328883796u, 1270088324u, 3099982740u, 101081125u, 2110855994u, 2848517473u, 2368007679u, 587649824u, 4056952848u, 3812261152u, 1475589046u),
+    SC(2243412444u, 3016671671u, 4001312990u, 3617444362u, 248640716u, 416010191u, 2752525855u, 3639643953u, 1033415117u, 3492207939u, 4086319346u, 1518880756u, 4239371544u, 2513937971u, 3338589123u, 1587123473u),
+    SC(702521277u, 2375960144u, 2457203889u, 634836061u, 2143197755u, 2273999608u, 1923252230u, 1638686545u, 189550569u, 2625067616u, 1848477794u, 395393535u, 3663846534u, 469868117u, 3441981163u, 707254347u),
+    SC(2696006368u, 1795851386u, 1072328295u, 447711967u, 3756362914u, 4150792284u, 2156049124u, 1241309778u, 2923643138u, 3990751576u, 3964344793u, 396796558u, 1802689048u, 883945702u, 1357924688u, 975793394u),
+    SC(82366127u, 3115575713u, 920420342u, 2122580629u, 3029983155u, 2987605579u, 2702439140u, 3235979749u, 3475076113u, 2357947770u, 1263072981u, 885939321u, 1110181994u, 1665533186u, 3089616482u, 2737203260u),
+    SC(3528082656u, 1205967727u, 1526432199u, 3392104712u, 173045352u, 2583759129u, 4096206274u, 3079250747u, 1874384217u, 457600911u, 3325932815u, 470752361u, 20945256u, 2276992077u, 752796695u, 2951384995u),
+    SC(3925958762u, 2053938397u, 614457295u, 2897843588u, 2022696u, 2881140603u, 1359276430u, 2386245076u, 841675920u, 2356351664u, 3485459305u, 4154962893u, 3084142923u, 3263313664u, 3486929432u, 2319362445u),
+    SC(2945113535u, 728112266u, 1818437733u, 1589208657u, 622856152u, 3320459710u, 1255249630u, 2363626271u, 1732896380u, 43746805u, 704859823u, 3499524971u, 622887302u, 2162322120u, 4091526363u, 1903466240u),
+    SC(14921241u, 1951820960u, 1824855764u, 2114957669u, 2792661978u, 3170672990u, 1915686452u, 1358190729u, 720027262u, 1160859905u, 371293959u, 3209496368u, 233406024u, 1962418003u, 874555182u, 3943421604u),
+    SC(1495196501u, 826120562u, 485923135u, 4275168227u, 26820595u, 3978659842u, 123644110u, 3549946438u, 2968147338u, 289157310u, 2786051191u, 1415628688u, 535867475u, 3529286333u, 4008283930u, 1273352598u),
+    SC(288976213u, 4255468617u, 4053444979u, 416864865u, 4203054308u, 2064140613u, 125628466u, 1437936004u, 2576118952u, 3443895297u, 681400371u, 2814293108u, 1341470384u, 455441380u, 3312876522u, 2481608612u),
+    SC(1012738587u, 2744932887u, 2415920952u, 3386950667u, 2379087188u, 1752517476u, 89391447u, 3759647354u, 2988982905u, 2572825826u, 4191477363u, 2533103800u, 261852063u, 3710324582u, 1643617444u, 3357266519u),
+    SC(3431400632u, 2785676783u, 2745801330u, 2582833603u, 4223899055u, 2957688952u, 1113520289u, 2034024496u, 3184812089u, 4276950920u, 488507490u, 3677650828u, 4086675279u, 3300711502u, 2483778787u, 2887719699u),
+    SC(3308512503u, 3934606762u, 3449255852u, 1554852281u, 2111102716u, 3428052606u, 2718175643u, 680112535u, 1862935915u, 3320831810u, 2586818084u, 790250402u, 3652789691u, 1246444070u, 3146649413u, 3948503190u),
+    SC(202701042u, 3434249583u, 278883592u, 3493644650u, 1773833268u, 4005591996u, 4117157006u, 869950867u, 3277444754u, 1001625847u, 4249121761u, 1877066372u, 1974943965u, 159413734u, 3236455569u, 333199928u),
+    SC(2798371588u, 1808180304u, 3133294473u, 4195815770u, 1284979181u, 1979249180u, 3829528366u, 194045679u, 35317748u, 1745782939u, 2972737950u, 739218851u, 1624159603u, 3339059987u, 2556604374u, 402299807u),
+    SC(880635290u, 46434599u, 3959129793u, 899357871u, 319437826u, 1741757670u, 877345273u, 2638466104u, 1625980769u, 2740146765u, 479756142u, 3469291272u, 1834375862u, 2273774769u, 646577950u, 835142728u),
+    SC(3664070098u, 404601049u, 2214059187u, 1978620006u, 3564922801u, 3207710927u, 2237593411u, 2071094634u, 1236887317u, 2875750567u, 2658726012u, 3848801373u, 1718813979u, 1228258697u, 2146075211u, 2010914954u),
+    SC(3288811468u, 2634099889u, 2705031496u, 815558119u, 3961902740u, 1566929222u, 3117783371u, 2414547217u, 1554342005u, 1004708143u, 3336465583u, 750029142u, 1572419093u, 1804932321u, 3143533315u, 2114953940u),
+    SC(1312999660u, 2194249624u, 3438519824u, 3196522104u, 864845681u, 860405044u, 3357556468u, 58668290u, 1970394958u, 3856726930u, 2812851002u, 125317953u, 2773033284u, 3428105412u, 177489718u, 2472567863u),
+    SC(930458480u, 2310826744u, 598450913u, 2943398454u, 3528575707u, 210138162u, 2270308891u, 990768618u, 3193098503u, 3170503128u, 3166270314u, 2190277247u, 2894967163u, 4154944044u, 1118672404u, 151096567u),
+    SC(3470990527u, 2117397559u, 2643786625u, 1295873882u, 3646183773u, 320125576u, 1184210494u, 2197245478u, 2413185556u, 3228260508u, 649676718u, 735013882u, 21622539u, 3780039896u, 256150017u, 3292208237u),
+    SC(3036277482u, 162959734u, 435612266u, 1320502862u, 4259010813u, 1169288175u, 3452018717u, 146045318u, 971360658u, 1532646576u, 1949541617u, 2355196527u, 2343645632u, 315249710u, 2991229632u, 1912629290u),
+    SC(3559276028u, 1026423075u, 2685901384u, 2523738318u, 2229424474u, 4231908545u, 3078162297u, 784123406u, 1658826503u, 2700578795u, 820186466u, 2508537057u, 2313234294u, 181849983u, 2920697362u, 706776404u),
+    SC(1212511524u, 2182063706u, 1334654443u, 1764787580u, 3321024u, 2762137154u, 573828826u, 2306216644u, 631720107u, 913930713u, 2268316554u, 530694887u, 3698114685u, 3000371866u, 3886508714u, 1237127031u),
+    SC(3756977944u, 2165317420u, 2971026675u, 2729435074u, 73275793u, 2438107711u, 913971047u, 3239890650u, 3975901270u, 3474841666u, 4181855147u, 963089344u, 3281042919u, 1263255039u, 380123872u, 2593813783u),
+    SC(1837037233u, 1967388727u, 1012350788u, 3790834051u, 1569307836u, 1617088211u, 1820516227u, 3103451225u, 3443855043u, 893618566u, 3757023500u, 1476307388u, 3307315349u, 2603450555u, 4148893965u, 3396414736u),
+    SC(3881174485u, 2432869794u, 1749352659u, 3113349859u, 4090006419u, 576014083u, 1525832438u, 1845777439u, 4123346772u, 2834767589u, 1085912199u, 675757617u, 1332910789u, 814417555u, 2204145934u, 737857829u),
+    SC(3952633359u, 1280178848u, 1781261395u, 3573681097u, 2584489568u, 2883815493u, 2111061999u, 2985124364u, 1824106631u, 1838987346u, 101297978u, 3710307616u, 2695351690u, 2484146972u, 3898557456u, 10035774u),
+    SC(334002946u, 2105873619u, 1496969958u, 2301303186u, 559176041u, 1099465526u, 3694486499u, 3101403458u, 4277511110u, 2153359070u, 3319145489u, 1274145050u, 2888539557u, 1758899179u, 628151638u, 1186508273u),
+    SC(3994431526u, 3925700576u, 398692102u, 2780721089u, 625101623u, 484601998u, 2079607062u, 2447734346u, 449520911u, 626906652u, 1138314444u, 1728909144u, 4103791610u, 364471843u, 3846376864u, 2909561522u),
+    SC(2993223151u, 2597658189u, 2027829877u, 204327067u, 509766979u, 1347970969u, 2570249691u, 867122560u, 1597050187u, 1016707563u, 2980018132u, 471723521u, 2364592975u, 3558413844u, 4101210u, 303490083u),
+    SC(4278711057u, 2325606453u, 3925530718u, 3066544100u, 721612828u, 2845634211u, 3212836282u, 2479125773u, 1132541654u, 65558691u, 2781102275u, 2395781853u, 3251803169u, 350416349u, 1195430040u, 3469865176u),
+    SC(2374735957u, 3351270051u, 1095171360u, 4290140350u, 2763650718u, 226647742u, 3245247548u, 3803522721u, 3451214318u, 3693967865u, 649786447u, 3092161748u, 1271877886u, 3843914987u, 820176884u, 1661167448u),
+    SC(1390086995u, 2229255941u, 3215578226u, 3618514655u, 3837284814u, 3398545899u, 2772591384u, 228797283u, 205232509u, 84862420u, 602648422u, 2799411031u, 3004697744u, 678782877u, 3911497373u, 2225582965u),
+    SC(3861877904u, 3553959334u, 962526500u, 3892910540u, 2098145731u, 4093266118u, 4294263742u, 3419681618u, 1837739387u, 2760338187u, 583191080u, 208152674u, 4081240153u, 522039121u, 1893759997u, 2630548093u),
+    SC(2133912100u, 1991481780u, 2507475400u, 2406993945u, 452603893u, 3413841149u, 1838054757u, 2863337875u, 3395221460u, 2989607244u, 991246490u, 1600328169u, 3674176438u, 2064662168u, 2163166207u, 1668991724u),
+    SC(1352204062u, 496964859u, 1185026298u, 3664547903u, 4010784692u, 2715622810u, 3322544993u, 2148235776u, 158536001u, 3625961720u, 139278278u, 3881050118u, 3018726208u, 3591241299u, 1655025970u, 4246199744u),
+    SC(850889853u, 3924709674u, 1921604582u, 3117150118u, 3807626444u, 3460586646u, 3119695902u, 662220120u, 3994569205u, 333410787u, 788281494u, 3995608588u, 1941667924u, 2061641563u, 2761368439u, 2496165180u),
+    SC(3804984573u, 3700334524u, 3497455346u, 2814847756u, 3816640752u, 2187976640u, 1958052181u, 88581367u, 3551145687u, 480104996u, 2053299974u, 657910539u, 2917050851u, 1629672126u, 2252450763u, 6079652u),
+    SC(2218280053u, 1725224894u, 3671861652u, 2527802740u, 637573685u, 4063611668u, 467720604u, 3507151784u, 3303080457u, 379062861u, 2781878981u, 3870110471u, 888081785u, 107158607u, 596656747u, 786266399u),
+    SC(1096995976u, 3096707587u, 2606255215u, 3334670471u, 92789188u, 1868958599u, 2327207042u, 3339835006u, 1729511056u, 842410143u, 2003772098u, 1605936047u, 3245551403u, 2226448733u, 3181673189u, 2693080649u),
+    SC(1068318632u, 1286541108u, 4042824701u, 768562428u, 392001146u, 3963506792u, 1329308836u, 3210700861u, 215071868u, 3066839163u, 3002124900u, 2087815795u, 217520242u, 3889222309u, 1067585276u, 3756398630u),
+    SC(1733240320u, 2734717440u, 1452022396u, 3764193302u, 3254486207u, 326138255u, 476664623u, 2930878571u, 698163705u, 1094661043u, 3992206117u, 1879332875u, 1893423066u, 186131033u, 3768511686u, 2651666597u),
+    SC(3543092645u, 1256092843u, 3088810330u, 3522902822u, 1031984838u, 2456898511u, 4168952253u, 1592389775u, 4181892723u, 2341360569u, 1760137238u, 3227086967u, 2195803973u, 892706136u, 801379985u, 188672647u),
+    SC(820307568u, 1129547093u, 1851340375u, 324552147u, 1874553137u, 4146792651u, 517559537u, 3821944822u, 1177525198u, 1637390435u, 2224633089u, 331073969u, 176655669u, 3664802829u, 3331695961u, 3951614843u),
+    SC(3189793280u, 1011993648u, 73935108u, 856575470u, 2134756624u, 2954778635u, 4053211908u, 3570061975u, 1645775812u, 2640438594u, 2238960778u, 1960953429u, 2982547600u, 2421588640u, 3579154135u, 768391612u),
+    SC(2467578915u, 2900575518u, 3533574073u, 2888495633u, 3413017766u, 31414675u, 3290006943u, 4284346442u, 2081480625u, 1690518111u, 1550951417u, 3617136696u, 4043723300u, 4146837969u, 3640829649u, 808957052u),
+    SC(2954229764u, 1331678172u, 4061962861u, 1815411585u, 2541916677u, 3350712999u, 3412476300u, 360386860u, 2878086664u, 1829038099u, 1951032667u, 771282424u, 993844335u, 2855307457u, 3551437125u, 1312431455u),
+    SC(3588874714u, 1688049624u, 2655545361u, 2051430970u, 1334450398u, 1470185683u, 1799301875u, 1101142866u, 1286620215u, 4086426995u, 286921676u, 491639003u, 378750556u, 574638093u, 2304108633u, 791102586u),
+    SC(3551412484u, 2111293958u, 1572835031u, 2073633849u, 2553284045u, 1927376239u, 2573882134u, 3546900155u, 3172657953u, 2904746930u, 705753136u, 873973465u, 1694027223u, 3742026337u, 1259396116u, 3508907078u),
+    SC(1178478435u, 3632658776u, 4234595794u, 671150244u, 2266594570u, 2195945396u, 2676010887u, 3365384293u, 3220155611u, 240979927u, 3745132826u, 2497578539u, 649596001u, 4224283912u, 3080295015u, 519555711u),
+    SC(2038824445u, 310117735u, 3337961153u, 3143887921u, 1491441604u, 201225340u, 2211307465u, 274995479u, 1614549722u, 4091119150u, 4071776225u, 3727203053u, 619522334u, 247885959u, 61193558u, 2134043907u),
+    SC(1956752747u, 1601627037u, 3000837268u, 283822073u, 2658452892u, 3091016974u, 3590264131u, 3665232873u, 3428931567u, 415876668u, 3591978371u, 1662762656u, 155060584u, 2486078515u, 3581116375u, 2430655240u),
+    SC(812132944u, 1882420726u, 47453798u, 1268882303u, 3384456236u, 1920234595u, 2803697814u, 2989452707u, 1430127862u, 2954409210u, 1821325799u, 4078031639u, 1653657824u, 4053575487u, 393301401u, 2007117816u),
+    SC(2652985584u, 3619739122u, 1815581167u, 4020737431u, 1699641899u, 610596139u, 518439220u, 2003431255u, 118684893u, 462443504u, 2416157512u, 531068462u, 2684189838u, 4082776144u, 2653929254u, 687899507u),
+    SC(393094808u, 2588133839u, 3953394332u, 539310274u, 2171790694u, 3821337831u, 841504755u, 3190979942u, 3985426896u, 1261038471u, 2099710792u, 2027701185u, 2599408415u, 1324222958u, 2068284236u, 530887107u),
+    SC(1976856318u, 2742492782u, 1756084378u, 330134654u, 3474494009u, 1039945499u, 1879341196u, 1345801640u, 2555525386u, 2572187257u, 4245391101u, 725198952u, 3622814241u, 1362390554u, 1017410149u, 2259074776u),
+    SC(2157584582u, 2103742479u, 4217998412u, 2187291999u, 588315396u, 1372088628u, 1534269942u, 1163941665u, 2660845952u, 3650190882u, 3077244441u, 670696468u, 1024027852u, 1419132522u, 1589618163u, 4175595201u),
+    SC(456691770u, 1140322580u, 3980722356u, 3938912319u, 3741240860u, 4070335314u, 2371236934u, 4185047424u, 1077341641u, 832965352u, 2301968247u, 4250132042u, 654881387u, 1868408618u, 3543744793u, 3673426169u),
+    SC(2426932662u, 3945352094u, 2869644941u, 3752062951u, 640964814u, 755455597u, 4108764552u, 1761537827u, 1966902175u, 2538926477u, 2280788293u, 3655504747u, 1591759026u, 2076022401u, 1143764713u, 802132454u),
+    SC(3267891076u, 1265654168u, 316024134u, 257963022u, 1047475717u, 1242846318u, 1841454407u, 929819291u, 2261390861u, 1760875751u, 414487992u, 2446569909u, 1941467559u, 45404001u, 598463560u, 984063076u),
+    SC(2633369204u, 1291105779u, 4260989395u, 4053774949u, 755027937u, 3590117010u, 2737032721u, 2727245139u, 2168966135u, 3111386305u, 1532475043u, 3484248163u, 3989893902u, 1011202141u, 3271607571u, 3259463069u),
+    SC(1464373154u, 2269300402u, 1514749910u, 101553006u, 2787642124u, 1948255659u, 3466130821u, 1524113928u, 833866309u, 1349762725u, 1487781462u, 3262859019u, 2945751782u, 1344354593u, 3693639748u, 4053964148u),
+    SC(4044569790u, 1810414536u, 3700290232u, 3612959682u, 3557742102u, 3344485832u, 1323025899u, 1218004093u, 1476142151u, 572895807u, 1460953709u, 2372392289u, 280836704u, 3715765895u, 213629075u, 4132631823u),
+    SC(2500345461u, 855752056u, 2139720135u, 2422586241u, 1060989375u, 4091815173u, 256771095u, 1539213760u, 2219498332u, 3889237481u, 1175963452u, 2809151716u, 3998126816u, 359349360u, 3428401060u, 2494772354u),
+    SC(445678421u, 3417790069u, 1582788306u, 2627317603u, 2255013811u, 1674107251u, 1645216835u, 3160176070u, 3613738604u, 1851092533u, 796362530u, 627211648u, 2805282823u, 1262812967u, 91935278u, 790910114u),
+    SC(3314691956u, 198394837u, 2860937992u, 4208557983u, 2318212963u, 3321044404u, 4031640510u, 4081694280u, 2008150120u, 2096946152u, 2166752741u, 227243308u, 3665893444u, 594168899u, 2012560532u, 1853609544u),
+    SC(1692512662u, 2677080727u, 1989256196u, 833664626u, 90033969u, 372807641u, 2520990752u, 3871956425u, 3245301959u, 3240084425u, 3945265702u, 2835569510u, 2616948690u, 485439261u, 3706277426u, 2451723532u),
+    SC(54210166u, 1752646893u, 1817320365u, 859036983u, 3322083495u, 1419680999u, 2156902378u, 130943198u, 3787259519u, 3371010793u, 1559675459u, 2145227967u, 3611486410u, 2799597585u, 1277497642u, 2258145021u),
+    SC(552701772u, 2255325724u, 3265466419u, 397716529u, 2314990351u, 4069828444u, 2501145534u, 1172632212u, 2372425673u, 3499030452u, 4253582134u, 1027063527u, 266883743u, 1903424905u, 1140633217u, 3536906766u),
+    SC(1293296585u, 1154074390u, 2699775080u, 1579846557u, 770917971u, 1415855087u, 3510911350u, 3619068555u, 3723606526u, 2269424899u, 4187406187u, 2532062358u, 727718869u, 3985977208u, 1425376136u, 2300034688u),
+    SC(2835460315u, 3903531309u, 671968054u, 2240366469u, 1336594596u, 3708659682u, 3568111605u, 1034975712u, 1059579873u, 2202999393u, 2943288540u, 1642573412u, 1902888416u, 2796577715u, 30467598u, 1193904797u),
+    SC(2114646129u, 807505917u, 1354589940u, 1212564913u, 792896079u, 2088798363u, 808569254u, 3959200368u, 1354507251u, 2456604868u, 2673081266u, 904601225u, 223843607u, 4122854315u, 605477752u, 1521408831u),
+    SC(2074613886u, 444278178u, 3246773045u, 1141542968u, 3028223272u, 1416535460u, 4018318000u, 1525412365u, 1852501612u, 2519021322u, 4167483996u, 2091244920u, 86503356u, 3889738659u, 2595375408u, 2585284999u),
+    SC(2349141955u, 1300476537u, 3053455382u, 3784297016u, 2540156822u, 244475762u, 1438140985u, 3644483591u, 2556630255u, 1974898610u, 2189175141u, 68780345u, 1567203277u, 2177835982u, 1880734785u, 890718320u),
+    SC(1404535962u, 2028265350u, 629540227u, 2770639176u, 2641494434u, 3421832736u, 712739611u, 3382456009u, 1311894034u, 2892004615u, 1575268909u, 3787336786u, 3768864037u, 1193857733u, 1154670073u, 3823397312u),
+    SC(2615123559u, 2781923733u, 1778866689u, 266822334u, 3056816132u, 836691854u, 4273754750u, 1395735347u, 2485536289u, 2778074638u, 3796641682u, 1863764690u, 2424251958u, 1982762330u, 401165053u, 2392665008u),
+    SC(2091545267u, 2055910333u, 195822362u, 1197502345u, 400159788u, 1858261755u, 1117772176u, 1245191988u, 1532515243u, 2128993933u, 887346878u, 2986412367u, 4287610142u, 109246449u, 4018658774u, 1567818697u),
+    SC(787651487u, 159545717u, 2042636639u, 3287584183u, 2455593671u, 1429358909u, 3726031230u, 965990426u, 1231852621u, 3649526694u, 173244153u, 1811203860u, 2695888676u, 947754472u, 2604807034u, 856754003u),
+    SC(3742727341u, 2511370357u, 1463556192u, 2925331142u, 1076488530u, 3962916458u, 2656842942u, 2536603640u, 4075604679u, 1972513616u, 2308741018u, 45337648u, 3056199214u, 2238266276u, 1895231032u, 310690146u),
+    SC(3713384784u, 2728174886u, 3055038052u, 1000256836u, 3864121910u, 3071877351u, 2975504496u, 373639965u, 1153914789u, 1123346990u, 3012953556u, 646718736u, 2892520107u, 3615133532u, 1301668415u, 1278120808u),
+    SC(378039540u, 1859398777u, 420771683u, 104673878u, 3302347667u, 2280658723u, 632939704u, 2552397607u, 1948361248u, 2129080985u, 3563164412u, 2479490014u, 3357863309u, 3807675239u, 3964896023u, 169345019u),
+    SC(1878098172u, 3668117016u, 149467910u, 3606097151u, 664177698u, 1213199454u, 1454287483u, 727741231u, 2098648660u, 4039290864u, 4230303149u, 104292770u, 1821196322u, 3934632140u, 586410526u, 4137247145u),
+    SC(65684753u, 2685256352u, 1052046623u, 1089365884u, 2861640533u, 972457412u, 4173121770u, 3694747190u, 1822347761u, 1384841749u, 2476972089u, 873323347u, 170864182u, 1385219224u, 615527878u, 1942562205u),
+    SC(193121648u, 3695045098u, 3011986136u, 4079877005u, 1407456522u, 2203997366u, 1014811168u, 4065527837u, 244042750u, 528445045u, 3543015497u, 2468968031u, 49282134u, 2837639784u, 1624554506u, 2916147789u),
+    SC(4264543200u, 7636805u, 2230199231u, 274360742u, 114317040u, 389184841u, 3081997143u, 2711013247u, 1041798172u, 3284587159u, 3432657654u, 2508225308u, 2108184093u, 3841845021u, 1335606710u, 3921623318u),
+    SC(79233398u, 3450484371u, 1206417291u, 316382574u, 3903848724u, 1189754348u, 2220736343u, 1270318475u, 4127541163u, 1855741907u, 3970360137u, 3092807878u, 534434044u, 796569941u, 693938924u, 3111371092u),
+    SC(905151057u, 489971723u, 1267500713u, 4040935917u, 3741074034u, 4120193184u, 3443441930u, 1497679570u, 698889718u, 4018119141u, 4143151744u, 3482765976u, 1131817905u, 2972323246u, 2927829835u, 3501575381u),
+    SC(494187159u, 51492863u, 2701295142u, 1484603227u, 3788564908u, 1057034701u, 4090241905u, 1915533642u, 1551617931u, 1475417312u, 3074150328u, 284542477u, 903649710u, 2647126242u, 1617740279u, 683804446u),
+    SC(1352701171u, 164034902u, 184682295u, 3119280686u, 1333121463u, 3289748454u, 4180977290u, 2554659880u, 2726748706u, 3756068093u, 2525620922u, 1786900548u, 2311613878u, 2258280885u, 1420365598u, 2205650670u),
+    SC(2607135617u, 556340604u, 3756847406u, 660521868u, 674086105u, 347373829u, 2578491094u, 667303351u, 3313687322u, 1057956418u, 420721385u, 1374259832u, 1712016448u, 2903047525u, 1384485820u, 404894088u),
+    SC(2336572668u, 534749294u, 1164710165u, 2715583260u, 2246570437u, 3860917413u, 471892013u, 916765803u, 3823598657u, 680470018u, 3877810047u, 1265690189u, 3826347961u, 2505769904u, 1856549279u, 2048931085u),
+    SC(1819318400u, 3109677948u, 1366930076u, 3310850012u, 1823649299u, 3721322025u, 3589807509u, 3725243562u, 3387113390u, 3180247618u, 1731641543u, 1866328762u, 3995818437u, 156498755u, 3269248275u, 2658946012u),
+    SC(2004224849u, 934963825u, 2513998327u, 2493548448u, 1996266855u, 2150334951u, 140203639u, 1028880390u, 4112526581u, 2867766667u, 4109732990u, 3745781694u, 461897694u, 3868096496u, 3622312638u, 361642533u),
+    SC(445372291u, 1779108994u, 3920168104u, 2831751783u, 3795637496u, 4023789008u, 3746316910u, 2115383554u, 1644061898u, 2962566318u, 1012354856u, 796174461u, 3265880854u, 3070271278u, 1318870988u, 304633924u),
+    SC(4263607734u, 1493670163u, 4213065022u, 3528298966u, 2751148185u, 3868488151u, 1406882704u, 2253044784u, 1573886651u, 2841796310u, 2159079951u, 2985314261u, 2476787228u, 1402376787u, 2363452163u, 1299385176u),
+    SC(621073975u, 1420809707u, 3280951478u, 1588423021u, 132361175u, 1221291103u, 556461385u, 4122164113u, 2040971075u, 1978746524u, 1330848198u, 3341794292u, 3128749072u, 1450570807u, 3051361197u, 2069722580u),
+    SC(185005826u, 4101710551u, 2309602623u, 1752237507u, 1633725375u, 1556649835u, 2143149231u, 3675880284u, 1986640852u, 430232721u, 4120027995u, 1789124580u, 1540554367u, 3514419064u, 483784984u, 3610441277u),
+    SC(2151358523u, 3005193465u, 1077210809u, 833963136u, 2801007006u, 3173241004u, 3156289702u, 218385955u, 814398605u, 4067555161u, 1504840796u, 2141596591u, 3217673407u, 1236879017u, 1424308252u, 388551111u),
+    SC(644521140u, 3321220781u, 3142641085u, 2688185106u, 3844989406u, 2392172764u, 3581053438u, 50492570u, 2666174219u, 2824254202u, 2749900919u, 3431263567u, 1036054458u, 511458218u, 2335731708u, 1189129854u),
+    SC(4253719957u, 3624696533u, 630826923u, 2551594483u, 1690616129u, 3920357941u, 1567842492u, 4165909140u, 2851804930u, 269046707u, 1504895592u, 2330459443u, 2734913498u, 1203755633u, 1043168627u, 3752919820u),
+    SC(2805083635u, 166891299u, 1509700506u, 2334949566u, 1854188741u, 3081812216u, 4073418534u, 4191881853u, 586612381u, 561288449u, 2145091419u, 789772887u, 157237473u, 829507717u, 3240767137u, 1859873766u),
+    SC(2192097551u, 862611017u, 1671496925u, 3212775192u, 3175892506u, 3931545596u, 2193868772u, 3406114102u, 1937566882u, 3236917799u, 2341490716u, 3413227121u, 1583100372u, 3439622337u, 419304071u, 2515655948u),
+    SC(2605765046u, 2386294677u, 8180015u, 94768166u, 1817113271u, 1537590550u, 3309798569u, 1326831327u, 721194249u, 3079763672u, 3489922346u, 1327027494u, 1077935911u, 759687032u, 1937178295u, 3420313853u),
+    SC(1066435549u, 3367248894u, 2112071714u, 2178090346u, 3101473239u, 4001549184u, 1729648991u, 3135278386u, 3407069522u, 4249951633u, 2850090384u, 2946507168u, 2180480877u, 550245238u, 3793313788u, 4069500760u),
+    SC(3344729537u, 3994534306u, 1458566845u, 1495688907u, 3374520070u, 1507134458u, 3687909198u, 4061560751u, 448064190u, 1577664669u, 1976346770u, 642249869u, 3177810454u, 3573009541u, 2530931049u, 1073887826u),
+    SC(3308527594u, 4171298259u, 3033583373u, 796568956u, 1625984555u, 1028358073u, 1550374262u, 2556780613u, 2516186345u, 8280991u, 2760877090u, 2724903298u, 3695748309u, 1299260312u, 1852652217u, 1961396501u),
+    SC(2209143358u, 713660384u, 3576419526u, 2265308450u, 570970807u, 1965910013u, 2305269810u, 1623382171u, 3705780961u, 3595942481u, 2136692096u, 2574325591u, 175623483u, 3712716430u, 856594297u, 465772016u),
+    SC(1535217990u, 2334756980u, 1536967012u, 3801962828u, 4055946609u, 1818048866u, 1540520371u, 2433915u, 3426104992u, 1071504890u, 3201863082u, 2961306457u, 474534602u, 1908028668u, 4137197386u, 4150418830u),
+    SC(1685553442u, 558774511u, 4161017750u, 375456999u, 854980196u, 3549263649u, 2609448030u, 742067820u, 849145929u, 2115366599u, 3102407754u, 193625372u, 3635819011u, 2370498433u, 2538404228u, 1175561005u),
+    SC(3981279850u, 4267139828u, 2035325193u, 2599323236u, 726096541u, 1839268220u, 1137757087u, 452010787u, 2356117950u, 1068475886u, 3358158738u, 2328334749u, 3302526106u, 1497637492u, 3495107451u, 4158951032u),
+    SC(951331108u, 1100672195u, 2899768657u, 879744538u, 1300409387u, 1442295785u, 2047273792u, 3440417866u, 2135081110u, 803942259u, 2997917274u, 523606634u, 3729381224u, 2731436807u, 3047995691u, 1944081795u),
+    SC(3284849832u, 3636171943u, 3023359856u, 406750741u, 3140128610u, 619845347u, 1147847401u, 2182318353u, 4132027943u, 2360186724u, 544484579u, 2195514273u, 1108227886u, 4054997799u, 1504243000u, 1921152606u),
+    SC(759205876u, 3553769213u, 1425728525u, 3460213228u, 3642830423u, 911809182u, 1431866954u, 1421698360u, 3583421936u, 3899206150u, 3160573119u, 43630326u, 2246222193u, 1482334514u, 1268385205u, 216536503u),
+    SC(4001029997u, 612312571u, 1994984696u, 335055083u, 3597935523u, 2747727278u, 3137044138u, 2050213972u, 3765901387u, 1256781573u, 1813044638u, 4114704541u, 339699825u, 2023626753u, 3736009757u, 1383763892u),
+    SC(798250952u, 2852105377u, 1032918301u, 3301304477u, 3713873827u, 2090501707u, 2088836926u, 18107188u, 3947665480u, 2425607539u, 2727690366u, 493864074u, 2020679886u, 3017006331u, 3020305632u, 3881706013u),
+    SC(3555930808u, 2700154242u, 484657036u, 4024536547u, 1611793539u, 4015201319u, 2066793582u, 3086926484u, 3933583794u, 1567717473u, 3517914113u, 2620860737u, 3365309328u, 4011020191u, 842143201u, 3138068821u),
+    SC(406063315u, 951081645u, 891419864u, 1861447127u, 1597889414u, 1723150206u, 2588729119u, 2383752081u, 1721337120u, 1860127430u, 4087079455u, 550078500u, 554573900u, 3830028297u, 1575179575u, 373367180u),
+    SC(675277917u, 2970902099u, 3129941775u, 4191127975u, 570097622u, 3260237446u, 1027167753u, 1598043982u, 1890587191u, 1957647630u, 1759940191u, 1707765400u, 142896643u, 3476664183u, 2232532610u, 3157458686u),
+    SC(216487690u, 1335115002u, 1094439497u, 3639073788u, 3955701113u, 1997526746u, 4115271163u, 3713202786u, 3776295243u, 4014380495u, 4219846137u, 2342754396u, 3177077641u, 2212516752u, 2083977678u, 2339755037u),
+    SC(2124173081u, 3371494463u, 308934216u, 3448870181u, 3749249813u, 1959521045u, 930695756u, 2207241328u, 3923368958u, 2364929484u, 2824197836u, 3172070528u, 1627060877u, 2909524969u, 3362649550u, 2969195120u),
+    SC(3802774502u, 224222206u, 2814900505u, 3743615481u, 195055436u, 1915371202u, 1005867444u, 1691025435u, 3826744545u, 3285019335u, 2022857686u, 2121452407u, 3516029841u, 3496640278u, 2554403399u, 2251898800u),
+    SC(1346704036u, 1041755984u, 3829134205u, 1118390672u, 4116603931u, 358138469u, 3876163586u, 1965494290u, 2504679384u, 1471822543u, 759897921u, 3907121869u, 522306745u, 1754888219u, 1948928466u, 3860779403u),
+    SC(2178019347u, 2797285983u, 1261247825u, 3128084257u, 2241414616u, 2709206033u, 3445407367u, 677348621u, 761081777u, 4039313493u, 991945289u, 696983641u, 631061833u, 3570861850u, 3705978053u, 3700650387u),
+    SC(1533461215u, 3251798630u, 413692534u, 2120663869u, 3641562388u, 346273916u, 2805151805u, 495538210u, 2614105998u, 941135209u, 571942523u, 1946675591u, 670871258u, 316198740u, 1240159346u, 3579109631u),
+    SC(2931160846u, 2565627448u, 3688027460u, 3183474859u, 2578809817u, 2941830551u, 2947516040u, 540545414u, 1636554416u, 3529287437u, 4035671698u, 2469848097u, 1763379571u, 254761477u, 779803671u, 897860219u),
+    SC(187211519u, 3896611899u, 2222333500u, 1739178026u, 1433827786u, 1991079226u, 1887082529u, 621085998u, 128549360u, 3256378024u, 1404369045u, 3697428524u, 1393481528u, 1583160883u, 217816335u, 3900283180u),
+    SC(2880321861u, 2333219230u, 1795982176u, 3486679688u, 1062754583u, 3830321664u, 4162573142u, 4128844060u, 2914139085u, 3016780229u, 3896238859u, 610906216u, 187335095u, 3060263220u, 591099375u, 3044359976u),
+    SC(1251312550u, 1213946458u, 2175541834u, 1368306333u, 504325516u, 2375135251u, 2484717577u, 1442557098u, 3623894174u, 3821552373u, 3991106984u, 2809564596u, 2151599889u, 2608543710u, 3466679857u, 3035159498u),
+    SC(3576652558u, 3685152715u, 1711076453u, 1152060830u, 3928189633u, 1175394222u, 975241474u, 283885929u, 555046728u, 2678668168u, 1046211152u, 3657456723u, 1759648268u, 1102873561u, 341578721u, 923608784u),
+    SC(198988343u, 2194102360u, 4123332544u, 1390723561u, 3343526499u, 901556671u, 2366693664u, 2598201933u, 2880559608u, 1952675432u, 3793022906u, 4227148243u, 318702139u, 3251991102u, 1481901110u, 1748300169u),
+    SC(1148652083u, 2347805368u, 1001803335u, 1857427066u, 2283105558u, 2400439942u, 653134098u, 3852128391u, 1532571889u, 781992124u, 3006872201u, 1546478679u, 1782234403u, 3072924569u, 3378889533u, 4016088412u),
+    SC(2975759154u, 775965422u, 832225795u, 602105458u, 1694699661u, 2397626824u, 1043519780u, 1365120633u, 1380362265u, 197112465u, 1602415958u, 1350135632u, 1559059493u, 2268364119u, 2826161839u, 1033469562u),
+    SC(2716693847u, 86138064u, 4073000821u, 2317098489u, 1717231880u, 3588243856u, 666622382u, 3719302946u, 1015223389u, 2912913224u, 2073552710u, 1213263106u, 3609050372u, 154304929u, 1025582966u, 1786322658u),
+    SC(3903517537u, 1780205071u, 3653223484u, 744511503u, 1201577673u, 3258595234u, 1022930867u, 496077557u, 1827050422u, 1245169266u, 2115244097u, 2878999896u, 2595865347u, 2779528510u, 3365629735u, 2658763388u),
+    SC(1573320909u, 746937955u, 1386521839u, 1636280022u, 123322435u, 950262646u, 3315837495u, 88875171u, 4127376194u, 2241046952u, 3597783484u, 2082310196u, 266991093u, 778731279u, 3146187078u, 1315915832u),
+    SC(1664250641u, 1740560559u, 1755341807u, 581585052u, 4132845088u, 1176171114u, 1595541451u, 1799549862u, 3103245234u, 544215840u, 4060913718u, 1981627990u, 3214190336u, 2593234714u, 1050725249u, 3074696358u),
+    SC(2319505701u, 2587441976u, 587579905u, 2122732763u, 2909201674u, 3617104083u, 1397895417u, 1208484451u, 2947983181u, 2554938702u, 3716116538u, 1550194385u, 1140444108u, 2593807727u, 1786469663u, 2644495103u),
+    SC(3876876551u, 667369994u, 4111990079u, 2584066014u, 2795515019u, 3424694653u, 3455970040u, 544760922u, 3665651659u, 3253594580u, 4275920333u, 3379234041u, 2740329376u, 629256277u, 3936437483u, 1108859594u),
+    SC(1630611740u, 3646929016u, 31730280u, 1429820098u, 2569190632u, 2445289152u, 3403806364u, 2522990637u, 370023452u, 322187220u, 1507129737u, 2330342072u, 1119392889u, 326318985u, 944750852u, 758169345u),
+    SC(1271199813u, 3061204626u, 3500785576u, 394821790u, 4234029737u, 3662676927u, 3078798577u, 3519695185u, 2265525707u, 3116618324u, 3819984383u, 980872197u, 1690609605u, 2142337084u, 4024189180u, 280449520u),
+    SC(1168670882u, 2076109279u, 704233461u, 3380999012u, 1384536925u, 1479155743u, 1770942154u, 2730387423u, 4266239656u, 3051645937u, 4016543508u, 3669842190u, 2821837931u, 2397654710u, 320023459u, 2018900667u),
+    SC(1786931768u, 830213254u, 1691780218u, 570508753u, 2273203349u, 2987720915u, 4062124557u, 1257566884u, 1159828814u, 4241064547u, 3744404704u, 3873879162u, 4139269899u, 3156242988u, 356802439u, 3764339987u),
+    SC(355820806u, 4065720297u, 1825090075u, 165471602u, 2346213598u, 2087503711u, 1631488564u, 912925609u, 3440749500u, 3611612293u, 224280607u, 529114591u, 305084340u, 3814896846u, 3823450908u, 1117171u),
+    SC(4089189038u, 4114456415u, 1803964792u, 47891180u, 3402625957u, 3433448506u, 727588000u, 4072184721u, 3486831467u, 3945665010u, 1107103542u, 2047293357u, 809406815u, 4064801073u, 915186953u, 417335639u),
+    SC(2117897325u, 4194608438u, 4154617585u, 2335733321u, 573705199u, 1480930163u, 1869775511u, 861671380u, 1927943861u, 849818477u, 858931211u, 809239094u, 3064015181u, 2295234537u, 358027908u, 3522675081u),
+    SC(428654543u, 2690080706u, 3244410518u, 3629209086u, 1766042523u, 3605099043u, 3632547336u, 2902682072u, 3588630155u, 815080482u, 3193568782u, 4269515495u, 52517268u, 2189051586u, 4069993254u, 356317102u),
+    SC(503672457u, 3062690650u, 572013576u, 2424944909u, 1511292074u, 2013994966u, 988484432u, 2947605992u, 3089372243u, 2881768535u, 3719131123u, 2262046452u, 1042647609u, 208635959u, 2675984171u, 2487169721u),
+    SC(3699374452u, 2374139518u, 2786540335u, 442789191u, 3624960324u, 3464468731u, 1068266142u, 1929030177u, 3254627418u, 4014763791u, 4239974853u, 3292626033u, 1044209415u, 342731290u, 2868045822u, 3876342036u),
+    SC(1907973884u, 3298303495u, 87378881u, 484424776u, 917696496u, 3213856450u, 2593774107u, 802328185u, 4250546583u, 1873636078u, 3271849260u, 3287006289u, 523670960u, 2591260579u, 183774406u, 4023813324u),
+    SC(1132809391u, 702294998u, 3388205311u, 2723920515u, 4139344161u, 2305836206u, 1752598586u, 3730058042u, 1446400374u, 144139055u, 2380149095u, 2049242456u, 885377445u, 1545387830u, 4253762688u, 1016884353u),
+    SC(44957207u, 151953308u, 1888263027u, 224383108u, 3069180304u, 4219959649u, 1170402546u, 3559371298u, 3050189152u, 1567480262u, 583722021u, 3436349714u, 3292764192u, 3228127437u, 1283905972u, 1403770861u),
+    SC(2703443244u, 729722673u, 364094772u, 994046746u, 167185492u, 2922628640u, 1193164418u, 665442041u, 2470261891u, 2024218436u, 931666250u, 2948941287u, 4114495398u, 4151966062u, 2409712845u, 3991123179u),
+    SC(2609488834u, 3399047809u, 2260816407u, 1630832439u, 2863752878u, 2112670304u, 1023861548u, 3468732075u, 712849153u, 2826062610u, 3179038768u, 575324291u, 3421144016u, 1413174292u, 2159709322u, 3883078194u),
+    SC(1692234839u, 3889813305u, 149076384u, 3695519531u, 944440371u, 2665001709u, 3372717638u, 300542386u, 3935369386u, 3793022486u, 3982527090u, 912890009u, 1311841735u, 2014247045u, 2995949763u, 2184988430u),
+    SC(1495430193u, 3193994347u, 3542613361u, 1320623239u, 548125250u, 478106890u, 1798665853u, 1872893804u, 3413471684u, 119297319u, 1706895518u, 2748268344u, 2037228209u, 747977995u, 2265256540u, 1214371224u),
+    SC(1406625229u, 2914152094u, 478207473u, 2570535779u, 2218491144u, 2804120540u, 2354120431u, 2036327106u, 2075898264u, 3946420027u, 1993899905u, 2496942416u, 2792181563u, 311050430u, 3381240837u, 2910595195u),
+    SC(3842498206u, 3245030387u, 1379571868u, 257947329u, 72543888u, 2607218625u, 1836798362u, 1471899311u, 2733830186u, 2188566126u, 1036563349u, 144022226u, 1370936272u, 80222546u, 1503986146u, 2415364394u),
+    SC(24070342u, 246960050u, 2173713292u, 3119909754u, 1700797814u, 3802495363u, 1432996227u, 968140530u, 2249440132u, 2207803421u, 1727129437u, 1533998159u, 3626481193u, 256464548u, 1104737539u, 3711087241u),
+    SC(1694790062u, 2000840163u, 655053106u, 869346693u, 196709944u, 708524793u, 212558649u, 3779354710u, 2207152019u, 883584998u, 3404270178u, 3545875257u, 410730546u, 366574810u, 1315074634u, 2779054854u),
+    SC(366912534u, 4197734479u, 3432047005u, 1770151854u, 881662881u, 4252682273u, 1436199978u, 3156336040u, 33336306u, 505007720u, 3994198994u, 2226983684u, 17802741u, 3563035669u, 3557229123u, 2822975559u),
+    SC(3022726293u, 1327460589u, 1035534471u, 2203564614u, 4003293703u, 3036137297u, 3697064455u, 2958771938u, 3780584427u, 235658214u, 3606220141u, 2688826467u, 1213330868u, 3310468806u, 2677118624u, 157937009u),
+    SC(149546229u, 3333336113u, 497750309u, 3737760864u, 1789987710u, 2384791904u, 2709505407u, 3223523203u, 4289782289u, 3349134201u, 2025672275u, 2690262655u, 4058197044u, 3592977902u, 1683451185u, 2878708402u),
+    SC(2277405475u, 1941785459u, 2250767203u, 3175960767u, 3606231937u, 4161058088u, 693411817u, 1071754286u, 4138276975u, 4048009653u, 4291314866u, 3960350042u, 451236733u, 1969373832u, 3464765944u, 2123686308u),
+    SC(1130372449u, 3358996596u, 2246660426u, 3049820749u, 3536835686u, 2939464853u, 2566113u, 1704812791u, 2274476032u, 2081016141u, 3005743947u, 2294660028u, 288568630u, 1719266057u, 2589881781u, 2210147370u),
+    SC(874190208u, 4163924421u, 912198603u, 3127291798u, 1761797012u, 707092652u, 2698686371u, 716479757u, 1268275987u, 3309932582u, 2146788562u, 3563363439u, 2123357153u, 3121618324u, 469978644u, 1686600480u),
+    SC(392068275u, 3460971075u, 2087813602u, 3349131604u, 866917032u, 3848573675u, 1466069361u, 4048399765u, 835609000u, 2016736558u, 4244140095u, 2473160514u, 1477640533u, 1674206620u, 3912077250u, 2165529357u),
+    SC(1523855564u, 1692802145u, 3820210248u, 748940460u, 2311185557u, 1283504792u, 614352321u, 812737965u, 3198328928u, 1348211644u, 830251139u, 3316168796u, 2662162286u, 448937918u, 2893868266u, 2454833041u),
+    SC(1104994521u, 1840046872u, 2558919391u, 133858497u, 135204067u, 3715959282u, 2330980262u, 230209591u, 1955998783u, 3986321052u, 2305177066u, 2236818358u, 142934161u, 4165856819u, 1021311184u, 3531766056u),
+    SC(2783921304u, 2265992666u, 272375234u, 1376155203u, 2599234910u, 70450779u, 2721890626u, 966138828u, 482146366u, 2741231833u, 1047448626u, 2253634170u, 2707801382u, 1985677808u, 1768623457u, 4045593402u),
+    SC(1302490830u, 2597609475u, 951973515u, 2234133694u, 404905774u, 762142306u, 1840607797u, 4214922565u, 3507182179u, 2058700479u, 3428912685u, 473784820u, 1638967302u, 3887737287u, 1027467529u, 3925534297u),
+    SC(1851924079u, 1406288014u, 1217236657u, 1780065527u, 3923334533u, 300323089u, 702471273u, 4186916707u, 2064944882u, 1944170801u, 874173559u, 2470627260u, 2073319980u, 3039577230u, 1270218064u, 1021975065u),
+    SC(3954136932u, 1542288489u, 2606230133u, 2319014544u, 1723523594u, 2399677110u, 3661976789u, 663480379u, 1481110752u, 1818570803u, 1579805332u, 949937126u, 3642110282u, 1611817000u, 1695201760u, 3218062247u),
+    SC(3237513841u, 1897620269u, 615865791u, 86709714u, 4205022369u, 339263866u, 1785722421u, 856692783u, 750759245u, 381710369u, 2254511852u, 1082163963u, 4214134936u, 337269320u, 475653198u, 3439752959u),
+    SC(1570466840u, 2226623640u, 3324268479u, 640230086u, 3692879287u, 1022823136u, 458393520u, 1532781392u, 848200477u, 791352876u, 1253971524u, 3142896773u, 417011596u, 1533733246u, 1585778956u, 2105532189u),
+    SC(3520149007u, 938307177u, 3572634822u, 842683319u, 3850204565u, 1435516950u, 1699498480u, 1308811804u, 1652484755u, 3335107903u, 2488636436u, 1084797184u, 1857710292u, 1821518698u, 354546580u, 1842437710u),
+    SC(4022962123u, 4043455221u, 1487731224u, 2545005234u, 2900531843u, 1701267203u, 3835075787u, 3997243185u, 425355877u, 3547925484u, 1902389638u, 1003418674u, 3816964860u, 2673237435u, 3780754498u, 4118023273u),
+    SC(4077022103u, 373158845u, 1639484280u, 1938179200u, 2525830523u, 2213505793u, 822677418u, 405295088u, 394017377u, 1747149739u, 3207075349u, 3583969023u, 1602708556u, 2228646121u, 2797955777u, 3054588059u),
+    SC(1563754335u, 305879913u, 2460783302u, 2359099206u, 233762041u, 1761575691u, 1445071117u, 1747736691u, 756681628u, 2393612389u, 1126190577u, 1223366168u, 625229562u, 2163781619u, 3566954022u, 3314899656u),
+    SC(3422140951u, 2494124615u, 3281887333u, 2217774280u, 3773716765u, 833204411u, 3670438528u, 1183074292u, 1419450563u, 285126305u, 36043486u, 2470515411u, 1079513117u, 1961887032u, 461535594u, 3494254390u),
+    SC(2450093498u, 165815835u, 3210314406u, 3044700996u, 2390181816u, 915241555u, 2041359572u, 3353137951u, 3915253000u, 2175751437u, 153231194u, 3914600497u, 1667748427u, 3578117579u, 1129215544u, 2897505725u),
+    SC(2170235620u, 1876735325u, 2456607976u, 726607312u, 957555474u, 1002537215u, 872214834u, 133089892u, 1660303302u, 2106090356u, 2401119782u, 2253461689u, 2569558919u, 1441944850u, 3379082494u, 1236846961u),
+    SC(465151682u, 2385040570u, 820676153u, 2051881086u, 667582501u, 3659733286u, 233030740u, 4158697838u, 2697707542u, 1580341020u, 2172921438u, 2893939015u, 543377877u, 1090738836u, 4117691465u, 3705121683u),
+    SC(1862358014u, 3757933546u, 2962870941u, 3722606833u, 2617615546u, 2028686397u, 886257606u, 3664296994u, 2771570701u, 889274245u, 2671788499u, 2854428459u, 2680461671u, 235810690u, 1297109497u, 3891316262u),
+    SC(877983547u, 1005483940u, 218157956u, 1908364634u, 3978552806u, 3336235093u, 782022569u, 455091594u, 2462189638u, 3487506063u, 1072020650u, 113110467u, 2569438010u, 1061212815u, 598276434u, 3637611998u),
+    SC(913835977u, 2741005134u, 462169622u, 2907865136u, 503117446u, 1089330946u, 4233703804u, 588159622u, 520240943u, 2730224871u, 64725324u, 306222539u, 4257544495u, 2628116u, 2198119442u, 3245263590u),
+    SC(2395274691u, 2559702703u, 326426735u, 205830165u, 28845377u, 1979468041u, 2897893697u, 538637867u, 768002789u, 3401767047u, 2212274405u, 63412472u, 4261837775u, 1606588241u, 326462711u, 4014890779u),
+    SC(1556236909u, 1281041657u, 341061521u, 3858404223u, 4288709969u, 1371060290u, 2267656298u, 2440602211u, 2983888437u, 2169707039u, 3216214606u, 1100980734u, 3398260136u, 1037814680u, 3659126223u, 4219315314u),
+    SC(2207275302u, 3224962499u, 2841922156u, 3665890770u, 2455775824u, 1355098657u, 2436168781u, 3814301343u, 1116939791u, 3903809426u, 2718634334u, 2860742200u, 2425629067u, 567926294u, 3475038405u, 2051410074u),
+    SC(2487945598u, 1193404893u, 4162865859u, 221804794u, 3908725780u, 883836962u, 1209739653u, 1703524039u, 1606710629u, 820621461u, 4172781123u, 510942105u, 354794828u, 74862222u, 3903802262u, 2614550006u),
+    SC(2869643839u, 3484926260u, 3788156676u, 2788848433u, 389184030u, 1604911873u, 129362879u, 874755901u, 3790049891u, 2780543626u, 3447245100u, 4209823034u, 3091809491u, 2019297153u, 929283866u, 3465988570u),
+    SC(1470317749u, 571419406u, 4156522431u, 94561511u, 446874584u, 2079363260u, 4161003502u, 266909791u, 4163599630u, 149919264u, 3834421011u, 1403464341u, 2850101820u, 377016080u, 1466852251u, 2980565070u),
+    SC(1845837338u, 2148236364u, 1375257801u, 1559295231u, 906552214u, 3964016781u, 2712217151u, 3369605829u, 2251857560u, 3821544393u, 3786750031u, 4242811075u, 1659069817u, 1912798650u, 3695021129u, 962491507u),
+    SC(1658283014u, 402944383u, 3003992700u, 1969730885u, 1218611692u, 2131246876u, 1507765797u, 3460848823u, 4057346379u, 1713184653u, 2234635643u, 2490432339u, 3511720749u, 2787549436u, 1286588737u, 3060317828u),
+    SC(3856345330u, 564114090u, 2198663432u, 198329498u, 1548552192u, 2194884184u, 2654240561u, 3710461199u, 3264669254u, 855211477u, 3124457490u, 3939781487u, 844091346u, 4083125028u, 2388196968u, 2290865235u),
+    SC(1193653225u, 2748321252u, 2320701308u, 2684322591u, 1933494427u, 3264826034u, 1072174577u, 162735913u, 2889578311u, 3728261135u, 341826420u, 344111954u, 843130829u, 695856658u, 3567904393u, 3120097144u),
+    SC(3503534006u, 1227649767u, 961468696u, 1880351559u, 2956375646u, 2809005417u, 3152667462u, 1104620350u, 768844891u, 2494234119u, 1392909482u, 10650976u, 3180669707u, 49692435u, 2532585399u, 2382561011u),
+    SC(2018764597u, 3608660055u, 2545440340u, 2722811891u, 272712685u, 3477818188u, 2020148879u, 3271844652u, 11039705u, 3876573514u, 3262610063u, 3047172386u, 3135480602u, 345214569u, 3411235669u, 3726572253u),
+    SC(115025587u, 2102385753u, 329359386u, 348726102u, 3997491913u, 2141024970u, 2005524019u, 2397635748u, 352199205u, 3207307468u, 683787273u, 3917782090u, 3635279762u, 1669765992u, 1419938537u, 1662599675u),
+    SC(3039758441u, 3147345724u, 187662172u, 1721738302u, 1401831439u, 1672072422u, 2578067192u, 3945285855u, 609643300u, 1438401866u, 3887298764u, 2699393898u, 2340560012u, 2809116760u, 3143724567u, 2298986074u),
+    SC(2249514465u, 518434563u, 3946097129u, 2534385603u, 591483584u, 327481316u, 3252812090u, 26719304u, 705766818u, 2895734896u, 732048218u, 3526411278u, 1314684501u, 3636095905u, 1582617548u, 2071131084u),
+    SC(2552903598u, 1650421339u, 2028411928u, 253803984u, 2335377643u, 1506855602u, 3686926647u, 2475433210u, 1730142575u, 10899752u, 1494370786u, 189821119u, 711499307u, 3714865116u, 417673370u, 3064204556u),
+    SC(1810535173u, 649364124u, 3969479727u, 3374521344u, 1652165039u, 583703963u, 1082237693u, 1279160378u, 2932162602u, 1414626124u, 523521300u, 2979282537u, 3612614416u, 3294352515u, 721596505u, 1234857153u),
+    SC(3044165505u, 2257864830u, 2093058227u, 919672496u, 1409378969u, 544413984u, 195542313u, 2522365659u, 1555812742u, 528524477u, 1029187117u, 3955593213u, 489131955u, 3034054342u, 546267782u, 2005163228u),
+    SC(3726302818u, 2074087057u, 2020560723u, 413946770u, 1307944244u, 1884216246u, 772709933u, 2575062034u, 2129954501u, 200424443u, 4235051354u, 1103128383u, 2848981990u, 3788544654u, 1275063965u, 2921341408u),
+    SC(926459260u, 2977045569u, 2677950045u, 4219527639u, 863110040u, 3154187885u, 3564557167u, 865648800u, 3790756786u, 375566701u, 1831380521u, 2911123546u, 1138710124u, 1385319421u, 293948024u, 3071025909u),
+    SC(1286480321u, 1797919289u, 2824173041u, 769617322u, 425066168u, 3075485239u, 1765802094u, 2055309405u, 721414229u, 948330712u, 661069449u, 3358077618u, 637152411u, 701848034u, 934237788u, 3034356163u),
+    SC(1280383519u, 3129609187u, 1849151317u, 2243740583u, 2545919982u, 464150585u, 1462958840u, 3703750011u, 3932813204u, 1550560255u, 591400916u, 2841471027u, 2880598633u, 2289841965u, 2322220490u, 2992001455u),
+    SC(3625048260u, 842744688u, 638042714u, 3734203402u, 3269764171u, 732241795u, 549787550u, 1952087593u, 1878618274u, 398411768u, 228634283u, 3410562619u, 1187438399u, 1777985852u, 1011734858u, 3888141125u),
+    SC(270448083u, 3051727615u, 3818633981u, 4047200250u, 870017198u, 531667723u, 481175014u, 381959918u, 2640991508u, 2556916314u, 1618615446u, 3942846988u, 2761361721u, 887148362u, 372352570u, 3133529523u),
+    SC(2313883986u, 3101549663u, 3779195423u, 103803601u, 3973873520u, 4026071400u, 3726757771u, 1917322521u, 4171446212u, 830596053u, 1777113559u, 4072425328u, 3412525992u, 1677449563u, 1107144828u, 3063395399u),
+    SC(1406546931u, 4102988877u, 658345758u, 1162877353u, 1238982379u, 1759408333u, 3172898381u, 2597379094u, 455535990u, 2521681691u, 1065346803u, 778942438u, 2391799022u, 1224631215u, 1224725307u, 3440788990u),
+    SC(3725617424u, 1233719558u, 1504267558u, 3117341540u, 1826872139u, 2207821082u, 2465790303u, 3638148714u, 2271480641u, 3688471830u, 1468677382u, 3527229576u, 2271782118u, 3707256443u, 1537052979u, 1588870450u),
+    SC(1089281647u, 194961989u, 2887293594u, 2013911568u, 3429739131u, 1101095882u, 4150359868u, 1794490018u, 4293727489u, 1922628506u, 2028698591u, 338734084u, 2193287214u, 2803464923u, 1354547681u, 4230052654u),
+    SC(1442491118u, 1503792026u, 931451249u, 2661624268u, 461026211u, 703753722u, 2746293206u, 1740248513u, 2851640219u, 1387025379u, 1590982429u, 2387019356u, 226437125u, 2816821084u, 926236127u, 405752421u),
+    SC(3038635598u, 567249071u, 562088471u, 613772560u, 2841298439u, 4030004427u, 2772160555u, 4203410427u, 392010608u, 476393151u, 1186570015u, 1852228774u, 2609119257u, 2760579780u, 2274048108u, 62388254u),
+    SC(1364635868u, 3168345730u, 1269970366u, 2473054016u, 2072586216u, 3448193393u, 1433377147u, 2064101699u, 491093007u, 2728217663u, 3864915225u, 287768941u, 3557481104u, 3417364702u, 3266268152u, 550277596u),
+    SC(1005919602u, 101402995u, 371174485u, 2296660391u, 4053351430u, 2031840205u, 14753166u, 158193213u, 2076619888u, 2426908635u, 4234383453u, 3748234393u, 1944184034u, 2943676710u, 1676339364u, 4101123401u),
+    SC(3533115537u, 537428226u, 290780371u, 3127848353u, 586839238u, 1336598618u, 3614291888u, 2597724133u, 1934683050u, 4073518024u, 4181773332u, 354165698u, 3157511027u, 1699905878u, 2456063851u, 1653489608u),
+    SC(3270395850u, 2383876399u, 2723521824u, 570413835u, 1836727166u, 591483500u, 1436246185u, 3345482045u, 778996587u, 3627777883u, 499705915u, 3987976762u, 2161770248u, 539591450u, 1160794134u, 736945224u),
+    SC(1436129494u, 2648493581u, 2651693982u, 2529971200u, 3320792139u, 1444788906u, 3832917437u, 1047574223u, 3298568704u, 2511269467u, 2381012620u, 3679265252u, 3473879411u, 452131525u, 633681090u, 889172776u),
+    SC(1263207107u, 3838360285u, 3830646211u, 2535565709u, 2082035165u, 2430382841u, 3923069185u, 1807414115u, 2696313726u, 3197065651u, 3260896366u, 64761933u, 3525995108u, 1633406905u, 632718819u, 416560232u),
+    SC(4222609405u, 2016850983u, 1372555644u, 1564641660u, 1984998888u, 3994996767u, 3772243244u, 2865056197u, 793844035u, 1389395537u, 2071478773u, 2396672549u, 580550184u, 2588228331u, 1584402702u, 308708406u),
+    SC(3436381945u, 207992992u, 2021975584u, 3074082022u, 2175933392u, 709566879u, 2504909238u, 1886830700u, 2185208959u, 2813375756u, 2423281372u, 1944077684u, 4155559u, 1514964326u, 2327180721u, 1448562955u),
+    SC(3137067064u, 2572839197u, 995788554u, 2017936685u, 2435061085u, 3634010496u, 2181795158u, 404314683u, 2381629946u, 3376949742u, 4212031314u, 270579120u, 1325790421u, 2208073351u, 1317617277u, 145592995u),
+    SC(3508915258u, 2155025774u, 169241336u, 4287892068u, 1899859767u, 3093895675u, 360498048u, 575620495u, 2687559862u, 2890807207u, 3741386058u, 3928205198u, 465019438u, 4066398883u, 2687823036u, 3157634014u),
+    SC(2101944104u, 459135674u, 4012663859u, 3189957677u, 4073831421u, 2323548262u, 2361337742u, 3414263746u, 3390576157u, 1882589542u, 3392675491u, 4150309630u, 682639559u, 3955763961u, 3198319526u, 4108314861u),
+    SC(835508787u, 2670268986u, 2260900188u, 1788823929u, 1836098965u, 1350154593u, 1612050555u, 3455632286u, 2930933003u, 3992330156u, 2572323487u, 4032877042u, 929441456u, 3162536473u, 1444687439u, 3904151397u),
+    SC(127820999u, 4099903881u, 1821509438u, 1907847089u, 3857486127u, 232856487u, 3611533130u, 695732154u, 1473852470u, 3008665148u, 1485941731u, 2187168180u, 3514205628u, 3378720382u, 4270186199u, 1478740257u),
+    SC(3592629983u, 4241176680u, 1911489915u, 1623041087u, 1777607378u, 3736920172u, 2023956330u, 2353145678u, 333115296u, 3001213085u, 921989874u, 699791313u, 1486983011u, 2889729238u, 3593258967u, 3960404006u),
+    SC(566293144u, 3000427429u, 926481408u, 3358102616u, 1915582674u, 1218657958u, 2817242727u, 1148073614u, 2255836140u, 399703445u, 3096833758u, 366630558u, 3417567834u, 3857921186u, 2986762463u, 3741721475u),
+    SC(488258817u, 231471001u, 3578880540u, 1425491744u, 3936497948u, 1071231440u, 4109552366u, 1278318280u, 3584532757u, 2566977804u, 2275088944u, 328490380u, 1414774556u, 132506429u, 1871687342u, 1133982955u),
+    SC(1464370816u, 2410258142u, 13277137u, 2239930705u, 1659006300u, 2001970529u, 1330360796u, 686253877u, 3736971353u, 1897393632u, 3703631045u, 1321313428u, 3015437876u, 2514168606u, 3953794489u, 801209455u),
+    SC(3067950291u, 1289871354u, 1310622220u, 1284234911u, 1618056403u, 471654524u, 2674896328u, 2542891354u, 2348058728u, 3825587507u, 719064777u, 77318095u, 344450388u, 973353472u, 1903715617u, 2319043741u),
+    SC(2432294613u, 1762166642u, 3391867015u, 354607003u, 1478614892u, 2652942688u, 255132861u, 1251070174u, 219670090u, 3713223278u, 4258311974u, 3024700217u, 4151000091u, 308516857u, 2730408566u, 3942187692u),
+    SC(3311351016u, 1490129747u, 2433148064u, 3271567475u, 3674714681u, 2601527709u, 638241893u, 1798109785u, 2107586772u, 1958060590u, 1922342783u, 3805215540u, 2593120763u, 3245051354u, 301032158u, 820318043u),
+    SC(1793343890u, 3549004229u, 2604631122u, 3298997799u, 4087092946u, 3069519221u, 207558434u, 1454959789u, 2612766941u, 2085167178u, 2665237393u, 3817752947u, 4200717852u, 3987123553u, 1614649109u, 2131429789u),
+    SC(866637369u, 1111366454u, 1788063129u, 3937813580u, 3171689759u, 1826142106u, 3761524463u, 1876754364u, 3261141708u, 7195178u, 4199704655u, 3387761363u, 788953233u, 3585786560u, 733507131u, 2484192798u),
+    SC(1212617521u, 3938748016u, 687498818u, 2808915653u, 864076249u, 257074354u, 3932425543u, 4049186570u, 3035268422u, 2482888732u, 4220533297u, 414933493u, 3305405332u, 1884975437u, 1532521799u, 2685675268u),
+    SC(90549305u, 2598842816u, 1291823799u, 1137855345u, 1927216505u, 3199782534u, 3563066021u, 3260578071u, 3736431269u, 3562025450u, 4232126444u, 3768227398u, 342247817u, 4249829591u, 2042636673u, 2562435912u),
+    SC(2521315509u, 996944765u, 1787625853u, 207237884u, 2572456084u, 1842083699u, 3936815196u, 2553367563u, 766484284u, 3963880271u, 3366395616u, 4000759159u, 2893012126u, 4194576943u, 1823448158u, 4245883799u),
+    SC(3154172560u, 2072840075u, 2642629165u, 2924776212u, 1872494349u, 49252476u, 1252929310u, 3303770325u, 1808858385u, 4192394099u, 1710366161u, 885729782u, 267341183u, 3021581295u, 3942520228u, 551399762u),
+    SC(442103893u, 16293644u, 4047362222u, 2673759500u, 2718444467u, 670765341u, 122967467u, 3685203620u, 2124610368u, 3563105791u, 3387055187u, 174441736u, 3883822710u, 3806606786u, 353142538u, 1979762723u),
+    SC(2050711835u, 3552574570u, 3562045794u, 1164529700u, 1160185507u, 664432602u, 3632634021u, 1322043236u, 383817097u, 1745251922u, 3363034863u, 3846820778u, 2211646422u, 2715234515u, 1755978450u, 841167173u),
+    SC(804083063u, 2629700186u, 2020583771u, 1549197946u, 2694958120u, 1360079855u, 1289085367u, 22900113u, 2129316903u, 2989064117u, 1675006458u, 920413450u, 4134523878u, 1877337655u, 2572801134u, 759946746u),
+    SC(645583383u, 2502877029u, 1732180714u, 1810609227u, 25372381u, 4055067906u, 4027927053u, 2001376600u, 2002336960u, 2124242526u, 1753905971u, 200624641u, 1883031991u, 2689097325u, 2423592379u, 295780335u),
+    SC(3949909548u, 597400008u, 1769524460u, 2784174405u, 235746331u, 3397298960u, 1872781025u, 2137425896u, 2911477282u, 1358342376u, 3458839077u, 2209187669u, 711879352u, 2422330171u, 1714027516u, 1388356161u),
+    SC(3395088764u, 3762102607u, 189723452u, 1097362511u, 1351067035u, 4169967537u, 143722829u, 1124769371u, 400838379u, 1195341242u, 3489326723u, 3370779289u, 3784528256u, 1918337086u, 4187372243u, 3499662569u),
+    SC(1283179164u, 2901435438u, 1676686828u, 2839440236u, 3358532047u, 1180842543u, 3838255454u, 1374171004u, 2086004590u, 2270591340u, 339698919u, 3825877035u, 3948116964u, 253711138u, 3852282850u, 2188863605u),
+    SC(1472903401u, 3022162416u, 1346261011u, 181358039u, 2037920132u, 596245792u, 2159418307u, 1729124579u, 2015515416u, 1718691645u, 2813376644u, 3878591470u, 721718341u, 2486227658u, 2084145834u, 2681856700u),
+    SC(1009513021u, 4044491828u, 3733011074u, 2775073781u, 2884883058u, 3979242535u, 1409245968u, 2613346878u, 391764835u, 2293158451u, 3456916295u, 3969764232u, 1987316008u, 3778013648u, 3499013977u, 759110032u),
+    SC(3222317484u, 2212525098u, 221464796u, 1037032914u, 873925282u, 684943446u, 3629652762u, 246102226u, 1665964013u, 105162383u, 3790723615u, 420280608u, 724420624u, 1147893994u, 2631038596u, 1014409981u),
+    SC(2762725870u, 1418437736u, 239908402u, 3017394345u, 1327200063u, 3124401760u, 1426348346u, 2449938836u, 974399082u, 3123065495u, 4234850314u, 2214811229u, 3375958856u, 3959409505u, 297134319u, 3371725186u),
+    SC(3691169874u, 4022408689u, 3317728576u, 3738107877u, 3599467237u, 2578941713u, 1517957949u, 3906838898u, 3840301370u, 2384128066u, 3397340846u, 3637299874u, 2318792924u, 3414510010u, 594017013u, 1600924102u),
+    SC(3997657576u, 574104319u, 3263846987u, 1596587388u, 173341825u, 1914133676u, 460174754u, 2448185288u, 4238526140u, 1081526507u, 2694286234u, 721508548u, 864617748u, 671696409u, 943800294u, 3223337055u),
+    SC(4076891165u, 881921039u, 3560285918u, 3473443896u, 754553039u, 824505003u, 2971477799u, 3644780646u, 7743989u, 2855698257u, 2728311537u, 593293927u, 4160842348u, 2296368539u, 2194893060u, 3377064674u),
+    SC(2096832573u, 129980009u, 312412734u, 844906454u, 2981742596u, 1228075251u, 2034996055u, 510858167u, 1333180925u, 607362104u, 3364635159u, 947585389u, 3836610814u, 1729637689u, 2191809460u, 3895182863u),
+    SC(214580448u, 920652179u, 164826088u, 3875820973u, 4025138801u, 2209264134u, 2737098987u, 842083338u, 2524229208u, 4271144045u, 885405477u, 542689420u, 2444507101u, 2564446386u, 251494029u, 370522597u),
+    SC(2679521608u, 2177719335u, 2195326748u, 33131889u, 3649134546u, 596234770u, 3328888422u, 179362248u, 79844436u, 441530178u, 1601561877u, 3226410099u, 3508359239u, 2625024155u, 3458449726u, 3514905169u),
+    SC(31178431u, 65262681u, 282303970u, 844499789u, 3948751576u, 111809858u, 3267391670u, 1364560677u, 3966297884u, 781509776u, 1100248383u, 3611839649u, 2483990097u, 1770199158u, 2273025255u, 755735985u),
+    SC(2001850905u, 2465494049u, 2000848235u, 80235841u, 1518931689u, 605576737u, 1512114751u, 2758522359u, 689285573u, 3077621868u, 3990038345u, 1063881751u, 1668413089u, 1286363682u, 1940112968u, 455311343u),
+    SC(967330208u, 1528339518u, 544745859u, 3975570609u, 3887635606u, 1309792055u, 1887010762u, 3975375405u, 3555129585u, 1636948742u, 3189929169u, 1449678997u, 1223070291u, 1425281300u, 4097531601u, 20353221u),
+    SC(1743085861u, 2996628768u, 4193867042u, 3558004348u, 2162415144u, 3099581930u, 1988171723u, 3885704635u, 1619917845u, 2117870580u, 1252064648u, 1023595155u, 1015279055u, 107914623u, 2439493394u, 2365839905u),
+    SC(173125338u, 49796509u, 3542019104u, 3914873334u, 3973906927u, 1385375675u, 1555179959u, 3079607589u, 1883858911u, 2482734635u, 1027125647u, 1281890475u, 1713489872u, 2161716445u, 520131264u, 3615783171u),
+    SC(3380635966u, 1939983174u, 4125847991u, 1940915081u, 4173116271u, 4215840378u, 2867219491u, 1791063133u, 3208347790u, 4268457723u, 1998083045u, 1874568936u, 3014795247u, 7367636u, 659341400u, 3069895796u),
+    SC(3347970352u, 3170192412u, 685931179u, 695593459u, 2484501458u, 2492286739u, 1796711284u, 169054633u, 2588036918u, 1832548798u, 1438342810u, 675013088u, 373030434u, 465985118u, 51966174u, 810392295u),
+    SC(2591422396u, 3335713705u, 3860238012u, 2407472720u, 2845356516u, 3866302181u, 4213452740u, 1831354505u, 213154022u, 3757619626u, 986737774u, 2412241754u, 968847043u, 2021226431u, 3557765465u, 3205930497u),
+    SC(1991381786u, 3674977255u, 3678939005u, 2513335268u, 2126126716u, 3069706688u, 3523965347u, 2339267108u, 53361882u, 4016104795u, 178140902u, 3441981239u, 426531576u, 302794674u, 4154270866u, 2574853690u),
+    SC(562660193u, 1321572125u, 4116682441u, 1034458243u, 3452718150u, 3736657512u, 4079633075u, 1544783073u, 741960784u, 1151636794u, 2989108514u, 1198954305u, 3320685898u, 3653872791u, 3595070303u, 309177406u),
+    SC(2886404681u, 1318918157u, 270384668u, 2770927307u, 2693024166u, 3479012009u, 2853501045u, 3822815964u, 651285522u, 631354755u, 768949148u, 1453762792u, 924701087u, 826682841u, 2997812798u, 1883317588u),
+    SC(4167677324u, 139568735u, 3178050345u, 1979029154u, 2635757773u, 3153087003u, 1841982503u, 820004389u, 1088348996u, 4235156594u, 3247117827u, 3779695772u, 2697966363u, 3099138825u, 3284904880u, 3332751344u),
+    SC(4149150427u, 604382479u, 2307171826u, 658269165u, 2789254202u, 2390586026u, 3975646574u, 3109309498u, 2284730989u, 3402374802u, 2319194721u, 2247277809u, 1580617594u, 518957802u, 470480275u, 3481671771u),
+    SC(3227598518u, 493311467u, 784110212u, 2695522770u, 2294517840u, 1266583199u, 4091102122u, 108963421u, 1928731365u, 666224686u, 1257933158u, 1440295069u, 697506843u, 4040387593u, 4265743301u, 662998202u),
+    SC(3949395864u, 1622804646u, 1007671492u, 1897377456u, 2920136547u, 1380124583u, 3950223112u, 4078077403u, 204554954u, 1421669038u, 2332417977u, 1312879802u, 2100716275u, 125101590u, 1439125850u, 2279458261u),
+    SC(980486374u, 2703581281u, 4230337931u, 3394455042u, 3827067669u, 359404984u, 1906644720u, 3964306973u, 3668847874u, 68987826u, 26326462u, 3246292616u, 2507930839u, 1725895206u, 2709718606u, 1011061670u),
+    SC(3514710616u, 3358681553u, 871265137u, 2065719084u, 3927584755u, 1316243800u, 2493420547u, 3103300959u, 2562940797u, 1776671115u, 2450520826u, 1830146889u, 762707129u, 2177519650u, 1523056434u, 1636506144u),
+    SC(3605211282u, 3472603373u, 339020991u, 639165182u, 2563438292u, 4150760325u, 4294142891u, 200692764u, 1903511086u, 3188678336u, 126298965u, 896476312u, 2539755196u, 3988652574u, 134749885u, 2992857752u),
+    SC(831343103u, 1625882798u, 1854808450u, 4086218758u, 2195572910u, 2477417105u, 2262162936u, 184545141u, 1855450151u, 3715981645u, 3253555160u, 4260801136u, 148685803u, 3190327345u, 2844295526u, 107164594u),
+    SC(4251950640u, 393403275u, 2794366382u, 3045436349u, 3228952363u, 1758918268u, 1513062724u, 2563728198u, 3671922407u, 1685543893u, 3395051345u, 897856854u, 3613426224u, 2868855077u, 1297001272u, 489214656u),
+    SC(2413976376u, 2730968929u, 2836320397u, 1271821964u, 4034144298u, 3914730801u, 1449845818u, 405658934u, 1860298826u, 2009508728u, 2731385267u, 800980526u, 1373005891u, 656217543u, 1066277506u, 508306338u),
+    SC(936316626u, 2297270255u, 1256291279u, 4139759637u, 1041414834u, 2758639197u, 779086745u, 2543042296u, 154040919u, 418056017u, 3381810420u, 3719676536u, 3782885755u, 561591097u, 295310445u, 3152273619u),
+    SC(1754013793u, 112840904u, 1994307602u, 3053453544u, 3969966159u, 1394528736u, 152405058u, 129974332u, 3132404410u, 1102728531u, 3746639478u, 840960988u, 18711939u, 4073633213u, 2830625556u, 1556873726u),
+    SC(1263315626u, 4114191669u, 3626120989u, 1670795798u, 3518313860u, 3634005225u, 3630709082u, 1890834436u, 1037903791u, 3440903322u, 989974595u, 2002904298u, 1697627537u, 291260170u, 3838295360u, 1374581714u),
+    SC(1868221380u, 1094048352u, 1972296101u, 414423903u, 1204593560u, 618794582u, 340057426u, 3808042286u, 98344262u, 3858159949u, 1219440380u, 49387426u, 4146721239u, 861906281u, 86299516u, 1254971588u),
+    SC(2043860041u, 1040173969u, 1876578939u, 4172723746u, 1713205027u, 1937934534u, 3465818429u, 3261594690u, 2993175537u, 1068038140u, 3190827043u, 3753677139u, 2375034769u, 3587628513u, 3531628343u, 168560859u),
+    SC(866707582u, 611023772u, 2625087152u, 2093382977u, 4086390204u, 35127576u, 3229616947u, 4193867044u, 3131581516u, 1481625695u, 643162987u, 3806708825u, 545075439u, 3705348756u, 1890796339u, 2635530127u),
+    SC(2585170226u, 4085808632u, 542513786u, 3837613153u, 842390962u, 263879193u, 1062054586u, 2038861461u, 1752154903u, 2572437188u, 1117016598u, 446060890u, 2721296640u, 3858283456u, 1905852969u, 1147341773u),
+    SC(2030793972u, 2214972991u, 2596128745u, 70906613u, 3361314974u, 749070076u, 688152836u, 2273553474u, 2304887059u, 1445168586u, 2567279523u, 1997609565u, 499545643u, 2980653222u, 1857761355u, 2317657857u),
+    SC(3802386639u, 2921317081u, 2278207158u, 2670918870u, 2504464261u, 4112835640u, 3041426083u, 1928979612u, 2629976581u, 3975311500u, 897506132u, 814539858u, 301456387u, 2566605019u, 1233310519u, 348729414u),
+    SC(213060675u, 1502790037u, 1993568945u, 2532486760u, 3486672190u, 1675868794u, 725361132u, 2517355498u, 4132910521u, 1887647945u, 2898906017u, 1263082378u, 4217909336u, 644499517u, 1233636819u, 2311901364u),
+    SC(531553429u, 3593538542u, 1654194097u, 1874060963u, 694986347u, 2090425645u, 4270998401u, 283685994u, 889429567u, 2181163268u, 3845623043u, 735623014u, 651817166u, 1143329486u, 3887845967u, 3094499465u),
+    SC(2789658458u, 736674257u, 1057308940u, 3981554677u, 2392058451u, 505986865u, 2406249739u, 1387522297u, 1489342155u, 1999087904u, 3027926648u, 3789888785u, 3827816420u, 1179920829u, 2686404176u, 2764112571u),
+    SC(846415655u, 408124728u, 3921200023u, 2781622829u, 477610182u, 367914297u, 3706437664u, 3737002501u, 3269377161u, 1489237515u, 3569856626u, 3564480469u, 3253368907u, 3286577851u, 1925194896u, 161754469u),
+    SC(379692824u, 139829778u, 3228090517u, 3643843184u, 2567363874u, 3889905485u, 1289941907u, 3581051518u, 3549025867u, 3003886059u, 1827144501u, 3421042653u, 2985242646u, 2830583392u, 563525412u, 3507839068u),
+    SC(3032435988u, 1575114097u, 862538630u, 1981181584u, 4004637688u, 1249116905u, 2786784463u, 594048406u, 1239097508u, 3626211301u, 1662542858u, 1801477782u, 936610145u, 2777342939u, 4207082513u, 3151041090u),
+    SC(3572328361u, 3438569054u, 1099566560u, 2375254219u, 4231074835u, 3909785163u, 3208018843u, 193537584u, 2415388028u, 3885631619u, 535341426u, 2454271844u, 122104695u, 1638946298u, 923819288u, 3038638385u),
+    SC(2329040625u, 2671853298u, 246321263u, 203173028u, 1154867164u, 4179022694u, 3006209863u, 4115654413u, 3186551617u, 2368490949u, 2186575717u, 2445898265u, 880250718u, 220590068u, 2497856493u, 2798865831u),
+    SC(2379473658u, 4267030001u, 4046922720u, 441812921u, 3330089710u, 569505327u, 133573141u, 837910414u, 2854474404u, 2104193406u, 1440204470u, 1570522822u, 2402137116u, 3127285259u, 1263270207u, 1606978736u),
+    SC(1157471784u, 713961647u, 2889145089u, 2813389113u, 62994711u, 1431149159u, 2388097629u, 78893302u, 3406270561u, 892541363u, 2707856729u, 693885922u, 412253446u, 3434162446u, 1212206102u, 2434425296u),
+    SC(1562679810u, 1147465061u, 2199726761u, 3378798406u, 767019508u, 3852756087u, 1953176177u, 2293738050u, 738161542u, 1383951196u, 744054656u, 3767225632u, 599494139u, 4069841426u, 3041889044u, 124944848u),
+    SC(3650008152u, 517788957u, 1180570172u, 3633431681u, 3721497428u, 194250954u, 2242660296u, 235993891u, 364893118u, 3547687622u, 4075944422u, 254102683u, 722810647u, 455495809u, 1781318171u, 2025118962u),
+    SC(789758825u, 430091958u, 556929869u, 780473615u, 1859864686u, 2640785077u, 2271741142u, 1155227778u, 3222347485u, 994912452u, 3989988536u, 3693859043u, 545476039u, 3181915600u, 2188456901u, 2139944763u),
+    SC(1301583492u, 1889126904u, 1109210591u, 3956168618u, 1899126836u, 2399658982u, 4029683651u, 340477476u, 2600163927u, 3608373703u, 685453455u, 3098574240u, 3105854797u, 2978147035u, 309010431u, 3719721946u),
+    SC(3474831632u, 1586885064u, 3814765466u, 1965732222u, 264933156u, 3655190706u, 2843117312u, 3803128934u, 3888750438u, 3298592372u, 2797713739u, 1268138009u, 1583635623u, 3016941572u, 181984371u, 4131899999u),
+    SC(3877549093u, 2100296330u, 3080545186u, 1120302469u, 3568399487u, 95584034u, 2850964100u, 1789275013u, 2835787500u, 4177634166u, 2104631109u, 3662930754u, 1002481529u, 2265854915u, 3507446822u, 1781303397u),
+    SC(3168372691u, 187004404u, 1002816481u, 3030555071u, 566594412u, 2726214433u, 2409136811u, 810915975u, 1077413065u, 1127853607u, 732944532u, 3862580916u, 1762401100u, 2458508032u, 1981717306u, 491274085u),
+    SC(3075300599u, 1219457378u, 962407774u, 2322200384u, 2049698746u, 1767260226u, 3936124468u, 2985872048u, 3049651675u, 858520409u, 2204015139u, 1257915715u, 1462296490u, 2110769726u, 2747629035u, 3897144118u),
+    SC(1190387445u, 2553661870u, 444283667u, 2837495465u, 3921416942u, 1664827100u, 1462049650u, 895517565u, 1484467743u, 781105611u, 933914999u, 2265060588u, 2173679388u, 271969994u, 2446671464u, 353166971u),
+    SC(2369001725u, 3946776936u, 3729913047u, 3417703065u, 2769087396u, 420862134u, 1467273143u, 1986516338u, 3471284496u, 379749474u, 2862458816u, 258454727u, 3904101688u, 256582147u, 2634355034u, 2892373432u),
+    SC(2563444489u, 1158703453u, 2023794290u, 3949405498u, 821310075u, 2019883983u, 1386017298u, 2909764624u, 630533548u, 1310412853u, 2605181365u, 1384459551u, 806346357u, 2797425455u, 167597743u, 705344307u),
+    SC(2516868684u, 211842556u, 1246987251u, 4030587141u, 2739698764u, 2955988735u, 3045824737u, 725197775u, 4113021181u, 2451784017u, 3121738319u, 2077614061u, 1857881059u, 2768538734u, 2402112049u, 1912716030u),
+    SC(4066568337u, 1118691064u, 3416418972u, 2910295905u, 3287593957u, 1502652734u, 1882977642u, 2580308016u, 660391780u, 2261281424u, 257523158u, 1888677119u, 1401079735u, 865311905u, 3522371981u, 1863014731u),
+    SC(215456770u, 3994506038u, 1604286720u, 3193027371u, 2910187393u, 1013732916u, 2093422555u, 359471102u, 3052136703u, 3004032445u, 2771542084u, 380353249u, 1341725070u, 3029432650u, 3293577265u, 2491062365u),
+    SC(682934050u, 1528643805u, 3759287811u, 3861938954u, 3652863529u, 3427912146u, 2158110201u, 1224235252u, 611672457u, 2562408781u, 1246973035u, 3808438651u, 2866761724u, 2970511253u, 1319333413u, 754174656u),
+    SC(4028166662u, 2111135219u, 2622698571u, 3323103839u, 3430308918u, 3350249120u, 382223964u, 3337433079u, 3657194162u, 3445726538u, 3328974034u, 622134476u, 3450030710u, 2261083674u, 2517238008u, 3836378726u),
+    SC(1231644879u, 134769922u, 2589840839u, 1330105306u, 2137399025u, 1217083714u, 418220140u, 1112177171u, 3621314456u, 1142972640u, 253207395u, 1469867520u, 906711332u, 661971679u, 3369383815u, 504919271u),
+    SC(606948441u, 3910220663u, 1759806836u, 2472545703u, 3112449372u, 2714794313u, 2300641643u, 586149291u, 1192087511u, 2965947117u, 1671594100u, 2768590651u, 1123354912u, 1795876215u, 665368470u, 2047820465u),
+    SC(3065513164u, 437934547u, 2227482540u, 3320120591u, 1180860604u, 3584759174u, 488699101u, 327542983u, 796431174u, 44447401u, 2611126738u, 847421249u, 968194407u, 196242700u, 2307365051u, 1696715833u),
+    SC(3694175184u, 2127323101u, 951583882u, 4068541003u, 1183861549u, 709644746u, 219892151u, 496077390u, 845416880u, 1884622487u, 1492465304u, 2033624394u, 3070359478u, 2024263951u, 3954512294u, 3247229207u),
+    SC(3791536973u, 878441264u, 2209068584u, 256853164u, 1605511476u, 2541228994u, 201416491u, 1137965752u, 455416997u, 720934828u, 1275649864u, 3460109831u, 3551730476u, 768442234u, 1504271111u, 2001489283u),
+    SC(2834139354u, 3767191010u, 2948483648u, 4000798277u, 2193814803u, 3486982240u, 3172980177u, 1996197128u, 4110114992u, 1950455344u, 4222573395u, 1903897199u, 1556273551u, 489244699u, 2008152563u, 2216122153u),
+    SC(3039623208u, 3726548183u, 3378251838u, 3964719656u, 2390165267u, 2699187263u, 1996117904u, 746349697u, 1666857299u, 4651967u, 2419967785u, 3554915627u, 1139719621u, 927526275u, 1016457975u, 460683535u),
+    SC(1881176494u, 4151155709u, 3434698665u, 1252889596u, 2972286036u, 3593770894u, 1304920722u, 371023491u, 1233371275u, 4074249298u, 3551764994u, 3771129273u, 849623621u, 3300482946u, 3368093250u, 1517828946u),
+    SC(1178129617u, 2392711630u, 4014991563u, 3678632162u, 1054071993u, 1362938272u, 3715362350u, 3193420789u, 1444864050u, 1171009638u, 2525516791u, 1375352510u, 213190464u, 2778013319u, 3480743712u, 3408388368u),
+    SC(4004728503u, 1605152222u, 3579960414u, 3822100537u, 3649980544u, 2432973259u, 3975881433u, 993553404u, 4071767295u, 99343500u, 89709452u, 472980116u, 3923310138u, 3520023284u, 3256623945u, 2800057420u),
+    SC(133351141u, 3201249811u, 3251666416u, 3485371961u, 4144663652u, 1039619934u, 1549174174u, 3308013002u, 2500106688u, 426876334u, 265946148u, 2374311506u, 3483199214u, 2987514010u, 2008957150u, 582404253u),
+    SC(1858561826u, 516280956u, 4158722148u, 3573067798u, 1021970703u, 1788153729u, 2237805315u, 602224199u, 2600716119u, 2533681209u, 3371091920u, 4033070333u, 3500833696u, 1524060756u, 2555057923u, 2926158806u),
+    SC(2566321821u, 839737034u, 32605360u, 932145101u, 3024777338u, 3316821844u, 2582247588u, 1380838014u, 653224765u, 2063824483u, 2543006718u, 90948410u, 3394544605u, 2026447949u, 2045727782u, 4072053250u),
+    SC(3474912325u, 1488465014u, 1568124057u, 2348904649u, 758154856u, 765384623u, 694275845u, 1531437968u, 2345409797u, 4219997895u, 2271402227u, 4121948136u, 4097072088u, 909737251u, 3204314182u, 1233457603u),
+    SC(283121233u, 4020399918u, 4169975233u, 93647736u, 2595629954u, 1510503850u, 935493793u, 2356086760u, 778704353u, 527917877u, 821767387u, 2022353560u, 2198887843u, 132287498u, 2410500158u, 3111624178u),
+    SC(3108909024u, 1104027803u, 1862105047u, 1150824752u, 184092997u, 302750296u, 88242534u, 3913215562u, 150449137u, 272536309u, 1573592542u, 1953362189u, 2825649037u, 662085872u, 487003181u, 3384583235u),
+    SC(3483270402u, 3329337834u, 341648190u, 609061622u, 1836174388u, 3783208140u, 304468659u, 382996820u, 2196682913u, 252417647u, 3150153098u, 947452265u, 2824069819u, 3786804302u, 3779002245u, 221064359u),
+    SC(3661249577u, 2494380945u, 832379115u, 3707025716u, 3750645547u, 3763532854u, 1834195711u, 1272220594u, 687461971u, 3288605816u, 2199703527u, 3200804451u, 1577923309u, 4141567828u, 627481233u, 3520856467u),
+    SC(2877368344u, 729823115u, 3642018300u, 3531808560u, 2694878665u, 3504677968u, 3568969648u, 4058956033u, 95143298u, 659060438u, 1036924522u, 4222736394u, 579263530u, 3691775887u, 337957982u, 40265395u),
+    SC(3931865762u, 3204631205u, 3587589009u, 3231079507u, 4042119527u, 4175402155u, 2199128311u, 3854866298u, 2180940441u, 254937143u, 2900219140u, 129534182u, 622384446u, 2306714796u, 1562950888u, 4282225465u),
+    SC(1348492299u, 2871008637u, 64840075u, 3822726441u, 831187649u, 2113244460u, 2841350076u, 4226224034u, 15010590u, 8083091u, 3303850336u, 3643329902u, 3569973500u, 1814718639u, 3225368957u, 1923482499u),
+    SC(4151070902u, 1836960462u, 4099148248u, 2236578230u, 1362454113u, 277573992u, 833981221u, 3927019997u, 2097503092u, 2954449216u, 3155046035u, 2843674547u, 2734948680u, 1998643078u, 3552385040u, 1844694130u),
+    SC(3729806266u, 3608544380u, 3424872411u, 657346065u, 1093740176u, 735550258u, 4141078873u, 2468744829u, 475308755u, 2620698843u, 233529781u, 3052691507u, 2984560001u, 85015539u, 3555954145u, 3380398050u),
+    SC(2906550687u, 403608683u, 462988082u, 3185675860u, 1132403236u, 155834130u, 452951181u, 4194716061u, 3025721329u, 957326551u, 3527882851u, 2884485219u, 4012968671u, 2091053768u, 2193403198u, 49395028u),
+    SC(654967348u, 1432399723u, 1662044263u, 858753913u, 2207922919u, 1848010476u, 3027010572u, 3278614091u, 2376775755u, 2450881814u, 211874144u, 160987041u, 4018073714u, 467360710u, 2312202777u, 1321131695u),
+    SC(3948859774u, 807913924u, 3363831218u, 2494058487u, 632957787u, 737619248u, 4186125550u, 1751270945u, 973077683u, 2406798449u, 2615726498u, 348527315u, 3746206143u, 3583624110u, 995407084u, 140552514u),
+    SC(3116441074u, 2316015820u, 1648316032u, 1974260841u, 4213138977u, 2807508330u, 2074874716u, 752920029u, 1543146104u, 3559626223u, 847163587u, 1764441001u, 1588922018u, 1311754782u, 958317893u, 1084711544u),
+    SC(4006703171u, 2158748249u, 4268101894u, 1859781640u, 4128183193u, 1011458588u, 2829463820u, 3957803868u, 1842045558u, 3420683153u, 371860543u, 1471139226u, 2361575009u, 1697395274u, 1451056567u, 580966224u),
+    SC(2387283823u, 1599839476u, 1759859274u, 1256153782u, 2355684112u, 1591964866u, 1382350860u, 1403688871u, 3522724014u, 3247243665u, 3074783425u, 1828985078u, 3353714477u, 360451414u, 3796973548u, 3250059082u),
+    SC(2007900605u, 4234516153u, 2928004764u, 2467375901u, 2817758170u, 305715054u, 2429508040u, 3399871422u, 4098377089u, 506619597u, 4100084624u, 3878229327u, 1365853975u, 839315355u, 2433140039u, 4283048401u),
+    SC(490183848u, 1908420340u, 1504230709u, 4110836325u, 2459051315u, 4031789465u, 3782044423u, 3687986287u, 3226799002u, 1921620603u, 1108966654u, 3516253956u, 2788375902u, 395153857u, 223393650u, 1094765264u),
+    SC(1649416179u, 687609518u, 2570482073u, 1593997098u, 1551804193u, 2101854870u, 3417138956u, 1072635084u, 457499219u, 2939887951u, 3988698284u, 1343294966u, 3607457030u, 1635527667u, 1636411213u, 1682245123u),
+    SC(3349478985u, 1809593609u, 988017928u, 3560470504u, 3506543894u, 1946836663u, 2393535160u, 104349997u, 458953384u, 2516283696u, 3900253190u, 1958278965u, 1731236747u, 1733924603u, 2735380292u, 2517625839u),
+    SC(3489265724u, 3908682991u, 1048580140u, 3158885385u, 3059507558u, 3075409199u, 2774696776u, 2990808383u, 1287919864u, 562045054u, 4236536385u, 3983111154u, 2169301767u, 2830968110u, 864957133u, 3813863023u),
+    SC(2214754064u, 1169736341u, 3375935128u, 2850689500u, 802306789u, 2061397752u, 744507169u, 1718617409u, 1922327954u, 3552646148u, 2283509548u, 3953663311u, 4093119949u, 1085365669u, 4117628707u, 2216578969u),
+    SC(4155183920u, 3758930412u, 102380651u, 3639956013u, 1580223054u, 2840560815u, 3049719316u, 221121836u, 1565182033u, 2301954644u, 2941837044u, 1866415465u, 787543715u, 2647977862u, 1806766107u, 3747504452u),
+    SC(2814922265u, 587446136u, 2350533979u, 2020382761u, 3503967708u, 3242158380u, 2018609228u, 1876223512u, 1457729115u, 2411911983u, 567692205u, 904130837u, 1704101171u, 2821314372u, 2476450902u, 3138876670u),
+    SC(3098593412u, 2793462464u, 909886810u, 4201085554u, 3328131385u, 133549516u, 4053391373u, 2895692858u, 1139021962u, 3374712513u, 3446402139u, 2767040581u, 1701443706u, 1650309426u, 3505973022u, 1365999911u),
+    SC(2171520067u, 3495387445u, 1513866044u, 498377081u, 3317627278u, 2486892765u, 2888107138u, 2791181814u, 2309468873u, 3925039245u, 2567925665u, 2531485366u, 89102896u, 303604393u, 3384310856u, 1441837920u),
+    SC(2381127939u, 2185037781u, 872129103u, 2144126076u, 2969671183u, 997294034u, 2939802778u, 2837325984u, 1057221919u, 3189401118u, 4097767927u, 3612601005u, 3823215505u, 711469780u, 4212740716u, 3221296936u),
+    SC(2982458268u, 3899970680u, 3216898531u, 3465294181u, 267712452u, 3202485383u, 1212788394u, 3503695371u, 951028577u, 812652673u, 4223657764u, 1402383817u, 851598212u, 3753659837u, 2773209654u, 3226161118u),
+    SC(2103168571u, 3851763379u, 2709480828u, 4206658057u, 4027694322u, 2115025165u, 242604761u, 4206020977u, 1937823366u, 1600116610u, 2960165691u, 1656987209u, 2253073319u, 1080432252u, 3150896682u, 2969061255u),
+    SC(720703770u, 1110110925u, 350712191u, 3161551300u, 158003576u, 2334299287u, 2773298055u, 1275130501u, 1147715355u, 3997430016u, 2122320744u, 3082007107u, 791954885u, 3366757791u, 1966390958u, 3145146177u),
+    SC(3027118528u, 1841880559u, 4173200229u, 4093918049u, 4261481902u, 2731578717u, 3357178697u, 1669003110u, 1651995797u, 2920689999u, 3620785912u, 614627999u, 1955355803u, 163911237u, 2619263453u, 2642106869u),
+    SC(274171603u, 4098794511u, 1911241685u, 865916180u, 2935412986u, 1495512229u, 144384412u, 4222005738u, 709797850u, 3363119819u, 2106770512u, 2391199929u, 972738596u, 2680344341u, 463472077u, 3074674876u),
+    SC(524029057u, 3196415536u, 412304755u, 2301422370u, 3537033455u, 4035672151u, 1549946696u, 380482111u, 120723088u, 3726920092u, 4113516608u, 2311378868u, 286625106u, 3542561225u, 4205749607u, 2348156715u),
+    SC(383564515u, 2841286138u, 152193103u, 4164139534u, 3828844395u, 4050623647u, 1522484906u, 1183568563u, 1450343431u, 612045526u, 3249398899u, 1013520128u, 820336682u, 3454091316u, 877261377u, 1509925965u),
+    SC(290186604u, 3597810831u, 2454713280u, 4125993926u, 3827504294u, 1240317951u, 477709368u, 3672573734u, 159702386u, 2237456046u, 2086142022u, 3006069370u, 1169562485u, 2487694817u, 3590164581u, 646628641u),
+    SC(2366419686u, 33129586u, 3781811116u, 2136714239u, 1366715194u, 2373247357u, 1954250412u, 3640917423u, 3512286197u, 3118961655u, 634299240u, 753580817u, 4033558187u, 2308838922u, 253719402u, 2159844242u),
+    SC(1531053908u, 411861732u, 3681743778u, 3355743889u, 887338046u, 1212892618u, 2873567221u, 829509043u, 1250504829u, 668463968u, 2060260931u, 1906041160u, 478080348u, 2002356355u, 2348207123u, 2758950303u),
+    SC(2447603229u, 2507546006u, 2374330994u, 2148524213u, 2667693614u, 482625261u, 415348111u, 2295068491u, 3047907811u, 2532868982u, 687028382u, 2577002325u, 3074054336u, 3544050631u, 629220656u, 731301746u),
+    SC(825756547u, 3698845170u, 2620347720u, 180225322u, 23990047u, 47753939u, 1527108252u, 1545225813u, 600616878u, 3431262834u, 1011041090u, 3090795786u, 3022091196u, 446815008u, 276037158u, 1704149053u),
+    SC(2923436428u, 3168092772u, 2420851911u, 3372324179u, 2403284775u, 2697552794u, 1984748160u, 2988367143u, 61177608u, 4293709052u, 3449425532u, 2189269154u, 4291750554u, 1815728640u, 1559946787u, 888060559u),
+    SC(4101150599u, 2884288753u, 614145338u, 3248205861u, 1466214484u, 1920680287u, 1944210568u, 2829681096u, 3809567141u, 1758991144u, 3355015231u, 3725880583u, 3038424597u, 201224605u, 11226782u, 2925908338u),
+    SC(4180607672u, 873761076u, 4144339809u, 2122633382u, 4113382284u, 175995753u, 3461120373u, 2127923274u, 4209868536u, 2188587040u, 2291053872u, 1550707275u, 3402440847u, 263939767u, 116641601u, 2827370624u),
+    SC(2730416298u, 3913012866u, 199806029u, 3522711490u, 2667462690u, 2997935812u, 2664680983u, 2093560675u, 679131593u, 1645375415u, 3761508137u, 2665396382u, 2079471027u, 3018883603u, 3593521631u, 428530205u),
+    SC(1514328013u, 1024987601u, 2578488776u, 154173748u, 3479312866u, 3760806286u, 2308184313u, 3081717540u, 2513334812u, 965909878u, 2968159153u, 2160010690u, 3808510269u, 1627096855u, 772729072u, 1497334819u),
+    SC(489138949u, 1743306521u, 842997450u, 1142378629u, 779520619u, 2705549193u, 1085942676u, 1527665423u, 407083321u, 1231890849u, 1487221438u, 1991264562u, 2721988061u, 3575257863u, 3334684266u, 300003240u),
+    SC(1496053849u, 583031796u, 1262681334u, 3838702589u, 3149889672u, 3072736561u, 2613528852u, 1856717606u, 2227951811u, 2379018479u, 3728295667u, 3123620901u, 984267126u, 2407489566u, 2106965108u, 5013349u),
+    SC(1718815344u, 1524882104u, 3217039178u, 3739933761u, 223211862u, 3493613519u, 500818287u, 9656789u, 3226238148u, 1319229618u, 658215280u, 431615923u, 1854882348u, 1214510872u, 1479497632u, 2005038062u),
+    SC(1023419904u, 1394876588u, 167453805u, 2229568864u, 484870523u, 2543096238u, 130388302u, 3686268547u, 1540829796u, 790025447u, 2076985429u, 1917404451u, 3257006621u, 840717610u, 1394875863u, 2496125326u),
+    SC(222473782u, 727568943u, 3523779895u, 3526241322u, 1963169197u, 1896522176u, 1642938997u, 1134707847u, 2219023872u, 359784938u, 1404879435u, 2702929788u, 3738216009u, 2996907977u, 3265665278u, 3409554855u),
+    SC(935813578u, 1215278077u, 733293u, 3247345780u, 1084100638u, 1541215856u, 3991867987u, 2854565699u, 3845669091u, 17894833u, 2313954330u, 3887254409u, 694590889u, 1544025040u, 1652029031u, 3104615698u),
+    SC(1315385080u, 3148856462u, 3951140663u, 363597164u, 721065857u, 2711041115u, 680127754u, 4088457096u, 2618355931u, 3138836487u, 1182798655u, 3861778091u, 319598777u, 1368619090u, 78630732u, 947994721u),
+    SC(3253900347u, 599816489u, 3922081198u, 1727408457u, 149020434u, 4082809448u, 3985084886u, 2413109228u, 863418056u, 2477612741u, 2568978169u, 1785401605u, 790782662u, 1744848381u, 4232924158u, 3932466805u),
+    SC(1039287838u, 1939659140u, 1926172877u, 4133742161u, 891191917u, 2063454204u, 3782607534u, 3224832998u, 1581841587u, 1054458092u, 898952880u, 135977642u, 3177104805u, 2129326111u, 3387952386u, 3331508998u),
+    SC(3570652456u, 4186673877u, 4106546427u, 2875260293u, 1357980455u, 1533260797u, 1427685875u, 3593110199u, 1682533712u, 2235784678u, 2568651662u, 3649354761u, 626263355u, 1420843566u, 76600014u, 3665648502u),
+    SC(3973593499u, 1252210319u, 444219667u, 1677656999u, 2909030471u, 237129992u, 3018751234u, 302588779u, 772934139u, 2811370537u, 238362209u, 1941974197u, 3324631183u, 80368047u, 821260579u, 1966428691u),
+    SC(3583577061u, 2120879529u, 53687626u, 4214508889u, 1097669232u, 2019351267u, 2352164361u, 3455551266u, 2997013899u, 1945595709u, 276371853u, 876875784u, 663712712u, 2476187342u, 4009515281u, 2074179604u),
+    SC(1972939621u, 495774976u, 2940033400u, 1713209374u, 3044970633u, 679204687u, 2247033898u, 2419542811u, 1486865446u, 2489758207u, 3116420052u, 2955078126u, 2128260743u, 2404172352u, 3054351885u, 1814622287u),
+    SC(4245099543u, 2972527921u, 2233485495u, 1640312859u, 3188231421u, 2565590653u, 2114527951u, 1106679015u, 765219825u, 249969555u, 719284125u, 2528463064u, 3564998516u, 1492093765u, 2523191843u, 3190997859u),
+    SC(1515932048u, 3801122442u, 3520426412u, 2392016882u, 2984580031u, 3418536145u, 1582747137u, 728943118u, 3345502965u, 118854948u, 1410689526u, 1011653757u, 1111655911u, 3895543253u, 3843430808u, 4025219432u),
+    SC(2480860196u, 1020588358u, 1123394581u, 4142559030u, 633929857u, 1597841653u, 2536030294u, 4259836605u, 2298026430u, 3113826838u, 1643610437u, 4114696692u, 1790945369u, 419918701u, 3588775717u, 3207448523u),
+    SC(2451886459u, 2790971751u, 2526086345u, 812176441u, 2627464318u, 1980999170u, 4123627902u, 1189053110u, 879532259u, 734176488u, 3345522260u, 4004578892u, 458658299u, 3478800144u, 1439628239u, 413347685u),
+    SC(2233126033u, 618528668u, 349111627u, 2268363377u, 3486062135u, 1851101577u, 252006723u, 997835662u, 3646537200u, 1490164931u, 1124411368u, 3427392598u, 768740337u, 821092666u, 1439459788u, 504459061u),
+    SC(4285272835u, 3082883525u, 142475759u, 1149408528u, 4025525778u, 2468319762u, 728827743u, 753552790u, 619748287u, 2077184170u, 211958206u, 3106230366u, 2124009727u, 1519752564u, 1399910049u, 2068333046u),
+    SC(4064008688u, 1441250589u, 1128248606u, 3367431350u, 265617743u, 1330424272u, 1783350838u, 1130355392u, 2522002520u, 2636552921u, 1760456722u, 2934207559u, 632983933u, 4045454758u, 2636223726u, 2775415648u),
+    SC(2640456790u, 3933035801u, 2072133216u, 465390320u, 534802681u, 958117220u, 704991866u, 1240756215u, 2153888660u, 224691710u, 3657160023u, 1725644234u, 3326658500u, 771904660u, 3871582492u, 4250689694u),
+    SC(2492788708u, 3488994791u, 1670690428u, 1081842017u, 689287134u, 1452489600u, 923601631u, 788663315u, 2869722680u, 3361661388u, 41510066u, 3728881455u, 4253478072u, 4248767105u, 2230693688u, 1487398122u),
+    SC(2833569722u, 4290532092u, 11062124u, 691576860u, 3760767577u, 2537566824u, 3688980490u, 2502826630u, 148224061u, 230883884u, 83334947u, 3337709346u, 3430870713u, 3378792815u, 3388374057u, 890899437u),
+    SC(2206474084u, 2475574799u, 4025586093u, 1299371941u, 540803503u, 354012657u, 4051450805u, 3834804933u, 257452274u, 3270013513u, 557265815u, 1078025290u, 3971085069u, 2986671681u, 2162171257u, 3948111872u),
+    SC(4001985753u, 1592803210u, 2249051046u, 2069462962u, 2938777078u, 2500520651u, 3592669315u, 33952502u, 1559301492u, 50879959u, 3429454149u, 1067415101u, 1704373242u, 3950834198u, 888014840u, 2767274412u),
+    SC(1760071052u, 593587363u, 2973165050u, 874996365u, 2838355563u, 647092311u, 2999982688u, 3059193350u, 5935248u, 929486571u, 3314310496u, 2607437429u, 3857480563u, 2258730049u, 628412793u, 2700956752u),
+    SC(4264877450u, 3324954806u, 551283321u, 1154271808u, 3488000858u, 3459985020u, 1353472154u, 2502046811u, 2295267413u, 2918310178u, 1398149591u, 3174957223u, 818539989u, 2307728831u, 4037786047u, 1809238208u),
+    SC(1111128732u, 3237483657u, 2863015033u, 3241243496u, 160994150u, 4246257655u, 4138070581u, 2186394655u, 3374756829u, 85533725u, 48723690u, 370224705u, 631040150u, 1194125087u, 3728892349u, 700872942u),
+    SC(2141588473u, 2092913919u, 3860576320u, 3001060753u, 268111540u, 1920732787u, 248836439u, 2903218420u, 3585190623u, 2228455352u, 4259085094u, 2817996454u, 2116644845u, 2037966879u, 1853569801u, 244635443u),
+    SC(2656291598u, 4058898108u, 2012084390u, 1763178773u, 2190770525u, 250579340u, 4058477619u, 1612003942u, 1398332146u, 1627300513u, 3114583793u, 3099508233u, 1233340828u, 4267014050u, 3985604991u, 1186208975u),
+    SC(2918790721u, 3323381367u, 2578729685u, 893596352u, 335835534u, 2395545238u, 837195090u, 987164953u, 3661391535u, 3838817247u, 4116670305u, 1550500906u, 2378265153u, 1523811865u, 3756171579u, 2118320030u),
+    SC(117564396u, 1214100327u, 2959637979u, 736190283u, 1533166276u, 963604236u, 2535910582u, 1196313768u, 278461046u, 333242821u, 44007402u, 812909431u, 1763353551u, 1024708500u, 1865253265u, 758881923u),
+    SC(3640417189u, 3555502597u, 2660924932u, 743591946u, 3574817886u, 102014596u, 2864765200u, 4174184188u, 1920093005u, 250385626u, 1955902681u, 2208489222u, 3751210627u, 3849902368u, 3260641417u, 2068528522u),
+    SC(2076741530u, 2189033399u, 106471814u, 4205469452u, 3372272541u, 1244903644u, 3387861054u, 4285610382u, 3452772831u, 3857547601u, 439192695u, 3767236343u, 1228526495u, 525697456u, 2861916262u, 262228604u),
+    SC(2239288625u, 197631519u, 1847696327u, 2132898467u, 3858469541u, 4022311193u, 256305681u, 1868493029u, 4241601196u, 969040582u, 2498688480u, 1379110812u, 3401764941u, 3977757328u, 1988581837u, 330814800u),
+    SC(2562466519u, 1050830363u, 1415493108u, 937544714u, 3557965856u, 1153142931u, 1558046552u, 2818706018u, 339508702u, 221493851u, 3266088323u, 3427151764u, 638042098u, 2712285913u, 4079883458u, 2183340582u),
+    SC(2144305694u, 2513573741u, 3498578028u, 2780760149u, 2575364709u, 3929817114u, 2896448266u, 3588812304u, 667107758u, 2280108014u, 4172236184u, 3907157163u, 3240603732u, 456695035u, 644794834u, 4265607812u),
+    SC(2307537337u, 3561025285u, 4169013595u, 1781747603u, 1739380346u, 533163176u, 828543722u, 35038705u, 3949211579u, 4264719589u, 802278121u, 1951378426u, 3235610854u, 735377347u, 4230784059u, 416174831u),
+    SC(1055487138u, 2300101142u, 177611904u, 521715610u, 2278991399u, 2201108028u, 3205729268u, 1059164836u, 4122183391u, 2893146933u, 1235049258u, 2517619214u, 266222076u, 282942563u, 3696276827u, 3446017436u),
+    SC(3184594223u, 3732332340u, 2595705838u, 3496743505u, 2540092404u, 800460965u, 2111586102u, 1078444362u, 1346712301u, 888766137u, 3098703460u, 2873360434u, 730548214u, 2621455293u, 1808220976u, 378682860u),
+    SC(739742775u, 964182308u, 1341760672u, 3953128082u, 1199198536u, 3289869091u, 3221266894u, 1005442621u, 2741482884u, 1335589675u, 2821704906u, 3114347148u, 740074999u, 1046675827u, 3816710159u, 254791606u),
+    SC(674165518u, 4074118419u, 1869735647u, 1860796093u, 2821732003u, 758962241u, 908629912u, 3018265984u, 2427505971u, 3276859950u, 1422021220u, 2051000607u, 1531944387u, 525920367u, 3296208348u, 3822122042u),
+    SC(2754301269u, 1118632572u, 3041571797u, 249609917u, 140244714u, 3675492087u, 514034803u, 2308898595u, 400787584u, 4044069159u, 1984711063u, 845876127u, 1674633274u, 265482429u, 2986294474u, 525757367u),
+    SC(2990197860u, 3316649103u, 1264061767u, 1230542169u, 2691681957u, 1978913675u, 436348190u, 4286509070u, 1723537418u, 2125096152u, 1274964503u, 3562534375u, 121201836u, 4287661865u, 1002782890u, 481707599u),
+    SC(155376870u, 2528030819u, 1182912122u, 1081415401u, 2313093788u, 3972493347u, 1092248207u, 1971871399u, 3792223882u, 2294184767u, 1802176206u, 2745891653u, 3292131514u, 3575097220u, 3121870859u, 1887219476u),
+    SC(3097928377u, 1377390272u, 2184766683u, 3877550408u, 602294932u, 3775832289u, 1627678123u, 2285448470u, 4160921393u, 3102076479u, 2007455918u, 876339800u, 885505780u, 3249886663u, 1287011665u, 3416653505u),
+    SC(2741842793u, 2716730871u, 2986193027u, 3932245174u, 4049595076u, 396629721u, 214450114u, 141098016u, 3836467193u, 4265669245u, 1534817873u, 1788860180u, 2865572576u, 1594498832u, 3913492451u, 1995485010u),
+    SC(1319305480u, 1030822630u, 4291610779u, 2641351893u, 1862516072u, 4098919616u, 3958332995u, 143514141u, 2179570042u, 2333890889u, 106253263u, 356607699u, 1090120287u, 3461737603u, 4007105493u, 1554244883u),
+    SC(539133718u, 471632327u, 1685335650u, 3827808018u, 267260303u, 1080694622u, 3459203662u, 721411157u, 2016908894u, 3475417075u, 1116547172u, 1105318042u, 2448097036u, 1590504488u, 3162601318u, 1744450993u),
+    SC(3552604924u, 2387341664u, 1469109289u, 1629511971u, 2512294034u, 4050024524u, 4121802728u, 1618006540u, 1919451746u, 1498183099u, 3142959354u, 2943979976u, 4094877931u, 184359948u, 4122782594u, 3638227738u),
+    SC(692956284u, 3808950908u, 3473837876u, 681792722u, 2483043773u, 3396746669u, 1047393806u, 87092354u, 1201652258u, 2814159458u, 2934441924u, 3127052774u, 3485255555u, 2949947084u, 263828575u, 3481560893u),
+    SC(961989212u, 3231705305u, 3825478285u, 1739749118u, 576579081u, 3928250204u, 1886771628u, 1316171694u, 479616999u, 2820771922u, 2636508684u, 3791479539u, 1905672989u, 2077721346u, 3800539754u, 787128894u),
+    SC(617800598u, 3658763080u, 3879136006u, 2224292213u, 1329662422u, 1837607398u, 2548990655u, 2449161711u, 3145328498u, 615526351u, 3709746332u, 3988443666u, 3934739573u, 535283742u, 1993855193u, 2742166382u),
+    SC(1670201410u, 4050541575u, 4240414233u, 3718000529u, 411379849u, 1041419578u, 3030264731u, 2577574494u, 3503913026u, 1325404324u, 234482571u, 2388492615u, 4128823875u, 1958257883u, 573459122u, 3005955474u),
+    SC(261205339u, 2845405882u, 3140631071u, 3540200989u, 2485136776u, 1667763292u, 3621156904u, 2400028268u, 1622568261u, 2794657626u, 976796495u, 4021497260u, 481646817u, 2966500721u, 3796505813u, 2488450496u),
+    SC(827593597u, 2006722033u, 1341258632u, 2798663435u, 2657809549u, 2296904761u, 3326177906u, 3936787324u, 3946567966u, 2617841546u, 965611818u, 2456045646u, 3247967257u, 2979609363u, 1443707387u, 2452184954u),
+    SC(4169276959u, 3755974600u, 507169596u, 488471141u, 4145069613u, 2493616981u, 119655315u, 1632933271u, 3142613096u, 3252703874u, 1370895801u, 3706883674u, 3312913413u, 3350184611u, 4105487451u, 2106168300u),
+    SC(2215200314u, 1377043621u, 2732108432u, 84818648u, 3965546415u, 2265134000u, 1842673214u, 2203362901u, 3432596779u, 2231970981u, 969677670u, 2209852215u, 462054693u, 647634639u, 2444777406u, 3789241300u),
+    SC(2524980241u, 315846837u, 1839345333u, 896818590u, 826507493u, 1747099145u, 4146335846u, 3916913u, 3719048503u, 2130952705u, 4288692637u, 1704382723u, 668387075u, 331041071u, 4103469382u, 677220152u),
+    SC(2635774700u, 2673284513u, 1551247396u, 1097897246u, 260434047u, 1758090131u, 3556375615u, 2721737160u, 4062111488u, 1356576284u, 596412902u, 692204856u, 1907364071u, 2558950365u, 345690763u, 1059637983u),
+    SC(532244113u, 2377363270u, 3279041718u, 2763015025u, 2558973600u, 1482275378u, 4146545366u, 337607398u, 2344697548u, 545193361u, 4160013378u, 1855603290u, 2709214584u, 541085386u, 2963101058u, 3558830969u),
+    SC(584704868u, 3106360747u, 160156451u, 3762458250u, 1097684208u, 1517818497u, 3995213238u, 2652817336u, 1573007960u, 4181556661u, 3849949589u, 3075380505u, 1278216849u, 687416513u, 3252979294u, 47726717u),
+    SC(1650435152u, 2932900859u, 806774630u, 3582411057u, 2914085056u, 612155384u, 965159291u, 4168344669u, 1913291012u, 1195231492u, 1700290258u, 436356336u, 4222984838u, 1536053527u, 1512175172u, 2272705403u),
+    SC(615297473u, 2607676453u, 3740991938u, 3798473448u, 770362383u, 4061849855u, 33042231u, 2795639935u, 4146713397u, 554598497u, 2324348365u, 3071978465u, 2482309850u, 3752820050u, 2017038813u, 3553254731u),
+    SC(3531958275u, 2845651156u, 4087556323u, 3153582907u, 1819089046u, 3126539167u, 868298796u, 4149917013u, 2521405773u, 1685085063u, 1657375679u, 457291557u, 729893513u, 1048055775u, 1451870682u, 110286591u),
+    SC(2152898149u, 2635688068u, 2975765999u, 2266914776u, 2411014543u, 1002930971u, 1352711320u, 1286995466u, 2257272399u, 2598682280u, 4024324287u, 3315970664u, 192197800u, 1961389542u, 3920512879u, 280213368u),
+    SC(2140248490u, 998375917u, 1562938953u, 1237594743u, 235647766u, 2503941598u, 3496430974u, 2267603331u, 28026483u, 3493273641u, 1416369994u, 980559500u, 4003298881u, 3717717551u, 4240318367u, 441616569u),
+    SC(2100480133u, 149510646u, 1220831052u, 3704402321u, 699684461u, 1682780087u, 1829538150u, 740945084u, 3641611500u, 3037462248u, 3377573816u, 3864818566u, 2271127966u, 838161384u, 1725956930u, 114529944u),
+    SC(4072235456u, 2459036872u, 1466754686u, 3151085313u, 521611263u, 2912859980u, 3213367779u, 756727743u, 3959314505u, 1511942710u, 1187217952u, 2253846072u, 3976915978u, 3557557540u, 24146178u, 824637333u),
+    SC(3651192457u, 2502439569u, 2536335986u, 2305917362u, 1800069911u, 1318626934u, 4149985215u, 2176747374u, 3546998918u, 2695675034u, 3512094103u, 1295975177u, 3909327763u, 3140816274u, 729779322u, 3334447170u),
+    SC(3349373732u, 1793817740u, 2568694439u, 279699292u, 4294088978u, 817079967u, 3190674561u, 2088517130u, 312016343u, 239373613u, 2040029954u, 1800088905u, 45293896u, 3604080120u, 368423104u, 97116703u),
+    SC(1667028896u, 1348785084u, 107296160u, 1304385082u, 1678582884u, 3355314884u, 2198085967u, 3835189894u, 14942821u, 2436790262u, 1181965564u, 2946379568u, 3906334791u, 4079491660u, 3762634279u, 3924012575u),
+    SC(98198095u, 955116069u, 938849842u, 1767589914u, 3970255799u, 560581340u, 3317243408u, 2560550389u, 3555356090u, 2701656832u, 4294635186u, 1134896494u, 1220708386u, 934372613u, 2720061297u, 3396474745u),
+    SC(2857329826u, 2979493356u, 2462185095u, 535082709u, 3456444300u, 695650318u, 4263061583u, 3900525918u, 4087288190u, 2516377851u, 1769400649u, 2508433004u, 575578152u, 2207666574u, 691508188u, 1054143040u),
+    SC(2607093994u, 2583632706u, 581517094u, 1658869073u, 3590941164u, 3957553345u, 1199266870u, 1115555393u, 782177877u, 2253454139u, 1135520221u, 810758137u, 3200120773u, 490870358u, 666323069u, 2408781402u),
+    SC(1822136994u, 3046583823u, 2715816248u, 501006008u, 1699214463u, 4212134233u, 1259945216u, 2929177954u, 2936658204u, 2370597330u, 3193060623u, 2636143578u, 2800193202u, 1732734267u, 371499064u, 1651892861u),
+    SC(2728511616u, 1021089221u, 1583572289u, 208736928u, 3481317062u, 2742968177u, 4113982994u, 3678829758u, 3301922575u, 909701184u, 4293214477u, 1356116341u, 2150510106u, 205664194u, 1944820525u, 1310981129u),
+    SC(104675152u, 3378629846u, 883273488u, 1216967526u, 319826862u, 552781993u, 3397662693u, 2875524135u, 2269205298u, 1957927542u, 1927188700u, 1770472097u, 4061210096u, 1899577248u, 1835466821u, 2385744456u),
+    SC(2366049894u, 3829563989u, 173271291u, 1480970572u, 3167321535u, 431395598u, 525426866u, 1388171338u, 1271499906u, 1328238340u, 3381149849u, 4050898210u, 1221455760u, 3471788978u, 1232971997u, 2571665101u),
+    SC(4059977383u, 777977995u, 3036758933u, 214001039u, 3824407775u, 2067141718u, 391904555u, 1251068093u, 3193962174u, 3850010021u, 3491639338u, 3546842471u, 2711399007u, 4270479282u, 3190589038u, 4126307826u),
+    SC(2150406875u, 3538654878u, 2611419797u, 108379335u, 3021093277u, 1525470773u, 1953931774u, 1934969633u, 1108549670u, 4115123817u, 1726370429u, 923769870u, 3425912009u, 3188738031u, 3074567699u, 1735572574u),
+    SC(2511451840u, 2641161506u, 15771085u, 2881987988u, 2636434852u, 4051216197u, 3340247115u, 345234262u, 3155441281u, 1392721174u, 2894915049u, 2798593037u, 665989917u, 919282653u, 4136634836u, 3064836125u),
+    SC(246338857u, 33115822u, 406530724u, 3782222577u, 2071568494u, 3614119581u, 761562022u, 2800608093u, 1406513782u, 2445642140u, 3719044858u, 987151088u, 3161339772u, 2578218895u, 2628943801u, 1574263219u),
+    SC(2009354213u, 2674869388u, 1928022107u, 1861482483u, 2423089422u, 914090686u, 2893771609u, 2619856752u, 3168227362u, 1816399744u, 751764320u, 1312647992u, 3865222303u, 4207692243u, 2201104107u, 4212196093u),
+    SC(3898847970u, 4027517510u, 3061129218u, 3448990344u, 18571897u, 1410438222u, 4208649723u, 3825861382u, 3049757603u, 1839374103u, 96062207u, 1662946989u, 3270349693u, 1711309656u, 3010453572u, 1730427487u),
+    SC(577723375u, 2480894416u, 3003051482u, 1255813272u, 948153780u, 4091342316u, 656533294u, 4009292177u, 2693924021u, 734968852u, 2315913467u, 3896870424u, 4184213387u, 3613183932u, 3241292750u, 1947666371u),
+    SC(2854367152u, 2350808147u, 2671411891u, 2624522462u, 3275484580u, 2952250478u, 978227254u, 2202431876u, 68224463u, 566951225u, 2182773818u, 2799696177u, 3244637481u, 2422955338u, 3319620657u, 2082223973u),
+    SC(410632909u, 653217491u, 3696369851u, 964367617u, 4182016716u, 305584770u, 597120241u, 3791571306u, 2435669813u, 1978326548u, 2449151497u, 567685186u, 1338411345u, 3413365585u, 1179067831u, 1911608957u),
+    SC(3191465124u, 3891189899u, 4104441797u, 2534230910u, 1844846878u, 3183655798u, 1985473713u, 2895708896u, 3635537137u, 335325111u, 1661393314u, 3033487945u, 850285732u, 1444268185u, 4182557814u, 2116537166u),
+    SC(514273230u, 859278397u, 3492816950u, 2260990120u, 472453860u, 2096383537u, 3556498479u, 1965905798u, 3792651608u, 4263304468u, 3439273498u, 4266683256u, 213312176u, 2155857865u, 2932914312u, 927502446u),
+    SC(91108317u, 1740633469u, 3905304806u, 4079731606u, 755802129u, 3075322434u, 986079994u, 3657656326u, 1077526732u, 375288112u, 154238286u, 1105090495u, 1356304079u, 1041559086u, 4222859583u, 3281253473u),
+    SC(1368921745u, 2784090335u, 481278298u, 1938529854u, 3493252692u, 4043994183u, 205982914u, 3893311405u, 167481415u, 1741630105u, 124183490u, 1855451205u, 3493833692u, 1193211492u, 3541739106u, 3315016289u),
+    SC(4013577861u, 2007340931u, 1795942393u, 1603434902u, 3104684473u, 3168108336u, 384588153u, 2558959037u, 1372578903u, 4280448158u, 2492957382u, 2921285507u, 4206760246u, 1270162643u, 1923890572u, 461135367u),
+    SC(4022751905u, 2352645562u, 2129256625u, 1849451571u, 2040948866u, 87050786u, 1379665421u, 2937676821u, 2321902612u, 3472431859u, 31138968u, 4120408195u, 2412701468u, 2562760009u, 1937000371u, 1425519269u),
+    SC(3453624303u, 4107652652u, 3649053080u, 949518577u, 2329704802u, 3226113502u, 4034097313u, 2286665602u, 2344775676u, 2966019077u, 3617134411u, 1246200162u, 1142421931u, 2234917722u, 240503216u, 1239620972u),
+    SC(1866414469u, 877963795u, 323712727u, 2011094336u, 3563828908u, 3694803519u, 2475190343u, 3110924500u, 2830780828u, 1333567925u, 2927514002u, 3930096452u, 3068339345u, 3848574519u, 3840853449u, 749582977u),
+    SC(3844936111u, 2443967363u, 3934527589u, 3985473615u, 2728616573u, 2232721128u, 102553055u, 3846902756u, 1509101677u, 1637766770u, 3408000749u, 1316169821u, 773007933u, 238997609u, 1183026706u, 2848980887u),
+    SC(2315175734u, 4041088182u, 1164266771u, 3005955243u, 2411272297u, 3272485568u, 1723912099u, 2658293503u, 4181818088u, 1295915629u, 3064697741u, 2650662445u, 1944520923u, 3046071789u, 1186223534u, 132399732u),
+    SC(85200726u, 2444297555u, 3464941171u, 807957663u, 1378227488u, 2828025717u, 834513929u, 582421289u, 2443286059u, 2650980925u, 6419662u, 566283920u, 2903166731u, 4196731645u, 232160626u, 2855125028u),
+    SC(63004976u, 2467338519u, 276160921u, 3979540811u, 91869419u, 2236747017u, 3237547976u, 2099673948u, 3574400223u, 3825470905u, 61472784u, 1989389313u, 3924907722u, 1585450577u, 2784482155u, 2024563907u),
+    SC(4253509902u, 1671758391u, 629901912u, 4028892498u, 2731587922u, 2434604968u, 3188977336u, 2615720649u, 1080934828u, 3434703093u, 1873014325u, 612353643u, 3020883171u, 2890998900u, 1491402404u, 2317062693u),
+    SC(149213662u, 25065715u, 753446233u, 2537239182u, 2566937824u, 1787663175u, 3955704651u, 3584109185u, 3325333310u, 1951180381u, 1951171643u, 1270812042u, 2569777064u, 2352068314u, 1116836865u, 2980227246u),
+    SC(942439375u, 3932341880u, 389770987u, 3126381226u, 4103635204u, 376946678u, 3933444620u, 1819755458u, 26256858u, 2011578947u, 1407156007u, 3759935338u, 1743367644u, 2949461283u, 2096452506u, 1774578557u),
+    SC(4117400398u, 1958234119u, 1402971249u, 3198486421u, 632347337u, 1405050153u, 3900543189u, 4178898191u, 1414977800u, 3663193618u, 985170374u, 1453779492u, 2409570332u, 328292936u, 3305198075u, 3231112075u),
+    SC(2425266171u, 1784567162u, 535793314u, 2976612548u, 989029676u, 1441868292u, 1322244870u, 395729792u, 3199084745u, 3518057712u, 4162333856u, 2126262583u, 3116372116u, 3983237187u, 1445848922u, 2274083534u),
+    SC(2797799192u, 1127449085u, 380773683u, 86586603u, 1068311883u, 2580815480u, 2129848041u, 3200806644u, 1202299526u, 2785890562u, 80816612u, 3761282162u, 2653319042u, 99493620u, 1274609751u, 1648343064u),
+    SC(2492181894u, 1816013862u, 47472995u, 1388191918u, 816206563u, 1244238689u, 74870455u, 2561927427u, 819136034u, 2907146795u, 2579774223u, 152428044u, 1126292042u, 1990298931u, 2511651972u, 3653456228u),
+    SC(3603508125u, 3414824878u, 2004386085u, 410529078u, 2639490780u, 4184681631u, 211715282u, 485925874u, 3717425056u, 2471592823u, 2544938632u, 451697995u, 248940068u, 2395086971u, 2650866863u, 719194553u),
+    SC(4194254203u, 2106266582u, 1187398090u, 1692368943u, 2064130569u, 2807751464u, 1422848253u, 1700162237u, 2891473310u, 521740437u, 4146212898u, 1138233809u, 3106315560u, 2709983688u, 3360577888u, 853470360u),
+    SC(1034821050u, 980476151u, 34187552u, 1115913941u, 2135848575u, 2202866913u, 3276967790u, 2462635488u, 2061649549u, 1856107215u, 3791445933u, 1073645513u, 1551374041u, 3935908654u, 146067541u, 672102783u),
+    SC(654594309u, 1875678076u, 2629828115u, 254455472u, 2415731326u, 230410186u, 3501502493u, 431266103u, 292973140u, 1814363646u, 571291428u, 1713204341u, 3151495669u, 3290983124u, 3498731919u, 536494999u),
+    SC(4191772665u, 1815240942u, 3443736693u, 640662145u, 539280726u, 1687963749u, 3146831454u, 551484706u, 936114173u, 2406749201u, 2158375610u, 2198106891u, 176805194u, 442179034u, 615524028u, 396442669u),
+    SC(82370328u, 4178536425u, 4275619541u, 3060595686u, 4278879931u, 3684237844u, 1219188677u, 3316056607u, 2120874181u, 3438634003u, 1161440027u, 993297468u, 245083645u, 981693086u, 2720612314u, 4070973941u),
+    SC(2351582506u, 1896513458u, 463963011u, 1673946200u, 2872914621u, 1004754977u, 3366303609u, 3539988383u, 3576841341u, 669263235u, 1175917845u, 1908237687u, 4163735441u, 4281979397u, 3399854790u, 911544790u),
+    SC(683144096u, 427072718u, 1875277743u, 2835015470u, 3238953246u, 3568324121u, 1662270703u, 2271562613u, 50622955u, 843426617u, 362268801u, 3877587485u, 3795958321u, 2792947257u, 753752675u, 2220803970u),
+    SC(3410447631u, 4239976236u, 628841163u, 161082510u, 3634324628u, 217362440u, 150394843u, 1505640811u, 4286369998u, 4230560955u, 2327423312u, 2270820438u, 2584631731u, 4026269895u, 3819111706u, 2707825405u),
+    SC(3275647362u, 1572781120u, 643131387u, 3991053477u, 437780532u, 781804533u, 3176641375u, 1079358316u, 587153397u, 2095211982u, 624644193u, 1503309926u, 137104565u, 2443517453u, 3080252460u, 3309747736u),
+    SC(2227159302u, 1154707747u, 1906590120u, 1145350571u, 629016389u, 3016804878u, 3996391480u, 431825463u, 2092848853u, 2071656198u, 3275559935u, 3018070395u, 2950165537u, 516825946u, 3787593851u, 681506545u),
+    SC(163779308u, 3577422926u, 4248891395u, 4158686047u, 1617101450u, 1527023836u, 1935251027u, 4185616698u, 297581839u, 1492940783u, 2236418838u, 25736424u, 1500089253u, 4276363238u, 374622641u, 1320643860u),
+    SC(1543941977u, 2720886573u, 215497716u, 3820736289u, 3564434970u, 3759998003u, 755663580u, 2937442044u, 1198214121u, 4056049149u, 2831603469u, 1818663599u, 1107029937u, 1113467874u, 2420643418u, 1126345448u),
+    SC(2003982790u, 2175003971u, 3032542036u, 2062786235u, 4098821489u, 3360031423u, 762135987u, 4055285199u, 2325559123u, 1417774474u, 4005840977u, 1283671655u, 3597937564u, 4116966330u, 587063687u, 4215011156u),
+    SC(3010486302u, 2921316819u, 350499467u, 1291994334u, 24426692u, 124135484u, 3816950864u, 1093036098u, 2398113913u, 561300400u, 1965726396u, 2375552739u, 3987191210u, 1078110514u, 1041459252u, 3155319488u),
+    SC(1526287040u, 2139972754u, 2758978880u, 1728672262u, 2013816918u, 2954176703u, 2185800846u, 3674105220u, 2320811982u, 1475010129u, 492778223u, 3472225644u, 3020816343u, 2365478485u, 714881382u, 3861753626u),
+    SC(2414068124u, 3806883925u, 945639203u, 3313708855u, 1334096927u, 1066686789u, 2175580391u, 1527088838u, 4179823007u, 3513730243u, 2754694473u, 452039625u, 794697751u, 22476896u, 108328364u, 2440203304u),
+    SC(3581974045u, 641907998u, 1603408307u, 162946741u, 3845247359u, 2742792131u, 3052570876u, 330078833u, 1342965076u, 863931203u, 920980078u, 185793158u, 3647442140u, 1530459728u, 3841497065u, 457278923u),
+    SC(39181549u, 1386194467u, 1239703603u, 2256079922u, 592345447u, 1520194565u, 627899377u, 1117120555u, 2129504708u, 2134776955u, 4231156691u, 4205077271u, 1576773581u, 2499201808u, 210717514u, 2105120789u),
+    SC(1266597799u, 2453685535u, 2877585060u, 2924012895u, 438813496u, 2833089624u, 198960162u, 3968406871u, 3753009385u, 4170266102u, 264905679u, 2910771218u, 3240501975u, 3827847812u, 2355353662u, 2243268741u),
+    SC(2442987392u, 2657129129u, 2746581406u, 208105885u, 823744157u, 1003572349u, 2403857749u, 523222824u, 3389745912u, 1993805612u, 3971690405u, 160260376u, 3255096276u, 2735613181u, 3419075203u, 2218623124u),
+    SC(1181247401u, 3733563716u, 1542288317u, 1524843172u, 2609678699u, 1508818754u, 960353590u, 2356211320u, 710776583u, 3017889827u, 127653578u, 3904367881u, 2629541779u, 1323917353u, 945641080u, 2866823905u),
+    SC(1898401032u, 3363325207u, 2300662383u, 3480298893u, 4235464027u, 3194314556u, 3649424290u, 3252371323u, 3769565488u, 2780697652u, 4174795452u, 1141249915u, 1021127846u, 1790869334u, 226790895u, 4216006112u),
+    SC(2758709320u, 757408797u, 331781057u, 4108715663u, 3068667245u, 531829023u, 2695761463u, 2126392269u, 1969713164u, 4062882665u, 2166810540u, 2518099629u, 4258728127u, 3584971025u, 1090068926u, 2487701210u),
+    SC(4149808017u, 4064481574u, 2240232207u, 2008967249u, 283808139u, 2725067611u, 2931829754u, 2783464125u, 1209551096u, 1498191056u, 3384137420u, 2240662472u, 757404301u, 1587711534u, 3738776996u, 1651542425u),
+    SC(763013349u, 310567386u, 3671301476u, 965674896u, 1335258847u, 2952127420u, 2585980382u, 1116483295u, 313660220u, 1107501209u, 3946048036u, 4051001245u, 2735426977u, 1888280501u, 1983231514u, 861773177u),
+    SC(2435923776u, 855819391u, 3656455077u, 1478431580u, 2183661863u, 1600488967u, 2572488617u, 1916195043u, 4172737543u, 1584923839u, 1176350441u, 522266715u, 2862520002u, 772603687u, 3273913895u, 2424539767u),
+    SC(3659825433u, 164857255u, 2221467758u, 454324157u, 3770549020u, 974770398u, 793027029u, 1818706891u, 3229387131u, 1601631982u, 4073071889u, 431193159u, 97786038u, 489478758u, 1832513383u, 1077185727u),
+    SC(2514709028u, 186368739u, 4217266306u, 3734950962u, 1980679161u, 1862392790u, 780272232u, 3722977824u, 3194589399u, 985418298u, 2399384073u, 3702792235u, 1386695303u, 505298177u, 1986390481u, 484559715u),
+    SC(2332405856u, 985494960u, 3312749028u, 1375212001u, 2951039623u, 352607455u, 1216885567u, 1052536459u, 487651457u, 1171996923u, 2292067804u, 3894139516u, 670414357u, 2899711901u, 3140547838u, 2134965049u),
+    SC(4289448507u, 1984574074u, 1963703083u, 2714469161u, 3560882359u, 3705206568u, 1437192972u, 4076998484u, 2476149349u, 3372982880u, 1529852819u, 2766771380u, 3348207196u, 3054113538u, 3478672451u, 1842409562u),
+    SC(3014154991u, 4013286569u, 2400126458u, 2538772874u, 3545319528u, 2972968896u, 2710548563u, 193358962u, 806444769u, 3256769438u, 64402284u, 1424425192u, 166623431u, 3901368146u, 955542815u, 1533019618u),
+    SC(2767322463u, 1277377778u, 194795097u, 258370897u, 1534655538u, 3955970773u, 3512018188u, 3378215605u, 2446434181u, 1919554136u, 1145313790u, 206707143u, 863322917u, 2312711506u, 3278099996u, 2180686042u),
+    SC(2545437515u, 2075053843u, 2495559971u, 727234029u, 2662417975u, 3533388952u, 3200509476u, 22788874u, 1232975023u, 3197008698u, 323566963u, 3398612150u, 1588363056u, 3631070196u, 2340877461u, 756425781u),
+    SC(753639641u, 540948070u, 1978109590u, 1370862971u, 2849922946u, 1019762330u, 472337689u, 2489520819u, 3569548934u, 4030910430u, 1106290826u, 1836564872u, 3078643126u, 3333112842u, 1217033667u, 2396173367u),
+    SC(2878019888u, 1826466978u, 2347072376u, 3028511128u, 2435027403u, 3332644368u, 3910895266u, 1059811337u, 4256934876u, 2046534062u, 2642703009u, 2053407238u, 2059327057u, 914958851u, 890406480u, 927036111u),
+    SC(41300009u, 535904433u, 1475003061u, 2570646123u, 3242815581u, 178445005u, 1806750469u, 437629844u, 3266753322u, 953989602u, 4100196408u, 3308215456u, 1429574777u, 2263668853u, 2836726956u, 1228361446u),
+    SC(584183229u, 482431308u, 2140264339u, 1050530084u, 2658156496u, 2355490190u, 1825021621u, 3405543621u, 1951655918u, 2772100929u, 318918602u, 545929238u, 2839102145u, 595132282u, 98981496u, 3232259838u),
+    SC(1893231040u, 3312623252u, 655336793u, 198918072u, 3054789927u, 1590614908u, 3370633661u, 2902450722u, 1274850610u, 2363985844u, 1635495624u, 1220723624u, 4174648436u, 2618496599u, 291359672u, 4142674117u),
+    SC(2723890654u, 3666696066u, 1693846988u, 3667377448u, 3985652160u, 1807206781u, 3567406776u, 2031818311u, 2413316483u, 4247443798u, 842491221u, 1279501924u, 4077318430u, 788728957u, 4263274712u, 2856573839u),
+    SC(2185219436u, 2602793997u, 1520665398u, 1731659375u, 1048050196u, 3111495119u, 969575028u, 990913720u, 3868304461u, 698675933u, 3919326115u, 3144500037u, 3510845003u, 3519438194u, 428807861u, 1143266784u),
+    SC(60447331u, 2185539318u, 1126896199u, 3549745925u, 3998829522u, 1859273530u, 982959310u, 1511361804u, 343731513u, 3716908180u, 3581932414u, 2722935048u, 3997933379u, 1355110093u, 853510951u, 1651146787u),
+    SC(2409622453u, 3093017308u, 122335099u, 2175956886u, 706279099u, 1215952376u, 3734284886u, 3005244551u, 1222306774u, 3558300160u, 238541790u, 3266673469u, 3698619634u, 2875853116u, 849898187u, 4128293538u),
+    SC(4229364500u, 793774166u, 1158223242u, 1600867893u, 1778965331u, 921293816u, 83337277u, 2437150220u, 2392008434u, 2114107194u, 284470693u, 2646106087u, 1076320334u, 1798483631u, 1488779268u, 3693050422u),
+    SC(2108726951u, 390360942u, 2434128112u, 2558442115u, 3941379585u, 4095745400u, 2385060998u, 2244321921u, 3024526574u, 1114457437u, 4147557037u, 3241136510u, 2046632295u, 3316054116u, 657711911u, 3256185899u),
+    SC(3562871797u, 683339548u, 1051029466u, 2985874374u, 1039649525u, 3354177720u, 1448066196u, 2765727102u, 2447534468u, 1686310537u, 483532093u, 2175627264u, 2903278801u, 1007002001u, 3248583393u, 380554433u),
+    SC(1068436341u, 460293592u, 1426759674u, 2812439473u, 1783471257u, 2929158026u, 3560577681u, 1978677505u, 2321352234u, 2766421238u, 1554686879u, 1669738780u, 3195493652u, 999134056u, 3042296886u, 407122575u),
+    SC(1415613630u, 2382931058u, 2043436601u, 3328057024u, 519035811u, 991064327u, 1227272300u, 1995428129u, 175543740u, 1088354334u, 1223450513u, 3432578091u, 2614896502u, 1909480189u, 3413679648u, 3309367352u),
+    SC(1436159369u, 84802772u, 911108437u, 599091570u, 3902931418u, 1310289222u, 1692227597u, 2425889772u, 2079908269u, 3595733904u, 3470495068u, 142563667u, 1447158571u, 111585204u, 3295576146u, 3906761155u),
+    SC(376342616u, 3051534834u, 2976156724u, 1105591336u, 3140509353u, 184973763u, 446262164u, 2901698472u, 2627416173u, 4286774082u, 2899879609u, 277846420u, 3692788791u, 3708591402u, 4131521955u, 2464529842u),
+    SC(1088593548u, 3866002362u, 2840511996u, 988035310u, 3844624276u, 3320833448u, 3558713144u, 956176705u, 2087843612u, 3223222376u, 485577954u, 1940012299u, 2226022479u, 2967931331u, 2505148493u, 967619292u),
+    SC(1747568889u, 3949305062u, 2139618422u, 1180808192u, 1793821501u, 3211215880u, 444875648u, 1926557310u, 490033930u, 2201148421u, 1424500002u, 1587540747u, 1715993779u, 810539272u, 3931138373u, 3391263035u),
+    SC(1245700186u, 841916371u, 2470001427u, 1848308279u, 3797558592u, 1120996986u, 3685965121u, 325419414u, 2241479160u, 3562174017u, 2839298265u, 4010455413u, 2027674693u, 2128522913u, 4047962508u, 2030131020u),
+    SC(3730315209u, 2792745774u, 3243670229u, 2789637314u, 2661146306u, 24638338u, 631628033u, 2594459540u, 1079045072u, 1410543900u, 3742885413u, 1833693442u, 1907645975u, 1284492021u, 3962984058u, 3438748580u),
+    SC(4259484229u, 1325921297u, 180220322u, 1866305336u, 3668425139u, 458358394u, 358458859u, 1449304328u, 4070893267u, 2067392809u, 3438495651u, 2892788127u, 4036826966u, 3825678110u, 3649961416u, 3072819338u),
+    SC(4069342459u, 1857653665u, 1996247917u, 1786194017u, 2962322453u, 3498844904u, 2755301613u, 4025754678u, 1158200875u, 3005752589u, 3762543746u, 3632876196u, 426901132u, 1122421601u, 3922732853u, 309973439u),
+    SC(3345308720u, 1293727159u, 3499698939u, 295333367u, 2075546774u, 1108310215u, 18331985u, 2132206574u, 2306958018u, 3451334876u, 1268280092u, 2967370177u, 2739450046u, 1371080461u, 776109613u, 3877502461u),
+    SC(3850213319u, 799272550u, 1909881142u, 3949130968u, 1409268340u, 4061498637u, 2061757600u, 129282375u, 2984444204u, 2748918133u, 2443935929u, 2791885331u, 517219936u, 1203980632u, 3229381135u, 3791572324u),
+    SC(3940189762u, 357574079u, 3227799442u, 4261498059u, 1825821563u, 1986554436u, 3167615169u, 3794471937u, 2298699133u, 1909922736u, 293353413u, 1410302629u, 118827692u, 2944007825u, 112121810u, 165670637u),
+    SC(1047930494u, 1058480536u, 2677898894u, 18850815u, 1658583289u, 2001747495u, 1432874116u, 3859615269u, 2709739408u, 2519844571u, 2756902942u, 3353581370u, 1097829319u, 3808299121u, 2195235382u, 1846632630u),
+    SC(2703071192u, 2619748149u, 36150889u, 761708158u, 98464309u, 417756428u, 1769132624u, 2443435888u, 3515742371u, 3715084310u, 3744352510u, 2877854053u, 1148620151u, 3913845617u, 4247897819u, 3576326621u),
+    SC(2976792437u, 3472801902u, 3990178808u, 3672624169u, 2779468296u, 4250457991u, 2452570657u, 4126279249u, 1476132532u, 1517171437u, 1962678665u, 378574993u, 36941456u, 3308894237u, 2807592474u, 2798709549u),
+    SC(937328650u, 1064561262u, 2662687938u, 4210116516u, 2205366707u, 1151548831u, 3199358852u, 3343263922u, 1496552025u, 2644858883u, 26654693u, 899066583u, 3812608364u, 4197114016u, 792849427u, 3861200976u),
+    SC(1869103405u, 1706273711u, 1875605533u, 2339269546u, 1256554416u, 2468717041u, 2616116280u, 3419832405u, 2286933405u, 1080127932u, 11735106u, 35306333u, 668734515u, 4014583560u, 3959625027u, 797785036u),
+    SC(2437388958u, 1808130657u, 617549026u, 3039758095u, 2551127962u, 4127967865u, 1462305494u, 3413001062u, 587527946u, 584991797u, 2583036509u, 1259585063u, 1200825636u, 18019914u, 4019412250u, 2620347016u),
+    SC(2342957279u, 917276424u, 2350808094u, 1098374345u, 1288612807u, 1248622337u, 2203632020u, 1293532554u, 3916132878u, 3923056098u, 2452274826u, 393922389u, 2560491291u, 2023392698u, 2904029273u, 1655414484u),
+    SC(2870288789u, 2266972108u, 1492490892u, 2740262128u, 4045113961u, 1424288926u, 4104833915u, 701851596u, 3252530504u, 1648278945u, 1116314321u, 1979224049u, 2522792394u, 1696285084u, 1015980087u, 254181300u),
+    SC(2125610824u, 1589193680u, 470705224u, 3785022498u, 1822710854u, 3570779990u, 3847409277u, 1427505349u, 2503908114u, 1115207993u, 129228295u, 1675824213u, 2734747543u, 2824368936u, 3017549745u, 2814737093u),
+    SC(2990492715u, 2763157517u, 3344042642u, 629736593u, 3760271287u, 250289930u, 794970373u, 1310846487u, 2743822194u, 2660610991u, 751293861u, 3238233794u, 2318149758u, 1665792017u, 1165680861u, 2337899824u),
+    SC(2245191459u, 947803574u, 2730598443u, 2530192740u, 1738981678u, 3075744937u, 168864631u, 661242532u, 1920646572u, 574134447u, 28342267u, 2101875764u, 3738403023u, 564212176u, 3682881872u, 3370439427u),
+    SC(666988894u, 148612300u, 1094204761u, 3865704042u, 1420716289u, 2292683966u, 2681789036u, 2601068349u, 661113428u, 812543138u, 890755204u, 511652083u, 3782091461u, 3475750813u, 2576178388u, 3048317542u),
+    SC(3876293843u, 2140823182u, 2651606965u, 1871029931u, 1120878658u, 1082144015u, 1147522955u, 157216137u, 775785560u, 2490928411u, 2536827196u, 122719405u, 4205633286u, 832066814u, 1589948670u, 1795994394u),
+    SC(3795702869u, 604341142u, 2563250745u, 4092622510u, 2475895905u, 3504862814u, 3804365116u, 3723056825u, 1817430992u, 13470392u, 3210538885u, 2829716324u, 1387626105u, 3411226971u, 500020875u, 2026862537u),
+    SC(1586642817u, 3435436051u, 295739180u, 1197964475u, 2595162162u, 281445303u, 3617616793u, 1301388447u, 1615687954u, 3863784710u, 4262356136u, 2943374590u, 1884907132u, 4216412663u, 1938528244u, 942696563u),
+    SC(601485907u, 446669432u, 3760943575u, 289398379u, 327214403u, 1664255653u, 1610840759u, 1880368391u, 1440514631u, 3068879129u, 2800699894u, 3142485475u, 178246145u, 1332307300u, 1121138475u, 4265912748u),
+    SC(4004655253u, 2904904175u, 366719617u, 1593234002u, 2288810479u, 315044234u, 84893065u, 3611004708u, 3517389716u, 3112242408u, 3943446678u, 1048378256u, 1453854594u, 2637713068u, 1742308763u, 297410011u),
+    SC(1688657531u, 1472067554u, 1421798995u, 1862199963u, 2308604982u, 3827426240u, 3886180395u, 1421328923u, 1680315246u, 775180234u, 205532717u, 688061551u, 404410768u, 3824211255u, 3477129583u, 666137947u),
+    SC(2655418062u, 3614289727u, 471510366u, 1374093496u, 2181561669u, 1022133357u, 2006909634u, 3425108083u, 1451607937u, 494276781u, 73748505u, 1569358923u, 1878805196u, 3947203640u, 3654766411u, 3420233282u),
+    SC(2515407400u, 2153868193u, 1994452515u, 339905659u, 495175221u, 1858618341u, 3509891929u, 2372162675u, 2078493796u, 1100041223u, 1476924024u, 2602912881u, 1235619091u, 208593827u, 2098389662u, 2747220052u),
+    SC(3846176495u, 3642786210u, 4179490054u, 1683213279u, 3501263002u, 207195561u, 2499693571u, 4234483373u, 1443824321u, 1247808770u, 2733050664u, 1365533071u, 1573722983u, 2886146345u, 3972126865u, 3838155823u),
+    SC(2620598084u, 2088061068u, 1511322029u, 4198340980u, 2429872912u, 1672460931u, 4210869226u, 103447400u, 2630310395u, 162004027u, 1292892114u, 617663572u, 3402610575u, 1435560842u, 3599349486u, 427367523u),
+    SC(3894859008u, 792925695u, 2011898544u, 3367452994u, 4057006974u, 2179188110u, 1319343152u, 2537372741u, 977694296u, 2197385716u, 985215341u, 4236071844u, 3903526624u, 719802437u, 1569528217u, 3163252190u),
+    SC(3470057230u, 2945693124u, 2379159916u, 1855657660u, 3711477883u, 1071019282u, 3548885896u, 291378119u, 4261979707u, 3709115850u, 3035810096u, 2580353505u, 2356494961u, 3470612862u, 2432983750u, 3599463628u),
+    SC(2958486823u, 2297057503u, 723648898u, 3745051983u, 2154161005u, 3760294695u, 4002173974u, 3682513725u, 2536735605u, 3472119801u, 3957602984u, 686399977u, 2370915743u, 4231006827u, 169509851u, 3671024649u),
+    SC(56487028u, 50264394u, 2145782630u, 1933702819u, 3953144000u, 1080152406u, 480174728u, 1534603487u, 39424289u, 969412861u, 3891277798u, 3949892129u, 1052294766u, 1301218396u, 2879516760u, 2023461694u),
+    SC(66206920u, 1999839551u, 3537984697u, 2485843023u, 3617070743u, 935702303u, 135978491u, 843973131u, 619236544u, 3560754659u, 1312367701u, 3705585920u, 2147224673u, 996116058u, 3366961233u, 1970179971u),
+    SC(2611571830u, 3229637866u, 3622632003u, 3684751471u, 3360103884u, 2345573313u, 3764729839u, 733658075u, 3248735283u, 472571981u, 3190787642u, 2404321201u, 1647155232u, 1618928558u, 244562999u, 4181974771u),
+    SC(2210482074u, 826758037u, 2370896790u, 1575799246u, 490819393u, 1628318405u, 3270019031u, 3513399317u, 2228539416u, 324324678u, 3857947583u, 4194302906u, 3240350832u, 3497797932u, 2131253056u, 681270138u),
+    SC(3134153338u, 766582152u, 1994813770u, 42302904u, 2832662797u, 2067045041u, 4239780807u, 4024476461u, 2726812685u, 2756461710u, 1756854199u, 917299722u, 347334022u, 3132616542u, 3581600515u, 3905433897u),
+    SC(1929788501u, 806526841u, 281006803u, 2685694311u, 1286113489u, 3595379924u, 1637637375u, 662105047u, 3581493721u, 1154283720u, 799736674u, 2974385861u, 2641465452u, 3531965674u, 915164082u, 739611785u),
+    SC(82740786u, 3746934037u, 314199267u, 1306214462u, 2750749202u, 3561332753u, 1292410891u, 995976759u, 3265229209u, 3694143322u, 973013411u, 426917145u, 2439543041u, 2518089089u, 2293132357u, 2461091872u),
+    SC(4232504941u, 1757139999u, 2561772054u, 2722036426u, 2404599279u, 3043457132u, 3443699687u, 3622301480u, 2336400095u, 2885190813u, 1406858122u, 1246505145u, 2686681649u, 3968821717u, 225453845u, 2789458314u),
+    SC(2803552688u, 361593208u, 133090910u, 708380593u, 1067150232u, 2935781731u, 2325603864u, 3014122515u, 1876420717u, 2841035876u, 3845695588u, 1102690258u, 3439090756u, 3892995818u, 1131800225u, 4010327952u),
+    SC(1612809715u, 1618323071u, 3619395927u, 1623633753u, 1638384979u, 3575480973u, 248739688u, 4052093498u, 2429752027u, 1886094174u, 1685717628u, 3886587193u, 36068564u, 3713198082u, 375141053u, 1292940007u),
+    SC(3675245187u, 1987219857u, 3118045037u, 937190083u, 917783423u, 2486634165u, 2565322719u, 1618638794u, 601808238u, 2394586815u, 3771330739u, 706216698u, 2020186728u, 2572189145u, 3304358941u, 2196751005u),
+    SC(1763293281u, 1502433033u, 706058505u, 4294499970u, 595397356u, 54122628u, 1981346391u, 2762295609u, 2879357694u, 530922147u, 3093038980u, 1503977873u, 664904212u, 959201266u, 4091661275u, 1865726220u),
+    SC(4104639209u, 4059372455u, 3285125725u, 1565761550u, 2273231128u, 4158889529u, 698284846u, 2155134297u, 2667907328u, 1789308130u, 3662570368u, 3419306371u, 211544733u, 2574523360u, 4011319696u, 744215127u),
+    SC(2321379856u, 3572620819u, 277982755u, 805289366u, 958869886u, 1410954838u, 912993845u, 3443867043u, 2600438299u, 1534188046u, 2790623749u, 2838522587u, 1286475780u, 3845302936u, 2882344516u, 2958559828u),
+    SC(2582324188u, 3826086233u, 2963292267u, 3926177914u, 747738562u, 721254899u, 4181197198u, 3102240534u, 787618104u, 2792291820u, 2146880986u, 2812267199u, 2985394142u, 2659244855u, 2192866625u, 1693253478u),
+    SC(1005678212u, 445072408u, 2894007563u, 2596005761u, 1629147364u, 2060183812u, 2845550170u, 3033756786u, 490519028u, 3784608946u, 4236820721u, 2457289596u, 2098280626u, 2330936149u, 531845409u, 2749830317u),
+    SC(2750383103u, 434846030u, 193446195u, 909675142u, 1444417998u, 1414105434u, 4099538511u, 3891273534u, 425057593u, 2346495179u, 3452427700u, 1897728225u, 2640870605u, 3543508129u, 73208740u, 2172177323u),
+    SC(646016849u, 3667611265u, 1054605900u, 574478004u, 1513377041u, 4121814354u, 104788350u, 1890693008u, 1176997405u, 493578147u, 1462241639u, 1711597719u, 1700862847u, 3150773552u, 570456672u, 692759510u),
+    SC(1578521536u, 3594580296u, 3971683574u, 2543061775u, 491248841u, 1223119450u, 2426307652u, 2950604835u, 2609611245u, 3888874320u, 3975868194u, 2461910312u, 2387188937u, 1877924998u, 3443903695u, 1286640327u),
+    SC(467177029u, 185415316u, 1446284323u, 307958454u, 3077725551u, 2916878578u, 1207868861u, 3894992542u, 405354979u, 764141018u, 1467854460u, 2715025764u, 2674896744u, 1770033122u, 160283183u, 3098107312u),
+    SC(1258552838u, 987516480u, 828273999u, 3199956994u, 3087709974u, 3558875069u, 833694815u, 3652664322u, 2825179304u, 3804620057u, 13554999u, 3762264291u, 2774678577u, 3930735374u, 1944637268u, 478214918u),
+    SC(237020437u, 125931315u, 517548017u, 1011282869u, 558269967u, 3498436236u, 1485107688u, 1171480417u, 2713788418u, 444192453u, 2313447108u, 1070894950u, 2837768608u, 2748452272u, 1212708326u, 2528965416u),
+    SC(3822131790u, 1956766157u, 2346864007u, 1216733675u, 1252970145u, 3355622003u, 767108551u, 4162729918u, 2401157150u, 169799711u, 1669359495u, 3095600459u, 36375196u, 2068102271u, 1943184310u, 2249606645u),
+    SC(2317562389u, 1476267454u, 3907595096u, 1193914723u, 3664902706u, 255854103u, 3521290369u, 1043855077u, 2942191386u, 3146544389u, 2929847668u, 3178731723u, 645774633u, 1640193886u, 2475200598u, 2932664656u),
+    SC(1002179116u, 3024045699u, 353399008u, 117529814u, 2575207930u, 2573753534u, 2583275373u, 1750192653u, 2585656206u, 2784054336u, 3113651848u, 3053990161u, 4245948483u, 2532999800u, 3138270491u, 2092235133u),
+    SC(2349127553u, 137200555u, 3905265068u, 2483532985u, 1698172728u, 960696708u, 2166231868u, 2434604523u, 1299506323u, 4256310038u, 4243723072u, 2281936180u, 3231965336u, 1905839787u, 1248142859u, 1275739572u),
+    SC(1182616846u, 1915825374u, 3742017476u, 1658861124u, 517601557u, 3387418824u, 1467000022u, 3600820511u, 2212184233u, 3619853642u, 818291933u, 4045231706u, 4044874304u, 406487548u, 223205917u, 1889652274u),
+    SC(3056558285u, 2387976449u, 2869297542u, 2484911442u, 3463687725u, 3785015701u, 3579791756u, 1168366732u, 1507477680u, 2087527778u, 4004572425u, 361550347u, 1246824632u, 4227267823u, 1116521217u, 3004493633u),
+    SC(1801282064u, 4186631777u, 3744913393u, 2504454121u, 376342732u, 105456003u, 933089717u, 3416156191u, 3690665800u, 1506314859u, 1925754826u, 2197833154u, 2087577722u, 3295815911u, 2133093999u, 1770655094u),
+    SC(2289323268u, 3905389611u, 1758645406u, 4119427020u, 1418160347u, 1221837446u, 77516042u, 573574295u, 2220309157u, 514049310u, 1510673986u, 1551667382u, 345844115u, 2433244096u, 960452770u, 2411316108u),
+    SC(4260546596u, 1089645656u, 430990705u, 560650552u, 3491859365u, 3192733003u, 2913472050u, 3274586056u, 3266036917u, 2660638715u, 3834408736u, 1482698237u, 2440168218u, 1946577077u, 1484182954u, 1565757300u),
+    SC(1294983012u, 526026811u, 841118653u, 611668997u, 353864928u, 2605508777u, 912558423u, 4017583449u, 582622465u, 554431260u, 1679931547u, 2603751342u, 2994962177u, 3276057082u, 3201348485u, 1252268817u),
+    SC(3967597729u, 3879976927u, 2175745966u, 2781235855u, 1515510988u, 721199721u, 2621838738u, 886949427u, 2669231529u, 3933642832u, 2069007365u, 3852534023u, 3696387044u, 2566712873u, 1599570286u, 1319831831u),
+    SC(4281311507u, 1998166200u, 3087132537u, 63668300u, 3667711711u, 2637633859u, 3355098048u, 1152667615u, 2518755314u, 449148528u, 3348993645u, 3100471050u, 720136228u, 36482132u, 594832331u, 771098940u),
+    SC(1830502507u, 771424978u, 887890366u, 3291928239u, 1339300041u, 703690222u, 1685448570u, 145061248u, 3096729192u, 2646249007u, 2399572950u, 3555177986u, 4049072101u, 951709447u, 3000934973u, 3169359339u),
+    SC(1253809659u, 1151205582u, 1179084583u, 14445462u, 51888119u, 1958878709u, 2277438777u, 1682798947u, 1619456695u, 3222718107u, 718800774u, 2309954712u, 1299037096u, 1967511780u, 2620151997u, 4167984135u),
+    SC(3675017676u, 1665810582u, 927665033u, 1434756042u, 800308900u, 4245611062u, 529380922u, 1695534822u, 2126560555u, 2929831448u, 1272016851u, 2544952909u, 1562912127u, 2239980678u, 914350908u, 3317098144u),
+    SC(2926538172u, 3496364313u, 2791178989u, 1684924164u, 1771479938u, 564825716u, 1230295596u, 939373191u, 2884046510u, 4172182532u, 294851449u, 435753006u, 3317412597u, 4127128859u, 3077551777u, 3287478785u),
+    SC(2929978263u, 3409059632u, 3171381673u, 402429808u, 4094138978u, 4207222746u, 1675442888u, 3546243623u, 3064280086u, 965023173u, 3910350596u, 2726813663u, 2273396129u, 1142338853u, 116502086u, 1790917046u),
+    SC(2429155535u, 1897746654u, 2180457294u, 4139858680u, 959798278u, 1049173485u, 85707292u, 2233611198u, 148461432u, 418485833u, 4073968722u, 2167768963u, 399688494u, 2852214046u, 3623756232u, 874627061u),
+    SC(1524100325u, 2870805316u, 1428741342u, 884248318u, 4254419627u, 2449629410u, 345369996u, 2262398688u, 770840123u, 742155179u, 3203560681u, 1011267296u, 1655477316u, 2977448920u, 1879132931u, 4152715696u),
+    SC(3065654828u, 2392076016u, 384226286u, 329977004u, 494972541u, 1485472540u, 3078901390u, 1003654554u, 1092094517u, 4179877855u, 1343974150u, 2099515744u, 2733372499u, 3490402333u, 139845047u, 468680628u),
+    SC(2118163401u, 3147983997u, 4206744656u, 3162790044u, 2039829929u, 3330317508u, 329565812u, 2146825085u, 206670177u, 2630201314u, 3827057248u, 1209896927u, 1617342516u, 436077324u, 3827556071u, 2043274929u),
+    SC(2491862292u, 1890775790u, 684724320u, 1820085282u, 745694058u, 2768987360u, 805851502u, 3729743916u, 2288831372u, 4233822319u, 3750958981u, 4147263102u, 3227707811u, 1240748750u, 2865739595u, 3736364975u),
+    SC(3888192891u, 3367006725u, 505083608u, 1952161886u, 2494688924u, 1417861179u, 452586891u, 557026602u, 4257534611u, 2190256926u, 4237320874u, 422524329u, 1792305213u, 2038419321u, 3343405790u, 3613167184u),
+    SC(234775163u, 4281425072u, 454780850u, 2003692853u, 431073373u, 2390762007u, 3380609264u, 2480212941u, 2570868203u, 3143960699u, 1876763776u, 3386281579u, 3926878673u, 3110009896u, 1597155566u, 1442441075u),
+    SC(2700135447u, 4244677323u, 1606928769u, 2249130739u, 3945906797u, 1417944542u, 413052005u, 2756113686u, 3215886412u, 836078139u, 4044388263u, 3555578750u, 347858154u, 3174103668u, 4284229982u, 1262193001u),
+    SC(3252401852u, 3155437678u, 3605985574u, 3376854315u, 3548282707u, 2449350105u, 3715855034u, 2749592376u, 1739599239u, 3174262914u, 4105633224u, 440043735u, 2858297141u, 329128912u, 3885229734u, 316636144u),
+    SC(548996699u, 3352597956u, 3375149552u, 1861088751u, 117593361u, 271859435u, 3894740412u, 3142314930u, 2795008790u, 1545805202u, 3173098745u, 100811481u, 1340895655u, 78794685u, 1440027206u, 276129845u),
+    SC(2079194576u, 206408760u, 3718861901u, 956073862u, 1437309542u, 1334689582u, 63260688u, 3987116432u, 2576674992u, 223302366u, 1856831561u, 389017093u, 911562469u, 1016939921u, 1762071974u, 4172248993u),
+    SC(645279407u, 2574877686u, 2892202331u, 1913558987u, 1524411858u, 68801384u, 3746379870u, 1801001184u, 2180334732u, 3776662972u, 38527721u, 3193315581u, 636534998u, 1990911305u, 663885965u, 1512564414u),
+    SC(1900595943u, 3994607954u, 3275050997u, 3718802963u, 3927241077u, 2463159257u, 2839868621u, 4085758841u, 198915578u, 4143476368u, 1095130878u, 3670457358u, 4292094475u, 4008194917u, 2480714974u, 588296589u),
+    SC(669277657u, 867052595u, 2795167755u, 359155125u, 3142422278u, 1497114403u, 1345900055u, 2277358736u, 2730287935u, 2838854051u, 4175021916u, 2456920753u, 2113812128u, 1494166961u, 4157259734u, 1367349961u),
+    SC(2936828437u, 1529392780u, 707623367u, 3625869372u, 3495140369u, 4275219096u, 4197184178u, 3621173207u, 2926305231u, 2723219904u, 12061692u, 1909435454u, 995829473u, 3841116246u, 1087555226u, 2813084153u),
+    SC(2070135816u, 3573076815u, 827220123u, 568910706u, 3725548057u, 449620972u, 2127552554u, 1674292212u, 2852651162u, 2029688509u, 2364239717u, 3901249974u, 594093520u, 197966460u, 3772459454u, 2498847527u),
+    SC(2876672083u, 351529099u, 3594321846u, 2404332082u, 1330333697u, 1101987731u, 2497023899u, 2244380940u, 443664435u, 3604573121u, 204693774u, 3623818369u, 3388971073u, 360471008u, 1564083055u, 3481213228u),
+    SC(1679046640u, 2060931346u, 4164375687u, 3423524953u, 3436382426u, 1260774825u, 2503882012u, 2654720814u, 1012463590u, 2991928426u, 4111408040u, 1056999010u, 2100218192u, 2227381936u, 3435373448u, 2175381809u),
+    SC(4113759533u, 1611584632u, 3252473519u, 4244745863u, 1626860744u, 2000246795u, 2605348425u, 1738572491u, 1939034444u, 1896971647u, 2094773462u, 3355691507u, 572016557u, 1769772126u, 1141624737u, 310770326u),
+    SC(862427481u, 743156548u, 3634261856u, 2408065336u, 3681803220u, 1978719294u, 3791376501u, 186414641u, 1277132804u, 1877515507u, 1829208657u, 1609923806u, 387079522u, 1559655850u, 534184291u, 1231638460u),
+    SC(3783573869u, 708102743u, 2959823766u, 684376709u, 1863890912u, 848759387u, 3793885703u, 3193358795u, 2113913211u, 1374657613u, 4050301032u, 2355552087u, 3594964276u, 1186269639u, 2139480125u, 3804610419u),
+    SC(4171857174u, 800365909u, 3146639760u, 2585838051u, 1332537046u, 4021864079u, 237422724u, 1679152153u, 1020513363u, 1304414721u, 2492653921u, 1643309164u, 1595975738u, 2254992551u, 3738485476u, 1107693894u),
+    SC(2662771247u, 1818941473u, 3563968018u, 953408595u, 684704774u, 2909902414u, 3006128362u, 306665345u, 340793987u, 2043883017u, 912576052u, 440507176u, 1407181800u, 4223796399u, 3409175367u, 1816511129u),
+    SC(3955381866u, 1759938901u, 3789825856u, 843043841u, 2084581727u, 3468326466u, 1602779708u, 906126986u, 123633929u, 2533316322u, 1700765573u, 2929641893u, 4206083521u, 1122960954u, 2691248612u, 3569871417u),
+    SC(1432642616u, 2842087004u, 799388317u, 3125297355u, 2879151691u, 1081387517u, 1733000882u, 4113286034u, 878910086u, 1979927177u, 3485726346u, 1171084006u, 696768524u, 3920159375u, 171377167u, 2552008038u),
+    SC(3095364361u, 3204153843u, 825382840u, 3353186636u, 137297757u, 1730802407u, 3974824759u, 2065061726u, 3198576690u, 1508114477u, 1874718783u, 3087789083u, 3987071426u, 3428173360u, 3740121085u, 2842600088u),
+    SC(1167422853u, 3024148030u, 2901776562u, 24003422u, 615960341u, 680708311u, 2503242207u, 1889577278u, 4106969696u, 2003455823u, 598488682u, 1448110075u, 2996255228u, 590648224u, 188656362u, 3300332583u),
+    SC(747697740u, 2375828155u, 405063713u, 2409414743u, 1072223816u, 3110137361u, 344439780u, 2521352839u, 2191248727u, 2892250294u, 166723753u, 4063219543u, 1774108541u, 1797098164u, 3659644481u, 3552729738u),
+    SC(3945953991u, 2006751933u, 2504434684u, 3346208553u, 779434258u, 732559294u, 920323400u, 340483838u, 564931717u, 2368720184u, 2352137620u, 3605481475u, 750515045u, 595944864u, 2353238416u, 1368167477u),
+    SC(157206498u, 657247399u, 2854946813u, 3548188424u, 3668136984u, 451087978u, 3684748061u, 745341053u, 1933018863u, 1507811408u, 1428867347u, 3238758544u, 760782462u, 1333006131u, 1979158469u, 731982687u),
+    SC(1266312856u, 2337251456u, 4068246621u, 2146530161u, 2433763881u, 744592885u, 4231429225u, 4228692945u, 2332310480u, 2740999698u, 2276691924u, 3650824676u, 2387757389u, 2185306236u, 2458146843u, 1671977871u),
+    SC(2310194571u, 1844806111u, 891990666u, 1636837312u, 2837657490u, 4234487271u, 1205517617u, 2739070642u, 806034228u, 3562661467u, 3798330858u, 540767420u, 2600812523u, 2291040756u, 268720656u, 3623172651u),
+    SC(1091148637u, 2674534608u, 3836215053u, 3076441223u, 479355687u, 2314258432u, 2061140244u, 2613329137u, 705346198u, 774607542u, 3913884987u, 3764750545u, 1040683418u, 56183590u, 2572948919u, 2053294821u),
+    SC(3165715556u, 2663712963u, 1349752498u, 2590389589u, 2284186268u, 327796759u, 2944390678u, 119708644u, 378304914u, 3476813227u, 1815745198u, 153282119u, 325471673u, 763100764u, 745826611u, 973592070u),
+    SC(2051000664u, 1516394159u, 2654031015u, 89817238u, 2631119830u, 4144187813u, 247929293u, 3985339950u, 4270532620u, 701302550u, 891847974u, 3071778192u, 3672034680u, 957517602u, 399787467u, 3554612038u),
+    SC(930124769u, 3110642526u, 3773966817u, 3864451738u, 1971569126u, 13660129u, 3365814022u, 1638405994u, 3888154125u, 4140430433u, 2120895952u, 3099645952u, 1790611080u, 34270082u, 3873503392u, 3267756505u),
+    SC(3320837082u, 4104506572u, 4059200147u, 907215265u, 2442862034u, 1519970871u, 1537621780u, 1253043416u, 887166516u, 653886428u, 415801388u, 572703485u, 177476255u, 1312759143u, 4096038476u, 3703142940u),
+    SC(16546073u, 3948285235u, 1143148402u, 2204676043u, 1007658737u, 1391219945u, 2229968075u, 3862952743u, 477968258u, 2943774713u, 3155998776u, 2387246544u, 2689320142u, 2913812393u, 1093829674u, 2556012211u),
+    SC(662951931u, 1228434802u, 1413696726u, 3989238895u, 3004269346u, 1137934790u, 679316260u, 2250024381u, 2745889393u, 192965312u, 3821293606u, 687381625u, 3838215540u, 2171666705u, 2838588984u, 3355073648u),
+    SC(1946657912u, 1758781648u, 4152330569u, 1583071125u, 2297776751u, 4248162857u, 2329195279u, 764019443u, 307287394u, 2531364016u, 2858105150u, 2838702462u, 3737075092u, 94028238u, 617353653u, 2281565340u),
+    SC(3268594915u, 692120794u, 2007765134u, 1901346937u, 3314130852u, 4165344758u, 3428113697u, 2824971041u, 4039029242u, 1086029937u, 2458584547u, 3972551771u, 177315498u, 3895516018u, 2658003035u, 4032436489u),
+    SC(2364977545u, 3305445718u, 1788142069u, 2875102512u, 3562645813u, 80417771u, 882879550u, 2917705071u, 3211435376u, 853878918u, 3463251667u, 2989311912u, 846899080u, 371274636u, 369493323u, 3486489750u),
+    SC(3601888646u, 3986654321u, 261532767u, 1395096862u, 770615851u, 2144378193u, 3974526573u, 698960232u, 3669284020u, 3461764559u, 1257180429u, 1581228690u, 796460062u, 3538042012u, 1975419893u, 4036776742u),
+    SC(2803939123u, 1621114591u, 4080666913u, 2423871540u, 2657492275u, 1155170319u, 3092718203u, 250926663u, 522271850u, 1914449282u, 1614275493u, 2700379775u, 332897791u, 3175413169u, 464896181u, 1216670307u),
+    SC(1435129496u, 990103238u, 1904064610u, 3852324981u, 3013581730u, 3389108396u, 2510724332u, 523919351u, 2114438994u, 3676419723u, 561218648u, 2688941152u, 4265273449u, 2290079063u, 2464990919u, 3573526948u),
+    SC(3106398147u, 663120040u, 3308427585u, 4045213194u, 2814564823u, 4174824035u, 2628474192u, 283200676u, 1021851429u, 2572427899u, 3022054239u, 2003849765u, 1928648788u, 2577069394u, 1267176898u, 3072538764u),
+    SC(728814745u, 277196789u, 2296528597u, 2874516340u, 1010169628u, 1696334181u, 335122124u, 1326345640u, 3745594189u, 2854116508u, 2721678441u, 2105701935u, 175117331u, 481174989u, 445968426u, 1349159686u),
+    SC(3095620828u, 4147080704u, 2577995805u, 2495248361u, 3778448980u, 2788036932u, 337769199u, 766443094u, 162350383u, 238154349u, 3403088203u, 1758375606u, 29289642u, 1402258265u, 2946834953u, 3842254798u),
+    SC(623585659u, 1710285370u, 158894920u, 255033498u, 3966153797u, 3448822528u, 1305176704u, 3299840935u, 2361712836u, 1010065937u, 1936341967u, 3259652287u, 2675427280u, 3308474600u, 113970658u, 1620142136u),
+    SC(2671587530u, 471190630u, 2398969760u, 1030454235u, 3545179908u, 3446839442u, 2866353948u, 3737019184u, 1149985844u, 261484154u, 3154471284u, 4047987057u, 893229976u, 1310852475u, 946217767u, 2989625776u),
+    SC(2183520622u, 1539943897u, 4287264539u, 1539816673u, 1698387038u, 1314175462u, 1848453509u, 802381385u, 1649722851u, 2867831489u, 1822745054u, 2280693140u, 3749931933u, 3506463020u, 1903471221u, 2097508602u),
+    SC(2816273992u, 1299093937u, 3073015991u, 1306678705u, 122636135u, 1295800217u, 73833638u, 2865770174u, 493817082u, 1990365215u, 1214379329u, 3203901768u, 2019058040u, 2356953764u, 766870458u, 29454503u),
+    SC(2836678056u, 1565321486u, 2563979055u, 3536217272u, 2590747179u, 2744581406u, 554578270u, 2157541044u, 2915354251u, 2578477745u, 3038582034u, 3449028732u, 1927195897u, 1316770889u, 4057479286u, 2024919296u),
+    SC(1952631246u, 2424084053u, 1975783574u, 890298383u, 1869522605u, 2288835705u, 3983040226u, 712827377u, 1341800901u, 4029424281u, 3291346348u, 2043429184u, 1202214120u, 858754858u, 3867146784u, 3144796127u),
+    SC(3559429619u, 3735328189u, 2945332923u, 1786376756u, 3755496772u, 2522514694u, 1564002950u, 684543808u, 804121368u, 329325634u, 3884358432u, 2075674732u, 2552328463u, 2819464125u, 1506355936u, 3037568245u),
+    SC(4019940194u, 3464845450u, 4046730418u, 2130001170u, 3895008877u, 1990612585u, 3265108385u, 1295551196u, 362766287u, 2599471458u, 3985668437u, 3910404042u, 2149978709u, 1169593226u, 3675827936u, 2613023023u),
+    SC(1074000288u, 3160776111u, 3747592125u, 3163992063u, 2458352766u, 711540537u, 721094344u, 4256997170u, 3959409313u, 1951985840u, 687807947u, 1958643293u, 2142154662u, 3262151881u, 3932708533u, 2036465401u),
+    SC(1133529227u, 1795414097u, 1686603504u, 1955001805u, 2862277081u, 4745182u, 3201762154u, 1791007371u, 2016583141u, 2702030187u, 473282698u, 568193939u, 1159725505u, 698400110u, 1574398563u, 2256728186u),
+    SC(2926420178u, 2661546854u, 3053481046u, 1577028417u, 1618275862u, 4194272953u, 1616330855u, 2885344929u, 1959438947u, 3707841123u, 3882813718u, 4084228430u, 702803998u, 3096136128u, 1554199092u, 3239893703u),
+    SC(2029550047u, 2556512033u, 3083228754u, 82314998u, 56181472u, 2500138235u, 799902342u, 3150956330u, 1100277132u, 1200285707u, 4206256567u, 4290272455u, 588819155u, 2295733352u, 2807376237u, 942152390u),
+    SC(2154316645u, 1329705158u, 3603780044u, 2206422492u, 55762984u, 2065440029u, 3990026606u, 1607040513u, 2332828223u, 331750222u, 504633869u, 56568231u, 1967570046u, 991845445u, 639644651u, 2461410401u),
+    SC(693149087u, 1339651572u, 1862078825u, 496488618u, 4164639028u, 2625204240u, 97204488u, 1267156588u, 343403381u, 1772138390u, 3385838782u, 324942982u, 2738742661u, 783104218u, 2316221034u, 114350721u),
+    SC(421336131u, 1033663023u, 202715902u, 868629148u, 1312642881u, 1858042268u, 764411566u, 3743283786u, 1540359177u, 3065344429u, 1952370563u, 2441629421u, 2783168438u, 1710003974u, 3940857053u, 1882860760u),
+    SC(675533870u, 3530785128u, 1592616367u, 4003998706u, 2769227294u, 1035076065u, 3958944089u, 453072296u, 2155670118u, 3237650259u, 3028184620u, 590131749u, 2012065720u, 161116056u, 4287090833u, 3150331624u),
+    SC(1432926128u, 2522272623u, 1397182795u, 2390889208u, 3916353581u, 1159118872u, 1298480081u, 734590532u, 1531243430u, 1417899460u, 1069392653u, 2124637190u, 1231046043u, 2752678161u, 2335016504u, 1357254023u),
+    SC(1535434976u, 2157855910u, 2660073899u, 1499149048u, 1249760289u, 3228826990u, 1597566046u, 2974148611u, 442868432u, 4202241261u, 1928992034u, 2923630933u, 2120288704u, 4271063619u, 3410220015u, 2903757720u),
+    SC(4014130539u, 3710128241u, 1205948826u, 416491792u, 1734060098u, 2462879454u, 2416600298u, 3202328178u, 1880430407u, 859150711u, 1629359141u, 1256046443u, 648419490u, 826756668u, 3387407571u, 2348774828u),
+    SC(1222636252u, 3037547094u, 1273425152u, 991172020u, 2915455980u, 2280319308u, 2461516073u, 1448536931u, 2847840251u, 1404038390u, 4038875625u, 2348471618u, 4197049917u, 4144101045u, 4042678401u, 2372155688u),
+    SC(1731105013u, 610980212u, 281649887u, 3257600396u, 3516021716u, 436060983u, 4169262331u, 1256798420u, 1945973632u, 534408630u, 2285791115u, 837152926u, 4080121380u, 1444408478u, 2544511161u, 2709004057u),
+    SC(1506654641u, 1912308124u, 2426276170u, 2514228702u, 3690878241u, 1249687331u, 4001150817u, 1261526238u, 89834002u, 1728793187u, 3975411943u, 813826205u, 2133670105u, 3834694168u, 2054008859u, 3900920226u),
+    SC(1558416650u, 897210539u, 323860601u, 3113850052u, 1803714434u, 2384259312u, 70322398u, 2905463576u, 1585537538u, 3653359726u, 3271052083u, 3720135963u, 2490666087u, 277465537u, 1952060633u, 999814934u),
+    SC(3380746602u, 1952906171u, 2967632532u, 191559974u, 3248967002u, 3497076936u, 673489179u, 1402515418u, 2056387050u, 3863230639u, 3117311048u, 2713793499u, 764393765u, 1313162934u, 4026622845u, 1351622485u),
+    SC(943501444u, 2045123564u, 3702005033u, 2006372367u, 1623178434u, 2210938161u, 1918849833u, 2208221208u, 652373922u, 1224771891u, 2346583192u, 23016665u, 196883494u, 2911257855u, 3675920655u, 2044643614u),
+    SC(3868481329u, 718598474u, 1905359698u, 1149243871u, 683183259u, 1791509840u, 613197053u, 271540523u, 820846722u, 1375498270u, 1589566938u, 3387624260u, 3357329519u, 2533787804u, 454833030u, 1299641661u),
+    SC(755003834u, 2407109458u, 555837650u, 308455209u, 621283826u, 620386471u, 4068721862u, 3147396855u, 3452594433u, 1313371121u, 378819908u, 134219677u, 3435206897u, 2775620355u, 3362959383u, 1595800971u),
+    SC(3358299223u, 1706512319u, 2446276080u, 1738045369u, 3660956336u, 2218252169u, 2373226274u, 2003582u, 777014737u, 196111356u, 2114289070u, 2595000071u, 3044675370u, 967922493u, 2467551730u, 73389730u),
+    SC(2618969134u, 2125210025u, 4275123693u, 3879197977u, 643100066u, 4214899239u, 1674273576u, 1975251110u, 4078127980u, 318184536u, 577540392u, 2608552454u, 2162910790u, 3923390048u, 536907518u, 283711871u),
+    SC(2535275931u, 3161010722u, 3985364549u, 3893067001u, 2601978422u, 760706363u, 1781187198u, 2372705064u, 224646298u, 3801537580u, 1816818607u, 2143676525u, 3791885363u, 4085614976u, 2158194559u, 2446470702u),
+    SC(4115217011u, 2260472145u, 603103018u, 3764493829u, 1711944058u, 3210396223u, 2792882938u, 2341567787u, 3870145739u, 2339898672u, 724586839u, 3022502069u, 944070146u, 2148744739u, 2520920174u, 1709240791u),
+    SC(2199851582u, 1343097354u, 3835142945u, 1589502637u, 1983005949u, 1085507290u, 3722466615u, 2578898964u, 895576162u, 804620460u, 1429185800u, 3471793913u, 2885988106u, 2645997904u, 4098300360u, 3408010604u),
+    SC(2609700973u, 1591116u, 865387316u, 787711446u, 2050198562u, 2565417333u, 4050816135u, 2306669365u, 1989411360u, 3101441540u, 2094682308u, 3254073159u, 130975575u, 2762175261u, 1898768901u, 1118047602u),
+    SC(4144664939u, 2844601289u, 1612129296u, 1119829524u, 351300781u, 234858443u, 511784871u, 1069922389u, 4055417332u, 1893173615u, 4086972350u, 2574944499u, 3041029508u, 1136919103u, 4288217083u, 671249826u),
+    SC(757774267u, 3293478884u, 2871539297u, 794959109u, 2790091017u, 4254393753u, 2463443706u, 3228974422u, 1397034496u, 711561672u, 1761477710u, 2338439891u, 3321809071u, 906326666u, 3850187468u, 3310561512u),
+    SC(2172182200u, 3306592140u, 3928310335u, 982593879u, 840955845u, 1568692467u, 3701185862u, 4107337733u, 380050219u, 1187631875u, 4105071144u, 592595389u, 4190110022u, 2724948987u, 1501806518u, 2372924604u),
+    SC(3027286902u, 3490888318u, 1743756338u, 2916456768u, 32964810u, 369111057u, 652650130u, 917858916u, 4157641696u, 2098698337u, 2266969841u, 1490184583u, 393605250u, 2734422633u, 667689586u, 1632622940u),
+    SC(374287034u, 2205985810u, 431263411u, 821043521u, 3551041825u, 484130680u, 4262925119u, 3806210510u, 1002460680u, 2516045876u, 1251919774u, 193076230u, 3263396944u, 1720865175u, 738681716u, 2266835164u),
+    SC(3346676228u, 44592430u, 4111607435u, 902543517u, 3869380842u, 2285773443u, 3965320901u, 317138420u, 784127339u, 3992035455u, 3850888594u, 2396390067u, 1830663394u, 1531570452u, 2378821340u, 320666530u),
+    SC(237891489u, 4145336177u, 1434074909u, 1908845544u, 299848964u, 228822687u, 101372725u, 61936457u, 1591100163u, 2052307911u, 792826158u, 2790775108u, 206637018u, 999994699u, 3633009754u, 3762680361u),
+    SC(3995931339u, 3033374284u, 373279262u, 1514352815u, 891817193u, 3424475058u, 3524338755u, 3056680508u, 3800767937u, 2755099749u, 2207173370u, 3221206678u, 1079507823u, 3712724744u, 1241063994u, 3994366562u),
+    SC(70855830u, 1944510154u, 4089682996u, 4122901565u, 2718997317u, 577848956u, 2029147862u, 2107517117u, 2145698179u, 2922718515u, 2957635029u, 876243892u, 1954374615u, 3505653501u, 1493346438u, 1117264u),
+    SC(1500701422u, 376665261u, 2477151729u, 1611199642u, 257263282u, 4161902502u, 1898967836u, 168651104u, 1836121173u, 3500506228u, 2318288986u, 3640900978u, 2006139900u, 2080966727u, 3158174746u, 1870426582u),
+    SC(2824699914u, 4230742805u, 2292129706u, 702903914u, 2709582618u, 1074674713u, 2237176560u, 808220842u, 1948899316u, 2419881632u, 2755885889u, 2458278778u, 4284140154u, 1390228133u, 150515725u, 3112093790u),
+    SC(3380833039u, 223956940u, 2592729181u, 2102420358u, 3438165816u, 1920310492u, 2504545951u, 2784084549u, 2668304678u, 2478309078u, 790265094u, 4252067623u, 3201417925u, 2612277741u, 2486923394u, 3499424448u),
+    SC(3391194365u, 2998421076u, 3493105247u, 1838559635u, 1978844225u, 2925814315u, 1485614719u, 3523394875u, 3508676640u, 1030060716u, 76798898u, 4271319481u, 3797302472u, 526849574u, 2210722045u, 1919569385u),
+    SC(2651133382u, 1016829540u, 141960964u, 2153798998u, 3051266252u, 3349464683u, 1151526405u, 915677144u, 702427684u, 2733321606u, 2951706782u, 767165982u, 2515580770u, 293527120u, 1833640393u, 1421771546u),
+    SC(1107569701u, 857750143u, 203607930u, 4200545657u, 2318682074u, 1373007712u, 1403580416u, 2942157260u, 4034242170u, 1835808882u, 827597013u, 197213459u, 3310304285u, 1643593117u, 4285042087u, 4125540442u),
+    SC(1715839421u, 1319830206u, 1166561277u, 680089086u, 1062889674u, 2598646204u, 3443091399u, 304700310u, 589265401u, 489049812u, 686639920u, 4041813068u, 3213895781u, 604310375u, 818728210u, 3146043309u),
+    SC(1311252077u, 741437064u, 588546731u, 361225783u, 1754854312u, 2265925471u, 817700584u, 3568512927u, 4102860232u, 470916829u, 3858202722u, 3453760534u, 3287746773u, 4085139728u, 300905857u, 3227869228u),
+    SC(1998808084u, 2531532447u, 4047273979u, 3349570051u, 1337653203u, 3828534786u, 4241837808u, 1253003574u, 573440372u, 225230878u, 4216015858u, 2415982231u, 2562639776u, 1702834828u, 2148020340u, 606982680u),
+    SC(1059811404u, 2370205785u, 2913339148u, 2971801664u, 413859999u, 4155894749u, 2939279735u, 232020064u, 2758895525u, 342551390u, 2352536865u, 1566679775u, 3803622283u, 4245023391u, 3047141032u, 994957450u),
+    SC(2035204400u, 3527661585u, 784036080u, 905544667u, 2226367696u, 2924239697u, 1678483090u, 3970777414u, 1240329406u, 2512542844u, 4006237055u, 2474307420u, 1703882197u, 3636518513u, 3355932586u, 3497781325u),
+    SC(1963981292u, 3814973739u, 2041597172u, 2813444273u, 1237669069u, 1855972282u, 2156697108u, 2510908067u, 1512580765u, 3519390701u, 4108783380u, 2584087362u, 759461055u, 508325371u, 769740847u, 2048743849u),
+    SC(3596355031u, 3748030700u, 3110903489u, 4245853282u, 641402924u, 2608808297u, 1664482090u, 3059905231u, 225913029u, 470864941u, 606913975u, 4235722157u, 2118696454u, 1798274103u, 2300290288u, 3726149689u),
+    SC(3548400822u, 2360535529u, 3048854128u, 230269298u, 2932866617u, 1923338998u, 304463605u, 1498517699u, 301675788u, 2506646667u, 816791857u, 1174746152u, 679019070u, 1878054419u, 1210852465u, 3051556190u),
+    SC(4150451750u, 902182047u, 1825135713u, 2664402231u, 1788052033u, 285662013u, 3008274052u, 1882528758u, 3697801696u, 3366260638u, 3880989997u, 2844857060u, 214950445u, 1049116939u, 481149114u, 3164592148u),
+    SC(2870523071u, 2821193547u, 401479230u, 3514710311u, 3621580014u, 3129462397u, 2891863911u, 1404598897u, 1840790485u, 1944324390u, 3364011017u, 3301998450u, 695233820u, 3534872277u, 3044977081u, 722315545u),
+    SC(4149527112u, 4274133736u, 3660855943u, 72966698u, 2971957421u, 2405674379u, 4123420309u, 26790238u, 754677410u, 1604093814u, 3091781862u, 2136229748u, 3763784314u, 851160658u, 2477947282u, 1616032189u),
+    SC(4174989118u, 1010763672u, 4170443995u, 1902889494u, 271914691u, 323078370u, 3259379023u, 2588329244u, 1441793631u, 2753756730u, 649270490u, 3344201781u, 1548991803u, 3776661126u, 2651176594u, 3616689666u),
+    SC(140745026u, 3532966856u, 2591423010u, 1529478569u, 796678836u, 3216786325u, 892142861u, 1968092993u, 957606442u, 1147003738u, 920099517u, 3678328783u, 1948100739u, 1287134249u, 1736038569u, 3889241677u),
+    SC(710446188u, 1886009483u, 4050752048u, 3047627594u, 109408898u, 138079329u, 2035096184u, 3147158978u, 2938498423u, 441906905u, 1678241918u, 2816548759u, 1643403438u, 3216710400u, 2525244491u, 1824814482u),
+    SC(326881774u, 2301737384u, 2993535562u, 3651530160u, 2772801303u, 36577251u, 938380628u, 34213046u, 3454663547u, 2174207869u, 658415374u, 3900536481u, 3941208158u, 555043711u, 4119104048u, 399436386u),
+    SC(1180173125u, 3330683196u, 2534744945u, 330247210u, 261840874u, 2715859784u, 3525033522u, 3537775551u, 1975278971u, 3056771067u, 737920925u, 3060747306u, 2128273038u, 2708189265u, 171609833u, 3969052516u),
+    SC(1242862162u, 2947504845u, 2553267345u, 3261789509u, 49255382u, 455617157u, 1456861028u, 958124595u, 4223729852u, 280320864u, 2523229859u, 2252299595u, 3147727868u, 1512433050u, 995350415u, 1624236677u),
+    SC(2303638950u, 4228632463u, 235032881u, 880137803u, 2512253065u, 2107069434u, 2903479026u, 362815256u, 2992582992u, 358052559u, 3332178513u, 2547219168u, 508485122u, 3801695095u, 2678990543u, 1600045142u),
+    SC(3876424339u, 177322129u, 819917234u, 3218546860u, 770628774u, 4192577626u, 1009413806u, 1173029678u, 3174755923u, 2746285931u, 1174116074u, 1225902850u, 4262471297u, 2273975050u, 1765793553u, 1289353676u),
+    SC(2092039619u, 3855397341u, 1242986075u, 4183059306u, 294225983u, 324879486u, 3945029563u, 1320380498u, 151970006u, 3201261559u, 3087981537u, 1977348696u, 3515387912u, 2835272928u, 426304202u, 2412402733u),
+    SC(1361545944u, 53598743u, 2412317217u, 1126928472u, 3013564368u, 824247941u, 3214670786u, 2277097409u, 95089991u, 4087146104u, 2352666457u, 2992485349u, 2076309985u, 4149985344u, 1399708905u, 3550899055u),
+    SC(4042172959u, 3307941992u, 1219846920u, 587002099u, 267276296u, 1424127694u, 3925776644u, 1425382621u, 152041627u, 2488103101u, 3948830209u, 1794894640u, 3575445498u, 2165845603u, 2872816329u, 4061286146u),
+    SC(922524658u, 2348355538u, 1630957762u, 666180608u, 3747302575u, 623599094u, 1687018347u, 61794929u, 2289842294u, 4054608936u, 1617723745u, 1306246119u, 3648384198u, 2681800542u, 332456867u, 3884148355u),
+    SC(1848762987u, 217662316u, 3779931396u, 472512046u, 324818077u, 1583725261u, 3125670568u, 2610017931u, 37262980u, 2657336746u, 3052919287u, 2054654769u, 2495721351u, 3499793029u, 2240373128u, 2899371950u),
+    SC(3305391689u, 2763113151u, 2892663324u, 3939711648u, 1034549976u, 1333014188u, 897132146u, 496560228u, 1831207634u, 2212927163u, 1904022311u, 213980219u, 1174259789u, 3100901551u, 1400578077u, 2812347003u),
+    SC(177421937u, 4047258837u, 3181963619u, 3047163835u, 3115509836u, 3293712870u, 3970434284u, 1788463656u, 2468082620u, 3964003062u, 3864465927u, 835989468u, 3285058169u, 1411454197u, 3250648665u, 4129296298u),
+    SC(2416178717u, 2215390562u, 464095364u, 3776381835u, 193288656u, 2972885418u, 2209216093u, 4175734155u, 1355239716u, 4146805074u, 2683010766u, 3416418388u, 327721388u, 1935873330u, 3061798620u, 3906144405u),
+    SC(4236278808u, 1018392780u, 2251860959u, 3245506982u, 2437816745u, 3925074629u, 872119351u, 3399526534u, 986160446u, 1974213979u, 2846847587u, 2639675990u, 483356624u, 1804414174u, 3922872859u, 3903783098u),
+    SC(1023879908u, 2896473123u, 3023790223u, 353094987u, 3447197102u, 2118153153u, 2250849486u, 3756956861u, 114943043u, 4146186744u, 2844771683u, 9270823u, 4190503956u, 1742354519u, 2466076114u, 2120604086u),
+    SC(3502998932u, 1885451431u, 3535560429u, 1378856843u, 3127781052u, 2060131645u, 275426265u, 2818051520u, 4227665702u, 3922779329u, 2685434754u, 3517548395u, 2373280497u, 1106282796u, 2608045639u, 2063674890u),
+    SC(3840786603u, 1679214148u, 509211756u, 3340901568u, 645574060u, 606924338u, 1101451867u, 1666959869u, 4095490793u, 3467097284u, 75711618u, 2550663121u, 3298229582u, 196110692u, 3091996611u, 1338885918u),
+    SC(1647555851u, 759009537u, 2405073864u, 2227048286u, 4290250305u, 453726833u, 1434268331u, 3716068530u, 2382015780u, 4292684482u, 1467019806u, 847612081u, 55196203u, 3718513561u, 2031218457u, 2237512901u),
+    SC(1822425442u, 3799148002u, 666166596u, 2123898731u, 3290949214u, 3185743327u, 2486482908u, 1386322613u, 3544145763u, 2834442208u, 2755650199u, 3132832263u, 574523670u, 236272220u, 3774185061u, 290770145u),
+    SC(3222406570u, 1563069789u, 3235063982u, 2095565590u, 3603552658u, 2338391475u, 3446171246u, 922680572u, 3059638169u, 3304358037u, 3787288431u, 1794685566u, 3475605675u, 4289313605u, 986716249u, 243473726u),
+    SC(3818279827u, 241330379u, 1641478937u, 1476726585u, 129541527u, 1248611003u, 1309374674u, 3672170837u, 528002374u, 785834457u, 402671762u, 2235054892u, 1066868645u, 3449866280u, 2733803967u, 2155026231u),
+    SC(666882291u, 1881840963u, 5292454u, 2681835773u, 1036008184u, 1354597624u, 19169826u, 1823513038u, 585198432u, 3905597117u, 431014076u, 3825985472u, 3298808816u, 3641265977u, 267131676u, 3160686056u),
+    SC(2182151104u, 590452069u, 2666272631u, 312048265u, 708253484u, 1869996998u, 3421536416u, 1872143088u, 501053330u, 269575883u, 3138508114u, 2246176435u, 3215768357u, 1830441111u, 383691038u, 1185934989u),
+    SC(365717174u, 1607187840u, 3742706058u, 635633536u, 2924302437u, 4173265584u, 2311922087u, 1312062302u, 2487961577u, 896828054u, 3736282313u, 4116802856u, 2065849140u, 1217377099u, 1843055922u, 127106199u),
+    SC(3950738082u, 1167458665u, 513909890u, 2850472798u, 3350923516u, 1919691851u, 4286585568u, 2496231798u, 1294898544u, 3424155537u, 4240253161u, 66086250u, 4116279118u, 17089522u, 667041666u, 785494518u),
+    SC(1167653628u, 3978946628u, 3257153248u, 2573894761u, 417841414u, 3020578465u, 1605429215u, 1587257644u, 3879573174u, 3532843564u, 964140542u, 2138138121u, 2542437717u, 3853555241u, 2110661263u, 4083048595u),
+    SC(1233345158u, 907208084u, 1462379921u, 1996033560u, 3850194428u, 420529925u, 2386030259u, 444989687u, 62349626u, 264056001u, 3424891207u, 3773304118u, 1179388066u, 3834173369u, 2186341687u, 3754927409u),
+    SC(980250605u, 533495911u, 849549179u, 81517619u, 1019207863u, 3516073401u, 2522420983u, 3459470161u, 3426696586u, 827154815u, 344614662u, 3622897217u, 300624726u, 466738445u, 4070074661u, 1516643562u),
+    SC(555779462u, 1751186992u, 3465728751u, 2986564468u, 4134707236u, 4001081976u, 4211960955u, 987212277u, 2867938750u, 5353964u, 1072597985u, 527342963u, 2533297379u, 1106402684u, 3775351305u, 2025765815u),
+    SC(4162392874u, 3384487689u, 1715298460u, 1372262841u, 2201665666u, 1827667144u, 1741529165u, 644763142u, 2986206776u, 3966382172u, 2868892064u, 1678028524u, 3308210415u, 1984342963u, 2116186681u, 1284054501u),
+    SC(1399588312u, 2273731596u, 1131629938u, 183329497u, 377718177u, 557597736u, 1111135287u, 3270246557u, 2135679232u, 3626491416u, 1757162307u, 3359246533u, 4253343214u, 531230483u, 1263047461u, 3681415381u),
+    SC(1126699582u, 3301366646u, 938360531u, 1120446553u, 165556145u, 2744788157u, 1695249338u, 2715775531u, 2176844522u, 19363667u, 3869388711u, 458196725u, 1323376400u, 257776405u, 2496255977u, 1671694423u),
+    SC(4091631358u, 4166162769u, 2259281206u, 16352705u, 1787165746u, 3574503944u, 357620328u, 287989527u, 2449462891u, 1459555951u, 1708555907u, 3278026835u, 2733916622u, 1947783313u, 1566429338u, 3028849362u),
+    SC(851080025u, 2229354306u, 3538462486u, 2773237932u, 1715839407u, 3941609702u, 2185406680u, 2336582857u, 1744817950u, 473084240u, 2821370647u, 2398243987u, 4032132700u, 2659082752u, 4167610755u, 3165964021u),
+    SC(3416009530u, 71110750u, 1367766223u, 1691923626u, 2626063251u, 413908445u, 3433808044u, 1501729553u, 533102322u, 591333227u, 3738414151u, 2580044241u, 2202790495u, 3173766619u, 606472174u, 2217437471u),
+    SC(3780061272u, 3082776688u, 842307221u, 3768307003u, 1593813335u, 2881592965u, 1861890493u, 781333744u, 1040508061u, 3555982649u, 2285681701u, 2161508102u, 3482107661u, 1250514785u, 4090303972u, 3705703387u),
+    SC(359394171u, 472365283u, 214401299u, 3380604966u, 1954614764u, 1480629761u, 226194312u, 2270498178u, 3339809546u, 2149674696u, 892002095u, 3583220113u, 982422214u, 202817915u, 383941265u, 2428261233u),
+    SC(3730745318u, 3115608164u, 1266738325u, 2586696353u, 2722771865u, 4160983893u, 2071563099u, 743822848u, 2298585127u, 3869778898u, 3691683108u, 3783445842u, 3115441767u, 582481877u, 973325845u, 2362740456u),
+    SC(2396902248u, 2348477766u, 632762670u, 2066477292u, 2929751060u, 2703760094u, 3080429119u, 3960980423u, 766786297u, 639049012u, 3586803880u, 2451826043u, 1505265073u, 1548710449u, 1838078828u, 2035669627u),
+    SC(1553406826u, 1717227998u, 2409925038u, 572751577u, 2273783311u, 4019579781u, 4213887959u, 4038186211u, 1299314072u, 935505775u, 183709687u, 1119486425u, 2861387131u, 808270246u, 3304876346u, 1602953062u),
+    SC(3992659260u, 673262442u, 3585500553u, 2728980941u, 3174401775u, 874858344u, 2244982538u, 1186587176u, 1046177288u, 3085442921u, 3100321464u, 1328571026u, 1498301152u, 622021661u, 2138778148u, 2992729088u),
+    SC(1133900362u, 3777460012u, 3675667924u, 3794105531u, 3526835398u, 2999350148u, 1937528503u, 3713162259u, 3133597477u, 1283460140u, 1686726931u, 3748894068u, 1734705628u, 28591226u, 2174477900u, 269497638u),
+    SC(2165312213u, 1940350647u, 4170267492u, 3052775551u, 2356683603u, 1600300011u, 405737457u, 2489870069u, 1389019502u, 844826777u, 2634452861u, 85842389u, 3333404858u, 2557520329u, 3532341616u, 3919580275u),
+    SC(4248438097u, 1091993926u, 1793284291u, 2853445997u, 3739459678u, 3856526912u, 2138190971u, 3952415247u, 720565005u, 1171173674u, 3097197448u, 3084929824u, 295945735u, 1489924688u, 3838295251u, 3666798007u),
+    SC(396712792u, 2817322746u, 1072716653u, 4195866306u, 1993449522u, 2882640122u, 1312801775u, 3863175161u, 3609672024u, 2746050497u, 266137202u, 3877569846u, 1099904420u, 1474323008u, 3164192625u, 3109506383u),
+    SC(2265757624u, 3804913312u, 2354869166u, 3781069602u, 2034225157u, 1591148603u, 3298508937u, 997759853u, 3275524928u, 2070944943u, 651667900u, 3794158761u, 79354860u, 2907741382u, 2813390340u, 468089507u),
+    SC(4182885884u, 3695636224u, 2915384457u, 2769068199u, 4290739254u, 3624814743u, 1414712347u, 1316092071u, 1793259553u, 2018102308u, 814108029u, 618634841u, 3245366162u, 1469245000u, 1964115768u, 3348285791u),
+    SC(2931296127u, 999474806u, 2920397574u, 2710231615u, 1824359210u, 372764001u, 837062700u, 2527120113u, 703864093u, 4124353584u, 2498191289u, 2347964415u, 1821011325u, 188206333u, 3760401950u, 2949389877u),
+    SC(3564064151u, 1563373144u, 114395774u, 1569032131u, 2223159179u, 1499325964u, 3117548383u, 825981177u, 2513928618u, 1004278134u, 962680047u, 52424258u, 4144292249u, 1125573436u, 273893658u, 3898839792u),
+    SC(7011140u, 1263261855u, 773961034u, 3298533059u, 2944469911u, 1942449839u, 1329225500u, 2049552897u, 889360415u, 3620975822u, 323934477u, 327723831u, 1692091917u, 200094542u, 2936412194u, 1858048815u),
+    SC(1594025346u, 2743801603u, 2814337158u, 2508697437u, 3865266516u, 3484386196u, 154335213u, 3956828534u, 2689105118u, 2465441686u, 2991261375u, 1946914786u, 3438959884u, 2729871997u, 4014383109u, 763035330u),
+    SC(641889410u, 1615015149u, 1510455429u, 4082394751u, 2909858677u, 2622844467u, 3328519482u, 168139262u, 294795518u, 627062831u, 3614353207u, 2470462779u, 2788714447u, 1845775458u, 2493482382u, 3089682053u),
+    SC(1797930586u, 3542592986u, 1387371133u, 3588765677u, 1325639079u, 3789928447u, 752248416u, 1184862684u, 798967078u, 112493306u, 255026528u, 497674565u, 894358117u, 3906463098u, 586173390u, 2320811737u),
+    SC(629717131u, 2116112314u, 2869990221u, 3740352138u, 3858476919u, 3611917764u, 4240454748u, 1130211961u, 1046280459u, 3552210252u, 2373915692u, 4011479514u, 1640653903u, 2897884641u, 1374404884u, 3309525951u),
+    SC(3645391174u, 2458201839u, 4202789044u, 167854154u, 3840137286u, 3255582667u, 3488993273u, 3730119315u, 3585146239u, 3861431335u, 1128927769u, 1792645218u, 334105277u, 2526569676u, 3686278539u, 2527516068u),
+    SC(1559764956u, 976167047u, 213273372u, 2607761236u, 1556881016u, 1741612523u, 2682897642u, 990765823u, 3769674524u, 4139486813u, 4158506752u, 1590113393u, 3892261157u, 14348563u, 460913548u, 364645757u),
+    SC(1102376830u, 3071933877u, 1883979543u, 1093846676u, 4176290929u, 376939296u, 998663776u, 3689445799u, 2801690033u, 3417186869u, 3450385497u, 4004256164u, 2672083626u, 478840858u, 3777008568u, 908183647u),
+    SC(1139627820u, 1106678242u, 2833061521u, 2252361416u, 2051803711u, 1081031644u, 1546062249u, 3138484983u, 3082412472u, 2427716404u, 1806482347u, 2078594167u, 2426581139u, 229620419u, 4249690227u, 4199030179u),
+    SC(1308690969u, 573605542u, 827045158u, 49386846u, 2171743041u, 3898584642u, 473140806u, 456752611u, 4040421660u, 55008984u, 1149726331u, 1003535244u, 674972899u, 1891921604u, 2786433575u, 3953549218u),
+    SC(3009453243u, 2143841228u, 1304180830u, 2179845508u, 1172397354u, 2100649506u, 1105019951u, 3994153835u, 2248664492u, 2749314303u, 2151684060u, 2541468296u, 3272118554u, 2853607650u, 241275080u, 3701235560u),
+    SC(1147035826u, 88341459u, 2077658335u, 1840321118u, 3518879414u, 2993834449u, 3751207998u, 3751172942u, 2784642442u, 2353706106u, 3200244860u, 4179814163u, 3328150354u, 679110064u, 190697227u, 3346096081u),
+    SC(1889501735u, 2456078751u, 2260048507u, 4011114889u, 3196541769u, 3758929484u, 4191925827u, 284495817u, 377497584u, 3442004670u, 2322138699u, 1183731173u, 1028195327u, 4205508136u, 2213630001u, 1486228752u),
+    SC(1655316493u, 3419481099u, 2723342117u, 2738090524u, 2318310750u, 4226911451u, 3780542457u, 704334755u, 430636396u, 1880604092u, 1267755846u, 2218672556u, 516106283u, 316596663u, 2978889512u, 2651460423u),
+    SC(732379480u, 2396341830u, 4204733321u, 2150509241u, 3777206399u, 3363941905u, 4086239404u, 3095576734u, 4085099036u, 2617940142u, 4167877725u, 880808787u, 3640172947u, 2001830947u, 1914650130u, 928654758u),
+    SC(2255665612u, 3908810394u, 2925268820u, 2606358497u, 3798395360u, 898802583u, 120671855u, 2030067176u, 551044970u, 4021689465u, 2915740776u, 264216238u, 3289507957u, 2792053411u, 2578020998u, 2600841061u),
+    SC(860663810u, 2216700313u, 2046671553u, 99507223u, 523419366u, 322109677u, 2724557288u, 3182127797u, 2284312991u, 1034389391u, 1186225149u, 1469865144u, 3840504502u, 1238778765u, 2531631496u, 1520792788u),
+    SC(850595335u, 3529567239u, 894217578u, 795146268u, 3924975438u, 1203706622u, 1613701786u, 900492621u, 1912590093u, 1693356152u, 1864959000u, 287753294u, 1549678216u, 4077271361u, 2238056564u, 1010566183u),
+    SC(3842610776u, 2051755619u, 1139016191u, 698260475u, 995943426u, 1547237893u, 123856384u, 2744812625u, 2063827624u, 1698863750u, 2498415823u, 1550529408u, 1748646166u, 1895592513u, 4046636133u, 3015388878u),
+    SC(3011980364u, 737491388u, 3769540661u, 993884269u, 3395830049u, 702244523u, 3541494064u, 3856025469u, 130942127u, 3838363759u, 993520927u, 2849849697u, 1496915057u, 584119545u, 606392464u, 151118469u),
+    SC(3535106015u, 2438390699u, 776031638u, 1240777752u, 101277300u, 2732558600u, 4088661726u, 2570440827u, 1144794139u, 1734773846u, 2823506213u, 2490011231u, 2959750063u, 924144298u, 2915284224u, 4024676927u),
+    SC(258573950u, 276088677u, 2453615329u, 3969860019u, 1317177597u, 1655742593u, 366679465u, 4085234379u, 4251741733u, 705799446u, 2631945326u, 3608789547u, 1752210407u, 1876758104u, 3439658438u, 1094699542u),
+    SC(3155701940u, 2846560705u, 2911336648u, 1754254572u, 3403823256u, 1432053113u, 1650920842u, 3118877064u, 3055829129u, 4089733427u, 427401466u, 4090546418u, 2392182219u, 316382885u, 3067697860u, 3257810049u),
+    SC(4206538273u, 3698499546u, 2563029992u, 1020656530u, 309131806u, 2719957943u, 1147030343u, 4086151932u, 458659701u, 1682331698u, 3342144435u, 3983207839u, 394060218u, 2998968252u, 3301127680u, 1479380188u),
+    SC(2469945601u, 1297959997u, 4178725246u, 2722683107u, 3168009219u, 560846203u, 1416878445u, 2032110548u, 1032833386u, 3242268220u, 1341369813u, 1151774065u, 2656563755u, 2390781333u, 493031331u, 1821599525u),
+    SC(3308334431u, 2244225056u, 1498704782u, 3966441582u, 3658105636u, 3540076530u, 155878398u, 2801600504u, 4172181034u, 2042234710u, 1379655980u, 2371110708u, 858298600u, 3009111323u, 3987701868u, 1171429679u),
+    SC(2693735574u, 1388654400u, 1840733261u, 3657576257u, 3074101544u, 296383368u, 1434747061u, 4060328023u, 2744567774u, 2595611097u, 1587194149u, 516940746u, 421362213u, 935644364u, 2220738373u, 792638181u),
+    SC(2480222991u, 3906957222u, 175420239u, 10637734u, 2687951029u, 2310578267u, 3307594941u, 1089877215u, 3390438122u, 284435685u, 1567061239u, 2089277992u, 206435687u, 2098543112u, 4121712139u, 1904445270u),
+    SC(73542604u, 3754604331u, 3897600404u, 526721296u, 1547024403u, 252028150u, 386228114u, 2863996834u, 3646976045u, 837726806u, 3529298501u, 1767592904u, 3900953252u, 1620466316u, 3533390313u, 3620351311u),
+    SC(2737177452u, 2111342041u, 2495240306u, 2167980813u, 263637054u, 3514600840u, 128901254u, 3773800421u, 3026570857u, 924426581u, 835366861u, 3882392087u, 1164602593u, 3344849491u, 1217645927u, 852204535u),
+    SC(592724350u, 425950841u, 1907411079u, 3215312211u, 4090881961u, 2225523014u, 2983332698u, 2129622949u, 2170197793u, 3068842955u, 2991913977u, 2671047689u, 3933470803u, 1022684493u, 560592011u, 703905099u),
+    SC(2637458797u, 4233303887u, 1557820523u, 37228759u, 977303577u, 3721781151u, 721931403u, 3083759562u, 2607595627u, 1680424540u, 2774175737u, 4058580305u, 1243192067u, 3741903289u, 2232595287u, 2541144070u),
+    SC(1942498190u, 3326322615u, 4183752714u, 3737002255u, 3148232884u, 89163108u, 3143250736u, 4249410817u, 4294006425u, 2693291105u, 4264949275u, 2227907546u, 2099957596u, 3742199559u, 1610552169u, 134592020u),
+    SC(2418305493u, 2696074705u, 3482523250u, 2286971797u, 254618047u, 1822593455u, 3383991487u, 4235823816u, 56021009u, 3608966813u, 874739903u, 4239385855u, 3447238107u, 2884153556u, 4200849033u, 532917732u),
+    SC(3866140923u, 973899504u, 1397897979u, 2174454084u, 3695186921u, 4249879409u, 2985288254u, 521209399u, 141103979u, 3440630962u, 360560035u, 3497941487u, 656758752u, 2647336202u, 2616613343u, 638267832u),
+    SC(4093571181u, 1382384102u, 2968948263u, 217816265u, 3045003749u, 2224375292u, 3115138395u, 2315633557u, 850586007u, 340009196u, 3301200246u, 4020632509u, 1460097745u, 78680820u, 4281816388u, 431551827u),
+    SC(1923315299u, 962123844u, 1443873418u, 2361499016u, 4181901468u, 1193094316u, 1892310329u, 963249597u, 3734706958u, 1846677616u, 4135891896u, 1076792717u, 1922885702u, 221215656u, 1346323784u, 1935597997u),
+    SC(951552729u, 3292233199u, 1092207528u, 420273768u, 1098025295u, 2823609058u, 727940056u, 2152923312u, 169350503u, 1817141073u, 2267041559u, 1543451369u, 233294953u, 3699711108u, 601781416u, 3016760943u),
+    SC(3684076232u, 489585747u, 1818688201u, 3784637219u, 1410215561u, 147575727u, 1759598847u, 724858158u, 1297897387u, 2044303147u, 2892712688u, 2788455025u, 68656782u, 4245997417u, 2723043955u, 2863958538u),
+    SC(718149241u, 758795651u, 1896959784u, 3253548466u, 1348326649u, 2546410549u, 2705707879u, 2829767448u, 1393832234u, 610825444u, 3469097863u, 4135974609u, 67481839u, 2712548665u, 3431524159u, 908523045u),
+    SC(853020265u, 205065709u, 3683272192u, 2250713028u, 3139426840u, 627255166u, 2234487727u, 1035657480u, 63428975u, 3934900330u, 1832694776u, 404716763u, 3155967506u, 1033837832u, 3419756457u, 1625062407u),
+    SC(1056218762u, 3892210496u, 1653498274u, 2489168843u, 4055827725u, 3844461857u, 3639125000u, 1995323656u, 1132578652u, 1660182450u, 1296243540u, 3593541039u, 1073163559u, 1489226027u, 3553746440u, 27337714u),
+    SC(2235042005u, 3451399376u, 968169428u, 478730160u, 237506278u, 1508230720u, 1520596290u, 1016537818u, 3244784708u, 2603259430u, 1770677551u, 2171740738u, 1053920515u, 2463375375u, 3034325663u, 1602129758u),
+    SC(1462752387u, 1225524734u, 2239045821u, 2288123083u, 812573939u, 699264841u, 1489099640u, 533223503u, 2192361734u, 272179970u, 3472951232u, 1799053716u, 3549335893u, 3005136032u, 3190816822u, 873723045u),
+    SC(2982914994u, 2594753073u, 1974114861u, 3571013348u, 4202107716u, 3562611841u, 952710531u, 929960838u, 2290925809u, 2140863984u, 1805770243u, 68422081u, 643609334u, 12588540u, 3159937757u, 1713974985u),
+    SC(4166437778u, 1111044404u, 1971365466u, 345665153u, 744265229u, 1728512417u, 1843116952u, 795585312u, 3275035066u, 422314217u, 2568968207u, 1707151839u, 2010764994u, 3587586153u, 3310964753u, 1213425268u),
+    SC(3781172436u, 2000556702u, 738470023u, 3043736379u, 2666369787u, 1813155363u, 268420007u, 4000551438u, 403130568u, 2743891862u, 3995368561u, 1236934604u, 175662220u, 2689633993u, 1867121007u, 806376650u),
+    SC(2565742804u, 1610310007u, 1554122405u, 2966155736u, 3904076971u, 2538116404u, 2844338403u, 914128498u, 771009761u, 3930250065u, 1756061294u, 2298232925u, 2236313824u, 1159838768u, 1769530469u, 1651754512u),
+    SC(1201064535u, 2900267098u, 836566677u, 3202162195u, 1410841665u, 4121739846u, 3960132846u, 3724416927u, 1947464994u, 962213890u, 3010869221u, 2506408505u, 1539663267u, 1178567007u, 2415485601u, 4037240744u),
+    SC(3009923172u, 950907064u, 3585484797u, 1455939487u, 3486864694u, 2596003136u, 113675229u, 439620096u, 3224782660u, 194635798u, 2038625125u, 1915127554u, 3029888245u, 3385160861u, 4246882718u, 781171281u),
+    SC(3677784139u, 1916657359u, 2116175040u, 34465860u, 3879761418u, 1328010118u, 2806510759u, 2291223849u, 2330232780u, 712260156u, 706611024u, 2112818987u, 4277734948u, 4255179700u, 241120051u, 2105139235u),
+    SC(1704400920u, 4145815851u, 2833537057u, 837743865u, 1991537454u, 1819029795u, 3438659232u, 2577602244u, 1096771473u, 892555475u, 990412601u, 326504729u, 1382688817u, 3338892763u, 1288730452u, 3778413787u),
+    SC(4076137274u, 329839794u, 1108879971u, 2548788441u, 2421395519u, 2518291256u, 4240231111u, 1626068570u, 2775963259u, 1719571671u, 548260023u, 1319866044u, 411114303u, 976997230u, 2035337982u, 149920936u),
+    SC(2723052045u, 2690183366u, 858323537u, 4248605311u, 2286632823u, 3422980679u, 3905336531u, 487668297u, 3196958768u, 2041357673u, 2662530623u, 2190940629u, 198108693u, 1683901569u, 2846302511u, 1158608779u),
+    SC(3852090571u, 2011240343u, 2109131826u, 1589467521u, 1109470631u, 1223730360u, 159505266u, 1106226522u, 2833282373u, 4258932328u, 3423211682u, 596222680u, 3599774742u, 2761970329u, 2639015246u, 78119129u),
+    SC(831631971u, 2747730917u, 3200721401u, 1034676681u, 4234943093u, 2863222431u, 229597280u, 4266364722u, 865178316u, 477797319u, 714770372u, 3929848496u, 3350166311u, 1407665297u, 1903894425u, 1576241814u),
+    SC(1675452358u, 83484080u, 2413067815u, 1585683232u, 317982949u, 1007916131u, 2341963599u, 2441544250u, 451954868u, 48805862u, 3562458319u, 3509516271u, 108923152u, 1096950683u, 2230541500u, 2231680410u),
+    SC(177398871u, 3447919340u, 3414631067u, 2138381387u, 773686848u, 3266897345u, 759021387u, 1729875731u, 3618560854u, 1413999453u, 407147073u, 973592178u, 3192302415u, 1029393215u, 1428105518u, 1610327912u),
+    SC(518437232u, 3118505250u, 45223682u, 351275956u, 1200223582u, 1482634682u, 1812846328u, 967902357u, 2089881580u, 4026134261u, 3517171872u, 1176840325u, 2647618491u, 3567301310u, 1066209504u, 3701380194u),
+    SC(2979799993u, 3266058583u, 87199100u, 1137723504u, 448700055u, 807951595u, 3841791577u, 2399577962u, 2041057726u, 3229387632u, 1865944972u, 4264992325u, 3322241148u, 3498871369u, 658879107u, 933462936u),
+    SC(1008786335u, 2664652738u, 2080934133u, 3798377557u, 1329577880u, 3098714134u, 2984881907u, 21973413u, 3141190292u, 1059710522u, 4128276826u, 1243503122u, 2468856245u, 3438578154u, 2106151139u, 1543226581u),
+    SC(4246523322u, 3027529374u, 1156274436u, 221479492u, 4020412412u, 147750932u, 4139328197u, 787104649u, 3775288646u, 1377070992u, 4199695263u, 3292325099u, 1939216978u, 284606528u, 2544377906u, 2592993390u),
+    SC(3809464718u, 2883500198u, 4012191175u, 1009454453u, 2204375593u, 2377349813u, 506306713u, 2607022604u, 1231435378u, 405075073u, 2519452344u, 1729555265u, 2384026921u, 1795069700u, 3485213889u, 685566091u),
+    SC(1271003017u, 652081456u, 3786319748u, 2208947209u, 1557603072u, 89392456u, 3873576935u, 1364974135u, 2523607734u, 2514230016u, 2378955310u, 1934350763u, 920167020u, 710067313u, 1671745485u, 3523267177u),
+    SC(601088635u, 2626046859u, 1089533906u, 1859034052u, 2416245134u, 3563803546u, 2952789665u, 1425028820u, 3192264683u, 4135625340u, 3426829270u, 2887060817u, 3017797563u, 680699591u, 456574868u, 2327883869u),
+    SC(682478544u, 348994416u, 4100852361u, 1199267008u, 1246834833u, 3412859563u, 1457408148u, 1046481344u, 2085201976u, 1965051082u, 955404468u, 1619852876u, 621022663u, 1038962650u, 4104727758u, 4242740737u),
+    SC(2002814136u, 2825848867u, 2768521912u, 1893224288u, 3931303035u, 2772822540u, 3362726303u, 480419080u, 1622916811u, 273207888u, 3020995640u, 1239771099u, 3740365426u, 1482099500u, 3498263858u, 1478254811u),
+    SC(1172254223u, 4247973704u, 2514052731u, 3322169681u, 3822818489u, 3983209979u, 3573423741u, 579806032u, 2805089867u, 445447686u, 1776551790u, 3558230936u, 1306613195u, 1757100436u, 1945991448u, 1676341397u),
+    SC(1761908587u, 1185283359u, 2806775680u, 3298009852u, 2330573800u, 2017263294u, 2137649377u, 3195918314u, 433091000u, 3751613494u, 103029282u, 436253504u, 821157701u, 1583807741u, 1523982766u, 3391897188u),
+    SC(2224916264u, 4185378933u, 2833154140u, 2390792207u, 3760058165u, 518524683u, 4015165061u, 699332185u, 3628684740u, 1820877443u, 3117919661u, 3154550029u, 2151865754u, 3966912255u, 3992130964u, 2925261864u),
+    SC(3822472012u, 591726310u, 243248364u, 2373268652u, 1415089607u, 3932705409u, 3799803718u, 1194154219u, 1244835132u, 3481414276u, 1950645167u, 1756276120u, 296339513u, 1285124335u, 3160535907u, 2925147883u),
+    SC(4095506728u, 1473337905u, 431419698u, 996631450u, 2291693482u, 3911270094u, 209222995u, 1415822250u, 1942998286u, 13126741u, 1291875732u, 355311068u, 1661748622u, 2124699344u, 2093352195u, 2035127080u),
+    SC(3788642119u, 75151436u, 3833219586u, 3404567455u, 235715100u, 1105703453u, 1744121815u, 2031640697u, 397456936u, 2857091235u, 3986106531u, 3796533505u, 4213627494u, 2596876131u, 2944510718u, 2108864104u),
+    SC(2829058442u, 4177029013u, 831117869u, 3576384944u, 1568529227u, 2368277632u, 2510874588u, 3631149528u, 2344181868u, 2226686494u, 3751283838u, 2472575550u, 632891351u, 2628471831u, 4236950141u, 1747341707u),
+    SC(1938015857u, 1860197956u, 3669645248u, 1357634144u, 3839934689u, 1039350004u, 3448595071u, 1936719853u, 1004321094u, 1595296372u, 1670166899u, 4235713199u, 954924360u, 2502020000u, 78481772u, 2391404768u),
+    SC(1643806236u, 2345184407u, 2529059889u, 545620067u, 480471796u, 86035486u, 140048651u, 2906074621u, 1057843048u, 918808212u, 841513225u, 3364101600u, 2784380592u, 2494611975u, 2372093062u, 3286999869u),
+    SC(2248318507u, 3389703681u, 2567515631u, 3477635752u, 3035710281u, 1136595309u, 1018368163u, 2999232320u, 3099496558u, 3448788720u, 4079361279u, 3508672200u, 4015986003u, 3715138688u, 356924285u, 605826940u),
+    SC(3782408165u, 2435490951u, 1486711884u, 3503733163u, 1220847280u, 1606809870u, 795112640u, 1336776140u, 3988595649u, 722079443u, 3097072140u, 3904261501u, 226229625u, 1342816912u, 3926291420u, 145540097u),
+    SC(2038872717u, 841940004u, 2340102827u, 4164476563u, 764615800u, 3446310422u, 3522395582u, 847721620u, 1765714722u, 1282737554u, 832271684u, 220855820u, 606119379u, 3552043038u, 3874212200u, 312555060u),
+    SC(3126411576u, 1249015411u, 1979754200u, 2369171763u, 1074509267u, 1787469126u, 65586780u, 3789554563u, 1953451560u, 3155919147u, 578799955u, 1393580223u, 3653666117u, 794958269u, 2256117183u, 1009575255u),
+    SC(1174356425u, 2463543575u, 3362712439u, 3138877599u, 1811508439u, 753977017u, 2150299753u, 541551759u, 2468672959u, 1680008110u, 537971169u, 40986584u, 1330785926u, 2281477579u, 3963447666u, 537048479u),
+    SC(3134692917u, 1215974816u, 1903280770u, 3899027156u, 3490426276u, 3646384765u, 2593385667u, 3245266575u, 423197230u, 4021388452u, 832581138u, 2447051988u, 1528116503u, 2419632416u, 2053984476u, 2021349330u),
+    SC(3724419335u, 763917804u, 1623512451u, 1500863484u, 584026381u, 3546700665u, 3483632572u, 2654767681u, 3324762391u, 1226640010u, 2450876236u, 683837554u, 2378042687u, 2277576080u, 3458381320u, 1195336423u),
+    SC(2455726675u, 3229585983u, 2525809375u, 3204045148u, 3612951145u, 2748971620u, 2971143899u, 1719579289u, 276883711u, 33102054u, 1862840939u, 2140991048u, 1492123704u, 3100266679u, 2996017504u, 2984738972u),
+    SC(3264104925u, 2808021635u, 954585799u, 3522181872u, 309758928u, 1796082957u, 2273807272u, 656465280u, 1729071497u, 3376522395u, 3427871835u, 1233641831u, 3965380276u, 3623258776u, 857228715u, 1561178411u),
+    SC(128517438u, 2500025320u, 2173223318u, 3588808794u, 2988289608u, 3583248115u, 2074052298u, 746814651u, 1089341582u, 2390135991u, 2571597031u, 2634644854u, 1843406582u, 4160480082u, 3891445007u, 1144684060u),
+    SC(867137770u, 3216703685u, 1300819841u, 3915782934u, 3769838725u, 2713066389u, 1818917373u, 235104930u, 1899920047u, 87533462u, 3302463044u, 210066699u, 355670408u, 99567145u, 3624176745u, 3553612736u),
+    SC(3314077716u, 1514093875u, 694769011u, 2530636995u, 321314724u, 127391293u, 4188063520u, 1230519248u, 3049312209u, 1818742189u, 2880154255u, 3486698870u, 2138337316u, 2360303831u, 928193638u, 2891173370u),
+    SC(2528368109u, 3107406534u, 2085154578u, 3326686235u, 2535604002u, 521067866u, 791328035u, 2151207582u, 3678887082u, 950247517u, 924426982u, 1290253549u, 3206938199u, 1260967594u, 2573331468u, 2967751758u),
+    SC(1093618542u, 1032408806u, 4211912715u, 342239900u, 518666818u, 1512597378u, 2788009855u, 1447358663u, 2823747126u, 2879113221u, 3221088275u, 2475115561u, 2823831177u, 2349068758u, 4047089542u, 4138104574u),
+    SC(636528517u, 3350474792u, 1391542813u, 2737586573u, 855506372u, 2311295049u, 932504058u, 3830854226u, 4025157901u, 1165070517u, 2311672739u, 2931749894u, 3664866037u, 499573556u, 2686609539u, 1610933436u),
+    SC(1358777015u, 4083677940u, 2897494074u, 1240088191u, 4029672792u, 1126673661u, 3770505380u, 3983809647u, 2024522151u, 1016974664u, 1696648018u, 182131770u, 755542991u, 2692309118u, 2774730694u, 1028054367u),
+    SC(360022996u, 3484385145u, 867760742u, 1125060734u, 3277283871u, 1268052755u, 3150954193u, 74073978u, 2594615861u, 3465335294u, 1624064853u, 3295496281u, 4264947085u, 1704798895u, 4228500970u, 696159669u),
+    SC(1011137378u, 1562781187u, 3830120385u, 1706252662u, 4075671263u, 2347152532u, 4105419850u, 1530069182u, 2293351777u, 1737964216u, 1590510996u, 2421784914u, 519104711u, 536283065u, 127845055u, 1018963253u),
+    SC(835987021u, 3781192599u, 4076281113u, 871513284u, 2412108230u, 3767000467u, 1591892879u, 3123284312u, 1174800832u, 2745834790u, 677713932u, 2555730840u, 3370393014u, 778220228u, 1256198544u, 1904366027u),
+    SC(525672202u, 2414954276u, 1621827693u, 1036092235u, 892149021u, 2158558072u, 2826061742u, 1560522031u, 606419974u, 2764616008u, 3683929985u, 2150362676u, 4240014006u, 1351973682u, 3972965182u, 3239487203u),
+    SC(3727445533u, 670073863u, 825443089u, 2683676868u, 543825779u, 716096424u, 2058054581u, 3251581758u, 3699456929u, 1090440506u, 838814350u, 1106921869u, 2452015658u, 3408747121u, 3315978210u, 2174031629u),
+    SC(1876712882u, 2918533832u, 321669666u, 3280126704u, 3254078417u, 2330809888u, 2773206209u, 413750802u, 3678381285u, 4078496077u, 3233878099u, 1641158211u, 3479220426u, 2799455526u, 2488174869u, 2534285854u),
+    SC(3354097350u, 3926793297u, 2746132212u, 3716069904u, 3145098509u, 140374268u, 2144828275u, 1399326211u, 1524744663u, 3079145770u, 63183933u, 2076389106u, 172968505u, 2821411808u, 3874780946u, 3747346005u),
+    SC(3356820898u, 3085405019u, 1691223182u, 1662173114u, 441632695u, 2182731863u, 3028368024u, 3366619629u, 1188767810u, 1835852305u, 1579043262u, 1168048957u, 3257056895u, 2528266234u, 2278940608u, 3741935622u),
+    SC(3403108949u, 368690133u, 2265317133u, 2209101064u, 4158571282u, 198996425u, 169339806u, 2018524152u, 850618882u, 1993333655u, 3973242311u, 1670270305u, 102964197u, 632730821u, 756662572u, 1852561177u),
+    SC(2496799044u, 3794501168u, 1458350244u, 2104169944u, 4051647589u, 2186493867u, 3339620365u, 3192708389u, 314603021u, 1609510789u, 3634232253u, 3170968779u, 2190210861u, 2041884255u, 1629595725u, 1205419001u),
+    SC(844913699u, 4009779231u, 3723829312u, 1998700002u, 332112287u, 3237143077u, 990981003u, 2439459235u, 1507052440u, 3231454787u, 2571058643u, 105676073u, 1555270834u, 1171846926u, 2519262702u, 3592722656u),
+    SC(2626711689u, 1414234902u, 1243944214u, 2176712102u, 2098754616u, 1048529532u, 3667318881u, 2448302872u, 4130987751u, 3875604016u, 910506475u, 1545752665u, 1416697822u, 2680047889u, 3648097903u, 2205340173u),
+    SC(888227847u, 3991519340u, 1286775256u, 2544171905u, 3965011164u, 3938566080u, 4079982645u, 808155778u, 2017688204u, 3966411304u, 4126246931u, 2794184296u, 1012188007u, 1567351938u, 2365715108u, 158178391u),
+    SC(2493043467u, 1057490984u, 3762111898u, 4239925213u, 1225476095u, 204754293u, 948418048u, 372865163u, 2052883205u, 3111829054u, 2990629501u, 3306715804u, 1735943603u, 1451031854u, 3457378386u, 3827639031u),
+    SC(3953168239u, 4023610935u, 2857626674u, 3553556622u, 1565472511u, 3954800840u, 1993626357u, 2002055718u, 4262356661u, 1135236298u, 2063511017u, 3012345355u, 971075960u, 1292014704u, 1619820088u, 3172996545u),
+    SC(1432177602u, 198317865u, 4128349047u, 2928450510u, 3371125181u, 2569854544u, 1283015812u, 1916799259u, 3436101048u, 1766989363u, 749234497u, 1497281703u, 1821397759u, 2773451541u, 3540064716u, 2135128916u),
+    SC(863148956u, 433730676u, 1123235891u, 3513924933u, 1060135148u, 3331512355u, 1738475643u, 268339314u, 2840291919u, 674952708u, 3951580165u, 1811644484u, 4207079431u, 3622553600u, 3031160396u, 1546976304u),
+    SC(706381983u, 2951104120u, 1685784074u, 1940624079u, 2014465760u, 3561782322u, 3635287520u, 233954321u, 1651480125u, 1005657998u, 1751884907u, 3873160974u, 1974182096u, 2130252312u, 2556452851u, 4236998104u),
+    SC(1191347532u, 2734941948u, 4291178352u, 629912309u, 1670465715u, 1312368639u, 4074490635u, 2082045295u, 2107793842u, 2232624508u, 3511114797u, 3763943214u, 765947571u, 255536209u, 2512667719u, 3609071958u),
+    SC(1879240133u, 2697733024u, 1694588078u, 115646075u, 1373179133u, 2107657731u, 1213711766u, 3442580571u, 1864910269u, 112699992u, 2060636846u, 436035861u, 2026142550u, 2231134581u, 3680756272u, 3285939131u),
+    SC(657626324u, 1211982093u, 2987826949u, 1909802255u, 4107033544u, 1918733030u, 2082135819u, 1867043973u, 2578596258u, 268356064u, 2688131075u, 404986530u, 2803776705u, 486258387u, 1919453003u, 1742291633u),
+    SC(468504450u, 810923072u, 4208093779u, 1518676573u, 118540074u, 3302133379u, 2956156559u, 3918305897u, 255505766u, 2886659616u, 2089607332u, 222764716u, 744339222u, 1579463817u, 3808288831u, 2072702204u),
+    SC(3689213647u, 1325612371u, 1570020526u, 3372115756u, 2710577955u, 2005475735u, 4209566098u, 1393721696u, 3019180999u, 2457800283u, 1445207154u, 613814213u, 2305804294u, 470452767u, 1607718012u, 3584710255u),
+    SC(1715731573u, 3201829993u, 1167165562u, 1573221375u, 3405247620u, 2964203057u, 322883402u, 968695328u, 74453637u, 4155276435u, 3133245279u, 3695847139u, 2395072156u, 691813242u, 529226847u, 2274187493u),
+    SC(2583235550u, 3474836830u, 118850176u, 1408770279u, 4011448630u, 3165011732u, 1365459710u, 88222241u, 2689465648u, 1845256539u, 87624326u, 2347494102u, 1560114969u, 871964202u, 403516793u, 3114063101u),
+    SC(1424477768u, 830781438u, 1174097461u, 422270584u, 3170312062u, 77333310u, 2865880370u, 2263036979u, 3401745211u, 1706728631u, 2208872540u, 3086279906u, 1297057094u, 1013591100u, 1307372680u, 348186863u),
+    SC(3481684559u, 4217411902u, 1146048123u, 2404030835u, 1191553558u, 693512147u, 527861432u, 1274031624u, 2056835599u, 3073829709u, 1180547188u, 3466116593u, 1804212561u, 2000988753u, 2938596476u, 3681491934u),
+    SC(1878089942u, 1366294417u, 1524813125u, 2056826850u, 2723582789u, 101351206u, 3386929682u, 1834602926u, 1562317653u, 3205763244u, 3841504277u, 890215541u, 2109068781u, 2045150u, 2952118679u, 3035552842u),
+    SC(162380386u, 2935826064u, 494400162u, 3324542377u, 2775573339u, 922933830u, 4063362636u, 2673736905u, 3126389829u, 3410638235u, 7415471u, 4247538653u, 779128131u, 1104768638u, 1210446163u, 2880455009u),
+    SC(542024734u, 3151813704u, 3444484421u, 1925254654u, 3050897504u, 3923572182u, 1388372650u, 346177581u, 2066254252u, 2710908732u, 2999311242u, 2569316090u, 4211842610u, 1052809225u, 2023716875u, 2889264696u),
+    SC(4158047849u, 911028500u, 576350246u, 3255641786u, 2763321744u, 3896666474u, 2192232087u, 1606990370u, 363573623u, 3022338245u, 6803808u, 3409737243u, 536116468u, 1259126038u, 922122844u, 2275226736u),
+    SC(2076496650u, 2279418055u, 2332454400u, 3224097313u, 3842670180u, 1169522445u, 3410390823u, 2100635015u, 4109191252u, 780009828u, 3664175305u, 4239411742u, 1861994945u, 543905070u, 3331107734u, 3502413012u),
+    SC(1430529412u, 2957426406u, 3259359161u, 1509033513u, 3254840097u, 3022326231u, 2237961275u, 506556145u, 774547825u, 3356565209u, 1717974330u, 272576078u, 2728149346u, 3516768896u, 2421174697u, 1213730178u),
+    SC(2390620352u, 3733491774u, 1898073239u, 982296154u, 153352306u, 2216635852u, 3168181860u, 2984042987u, 3826593923u, 2598923601u, 3876878451u, 4059801819u, 3272738274u, 885605986u, 1387152321u, 634560716u),
+    SC(1730355676u, 1775807000u, 626433286u, 1710940281u, 3091897289u, 901620881u, 1565814609u, 3327254159u, 2329297675u, 2265483645u, 3196099249u, 2151313134u, 4185371121u, 1798619528u, 3543389942u, 3891200095u),
+    SC(4108499905u, 1139383040u, 1375938328u, 677213848u, 462154650u, 4136885244u, 757134450u, 2309765820u, 3846803701u, 3694333611u, 779234175u, 1892500079u, 1837164862u, 543079049u, 2125197489u, 1566906922u),
+    SC(1520675423u, 3335660940u, 2424074869u, 2153518602u, 1919504198u, 1801444056u, 9516273u, 221904895u, 584524144u, 1635692453u, 3091458091u, 1600588994u, 826714776u, 3406259274u, 2135688704u, 1223333169u),
+    SC(880095225u, 3535751578u, 3333663933u, 460874556u, 2660905450u, 1170424707u, 3191779336u, 2078468079u, 3040781172u, 754178182u, 1375195254u, 1063766203u, 970407081u, 2198257373u, 2443631431u, 739312888u),
+    SC(3595576868u, 48907511u, 228281499u, 1349116357u, 2291626082u, 3677072747u, 1366512486u, 654603047u, 1391839642u, 4075989182u, 3224689471u, 3044242814u, 3623961377u, 2262510632u, 2356236796u, 1253142317u),
+    SC(1387507398u, 1430061663u, 3513032928u, 2985532093u, 152425641u, 3982340780u, 3025746992u, 18828489u, 1364489218u, 471315131u, 2638222979u, 2468029911u, 2007963836u, 3773283234u, 1126856471u, 4108515529u),
+    SC(2361091966u, 4153905700u, 309494808u, 1756863506u, 3936414830u, 3125779223u, 1301894270u, 2189359562u, 2737310136u, 2961052434u, 3064204998u, 1092313278u, 2459389848u, 3220033049u, 2925072280u, 67208178u),
+    SC(3639959008u, 3807310205u, 3914012004u, 3611767993u, 1066005206u, 3273105992u, 2132223203u, 3576812667u, 3925690101u, 3663160176u, 3762384753u, 4067550796u, 4202546764u, 1577609520u, 86239532u, 2595739504u),
+    SC(4201630139u, 4204966687u, 4191515393u, 1198986911u, 2765994221u, 3981159289u, 3505704802u, 896233435u, 3070187469u, 3755833612u, 2062537188u, 3568374232u, 1134734799u, 2675448627u, 457449696u, 257414292u),
+    SC(597623436u, 3880316377u, 1777816281u, 2880242840u, 4181037079u, 1698589414u, 3147034781u, 1639288474u, 400555703u, 2284975802u, 2074370999u, 3145405485u, 3579611810u, 2445127548u, 105179372u, 351843606u),
+    SC(787926011u, 1921881967u, 2579963312u, 1401535396u, 3970776084u, 2401605565u, 2578419572u, 2522763067u, 430078887u, 2743207820u, 1058979468u, 496214907u, 3740202306u, 3474408051u, 3021059599u, 2041642240u),
+    SC(2536338219u, 2599956830u, 2297447153u, 863471390u, 440570439u, 3629347894u, 2562291161u, 856050190u, 813781946u, 3125558151u, 1084457214u, 3837574050u, 2780999231u, 637395412u, 4094358747u, 2857357963u),
+    SC(1027050292u, 3125385457u, 2201658005u, 408163518u, 3884498157u, 2940350163u, 1011820359u, 1845897804u, 1185174940u, 2451044633u, 2156428112u, 704076801u, 1010651704u, 3547693424u, 2481824168u, 4072982691u),
+    SC(4222746683u, 532788138u, 4247958153u, 2883826530u, 2973593842u, 2103726563u, 1992263725u, 962343047u, 2546493093u, 3294770730u, 1290507963u, 2618809091u, 4069415709u, 1312918145u, 1698312540u, 81779389u),
+    SC(42969422u, 2397745658u, 12396457u, 630073028u, 694091191u, 2947916926u, 1846861455u, 2272920689u, 4150369546u, 4075743475u, 3234313698u, 147758351u, 1646401817u, 1293378213u, 1363519753u, 164770422u),
+    SC(1191748229u, 2126102805u, 1902280414u, 1873346089u, 1273131571u, 142184229u, 3240937998u, 4180708073u, 4083128676u, 779565456u, 3001068384u, 445828950u, 2235577446u, 142249013u, 1357081489u, 3394217033u),
+    SC(2470477975u, 1878308980u, 3632858076u, 3016682862u, 2820941771u, 917908586u, 1667560184u, 2554897967u, 3797576034u, 3571607396u, 2595411198u, 168537079u, 3673574728u, 2562482350u, 4282186595u, 3915332719u),
+    SC(4104399776u, 2172781002u, 3810090409u, 978740771u, 2651661533u, 627883180u, 60136892u, 1913511834u, 2412933068u, 199487472u, 1976669359u, 3879277189u, 280841358u, 1915812202u, 1627203552u, 167776134u),
+    SC(3316491798u, 3864776000u, 217292534u, 427690647u, 2031922415u, 3021670801u, 2622599526u, 3819316236u, 3838205288u, 4265723437u, 3361409842u, 957377257u, 3425073274u, 1624461728u, 1248856231u, 4184783043u),
+    SC(2082029251u, 3555842331u, 3419915822u, 1348576677u, 3903978056u, 1443955386u, 3391807744u, 2160476391u, 3430742165u, 1360267507u, 3825270577u, 145045125u, 62447720u, 491467578u, 649436333u, 2542222541u),
+    SC(2002003267u, 2390552872u, 840324649u, 1047141401u, 582443861u, 516364017u, 3646948016u, 2904282051u, 927405725u, 556545982u, 419884738u, 143002361u, 3992443186u, 12683204u, 3736860672u, 2345800575u),
+    SC(2463978393u, 4202030982u, 4200337279u, 2427179432u, 3142123331u, 3847072858u, 999919862u, 668535186u, 1555152526u, 4181165024u, 3269838884u, 2892780360u, 3997774385u, 2570250660u, 115689761u, 1058125754u),
+    SC(3245803560u, 1183771536u, 280318035u, 710094816u, 1332144039u, 3080833847u, 1857478127u, 3599963517u, 228942909u, 2685697351u, 4247380578u, 4128957602u, 118382234u, 2007460802u, 3538408010u, 2174365201u),
+    SC(326295830u, 3909805346u, 1179231540u, 286495485u, 2830805989u, 3196750549u, 869260748u, 2942531784u, 1593562274u, 1767339451u, 3694707370u, 4175064901u, 487202035u, 734364886u, 3920803557u, 3358878457u),
+    SC(733868574u, 2678170290u, 3168083977u, 2133889693u, 98744314u, 3775106048u, 2402474090u, 1709025590u, 1370982808u, 1611185628u, 1634471373u, 713569121u, 403106764u, 1480832588u, 2964980425u, 865945068u),
+    SC(912870564u, 3494469335u, 2015563081u, 3874624023u, 2607008892u, 653148031u, 1786001597u, 1966081505u, 776594419u, 3151802675u, 1072816509u, 2978828903u, 2826913974u, 2511730951u, 1599774929u, 1891371768u),
+    SC(608011441u, 3701268803u, 2794535928u, 3510389423u, 1874596723u, 1807263720u, 1583647064u, 52433848u, 59971501u, 3065956125u, 4293116636u, 1844207120u, 564387203u, 771746705u, 277527899u, 1853827263u),
+    SC(495485831u, 1381364726u, 2207165314u, 437430526u, 195485662u, 4052768861u, 3761853483u, 764538002u, 2849213410u, 3910793237u, 1566782776u, 3538988787u, 2630532525u, 3688436412u, 1187119999u, 858043529u),
+    SC(966926197u, 1275933558u, 4149612074u, 2806215965u, 1427297832u, 2051541333u, 1683421612u, 2982033253u, 1022567589u, 713021342u, 1002539204u, 3579556937u, 4014559409u, 977613245u, 3769821853u, 1077272581u),
+    SC(2702177804u, 3638713842u, 2714997929u, 1388740461u, 413862431u, 2774886889u, 1222190990u, 3022922184u, 3026136419u, 1021849336u, 499171517u, 1334383731u, 2315070261u, 4029461047u, 3218404610u, 234482065u),
+    SC(3156645778u, 223363831u, 273807270u, 1186558457u, 3145734861u, 3693388466u, 1539065246u, 3082599601u, 3070510588u, 469966945u, 1638929712u, 3374341502u, 3355096798u, 495186420u, 2025020375u, 1898141285u),
+    SC(1030912510u, 4250547842u, 2821357461u, 3520808002u, 1594815560u, 4139568553u, 2590097984u, 2419575701u, 3746703050u, 3862322046u, 582233290u, 732055885u, 2586747283u, 215556450u, 770072623u, 1880463168u),
+    SC(3771034928u, 4019367680u, 3107373757u, 2501590353u, 3158547152u, 3827396143u, 3578970837u, 3906725256u, 3267172221u, 44522564u, 1088147846u, 661035535u, 4082207175u, 2760326671u, 105401147u, 1750425582u),
+    SC(2616811749u, 729530194u, 4253259824u, 1665904412u, 4040614706u, 1114815509u, 3650722530u, 2020815195u, 187199901u, 551558604u, 2952883377u, 1782921017u, 1427661559u, 3654058441u, 107357063u, 495780869u),
+    SC(551491947u, 3859523354u, 3860309681u, 1148550670u, 2281700165u, 3561478620u, 223641760u, 875893144u, 2624728387u, 202180379u, 2692565331u, 2597366698u, 4046168920u, 1123999918u, 2573258271u, 652937176u),
+    SC(138658102u, 34124811u, 2488887613u, 135612800u, 1163550577u, 599127603u, 170288669u, 3399199767u, 3585457549u, 2425748544u, 3536945677u, 836478274u, 3502722851u, 2255949534u, 3384074054u, 4075888760u),
+    SC(2433332447u, 1881939616u, 3735350796u, 2873546479u, 1888108491u, 1928977411u, 3764111138u, 1082986912u, 1975165633u, 2347073564u, 3039908245u, 1277964324u, 1934158279u, 2436608578u, 3478047883u, 2531020922u),
+    SC(4044149237u, 3378555323u, 313392899u, 3255027101u, 2387694894u, 925363634u, 849276732u, 1502679356u, 2823473377u, 1868946086u, 374818441u, 2414765612u, 2637038534u, 1201018139u, 2403273713u, 1586251354u),
+    SC(2668065084u, 4292042799u, 2902948713u, 2829448505u, 182507216u, 3747133959u, 514844333u, 283592616u, 2919024755u, 1119195267u, 3452163893u, 2016382657u, 3417631290u, 1469516542u, 1489854044u, 2414773883u),
+    SC(1830657294u, 848320308u, 330479728u, 4294481804u, 1558834284u, 2971720179u, 1678127938u, 3449126938u, 1695278248u, 2513679874u, 1299472252u, 599514339u, 631502231u, 2452508911u, 3121958796u, 1748042127u),
+    SC(1232176549u, 1799015572u, 2049407260u, 2116006217u, 1550098329u, 3698753447u, 310512838u, 1826405762u, 2102467452u, 299557297u, 2118154418u, 4269106592u, 4080854463u, 1947737149u, 4122388817u, 266753676u),
+    SC(4294392057u, 2223958940u, 1306233799u, 1389201345u, 2587228094u, 346321058u, 3272953843u, 269120575u, 275483221u, 3448847511u, 1988328668u, 4099692704u, 555456410u, 386424309u, 2078274419u, 791427308u),
+    SC(839094692u, 2369078987u, 1147570026u, 936771605u, 1099538164u, 1576832568u, 3434676763u, 2551924784u, 1190539312u, 3025507345u, 3879924483u, 628128587u, 603598205u, 3862134799u, 164041221u, 1716629762u),
+    SC(3192180288u, 2837833869u, 647200639u, 3076726552u, 1434947846u, 304616441u, 2918280704u, 1569062558u, 391491047u, 3526258118u, 2120746708u, 3208951522u, 3395897546u, 2587986067u, 618332774u, 728636868u),
+    SC(2369717937u, 1490933257u, 4164617521u, 1181729443u, 3664422923u, 1127912157u, 4004643893u, 3476282798u, 760564377u, 4024324411u, 3098994164u, 3688032578u, 4056983105u, 2562973484u, 1282699357u, 1261940579u),
+    SC(4162103196u, 4065916243u, 626793651u, 2689924288u, 3502710132u, 1949001255u, 554608710u, 2438555433u, 18480277u, 3192435890u, 600312898u, 4246682949u, 41012874u, 3991634652u, 830553973u, 2737669757u),
+    SC(2515074374u, 473428443u, 1571171323u, 3995783941u, 3615381499u, 4019289800u, 278815781u, 3913481056u, 3720514334u, 3755724193u, 2858077745u, 1622431929u, 3553997310u, 812338441u, 2687512618u, 149085075u),
+    SC(3227862012u, 1205962774u, 3161589252u, 3485599782u, 1867406528u, 4097237321u, 3805982952u, 2811764343u, 570885221u, 4087654338u, 288653722u, 3247754397u, 672683057u, 401367886u, 3865266225u, 2533495873u),
+    SC(1233377627u, 924233466u, 1242878230u, 3186459873u, 265662544u, 3177185738u, 2730061958u, 3033908878u, 326320749u, 2733624596u, 859654076u, 3956522748u, 4125493670u, 1873550082u, 2160963116u, 133210745u),
+    SC(2730319046u, 2464697239u, 1000525065u, 635471119u, 2910868717u, 3870768886u, 534563160u, 1051715243u, 3433490314u, 4178844446u, 1633222939u, 2583167565u, 869848983u, 2543168078u, 1326131047u, 3869625899u),
+    SC(1640600113u, 2710523507u, 2500289153u, 3009925252u, 3103281702u, 823634784u, 3211365711u, 1802335258u, 2184268695u, 2659130672u, 1686509065u, 168345625u, 2944953776u, 1741986089u, 2637432852u, 1852620773u),
+    SC(1247465455u, 851792537u, 980489468u, 2031301146u, 3557239343u, 1819004343u, 1054215165u, 1790132996u, 120150569u, 3228064178u, 1774165801u, 1689415103u, 20070025u, 1258267866u, 2673979478u, 2584478665u),
+    SC(3762714453u, 2255440204u, 725015734u, 3328101062u, 1615745043u, 1108782408u, 2102352744u, 3145678883u, 3735880645u, 2538469915u, 4113758549u, 2187430317u, 2928957813u, 686612521u, 3655705644u, 817051315u),
+    SC(1752162053u, 3374735327u, 1532283508u, 3048333873u, 3303587424u, 545539478u, 1088163115u, 3139526311u, 4107550236u, 3992566132u, 183473422u, 3220399995u, 3375834098u, 3314554640u, 3059097171u, 3581847514u),
+    SC(306669957u, 16364044u, 3932338135u, 2967039279u, 3804027172u, 3522256057u, 4242926779u, 2345800275u, 3544415411u, 2660257734u, 1135063894u, 3023608843u, 1058623730u, 1138587714u, 3811434861u, 726802436u),
+    SC(1701567724u, 2592590258u, 3853722257u, 10446203u, 3052084766u, 3539628622u, 1161330726u, 718371611u, 3346304268u, 1203168503u, 4131352651u, 1071384831u, 215992368u, 3514572049u, 1789123810u, 4180649549u),
+    SC(1535078670u, 259134994u, 212310820u, 1211952402u, 2050834494u, 1626062924u, 988539798u, 3028542645u, 458315687u, 4033383150u, 1665242856u, 3730480876u, 299584370u, 3180771435u, 1771008644u, 3216015488u),
+    SC(3217712848u, 1428924149u, 1469431576u, 1090063749u, 625287485u, 2178076138u, 3163372804u, 2716251354u, 1225830604u, 688734807u, 3226224184u, 818625040u, 573588384u, 3185411728u, 2226576666u, 4050996853u),
+    SC(1715447439u, 3080571838u, 1201207535u, 542620948u, 340246811u, 3469150500u, 2136367154u, 2286513942u, 986590970u, 524008739u, 3632617866u, 2446455840u, 2753927074u, 2872113489u, 4071783078u, 2210666374u),
+    SC(667738931u, 2319300850u, 535768966u, 3991308837u, 2081846702u, 135065604u, 1619390942u, 1230783265u, 1901510028u, 2343298162u, 3943975424u, 641552351u, 2062526111u, 3660225577u, 1259776043u, 617837486u),
+    SC(3566995140u, 1391221769u, 3190264846u, 331707887u, 3072835147u, 470715619u, 1520811085u, 1690146144u, 744830232u, 2996310026u, 1923507305u, 4188026421u, 1568331657u, 1416491970u, 4111946296u, 3884783792u),
+    SC(1767932030u, 3171057702u, 3553545509u, 336411606u, 1031533821u, 279957801u, 3483375607u, 1414189194u, 2810512463u, 683604711u, 729593158u, 1541041119u, 1872388995u, 2862268236u, 4156222144u, 2450422908u),
+    SC(2206383926u, 1421228657u, 2746702526u, 3126320046u, 4237452229u, 1515518625u, 3991622437u, 1039727265u, 3764304348u, 3273247571u, 1147263526u, 2519164446u, 3701206845u, 2488755932u, 3067149553u, 139046929u),
+    SC(2151388025u, 820807534u, 2026425513u, 4203949858u, 3085370778u, 4127537050u, 3427115985u, 1253097467u, 2108830748u, 1375916482u, 3338586064u, 3079050353u, 3415265757u, 399315282u, 3039490118u, 1441102095u),
+    SC(3410866473u, 179744415u, 286679028u, 4148144898u, 3413703438u, 2305064456u, 4187535889u, 3536136492u, 214626202u, 393623627u, 3047688918u, 1538483966u, 1952195592u, 3612667550u, 4128588168u, 3620850114u),
+    SC(4206004055u, 1357510258u, 943242890u, 4228321223u, 2413211515u, 2227787674u, 2819959501u, 3973125538u, 3584024616u, 2311935533u, 1402459064u, 988304131u, 1984882993u, 3653690517u, 1815155856u, 3233017957u),
+    SC(3716652730u, 4168150589u, 258883331u, 1619213842u, 4225729612u, 3601184620u, 427828357u, 1716108225u, 3887793347u, 2845465617u, 3715773004u, 492213960u, 2957091114u, 3332716791u, 815034732u, 2571355482u),
+    SC(2057613246u, 699427358u, 3667073493u, 1918315283u, 502697844u, 459246990u, 3490499588u, 2163736942u, 368548511u, 3078325639u, 2130895809u, 839039346u, 1111478285u, 2474380589u, 3386460951u, 1409184048u)
+};
+#ifdef USE_ENDOMORPHISM
+static const secp256k1_ge_storage secp256k1_ecmult_static_pre_g_128[1024] = {
+    SC(2406005202u, 4131086131u, 2453258669u, 2552174126u, 3901511288u, 1916707637u, 461063244u, 2663694554u, 1714069293u, 3120970118u, 3726479554u, 3065913693u, 3152686334u, 2505116669u, 4064067449u, 1344274306u),
+    SC(943201726u, 777035554u, 2343121763u, 4064616200u, 4253310131u, 1373197502u, 417511661u, 3526887930u, 3835899146u, 263788508u, 2962490789u, 1376694732u, 914488523u, 853078605u, 3178263832u, 857730386u),
+    SC(1227237156u, 3828820710u, 4136770434u, 2856753569u, 4052135589u, 1074931248u, 1050945096u, 2546115344u, 322430835u, 3165105145u, 1512897110u, 2534682683u, 1830172178u, 2808084686u, 205633153u, 1579671248u),
+    SC(3808843404u, 438570128u, 3588379571u, 3833062136u, 1305221718u, 4278639501u, 327463033u, 3468504369u, 246181859u, 2022916704u, 2291084048u, 2138901942u, 4290543682u, 3191289894u, 1764442243u, 2455006788u),
+    SC(1000214542u, 606654204u, 656084598u, 603706931u, 1961621721u, 2863930841u, 3308307358u, 909194928u, 4210792469u, 756464497u, 3742708715u, 2403818278u, 2729322659u, 986914689u, 2503917935u, 1826339978u),
+    SC(3138039113u, 1898629545u, 729205376u, 4125023991u, 399116136u, 2164768494u, 2517168199u, 793271615u, 3932789843u, 3313718393u, 2395807775u, 1922554420u, 2304400122u, 828836863u, 3885208144u, 1017313653u),
+    SC(2030635720u, 3840867520u, 3572034329u, 2063466771u, 3789917005u, 2953913310u, 1257165626u, 913411529u, 3937104427u, 2442156943u, 332928715u, 3449465430u, 3711348663u, 195625099u, 2519933617u, 486205381u),
+    SC(3883696557u, 3925441365u, 470014908u, 3846814310u, 2379685351u, 3447151314u, 2724817228u, 2137049041u, 986649720u, 4009235233u, 3321641778u, 1051202883u, 1662284023u, 472483539u, 1321566706u, 2195137609u),
+    SC(3727383785u, 3687731484u, 4074276750u, 1038976972u, 1029914030u, 2731823937u, 1344254884u, 1439495856u, 4043667187u, 3552829665u, 3153532905u, 2333751108u, 1706607706u, 3328383163u, 880975543u, 286262886u),
+    SC(3497778687u, 3566314238u, 514170813u, 2081559063u, 694525093u, 3729155467u, 649152011u, 331365462u, 2997700360u, 3443300317u, 261898466u, 2715682005u, 1641636863u, 2361585319u, 1810101772u, 725638375u),
+    SC(2185248380u, 1563432623u, 929426508u, 963438817u, 260940892u, 1129022039u, 284011329u, 3144306001u, 218719771u, 3799824231u, 1146534621u, 3018342481u, 2578148556u, 1321630747u, 300494509u, 2068200217u),
+    SC(3940299057u, 4225115893u, 641706584u, 3301635289u, 2467271485u, 2504114751u, 1133294726u, 1963360463u, 3553195953u, 3384060055u, 1550103404u, 2536332545u, 2743663517u, 3279493748u, 906579953u, 747088148u),
+    SC(956558943u, 1733885732u, 3306726579u, 2255785807u, 918410844u, 3078518956u, 1621043465u, 4235823065u, 244455758u, 2706522582u, 1083267380u, 3173205833u, 2367826456u, 1227335898u, 2966413998u, 405530683u),
+    SC(3498064760u, 967526563u, 2222308812u, 4188664345u, 1465500483u, 3686764179u, 602011778u, 1541842393u, 751022464u, 4280928638u, 2704195935u, 3012276132u, 82636908u, 3843890468u, 680831270u, 1683500811u),
+    SC(525791382u, 2978641049u, 2706613678u, 2901982725u, 2224479523u, 3666766873u, 559294715u, 3226894032u, 4277283722u, 995292304u, 2197832758u, 191221097u, 3376515572u, 445890773u, 532757684u, 933101400u),
+    SC(496986545u, 2762241074u, 3817272613u, 37005872u, 2045331407u, 3474993815u, 1309655131u, 1670259003u, 3633900567u, 2493253473u, 3011838147u, 2729564708u, 1413010867u, 3556177696u, 1106337134u, 3839151291u),
+    SC(19450131u, 1302186872u, 318522209u, 96893648u, 1428239188u, 3699378353u, 2931141084u, 4217544445u, 4276348234u, 3709150736u, 3648149814u, 10081890u, 3244345572u, 3966727908u, 1609832472u, 199654550u),
+    SC(569114927u, 1519761741u, 608931153u, 2538997596u, 807348308u, 2385269244u, 1237378009u, 219846277u, 770646277u, 2007976319u, 1283452785u, 1766453902u, 1947790758u, 4250911074u, 3509116441u, 1021184174u),
+    SC(1754223106u, 4221406144u, 2655522441u, 1283259508u, 1981561831u, 2108666140u, 1480730678u, 1043537093u, 2528804185u, 1672823207u, 784845501u, 2453681204u, 439959215u, 2314124692u, 1658438168u, 3341823187u),
+    SC(4217151210u, 481929461u, 3006352432u, 10816821u, 121950447u, 244039528u, 776813236u, 4159712175u, 704350276u, 3784295761u, 4213751078u, 2512775516u, 1751703756u, 2119330544u, 2434104989u, 4217570328u),
+    SC(4048003042u, 787328575u, 794782301u, 2225724957u, 1496410348u, 2068985869u, 3769852508u, 3401593889u, 442772829u, 802720642u, 330632474u, 1069364249u, 3233047308u, 1211441457u, 3414518574u, 578176518u),
+    SC(578022853u, 3893991284u, 2479206624u, 2682318842u, 16125819u, 681072218u, 1777715122u, 3206183248u, 3014566456u, 2413394137u, 703701471u, 2554942296u, 3058078204u, 1330689328u, 2422924190u, 4269529618u),
+    SC(2583185420u, 810566520u, 3028095155u, 725211695u, 1231903220u, 2974165078u, 1458592471u, 2616152596u, 3758216541u, 2384609926u, 2374751127u, 3411716510u, 3643860023u, 3840287057u, 1910143718u, 1650766541u),
+    SC(58860927u, 3832877696u, 3612336070u, 2570880578u, 163578069u, 2281010741u, 3163969210u, 2573889311u, 3269227325u, 4266838790u, 643452701u, 2796941817u, 819722809u, 3815086451u, 476523181u, 2337395828u),
+    SC(597767730u, 2435135595u, 3831451163u, 718046330u, 1659235065u, 4141216850u, 1846828671u, 3975131723u, 2435413886u, 105101858u, 737679265u, 2943440369u, 1094501232u, 926202479u, 1240555349u, 2573751488u),
+    SC(1717168736u, 1487299806u, 2740425121u, 2354896596u, 2364889405u, 3292576212u, 2318445621u, 2031394571u, 719111941u, 2824700783u, 3007821470u, 1949288131u, 1392562648u, 3845452287u, 3357591254u, 3002210717u),
+    SC(1390164934u, 3786199988u, 2127458156u, 2315070014u, 681161863u, 1094848563u, 58353629u, 464075260u, 1571730246u, 850202751u, 3179534810u, 363054335u, 512715683u, 3998323682u, 1889438147u, 1137727302u),
+    SC(1380657815u, 2479707973u, 3180431802u, 2626976705u, 1765784811u, 1978692854u, 389507856u, 3579262289u, 2659228118u, 3408132890u, 2649461452u, 1049243573u, 2793822918u, 1038937248u, 756313627u, 3167226737u),
+    SC(1931575720u, 3803994451u, 2453564477u, 3647007159u, 1381727125u, 3851446679u, 1877446998u, 394425710u, 622249651u, 1435691786u, 1119492412u, 195991723u, 3821284758u, 344923524u, 3987497498u, 1915635747u),
+    SC(3102250029u, 2456697085u, 4080552298u, 3270471626u, 1235725885u, 4151226717u, 2371289361u, 3842139723u, 2039534958u, 2112510094u, 1298598818u, 540141255u, 2535753281u, 1776622967u, 4153603565u, 3204118763u),
+    SC(340691190u, 1047768063u, 1925890334u, 2111623033u, 434586854u, 663306670u, 416397207u, 3768116453u, 104651763u, 1576257109u, 207100287u, 3931398973u, 361170383u, 2109926203u, 1309276220u, 807502716u),
+    SC(2486625244u, 1218366862u, 756459321u, 3385278013u, 1625668755u, 1746235449u, 1975054269u, 1547341953u, 341857055u, 1355509439u, 3517609990u, 3934578679u, 2391635634u, 3014028638u, 60866400u, 967304604u),
+    SC(2637964641u, 2052509963u, 1188671514u, 386978195u, 3896565765u, 3748044406u, 423019125u, 545852857u, 1807597756u, 1279977916u, 3269455515u, 2195364756u, 529137613u, 3903793866u, 71728355u, 2018647715u),
+    SC(704220752u, 4112220043u, 3784076000u, 3025388786u, 3500975528u, 2967870765u, 232424710u, 1071347400u, 3673406684u, 2928542492u, 1944816417u, 335904867u, 1487334448u, 2906100102u, 3749766087u, 4041593487u),
+    SC(3598528706u, 3340610102u, 25189937u, 500565102u, 396924754u, 2497146394u, 1401614452u, 1304571028u, 1220128999u, 315099056u, 3106826506u, 2732615884u, 3900619710u, 2868166038u, 2618365115u, 2773444364u),
+    SC(4062981032u, 2364130020u, 3077753271u, 1828954135u, 94021561u, 2544337716u, 2203476007u, 801642057u, 1789519632u, 4052794902u, 607800847u, 359671562u, 764599465u, 147823011u, 3418386397u, 4189520527u),
+    SC(207516045u, 112807043u, 3844420553u, 250815311u, 917971693u, 3485496485u, 4025682281u, 2596665492u, 613814353u, 3439093273u, 3714377744u, 4204548171u, 4160278174u, 3427032446u, 1680552294u, 250541110u),
+    SC(648592554u, 3359042429u, 1466010009u, 4018662990u, 3264339083u, 859133090u, 3254153075u, 2034554385u, 3254800826u, 119760483u, 2900548137u, 3252713020u, 3849425616u, 3784959910u, 3332163165u, 3149720777u),
+    SC(948843888u, 4219147589u, 2616204193u, 2053412565u, 1808754145u, 124053418u, 738734918u, 771361164u, 760089890u, 2733314032u, 1414881765u, 2922662886u, 2568097042u, 1172007902u, 2840596319u, 2692474776u),
+    SC(1746443179u, 3047192638u, 589463290u, 1319840878u, 14298396u, 782598090u, 2055180146u, 354748169u, 3174088067u, 915723258u, 2705937654u, 622085624u, 1044567319u, 819136597u, 2699789133u, 1014687830u),
+    SC(1680738339u, 3140777877u, 2524674729u, 4295205u, 3933206147u, 4252712258u, 3096285393u, 690065579u, 3681803943u, 2263614767u, 3815196818u, 1671278393u, 678119056u, 1672907011u, 554056135u, 4088659983u),
+    SC(2595678849u, 3854521605u, 1964695018u, 1486270379u, 2135883567u, 3549978663u, 4179002204u, 1687309050u, 952134311u, 1215342055u, 804429564u, 3169104871u, 3717536923u, 697724715u, 1204815788u, 1982446444u),
+    SC(2962752942u, 3848795804u, 1906934344u, 3902694649u, 3763986453u, 3185580642u, 3709343118u, 3913977575u, 1655611754u, 2127106799u, 3428025067u, 1830947523u, 3735586216u, 238919980u, 2168959630u, 428069409u),
+    SC(1029909083u, 1668208035u, 1247330236u, 2553375002u, 2446767600u, 2539387738u, 2192884156u, 17295077u, 1467630750u, 1975457497u, 783727119u, 2629096598u, 2055135388u, 4049623791u, 1747778097u, 3476642332u),
+    SC(1803688944u, 4144848882u, 3471685277u, 3647654075u, 3038656053u, 976672010u, 2982258327u, 1087305479u, 1376964113u, 2571092256u, 2281866868u, 1558047380u, 6517172u, 3751998586u, 1837348745u, 3335597661u),
+    SC(3207154001u, 1150746123u, 2233955339u, 1557739854u, 3694375728u, 3374160236u, 2023602260u, 1165134627u, 2030759397u, 3660959354u, 876573788u, 1091429263u, 1280556074u, 3141647278u, 3241308849u, 3910301740u),
+    SC(2773701827u, 2193593994u, 375816807u, 3293153606u, 1225193115u, 290418438u, 1948999733u, 494267520u, 671727068u, 1164319327u, 682826087u, 1826600369u, 2648101526u, 3514993800u, 395993868u, 3394855656u),
+    SC(4227944502u, 2882372369u, 3153728884u, 4290025487u, 3096705199u, 2230655476u, 1517265732u, 642360979u, 3505824376u, 424075339u, 945606660u, 699192310u, 4115933898u, 65521545u, 1702848363u, 4053645337u),
+    SC(1633960205u, 2676093778u, 657095071u, 3031416356u, 1506470508u, 1361028330u, 3075967360u, 228227758u, 2461799552u, 195141581u, 1019143836u, 2511944047u, 1233321973u, 3571964608u, 2884399443u, 3998906726u),
+    SC(4018234677u, 2380912439u, 1922013851u, 830649589u, 1847955837u, 515923910u, 4204854405u, 386621229u, 3694601254u, 1077717444u, 1348771320u, 2339361581u, 253174236u, 3407641982u, 358384618u, 1954465173u),
+    SC(1116484793u, 2309240541u, 3698347624u, 386739264u, 395073094u, 2216604386u, 1680607816u, 2307369197u, 2985443672u, 622609990u, 3389316158u, 1681298996u, 943126910u, 1905549135u, 1361279677u, 988724742u),
+    SC(1857427330u, 4178122107u, 1096704579u, 2079047018u, 1595529843u, 2128241829u, 1523573254u, 1698790046u, 1340589382u, 3136156337u, 1821569384u, 4187767542u, 2936270318u, 688835641u, 80015359u, 3898047346u),
+    SC(2569931505u, 1181569004u, 1593323529u, 2563650015u, 3413087603u, 3511424582u, 3828816994u, 2742483531u, 3504593513u, 507745970u, 3942769577u, 9847653u, 1355808998u, 836213475u, 2266403029u, 704243749u),
+    SC(4275787339u, 2915500152u, 4061082065u, 306800948u, 1363056899u, 2364914115u, 17318787u, 91364625u, 445524553u, 1474839052u, 4074101117u, 1702827522u, 3123097223u, 3577776943u, 2839842287u, 940931641u),
+    SC(4092724874u, 1306041624u, 306645133u, 1010977046u, 1047015974u, 1651815797u, 3846451408u, 121316541u, 4071275801u, 11007074u, 338078494u, 3769269811u, 305667167u, 3790720782u, 1975625719u, 2074263464u),
+    SC(850993758u, 1108845401u, 2380588993u, 1198163329u, 1533715544u, 3644698114u, 3016951666u, 1017198208u, 1952901124u, 646275904u, 311973507u, 3708231319u, 1394893332u, 1933052067u, 2532531470u, 1511208962u),
+    SC(2231405191u, 945739440u, 1341692281u, 783651577u, 4000082835u, 4196719743u, 3324615583u, 3672525450u, 522690091u, 2321220982u, 4220873206u, 3229767798u, 2226500495u, 2723210082u, 719774340u, 2768544479u),
+    SC(1303148595u, 3955141387u, 3968785095u, 3485768701u, 193155938u, 251736297u, 3829682934u, 2821652436u, 4238154096u, 4063275624u, 1628745125u, 2067937245u, 322814901u, 3683566064u, 214763946u, 37516298u),
+    SC(2608158849u, 1168530772u, 431227430u, 3845513051u, 1262804545u, 28917105u, 52375810u, 3580739307u, 3492954481u, 224999351u, 3383984784u, 2109449141u, 3243335777u, 1508363807u, 2716704017u, 3767115821u),
+    SC(467062457u, 630368215u, 2792255115u, 459562421u, 2562008522u, 1176356029u, 3045322138u, 3418131421u, 2589580935u, 2225703914u, 1219996593u, 173764693u, 1511804133u, 1427955278u, 2071530180u, 2586416204u),
+    SC(631812793u, 993397057u, 1696968842u, 2145879785u, 1798978685u, 2336507447u, 646927189u, 3176879854u, 1012452599u, 1463052415u, 3687852006u, 1053214032u, 1173434798u, 3748766730u, 3294514827u, 2522817260u),
+    SC(608905267u, 667107067u, 572151655u, 354573674u, 3210353834u, 2376418240u, 3632996837u, 401448799u, 570439340u, 3834480979u, 1525476498u, 2728349714u, 939015398u, 71532763u, 3257528511u, 3254074749u),
+    SC(1872210959u, 666401029u, 1799630099u, 3848705934u, 2448477213u, 3601604196u, 3916843573u, 845009335u, 2210850572u, 4207331079u, 577561036u, 1763391648u, 2123595610u, 1596824705u, 1305531391u, 2671983922u),
+    SC(1925568015u, 3942731309u, 3129107914u, 3562336865u, 761969876u, 2988665773u, 3377219585u, 1444793887u, 3809581593u, 2130254179u, 3014820374u, 1012742859u, 2545058230u, 3527855088u, 1762345178u, 1670877154u),
+    SC(2842504608u, 28377478u, 1771595165u, 4097941936u, 720579476u, 2867381994u, 1887280848u, 3589486629u, 1712160131u, 98193973u, 2675768641u, 683897002u, 1448733297u, 380180112u, 1812889864u, 173096863u),
+    SC(751726435u, 1300324044u, 427938304u, 2271307383u, 3641092647u, 2567719029u, 389107141u, 1541653754u, 1632768221u, 3176767121u, 460298618u, 265311349u, 3007099508u, 3387733733u, 3552719651u, 3199880016u),
+    SC(2569732228u, 1381880729u, 3649438425u, 2341295026u, 1163459324u, 1971990342u, 1625856982u, 2789601476u, 2211092690u, 643062313u, 2353394699u, 289539586u, 4121282318u, 1499392599u, 765873505u, 2766338445u),
+    SC(1129249605u, 814309791u, 3430293220u, 1070905213u, 3333473950u, 3026106510u, 1156544110u, 2615898967u, 1035668845u, 29407534u, 1499813997u, 594283497u, 647396040u, 2198576080u, 32108482u, 714248682u),
+    SC(169965997u, 745026310u, 170805045u, 2481971972u, 4040947081u, 3302763400u, 1272825287u, 3824927062u, 3997514232u, 2878865782u, 2710466042u, 3182823890u, 2292372003u, 141413152u, 421559034u, 4127407135u),
+    SC(959711262u, 3554795847u, 2857548608u, 153231094u, 2756047402u, 1718718228u, 1835241594u, 4010124001u, 3157722710u, 825826170u, 547256788u, 2669581723u, 3551133438u, 1965842530u, 351974032u, 2813703111u),
+    SC(901522657u, 1503836473u, 4424532u, 1824793951u, 4059297762u, 273847259u, 963153415u, 3751139567u, 3739352176u, 177641690u, 4155239260u, 90645752u, 3900574931u, 2286546426u, 611242152u, 2451811861u),
+    SC(4124174172u, 622834803u, 2236784878u, 4032663141u, 1672090849u, 3165543240u, 3162395224u, 3108508285u, 3797991868u, 1883566168u, 2403373364u, 3533197963u, 3889530612u, 200783614u, 2463240872u, 1869705470u),
+    SC(3993663187u, 1877813295u, 168915165u, 1791719235u, 4183915443u, 1614090068u, 3509428684u, 132846108u, 4174365403u, 3953563151u, 241251823u, 4288549066u, 1314309208u, 1262662934u, 1841265393u, 1108059569u),
+    SC(2654701519u, 2022864484u, 365605751u, 4051127572u, 1293449718u, 383407734u, 4182216913u, 2628159960u, 4176692514u, 3661406892u, 2993926338u, 2981229162u, 2057055638u, 3025433730u, 644517485u, 3132339575u),
+    SC(3798934895u, 3498656448u, 1015396510u, 3865807696u, 317983175u, 1331843410u, 2263200528u, 3947391216u, 3132343513u, 1877625338u, 1829291606u, 600420647u, 894616127u, 1011815154u, 465472507u, 1458704633u),
+    SC(2328313926u, 2782102424u, 3511379811u, 1325902789u, 2750793810u, 3935060508u, 4035283328u, 18720450u, 3524044691u, 4117639576u, 2236569878u, 55837378u, 1248964501u, 209987726u, 345363236u, 1915335644u),
+    SC(1526784149u, 1665569996u, 2480222632u, 1854001822u, 1966680255u, 2999466627u, 2892462738u, 1435708368u, 2368677498u, 2154939532u, 1634578200u, 874622u, 1116220211u, 1954558678u, 1271132118u, 1621726806u),
+    SC(371298500u, 135028091u, 2870666426u, 2066376209u, 1416625050u, 3035228807u, 738416632u, 2651975857u, 3680379140u, 306481820u, 3850819491u, 331205741u, 3145996590u, 2563103192u, 2036936752u, 2453812517u),
+    SC(4138222625u, 3031663592u, 142574880u, 3764393947u, 1197962460u, 2600428396u, 4067059564u, 2242987441u, 1347187113u, 1499951341u, 8007080u, 781181422u, 2473685525u, 3213418664u, 248990336u, 1077388211u),
+    SC(520278338u, 4038448088u, 3019412349u, 2761920653u, 2212860318u, 1439285556u, 1437030825u, 2469254885u, 3869625139u, 2396220919u, 1357655726u, 1572325887u, 4224254815u, 1219363656u, 4214784730u, 965099109u),
+    SC(1643436395u, 3274088958u, 2729326787u, 1934117462u, 1759681525u, 316111364u, 883303032u, 494438815u, 1696528184u, 1644190407u, 1694068769u, 1635828318u, 561148491u, 928934712u, 3013835474u, 3618941624u),
+    SC(3128777741u, 1648123513u, 2156439327u, 2368280288u, 2088681003u, 452598209u, 2626780334u, 834737686u, 3661668160u, 226377580u, 2019905875u, 263411093u, 2716612583u, 3865872728u, 3460673661u, 3177142865u),
+    SC(2341512592u, 3939211132u, 1852467438u, 1841053209u, 4267348646u, 2596029379u, 3138845137u, 2455493385u, 2781830978u, 4016397657u, 182924513u, 4148602706u, 1291972469u, 3626613161u, 704860544u, 4217239320u),
+    SC(2280870439u, 563170557u, 3464664227u, 3411730801u, 4040791295u, 4116391351u, 480156332u, 3757375052u, 3430011311u, 1393280481u, 3941057007u, 3114865461u, 4067108927u, 573191506u, 3718401064u, 1689959215u),
+    SC(2934590774u, 3124777305u, 3205496458u, 1429271027u, 2211795103u, 410973579u, 1813966410u, 3413614941u, 3679862250u, 3879747064u, 2100310466u, 1219142285u, 2526383997u, 3459691511u, 2371182714u, 1624484890u),
+    SC(806349197u, 966192029u, 1472655855u, 134581580u, 3638404150u, 1467280822u, 708020825u, 2949411089u, 3511197719u, 2413667340u, 4181168444u, 339441405u, 3538346534u, 3530696163u, 2761316530u, 952372855u),
+    SC(3338710878u, 583865454u, 2207290785u, 4134813263u, 3491666971u, 1993656122u, 2768265026u, 2579603419u, 1071645057u, 2985303079u, 665526214u, 3144590697u, 222965906u, 3268743634u, 2337621674u, 424358592u),
+    SC(3493660897u, 398016824u, 446777263u, 944014649u, 2485292917u, 4184585381u, 2484877128u, 3478174816u, 1527881725u, 663076037u, 772537341u, 3309427341u, 4101886070u, 3910418682u, 283144627u, 2828460829u),
+    SC(1818693882u, 396697784u, 1456995035u, 1794644575u, 3936131134u, 3377264690u, 3012942431u, 3257652065u, 3679386918u, 920814058u, 1100571891u, 3230235397u, 2956370952u, 636308182u, 1337604412u, 4068493633u),
+    SC(3619013177u, 2650044950u, 1802287360u, 3498728858u, 1587789801u, 2499305945u, 3027189693u, 2748914619u, 3984138062u, 1253163614u, 2625849677u, 2035285535u, 2747834469u, 700495632u, 3489487229u, 1693444282u),
+    SC(2432080299u, 2406646098u, 3806247132u, 3467289582u, 1409232675u, 591505746u, 1253744270u, 1358326790u, 2345714599u, 2136150715u, 2638665742u, 3278447096u, 1444239566u, 1852031118u, 1679590089u, 4277987613u),
+    SC(1292807742u, 1031461940u, 3374231213u, 1779889513u, 928349646u, 728265802u, 3147491098u, 2382063052u, 2171275270u, 2840626993u, 3130631813u, 338339118u, 1854360729u, 84503123u, 1388765938u, 530832986u),
+    SC(1187880669u, 3962668184u, 3753179157u, 857020509u, 1754932121u, 2382803408u, 607713225u, 3002588770u, 995869091u, 3590158452u, 2358659723u, 3088267403u, 3772109160u, 306696200u, 279463674u, 1444882876u),
+    SC(78301198u, 1064217271u, 475488919u, 3025481280u, 1698121982u, 564494510u, 3169119107u, 50295563u, 1027776525u, 2148856938u, 2164141525u, 3133579334u, 1087582633u, 1327358032u, 2655212440u, 1821145428u),
+    SC(1505666657u, 3074268169u, 320750963u, 26841978u, 3762198262u, 785106487u, 1270251941u, 1479164180u, 832703464u, 4002032686u, 2177917671u, 2391348484u, 3656541082u, 3177035201u, 817773868u, 2981078141u),
+    SC(134123621u, 2293427858u, 723102931u, 4274496734u, 2665515428u, 2766259000u, 1579758951u, 2429182007u, 3753139600u, 3321118443u, 526299942u, 544620532u, 643413859u, 3891032743u, 3332281193u, 904249640u),
+    SC(3677949841u, 841447561u, 2018205258u, 3482267601u, 4087741511u, 4073203247u, 433886488u, 2503090519u, 1130665307u, 605848351u, 156227540u, 3663977241u, 716092864u, 2917674440u, 3587579052u, 3599809453u),
+    SC(886899302u, 3858504108u, 2108333665u, 1525217164u, 2555851430u, 29703209u, 3873821703u, 1938942920u, 3268851416u, 242482688u, 3858840349u, 741034172u, 2007358315u, 1159933403u, 1712450079u, 3319626107u),
+    SC(4003985195u, 2117165197u, 3554660286u, 383971221u, 1584168645u, 848266459u, 862862833u, 2635559595u, 2523056369u, 3437143235u, 1223323028u, 1939515207u, 388076886u, 208398776u, 2331038477u, 1363150011u),
+    SC(3333359738u, 4054912691u, 2480816429u, 3733283113u, 2474037860u, 920193020u, 282322851u, 2294518258u, 3130644014u, 830825559u, 2329445498u, 2633935781u, 3858733092u, 744573273u, 4008397543u, 1350717764u),
+    SC(3940763445u, 1819367232u, 2876493876u, 3165929306u, 2951970751u, 1356027160u, 325372313u, 4274843591u, 3107482741u, 3666605637u, 3446609368u, 1229256523u, 2525308269u, 3055540888u, 2046715449u, 2466137859u),
+    SC(1247054885u, 256741204u, 83468926u, 1692702246u, 1102482147u, 30999649u, 1707233271u, 4215292815u, 2929667205u, 3177221366u, 4015931590u, 2116658749u, 1277641237u, 3265320312u, 941961000u, 426732816u),
+    SC(1636980345u, 3714401704u, 3927536701u, 2092155071u, 1160976601u, 3783318099u, 4097503920u, 3975627951u, 2691181956u, 3609285490u, 3924559404u, 2749671967u, 1207719197u, 1155781025u, 1918936143u, 734730317u),
+    SC(3789250182u, 2507451254u, 3573163533u, 606465890u, 1344699064u, 1392444670u, 39780688u, 2436360746u, 3370841121u, 2681599907u, 1813682593u, 3502641744u, 2205032523u, 4215891828u, 2213821569u, 1360594344u),
+    SC(811781066u, 1938962498u, 705345634u, 2717746416u, 954611345u, 3485598887u, 3539587683u, 3527985137u, 2400267863u, 239020400u, 3706232558u, 504906512u, 1914340849u, 3433032492u, 4116448383u, 3717624011u),
+    SC(1740870604u, 2862036732u, 4006062177u, 3948149075u, 2644987890u, 2541113166u, 1317093380u, 1302656825u, 2480089552u, 2585157602u, 796920277u, 2908337444u, 866919637u, 1187500948u, 756317261u, 1233465859u),
+    SC(3329520114u, 919544199u, 3998897689u, 3582053501u, 2891695537u, 244037416u, 4181919823u, 3902390110u, 1976110236u, 2021339533u, 2486972999u, 1959509192u, 978534199u, 4217916138u, 1660840008u, 2380449043u),
+    SC(3573637103u, 3583217113u, 557045668u, 39496389u, 303315660u, 106197104u, 405268874u, 3840744274u, 1144018454u, 2686596849u, 1547157718u, 1373128156u, 3918948448u, 3080255391u, 1074184797u, 2096119147u),
+    SC(2931605349u, 2863175189u, 3410554198u, 1073933722u, 607953673u, 485819319u, 1008282062u, 2170876626u, 1338110557u, 439414315u, 1109405787u, 2848493190u, 2800648021u, 1429839589u, 904385407u, 3836997657u),
+    SC(365630999u, 388488943u, 1236101153u, 2469018065u, 3146749963u, 3040284033u, 99549439u, 3954380355u, 1689095298u, 2281440575u, 3996500409u, 2536813389u, 771749995u, 1225698707u, 2986245419u, 4161715578u),
+    SC(3557040286u, 2234570356u, 163285157u, 1381110177u, 435889443u, 104736408u, 1808806016u, 1279901987u, 929299816u, 4256718105u, 3897582197u, 995766908u, 1190102974u, 2318676677u, 1656538658u, 1084727592u),
+    SC(4088133839u, 203630665u, 1491284162u, 4231166660u, 3557508247u, 4095912526u, 3559822209u, 2617236886u, 1350967045u, 3627102844u, 1049654851u, 763000353u, 3521112556u, 2093949025u, 3430026906u, 2103119197u),
+    SC(2023958675u, 787078139u, 1065645402u, 1696308515u, 1559833414u, 3286547278u, 1471676271u, 2089242090u, 2455468090u, 2523341300u, 1856818567u, 1230941053u, 3015929522u, 2462164083u, 3026288491u, 2596821141u),
+    SC(2170888463u, 1561620362u, 448916881u, 2814076813u, 461182436u, 1054170765u, 4132450825u, 2807090506u, 4265151802u, 434252764u, 3419691125u, 3818309395u, 2241151334u, 2716710458u, 944473479u, 2438800909u),
+    SC(1965465064u, 1815035188u, 3455155670u, 4092567960u, 3128115999u, 3472913139u, 1664918911u, 2113814281u, 2976032351u, 3516475372u, 1145496539u, 3589179472u, 4100191135u, 502374577u, 4125955390u, 1883768253u),
+    SC(1580650127u, 3012793502u, 1536970256u, 1157312503u, 3307251639u, 2835442488u, 2504320274u, 1114719664u, 2084628248u, 690984612u, 496509646u, 3578456720u, 570903644u, 209893966u, 2100929760u, 2014404940u),
+    SC(3368841513u, 4260085702u, 3226955484u, 1791591397u, 3259618144u, 1994030373u, 2958822251u, 375596870u, 1219022051u, 2810070168u, 1993450290u, 3308912314u, 643038127u, 3572981352u, 3831975288u, 1282502577u),
+    SC(2682379062u, 4058922605u, 958714537u, 2923289775u, 4203051403u, 1938006493u, 762055700u, 3930494783u, 490059432u, 1617970624u, 2515375704u, 2149657443u, 1138513388u, 3199410750u, 2083419854u, 745862866u),
+    SC(1286122378u, 1027961998u, 1847189549u, 3694465657u, 3795208411u, 3530368101u, 2090275829u, 3163475362u, 2321049261u, 2612517778u, 658284323u, 3230100629u, 330868365u, 3139487183u, 373987897u, 1312715738u),
+    SC(210567504u, 3836316140u, 1557907236u, 565306015u, 4059236376u, 494999473u, 1027043160u, 3072352448u, 1549303972u, 3316070986u, 451160733u, 4038197298u, 2059708210u, 3408324375u, 1239823205u, 1350757329u),
+    SC(1029789051u, 3032088038u, 1241389948u, 2552010883u, 2654372932u, 4046503914u, 4229831180u, 317893169u, 2469488639u, 1657635851u, 982912144u, 3870409598u, 505624213u, 831431302u, 1908963730u, 3730527993u),
+    SC(1733730207u, 4249143817u, 1531415995u, 2244209951u, 4272610029u, 3412215122u, 3438997865u, 619093546u, 1656432968u, 588234028u, 2861830792u, 2061480523u, 3513129438u, 2937045250u, 4273058413u, 1743486924u),
+    SC(1662243134u, 3737064449u, 246927993u, 744938152u, 1848669648u, 1022417655u, 255554878u, 1936915394u, 1147277872u, 1357582917u, 2258064469u, 1675652655u, 674887796u, 3199203778u, 4133365421u, 3545710323u),
+    SC(1871628775u, 4223561356u, 3504539739u, 1204210475u, 142944754u, 368128405u, 1580195364u, 1305622888u, 532028948u, 1379614638u, 3041112597u, 3695636203u, 601986314u, 2197931917u, 3306211183u, 3979791737u),
+    SC(1449213356u, 1012572588u, 3180990146u, 4164531395u, 921742936u, 3772785220u, 2079065414u, 1896578924u, 611476395u, 2260965625u, 62010137u, 1144303499u, 1393100989u, 3716116844u, 4155980457u, 2395634152u),
+    SC(3386775015u, 3021238809u, 327052887u, 3316112854u, 401152688u, 1750719904u, 1105935393u, 2276384908u, 3340209829u, 3483391696u, 3755023495u, 1901433292u, 1087135153u, 4125406991u, 3640639428u, 1066074121u),
+    SC(123275850u, 1652383376u, 3827976975u, 1810254202u, 4177926189u, 3537755208u, 2830547965u, 4117497092u, 3591496218u, 3041494880u, 1553459320u, 3131335868u, 3428571253u, 893086200u, 529780266u, 2797831559u),
+    SC(2494683663u, 3004227670u, 3675127666u, 2178626402u, 533484893u, 3208419131u, 1980332296u, 2145492330u, 2199423293u, 3585350230u, 54143668u, 2924188988u, 1170484892u, 2402275673u, 2234019299u, 4249862679u),
+    SC(3048161945u, 3168456433u, 235393153u, 3672911098u, 3606640673u, 954290597u, 4061031762u, 2227807947u, 3231204359u, 2323494957u, 4117928062u, 2973228041u, 3369035261u, 183356192u, 1135757211u, 2878686349u),
+    SC(1598664003u, 1886668167u, 964731219u, 3360785051u, 4176437569u, 2559163148u, 1011312711u, 1765393379u, 1547752325u, 552954941u, 195070689u, 3020931658u, 719477908u, 1170923767u, 3491567616u, 1954415851u),
+    SC(4139452031u, 2295120156u, 1692601626u, 3867752770u, 381592511u, 653040740u, 1558059934u, 1216193413u, 828000109u, 1919457164u, 3634187976u, 2917026435u, 685506009u, 4072621310u, 2907625249u, 2015924053u),
+    SC(2068303582u, 3224050144u, 2497374734u, 3959424085u, 1382615881u, 72040208u, 3203322559u, 4192168272u, 466462196u, 2616123081u, 1857734055u, 2507741359u, 1404554456u, 203494192u, 672061755u, 3773819302u),
+    SC(3127498739u, 137189081u, 3949322667u, 762377517u, 404895265u, 3221393461u, 2811221600u, 2571143021u, 1598333693u, 1456810140u, 255245753u, 1357784376u, 488438069u, 2921000054u, 2226573599u, 2539469117u),
+    SC(2746681492u, 3525755285u, 574034879u, 53525049u, 4269720415u, 2537763965u, 490601913u, 2077829631u, 97569759u, 1114987168u, 895144673u, 179541113u, 1230954284u, 549128869u, 2479621325u, 1454268725u),
+    SC(3344359998u, 3140321789u, 2449372085u, 552287230u, 1525023411u, 1150089295u, 244163453u, 3519546597u, 2314516218u, 3992480667u, 3399439026u, 2556733826u, 1515170729u, 3573233144u, 2555449872u, 887048703u),
+    SC(909278261u, 1873515691u, 4153524788u, 473498780u, 1698762396u, 1826597376u, 3513970308u, 913408556u, 4264921252u, 1770818869u, 4041219844u, 3914297401u, 3950270001u, 2351272570u, 3195864607u, 3555544173u),
+    SC(997572542u, 2385978129u, 4100902767u, 3320523508u, 3059765681u, 2269842482u, 294248710u, 937238971u, 3105114675u, 3821220762u, 1167450696u, 2274626382u, 776118421u, 3620846634u, 3931154985u, 1518835976u),
+    SC(1151737616u, 1471473802u, 206957938u, 529482871u, 1593995965u, 932878260u, 3643441013u, 4040410594u, 3899714149u, 2150892644u, 2534861855u, 95916946u, 404103942u, 1841381510u, 287170884u, 2195194177u),
+    SC(296616695u, 6700042u, 38563813u, 3465676525u, 515822310u, 3391703755u, 1959371303u, 9961213u, 1666849671u, 2724395824u, 1342731130u, 3875807949u, 2766362470u, 2483962443u, 3600274060u, 3755385711u),
+    SC(3343986954u, 3753008404u, 778744240u, 2872161148u, 2392357618u, 274553217u, 110134730u, 1041510236u, 2757955032u, 3978762153u, 4043605412u, 3194510426u, 3435824413u, 1271666822u, 1308181434u, 4001501204u),
+    SC(4294236102u, 1074394012u, 1098218263u, 1051874156u, 2788800299u, 236302207u, 2030820791u, 4025476202u, 1766488462u, 268313297u, 271608186u, 690637745u, 1276185963u, 3671584198u, 3902235728u, 3461382373u),
+    SC(2104945209u, 3241975622u, 3912362172u, 483669767u, 9644826u, 824528152u, 3228339433u, 3287876916u, 3155473082u, 2399813007u, 885510012u, 878233878u, 1290683275u, 967157460u, 3533818366u, 2346980795u),
+    SC(3069168338u, 3396003059u, 1862797063u, 1393207981u, 1650448990u, 2187294696u, 2792558229u, 1577561401u, 1214830831u, 2320945959u, 66516131u, 602565334u, 1184116762u, 526648816u, 172103993u, 3182544741u),
+    SC(436515114u, 2827601062u, 3548352592u, 3881043667u, 1222873002u, 3235031882u, 3809258094u, 909353774u, 4097445007u, 4208168336u, 1820425674u, 1048486046u, 568444929u, 2063100262u, 3259427784u, 3698692381u),
+    SC(2913906942u, 2603897232u, 1317505810u, 1821302239u, 3071157504u, 1515022956u, 1394257233u, 2199952254u, 723956077u, 3712821671u, 147614542u, 428764894u, 2982518255u, 3329831283u, 4080840761u, 3547669165u),
+    SC(82102786u, 959575036u, 3037860381u, 761472868u, 3649020197u, 2220937425u, 2593450888u, 745408121u, 4019252941u, 923051721u, 1162635360u, 2458825522u, 3432086295u, 4065936200u, 1364730577u, 2220061799u),
+    SC(2717106809u, 3748249914u, 1897619172u, 329211963u, 1448406188u, 2915052066u, 175906951u, 3239979377u, 1462015892u, 1422620893u, 2130090262u, 1593713446u, 3903519447u, 2829657010u, 623190957u, 3064032045u),
+    SC(2865196929u, 1216768230u, 4105226513u, 3163977215u, 3247711432u, 1785267140u, 4105256460u, 3885549477u, 615388895u, 3714874732u, 328326975u, 1935711170u, 3279263030u, 3945230729u, 1485468369u, 2229086584u),
+    SC(1894334833u, 3851821808u, 3728081254u, 1687742153u, 232580246u, 2707304610u, 2780673793u, 3489875817u, 3604463783u, 1974062063u, 730125544u, 33618218u, 1147212219u, 3477513597u, 1579437850u, 285456215u),
+    SC(3390563815u, 299123858u, 1232054345u, 3333102663u, 874934379u, 1535279798u, 4069056662u, 2395441296u, 3017659954u, 753235896u, 3719951617u, 3783078604u, 3871707118u, 1311257616u, 1580397544u, 2345544750u),
+    SC(437691789u, 2372992488u, 1790996495u, 977513372u, 626966529u, 2371872113u, 2126918218u, 799695592u, 4073402042u, 1706029219u, 3715875127u, 628890928u, 3694049011u, 2050529249u, 381741853u, 443616295u),
+    SC(2402147941u, 189652752u, 3265031103u, 1521658897u, 768816506u, 3823497246u, 2551778866u, 2495206642u, 3765144823u, 3852941013u, 82400445u, 2240935885u, 2044670811u, 3542589277u, 2152284132u, 3746327291u),
+    SC(856995155u, 4162928252u, 2161399342u, 215692644u, 3122492037u, 1820907717u, 2746079888u, 76874082u, 870857822u, 3824665936u, 4182406196u, 3821720862u, 3034231906u, 20630564u, 4232749561u, 4232270637u),
+    SC(2081455860u, 1705774127u, 4233826723u, 881491139u, 4200109396u, 3995821574u, 720618938u, 623919104u, 1801178898u, 780797701u, 3496476280u, 3849139806u, 2310383993u, 3258913355u, 1351508974u, 2539061957u),
+    SC(3910707241u, 844816231u, 1360930174u, 3847843080u, 431900165u, 917638329u, 2071373130u, 1541732531u, 445837472u, 3026277059u, 3787099917u, 303143957u, 3070947567u, 67047103u, 2849804807u, 3476007086u),
+    SC(2272320003u, 3572737209u, 3912094435u, 3190856833u, 3276196221u, 753538513u, 3824981199u, 1102688377u, 3492102927u, 3697491287u, 416510718u, 1693810604u, 1408853089u, 531955802u, 281969709u, 2870098947u),
+    SC(3333729599u, 2922063191u, 2972099967u, 1807483805u, 2790825840u, 3324526241u, 1930734293u, 2899882539u, 3897703885u, 740045842u, 903817101u, 3835443423u, 2247264398u, 3476846331u, 1189195770u, 3637681150u),
+    SC(2597247304u, 1878784388u, 926621329u, 4287043097u, 1176663067u, 505067880u, 2626210672u, 933785108u, 3618106143u, 457978335u, 4282633266u, 424264147u, 383903724u, 2796049101u, 3907515794u, 145969881u),
+    SC(2941342575u, 4241218228u, 3304325467u, 512412265u, 2961961045u, 3761812011u, 2277855071u, 462424051u, 3065711436u, 2512420559u, 1241491547u, 2880557832u, 3420984247u, 1882859503u, 13599902u, 1192431483u),
+    SC(3964864223u, 1050717109u, 1875139081u, 633456933u, 1457532922u, 404982846u, 1538453075u, 293747938u, 3377515958u, 1913611764u, 403067730u, 1137249240u, 2488792255u, 3644967414u, 2306943040u, 770608025u),
+    SC(691739813u, 3188882374u, 439975629u, 1494631267u, 1484736140u, 2178829703u, 1818074030u, 3878523040u, 1210123023u, 596549381u, 3913122265u, 392463933u, 71542052u, 1025041947u, 2921789261u, 3124090913u),
+    SC(3957672829u, 2575788726u, 2996117262u, 3867933712u, 377975106u, 586122177u, 627176582u, 3028702344u, 706569500u, 3405283375u, 4201225617u, 3089379153u, 1490571168u, 3565272135u, 2454122168u, 1832393735u),
+    SC(2297918755u, 984667803u, 3978428681u, 2996637081u, 866943781u, 1146952159u, 3549273193u, 879013084u, 2408665378u, 4225326837u, 837430449u, 2932260543u, 2382729305u, 1167854939u, 2040693451u, 3408357122u),
+    SC(495220029u, 3877703128u, 2646003616u, 2394855319u, 3355066553u, 1855210399u, 3088151385u, 2729687809u, 4147514202u, 3126043864u, 1950398166u, 4114662533u, 780704819u, 2670994957u, 2885318753u, 4059306710u),
+    SC(434544117u, 393183937u, 3474645042u, 3409480931u, 922233406u, 1584668188u, 670887861u, 824003375u, 3288462590u, 3384431550u, 3189202376u, 3424458675u, 165279663u, 1538561760u, 194362278u, 3419783491u),
+    SC(1930993154u, 3253806591u, 3743060889u, 1475517093u, 430985054u, 1118697257u, 1406358732u, 2934174409u, 1387849871u, 477003000u, 1646076336u, 507535416u, 3640778268u, 1090638884u, 16817153u, 2771908356u),
+    SC(3320569986u, 2414979263u, 1392022892u, 3074945491u, 663737008u, 2779674217u, 29513449u, 679978831u, 216370361u, 1659325336u, 448363977u, 762538846u, 3305563421u, 1812575106u, 1056906459u, 3441793120u),
+    SC(2017203745u, 4154002945u, 1117191917u, 1002996693u, 444074087u, 3359347046u, 1129973090u, 1233312374u, 57717730u, 3382806982u, 2622905406u, 2394423709u, 4112663924u, 3177184198u, 586507233u, 2318850608u),
+    SC(1432256128u, 214723142u, 388287446u, 1246982685u, 4208357323u, 745657721u, 1299816303u, 4197135109u, 1740370277u, 3550310466u, 418770225u, 687762902u, 3684386825u, 187855083u, 1673373187u, 4098793025u),
+    SC(1086626342u, 2870793324u, 4058531454u, 606890779u, 262815908u, 3402487050u, 1258427301u, 1076114545u, 378866432u, 1342333487u, 3770285492u, 3275891907u, 2908077872u, 1744103787u, 3693614070u, 802873222u),
+    SC(3949673445u, 3674836248u, 2625702815u, 1435748166u, 1194353190u, 225960290u, 2089509622u, 3616756376u, 1026119044u, 1060466524u, 530121265u, 1880944072u, 3360593521u, 1153311483u, 2614578958u, 22830024u),
+    SC(393353380u, 727040361u, 480288883u, 1292245843u, 2691183926u, 2584018089u, 66482382u, 1588748433u, 2517722650u, 2829302899u, 1998058051u, 3857234298u, 92147314u, 1973358414u, 3470485772u, 3013999170u),
+    SC(2216333218u, 4089208714u, 2097318912u, 310126202u, 3926669154u, 2332552163u, 2139634279u, 2412947072u, 1469838205u, 3002933111u, 2684712722u, 2296102348u, 86414220u, 1335601309u, 2588071155u, 1160573360u),
+    SC(2954818900u, 976715550u, 3355525661u, 2744763708u, 897939612u, 3622114961u, 841288289u, 1860085805u, 687017193u, 2116662001u, 989210272u, 128155412u, 2195790289u, 3865283051u, 2518687755u, 631833189u),
+    SC(3107848526u, 2386347587u, 401502422u, 4018968856u, 3123990140u, 188262822u, 630304940u, 83069188u, 19513733u, 1541394700u, 1810977505u, 50301364u, 3501418733u, 3232629239u, 724171925u, 604685267u),
+    SC(3774097138u, 1136987546u, 4286620125u, 651571593u, 2684748230u, 2328367987u, 100398408u, 128767266u, 2530771936u, 2501565534u, 810276936u, 3438517290u, 471414826u, 3945049374u, 338745093u, 3736553980u),
+    SC(3776879732u, 1088985005u, 678473178u, 1673128964u, 3577192212u, 3015425522u, 343845303u, 2624791356u, 1238820171u, 689534258u, 1062903280u, 1042473817u, 3777356621u, 3656636101u, 3416197664u, 1841426457u),
+    SC(2444056651u, 207548741u, 997813962u, 537033922u, 2922966640u, 2596559132u, 2043635623u, 2842373163u, 3625296403u, 2787165489u, 301440605u, 3050947525u, 1449000343u, 3974644194u, 1050418343u, 1393273898u),
+    SC(1047679890u, 4110038258u, 121714565u, 3409063733u, 271750940u, 587461594u, 3219391585u, 1117386962u, 2385656401u, 1524494037u, 4082401815u, 1762127781u, 1309416791u, 2023064478u, 69346277u, 1997057669u),
+    SC(1585954498u, 27625899u, 1211891884u, 4203102005u, 2446922139u, 2583837116u, 3981399952u, 1168736608u, 2827631492u, 868703263u, 2662284309u, 2680396398u, 862084892u, 3503125091u, 981618723u, 4075279483u),
+    SC(3269494291u, 750336821u, 1956427346u, 1156159753u, 3659015694u, 3528642354u, 1218421192u, 3530072301u, 3555910573u, 521549405u, 3564124374u, 2236483443u, 685780580u, 3495577444u, 1322309674u, 2357876577u),
+    SC(2570079326u, 3438319721u, 2065798082u, 836604978u, 999314384u, 3837330012u, 1951497127u, 253327535u, 4000840315u, 1670058902u, 1870559203u, 1138558112u, 3121816819u, 504209681u, 864033194u, 547211145u),
+    SC(1088489669u, 1504574263u, 1696531703u, 166693211u, 631742211u, 1695378205u, 471937578u, 3032860348u, 2306911032u, 1463019080u, 2226123768u, 3296718660u, 554611371u, 2694114092u, 4234036811u, 1738389075u),
+    SC(2563277399u, 756614945u, 549655848u, 2135985652u, 1835169501u, 3379632842u, 1539222748u, 2294720394u, 1562028406u, 526147579u, 3509495796u, 2365919464u, 3045009166u, 3767284310u, 4092487531u, 1101405330u),
+    SC(949664378u, 636035846u, 3092179639u, 2708223918u, 3618950921u, 2154821440u, 3227364128u, 1622110189u, 1731899593u, 3964199656u, 3547524448u, 2167089552u, 1237526071u, 905321491u, 3606113526u, 3496308862u),
+    SC(2647019450u, 2200737134u, 2481969762u, 3857783610u, 1712974506u, 3845764914u, 1631928042u, 3394494231u, 403388585u, 1012312848u, 2753985240u, 3634583791u, 2405476809u, 2491648159u, 2506862554u, 4099510444u),
+    SC(1896975896u, 3881353923u, 1644384907u, 2338785195u, 3007552268u, 3553953961u, 1733935445u, 4266205687u, 3270908657u, 739987100u, 1687193369u, 4045099729u, 1992237815u, 3788275723u, 1590140456u, 2853195488u),
+    SC(868019694u, 297399236u, 2454587792u, 2598133713u, 1176603427u, 1697751618u, 1170977448u, 1053020310u, 368360730u, 1814218355u, 2484761078u, 4100542427u, 4164632205u, 1580301981u, 1699764181u, 2902174986u),
+    SC(1264163642u, 1253435889u, 4049724875u, 1660795477u, 4225333056u, 1972924880u, 3865780444u, 1309920436u, 1666202074u, 2419402539u, 2339398673u, 2603884868u, 1821770138u, 745403427u, 723003805u, 1245689123u),
+    SC(435601228u, 3672460457u, 1102640706u, 2501074982u, 3737882074u, 904492583u, 1452553819u, 556178704u, 2722906076u, 151717596u, 642501192u, 3676786735u, 1823677035u, 1620918077u, 2714315876u, 3476854231u),
+    SC(3158176169u, 2150093133u, 4133657311u, 2060481454u, 2317813877u, 2977408634u, 93181039u, 453062988u, 2581412497u, 1425349895u, 786644617u, 2375111049u, 2470727781u, 1996965351u, 3065721003u, 2156732278u),
+    SC(2541372004u, 1377464552u, 1294333365u, 2887443958u, 3276731166u, 1306142814u, 514107877u, 2111253564u, 4055877657u, 2058039268u, 3494009697u, 3443539913u, 3690221416u, 853656603u, 1338940202u, 731863564u),
+    SC(1608506954u, 2247907923u, 1054124021u, 2329705244u, 160114193u, 1042750279u, 2713791593u, 231322425u, 1054813103u, 3177878758u, 156351189u, 653993145u, 1931224456u, 3002526492u, 3916713801u, 382096730u),
+    SC(3099383596u, 3704785660u, 4004256453u, 263707532u, 2948692671u, 2183563079u, 1826624547u, 3924411661u, 136721349u, 778944599u, 2612895535u, 930194751u, 2629226723u, 1786078939u, 4072952101u, 63266461u),
+    SC(1814083993u, 322683771u, 3327984107u, 1855219045u, 1914421993u, 3664993394u, 2347279388u, 32988279u, 550172276u, 3635217262u, 636758692u, 2052777077u, 1580659786u, 2043019040u, 3480088853u, 1085742675u),
+    SC(3152318785u, 1768251157u, 969821170u, 4075362783u, 4168594938u, 372996720u, 582783405u, 828037895u, 2362695717u, 1712902716u, 2355847158u, 3683631269u, 2809889919u, 248018604u, 1089957532u, 3422108190u),
+    SC(1955278968u, 3817043135u, 133405627u, 3311671095u, 3211656878u, 3549957237u, 803294312u, 1709651846u, 2138877450u, 1638391714u, 1193225344u, 562022471u, 3934697136u, 1654107826u, 2403112143u, 713104072u),
+    SC(4200843205u, 3097109849u, 1175810699u, 577949544u, 1564071314u, 3495084220u, 3527231678u, 3345278132u, 3301125026u, 2001837408u, 3789785680u, 1835520065u, 2152146134u, 1555356977u, 4226274962u, 2359590026u),
+    SC(3270341015u, 3491029888u, 2741365267u, 3645387083u, 2258079408u, 1893983300u, 1821718641u, 3428239644u, 1551090323u, 3888237848u, 4152707593u, 3636048123u, 872725943u, 1937621104u, 163430430u, 1181374814u),
+    SC(622117359u, 3407743958u, 3270725252u, 1866366982u, 1814772228u, 3235510965u, 4063225970u, 1875011262u, 3315641452u, 129741529u, 4286858054u, 1710649030u, 1350317533u, 2362415824u, 1772219540u, 3327016627u),
+    SC(1539342085u, 18237426u, 1490890280u, 2587378632u, 3794897919u, 3379169309u, 4139184020u, 1311269712u, 557637779u, 303558404u, 2374488153u, 4065873333u, 2056373349u, 504441958u, 2753529259u, 3955015332u),
+    SC(3988090434u, 2536987395u, 2320973680u, 1739474511u, 3684438837u, 4137696728u, 2250905393u, 2587667850u, 3555072624u, 385406278u, 1639465290u, 1114586084u, 897982547u, 496508718u, 1393837183u, 368009127u),
+    SC(690300782u, 2015782017u, 1005980056u, 771917382u, 1749616782u, 3503783253u, 2172423581u, 1943394098u, 4113651622u, 2843515037u, 3467827029u, 3685797601u, 2226336275u, 551382306u, 1646346212u, 2592549231u),
+    SC(742750677u, 3181442213u, 924883074u, 2473597417u, 2435343225u, 3283071871u, 2795389086u, 2613092404u, 3780165453u, 3632907204u, 1700449571u, 4077943754u, 2736378983u, 2981736796u, 862759220u, 1593301404u),
+    SC(1596328448u, 301594742u, 3152188807u, 183703602u, 39788984u, 1114213181u, 90735941u, 2826995972u, 1792227890u, 374123039u, 2051878112u, 7253053u, 1936713294u, 3627694747u, 1397176969u, 2397053776u),
+    SC(1002159302u, 302603977u, 87020592u, 4093328746u, 2636065897u, 3901247744u, 224765143u, 3064744843u, 53012520u, 944154343u, 3680176399u, 2358608346u, 1087521995u, 2856016200u, 2119147434u, 1426787479u),
+    SC(1233453691u, 3708803311u, 4274630468u, 3156356938u, 876511434u, 1714262397u, 2952502657u, 2506805232u, 1488911662u, 933457473u, 810901941u, 4067519011u, 1175130132u, 4269885012u, 1757506594u, 998965210u),
+    SC(558250216u, 3538094225u, 2606674648u, 2151366092u, 1854041804u, 14792091u, 2464310229u, 1737858535u, 165513505u, 1863523881u, 900596820u, 4284467650u, 3693265137u, 3370024408u, 2912764388u, 4130485290u),
+    SC(1827505925u, 1559047530u, 4091761451u, 2522745393u, 1752613136u, 1763008309u, 1145046262u, 3874738141u, 4112194219u, 3362739567u, 2340136162u, 2716249831u, 1437694977u, 2575289024u, 2822681967u, 2119462598u),
+    SC(2499898983u, 2272039788u, 3810931864u, 2019152301u, 2143530468u, 69310247u, 815908998u, 3386702539u, 698251460u, 3873597166u, 4290586699u, 2164284331u, 1308042031u, 776204640u, 1949021074u, 1794438752u),
+    SC(1273784008u, 809507897u, 3291119641u, 4231630064u, 3306410511u, 2645755747u, 1362187033u, 4000261106u, 4057988754u, 998065673u, 2266671382u, 680696931u, 1338895777u, 1413465045u, 2391484213u, 2474972412u),
+    SC(3037008849u, 1079065495u, 1790968154u, 1625635557u, 2424882415u, 1521646514u, 2134825592u, 2223659463u, 2621557477u, 293791426u, 1068651717u, 460877005u, 3700589257u, 2791786561u, 698714443u, 2579719065u),
+    SC(1501111891u, 965320761u, 1785314723u, 2324826825u, 3521067077u, 653462528u, 1044469139u, 3062919309u, 2133595319u, 659064795u, 1583702418u, 435054391u, 1282739379u, 2544782251u, 977195055u, 448423055u),
+    SC(2074261350u, 3472960147u, 1200612019u, 3910588005u, 622643193u, 1052863955u, 1303605334u, 99274607u, 352160056u, 4182800780u, 923931270u, 1586224404u, 1036811916u, 746891881u, 66793759u, 2237924539u),
+    SC(811791102u, 4137455833u, 4237589240u, 2850568653u, 2141101346u, 1449907111u, 474210203u, 3937785531u, 3682904115u, 1234267457u, 2145287025u, 2643633942u, 104875988u, 564358074u, 2912514748u, 116780632u),
+    SC(3982464157u, 1776020618u, 2012534421u, 3410257664u, 4143638151u, 3811036387u, 3677930237u, 1420848756u, 1193599072u, 91962704u, 1695567865u, 697633739u, 711526179u, 4049181181u, 3999465151u, 763965667u),
+    SC(1298488835u, 805470838u, 244519678u, 2796339216u, 820062544u, 2663213267u, 3608612422u, 102464732u, 2431631650u, 1814516891u, 794690667u, 1776910084u, 1134122910u, 663538955u, 2077156643u, 283810235u),
+    SC(4139124566u, 3095982060u, 3500797428u, 2760112475u, 1759534720u, 3276908045u, 3205918634u, 3941708637u, 666820285u, 2859996548u, 1787390756u, 452655536u, 3411536271u, 198073846u, 3218221629u, 950401932u),
+    SC(3428396202u, 2485887543u, 1925503892u, 1490479660u, 2357314872u, 2412235601u, 1822622088u, 2747619144u, 920844237u, 898520584u, 921140496u, 56738801u, 3144405681u, 3594530940u, 1674908369u, 3676864856u),
+    SC(1254861276u, 2780513944u, 564374712u, 3470738180u, 4181139809u, 2540506847u, 1786381103u, 4139885654u, 3010369594u, 2997569523u, 1047668862u, 2612855501u, 3606786090u, 2536448358u, 2628669061u, 1378231351u),
+    SC(3366262878u, 69368275u, 726720710u, 463268193u, 2078499645u, 2225686317u, 2537844187u, 3943047057u, 3484045495u, 1147017371u, 3595312631u, 1181281969u, 3451374545u, 4284858623u, 1010356781u, 2614408651u),
+    SC(3251197287u, 133494289u, 911304872u, 2313031853u, 1398779656u, 1710805518u, 86708289u, 3546224889u, 888650811u, 1033202531u, 162513387u, 2507097202u, 1413028321u, 923330539u, 1400551745u, 1208170313u),
+    SC(2381642679u, 922121070u, 3030422384u, 871879254u, 2343996776u, 4091672826u, 2381426257u, 3526797555u, 1030850046u, 2392468736u, 965193510u, 1908095056u, 3472273655u, 1886850177u, 580351844u, 1560416812u),
+    SC(14038512u, 3814489272u, 4071235264u, 3296002333u, 3267935158u, 3521888919u, 3267012070u, 2858087389u, 9596605u, 3314084019u, 446237275u, 1493675615u, 1142839961u, 408143427u, 1580630076u, 2074417711u),
+    SC(190370093u, 1602638709u, 1964304952u, 820219397u, 913880357u, 3904182563u, 3594913568u, 189179068u, 4155871619u, 1527691955u, 2472368252u, 3918905524u, 3615268416u, 3930601462u, 1222920257u, 121867582u),
+    SC(3145493132u, 3019978304u, 3975860341u, 1468959150u, 315310675u, 1684133760u, 297432795u, 3667558198u, 2111439448u, 930403864u, 1754880899u, 1460152666u, 1009736768u, 812501927u, 3519155617u, 1211521052u),
+    SC(351727863u, 2462878959u, 2647300362u, 2141566890u, 4044797977u, 1915550609u, 2525213336u, 890546662u, 2294505362u, 2047302028u, 2429442732u, 1262480565u, 576783455u, 4063756473u, 2073489936u, 978153557u),
+    SC(1268114932u, 3953107224u, 1574623382u, 1165970082u, 4217435344u, 1231738106u, 1992015079u, 2000979265u, 504366983u, 1362807601u, 3121119057u, 538051053u, 1345134344u, 4158830836u, 3531015889u, 1172774177u),
+    SC(3919675328u, 1744263980u, 1669638705u, 573789603u, 2813285222u, 1300618262u, 3706502442u, 910910382u, 1107960712u, 2909226275u, 1660484848u, 313917867u, 172023914u, 28629697u, 2506145925u, 3732912327u),
+    SC(60654902u, 4079021185u, 1323552870u, 3229827376u, 2530541379u, 2201069596u, 4044019012u, 1140822377u, 1894681065u, 343468184u, 1624664661u, 1616161744u, 3343074613u, 329753534u, 2054611815u, 3263996488u),
+    SC(2541330632u, 140660076u, 3199327346u, 4084321830u, 2677389715u, 3298816526u, 1944124u, 800470760u, 2644387788u, 1730767952u, 165301006u, 1614254603u, 915834072u, 2790045959u, 3526403243u, 2697097518u),
+    SC(3444332618u, 497792143u, 1784416734u, 2628728575u, 1251428127u, 3512096134u, 3178804475u, 1727050753u, 2509253297u, 251594466u, 3017868464u, 3402809998u, 1876299501u, 3296090096u, 3158520849u, 657737457u),
+    SC(1187647988u, 337863371u, 1362191607u, 3341514606u, 3689627493u, 1565684118u, 2297085674u, 627157924u, 2153792282u, 707449922u, 3753300939u, 3592830049u, 3170699590u, 1644487413u, 3895641301u, 2754923007u),
+    SC(3756773753u, 536568821u, 1995818835u, 1342380577u, 3950063077u, 2123334580u, 1974221272u, 2324997395u, 3488443518u, 968013132u, 543858914u, 796680460u, 1702276909u, 3971125002u, 2803675565u, 3351147998u),
+    SC(3340526898u, 2197620283u, 1147354525u, 2050725113u, 1138422177u, 2036858831u, 3777200263u, 1563173993u, 1660737485u, 234908176u, 954174189u, 866904384u, 4052371254u, 1387129768u, 1645026132u, 2849208016u),
+    SC(1676393293u, 3700138138u, 1311129851u, 4103059290u, 1751444545u, 4229318577u, 3925389047u, 885063479u, 3852272459u, 266432331u, 1104187617u, 2536901253u, 3690049103u, 1906074335u, 1998983685u, 3662340750u),
+    SC(1694800072u, 3411132182u, 1492036705u, 1639287085u, 3463339036u, 656228540u, 4003548601u, 3708977482u, 3890636677u, 1569587603u, 608532329u, 3151352138u, 2053195141u, 1890410094u, 3808791289u, 1688621689u),
+    SC(346153023u, 348129379u, 2170133511u, 3088506692u, 151524776u, 1086391082u, 3289523624u, 1204043733u, 891570777u, 3161172111u, 1190554540u, 2612588382u, 1227283000u, 1347628507u, 1835884655u, 905877726u),
+    SC(480210610u, 4138246632u, 248486422u, 1897222143u, 2767277077u, 3151302408u, 1299141397u, 3062905948u, 3871203829u, 749010787u, 2607217745u, 353300121u, 1401305150u, 1076861053u, 3529901661u, 704880691u),
+    SC(501685997u, 195946417u, 130550118u, 1258345836u, 3024004634u, 3235932633u, 2097087000u, 4184930495u, 148157150u, 2012081838u, 3616359137u, 1803274573u, 3935950429u, 2555865531u, 1550309990u, 418255924u),
+    SC(4098042496u, 3465891118u, 3131240546u, 2344269574u, 1201633849u, 137943235u, 1519839915u, 1599911089u, 2533256877u, 2889131020u, 63618887u, 1874891650u, 2448674935u, 700854316u, 3329890460u, 3201661375u),
+    SC(2406606669u, 395725556u, 1445188601u, 1749172505u, 3409437130u, 3243394871u, 1210627561u, 622459681u, 1771106527u, 3622881867u, 2809559268u, 3958805614u, 1533744928u, 141150492u, 3959915853u, 1615357355u),
+    SC(573124951u, 1581105758u, 1716864738u, 157975456u, 1510592594u, 3472294305u, 536976457u, 3332797534u, 2866346119u, 1113085447u, 3348283310u, 2324962474u, 2211467394u, 3741231193u, 2259086040u, 3854836656u),
+    SC(1703280227u, 787719834u, 2171336178u, 2657252944u, 3428307049u, 985798598u, 997435946u, 4064845974u, 2181735355u, 539499262u, 3990473303u, 1995228511u, 3700066623u, 3725719500u, 317946499u, 1828560779u),
+    SC(572728441u, 3848032714u, 2996190437u, 2884657793u, 2867611439u, 3859862329u, 424797215u, 2482404344u, 236531627u, 754068863u, 3867084052u, 3155372450u, 2290781976u, 2832617547u, 3083184571u, 3958974418u),
+    SC(3666674429u, 3837396638u, 3167402504u, 725183636u, 1147147403u, 1894354784u, 2187844354u, 1574901500u, 439361853u, 3812034634u, 1205239420u, 396551757u, 1469535952u, 2338780368u, 1504141345u, 3862930107u),
+    SC(2801216610u, 2236515038u, 4055408646u, 1690626233u, 2907299986u, 2028889345u, 1888132888u, 2451582655u, 2203424557u, 2961998084u, 192698027u, 3258027764u, 774310281u, 444826494u, 3668137271u, 30423972u),
+    SC(544537914u, 815695264u, 1550814261u, 2474495062u, 2706405326u, 2583013614u, 2371202602u, 1002953576u, 3776709354u, 3413654676u, 777583630u, 2154469398u, 811705577u, 2930333742u, 1403920136u, 841809815u),
+    SC(1240290918u, 4209617451u, 1892495727u, 1654961710u, 699030003u, 405147756u, 2249311500u, 2040636899u, 1554506906u, 2920566315u, 3703615902u, 4186347130u, 343392777u, 713255094u, 843820140u, 2155234295u),
+    SC(579464318u, 2717377769u, 2247389863u, 326247221u, 3045246185u, 2384008296u, 1053898274u, 1567365919u, 18754328u, 1754925159u, 85442550u, 2013151479u, 2956953995u, 3608054018u, 1638208202u, 3654008497u),
+    SC(3934596798u, 603058110u, 3635176613u, 1488595875u, 4226616914u, 4291233333u, 3158953663u, 2240123236u, 3185766209u, 4271351353u, 1931896195u, 3349472277u, 636425041u, 1529204655u, 3380258357u, 1103869988u),
+    SC(1461252326u, 2092989759u, 448899412u, 2414807204u, 688596349u, 2753009749u, 1072283163u, 3540185322u, 2565623131u, 4238761342u, 3878521813u, 910534319u, 2801781408u, 2733345103u, 3571715791u, 1772928656u),
+    SC(3747783339u, 3615161725u, 4002350672u, 3075758307u, 270965823u, 2014108373u, 1354677650u, 1266747980u, 1785071308u, 3817132667u, 2159977193u, 1485202400u, 2369388174u, 2680727757u, 1422164635u, 149209140u),
+    SC(269548613u, 1259087499u, 3275341081u, 2157250791u, 2661800974u, 4023876010u, 1232391598u, 2153670248u, 1751792347u, 109163927u, 724607779u, 3333864746u, 3574699249u, 2638053404u, 1067868075u, 3915649249u),
+    SC(2328336466u, 1969698840u, 1778291657u, 1631668542u, 120365892u, 126896251u, 3577896662u, 2673630232u, 3140567624u, 4240427111u, 3516345860u, 3119456144u, 2001958393u, 2636496108u, 1749840585u, 3184640142u),
+    SC(1443796753u, 2295056334u, 3323935732u, 1173401059u, 1866405709u, 35234144u, 1604093586u, 1065651101u, 2660424398u, 1735773287u, 3216765471u, 3327028893u, 1293107082u, 3247366775u, 3162566509u, 3518614831u),
+    SC(2353414660u, 1268116326u, 3432368648u, 2221515200u, 686728495u, 133630462u, 3872982784u, 4126905402u, 3205561437u, 2076332417u, 807090785u, 1589552535u, 2739478565u, 2503752357u, 437331742u, 1755120163u),
+    SC(3532912460u, 4082600817u, 892826183u, 3448439655u, 2132952538u, 4168373195u, 1301093570u, 2266936746u, 2260861242u, 1642064404u, 1675909425u, 3943236879u, 4034978772u, 2922738723u, 3128622061u, 2789895974u),
+    SC(899248705u, 2926934815u, 3345441054u, 3345922357u, 4277925799u, 862350079u, 1282135876u, 3613949237u, 3166610975u, 611044684u, 3284663605u, 2077463514u, 792125679u, 3433095068u, 1502935407u, 3293260448u),
+    SC(218718359u, 1952913789u, 1008340728u, 1156462044u, 676992965u, 3181250270u, 368271397u, 2137285867u, 875230885u, 503765910u, 1764316351u, 3348946590u, 1037322345u, 2659758140u, 3510941451u, 3174991747u),
+    SC(2391235737u, 720038614u, 1882432373u, 1377505157u, 1645369239u, 597841008u, 3219097996u, 2923538295u, 615130941u, 758061499u, 81836560u, 319978194u, 2783864454u, 516346054u, 1408739721u, 1942010840u),
+    SC(3209810419u, 40909388u, 3522119640u, 388783032u, 3592614980u, 139893486u, 221110713u, 2924746837u, 2407654226u, 3066432207u, 3151916608u, 2570403204u, 1494800689u, 1144242959u, 1012967184u, 3483018372u),
+    SC(1874244706u, 158492758u, 582144321u, 1350823766u, 784011611u, 1826405102u, 1768590668u, 2202124911u, 2617833407u, 4191145374u, 3433636787u, 3849894469u, 1183786288u, 3133808690u, 2828660832u, 3090979955u),
+    SC(1968716481u, 2338125709u, 2112266783u, 2951759355u, 498429800u, 1798109341u, 108584802u, 2472637496u, 2186912300u, 2961524479u, 237206653u, 2623970454u, 119529492u, 2554333229u, 4135125824u, 2607413504u),
+    SC(1113659699u, 2782353836u, 2126847113u, 834104981u, 1252770531u, 1627459382u, 3453550492u, 3032543122u, 2292597966u, 1804258254u, 2742608573u, 1424721093u, 1489888259u, 261737464u, 2016417053u, 569197153u),
+    SC(607808959u, 1630075236u, 3182327660u, 2803285445u, 1845468309u, 616233029u, 2319691235u, 183836882u, 640298634u, 1558502216u, 3493861456u, 3911966632u, 1037726797u, 2748908125u, 1620177317u, 538672720u),
+    SC(556519797u, 357091026u, 69112583u, 2816415164u, 1189445164u, 1517731160u, 137040529u, 3636636790u, 2185632711u, 1825141363u, 645711752u, 2830254210u, 1475366644u, 1905957546u, 3812408695u, 127111612u),
+    SC(3664577291u, 569994538u, 2852863574u, 682495688u, 2359862598u, 280846843u, 3248996715u, 1298208635u, 1532741173u, 2410349191u, 1244366230u, 457829417u, 740994334u, 514571530u, 485219303u, 775921630u),
+    SC(3693284080u, 1436697520u, 2776752385u, 787106044u, 1245909886u, 3488088328u, 2259285219u, 4139905055u, 3506015771u, 3876210061u, 1882198541u, 2748841709u, 783657387u, 1612126395u, 2500829246u, 1451327690u),
+    SC(2193808954u, 3356870278u, 2563666869u, 1864574596u, 4003223922u, 4037298071u, 3692482635u, 2835914225u, 478441573u, 3334655000u, 4196744078u, 3254654861u, 210081860u, 740271154u, 1413885335u, 2478331709u),
+    SC(1822613128u, 1961136494u, 3784728058u, 537589914u, 3426983712u, 1782609910u, 1728536905u, 3791951011u, 1861268292u, 2544535005u, 2755445162u, 1474067686u, 3444642205u, 2929110534u, 2578780570u, 2590384195u),
+    SC(3123087300u, 388561765u, 543443192u, 675286779u, 3474016676u, 2428318200u, 2368974675u, 2018630015u, 2527929841u, 523036586u, 3904373691u, 1013108018u, 53761280u, 607854053u, 3592364209u, 2259992772u),
+    SC(2889228352u, 424145665u, 369306970u, 1261450019u, 3541169459u, 3832158885u, 4058656520u, 223690253u, 1401134997u, 4277348484u, 1517651999u, 2709371164u, 492541979u, 2065732479u, 3742833727u, 749931042u),
+    SC(1736502510u, 1528525317u, 1758733342u, 3283311774u, 1096337346u, 767272043u, 2893452406u, 2030345747u, 2596345328u, 836798605u, 768150431u, 895674162u, 1179782487u, 3972509262u, 3774608385u, 811063720u),
+    SC(2503440967u, 3886208469u, 810618210u, 733819961u, 3237438778u, 2871607892u, 3417375632u, 3534108466u, 1470927120u, 2645538348u, 4263165517u, 4234433915u, 3137468266u, 912563579u, 152823075u, 4162412480u),
+    SC(82941375u, 2566751167u, 133076933u, 2614373109u, 1214940423u, 858210654u, 2247195159u, 719161633u, 2775240485u, 29893411u, 1663552227u, 112315101u, 436566972u, 4058987353u, 2825242552u, 1763505116u),
+    SC(3972866001u, 4024969631u, 3525345856u, 2914692046u, 3422884050u, 3619092154u, 3655504305u, 1287435583u, 3962565409u, 1839533989u, 3313332013u, 832102425u, 765161355u, 4290931497u, 324535367u, 2754373244u),
+    SC(3344385098u, 4072882780u, 1922036764u, 4157305973u, 1345222145u, 203349803u, 518816993u, 2958619704u, 3788800438u, 379524158u, 695210245u, 3163252311u, 2631034876u, 1750078648u, 4245095043u, 1667425594u),
+    SC(895648638u, 3220506486u, 1490654818u, 2047976295u, 2935170396u, 474417862u, 921810300u, 1683116216u, 3452914189u, 2544523516u, 3436410043u, 197852160u, 4196207925u, 3397364636u, 4107742566u, 697447640u),
+    SC(3466445381u, 4130248619u, 3537058281u, 2141984951u, 2985488509u, 4217719426u, 2970825084u, 2262082465u, 4141998885u, 875232142u, 1694401824u, 3963071454u, 4239334192u, 3194932089u, 666523157u, 4040262869u),
+    SC(2885824315u, 1223574714u, 2636585612u, 436337290u, 2863956364u, 3845668309u, 1121572579u, 746949138u, 503669672u, 2449002783u, 428466321u, 1939214814u, 421415294u, 1711626927u, 1172020137u, 1925871354u),
+    SC(3520394882u, 3407007658u, 3832436710u, 3681493623u, 1437087618u, 2295112959u, 983145483u, 2790382073u, 454672357u, 2265848113u, 1277408432u, 1902584371u, 23097956u, 2897799520u, 1216714983u, 2246515254u),
+    SC(2039882097u, 3151867796u, 1174121684u, 4189966760u, 2301523275u, 754995950u, 607465530u, 4280060471u, 3098290142u, 714419179u, 1162293111u, 3008107348u, 4266112681u, 3673190922u, 3092339683u, 2075757181u),
+    SC(1146755012u, 596686340u, 3141285235u, 2959188721u, 552383409u, 2208364760u, 3473092156u, 1352481680u, 3076472968u, 2080898652u, 2696959944u, 2130659686u, 1319594305u, 3825837738u, 3813332145u, 1765775281u),
+    SC(1634121209u, 1672082559u, 1605126567u, 2367117155u, 2352598345u, 298937551u, 2968009667u, 255860817u, 3123934817u, 2197991090u, 557729312u, 1321563282u, 2470276597u, 1510235518u, 87129567u, 3911463091u),
+    SC(3446042228u, 680532734u, 2389168356u, 76408803u, 817290203u, 2739778729u, 691100991u, 2334463281u, 2943539385u, 1137419584u, 3827538151u, 1241287149u, 1141463377u, 4045087993u, 3846510608u, 939667531u),
+    SC(3358834316u, 4247744480u, 1188575137u, 496567125u, 1516406204u, 3619193166u, 3896101805u, 86223986u, 2125003019u, 1141973859u, 2832683347u, 353123150u, 3066068414u, 4270624470u, 60967300u, 3383144195u),
+    SC(3424149302u, 808899461u, 3633359903u, 1586868578u, 3826141775u, 3896669715u, 2552234857u, 4066288759u, 3765864502u, 342727832u, 2561321957u, 2848854767u, 4134340469u, 1079372610u, 2200890271u, 640909878u),
+    SC(344852579u, 616284858u, 3061619687u, 67614729u, 2009913616u, 3912013680u, 1200897065u, 2359052890u, 2313698437u, 2631793792u, 2649174958u, 1631119741u, 3070665521u, 4218517230u, 1440736186u, 3259008919u),
+    SC(2601859521u, 2879763843u, 1552472497u, 2460186141u, 217626185u, 1425357438u, 1175322914u, 3200867446u, 958193177u, 1170102746u, 3569915377u, 983682596u, 3628543554u, 2721216859u, 2524914133u, 2901400600u),
+    SC(1755506369u, 1979384275u, 1990845813u, 4282547399u, 2785224564u, 2843000275u, 3912993395u, 239375821u, 356410500u, 3368226270u, 1596365684u, 475633223u, 107399863u, 3799241970u, 1433656398u, 2027947858u),
+    SC(1493078089u, 900047884u, 996357184u, 1396493484u, 1986652578u, 3888312502u, 1815527976u, 1642049614u, 3010004421u, 2453999149u, 1909485098u, 760846967u, 1907105319u, 363304277u, 3013589856u, 1429660091u),
+    SC(2184974230u, 3703429552u, 3218800426u, 431358589u, 65649830u, 237601656u, 863348611u, 1588359296u, 3642050252u, 4081949272u, 3133060821u, 1136606262u, 2284954288u, 3640933816u, 2304561672u, 4071426687u),
+    SC(1247194798u, 3909679368u, 1442741105u, 50413287u, 3598786898u, 1333652655u, 1396497952u, 47269175u, 2120271873u, 867637458u, 295278003u, 932244378u, 824813563u, 771952013u, 35322122u, 3324164002u),
+    SC(1812936789u, 3871667698u, 3294187051u, 2290168219u, 2191936500u, 2682295946u, 1911999035u, 4179886900u, 1552841581u, 2851060648u, 1264246405u, 811264723u, 3779562193u, 3033886664u, 986702669u, 599072828u),
+    SC(3654258476u, 3513796871u, 366862876u, 4050839112u, 76997643u, 1380512561u, 988521123u, 900503090u, 2460467793u, 3024156976u, 198804121u, 3277674487u, 361135760u, 3066292454u, 2960359772u, 1016283972u),
+    SC(1274852498u, 2341592187u, 2947018051u, 3652137017u, 2002331432u, 4243700194u, 2087151607u, 3113474200u, 661260017u, 3973698576u, 3008141898u, 3819582392u, 408200425u, 3832561114u, 2080155977u, 2757563639u),
+    SC(2883475603u, 2889888500u, 1322860014u, 2169919854u, 2094843253u, 3851585426u, 2487228844u, 600061160u, 1577297929u, 731799620u, 3913461626u, 2096038651u, 1175858354u, 1276744046u, 3614748685u, 2174075914u),
+    SC(542991111u, 2056825057u, 394794164u, 2457983520u, 1149432238u, 834543784u, 62107901u, 1382948037u, 1270753628u, 2487104864u, 1804978969u, 3605416956u, 3117070290u, 1432712724u, 2054815568u, 1877268352u),
+    SC(3410775171u, 3865524764u, 1814202946u, 921043741u, 3046527932u, 1170164604u, 999869906u, 1142703037u, 338559606u, 958824096u, 4156751673u, 1974462228u, 1660105740u, 535449929u, 3487885546u, 3810142057u),
+    SC(631370930u, 2146811387u, 989153867u, 1228101359u, 2462904498u, 3737634034u, 3047928357u, 751466407u, 455466387u, 356483905u, 2113123247u, 3381785305u, 918761099u, 680165353u, 1050671483u, 861682744u),
+    SC(573535911u, 2129436886u, 2769406051u, 2790771593u, 1511747924u, 2507892444u, 2311747498u, 710157179u, 2834480864u, 1693448333u, 142236042u, 2254819989u, 2718288004u, 795489426u, 2034606127u, 749777545u),
+    SC(852767373u, 449996059u, 1103040533u, 1765192710u, 933190694u, 2582758106u, 3963403663u, 994966157u, 2674779874u, 848601915u, 1598898274u, 1044873366u, 3747471521u, 3496552717u, 541911344u, 2038965789u),
+    SC(3454659774u, 1766378864u, 991508368u, 107359101u, 410847280u, 3482917652u, 3894826641u, 2180109296u, 2223536946u, 236067026u, 2608298316u, 3903674053u, 4121684223u, 4183102946u, 1271824817u, 1526896416u),
+    SC(3163157596u, 1001058124u, 2821993858u, 1694932998u, 1352617598u, 643713920u, 18699219u, 2806551677u, 4025859234u, 1900917062u, 2049388494u, 1397717438u, 167384495u, 1915140681u, 1360174942u, 1877378165u),
+    SC(1650953408u, 4003642366u, 735361637u, 1412737453u, 968100281u, 3044998640u, 2571171656u, 3719634255u, 2369277775u, 3526677277u, 471208517u, 4016952654u, 2781645497u, 3887908995u, 1731527964u, 933710543u),
+    SC(367009081u, 3325747749u, 1675397583u, 1039804214u, 3749448387u, 1340632970u, 4061788467u, 2260505552u, 525743410u, 827313025u, 3245494579u, 1232509025u, 3891247513u, 4197547764u, 734483848u, 282046779u),
+    SC(1334651721u, 882058637u, 4288210963u, 3827871388u, 1388708099u, 29212345u, 2072983115u, 732696803u, 2357006715u, 1737842102u, 3221585960u, 1066508119u, 512514276u, 560767420u, 3597346382u, 23705407u),
+    SC(3511477018u, 737241952u, 2554214780u, 3721615500u, 990738356u, 4098429807u, 444109430u, 3043958113u, 2585130528u, 2988955706u, 925026926u, 1305983989u, 2201953479u, 629470038u, 300889908u, 2906589456u),
+    SC(891427662u, 3099751925u, 3238880620u, 2617155584u, 38541986u, 3289581633u, 2621345339u, 1727496433u, 1025268226u, 1383378891u, 3178772523u, 2994177623u, 109612358u, 459145120u, 4176240089u, 1006168072u),
+    SC(2196610107u, 477544888u, 4098881266u, 2672048928u, 2213971479u, 1919976508u, 1240121514u, 883482056u, 640589419u, 3265997702u, 1933707293u, 2415928976u, 3894368856u, 2935844804u, 2324814941u, 3915322176u),
+    SC(2443089422u, 2901584438u, 3898819319u, 1949210564u, 2622076490u, 4284244248u, 3514950473u, 275872645u, 1263642958u, 2750027385u, 3449612757u, 2888998675u, 4015197506u, 3347191376u, 1510485988u, 3645225057u),
+    SC(3450646078u, 550393114u, 3203054767u, 2789461602u, 3989454305u, 2901437488u, 1711264614u, 1539566717u, 2863446803u, 2267744106u, 3800838765u, 4199871726u, 593360036u, 3007433137u, 1026695281u, 1857641398u),
+    SC(440731874u, 466639881u, 4091023234u, 2423418632u, 3728368383u, 3059996072u, 4182363686u, 2460349099u, 1383600112u, 2540613683u, 1979996607u, 1274030484u, 3336991429u, 1831195622u, 45293813u, 751474618u),
+    SC(2387013357u, 1451684444u, 2840556497u, 1059506570u, 3910311799u, 4088010973u, 3575726690u, 2151287621u, 3998667661u, 1883369127u, 3363778257u, 3891310262u, 1918096726u, 1628340736u, 2016189174u, 502124365u),
+    SC(2015957242u, 1003926281u, 3671562177u, 1533117545u, 1758861086u, 2047477042u, 2838387635u, 1769881649u, 4279731045u, 3293325864u, 3897307576u, 2490043008u, 1903760639u, 1832854237u, 3997210451u, 1155838964u),
+    SC(44801676u, 3316060362u, 1824706722u, 2498877394u, 1707412136u, 4177956929u, 2928920858u, 3858124426u, 179031311u, 2720353197u, 108851773u, 2777893191u, 408118786u, 2705162697u, 3676549065u, 2818087835u),
+    SC(3494275012u, 1337088802u, 2199964755u, 891627831u, 2694110658u, 1175517093u, 4239506717u, 1669515749u, 2090033471u, 2347780327u, 2259633006u, 3401906822u, 1851429336u, 50745180u, 3810346900u, 2997942094u),
+    SC(3116660473u, 2040323492u, 2770011254u, 3313731988u, 4049059113u, 3375764050u, 3740577667u, 1854320887u, 784818587u, 3346614451u, 4066176956u, 1183077671u, 3517559002u, 2835687919u, 4047153994u, 3398931246u),
+    SC(2428366251u, 4047477056u, 1268616278u, 1566864284u, 1324836351u, 3739397645u, 1694345281u, 678358661u, 2851371138u, 3651684523u, 1273500324u, 2173162092u, 2139863261u, 3108992805u, 1549959428u, 3771671029u),
+    SC(2697172136u, 35092276u, 3224077072u, 1961619711u, 4282517709u, 3704987259u, 2793436026u, 4232600708u, 3304098098u, 3032887092u, 4236395343u, 3921129828u, 3895839414u, 791998015u, 3594577367u, 218707531u),
+    SC(453188029u, 949414086u, 676304028u, 1927768398u, 3174836515u, 3958030963u, 3114972429u, 808012862u, 366739099u, 398699239u, 3858244413u, 1882946330u, 335656562u, 497229952u, 88003887u, 2733519773u),
+    SC(2568285967u, 3912177342u, 2725942100u, 85515456u, 303098683u, 982577835u, 1771234265u, 3218895261u, 2047594597u, 216664849u, 3906942505u, 4210448944u, 1583815980u, 2251500419u, 2564670129u, 3015968875u),
+    SC(979958297u, 1436153400u, 2108662134u, 962369045u, 1469623661u, 2060351504u, 3668892947u, 3723889982u, 1951881958u, 2750769627u, 961523441u, 3764657316u, 3725954798u, 2592785743u, 1557752823u, 3571915401u),
+    SC(3073776961u, 3803610673u, 253260465u, 2982149262u, 1092173292u, 2130781061u, 2644941920u, 1586016997u, 4204620693u, 1725209546u, 1942968464u, 4142378192u, 827541437u, 4044089794u, 2601060321u, 2154201924u),
+    SC(874420615u, 1121470016u, 4143780692u, 1069023134u, 2861802707u, 317299654u, 934828931u, 622284417u, 3298167004u, 2444517767u, 1629273343u, 1982750657u, 3915075226u, 1859602348u, 2249373369u, 2348612757u),
+    SC(2211882053u, 3728012631u, 1074284809u, 1076664088u, 526655679u, 2944877166u, 705656282u, 3296978678u, 2055658308u, 1489566547u, 1591538826u, 346639832u, 3925601545u, 662548733u, 2021397019u, 2715672513u),
+    SC(1326523226u, 21744361u, 2299014129u, 3332676056u, 852588166u, 802159581u, 2752218297u, 648819995u, 3037078769u, 1597056669u, 377496008u, 930323639u, 141004269u, 3193561736u, 1855337273u, 3913951951u),
+    SC(2411419431u, 567271724u, 3932707079u, 2876128638u, 3942332562u, 3229749595u, 2576259740u, 3555601289u, 3665815173u, 3356790298u, 1557716622u, 710630052u, 4011569573u, 2945186487u, 2445878179u, 1720739456u),
+    SC(2152506940u, 3106160479u, 1986026271u, 1408604317u, 677389298u, 4234619862u, 1062389151u, 1419166686u, 3614994u, 4007334230u, 2713202702u, 3941287160u, 2254416749u, 1237884888u, 1125583621u, 3612488646u),
+    SC(2994297962u, 3090982948u, 1796791943u, 90574084u, 1622445783u, 501857269u, 2361489052u, 757748581u, 1726530229u, 2287143787u, 1295323204u, 409635329u, 3681042775u, 2614887455u, 2429588315u, 709482528u),
+    SC(3736416333u, 3055278356u, 3230899463u, 3225833140u, 3404959803u, 419669384u, 546070021u, 920246995u, 416632643u, 3890503286u, 1783325257u, 508036924u, 1079016920u, 1065040679u, 1982465705u, 1297577930u),
+    SC(287044866u, 3514297396u, 3066436969u, 1664510209u, 3950630376u, 1464464847u, 2000932539u, 2608272580u, 3196114218u, 3157834700u, 4030118612u, 1581752561u, 131643936u, 4268196080u, 3213637847u, 1768574548u),
+    SC(2494631747u, 3244053395u, 3906266911u, 3683006565u, 3670993744u, 1733103499u, 23182648u, 3703476901u, 3965038382u, 2739833910u, 1530885929u, 285574863u, 2366143959u, 4053839515u, 3529218935u, 4122897863u),
+    SC(1177005042u, 759461764u, 3309195933u, 1657996139u, 4215947821u, 269771336u, 3551654280u, 243881363u, 2335448461u, 1628485019u, 1937863381u, 1716644168u, 3421150964u, 3353926728u, 978715907u, 3950722634u),
+    SC(432936399u, 3756711107u, 1937076859u, 1574720295u, 1482541758u, 3245517440u, 1971037288u, 696005983u, 84301150u, 3464663361u, 1936501228u, 2288840486u, 2206547582u, 95664742u, 634179544u, 1306922881u),
+    SC(1973683841u, 2190736558u, 2352912344u, 236949869u, 693135406u, 382983920u, 4268609488u, 2879012437u, 1385354688u, 3761168973u, 2168058543u, 1230149815u, 1160149003u, 4087308066u, 2689061205u, 3700193584u),
+    SC(2817231757u, 4014700166u, 3027907613u, 1330279219u, 2295038670u, 2402428657u, 3418323388u, 524023160u, 2245626735u, 3795343228u, 3014994931u, 2493982089u, 608205986u, 2256952520u, 2161101119u, 3179387297u),
+    SC(2780406453u, 3704167783u, 188034324u, 1008334521u, 1822393156u, 1356950528u, 3903404254u, 3017434234u, 4046278568u, 965018737u, 1681087162u, 308334577u, 654069267u, 4246129705u, 1665609512u, 2073391553u),
+    SC(2040121069u, 1221953958u, 1576518158u, 3920690677u, 3747141681u, 2024628593u, 1472240840u, 1140939978u, 359613701u, 923190177u, 3310043116u, 3175027400u, 2863443725u, 578113556u, 1540059933u, 1099913046u),
+    SC(2298380787u, 3070815697u, 3093015262u, 1812318125u, 1109401688u, 1841490146u, 267047801u, 3298306481u, 3445809743u, 2957737259u, 2973974864u, 638190892u, 2305992909u, 3668040464u, 3650961623u, 3748822017u),
+    SC(419106480u, 3486278142u, 1110545086u, 3063195517u, 2434884919u, 1351067214u, 2304081247u, 1340630883u, 1022831391u, 3756569957u, 954764835u, 249065943u, 2163517155u, 1428330786u, 2985462877u, 941004677u),
+    SC(3671798321u, 736424652u, 3488707029u, 3136392822u, 4659706u, 3948923750u, 227646598u, 4023618220u, 2372375645u, 1965942972u, 2960395842u, 974472265u, 1356903216u, 3332848001u, 1033849648u, 4186685655u),
+    SC(4038697094u, 2094899044u, 1799004363u, 238093754u, 2065162396u, 1813789122u, 3624238854u, 2745064590u, 726879830u, 635883904u, 1088222257u, 2552351676u, 1073287939u, 3242974337u, 923573771u, 1593108958u),
+    SC(3691907845u, 776586151u, 3855671891u, 1731104067u, 483787110u, 1686868781u, 1081065098u, 3271342048u, 4287731590u, 2384225562u, 1288936629u, 1763828298u, 574520051u, 2183125994u, 140855265u, 3350696409u),
+    SC(3877416600u, 4218281287u, 904672859u, 1365011621u, 1810527375u, 293670968u, 3075122594u, 854299118u, 2152392728u, 963387638u, 3808189383u, 1572675393u, 2664903079u, 671207532u, 3865586639u, 492831334u),
+    SC(1355920818u, 4155696383u, 995708232u, 1808976492u, 1801278312u, 544848799u, 2295829172u, 3571318156u, 1433203909u, 419038816u, 2260316223u, 179968253u, 1549094887u, 1075896155u, 1848949896u, 1297925956u),
+    SC(3230089278u, 735435092u, 3750518406u, 4064242868u, 2523089030u, 3027277639u, 844308945u, 3156672938u, 2645838215u, 3629216512u, 115582281u, 4007165446u, 629915979u, 3803186809u, 3809874u, 2739959570u),
+    SC(3708827639u, 4085527586u, 3733555453u, 1063821977u, 1296431349u, 512901811u, 2038494487u, 3178064020u, 3398331745u, 1560001757u, 2333784247u, 1731236774u, 446433486u, 1454401010u, 1425807643u, 634178785u),
+    SC(3726809625u, 1741314203u, 4104667331u, 3515840076u, 1112407461u, 1812569364u, 1940507773u, 884330164u, 2509228490u, 2227856297u, 1126429874u, 2923888452u, 2714981057u, 462326759u, 47518043u, 1410476834u),
+    SC(22950857u, 3432875258u, 371351368u, 1889753666u, 4171473885u, 1739119793u, 339508962u, 80608668u, 1094451718u, 3980971357u, 908089398u, 1172614506u, 2778340885u, 3354616406u, 797555123u, 107014432u),
+    SC(1396843873u, 3392949639u, 757326615u, 992063032u, 3691056025u, 3081441220u, 961429644u, 2748759776u, 1860765413u, 3842347167u, 1695008683u, 2006770120u, 552781067u, 2803611831u, 2381034491u, 1627587726u),
+    SC(2191380303u, 2603372343u, 847252415u, 4123750858u, 50904842u, 152529524u, 2687621490u, 2592256764u, 1194820096u, 1117672330u, 1311022396u, 2673379133u, 2883844292u, 102090195u, 891680430u, 1602520004u),
+    SC(3983503031u, 929673649u, 1227078025u, 2902431729u, 3226834106u, 492785342u, 1158571459u, 2330530277u, 3756945199u, 1072006363u, 2342046987u, 1778344473u, 3576573341u, 2742222782u, 417661153u, 2730725044u),
+    SC(1206199192u, 532574734u, 2412583298u, 3744143435u, 1885433534u, 3410564058u, 808612357u, 3225769219u, 2949831915u, 4083204879u, 1746980797u, 501276272u, 396315832u, 1816531537u, 1588473674u, 3136547072u),
+    SC(2955491285u, 2403918328u, 1866404208u, 4125655268u, 3121668776u, 3242053855u, 1241374795u, 2835575570u, 231410255u, 1045202006u, 829285760u, 1398137215u, 2322364708u, 4136418549u, 880622714u, 683773007u),
+    SC(2677619957u, 897106371u, 633408557u, 3284166379u, 2273609451u, 3755763156u, 1323663312u, 3961096696u, 3334001675u, 381190428u, 3597068867u, 778156793u, 3896433263u, 221783901u, 2437133190u, 835238738u),
+    SC(2486922434u, 1494477853u, 4045877485u, 3187481869u, 3460503428u, 4084197454u, 1503632265u, 3711058150u, 3850437306u, 3401776959u, 3559750819u, 625931610u, 2516898815u, 4206211437u, 167212162u, 1340948432u),
+    SC(162588286u, 1773402604u, 1367621028u, 4155877320u, 1498488271u, 1207274084u, 2180772592u, 430767626u, 1783487528u, 396684468u, 3459116999u, 3610459302u, 772230198u, 4158954599u, 1241554224u, 3989130712u),
+    SC(2547838515u, 2631455119u, 2352680916u, 76326630u, 209864372u, 20363980u, 1924040307u, 2757170769u, 1633919493u, 3424698169u, 2326673103u, 3365092806u, 700011078u, 1216494929u, 226677458u, 1961268196u),
+    SC(2716198649u, 647372506u, 2095750182u, 4104239618u, 2039256079u, 729662055u, 697958266u, 3525913837u, 1344752506u, 1785794420u, 3977479169u, 920221271u, 3485498105u, 1000247230u, 3390624539u, 148238749u),
+    SC(1195204559u, 2095046140u, 1392286684u, 1875341696u, 471973297u, 2215125414u, 446186134u, 1531479209u, 881342119u, 181925200u, 4273133315u, 1820514651u, 2315228651u, 3904791120u, 3953640881u, 2413319855u),
+    SC(2618848322u, 1938076368u, 1338782642u, 1884572824u, 3683393043u, 733039060u, 1422204577u, 1201075731u, 762178627u, 2534342777u, 1033973319u, 1499262906u, 3246546230u, 208745515u, 2031351797u, 4239264281u),
+    SC(298720326u, 2437997247u, 3074611238u, 3195276874u, 3982739241u, 1599862046u, 209349286u, 90354004u, 1854296399u, 3929548815u, 2883554195u, 3196812690u, 1744024204u, 2938782321u, 2856020578u, 525312829u),
+    SC(503544068u, 3840073327u, 680772436u, 416402543u, 3722640753u, 1269625293u, 1301961814u, 2036686914u, 465000905u, 885155873u, 707308088u, 2695824222u, 1015131269u, 1006756379u, 1177452965u, 2358642517u),
+    SC(1392284775u, 603494826u, 4054404900u, 262026784u, 1066225758u, 835479552u, 2572278183u, 3221691778u, 73607904u, 1967327264u, 550370201u, 655050682u, 969476531u, 1262107099u, 2453771927u, 3502075323u),
+    SC(3411564805u, 2574588363u, 558865977u, 1232032646u, 889626292u, 3616401999u, 4192851971u, 105034253u, 463422183u, 2780067233u, 3827961681u, 3459079760u, 1899082483u, 1502670149u, 105789715u, 3969100925u),
+    SC(942418007u, 703677784u, 1970435460u, 1563933907u, 3886749709u, 2702998034u, 3469402127u, 3030817862u, 3408390418u, 547819443u, 1847953028u, 1058178707u, 1230571427u, 3769780452u, 2723946110u, 1409520704u),
+    SC(384861894u, 3263499849u, 2407814876u, 3946030738u, 2765971775u, 3002685003u, 1842269064u, 1330532388u, 773138952u, 2297106824u, 877185640u, 631656500u, 1942707918u, 3383582195u, 316600301u, 663959977u),
+    SC(1971961115u, 520762743u, 1429270702u, 1148101237u, 1144628511u, 1718815056u, 1861050743u, 1704993938u, 763629074u, 3547693395u, 509047227u, 21837364u, 67596227u, 1661745308u, 11376485u, 2554735945u),
+    SC(414821952u, 3437640273u, 1038990635u, 205254377u, 2819409397u, 2724938822u, 2583897844u, 3566405776u, 616065613u, 3589094468u, 1907716408u, 723979531u, 2650813143u, 2383073674u, 3479850681u, 707170532u),
+    SC(2350871716u, 2898730742u, 1076943709u, 348030503u, 2498345582u, 271354276u, 3439233674u, 3555439754u, 2812215577u, 2561582377u, 507225909u, 3367136390u, 452051225u, 2463489172u, 384505459u, 2454022010u),
+    SC(2373998893u, 918530743u, 1532328864u, 3493340596u, 739232264u, 2395459654u, 1557316099u, 3267342464u, 1044878471u, 2448585811u, 1292508116u, 2771647786u, 1987159636u, 281901649u, 2241545839u, 22139894u),
+    SC(3937450777u, 4101497176u, 3968140396u, 4073023351u, 4083647209u, 3762628464u, 4145174373u, 1728881224u, 2726129793u, 587807476u, 3673513558u, 851052319u, 938524004u, 1058578109u, 1879526602u, 2092975680u),
+    SC(4279045577u, 3954913186u, 1832592543u, 3576040681u, 157580829u, 3678960027u, 3679661162u, 705299356u, 313587374u, 2132156299u, 3457955077u, 1570469386u, 4208308469u, 1713442851u, 1011061806u, 4206043049u),
+    SC(3633984053u, 1910226203u, 2452882246u, 2332604350u, 3189945120u, 1055305901u, 1117956758u, 943183142u, 635057593u, 2575888743u, 822612557u, 2658103071u, 3679061136u, 1430715234u, 342586401u, 920899367u),
+    SC(4048552507u, 4028410668u, 1128061690u, 2255822719u, 335524629u, 1439910434u, 2663694354u, 2455454717u, 838274593u, 40552598u, 1841915575u, 397010051u, 2328066666u, 544390964u, 446446899u, 986163660u),
+    SC(3650010427u, 760744312u, 1924046174u, 741134554u, 1995719368u, 3769911053u, 2604589081u, 3359306408u, 2664806057u, 1510349168u, 884971635u, 3664540196u, 2467279704u, 2769602595u, 3758193810u, 1977328629u),
+    SC(1438002565u, 2201654510u, 3754091283u, 3745294358u, 2171818811u, 4202158119u, 1480568859u, 3418605382u, 2676262771u, 213474039u, 3080632609u, 430416185u, 525188031u, 1153964183u, 364564753u, 910852956u),
+    SC(3752807798u, 4277616531u, 1153867240u, 4139893756u, 3967130697u, 2728894922u, 677445327u, 3178335718u, 2890593939u, 1155711623u, 4131430292u, 3278738413u, 2142904085u, 425449841u, 897397058u, 1918502513u),
+    SC(2225357987u, 1158713900u, 927076137u, 2708398635u, 2810421052u, 1477495800u, 951579622u, 3321768410u, 4017307008u, 571851054u, 339689994u, 1731226110u, 1854517104u, 213882719u, 2710144336u, 286584938u),
+    SC(3620228625u, 1187541000u, 1037903057u, 694686115u, 741570377u, 2206803272u, 1653713491u, 2804028079u, 2978471256u, 2747154621u, 3285407717u, 1208675425u, 2507780817u, 81237829u, 4165784582u, 277105348u),
+    SC(4260217471u, 2802518206u, 4088002070u, 1464890060u, 3355223221u, 1906502150u, 2684266376u, 1436026141u, 4271602458u, 475486878u, 55890553u, 3128905186u, 1408693581u, 3877920699u, 1053057700u, 129613722u),
+    SC(3483846538u, 3555904618u, 2449615669u, 92551091u, 4182819408u, 1301723557u, 3268790165u, 4010946167u, 4091841994u, 3914934325u, 894406381u, 4292693038u, 718766090u, 1034445755u, 361317810u, 638847428u),
+    SC(2391889912u, 1070997655u, 1895527571u, 3613888462u, 2853536956u, 3638420472u, 53992680u, 3993956322u, 1618590345u, 2349195190u, 3125776863u, 1263215260u, 857930586u, 1157273738u, 3369726885u, 973419803u),
+    SC(2079715254u, 272542768u, 3964581898u, 2615017250u, 2638360572u, 1786748413u, 3198728488u, 51474293u, 4021139033u, 1685659359u, 3851638100u, 628711745u, 750406476u, 894697063u, 3121842481u, 1000806971u),
+    SC(4122608311u, 3081945810u, 1757917621u, 929656953u, 1762268156u, 2312230206u, 2247260192u, 3504922379u, 1714515238u, 2992901697u, 3217238481u, 2636989488u, 2837867364u, 3284636579u, 2944341269u, 2655409285u),
+    SC(1588252147u, 3706496201u, 1831584731u, 4062794235u, 2277576101u, 4045735976u, 1242863807u, 4278207605u, 3409818605u, 2535575049u, 379084096u, 1211223300u, 3012515856u, 2541658374u, 3368178068u, 2904494637u),
+    SC(486431767u, 3101036852u, 1398090662u, 2907779953u, 3509717695u, 1336073793u, 2009442152u, 2789889364u, 1401126134u, 1212594311u, 509911799u, 3810129728u, 2579278822u, 7997588u, 1591649387u, 4246588765u),
+    SC(2460499783u, 2318191750u, 482942418u, 2703298494u, 678381499u, 1155819648u, 1579282595u, 2052963344u, 4276313189u, 4241775362u, 4163308427u, 3247969068u, 213295097u, 247681091u, 1750029557u, 3382304404u),
+    SC(388138426u, 3587520944u, 4107824801u, 56351609u, 1941994195u, 616521169u, 1333046121u, 3402790867u, 1168898368u, 3476382564u, 3770350101u, 3471041038u, 3485634624u, 680216727u, 827073273u, 2863507028u),
+    SC(2904014163u, 2464258987u, 2236919304u, 3213973725u, 824626817u, 973456172u, 1984359283u, 3407234914u, 168990745u, 478361991u, 2002603847u, 3654749519u, 2168047185u, 2305792916u, 3781449548u, 2366002566u),
+    SC(272767806u, 2443487388u, 527231465u, 333779395u, 3258962695u, 3288746514u, 1382533937u, 784198428u, 1402713552u, 2655645949u, 409700945u, 120658123u, 2555811584u, 3670506689u, 2452984454u, 983905049u),
+    SC(3292191994u, 2014652989u, 3703172006u, 107162277u, 780433118u, 504246527u, 963861254u, 568220669u, 1843202506u, 555898891u, 2222785776u, 1571601275u, 511821538u, 1616369792u, 445717077u, 2628509375u),
+    SC(4155088075u, 1614436560u, 1282121296u, 3655850376u, 339955485u, 2460672635u, 1552781318u, 2562693747u, 3437216324u, 1995716922u, 3916261385u, 481771824u, 1583518540u, 3405552392u, 2023991165u, 2803530955u),
+    SC(2596050367u, 1880575651u, 1345909839u, 1244441022u, 4127380758u, 2636421804u, 3004652519u, 235522086u, 1828441837u, 1047656611u, 3559379657u, 4174305994u, 581566171u, 1286305635u, 1634834656u, 3618504204u),
+    SC(2323425427u, 902318195u, 3971264262u, 3029584335u, 3619490044u, 218445253u, 1416346093u, 1549634946u, 622375794u, 151862280u, 1928457806u, 1410615193u, 547021822u, 3539109306u, 128975251u, 568531905u),
+    SC(1892213625u, 2252956301u, 2526118653u, 2251263306u, 3013598172u, 3259431801u, 4280062503u, 2790071358u, 3348306645u, 669780554u, 3962142110u, 4250280079u, 2473366807u, 1325250671u, 2136007457u, 652885179u),
+    SC(3615749812u, 101850848u, 1910361953u, 3028324316u, 2471133927u, 3246753643u, 2507331112u, 822092065u, 2861743492u, 337799497u, 2651880578u, 3114682520u, 682880277u, 1766565420u, 2687621515u, 1587314619u),
+    SC(3253758492u, 699118650u, 3403676600u, 2124997830u, 3076073365u, 2625079128u, 437773543u, 2070236184u, 497946082u, 4057678543u, 2879065725u, 2656700815u, 3155174512u, 2856420679u, 1825673822u, 4226604016u),
+    SC(718753297u, 839234951u, 2254844906u, 840377954u, 3511257639u, 1214875428u, 2276976174u, 1389121797u, 3339482375u, 3726615037u, 1650108371u, 123062330u, 3049804121u, 1267461648u, 1575247264u, 3506403230u),
+    SC(4103137709u, 1914989126u, 1857506851u, 924602199u, 2850237271u, 1957468864u, 1031801208u, 3614705846u, 1416574591u, 2413631111u, 3127832926u, 1277527303u, 2011470362u, 2336530361u, 1671491610u, 2849783146u),
+    SC(542124177u, 2203563671u, 3763833008u, 1442364210u, 2160341445u, 232812629u, 1058157427u, 2552062281u, 969949413u, 1141968418u, 1490708337u, 676527369u, 2492067419u, 1551345527u, 2036771792u, 1183726349u),
+    SC(1855044494u, 3244925859u, 4009072917u, 3571356310u, 3837231769u, 3761817041u, 3137347250u, 4168003221u, 3535934103u, 2298006001u, 373506147u, 2829036616u, 1160797653u, 3523790983u, 719932322u, 2156363261u),
+    SC(3475589064u, 972832944u, 1628245295u, 3789925715u, 971493562u, 2659052033u, 2422705073u, 1805863173u, 1631954703u, 2131547455u, 225807739u, 388925277u, 2377125738u, 320784314u, 2931900594u, 1060619837u),
+    SC(3029304199u, 3935545032u, 1444715265u, 181611048u, 479048129u, 2889640036u, 2903906420u, 4196624113u, 46838579u, 3420486974u, 654153499u, 906612680u, 2672213377u, 3749980011u, 928191954u, 2049779004u),
+    SC(2085314406u, 207039796u, 3838502284u, 1768936508u, 821429582u, 2168811870u, 4086427041u, 1117911079u, 1019094607u, 3188873968u, 956810748u, 3323081410u, 3501048493u, 1603597232u, 149762733u, 2575580567u),
+    SC(3849937768u, 3563363865u, 1646786953u, 126310617u, 2413973073u, 4124419431u, 931825120u, 2232256232u, 122401603u, 3383136552u, 2598928575u, 1739056318u, 530649528u, 3596650646u, 1189885262u, 4140422311u),
+    SC(3751872094u, 4270057967u, 3248195649u, 1849468377u, 1740745510u, 1405605456u, 2667756120u, 4232930175u, 36513127u, 3942791098u, 791088644u, 1751012178u, 3795836697u, 2729052707u, 516439789u, 212141101u),
+    SC(782358698u, 3560358706u, 2413444329u, 2389773184u, 2403743812u, 3474136879u, 591901562u, 2458579250u, 872054287u, 3099766032u, 1477059644u, 3438453938u, 335517216u, 2047034418u, 2412126001u, 244898892u),
+    SC(313398353u, 2166533951u, 2810718603u, 1582948151u, 2875889516u, 4171837876u, 3232046565u, 3580306751u, 2248089042u, 3005685038u, 3727664946u, 2654931546u, 473954734u, 3042268583u, 2456629664u, 488933245u),
+    SC(4249281007u, 3045633818u, 2804647166u, 3737606715u, 307591663u, 1441759856u, 2237946160u, 2512348697u, 3496664174u, 3468044591u, 1623708791u, 3342478079u, 875457402u, 3894173348u, 257411963u, 665131799u),
+    SC(249026878u, 3099644399u, 474603967u, 199371469u, 3349248326u, 2977095265u, 1244204299u, 2134029611u, 1292813066u, 967318586u, 4176897674u, 1948958386u, 3042255492u, 2794250822u, 4083732127u, 2989505242u),
+    SC(4241481637u, 3440277926u, 2683034241u, 1197213405u, 1481734419u, 908391644u, 2642447213u, 244718063u, 2042168333u, 298884077u, 4170799558u, 2569705014u, 3965858378u, 3591247123u, 2614248474u, 3708477257u),
+    SC(2199347896u, 1788582654u, 3533718706u, 2076644555u, 377634471u, 582238224u, 2776257892u, 1263191159u, 343597154u, 2398339036u, 3029024631u, 4165860727u, 659866076u, 2787553270u, 2620484068u, 2572601096u),
+    SC(860130305u, 2823639811u, 3371633371u, 3219180793u, 4180460641u, 4066734003u, 1224980893u, 1324509953u, 3849483081u, 183024225u, 3368714884u, 250083590u, 545968188u, 1876412767u, 1936631105u, 4290310911u),
+    SC(2450133601u, 1843335940u, 360500108u, 1357623149u, 1625261530u, 2979734690u, 1210404034u, 131208614u, 434427129u, 3432114320u, 1026521617u, 3398175639u, 3804981020u, 3771002422u, 2669296800u, 4069330766u),
+    SC(502844957u, 1043794844u, 1063300096u, 3417056709u, 1166247333u, 3300468407u, 4239386158u, 1399528356u, 877524078u, 3814936697u, 1387225440u, 657000782u, 1070312437u, 3161460867u, 1396604512u, 1352247595u),
+    SC(1915192445u, 2885559992u, 331448693u, 3279553830u, 773997512u, 3624768438u, 678111361u, 3549133682u, 3202251243u, 869940445u, 2502466707u, 1175870713u, 682994241u, 205960036u, 1646889144u, 2811706660u),
+    SC(1844427353u, 3777072122u, 2955244024u, 3435675908u, 1018165071u, 651745685u, 2536108690u, 4026006413u, 1299950222u, 569572293u, 2532798673u, 3174360956u, 739806213u, 1495384486u, 2506713741u, 1278478852u),
+    SC(3328701679u, 4111629604u, 1798417922u, 719279038u, 137375258u, 3056705785u, 2427543633u, 3761073107u, 1031523958u, 3457269238u, 4249715244u, 936855202u, 4175308861u, 1383789111u, 1048626340u, 3671280885u),
+    SC(3986589300u, 1142300917u, 2567818276u, 597863168u, 1874633144u, 3871030563u, 1438828335u, 3458848870u, 1691741595u, 3022559787u, 3088716531u, 814943726u, 2080628081u, 516120997u, 2190983722u, 1476832560u),
+    SC(2258857047u, 3870346976u, 868223781u, 1714704115u, 564025326u, 2890215072u, 2968435084u, 829881124u, 3035938266u, 2660980959u, 1309685876u, 2304322397u, 2974266430u, 2040639269u, 324963763u, 3942643513u),
+    SC(774076292u, 1161392115u, 2699101612u, 3121946173u, 4244815746u, 501681668u, 863576704u, 3167529235u, 4147532700u, 3883500528u, 1627677892u, 1002227972u, 4097255132u, 2738237519u, 3233224387u, 1729398097u),
+    SC(3436429644u, 2005981494u, 1378278351u, 295746560u, 2646116999u, 2888657089u, 1754921344u, 547436815u, 2990584671u, 3178061273u, 4080774186u, 4052325152u, 4171877288u, 132057703u, 2177760727u, 473626887u),
+    SC(1997782655u, 159963057u, 3334887021u, 89692045u, 3953455021u, 3089588658u, 398249351u, 909619224u, 2411272815u, 2849385386u, 787412933u, 368751425u, 3344904678u, 1693351316u, 1893414082u, 1950832513u),
+    SC(1418046816u, 56478523u, 2501946613u, 1795708365u, 885471743u, 475625867u, 448161722u, 2761435906u, 502033531u, 511448266u, 1950217774u, 1486033343u, 1472975957u, 3890003871u, 3443759458u, 2527661839u),
+    SC(2778157114u, 3552462925u, 30593487u, 3303560204u, 1092342273u, 4071644881u, 2311693276u, 2968391449u, 890322557u, 939528601u, 506261094u, 1304229008u, 3201029872u, 1985778908u, 3800391395u, 2953909197u),
+    SC(3130110545u, 2880516273u, 1474103203u, 3688037777u, 451037495u, 2160591980u, 3108889980u, 3717320266u, 3486261376u, 1342893563u, 2795451381u, 1331965883u, 2205630991u, 3782843855u, 3789305235u, 222175084u),
+    SC(2918931032u, 2211216339u, 3338482566u, 2512938004u, 1550659402u, 1614787298u, 4211366911u, 2261984420u, 374820567u, 1171795453u, 3305379233u, 2352011921u, 978474835u, 3432470306u, 581260607u, 2064440412u),
+    SC(277123405u, 3715172956u, 2894416660u, 279232053u, 3122598820u, 3774587874u, 2643783119u, 2740329192u, 1698472245u, 843116384u, 1093322445u, 2918770276u, 791377059u, 1493746618u, 3194867589u, 1237474969u),
+    SC(1883939441u, 2599652116u, 396930021u, 193470206u, 2173135466u, 4161241919u, 322755793u, 1852600187u, 2801722035u, 1220614155u, 3297191625u, 3190430273u, 288971508u, 1119517586u, 1676998254u, 2742459988u),
+    SC(1174703297u, 2136812166u, 1545557812u, 2302436995u, 4268273896u, 2485948544u, 1373091894u, 2830025353u, 3629968432u, 2309551997u, 123468230u, 3142552115u, 779511860u, 943829623u, 2757861497u, 2334691069u),
+    SC(1358030526u, 828193569u, 1667727802u, 2241385209u, 131091663u, 1537342582u, 1028945495u, 2013063657u, 4158437334u, 542620146u, 2361543029u, 2647220767u, 635243745u, 1205865911u, 3499490062u, 3999992576u),
+    SC(2127602244u, 1734759853u, 17758723u, 2001261726u, 2488136179u, 96290512u, 998243536u, 174280732u, 2822208101u, 1497309819u, 1148105318u, 2473256053u, 3920866917u, 2785503448u, 647024880u, 96570401u),
+    SC(218340513u, 3999711951u, 1629242141u, 3488726318u, 431136059u, 2985521986u, 3265218098u, 1340853447u, 3675065730u, 351585889u, 1654650338u, 1291701380u, 1852124897u, 363218798u, 2014515278u, 1768780655u),
+    SC(203921210u, 3428187695u, 1160869517u, 2496481806u, 2385932956u, 2866156921u, 2079250448u, 2813366967u, 3452113130u, 3010114118u, 3312276482u, 2610836244u, 142139889u, 4285866203u, 1133607444u, 32775321u),
+    SC(914630978u, 3437479555u, 625421896u, 3726650645u, 2887033216u, 61005188u, 1843446588u, 1682368837u, 1342223352u, 430670586u, 898227098u, 4006961307u, 546149882u, 232451019u, 1463827350u, 129561335u),
+    SC(3517585756u, 864428469u, 436157068u, 1437316180u, 1954963191u, 2246114683u, 205870254u, 1835192553u, 3890339123u, 3693688921u, 3026404726u, 3632530992u, 2200758131u, 2846407816u, 3269882449u, 2813802408u),
+    SC(1329741106u, 1618229740u, 913037055u, 1466362899u, 2778410026u, 2362443952u, 1218389631u, 1544487152u, 1581022877u, 2129218581u, 3226003114u, 657229964u, 3066290264u, 78968046u, 4125218695u, 2766645748u),
+    SC(1806812800u, 4287205871u, 398493082u, 2606737848u, 3955989242u, 2943588549u, 2432809881u, 133196874u, 831367029u, 227617509u, 3514573868u, 2539740255u, 560989693u, 1398506399u, 413135817u, 2255069779u),
+    SC(21009876u, 1192469610u, 1607148828u, 2680087270u, 3157865507u, 808467339u, 3505574042u, 3221843816u, 1685979147u, 912307060u, 2510185263u, 1751631868u, 477799675u, 192894355u, 584889018u, 3859063473u),
+    SC(303115248u, 879664238u, 1250919199u, 1812494454u, 2302875930u, 954858371u, 2334528432u, 1264472867u, 3826555586u, 3410310105u, 1278918498u, 2934233785u, 4210442341u, 2312102158u, 816064902u, 2522325968u),
+    SC(4187185356u, 3270330384u, 3624498411u, 3941292541u, 1327601575u, 2220454555u, 1333117808u, 2345293624u, 3106549598u, 2262268554u, 3267475960u, 1847161307u, 2691580948u, 2471502043u, 3234347666u, 4000259251u),
+    SC(770595406u, 3357163212u, 1215435051u, 3193173278u, 1689155484u, 1229489511u, 2790582278u, 3934297252u, 506374305u, 3748480961u, 3232373711u, 4291765774u, 3186249059u, 2471490481u, 3165774244u, 3342682452u),
+    SC(96118434u, 329182072u, 4103485687u, 2967228432u, 3073804497u, 3151447717u, 4063767675u, 222695977u, 1919382403u, 279139057u, 2670360013u, 2655146143u, 2961837225u, 1612007059u, 3422672277u, 635217949u),
+    SC(2750906041u, 840778966u, 3077875443u, 2972819014u, 4128051244u, 3647903804u, 2407884986u, 2190556528u, 4181554655u, 2188502799u, 446924336u, 650035664u, 4141553509u, 2001141879u, 3556567950u, 1549875717u),
+    SC(1186621109u, 4196373108u, 932173357u, 1756274488u, 2240337766u, 3955136475u, 1928923213u, 3354578696u, 88555044u, 813218015u, 2464127829u, 1387090005u, 4098619362u, 3975182427u, 1926979033u, 596154361u),
+    SC(3681157702u, 3721331296u, 2998146486u, 4115790544u, 197964124u, 3390663412u, 689775054u, 3464551410u, 963433542u, 4181597335u, 2775347055u, 1674381670u, 1602782575u, 3881704574u, 2844103039u, 676928828u),
+    SC(3090124060u, 2812451034u, 965919973u, 2377784075u, 941129400u, 1721314956u, 1556203572u, 1852608417u, 1259005802u, 4189077820u, 2370821085u, 3681975402u, 2981627273u, 1396588256u, 686514230u, 21509217u),
+    SC(1148098212u, 3700581551u, 3922486088u, 2858494049u, 3506896343u, 3086980257u, 2195779608u, 3297112064u, 853533657u, 559495768u, 534920062u, 3438704573u, 661767180u, 2786239751u, 3370335728u, 2572584000u),
+    SC(13135632u, 2080009676u, 3119516835u, 1179666910u, 1552563820u, 3629899704u, 450501945u, 809119417u, 3863965798u, 2123434004u, 182553706u, 1931691853u, 2647336830u, 1252687576u, 2293949614u, 2083791261u),
+    SC(3201887086u, 3449897625u, 3838678220u, 539748280u, 2449588907u, 808082651u, 2212885946u, 3681343248u, 359886074u, 3010831372u, 1563851679u, 1720874093u, 379711548u, 546574934u, 1887734181u, 1564547756u),
+    SC(3018827762u, 3321277712u, 1106342325u, 2910164096u, 1717439058u, 3733104769u, 3659081440u, 2405749647u, 1039547524u, 846600740u, 15404538u, 2929254452u, 3067859809u, 66802687u, 3308649160u, 4279662566u),
+    SC(2957381024u, 3448150879u, 592581544u, 1239499745u, 2410262465u, 1696524577u, 3957084765u, 655739858u, 3239722669u, 4082374775u, 3463689408u, 727167641u, 1186230878u, 3479375598u, 2254156065u, 3094337518u),
+    SC(682661143u, 2708755134u, 2999030151u, 316014804u, 3029766739u, 2815481130u, 1238287310u, 3611017329u, 912877320u, 121402769u, 286668056u, 67827092u, 1090508496u, 1762515687u, 4243039293u, 3911230246u),
+    SC(1377561816u, 422234968u, 128874167u, 3233748986u, 181955324u, 1192589139u, 1796886960u, 4223004982u, 1686787270u, 3618631998u, 3436132766u, 356849282u, 3993399566u, 3992135273u, 499646083u, 1974240653u),
+    SC(3082557904u, 3086851429u, 650755233u, 3045578830u, 2728525991u, 1993576578u, 915109407u, 2046218087u, 1524562622u, 3771779279u, 1112720026u, 1999725494u, 1243521022u, 4290765741u, 796487309u, 527477934u),
+    SC(3834526693u, 460105941u, 1106297409u, 559254764u, 1725660013u, 3242094868u, 3700629261u, 964356747u, 3687801687u, 1528226545u, 821060799u, 4279415909u, 4140513854u, 4193731633u, 1274289790u, 235874476u),
+    SC(60147422u, 1908839078u, 2737075606u, 2385048229u, 1321702837u, 2539251856u, 2603565712u, 2672121681u, 3999138072u, 63430050u, 3253654753u, 1523193183u, 3048249316u, 1234944963u, 4244384901u, 2791940413u),
+    SC(680757955u, 2971157401u, 578032273u, 2618289206u, 1715315626u, 2320402856u, 442893611u, 3397422489u, 1256775290u, 2985017790u, 2730405297u, 2160826896u, 3658908309u, 3122570744u, 51427718u, 1326925315u),
+    SC(96531992u, 2515045622u, 542405362u, 1042802771u, 3191535183u, 3500373749u, 2233724523u, 1380513188u, 3193715797u, 3439979443u, 3073782870u, 2681950459u, 2222187480u, 876733988u, 3021675581u, 3830179099u),
+    SC(2883712959u, 584120115u, 3978879269u, 4159505850u, 2922286867u, 515518144u, 22367660u, 1581031895u, 710559963u, 1038294890u, 2533949412u, 3113667379u, 3847481013u, 2511253500u, 2441781956u, 447785806u),
+    SC(3271828519u, 1473474739u, 2031241479u, 3932197161u, 1595784940u, 1143628617u, 3167736476u, 3767372775u, 1738952371u, 1041226357u, 1398486498u, 4173955357u, 1384733121u, 703131972u, 2344049897u, 2978384180u),
+    SC(1705351494u, 896475549u, 2007960426u, 2652521463u, 51717958u, 1794382881u, 3356832510u, 826340792u, 1692865165u, 1564364704u, 1368191615u, 3228621344u, 378712153u, 1032086559u, 610510364u, 1962105112u),
+    SC(1820143163u, 1212320903u, 1185965810u, 3147422224u, 1613831351u, 3571114398u, 3727603007u, 336860130u, 79316927u, 3269969520u, 1306691149u, 517452675u, 677548798u, 687327147u, 711347147u, 1823990689u),
+    SC(231888829u, 3114043842u, 3027736745u, 3163815767u, 1448442239u, 2756942287u, 1152185742u, 2482884057u, 4174803186u, 2837479205u, 1390928087u, 338202883u, 3893972865u, 1670439116u, 452111926u, 3249792175u),
+    SC(622199630u, 3101541412u, 1117072271u, 2899606626u, 1747433596u, 2962171454u, 2997532134u, 3972152699u, 2911799417u, 4127123975u, 2905949628u, 2805062960u, 3173692724u, 1263036454u, 1128035745u, 1645653150u),
+    SC(2121412692u, 666210787u, 2979542195u, 2182213057u, 2131186197u, 1704040459u, 2424163850u, 3644073069u, 1553071291u, 3636561062u, 4061557215u, 278427147u, 621199080u, 3810817251u, 990380359u, 1315153695u),
+    SC(455056662u, 2889616682u, 79197841u, 1168570043u, 2370811263u, 4020106046u, 1924518809u, 1842448779u, 1682095902u, 100656208u, 2974431646u, 371464794u, 367608915u, 2488376273u, 38603367u, 4082846491u),
+    SC(3773954638u, 1473112643u, 2746873457u, 1499869638u, 1706366029u, 2479168035u, 3909119075u, 4236717867u, 3359134203u, 1418267924u, 794842647u, 22142279u, 1962517470u, 3441940580u, 172605814u, 2939348324u),
+    SC(183065531u, 1769767434u, 622474855u, 2996871288u, 1089445927u, 2581052683u, 1050284779u, 846367802u, 3772496535u, 41945453u, 2263502249u, 1169051805u, 289464540u, 2072002320u, 3867521352u, 1806613313u),
+    SC(4237293701u, 3576624172u, 535112170u, 2235562179u, 184209838u, 1853823792u, 1776500854u, 1747643697u, 1381945044u, 2993590114u, 2073055003u, 861327386u, 164425073u, 1126877264u, 1128139364u, 2984500500u),
+    SC(1712526186u, 1167942234u, 224089939u, 982931980u, 3983070780u, 325395782u, 3324627635u, 852027408u, 284336120u, 617810580u, 3017224884u, 991333330u, 682937089u, 1074939547u, 2477360443u, 1700488651u),
+    SC(1158174997u, 2070426407u, 3345156531u, 2532260707u, 433956929u, 4139654033u, 4065286711u, 3723122416u, 3114734662u, 1481279716u, 1779785268u, 4035795563u, 728677311u, 3031542290u, 3150406991u, 2442487841u),
+    SC(378463165u, 2400238093u, 3736610166u, 3445495569u, 3193483084u, 578045519u, 238220279u, 2089435941u, 1861164643u, 1140801695u, 2836826396u, 2553251584u, 1180676484u, 1478539398u, 1756840450u, 1719186252u),
+    SC(3004767639u, 1983652673u, 1320475533u, 3944743908u, 4258818892u, 1618449179u, 1904224020u, 4010052612u, 3031183493u, 1509520842u, 3195884504u, 1052628419u, 3462947030u, 930155012u, 4169508924u, 3256168157u),
+    SC(3667745883u, 1316215955u, 1014148298u, 513012923u, 1053063164u, 4060154218u, 1374290470u, 976193336u, 2142675674u, 1710843587u, 1755026352u, 3593889041u, 1074529744u, 2332693941u, 189477385u, 2819815594u),
+    SC(336483794u, 2816956024u, 395408143u, 206726256u, 2367486624u, 2504925532u, 31873996u, 3836796262u, 1274781912u, 1676289431u, 2447667416u, 519267096u, 2279790053u, 3365376395u, 3464517953u, 156489139u),
+    SC(363449590u, 1268108423u, 3471424769u, 3219380415u, 3023632376u, 1714702876u, 4092828139u, 380728280u, 1330934477u, 3186355493u, 1616794107u, 4038269587u, 1561044378u, 1850851216u, 3761650829u, 2612215611u),
+    SC(3899536971u, 1735815197u, 3082015704u, 4208034236u, 3354222225u, 755665039u, 2169285181u, 2293198342u, 36688992u, 184288269u, 1050236184u, 3324537225u, 614754001u, 1247955221u, 4164207447u, 1307212690u),
+    SC(1009130136u, 3441815771u, 589370188u, 1916714215u, 2985827642u, 2799025627u, 4230492078u, 1515196086u, 730669381u, 1581875729u, 2320199383u, 3969295980u, 1076339974u, 3736005820u, 1163091909u, 2007751105u),
+    SC(1236707345u, 1297462551u, 1824202604u, 393915644u, 915159901u, 37236747u, 3596961517u, 4106835400u, 3518047396u, 166782913u, 112779265u, 2132478762u, 179913745u, 958225354u, 1532188728u, 2743163796u),
+    SC(1858660449u, 4040418725u, 1067313846u, 550259585u, 1827569695u, 4154736497u, 4081749420u, 3307599545u, 1121997915u, 1758244797u, 856278263u, 3949682353u, 503425137u, 3326062119u, 2015363499u, 2799500650u),
+    SC(1933751105u, 1504486863u, 3540361954u, 2834386340u, 1263697495u, 1178664474u, 3230177450u, 1167440300u, 3039171330u, 3527683810u, 909732264u, 1319506561u, 670453568u, 2894518977u, 565563956u, 1393951012u),
+    SC(2217423037u, 1424962827u, 1708981315u, 3743848060u, 2993977175u, 2785658187u, 1753034937u, 1516793769u, 1341824658u, 749352633u, 3975356259u, 4123582039u, 2103005052u, 1911023483u, 2630200451u, 4080462550u),
+    SC(767181661u, 3582568391u, 3158291981u, 1230460911u, 2081667850u, 1049731411u, 2576932940u, 435767394u, 3292557838u, 2763144377u, 3526945953u, 1735779584u, 2468167260u, 2113426413u, 1439516809u, 1586282657u),
+    SC(2636023076u, 2407845467u, 712352855u, 2173931710u, 3139981245u, 1023630343u, 2576170053u, 3342593026u, 2386619980u, 3375746220u, 590920648u, 1249928179u, 1835198671u, 2224815936u, 311953228u, 2498469549u),
+    SC(3530775237u, 3522930523u, 3572906258u, 290756437u, 2592048675u, 1659002100u, 3882181330u, 3635691951u, 198356022u, 435811129u, 2008533774u, 1532163045u, 3031296109u, 480228125u, 2715351862u, 2108670081u),
+    SC(2954038840u, 4100783891u, 2904189139u, 359830421u, 2994482070u, 3769194445u, 3395530238u, 2963530010u, 1033857407u, 1247887388u, 2280650820u, 991000426u, 1628378390u, 1130807733u, 1398118816u, 208315332u),
+    SC(3769239087u, 355494648u, 3059931379u, 998891147u, 4120881784u, 697576618u, 3984778856u, 904689319u, 3321229493u, 1856467716u, 2782919562u, 3402204039u, 875584340u, 637297025u, 2040808830u, 3244191534u),
+    SC(3977651905u, 2833699273u, 410916292u, 2929227244u, 559339141u, 2574959635u, 2672082187u, 26489557u, 1007520091u, 2647345727u, 1110828337u, 4000543735u, 2131733830u, 3314781566u, 1775567913u, 1911604061u),
+    SC(2731330609u, 1310260655u, 2361547430u, 1959359736u, 1715946715u, 2262846440u, 1125986000u, 1305028659u, 3057716809u, 3604247022u, 3524154678u, 2255680996u, 773561480u, 3227793576u, 1187227471u, 3344553756u),
+    SC(1543248175u, 3675649580u, 1257345305u, 3000593032u, 3014807046u, 1028961055u, 2740938587u, 4134059815u, 1182221172u, 2897535296u, 2420317107u, 2674041738u, 3688946786u, 1075962427u, 1620697496u, 1205440593u),
+    SC(1719937673u, 3665019908u, 849536339u, 2549067785u, 1642799445u, 2288699662u, 2547693040u, 153251880u, 982418371u, 1360961608u, 2295520413u, 4043402457u, 3658947526u, 2311696206u, 2427551889u, 563355113u),
+    SC(3967955351u, 1000955800u, 3563030929u, 1055439147u, 3819219021u, 3583197943u, 403732075u, 3452245736u, 1395473529u, 4111548238u, 427015304u, 714423133u, 2010466157u, 2895737518u, 4057095705u, 2876376830u),
+    SC(996540024u, 3159449974u, 2933253558u, 1597952927u, 3907576428u, 850069421u, 448942495u, 1929122827u, 2238527198u, 1368451996u, 335018358u, 1181717982u, 1449795543u, 827124763u, 2627697375u, 2552270232u),
+    SC(61607626u, 1371813157u, 3924116942u, 2214449161u, 4193459891u, 656587077u, 405151798u, 3515663174u, 3698459019u, 3283264719u, 843378481u, 873335108u, 844884936u, 2973032016u, 2595422794u, 2719197158u),
+    SC(1227449741u, 1817242854u, 3990018940u, 561880032u, 3168454841u, 3142620975u, 4226103812u, 786576648u, 3853296684u, 1638579156u, 3092601216u, 2721220417u, 1845267960u, 3617655866u, 1921301904u, 2865677194u),
+    SC(2635523951u, 1271489682u, 4041860936u, 2355962519u, 2016469675u, 1226465912u, 492874587u, 356147857u, 3864596224u, 3836504354u, 88302360u, 2540744437u, 1588238474u, 72259345u, 3664930540u, 2304427947u),
+    SC(2959383626u, 321382394u, 4113210302u, 2147056349u, 1309913962u, 666920813u, 1577693880u, 526252365u, 2568782614u, 2800969800u, 3765608576u, 2012699274u, 3617578248u, 442526994u, 188046396u, 949071069u),
+    SC(2400799265u, 4130356717u, 748479772u, 1151639915u, 3946424566u, 100537289u, 1803293373u, 2958173021u, 3172856784u, 3383722722u, 1415248675u, 3919764613u, 3325368108u, 3992875249u, 3178585382u, 2536534942u),
+    SC(497490583u, 3430567129u, 1199044291u, 3713951323u, 947042081u, 3334612522u, 1625849629u, 4024573936u, 2026994241u, 956526106u, 2062727599u, 309571563u, 172830952u, 1722017512u, 2131559528u, 79587846u),
+    SC(167695203u, 3834901090u, 3555699633u, 3307377095u, 3763224603u, 2978031887u, 2050469692u, 3750144581u, 319603518u, 3781471743u, 3202029607u, 1784452703u, 1403342646u, 2430586220u, 3019896886u, 1883105065u),
+    SC(3513183437u, 572274024u, 429833272u, 4240138560u, 2053118522u, 3253184911u, 3954662023u, 2812404895u, 639771319u, 3888251069u, 1573832034u, 2236109876u, 2959248508u, 3461645257u, 2474205046u, 2691887214u),
+    SC(3884268733u, 1043820737u, 3425728569u, 692727438u, 3113788782u, 959722956u, 691048970u, 2379997437u, 2037901002u, 1729395908u, 2522687768u, 270779324u, 3488737201u, 2409923851u, 2158051574u, 2551077518u),
+    SC(2830171825u, 3407086081u, 736771285u, 1796873986u, 1359178983u, 69465361u, 1208961477u, 1646764415u, 3436692443u, 2637870811u, 1825500630u, 3548388495u, 1739581330u, 210335669u, 667540730u, 1975159455u),
+    SC(1473142233u, 3783350101u, 837354873u, 1962249112u, 1828905990u, 2823203622u, 3372588908u, 1456871383u, 3426009232u, 1134162710u, 647338232u, 2861538029u, 2191483378u, 1593613252u, 3897666659u, 4262735124u),
+    SC(1201115318u, 1331756141u, 3204168733u, 911913956u, 2155329222u, 3421515565u, 1821087855u, 3506030680u, 360663426u, 3814201637u, 3710203946u, 3823407014u, 1560252698u, 2515124035u, 1576579926u, 142552987u),
+    SC(89832571u, 536742465u, 562148898u, 2168186732u, 2397085898u, 1018395420u, 3408285831u, 4294016104u, 3172155977u, 602491987u, 1291445763u, 169726553u, 1617064639u, 2189685462u, 1774116172u, 2842810783u),
+    SC(1822941234u, 2348144250u, 3087324209u, 241135774u, 3174127328u, 491065818u, 499544980u, 617801305u, 3291001139u, 4083693833u, 1699857151u, 797379968u, 3624577780u, 1831541353u, 124919895u, 1590306375u),
+    SC(1625233833u, 2213087340u, 1287463098u, 4222593202u, 879420654u, 2619004125u, 2576719505u, 771043539u, 3672619092u, 704124832u, 1109143326u, 240029261u, 2694668536u, 2221940273u, 3618158512u, 997837896u),
+    SC(1863898382u, 1593176749u, 3134721697u, 3315218503u, 1545797381u, 112874183u, 3788664173u, 3546835918u, 3520588303u, 2707877840u, 4207893635u, 3157755616u, 3555934301u, 1531279605u, 329463469u, 4040677289u),
+    SC(3056917661u, 1591022390u, 1254708890u, 2380196313u, 4242530318u, 1709543987u, 3015608839u, 802769376u, 3610134242u, 3323667829u, 4066005084u, 3183691118u, 4260465014u, 1700962727u, 243716150u, 3945913193u),
+    SC(1513618672u, 767173875u, 3865338225u, 1138476459u, 1087969667u, 1777717006u, 1338337021u, 2537838864u, 2841694680u, 335049836u, 1714066818u, 1632401479u, 870716733u, 695585625u, 3274974307u, 1975950622u),
+    SC(2326730407u, 925990962u, 3322020278u, 2979453181u, 4008415119u, 447424993u, 461614619u, 4044514844u, 3294752598u, 1722000551u, 1446822082u, 2220829415u, 1828956053u, 2558288221u, 1629203272u, 2879032900u),
+    SC(1164905381u, 2690586095u, 3644751689u, 3765607493u, 495298195u, 1120043085u, 2631186606u, 2942186548u, 2793469097u, 2569149067u, 2135349779u, 319036950u, 334894781u, 2226721627u, 2969038002u, 1930545877u),
+    SC(4170987169u, 4052767753u, 1978746585u, 836840633u, 1274923279u, 2709034762u, 2634757323u, 955631425u, 995503232u, 1491278738u, 2702730773u, 2619341371u, 1260254092u, 3947501126u, 1469916021u, 2621704603u),
+    SC(2137778961u, 773686784u, 227297539u, 493473716u, 3795351270u, 854787112u, 2636915971u, 1106507626u, 2710795271u, 3230817020u, 3197717403u, 1365408664u, 148475606u, 3905908665u, 215863532u, 2768194203u),
+    SC(2421870762u, 3045443523u, 2025263883u, 2904379393u, 269546819u, 424624339u, 2189280774u, 316093713u, 3217950465u, 3286093112u, 352399534u, 3910997716u, 2756149791u, 2732628138u, 3090907173u, 191985577u),
+    SC(4116300497u, 1645359050u, 1912727459u, 190854097u, 3846277108u, 1968222894u, 4057273633u, 4148202348u, 1058068002u, 3755010836u, 2137982172u, 1125155443u, 1989536322u, 953079794u, 1572956077u, 873809025u),
+    SC(431171748u, 4195816604u, 3433977904u, 2831081299u, 2081262092u, 3277939525u, 1867354576u, 1905060020u, 2585585674u, 709781795u, 1771198595u, 2390255481u, 4261379849u, 634816597u, 308563204u, 2656579428u),
+    SC(2947258528u, 3881179580u, 3955932196u, 3248922815u, 658756852u, 153222739u, 976827976u, 2913819978u, 3206232711u, 1972451749u, 2037652489u, 569547280u, 2089704419u, 332879637u, 2113747390u, 2453287643u),
+    SC(3268067196u, 495362893u, 2916824793u, 3359280841u, 3001016558u, 2172047493u, 3433635800u, 3997270471u, 1530050340u, 1408316252u, 1917085117u, 1859041525u, 362459472u, 3922293420u, 4112328618u, 1301350159u),
+    SC(2458096676u, 2391045202u, 698926388u, 2081699166u, 1332649210u, 739912676u, 4121783548u, 713684371u, 3147585629u, 4248956422u, 2580183882u, 342863720u, 1368931093u, 3595757974u, 3364397425u, 2089564679u),
+    SC(3164767548u, 949940612u, 546093668u, 1635506093u, 1441095442u, 3502897994u, 2833002704u, 3342630394u, 2671847582u, 4079676909u, 1027970347u, 379989946u, 4271510574u, 31871808u, 391679353u, 3789513634u),
+    SC(2766830554u, 2494916008u, 3958717162u, 1558606533u, 1464186813u, 936015844u, 2699358849u, 1908365053u, 3377493125u, 335932048u, 2610829864u, 1120245054u, 1654583089u, 935006128u, 2534198890u, 2302580412u),
+    SC(1903197509u, 2943423390u, 3610410221u, 144319491u, 3663184266u, 2233973535u, 4149536652u, 1624629609u, 615736452u, 4266501875u, 2750735528u, 1436841949u, 1055854393u, 4248590431u, 463333847u, 270679801u),
+    SC(1388436995u, 43447697u, 2640114898u, 918093649u, 1528782838u, 3610388672u, 2111467630u, 1340054021u, 3684011353u, 225695092u, 943744740u, 4255364997u, 3377501972u, 2422242385u, 902943565u, 1513377038u),
+    SC(2064236720u, 2018699333u, 812194185u, 3419192199u, 1960583175u, 3749867808u, 3635538530u, 594055471u, 1323259671u, 4291110935u, 3505307371u, 126007885u, 156523100u, 3667369787u, 3921714820u, 4163621475u),
+    SC(3919081678u, 2996490664u, 734038068u, 1044069379u, 4067324002u, 1723016512u, 1746692253u, 4290261002u, 2155916690u, 2022997349u, 3166776764u, 1632442280u, 2415353405u, 2434994093u, 3338110376u, 3445194655u),
+    SC(3353490029u, 3800793401u, 2245741753u, 3285501422u, 768787133u, 730932292u, 2915279924u, 542914791u, 1596482553u, 3451964565u, 532180992u, 3782725381u, 3541753740u, 1413319069u, 425457121u, 3333264398u),
+    SC(2285213384u, 1286061432u, 1012427773u, 687580297u, 1282127467u, 1587880516u, 295286109u, 1044347237u, 4212214760u, 1495621392u, 3379391818u, 1922325193u, 1201811291u, 1760361158u, 2483469538u, 1491675182u),
+    SC(2138285640u, 2710978805u, 2968529373u, 937782911u, 1559631449u, 1582509519u, 2147399651u, 4060824268u, 1333142666u, 4180782815u, 3034767166u, 3124445805u, 149887259u, 2639876223u, 1251278760u, 2164215787u),
+    SC(3365856074u, 912314426u, 3459995140u, 18442854u, 415789978u, 2319947197u, 3684448298u, 2537663037u, 2762193032u, 905686103u, 4076313289u, 3505334575u, 109283172u, 3114131588u, 1749883797u, 311572612u),
+    SC(616451158u, 3621522510u, 1342508276u, 836247321u, 3049547913u, 1124426749u, 1449938643u, 3644970428u, 3765581538u, 1228288349u, 1594299554u, 2937771881u, 258629575u, 2775564747u, 2886312069u, 4070466067u),
+    SC(1815209758u, 3400080384u, 2039408069u, 842508786u, 677816605u, 647194706u, 3303774291u, 3825964277u, 1706029859u, 727657681u, 3239149066u, 3272316137u, 877935833u, 1208973602u, 1461961605u, 2630847703u),
+    SC(1349269308u, 2222549309u, 1040433186u, 2606859167u, 3832587636u, 3542065798u, 2455772887u, 2388178919u, 1339080659u, 2776387637u, 646698158u, 1887432323u, 3796862582u, 3774866378u, 376699594u, 28814181u),
+    SC(1507436019u, 3927600326u, 384282775u, 2266985244u, 1465326089u, 499129157u, 3029095218u, 3380824484u, 2494379838u, 3999569603u, 641479823u, 176088377u, 1403707155u, 447133240u, 566324749u, 1442612295u),
+    SC(2770653099u, 1698109000u, 4131492143u, 2798544853u, 3338179229u, 912541910u, 1306755507u, 584539241u, 348286969u, 2281428377u, 396799632u, 3152529306u, 2887475544u, 3287572804u, 1906980521u, 1165502499u),
+    SC(309106797u, 4164707079u, 2277561260u, 1785406355u, 2326003156u, 3743868778u, 2460953701u, 2135475536u, 2156214739u, 2775216015u, 1003422941u, 833385184u, 1064610589u, 1587215673u, 2000774507u, 1028414556u),
+    SC(852147136u, 451661746u, 2115673435u, 1288721744u, 3640600023u, 3114802615u, 831014730u, 216241954u, 2100302346u, 3766497732u, 19662607u, 1860613418u, 3189313569u, 4205442491u, 2507603633u, 2411515625u),
+    SC(1071520954u, 4158576376u, 2844358059u, 2908382378u, 2325678180u, 383526362u, 899554552u, 586427492u, 240188588u, 1643180404u, 2968075438u, 1762792140u, 1157623201u, 1625096081u, 2665728352u, 794476661u),
+    SC(2628592330u, 3603161020u, 30646413u, 1796220711u, 921295671u, 518124139u, 1021915847u, 289812004u, 1525174045u, 2268974340u, 2131198411u, 179026771u, 1110159641u, 1314510246u, 2284116885u, 1346772075u),
+    SC(159748128u, 2860545574u, 982294926u, 2445389741u, 203476895u, 2454307406u, 476392729u, 2102948591u, 1162028029u, 564886894u, 1191802615u, 763755065u, 2693064683u, 3006459350u, 2748339384u, 3553050217u),
+    SC(2182519203u, 3888892885u, 2729481142u, 3357878300u, 2885729363u, 3293262761u, 3636665246u, 1179562678u, 4157971479u, 604031899u, 1924418748u, 3149741727u, 3861705809u, 3169253440u, 598766507u, 1722380906u),
+    SC(3171341502u, 910309474u, 2036320165u, 1548275384u, 1141587139u, 4230507949u, 1961525101u, 2362667225u, 990452026u, 266136712u, 3393869411u, 750485647u, 1639649875u, 4224522004u, 181196040u, 1636022542u),
+    SC(745607911u, 2626471821u, 4031401680u, 3762538186u, 3142284109u, 2440558626u, 1539576099u, 1270740178u, 3357331373u, 3559793224u, 1980926026u, 3640718878u, 3135390447u, 1711217405u, 1845750850u, 943264323u),
+    SC(1370372367u, 2791143212u, 2201795468u, 2648677611u, 3086295918u, 4053285125u, 1982560943u, 3777106718u, 1031577472u, 2151705350u, 674179720u, 2279323412u, 253662945u, 3897470664u, 307683752u, 3984302190u),
+    SC(3315458322u, 3726867011u, 734757704u, 3820163926u, 3343066738u, 1804691361u, 2010654436u, 3670825450u, 907058966u, 2086581869u, 2668216793u, 3319883628u, 2855527427u, 2833273520u, 676644489u, 3582999333u),
+    SC(2342122042u, 3075513755u, 354203802u, 1165307942u, 125608422u, 2451173623u, 1473255459u, 4116109688u, 2258836141u, 4114284100u, 4113813262u, 1271748412u, 3543720239u, 2420936346u, 3700293760u, 4117381476u),
+    SC(1281822565u, 2104469949u, 2665747290u, 519145518u, 1643510652u, 2649663255u, 972950201u, 2016845269u, 1394246182u, 1565217635u, 310861249u, 133730769u, 3041788981u, 458464723u, 3238049687u, 4024849431u),
+    SC(2392227381u, 2645168021u, 4251985126u, 3850307136u, 917428700u, 2649813821u, 2475216605u, 3774055752u, 922223963u, 2778397349u, 2357770291u, 3121677185u, 1174014641u, 4027977007u, 521803621u, 420290959u),
+    SC(1063328021u, 2621809533u, 96976810u, 3473721689u, 1580075388u, 147307582u, 3358498355u, 992659937u, 209720138u, 3074653637u, 601917271u, 2397755987u, 3117609966u, 632771834u, 4139986434u, 3583498198u),
+    SC(1062855837u, 2086748459u, 1408966714u, 3354123999u, 1723573891u, 2265384773u, 2676293644u, 4101390809u, 3202183304u, 1111744483u, 3526947073u, 257805646u, 1691158904u, 2557300978u, 2923308387u, 2755319216u),
+    SC(1534952649u, 3058185892u, 1002720091u, 4243681513u, 2907100378u, 427435905u, 3149705095u, 1542902928u, 2673193628u, 3352735999u, 4207642997u, 1350430795u, 4061548123u, 2569540970u, 2087976642u, 3008206927u),
+    SC(3790501038u, 180611132u, 4147900921u, 2868657835u, 2430521101u, 2691803784u, 2519476714u, 1366575900u, 2659635960u, 3008267557u, 90756724u, 2285470621u, 4009484635u, 2160484886u, 1353499912u, 4045893680u),
+    SC(4196191579u, 2370344008u, 3810094114u, 3916212205u, 3953598892u, 3203276814u, 1574717803u, 1810802801u, 3803706778u, 845833812u, 2640607656u, 2812636542u, 2232635467u, 4247427113u, 3529398357u, 798737513u),
+    SC(4011728087u, 255352982u, 526490065u, 2873779116u, 2995925355u, 4154845088u, 1285491770u, 2080229567u, 1290771457u, 2849902877u, 2207636188u, 3826378034u, 1468257143u, 1436403335u, 4004843714u, 3130584837u),
+    SC(3681636025u, 1047909306u, 3752184910u, 3565239730u, 266978197u, 2510417550u, 2604549770u, 3778175264u, 1036294790u, 3088218356u, 2228421393u, 3363924032u, 4198283009u, 1717307007u, 1635947946u, 1785831942u),
+    SC(1503130509u, 3176605784u, 1137506614u, 4003282923u, 3607919047u, 2597438546u, 699347710u, 3874119002u, 2918701154u, 3071672603u, 3111427592u, 2522619359u, 524596856u, 3746860780u, 1168546390u, 2548343332u),
+    SC(2547447513u, 177341815u, 2064166502u, 1874984058u, 2506511549u, 1002881081u, 3931040829u, 1002105746u, 3025198151u, 4280391764u, 3671436183u, 333429751u, 3456368351u, 1317010536u, 1272912732u, 3254806713u),
+    SC(1329938381u, 1590212395u, 1767152355u, 3303995804u, 1076046794u, 493555883u, 3299872000u, 1523779524u, 2866730344u, 3299392647u, 3349430970u, 4183874024u, 3177312606u, 3597203478u, 194298066u, 157826943u),
+    SC(94766243u, 1348022325u, 3340503658u, 3399980140u, 2924233872u, 3235607014u, 1234642693u, 2492736726u, 3849911314u, 1837564327u, 2687210169u, 1068014857u, 2927785886u, 796416106u, 2302125812u, 322693576u),
+    SC(1060139426u, 2439525114u, 459591437u, 1533012206u, 770048457u, 887129240u, 1561429654u, 130430387u, 3910513049u, 195998259u, 2989153135u, 1776225859u, 2266165852u, 467945229u, 87577060u, 1159386019u),
+    SC(1952170445u, 1680968108u, 4243598431u, 3214524962u, 4148652652u, 786328645u, 830772369u, 2417755877u, 1503837002u, 2265151325u, 3919911357u, 283483572u, 3189164865u, 3492240673u, 2267618566u, 3533255664u),
+    SC(3150999180u, 2914227613u, 2234880422u, 104364425u, 2872665910u, 2322340162u, 391645457u, 641147790u, 2920120982u, 3028608499u, 3695627144u, 151750308u, 3580014595u, 2790919210u, 45411821u, 951629456u),
+    SC(4242181558u, 311279206u, 2232122947u, 1671672670u, 2671687017u, 3081738147u, 2246393812u, 2452418684u, 1274273276u, 933296552u, 1601539809u, 1280138374u, 3440505320u, 705036072u, 974082911u, 4183103860u),
+    SC(1663426527u, 4238114285u, 711319827u, 656477387u, 1322441367u, 1323226480u, 1554099673u, 2557725922u, 2315144345u, 1748922311u, 386587262u, 639082474u, 2095158031u, 2937746264u, 1300059859u, 1290937057u),
+    SC(2002341030u, 2471055510u, 984971642u, 1383714983u, 1363015067u, 1101245785u, 610156329u, 586026367u, 425636114u, 751812552u, 4260224837u, 4012832143u, 1662906427u, 3395724457u, 1478024579u, 3858410418u),
+    SC(4082560103u, 3936035887u, 1326663933u, 3327731570u, 3806264702u, 50872955u, 3990967378u, 3131471975u, 1025664441u, 3795816100u, 2586538309u, 2627252287u, 3613008144u, 2400207137u, 3835886412u, 3593714298u),
+    SC(861974034u, 2601493646u, 3347984529u, 1334503161u, 2249498379u, 1493832447u, 3403668782u, 4171367881u, 2041805810u, 1913477649u, 1052809330u, 582002214u, 1031413841u, 3812084611u, 3702861303u, 634489396u),
+    SC(1156124498u, 3338913037u, 3006375109u, 4232536383u, 2995798187u, 2683368066u, 1069636307u, 4192760443u, 1658827585u, 2456108655u, 1668088122u, 1904816886u, 2512537886u, 651259883u, 1074392069u, 3807731479u),
+    SC(3855837097u, 3049500194u, 823744630u, 1260977717u, 3386917513u, 1368039582u, 3884985182u, 1321746503u, 3927647615u, 28045562u, 1874033670u, 2423280359u, 4223403700u, 3258460878u, 2627377340u, 3875060976u),
+    SC(2222516477u, 2031150509u, 1007033965u, 1109919397u, 89766571u, 3766728926u, 268779835u, 1504065879u, 1333343256u, 85537945u, 335427780u, 1363924159u, 792665789u, 3029531996u, 4253817795u, 439218646u),
+    SC(3280152520u, 92762907u, 4122337828u, 127701620u, 281640447u, 4135934829u, 3268212577u, 713339949u, 3942887340u, 3407548462u, 2122831391u, 1343409780u, 2719219450u, 3092634402u, 3160767826u, 1303117014u),
+    SC(3119032338u, 1397270130u, 1435453641u, 3514771618u, 1180873910u, 1615782220u, 3592598817u, 3159486730u, 901937165u, 1711067259u, 1374290468u, 393327907u, 940828603u, 2543940684u, 3822769970u, 4011642862u),
+    SC(2773131989u, 2513412901u, 953345155u, 1891272367u, 3552818493u, 557953277u, 3429410601u, 2781638974u, 3212106862u, 1673538350u, 3866540488u, 1787107912u, 2123715257u, 2737744815u, 1310697990u, 2344132953u),
+    SC(3563056188u, 3806287083u, 2219495749u, 4220028076u, 1108140717u, 2244826602u, 1287757343u, 3667908950u, 3985439488u, 1705954154u, 1761729529u, 3099723988u, 3211518439u, 4000620685u, 542918847u, 2360875990u),
+    SC(4105457304u, 4146639640u, 3398801449u, 3570238316u, 1543583403u, 2386768129u, 2277385389u, 1394155890u, 4015333811u, 2517356105u, 746856408u, 2365044957u, 803986827u, 4037698792u, 1295788553u, 2313854881u),
+    SC(3737571775u, 221548816u, 4204842304u, 3897766008u, 3706470598u, 3797989858u, 2215826468u, 893216739u, 1939959681u, 906610945u, 1911546959u, 855623951u, 2488381619u, 605059954u, 1422536634u, 1695111317u),
+    SC(532471123u, 1927380033u, 2467346880u, 577983309u, 643767332u, 3155845177u, 596335482u, 3019833662u, 2633301834u, 111549457u, 549769547u, 2535937351u, 2989854581u, 2318038863u, 582776818u, 1282156490u),
+    SC(3654217931u, 59535063u, 2062373876u, 2476940714u, 1357520889u, 2856564880u, 896537339u, 3802880315u, 849614590u, 610824917u, 3062785620u, 2132401573u, 3781283091u, 3976467590u, 80790237u, 911421503u),
+    SC(373405001u, 2296523288u, 1172443999u, 143467398u, 1311727740u, 3459513550u, 3726068320u, 535838115u, 3990089945u, 3983640423u, 912581049u, 1410302317u, 1222901713u, 3484255995u, 1533599677u, 2106888751u),
+    SC(2582604822u, 1012768763u, 459508513u, 519438694u, 932417411u, 2890856303u, 2529506924u, 975453405u, 1802432354u, 3625539613u, 3789387670u, 3741597186u, 2140220350u, 1805771929u, 2735830686u, 3606473544u),
+    SC(1228246317u, 3259772555u, 2164226480u, 2622710878u, 3116662706u, 2393178084u, 3807668127u, 1532742012u, 1361712295u, 4192157931u, 4017888447u, 4175547127u, 3100116808u, 2079209573u, 931364014u, 3692885428u),
+    SC(3810344911u, 2984173545u, 625591777u, 2706174851u, 3368100517u, 2754653928u, 2767112262u, 2095784043u, 2076426854u, 1775989883u, 171626973u, 3895747833u, 4026289581u, 3034478215u, 3871583830u, 2779792539u),
+    SC(2821638614u, 2894511277u, 4222824038u, 2727179395u, 2904537983u, 2543457748u, 1311919329u, 2261142239u, 3133701419u, 3263896293u, 4104865521u, 2893519158u, 983497424u, 186523521u, 1817102035u, 217533577u),
+    SC(560269716u, 738173666u, 1201322027u, 416103098u, 230912195u, 415702024u, 469455828u, 3370783037u, 2544378986u, 795161680u, 3192994671u, 1648467856u, 4165276094u, 2589929731u, 4274681801u, 3357526755u),
+    SC(1934643416u, 546150024u, 2145353840u, 3829983493u, 3840304838u, 1035306367u, 1674490722u, 3336391556u, 775926840u, 1446404553u, 3875415024u, 2088901036u, 560498635u, 2905635096u, 2415927198u, 716825321u),
+    SC(486676577u, 3866745864u, 2739681299u, 3147579035u, 1710782464u, 2044463290u, 427506534u, 1202709766u, 347525305u, 587417661u, 166276304u, 3801464584u, 1242622028u, 3993730128u, 3467275175u, 2801610527u),
+    SC(2055138932u, 2261420403u, 2824388957u, 1425013103u, 4179383671u, 1233470268u, 467423054u, 1188528395u, 1585684607u, 1569804519u, 2817852797u, 2278661327u, 1150283035u, 3156091543u, 3338742971u, 2008324303u),
+    SC(135381972u, 4262080609u, 1203789006u, 849554138u, 1213806594u, 854739793u, 4111364717u, 2801975020u, 2801582444u, 1822225657u, 780411214u, 900564343u, 2995673501u, 837645551u, 3378426556u, 2201853706u),
+    SC(748766264u, 2313854607u, 38624030u, 3830130387u, 3391483144u, 816747787u, 1129830985u, 565010540u, 2068358854u, 2463670943u, 176342614u, 260989459u, 3320384483u, 1947457647u, 1122045539u, 270976337u),
+    SC(2843803617u, 1627659004u, 865429202u, 2508088868u, 1574166693u, 3740179584u, 3581615903u, 956463039u, 846657442u, 2704880699u, 2272542841u, 2048347545u, 1165840389u, 1909344253u, 283382870u, 128042572u),
+    SC(3849364441u, 3419191119u, 3313669450u, 2576192369u, 4259585432u, 3864913596u, 2507790058u, 3654123709u, 1517588855u, 1717057934u, 161296437u, 314665149u, 2483076203u, 3353256671u, 658090980u, 379009618u),
+    SC(4126911160u, 2502751502u, 1725159813u, 3643280301u, 1908221435u, 1713592521u, 1924748483u, 2077102352u, 449454371u, 1635383329u, 2767230921u, 3028972623u, 2148565389u, 3851983u, 2955892723u, 534212981u),
+    SC(777601787u, 3971852460u, 356551973u, 2225831029u, 1872646750u, 3302749045u, 1431953057u, 1905101246u, 2500879623u, 3510737319u, 2400337260u, 4139094626u, 820062746u, 2349637654u, 1086674683u, 347896075u),
+    SC(2461861033u, 2300353001u, 1822326628u, 2847586053u, 178243647u, 2805547326u, 2733846529u, 3042824854u, 3479058227u, 1704721820u, 3846273958u, 2172348943u, 1556552756u, 571891647u, 318873517u, 2183898503u),
+    SC(819854751u, 2769283809u, 3821818918u, 2480786786u, 1292784304u, 2255636735u, 3984404545u, 2813399171u, 4279619838u, 733053935u, 2709752291u, 3745671626u, 566098447u, 2276221979u, 347975526u, 652952301u),
+    SC(2364871947u, 3750413962u, 2939262600u, 609688036u, 108912091u, 1929019164u, 3136527847u, 623550287u, 1277708667u, 2727983897u, 2209450946u, 1351391448u, 714695595u, 1095073914u, 556858373u, 1099354069u),
+    SC(525029117u, 1352093435u, 1018092023u, 1332599161u, 1250835465u, 2381103544u, 1761814661u, 643712711u, 1816855751u, 4156993549u, 3280658104u, 2759621642u, 1750290985u, 642779766u, 3994841067u, 396350361u),
+    SC(2639415552u, 2543516211u, 2371388346u, 3510436748u, 1066491065u, 254683554u, 704809752u, 3499208577u, 1083838780u, 58487597u, 285492541u, 1796611379u, 3677509575u, 194671585u, 3773917086u, 1745010232u),
+    SC(1390535908u, 1190058448u, 4250669644u, 472072252u, 1526962252u, 4093314868u, 3324506955u, 3718439841u, 1732925233u, 1937113000u, 3284406351u, 314667322u, 3806053936u, 1973911131u, 639906327u, 142811303u),
+    SC(2189104922u, 2398047793u, 3872033646u, 2087597818u, 235564179u, 2810016072u, 4246927272u, 373300363u, 1707967997u, 3652714959u, 2112278860u, 3079381268u, 492357626u, 312450824u, 2188768100u, 4157240640u),
+    SC(307185129u, 1641584194u, 1780137010u, 3850560070u, 1035114836u, 468321155u, 3359609211u, 1826566043u, 1934503908u, 285959601u, 761291375u, 3324546951u, 3834542717u, 557469571u, 1488670055u, 2542627938u),
+    SC(62329496u, 414364452u, 283439106u, 2308048068u, 4215982550u, 3230470505u, 1600083609u, 2588764130u, 683079563u, 216929973u, 1543572561u, 3964032521u, 1421501288u, 2710233624u, 1443348987u, 1120042043u),
+    SC(3530676350u, 104551267u, 241583237u, 3932874510u, 3803744161u, 3354910884u, 687879093u, 1361938944u, 1708406788u, 2019943040u, 657531578u, 2374386896u, 1626298663u, 882318491u, 1359100139u, 2641209415u),
+    SC(488402309u, 766726496u, 1741499778u, 3803862316u, 207397065u, 2927351393u, 3897117477u, 215745447u, 3157390533u, 1731854934u, 4003162176u, 2062458933u, 3785328460u, 3185028795u, 2928349189u, 1315512162u),
+    SC(2414774708u, 1910740160u, 3719112524u, 195067364u, 3213700812u, 1767262203u, 490166013u, 1190124957u, 1566494915u, 2222544783u, 3514491208u, 1905850831u, 1269157745u, 1185526980u, 885678833u, 3173747820u),
+    SC(1746915081u, 1436611409u, 1613115436u, 3460228213u, 2398697567u, 2425203941u, 1568652592u, 2282792684u, 1124595547u, 2576512548u, 2149088987u, 3301332828u, 2857691380u, 420415621u, 3872610506u, 44273578u),
+    SC(1904203485u, 4239763227u, 1784171048u, 2420954082u, 1869355657u, 2143496472u, 2423859511u, 3014039323u, 3020159017u, 1909763332u, 3754165587u, 670489230u, 453370461u, 874341649u, 3620570527u, 1488026002u),
+    SC(4072232739u, 2498467718u, 3693037976u, 1792590656u, 3533189753u, 3341957684u, 577770467u, 1968123894u, 3042169729u, 1056820545u, 1904829533u, 3650190195u, 3144279813u, 3886436877u, 3685370238u, 2003203643u),
+    SC(1483820006u, 3621285001u, 1697684306u, 1094792641u, 2595684048u, 492230577u, 1110919261u, 2524121883u, 201400116u, 1043910235u, 3735782571u, 4041413943u, 1077511260u, 1604648184u, 479874398u, 1877206323u),
+    SC(3543983531u, 3358128321u, 3111128393u, 3922113786u, 3003652603u, 2998837819u, 2140232640u, 2054157251u, 1939563042u, 957565320u, 574040998u, 1069425393u, 4015601999u, 937137519u, 3402255377u, 1973564309u),
+    SC(2183147058u, 4236050728u, 1320835327u, 1123539274u, 613435400u, 3606651093u, 2553786989u, 1672828025u, 4259723604u, 1353340388u, 4240767754u, 2328021120u, 1672098306u, 2583691341u, 3989844918u, 627291336u),
+    SC(635843096u, 1543195784u, 4197453367u, 13153866u, 2485019783u, 2739036855u, 68811388u, 770340737u, 2926144263u, 1208134553u, 1307760716u, 3329432958u, 164274468u, 1418471953u, 1121832382u, 4145473088u),
+    SC(3761465861u, 3106229786u, 4064709174u, 876219903u, 2645063482u, 519947399u, 1405200731u, 1616646478u, 1104632160u, 930798136u, 2042197077u, 878864069u, 1537235221u, 2648363088u, 3647839627u, 2947623448u),
+    SC(2217960367u, 2144514493u, 479892051u, 3827599809u, 888047450u, 3679958866u, 1658270122u, 2593744482u, 3854607057u, 3690786835u, 3981171254u, 4048790312u, 314880945u, 1726252147u, 1294808418u, 4291684042u),
+    SC(2914128056u, 484146968u, 4185478607u, 4202583907u, 2881090050u, 2636659717u, 652174130u, 2500950238u, 740368133u, 3625462438u, 225986337u, 2492135953u, 911062508u, 773582064u, 1760268709u, 1961496117u),
+    SC(2869714849u, 2734563893u, 4002645327u, 1503737746u, 540303438u, 1482143456u, 2293649730u, 4065162385u, 3846645195u, 3815599637u, 1909093252u, 121124179u, 3118221517u, 3970339627u, 2375219077u, 3087082706u),
+    SC(1046341498u, 488727524u, 1060185264u, 2941211763u, 2257192971u, 1739380789u, 4190881933u, 2022039258u, 2800563364u, 798294968u, 3091097272u, 931090762u, 3784474052u, 3279877842u, 625894685u, 359949872u),
+    SC(1623624509u, 835834662u, 1534193768u, 2402481777u, 840452117u, 4164590827u, 84848374u, 1234299909u, 2541407329u, 2675778760u, 2841308350u, 2557949861u, 2307417897u, 1343148842u, 2641760202u, 2080429208u),
+    SC(565203689u, 3058099605u, 3066055286u, 2792069925u, 1242720041u, 1810499156u, 1694260017u, 1774269922u, 271181005u, 800315159u, 1854351660u, 1259208063u, 417033940u, 1504350853u, 955291804u, 1409776103u),
+    SC(117492467u, 2087077141u, 3998228070u, 1623084234u, 4119573231u, 1527904157u, 3223837603u, 2068987240u, 2113366920u, 4056106739u, 775047292u, 429226032u, 2393676670u, 1458424136u, 3785962695u, 1872792545u),
+    SC(3316358098u, 311657546u, 3462339743u, 1447396117u, 1563733679u, 1448760982u, 697734756u, 1230249613u, 757105094u, 3323817098u, 2698986599u, 2395290238u, 2603931916u, 1473982249u, 3224769284u, 29631192u),
+    SC(2331787054u, 3577699777u, 1150096815u, 2350993880u, 1460927453u, 1564910559u, 2762815338u, 23950755u, 18834323u, 640138969u, 3759516061u, 1108950635u, 1734853907u, 4081416343u, 1692080718u, 1268477071u),
+    SC(1095424454u, 3142970079u, 3477927721u, 665728642u, 3235289191u, 3991532760u, 1847016528u, 978323367u, 3300708600u, 4108229405u, 285356139u, 1719293037u, 3673911170u, 3988651990u, 404607904u, 2405447045u),
+    SC(2182210112u, 3091952407u, 2848320648u, 4257490641u, 2707661523u, 2867890429u, 2989584967u, 3406078435u, 3396773275u, 2993209169u, 1325843702u, 3583384371u, 2806976689u, 1890183614u, 1316569773u, 645016507u),
+    SC(2773351730u, 909827388u, 1978418258u, 815051386u, 1065144977u, 1139692276u, 702913967u, 582643726u, 4049633836u, 1498480792u, 1043910960u, 1236551781u, 909749364u, 1788079035u, 664328494u, 3134474507u),
+    SC(2010532949u, 1387436824u, 2813256104u, 505322815u, 3801225795u, 3485308393u, 2746907833u, 1233674487u, 3917199609u, 1588185332u, 1141561815u, 920232042u, 267191209u, 214525335u, 2366042855u, 2181627664u),
+    SC(1213937684u, 3007212529u, 524808437u, 4041580937u, 458735875u, 1626422625u, 3128510433u, 1848679593u, 3871045744u, 3462429794u, 2785349072u, 2490140243u, 4187510639u, 746068831u, 354952754u, 82021339u),
+    SC(3978527212u, 2836035778u, 3740670142u, 460250193u, 2095917768u, 347007402u, 2963736207u, 7500700u, 3406328800u, 3123864658u, 940321054u, 3325376542u, 3599079702u, 748752828u, 1038376955u, 323572935u),
+    SC(3829706617u, 3547054375u, 3359404905u, 2764808446u, 2505796198u, 2402187880u, 1248191868u, 1156421405u, 2810670851u, 666272314u, 2868206753u, 1783142794u, 3964724702u, 17642729u, 3715913039u, 3547881471u),
+    SC(2945201367u, 2112313901u, 1600399724u, 355461711u, 3093789578u, 2529896332u, 133004880u, 1778130890u, 1221482594u, 2876162472u, 3461712287u, 610479074u, 4089729483u, 2340539020u, 4193043378u, 696571507u),
+    SC(3919172710u, 607798509u, 417809832u, 497044017u, 143920264u, 1980006603u, 3809821548u, 4135517715u, 4095643248u, 1671972449u, 3257581799u, 1558109136u, 4015379435u, 2141721547u, 796729264u, 37223990u),
+    SC(3289315498u, 2106156287u, 2748092986u, 50195436u, 120369066u, 1488399718u, 3792287300u, 1615580274u, 1208890805u, 1699324390u, 4044538806u, 393163640u, 4283493319u, 3018828847u, 1768883751u, 3072560357u),
+    SC(1211032605u, 3824765340u, 2308093254u, 3792284253u, 1738427274u, 581068309u, 466727155u, 2589104175u, 1359896688u, 3524466709u, 760410096u, 3994086511u, 1447006956u, 2699381240u, 854584961u, 3704872509u),
+    SC(1180738664u, 631488982u, 1728068713u, 1295448247u, 1844955698u, 3322060756u, 1708980006u, 1549335269u, 1033382901u, 1186316950u, 2559233138u, 47898263u, 2032003296u, 352556992u, 1879833104u, 3122918936u),
+    SC(3093193292u, 2461691659u, 1068620803u, 928553364u, 3634605793u, 1982942599u, 63487728u, 3948777357u, 2291362611u, 547707812u, 616560958u, 4214681463u, 3805151014u, 2255279238u, 2294683752u, 2910152603u),
+    SC(2753110197u, 907683519u, 3172499130u, 3056588211u, 3015583791u, 2498729158u, 2976483156u, 2418443235u, 2005967254u, 702102349u, 1025974299u, 839204354u, 3378155423u, 637945809u, 1226603082u, 3781077386u),
+    SC(2475175337u, 2032544352u, 844296219u, 3205504393u, 3977953163u, 357595447u, 89750004u, 4223137902u, 154699853u, 4037482223u, 20399371u, 2908684846u, 602239217u, 1054047746u, 363071760u, 412974660u),
+    SC(2701462008u, 1056889440u, 2901764964u, 923382167u, 3959056985u, 3866032902u, 2042769957u, 3365219840u, 1972405205u, 1436278349u, 161709557u, 617276664u, 1510401956u, 2081297918u, 2198799991u, 3259833819u),
+    SC(731142807u, 1856455288u, 1943528839u, 3756482223u, 3311265540u, 2325900585u, 1262165753u, 736835153u, 1111230445u, 667729771u, 2635905724u, 3758834971u, 3410529552u, 3856332626u, 1770057573u, 109657189u),
+    SC(2264521147u, 3248537572u, 14695840u, 334589975u, 4136965777u, 685052019u, 3046393211u, 265041904u, 4084254244u, 774911894u, 2470038859u, 4223770255u, 1647873794u, 1687308269u, 3745279079u, 1179398843u),
+    SC(4170799865u, 1432224846u, 1647892629u, 2346405395u, 984206351u, 2427002988u, 23924611u, 3714182545u, 3000292067u, 468587208u, 999021240u, 888811107u, 535550867u, 1257346236u, 3498203425u, 1319673952u),
+    SC(2874516095u, 1777022253u, 1163849343u, 196877428u, 4259980833u, 1674616254u, 794117143u, 2173932750u, 2328192147u, 1626703285u, 1916222401u, 1957245154u, 1297377098u, 2306380627u, 1242980864u, 3810230298u),
+    SC(1338050249u, 3291013016u, 2439678214u, 2515108691u, 3464786495u, 4208649506u, 3903363350u, 2721816486u, 2430022376u, 1028928542u, 1330415806u, 865233021u, 4260084810u, 2082058193u, 2454918792u, 2662932529u),
+    SC(3385350528u, 2284965067u, 2010676005u, 1940428003u, 2269151451u, 195065522u, 1176943746u, 51681937u, 2678934733u, 2349419001u, 3197789013u, 4038982198u, 3321467496u, 2013619942u, 2800943843u, 2997612728u),
+    SC(3234552702u, 580103098u, 1610058822u, 2853446397u, 2725833564u, 3721759927u, 2934403401u, 475138535u, 2164388910u, 912557446u, 1572255090u, 3504295075u, 3430054046u, 3985450965u, 321967923u, 1309721723u),
+    SC(3690726341u, 383336323u, 1193981452u, 958127465u, 2939121870u, 264036701u, 336532880u, 3637381987u, 4164477261u, 1915275822u, 2587094270u, 3279333966u, 1209137700u, 3736894278u, 1180221779u, 4275201380u),
+    SC(3727033989u, 4003545073u, 359782545u, 55969712u, 1129398457u, 1659091699u, 2093216723u, 1213159880u, 1807892169u, 2785171557u, 3862311733u, 3144085990u, 3254121804u, 2858388172u, 3623418597u, 2580528076u),
+    SC(1490521440u, 3100348379u, 28716921u, 4139876027u, 517477023u, 3347160671u, 1869858187u, 4204979998u, 2092688626u, 4251698801u, 2351050590u, 372838707u, 2957864253u, 3139843377u, 1084899411u, 3024866497u),
+    SC(3878394650u, 4006957029u, 2869455274u, 2416004667u, 4259426066u, 4131837752u, 555663102u, 738239632u, 3448951117u, 2404997171u, 2217406496u, 2731311776u, 3645266281u, 2010275124u, 2365534835u, 2427408322u),
+    SC(111700910u, 3579468769u, 2340220823u, 3386898600u, 3072718356u, 572606555u, 1000289421u, 1460655704u, 327820945u, 1278947349u, 271655232u, 1997142663u, 1621184276u, 1461361984u, 2176871783u, 4012660516u),
+    SC(480283894u, 1916858948u, 3603628121u, 1448067715u, 2977708513u, 3055841646u, 235932398u, 3138002885u, 585256910u, 1700596204u, 883122967u, 3328892679u, 3740018499u, 1318846826u, 3007609663u, 3656321621u),
+    SC(3646800168u, 4273621444u, 1944186416u, 3168663406u, 3083821706u, 4249441799u, 257262081u, 2185890575u, 3576957624u, 4272152887u, 3506836084u, 3332073699u, 1665046714u, 2922373398u, 370328790u, 3351767201u),
+    SC(751620650u, 2135938305u, 1815745764u, 1989839035u, 2927503499u, 3650648828u, 4089476088u, 3436722263u, 2927781436u, 2930286555u, 1192294473u, 4287516600u, 3265771028u, 1322999611u, 254108893u, 121321630u),
+    SC(3960976886u, 3370442275u, 2474360835u, 2111288337u, 2924124872u, 522715601u, 3320757936u, 2506263107u, 3017856285u, 4250408368u, 1663017624u, 2526013199u, 1949406752u, 4034496308u, 2389108457u, 1717100419u),
+    SC(2788863870u, 1653636942u, 442580189u, 3438398616u, 3471368492u, 2343363530u, 2506643593u, 1821816564u, 798310076u, 3697252723u, 3923004081u, 589650465u, 4173077117u, 3892366830u, 4017438769u, 2934448494u),
+    SC(2394226480u, 831360269u, 1799709548u, 2996228407u, 2430813615u, 430000940u, 1426981225u, 2276274931u, 1267606411u, 2927623294u, 2103443793u, 3320559478u, 213917009u, 136835441u, 2401808247u, 212116451u),
+    SC(2870223023u, 3143320471u, 4118324965u, 1957051116u, 607320716u, 3027313473u, 1131720153u, 2188818642u, 4210438798u, 2711087399u, 1706680208u, 175723915u, 2401651405u, 2138420596u, 2429445503u, 1689863062u),
+    SC(3668019470u, 1798021546u, 3703664412u, 3252001181u, 1359129195u, 881851230u, 2519776538u, 2289002506u, 435866473u, 1516497812u, 3413073925u, 3475750179u, 2269442140u, 740427024u, 2495573498u, 892314121u),
+    SC(4053398830u, 1402524084u, 2308578062u, 3750673267u, 3406341698u, 3173187374u, 186447431u, 2133469411u, 907652011u, 2783056669u, 1288668999u, 1743756149u, 760379564u, 1430896030u, 1545296261u, 2663576660u),
+    SC(405446291u, 2784619763u, 1811024833u, 1232751157u, 3881600757u, 2627715142u, 3799327267u, 4031163754u, 3322502792u, 3281907224u, 3397809811u, 3629520839u, 3767684554u, 883885989u, 3341935752u, 4290297085u),
+    SC(145017683u, 104267366u, 3059787521u, 1680310194u, 1522671278u, 151401084u, 995137876u, 2987699131u, 1765693521u, 1288087873u, 602828927u, 2904938040u, 2398926940u, 626002879u, 1677551910u, 2714823964u),
+    SC(1224815450u, 994100030u, 291385605u, 2193971570u, 4103411596u, 2168182996u, 723552534u, 1552683650u, 1191211382u, 1117615117u, 3702288619u, 2652835476u, 4067072526u, 1306394982u, 618256385u, 3359773923u),
+    SC(2172708263u, 2083796523u, 1176193505u, 1268723205u, 3747935581u, 3403164559u, 3455324722u, 2555249117u, 886003233u, 3568955648u, 2855579901u, 5949725u, 3409949852u, 319766117u, 233259692u, 2936341515u),
+    SC(2406556286u, 4272551080u, 2647322339u, 1491772885u, 2836274556u, 3084006052u, 2970116065u, 911339167u, 2765755836u, 3140188576u, 2726048847u, 999378047u, 3799148394u, 3154401966u, 3909988174u, 2522197363u),
+    SC(3689651060u, 3452549835u, 137728674u, 2748062118u, 3521810090u, 1510500924u, 3429422115u, 3484779108u, 3194390418u, 2213576629u, 2198287083u, 2044816316u, 417885689u, 3059344084u, 1527777699u, 1079468385u),
+    SC(4079544639u, 2817862828u, 1014696374u, 671426781u, 2107548895u, 2199365976u, 2869584253u, 1901664563u, 1104055385u, 2166333072u, 1641824058u, 2105922452u, 796396567u, 3622554208u, 4228129553u, 4064302407u),
+    SC(1456796675u, 1097538540u, 1237709900u, 539083333u, 3570024833u, 1362217853u, 2410729224u, 821993553u, 3428802867u, 2492430270u, 2471278135u, 1029557900u, 1370364562u, 3822584488u, 3545905880u, 1354578382u),
+    SC(2384650315u, 2343859895u, 3438013682u, 2737306945u, 3717253626u, 108854345u, 3922677436u, 59777720u, 33094240u, 839149933u, 886062082u, 835972952u, 2471393682u, 3267894637u, 1044485043u, 136866699u),
+    SC(874193636u, 3114761320u, 4181075164u, 486472414u, 3013012338u, 3214921242u, 1367768442u, 250635510u, 2508431239u, 2076404055u, 1498819535u, 230470363u, 2937187698u, 2100469287u, 3486056331u, 2463712282u),
+    SC(1050947219u, 2669887762u, 2275313280u, 2499512972u, 3870267289u, 3221270608u, 1173037094u, 993150819u, 1144144231u, 1868211952u, 1340396831u, 4275022077u, 1621475491u, 951152473u, 409386321u, 771860003u),
+    SC(2951197772u, 4010824014u, 4182747675u, 3100502300u, 601400928u, 2803642739u, 1123624895u, 1398628955u, 1981261704u, 1361151858u, 3168083736u, 1420846062u, 1828511095u, 2050524199u, 1372245960u, 2089503589u),
+    SC(2741029378u, 2880703820u, 1846200101u, 4072682961u, 318152419u, 4279115226u, 933493734u, 2718125355u, 371093880u, 1072447136u, 811405170u, 979403887u, 2643181177u, 626669588u, 4206375529u, 2439734381u),
+    SC(273174111u, 4158258813u, 2607143305u, 2603535863u, 1501876620u, 295302686u, 3373574235u, 2013338504u, 315736290u, 504591191u, 2665353350u, 3267445919u, 3891585085u, 2029498756u, 1333022063u, 2507591113u),
+    SC(1992482017u, 1571659228u, 606563392u, 3987201642u, 2970764774u, 1527061414u, 2129410502u, 3528896824u, 3651535310u, 1482360889u, 2464414882u, 2755082659u, 1638438525u, 1051784709u, 3981242133u, 4234464898u),
+    SC(1729769940u, 3286691224u, 2957311153u, 2212257991u, 3520608648u, 978613078u, 666475381u, 299160289u, 1876790549u, 537259839u, 2129884719u, 3208882249u, 673126494u, 2771131195u, 145569563u, 235221128u),
+    SC(2446390629u, 2732222723u, 313993624u, 1475812376u, 3258202715u, 2800841283u, 468587190u, 1854507575u, 2640991673u, 425108104u, 3580429985u, 33017309u, 3862510294u, 1917391994u, 1105928349u, 2134046337u),
+    SC(2119823448u, 424911555u, 3419721933u, 2404251576u, 1804654814u, 1916842708u, 3734956459u, 1652888250u, 867226091u, 1959558496u, 4014054154u, 4193269524u, 899683070u, 848281021u, 2644208059u, 2588057971u),
+    SC(4017665630u, 192486381u, 556159661u, 2870948607u, 4097452123u, 3762305037u, 3544787710u, 527993382u, 2671650104u, 2530586562u, 1051175707u, 620735488u, 4048997871u, 2476046608u, 2880556315u, 1695077126u),
+    SC(2025421008u, 429405166u, 1098703605u, 4229090049u, 3406564940u, 4000656927u, 1353240057u, 3043720403u, 2677833175u, 925238971u, 3809935681u, 827924317u, 3714260881u, 1900416208u, 426808440u, 3243642329u),
+    SC(1601723185u, 4187249184u, 3918722536u, 2158734194u, 2423258618u, 2074594543u, 4055093869u, 1891624522u, 2748073998u, 3016439914u, 4288780429u, 841453853u, 1465000979u, 3855647854u, 174918167u, 730340380u),
+    SC(2683206041u, 2092648751u, 3476729338u, 1145589105u, 46368893u, 1668663431u, 4243496933u, 2013705169u, 1125204775u, 2123679584u, 532607578u, 1625805896u, 3237001456u, 3334882359u, 2703873196u, 4263821870u),
+    SC(317906269u, 3076360325u, 2071719895u, 3451747446u, 3237241363u, 4188352770u, 181242636u, 1323561739u, 3458685323u, 243598494u, 2597580026u, 3548790896u, 4166059376u, 1949159457u, 1842039461u, 859871192u),
+    SC(3331632820u, 1055044892u, 1057893359u, 3155915150u, 4223168415u, 489325781u, 829960797u, 3482942423u, 1095245630u, 3064369937u, 749485660u, 3361369987u, 1875187982u, 2926703142u, 3184035752u, 3976530295u),
+    SC(4263930438u, 348504156u, 3136506175u, 1525923578u, 2614190336u, 140556977u, 1236105418u, 2164554473u, 3806432958u, 3292959956u, 3083211949u, 2809308612u, 4119634055u, 1230500363u, 121747796u, 407314027u),
+    SC(2037768668u, 153530492u, 1216004005u, 2350399265u, 3674146023u, 4135219792u, 3524601497u, 895555805u, 211307415u, 1155707648u, 3394549625u, 3667188453u, 4181935757u, 2610375128u, 567265033u, 890505701u),
+    SC(2471967963u, 1343763849u, 2693832334u, 1636226816u, 1881310350u, 3086838097u, 2704789270u, 2710186758u, 2056617062u, 810022574u, 3645440057u, 3510029006u, 3400412554u, 4238299376u, 643370594u, 415188949u),
+    SC(3233623582u, 2786029547u, 2383071197u, 1214235902u, 1735514126u, 3801827369u, 4197972728u, 2178381408u, 1750824189u, 2665341383u, 1762091623u, 3656533992u, 788514879u, 3797610597u, 1454371419u, 53852877u),
+    SC(1455079649u, 2467897863u, 2423152453u, 3579664665u, 3061220651u, 3668193875u, 2353817988u, 2619653950u, 3820966355u, 2555820050u, 3538190523u, 3367049445u, 257690345u, 4174418070u, 2782005228u, 801214143u),
+    SC(1404312339u, 4269596114u, 3959343044u, 2844130797u, 1378220554u, 3107847269u, 588567013u, 2437070956u, 2432481879u, 1155855717u, 1563296653u, 3436363263u, 3410939680u, 1223867032u, 2405629595u, 3283524683u),
+    SC(3181403697u, 3435195833u, 1206626854u, 2441267756u, 2970838016u, 1733092853u, 3579825962u, 3269944763u, 2535938425u, 824404354u, 2806354774u, 1929964183u, 805243098u, 2928636027u, 1149093562u, 2060416488u),
+    SC(1222450282u, 2324695072u, 534814489u, 2834718594u, 2434363029u, 475469979u, 565108245u, 1258558424u, 2040657659u, 445922762u, 1696064135u, 2162634629u, 3315995917u, 2622543791u, 2026419770u, 3231422709u),
+    SC(1967153769u, 3800842892u, 2398090466u, 3466210632u, 736638063u, 877020444u, 331367296u, 690954028u, 1195618455u, 555516030u, 600642519u, 1764686916u, 539772109u, 3722815647u, 2658983002u, 322869610u),
+    SC(447045011u, 3207692595u, 2285940301u, 607211516u, 1950482434u, 1306177893u, 1075339338u, 563277407u, 3132801876u, 2463473290u, 1701496809u, 2607592141u, 2053803656u, 325128591u, 69089521u, 750533628u),
+    SC(1975405648u, 3682321961u, 3863980112u, 1032451874u, 886183156u, 2602004410u, 3107394060u, 1199427331u, 3042053050u, 2355129778u, 137615668u, 1015417963u, 3979238954u, 1101448187u, 1360350338u, 2495019033u),
+    SC(4083173410u, 3840772909u, 223028358u, 3054614875u, 1695080714u, 477256829u, 2372108884u, 1022323852u, 4094012537u, 1946467434u, 631350290u, 4073445016u, 1977195820u, 2990194949u, 4186149958u, 573423861u),
+    SC(1821513446u, 1871914686u, 4208326439u, 2919442097u, 3662999185u, 4030845631u, 763879408u, 3883724776u, 1688215993u, 3155773384u, 3746852754u, 793915615u, 516092786u, 1348802308u, 1433630715u, 970024215u),
+    SC(2923928509u, 3466031917u, 3744544865u, 1988130424u, 2558740194u, 1527954185u, 3880601421u, 1761961610u, 2748187477u, 3315163271u, 2308137782u, 1691991506u, 3006951319u, 3930007731u, 4105683116u, 2455841065u),
+    SC(3465724281u, 1727483314u, 476757240u, 919589623u, 2630616487u, 2863625471u, 1208419629u, 1967691966u, 4091794419u, 1393506500u, 3394883273u, 3370337643u, 2329853824u, 1058050684u, 3830348234u, 1612429688u),
+    SC(2316025526u, 2169664961u, 2002075015u, 1502135517u, 2842647266u, 931806111u, 1199370594u, 1852745357u, 2508945758u, 1190417426u, 2896863095u, 140135988u, 2814856876u, 579106518u, 1318156675u, 1609006926u),
+    SC(3265548009u, 2538864866u, 2435449660u, 99425914u, 2131662759u, 478603472u, 204362038u, 2379861246u, 2506372591u, 2099553543u, 3690686898u, 2478117737u, 1892489144u, 3958815840u, 1500157253u, 913663631u),
+    SC(3054892581u, 1397612385u, 1203209504u, 2235841485u, 1027325585u, 3356875817u, 1019777479u, 429826529u, 1286337777u, 2581730408u, 1655244918u, 1332069924u, 4265278748u, 1798938130u, 645775847u, 1858333221u),
+    SC(2949427085u, 4258211626u, 3478576617u, 964738791u, 3058306132u, 4161286325u, 1607514427u, 3903281678u, 148434013u, 1869595727u, 2314656186u, 1935172015u, 3889604192u, 131632789u, 1425195329u, 272803390u),
+    SC(1396799144u, 3308329766u, 523843933u, 259534859u, 1436354346u, 3409474476u, 847461514u, 2601738067u, 2877618251u, 1592698804u, 2280613433u, 2410108666u, 185996637u, 1748956739u, 2956754540u, 2326983734u),
+    SC(1601872243u, 2549061069u, 4101394860u, 1646326770u, 2265295804u, 1697757502u, 2791296276u, 462549836u, 1928845464u, 1021162319u, 785494671u, 396852622u, 1892678843u, 3762694840u, 3075769697u, 2558646818u),
+    SC(3573238348u, 3252878194u, 3003243289u, 861601146u, 3064549976u, 1761866825u, 178423804u, 2895068475u, 1991602920u, 1251848839u, 433101005u, 1575909502u, 4061375991u, 2598961926u, 143136916u, 3779155193u),
+    SC(1036416355u, 2218471226u, 4153610604u, 601558480u, 3671103324u, 1522267497u, 1282229580u, 2675613684u, 3723910046u, 1303919487u, 1137757432u, 77234312u, 1217704567u, 1337171903u, 2013751904u, 895964078u),
+    SC(1702433469u, 517800269u, 327599177u, 1355617895u, 2621325661u, 3010344625u, 1001769004u, 2734200790u, 1311760347u, 297525824u, 2412247866u, 2899340393u, 2015387208u, 3388318019u, 1124110974u, 4275373519u),
+    SC(94655411u, 1602377820u, 4131681253u, 255846711u, 1866541919u, 3299731384u, 4178056983u, 1071030169u, 4229340689u, 877180304u, 1310572294u, 4104888739u, 3962549429u, 2133544015u, 2728093207u, 1477017278u),
+    SC(3282957402u, 3259714504u, 1772944113u, 4184485955u, 3491522738u, 256898697u, 154875827u, 2751800953u, 1032991239u, 3442953033u, 3551026154u, 2536213769u, 1326271363u, 3470563287u, 3988958312u, 279845324u),
+    SC(439545288u, 2422070404u, 659964427u, 3790757295u, 1540902671u, 2897233590u, 3909357545u, 1579031894u, 2135326109u, 289044472u, 3251336109u, 379989839u, 4049677440u, 4174349724u, 212083044u, 1760250961u),
+    SC(1888845208u, 1659213690u, 3274225626u, 777060938u, 4180001090u, 3944367799u, 3030630176u, 2806869144u, 647714502u, 776129588u, 2694124360u, 2283613267u, 2105467441u, 4063395521u, 1142936179u, 3203437441u),
+    SC(132551702u, 1510125932u, 276489300u, 191684389u, 3211645526u, 3648432964u, 3179207812u, 2205497255u, 4290278619u, 943066129u, 3805336270u, 65303395u, 2796208669u, 2023979812u, 1046905451u, 1146193397u),
+    SC(1333895513u, 2067982773u, 616463046u, 4282648024u, 1000180341u, 3816511670u, 250434853u, 1843369592u, 2991788551u, 409428069u, 2911894497u, 1831329612u, 895020759u, 2569353395u, 2009826455u, 2262869900u),
+    SC(4196729704u, 1466983855u, 190889613u, 3912766260u, 2615606742u, 467469017u, 898736989u, 693097799u, 4038693347u, 2529655999u, 1566846733u, 3479101707u, 990519207u, 2070507270u, 3570801876u, 1223169573u),
+    SC(4108279485u, 1729506300u, 1044227351u, 603899608u, 1801574084u, 2777115725u, 1141834330u, 657171412u, 2990252665u, 2345099186u, 3583042436u, 3387127246u, 1669389403u, 2425818436u, 1733178017u, 2152866091u),
+    SC(2874895133u, 3010616165u, 4209151580u, 1145441644u, 1371051802u, 106255388u, 1247309942u, 2712424469u, 382911575u, 3973846808u, 983398518u, 3615862256u, 1112502968u, 3498797726u, 678340043u, 653143758u),
+    SC(2829380734u, 333140848u, 1080561100u, 1192048804u, 48270745u, 1009842561u, 2894560480u, 679910997u, 1251863964u, 752873043u, 2306672756u, 2522380452u, 1967138261u, 3132819387u, 757367121u, 3414122660u),
+    SC(863982838u, 868049115u, 5782792u, 375132177u, 1871793625u, 3802910634u, 1595610128u, 3089391432u, 2488527656u, 1768619082u, 1085621547u, 3551243852u, 1738234085u, 1082854036u, 3930417009u, 2172050428u),
+    SC(4007868331u, 3693849329u, 88393575u, 1101333836u, 4141565965u, 1386029284u, 867582645u, 4254079827u, 1705859976u, 46923988u, 2763660683u, 2794811272u, 2186680013u, 1600952368u, 2267431495u, 2258380734u),
+    SC(1509240344u, 1472921610u, 3961171724u, 3024032372u, 4117645180u, 1357910200u, 1158937839u, 1966019912u, 3637153646u, 2377136921u, 2152136811u, 2800492073u, 1327649889u, 2574831216u, 2712538963u, 2652281022u),
+    SC(1814039052u, 637197098u, 2325092569u, 3621282439u, 2239998736u, 4071919966u, 2405064453u, 1081032210u, 349476942u, 927789916u, 341504589u, 2780877048u, 84173981u, 2977512033u, 2104416585u, 4018176504u),
+    SC(374645501u, 1373615864u, 1907021944u, 597386618u, 4162080760u, 2560869024u, 852491203u, 2326530042u, 2338940355u, 2195293545u, 3066940445u, 1282502748u, 3815589573u, 4200462100u, 2371421245u, 370836380u),
+    SC(3296736201u, 2873570646u, 3382193971u, 2503972566u, 2067714496u, 2123952046u, 2380411639u, 1733651831u, 2940160168u, 2076455272u, 276329346u, 2379217581u, 180243028u, 2190148278u, 4170689355u, 3986066348u),
+    SC(1574533114u, 2849122517u, 411413226u, 1434417816u, 446002975u, 34784186u, 4054115368u, 1010589746u, 1006607690u, 3122106220u, 3536736772u, 1034553074u, 2880465613u, 659286853u, 1239886391u, 2402203222u),
+    SC(712432677u, 3717895876u, 3170835850u, 4090079979u, 639519849u, 2782409387u, 4025474857u, 3460474212u, 1228165874u, 987089639u, 3733755690u, 2942056579u, 134185642u, 3747703899u, 801813702u, 3575924742u),
+    SC(3451729158u, 1276016931u, 2183899981u, 3026594602u, 4248384937u, 2761846127u, 4074475339u, 3533327245u, 2987552558u, 3055429455u, 2793973836u, 946854751u, 1488471317u, 356774211u, 2832075324u, 1434095822u),
+    SC(2554274971u, 750376182u, 886582636u, 3876827129u, 735040805u, 2752801397u, 3211752029u, 726980984u, 2043487238u, 2232148013u, 2797916767u, 1510136510u, 2939170423u, 596128751u, 218039428u, 2324348066u),
+    SC(2294769076u, 2778769907u, 2723668510u, 4289871441u, 2652013705u, 4208857987u, 2533212556u, 951047412u, 4107664996u, 1922667939u, 3842362371u, 487868034u, 3811797731u, 1170376343u, 486054781u, 1499416258u),
+    SC(427099628u, 3590572810u, 429686024u, 3096252003u, 487881991u, 1163933330u, 1801954690u, 3084201009u, 2491334971u, 4074201029u, 183871302u, 363289324u, 790702815u, 2721374351u, 1235575268u, 4177886997u),
+    SC(2551726642u, 3775881311u, 1487339715u, 225165389u, 2585360655u, 3949170668u, 1719869622u, 992914168u, 4012930797u, 3236100665u, 820675454u, 918757209u, 3686658450u, 2870525311u, 962039324u, 4026124379u),
+    SC(1357962037u, 3416265547u, 2031044521u, 3810682638u, 4039626881u, 1751754596u, 2301595171u, 1812709378u, 471538707u, 3649733866u, 3883032822u, 1491232216u, 2655415108u, 3093319389u, 2200125387u, 1748590706u),
+    SC(3655549162u, 440712016u, 2924196255u, 1061300468u, 2578220310u, 3446405766u, 2160188465u, 3580253442u, 311039624u, 861544851u, 4286599761u, 3090919145u, 873743789u, 621055861u, 895437621u, 1531620056u),
+    SC(363495731u, 28855773u, 2356176642u, 89512985u, 3559699625u, 177501385u, 506708216u, 3900461980u, 2035484448u, 2522375168u, 3957140385u, 2002963643u, 706002759u, 1173764893u, 3794561645u, 2302860225u),
+    SC(1869645572u, 1406245453u, 3104887145u, 3351756323u, 3565804824u, 593510978u, 1440842488u, 2052928722u, 3763542358u, 2082221044u, 2695478955u, 3620002745u, 3243394813u, 1517150465u, 894929577u, 2580012514u),
+    SC(837361887u, 3453789092u, 2309855209u, 378033399u, 2256509528u, 4264378139u, 4081028547u, 3340138100u, 1383148605u, 185364056u, 353728096u, 247343069u, 608869471u, 2972498095u, 3689425152u, 3278925625u),
+    SC(2469400081u, 1888481309u, 2532843452u, 4052257942u, 2186862274u, 2258834859u, 2365715162u, 1284329944u, 355894855u, 996810892u, 138713939u, 1717063244u, 2651551286u, 307683142u, 1284756640u, 3798742015u),
+    SC(2407191819u, 4130170626u, 102158303u, 923976138u, 818497074u, 1913100252u, 3973402469u, 3484201947u, 1522600498u, 131879612u, 858325120u, 2711721160u, 520031601u, 106929460u, 2119142212u, 2219034167u),
+    SC(1859652482u, 1982270833u, 3295213015u, 890003594u, 2136798493u, 3371154903u, 1146659975u, 696906921u, 3166317559u, 955705211u, 1180583863u, 3330787297u, 2013084914u, 23311778u, 3758695376u, 2307026368u),
+    SC(3966508413u, 3108604386u, 2519513183u, 2004790690u, 2083197362u, 2257886776u, 4003642187u, 2095280460u, 2916743599u, 1614995419u, 490768848u, 3955906389u, 2398250573u, 1392305430u, 3745186574u, 2664468445u),
+    SC(2406992684u, 618447250u, 1497006803u, 1359501753u, 3315321486u, 2504422236u, 534929540u, 1245180051u, 1365723526u, 4227111418u, 1890933716u, 4037479608u, 1111482045u, 1484677651u, 2199493436u, 1340109314u),
+    SC(3803045748u, 3672650159u, 2857127638u, 793391837u, 287503062u, 607978655u, 534219805u, 105605834u, 2109518740u, 514718475u, 145055778u, 1302749480u, 2805602976u, 547729980u, 3478655375u, 3800769175u),
+    SC(3212505532u, 1632448969u, 2600172653u, 3100460467u, 975352145u, 884639533u, 1048862115u, 45212651u, 277690855u, 2365098530u, 4222214741u, 589724629u, 730137700u, 4045894201u, 1967320108u, 1343380001u),
+    SC(143654015u, 216819072u, 1536345590u, 2502787788u, 901050472u, 2807568775u, 155106393u, 2399031524u, 942517450u, 2494835774u, 3121961159u, 2184791396u, 3549533129u, 2342423796u, 2789065946u, 1295485516u),
+    SC(2970919812u, 250916448u, 3116722606u, 1668197159u, 2423316999u, 886014903u, 2726515668u, 2100958507u, 935814972u, 3851346442u, 1618363276u, 2612944063u, 3145883766u, 1837789185u, 2978530423u, 3433298544u),
+    SC(3826361391u, 3792511926u, 4202074017u, 3809483052u, 3484470571u, 420792794u, 1652405160u, 3353870768u, 4273059739u, 1139702144u, 1918024641u, 1921708698u, 2405968046u, 2330740747u, 2445824008u, 2509967417u),
+    SC(421488766u, 1178805011u, 3229947946u, 3991267268u, 822442711u, 4059336663u, 3414249421u, 1961761177u, 1415885867u, 1064816173u, 1503895291u, 2206239960u, 1139131712u, 1028686310u, 240077598u, 2456665202u),
+    SC(1677674871u, 867214494u, 4128818431u, 28243255u, 2553771084u, 2241960944u, 2988478137u, 1349242241u, 1825238935u, 3397605681u, 4087905104u, 177468068u, 961764748u, 2279760016u, 988060457u, 811154747u),
+    SC(4024656933u, 3279357370u, 1776747884u, 48809512u, 4107170468u, 1759008086u, 1280828845u, 3086756892u, 959159135u, 665602501u, 2199543634u, 3269811122u, 2410315538u, 1377252048u, 2379813056u, 1368853205u),
+    SC(114430571u, 3715940493u, 466884880u, 561007134u, 2216511287u, 1314523801u, 2558526749u, 4152267941u, 781943354u, 3449929367u, 1391930598u, 3939770663u, 4021605552u, 2377078261u, 1571223894u, 2229725190u),
+    SC(3480985588u, 696097883u, 2445685773u, 3251415356u, 1833253577u, 2260004692u, 2987259557u, 76756803u, 2320990346u, 738656299u, 287243970u, 3212122964u, 3255178180u, 506860234u, 138127935u, 3949399061u),
+    SC(2975867947u, 1287544545u, 3520832744u, 237852064u, 670410175u, 4156564466u, 3243397094u, 100132926u, 180574101u, 1827869280u, 133078868u, 263429438u, 1327475444u, 1741722983u, 1618327750u, 1007662496u),
+    SC(2055619884u, 1334384857u, 2262031584u, 576821874u, 390388166u, 3755009843u, 3224165029u, 1790641422u, 819137308u, 3042488544u, 4222230451u, 1500312660u, 1411608826u, 1138272346u, 2448124869u, 3373130105u),
+    SC(2725887002u, 1691485935u, 245984570u, 3111937904u, 2940320320u, 2474759026u, 1082151679u, 1478697913u, 2935784765u, 1881062468u, 1738177201u, 4261622146u, 3915487699u, 1264068125u, 2712970940u, 1826889798u),
+    SC(3907159408u, 1544946027u, 1619800090u, 2891577448u, 4150859910u, 639545370u, 223243974u, 2850409590u, 2452947733u, 4175921233u, 191904634u, 1229091442u, 3381193318u, 661233336u, 4076551852u, 2668271677u),
+    SC(534367992u, 351534209u, 2153116416u, 2805266892u, 1188697477u, 3107569267u, 1167985889u, 2325687229u, 3703895871u, 2769276046u, 1858324251u, 3225808928u, 3261954473u, 2034902477u, 642288653u, 2628498782u),
+    SC(840637180u, 1881628630u, 265587010u, 3744878447u, 3322533046u, 3478017869u, 972139782u, 2457755409u, 325643503u, 2156638993u, 2929382255u, 2320269819u, 1918533880u, 3976369792u, 3316991075u, 2158875453u),
+    SC(1308568059u, 1696129939u, 3671116505u, 2967388759u, 4193197724u, 3305953089u, 2164835374u, 4141334386u, 1096382574u, 95047298u, 1299971334u, 1899940086u, 3643772811u, 1211125501u, 3838899394u, 819967756u),
+    SC(2474280101u, 3949135196u, 1706124001u, 440348244u, 3359226226u, 2510864825u, 658732023u, 1559043595u, 2687531195u, 3205604177u, 3665802165u, 775846445u, 1656824497u, 2848954708u, 1395216183u, 2036772806u),
+    SC(3191843483u, 2091611064u, 1337108605u, 635142085u, 1458598803u, 3004660858u, 1457456199u, 3916219346u, 3875872480u, 450335919u, 1461562564u, 1318189046u, 2457224298u, 2117373665u, 43616616u, 184219519u),
+    SC(1488165995u, 3426145542u, 1985815770u, 1616435165u, 915574035u, 2969297400u, 3330334485u, 1970051905u, 1151243921u, 2863154905u, 2806066039u, 1945611887u, 3035421086u, 207062589u, 2909983728u, 1111323903u),
+    SC(2602084721u, 2976254790u, 1913528576u, 140866604u, 2358323243u, 477284274u, 2173877705u, 3279312792u, 672326946u, 2561538109u, 750811795u, 1241927702u, 736267575u, 94174544u, 1819881009u, 853603487u),
+    SC(2797882371u, 3685536957u, 2050351623u, 1635223590u, 3362209989u, 3374924503u, 4147780414u, 3737187742u, 1932618620u, 3522835472u, 1991718695u, 2326739398u, 576246430u, 3289153760u, 2037683148u, 1884686207u),
+    SC(536553301u, 1653602517u, 3627501915u, 2494396576u, 1574838339u, 3153738410u, 564156986u, 560475875u, 1241807095u, 7048044u, 4292449837u, 4144900739u, 2802992045u, 3331387372u, 1603645432u, 3686110267u),
+    SC(2930033806u, 906301764u, 1210398888u, 149839730u, 3061457383u, 150684252u, 1030692472u, 1100710531u, 1159187128u, 3264131991u, 3179926038u, 3463516978u, 2194126128u, 1801734555u, 571915177u, 1101531943u),
+    SC(3720715258u, 1603011184u, 2218195643u, 1342425711u, 194457364u, 942403879u, 4113136016u, 189715435u, 4140036511u, 3087955382u, 1405317302u, 1948272105u, 2910698624u, 983131798u, 2573226821u, 3956905409u),
+    SC(572018663u, 3979352877u, 1656718317u, 1685335919u, 2496791753u, 2255119229u, 218350987u, 88899752u, 2645718312u, 276014037u, 1635399837u, 3312026197u, 1002790250u, 998296244u, 2900582720u, 2172236866u),
+    SC(3850770420u, 1961127754u, 1957752109u, 1806681035u, 1686684944u, 2266197738u, 4186612602u, 4060204787u, 3429528437u, 1390272606u, 1908351047u, 3566879152u, 3333505506u, 3841268180u, 919927012u, 4071236128u),
+    SC(3249160338u, 1524483582u, 3731631194u, 3128144882u, 3073985039u, 486704236u, 1529480057u, 2186251841u, 2534649607u, 3809146208u, 2501299827u, 1350806355u, 611696422u, 91305328u, 682985153u, 3532417147u),
+    SC(1252382861u, 2304205913u, 30200258u, 811910936u, 1776603936u, 2964790106u, 3230476570u, 3252642152u, 487498779u, 2438736014u, 3333647555u, 4152386689u, 201622658u, 3706029741u, 4064334634u, 3373524710u),
+    SC(2475126161u, 1930655796u, 3701858706u, 4203125250u, 1938637169u, 958263783u, 1126789011u, 2728962423u, 2034779709u, 851104848u, 619068829u, 3581438569u, 1945922703u, 2636807229u, 3805739949u, 2053396388u),
+    SC(209767805u, 807829541u, 2989743379u, 4075990839u, 1561856010u, 1422132974u, 1357154575u, 2837150504u, 2675160459u, 521998841u, 373881092u, 2893730421u, 2657247433u, 663159442u, 663741729u, 3071851595u),
+    SC(3535611097u, 2111087429u, 2831476823u, 2544485132u, 3907512260u, 1021811640u, 4221838606u, 2697512395u, 856624312u, 365631793u, 2419265621u, 2157883432u, 89843861u, 3994693879u, 1716610745u, 105466782u),
+    SC(3571753890u, 2430528024u, 4212475261u, 4088109077u, 1567761801u, 1364867256u, 3694146311u, 1574431220u, 1213483326u, 2010180785u, 1949031579u, 2770443930u, 1908767340u, 3105142949u, 1860968925u, 1048386593u),
+    SC(4043009268u, 2165171097u, 4241601094u, 4041698859u, 3541628974u, 369224682u, 662290029u, 1193504025u, 3819786592u, 1715995193u, 2293281175u, 1051894814u, 751416531u, 2096467207u, 2903432679u, 2891537839u),
+    SC(3712927118u, 1061963532u, 916002624u, 3492483015u, 2588909041u, 2556721840u, 3958848272u, 881166649u, 980339846u, 2746243278u, 4068001849u, 1411289820u, 1937400720u, 2499781732u, 400784800u, 1084473315u),
+    SC(247818512u, 494852436u, 3572490678u, 3304500705u, 720449338u, 3720829579u, 2413489079u, 2878361169u, 882361983u, 1566134129u, 1126633754u, 3794740769u, 3195845293u, 2999721325u, 3188424272u, 3562063178u),
+    SC(3393576696u, 85481125u, 2091245994u, 1693303755u, 3797874352u, 3800743333u, 2824706585u, 3685365189u, 3683328855u, 646822379u, 3759406302u, 286487234u, 1857351017u, 1517960688u, 1293759451u, 1882530226u),
+    SC(3024901000u, 2521113058u, 1208207542u, 1036559508u, 1090042389u, 1130160870u, 1601028242u, 364157511u, 773210973u, 4077669248u, 3474087428u, 3092342457u, 1352175785u, 3252351477u, 1917201027u, 3726216448u),
+    SC(2511812066u, 897986324u, 244486565u, 1262934391u, 866258145u, 3046852099u, 1718419146u, 3764251174u, 3777500933u, 1597554201u, 163354999u, 3068660744u, 4062885297u, 678339923u, 554980981u, 642427833u),
+    SC(2212092007u, 2411397731u, 1827197489u, 1055158636u, 2707190194u, 1723967438u, 3848874221u, 1944436220u, 3762900015u, 3197301042u, 4026432888u, 1235175936u, 3276810178u, 937395525u, 2568513659u, 1804898886u),
+    SC(160136325u, 2689356909u, 3153509073u, 1762976327u, 490424204u, 4077770480u, 780416880u, 1237036547u, 1989950357u, 926146521u, 3640819108u, 2701855333u, 3460368121u, 1144408434u, 3848914493u, 992661079u),
+    SC(1021818487u, 2234332396u, 875924111u, 1302752595u, 1963039921u, 430202366u, 140772906u, 2746297925u, 1758624015u, 25398150u, 2519149643u, 3588495529u, 47121369u, 3729060376u, 3827655389u, 1182679194u),
+    SC(2696685812u, 3571085569u, 1104207015u, 1364470659u, 1800453576u, 160936593u, 3765727870u, 3403121519u, 1859641673u, 1089632284u, 3599082881u, 2582733778u, 394194108u, 3396882980u, 713771097u, 2548333704u),
+    SC(2589399971u, 1387386411u, 1314728202u, 3235125635u, 2541031364u, 2585316200u, 419303851u, 504912907u, 445762765u, 2998007183u, 2633764350u, 3544598807u, 258746480u, 2614985000u, 4284605077u, 2904246993u),
+    SC(4221588559u, 3453148787u, 220523685u, 1437123760u, 1309891613u, 2202586003u, 3577701502u, 706853311u, 2047976485u, 2766957263u, 783279665u, 4286824042u, 4145704137u, 4158383095u, 2933227012u, 661935754u),
+    SC(3647677754u, 517731938u, 956480983u, 29604569u, 3970765077u, 1164004168u, 1601879201u, 3566340763u, 734562712u, 4182882353u, 791138463u, 791876918u, 345633224u, 2977100274u, 1082984032u, 991478504u),
+    SC(725358542u, 276936741u, 2494436570u, 261563385u, 2552444974u, 2491159382u, 329562278u, 1109818411u, 2764920991u, 784147547u, 2294804986u, 1115302582u, 3883009474u, 3686582095u, 3686660713u, 861948159u),
+    SC(1768523648u, 4255928876u, 1764834983u, 774131101u, 1064027593u, 1339580709u, 783639401u, 3378788857u, 3907957702u, 1175406431u, 3228260675u, 2612631885u, 2372813588u, 4263510542u, 3238010743u, 631255380u),
+    SC(506742289u, 1286921292u, 2520651564u, 2616995658u, 3512172284u, 2922380397u, 1983471353u, 2693041256u, 3736844511u, 3874855438u, 194434148u, 1002204497u, 2730182177u, 1616502301u, 2759017324u, 1078942489u),
+    SC(1825549826u, 1283402394u, 3121791377u, 3174425223u, 3586327172u, 3290905119u, 3310923405u, 678077978u, 3254862196u, 209232637u, 3544362466u, 1373919373u, 2495925745u, 4001607144u, 1424262024u, 3068644113u),
+    SC(1533006983u, 1773576499u, 901712430u, 1638011530u, 3678606655u, 2492974974u, 3274381026u, 3394007694u, 2572432703u, 2990316868u, 3940492850u, 377950645u, 1515506138u, 1405358216u, 1358854093u, 2364542071u),
+    SC(1802805847u, 665797853u, 1643887570u, 1931720255u, 3869515165u, 4114686485u, 1705421244u, 56428190u, 172888596u, 4051406335u, 3049089180u, 1593855128u, 968391238u, 354703190u, 1208589619u, 4096959308u),
+    SC(1366401415u, 2330586369u, 2205419705u, 4261999383u, 2257084524u, 179176626u, 1674309955u, 3101913762u, 3051871851u, 2520863692u, 4268008562u, 2324635812u, 1155173909u, 3314792424u, 1746141814u, 186068230u),
+    SC(234481770u, 1127739186u, 890787468u, 3844692139u, 3687746194u, 2215343468u, 664704717u, 1137240077u, 1413659374u, 3341764106u, 286167030u, 512983346u, 1353895135u, 102318559u, 1599675316u, 1929543079u),
+    SC(3456565881u, 3949928305u, 2944887479u, 956562384u, 2896053907u, 2070754055u, 784859522u, 948422736u, 3733183993u, 2298073925u, 3791596153u, 3911158489u, 1856123031u, 1401806468u, 2929778388u, 3064026603u),
+    SC(2686803042u, 1152370764u, 1478723894u, 3385888054u, 2531621019u, 248679488u, 1986523976u, 1278162429u, 2481116167u, 2935527639u, 210338451u, 4213240354u, 114118679u, 3445778079u, 401476886u, 2000449402u),
+    SC(2927812269u, 3077397975u, 336466327u, 2743336802u, 328079424u, 3694100208u, 3574754762u, 2263930987u, 597539756u, 3400140665u, 2851526892u, 774944144u, 1926458200u, 429533126u, 1599608266u, 1461753418u),
+    SC(3473512910u, 3202768430u, 3583394846u, 2828280929u, 2546309036u, 2617837700u, 1153660377u, 372450195u, 1713425362u, 4034194901u, 33524949u, 1169018301u, 476465874u, 110319744u, 2253782963u, 980716708u),
+    SC(1605676916u, 1678028827u, 1673523636u, 464304950u, 2663409665u, 2488558122u, 1982169139u, 2631112284u, 1179431649u, 751724924u, 3557380767u, 2760799304u, 2439664052u, 1498742419u, 3650937746u, 657113077u),
+    SC(363805706u, 1186276142u, 90068615u, 2730248908u, 746206479u, 2165629856u, 429105395u, 456267444u, 2919461787u, 3184408752u, 1194699993u, 977270714u, 2261260446u, 1453701943u, 2911085940u, 3453246083u),
+    SC(1560294865u, 3490237637u, 1120635741u, 853111770u, 852002695u, 1678574693u, 1993555510u, 1410026256u, 1150212325u, 3220873000u, 1720256031u, 1940344599u, 1994099340u, 3585388345u, 1634985918u, 1851049061u),
+    SC(2488037619u, 2633451999u, 3988378402u, 4291206714u, 2752186116u, 4232771861u, 3760700116u, 2211009831u, 2964065339u, 3209204530u, 1688660316u, 3835324058u, 3742412029u, 1222782914u, 437841085u, 3094114060u),
+    SC(4199684592u, 2196520010u, 1059350356u, 3671469828u, 1390567973u, 1825737420u, 2221655510u, 354305026u, 852394473u, 3594531122u, 3619049254u, 2687012913u, 3950185771u, 3704620634u, 28632051u, 175831785u),
+    SC(3388254768u, 3720274531u, 84493658u, 2240513304u, 2244387179u, 1570500658u, 1883519272u, 950210270u, 1593251782u, 3023613745u, 2592679833u, 1186413479u, 2916221748u, 3271187374u, 2707125810u, 883784572u),
+    SC(793572298u, 1951716713u, 1527632637u, 3341635582u, 86618978u, 3740180768u, 371988366u, 2071397145u, 3705311758u, 895937483u, 4101774560u, 4218843282u, 4269574085u, 4279525442u, 3584085687u, 2734150791u),
+    SC(605549942u, 772593482u, 4034544039u, 1375279934u, 2714438210u, 35941108u, 168466104u, 2039912773u, 1788270421u, 4175196604u, 2913798719u, 1640711405u, 1948186989u, 2528816366u, 4244350975u, 511182809u),
+    SC(2595368836u, 811211807u, 1734124986u, 3417562020u, 3560769034u, 4002498758u, 1828413880u, 1485341996u, 2936342266u, 2723712570u, 2062205226u, 2060311099u, 3038615915u, 751475736u, 3795538298u, 2754125886u),
+    SC(4148305570u, 610433318u, 42915960u, 2115323684u, 2007570214u, 1511403346u, 2270174493u, 614935404u, 3674924645u, 3829940530u, 4084386413u, 2362728725u, 4263277260u, 2287469789u, 2404419840u, 1464073462u),
+    SC(896887539u, 1418549224u, 3691755409u, 2342024625u, 279515835u, 2107055669u, 1231273343u, 3747377013u, 480538042u, 2023929085u, 3572328878u, 3176012129u, 2262387598u, 548496911u, 3306621325u, 3765936594u),
+    SC(2817126412u, 1229781746u, 373595546u, 2967136255u, 3728753090u, 4261616576u, 605832411u, 468719671u, 4071537070u, 1208696938u, 2538852361u, 996129652u, 1517773022u, 1324681399u, 3506963648u, 370803328u),
+    SC(1766137274u, 2458331257u, 2000123227u, 1985334896u, 1686342306u, 2424634394u, 3364839023u, 3395464631u, 639733672u, 3557683345u, 836257236u, 2529671504u, 275862395u, 1369642044u, 208925095u, 2955615449u),
+    SC(3298573104u, 365733487u, 3466095159u, 1484916220u, 2309565711u, 206703315u, 1589038307u, 3668701293u, 2063460426u, 1717240496u, 3771702441u, 2636828823u, 1648529820u, 1407392606u, 1645663868u, 1477326156u),
+    SC(3923870143u, 3062787640u, 3317100061u, 4045149432u, 2428553028u, 139920263u, 448181796u, 1805495951u, 2965176027u, 1060717335u, 151511648u, 3278183076u, 3517930661u, 3785572376u, 4234946210u, 3589234203u),
+    SC(2754107503u, 182403535u, 1532796498u, 3772178937u, 779978552u, 2878990524u, 1080222466u, 3728286500u, 2009325963u, 4268869943u, 1706627560u, 3030179561u, 2728870207u, 1307062728u, 1066827528u, 2511917378u),
+    SC(4123602642u, 3726449189u, 1263159344u, 3059132020u, 940014567u, 1593760077u, 2019414233u, 120001231u, 2129235258u, 1232619981u, 1532980683u, 3306967321u, 579854206u, 27688734u, 3620106425u, 3946404091u),
+    SC(2824275914u, 1820718342u, 823879984u, 1987794289u, 3784055239u, 4280644797u, 4066963480u, 3030138726u, 394657393u, 3454198153u, 2868280592u, 863735736u, 1399145269u, 1297852221u, 2001833375u, 1586143312u),
+    SC(143028063u, 2764624322u, 4074638584u, 434939332u, 3498355552u, 1739053436u, 261702398u, 3232188045u, 806625900u, 1060343930u, 795625901u, 3345137262u, 689252491u, 2817261722u, 4268306504u, 898118510u),
+    SC(1113550195u, 938159464u, 3783067592u, 3181643471u, 2460951221u, 1684127078u, 4094419276u, 2919663820u, 3898954351u, 2084758417u, 448213648u, 3893090812u, 157562457u, 1483849149u, 4019022223u, 3494726016u),
+    SC(259062846u, 501462013u, 1430357057u, 1138668734u, 918546095u, 1003084194u, 4172055101u, 1748119865u, 2336725323u, 535540489u, 3816245890u, 3601960312u, 2330293515u, 1084920906u, 3672376501u, 3659845123u),
+    SC(468279539u, 59582998u, 117682444u, 3942257180u, 3583796953u, 1134465127u, 1486926691u, 713232748u, 2141506095u, 2182671876u, 890587596u, 989921531u, 105373915u, 435068944u, 1660010718u, 1038260975u),
+    SC(32678611u, 3160178851u, 2331319967u, 1452582926u, 3910527881u, 1211230846u, 1212624211u, 839709573u, 2710366777u, 390810697u, 4189894981u, 1583809017u, 1191526151u, 1736625823u, 4116075454u, 1832468709u),
+    SC(102591328u, 1887726347u, 3078162529u, 399178409u, 2594602039u, 4269216782u, 2286387006u, 1154500454u, 3354705552u, 2256837345u, 1664005530u, 1821826662u, 3083121130u, 3405194450u, 1396228380u, 2834458767u),
+    SC(45314195u, 765092945u, 2035322287u, 79593254u, 1834222904u, 2457271375u, 3872190676u, 518442140u, 3221398516u, 747215025u, 3994460632u, 1634525367u, 2446195780u, 1636015519u, 1553991950u, 693890215u),
+    SC(1224066031u, 2879960995u, 1300222262u, 266973215u, 1689194133u, 1780966970u, 2278385193u, 4067461208u, 2361625783u, 4242827044u, 2083457484u, 1392079806u, 2427387327u, 3039335906u, 3096380392u, 4264736171u),
+    SC(3859395991u, 777962023u, 1868364935u, 1740035380u, 2918967785u, 166071174u, 3917602203u, 1046663072u, 1810481646u, 4280311763u, 3820510781u, 3153179258u, 861709846u, 162404511u, 172179045u, 4071895169u),
+    SC(3957590810u, 1529650376u, 1189842600u, 519094734u, 4053431931u, 765897483u, 716597761u, 2976718938u, 796332264u, 3841903569u, 60332477u, 426046938u, 2524801312u, 225489652u, 1171716372u, 2546364504u),
+    SC(2546814009u, 2475799023u, 1698509555u, 2600872911u, 3687263557u, 2211978047u, 4144887385u, 898513597u, 2690277764u, 2708846302u, 4189861317u, 1855937710u, 641388331u, 2721300456u, 333289639u, 4227037544u),
+    SC(2187929770u, 490721512u, 1405983228u, 3864369895u, 628310954u, 58200078u, 3211043777u, 3198674649u, 3158977969u, 2747132170u, 4283497951u, 3480192074u, 4205674378u, 2310748571u, 34277298u, 773782649u),
+    SC(1047871639u, 4088174045u, 393122177u, 1091284602u, 2210206769u, 1735582616u, 2524894106u, 1604423969u, 1953287833u, 3332558840u, 2693824161u, 1559839596u, 13270932u, 2134841345u, 325052021u, 2769870642u),
+    SC(3461583972u, 3030096199u, 2156536684u, 2315415654u, 2191073094u, 1001924858u, 1147482726u, 848520667u, 897121986u, 3099346787u, 102707162u, 700629899u, 2814224284u, 296930625u, 2806860802u, 1982750169u),
+    SC(3375618521u, 3450213805u, 2059672938u, 3863640011u, 1151514217u, 559101545u, 747684783u, 1407404509u, 1248698959u, 2210065339u, 2401930974u, 697019342u, 2723874122u, 2714029073u, 4193300699u, 91407888u),
+    SC(1167762491u, 447316319u, 3910233902u, 2027806191u, 2811112943u, 671251793u, 3498156988u, 2148215492u, 449764291u, 3734593072u, 2976448724u, 3453800946u, 1549881686u, 264410693u, 1272315004u, 1676252117u),
+    SC(1596630489u, 2556603689u, 3947263332u, 104442876u, 4282667828u, 2586887380u, 992475411u, 507185758u, 1461635627u, 3860663282u, 3655268794u, 1146829234u, 1523563447u, 3712888059u, 3463791049u, 1638719812u),
+    SC(3966167581u, 3872152921u, 2352561768u, 439584073u, 4230757759u, 2491105525u, 1969757792u, 2297756957u, 3608281051u, 993494069u, 1486151593u, 3500493178u, 1430287263u, 2742052247u, 2327305194u, 2837974866u),
+    SC(1791311349u, 2852749101u, 2575560728u, 3172772665u, 1772947000u, 3347400619u, 440931970u, 2908816894u, 2515966593u, 1361557785u, 2492002852u, 607156585u, 1020598166u, 3147859320u, 2885455365u, 1712891288u),
+    SC(2829314530u, 2655703293u, 3295075512u, 4257230068u, 385571973u, 187979005u, 943911209u, 2677457072u, 3750161214u, 805756581u, 248959314u, 4086618051u, 379292937u, 199112325u, 3457387093u, 1729551403u),
+    SC(1353147602u, 2698540059u, 2515305634u, 4275727864u, 499030140u, 830869862u, 851708989u, 3873121564u, 2994865136u, 590944193u, 1265066794u, 3466285357u, 1990772706u, 1124747840u, 2244981794u, 2145652821u),
+    SC(3267564721u, 1593433885u, 646278303u, 2799934713u, 467256708u, 1479054249u, 1110918858u, 448077561u, 2726269574u, 4286570410u, 3108612597u, 3583969463u, 2720996913u, 3877068100u, 2481068452u, 3911890777u),
+    SC(3127203205u, 3661940945u, 725410677u, 3793790147u, 1686539125u, 923786101u, 3690380178u, 1990841311u, 1030021483u, 2688170075u, 3740372833u, 1127007388u, 3185168462u, 1875412795u, 3843449787u, 3394230864u),
+    SC(1027996233u, 3570466980u, 3047647845u, 27594766u, 1455230227u, 3118547394u, 2896547823u, 2758696974u, 9606460u, 955182658u, 3789198257u, 1014348360u, 3660593422u, 1930953196u, 3982220331u, 1476759926u),
+    SC(3831808838u, 3826107362u, 1088805230u, 531808524u, 2212866943u, 1158907286u, 1285843716u, 3163306636u, 1676757830u, 405360829u, 673318314u, 927782523u, 212034724u, 4118608143u, 3349975254u, 1376046926u),
+    SC(346546479u, 3795170055u, 95474200u, 3174942496u, 3580837860u, 3342352867u, 4260638165u, 2929993352u, 3616965580u, 1087304834u, 3983155924u, 2167907568u, 3938652745u, 2598451209u, 2666263459u, 367656746u),
+    SC(2390424504u, 565146546u, 632508410u, 3140482804u, 1641213483u, 2245384502u, 2845814904u, 2520262846u, 68044662u, 1520465548u, 4032151200u, 3792572514u, 3142747248u, 3739623105u, 1825164925u, 2926254163u),
+    SC(2640580962u, 841465103u, 1271897887u, 2656888873u, 2105819221u, 2323563078u, 1528170128u, 1395225971u, 3977085856u, 1744837605u, 1879473828u, 1895743646u, 528888021u, 3663534892u, 309081539u, 2600991885u),
+    SC(1733871318u, 3655638431u, 1092990251u, 3822744807u, 1388003569u, 1152323339u, 2077754761u, 2143829679u, 1956307086u, 3265932342u, 975346493u, 3914825148u, 1602036428u, 3563595491u, 1780266036u, 407884434u),
+    SC(188617120u, 1164979595u, 349781494u, 978063861u, 845358873u, 3030597560u, 228660500u, 3160528698u, 3336655537u, 723943106u, 27408530u, 2360963140u, 2522924726u, 884092184u, 2592537561u, 2849333995u),
+    SC(1352869354u, 993040657u, 20388623u, 3770278518u, 326890556u, 571509656u, 2572080544u, 3597641201u, 2490215711u, 3550349989u, 2322957607u, 2604265450u, 2325297564u, 41223993u, 3756712256u, 927315726u),
+    SC(4157141577u, 1005573538u, 3479700174u, 2328168686u, 2842902950u, 2758737465u, 303358754u, 3915290209u, 1007103172u, 4005688176u, 340491968u, 1502498198u, 1463321575u, 4198448989u, 1312020621u, 506776423u),
+    SC(808270672u, 3243520902u, 4038113614u, 2622089832u, 952625083u, 2260896963u, 3365297608u, 59737526u, 2558543824u, 3633424943u, 1622568538u, 2529660049u, 898158888u, 3571971872u, 1450365530u, 2284914500u),
+    SC(3415140136u, 780032934u, 219057867u, 1441654938u, 490213628u, 2967009386u, 4227152765u, 564072119u, 1258613291u, 4021096601u, 147432675u, 3473183170u, 3155213664u, 3765047694u, 1979580771u, 2877330637u),
+    SC(1683794475u, 1242355882u, 550465284u, 2893259933u, 1962483765u, 4178301723u, 555053780u, 3486907714u, 2034182550u, 905566145u, 3731011150u, 2951026395u, 2963936035u, 2136068262u, 3070001990u, 4219401657u),
+    SC(1295463471u, 1632155111u, 1412741343u, 1712838220u, 4027260019u, 1032189171u, 3869002279u, 962550305u, 1677723947u, 3569731333u, 1179286962u, 2981541479u, 1324079069u, 953179358u, 3512171914u, 1403455677u),
+    SC(3862216471u, 38668210u, 3031196293u, 3978870073u, 1954160948u, 921136445u, 3177787760u, 415293656u, 3435907806u, 1266853150u, 3273497995u, 1796290678u, 1586913531u, 3902261843u, 34453619u, 334098465u),
+    SC(2157972966u, 661112083u, 3586127157u, 1125983642u, 1690603526u, 1002412331u, 2769358853u, 906817336u, 2110698889u, 3906417510u, 3295142462u, 2413592067u, 2992770551u, 2502997682u, 66903263u, 1653536114u),
+    SC(1617776870u, 3527233773u, 2589688841u, 4045233270u, 3136665445u, 4145635933u, 95609565u, 2660207119u, 435508370u, 1169274050u, 4240560672u, 1813451264u, 1287340520u, 3145501895u, 1220818539u, 1068705672u),
+    SC(2626292244u, 4157886391u, 1249814581u, 2924091698u, 644624515u, 953575972u, 2145214702u, 240059424u, 1120322103u, 827821522u, 837658145u, 2175720745u, 2268593274u, 992733364u, 3491263577u, 3856209562u),
+    SC(3603758327u, 2175037272u, 4288282964u, 2319546660u, 439538634u, 70946393u, 3468440539u, 506845724u, 2714417690u, 3464784781u, 2336761062u, 359725106u, 2278281148u, 2432849621u, 1757278755u, 2250049615u),
+    SC(2365256554u, 1045184498u, 1163326534u, 1229441232u, 1861049837u, 2752430298u, 1167506137u, 4126335940u, 2568711884u, 3991326205u, 3812590033u, 3238428450u, 1802647355u, 2529833468u, 3356362386u, 3639854295u),
+    SC(3563863425u, 1527724555u, 3169794419u, 2355784903u, 412633520u, 1226309024u, 1411123435u, 3085329568u, 894585782u, 3495159255u, 3366832566u, 981790081u, 1490026137u, 1078060610u, 535618954u, 3647455577u),
+    SC(2396516517u, 790597111u, 4163751475u, 3831725519u, 3805191029u, 3389189892u, 2428649452u, 729473023u, 4028915911u, 3021525260u, 2529325605u, 1039022950u, 1273080413u, 1115117989u, 1569767971u, 1653447167u),
+    SC(1128188636u, 2829275581u, 1387941228u, 2934587376u, 2187085490u, 2327653419u, 216696310u, 1839899338u, 1295741372u, 3268923767u, 1171063748u, 2264109283u, 4141061884u, 2211464079u, 2553943087u, 371816421u),
+    SC(3229032179u, 272072579u, 2057027037u, 2180408363u, 3120843067u, 364926187u, 614154140u, 3147826918u, 1045683627u, 495020546u, 2023278260u, 2005748808u, 3790220083u, 2788775344u, 2018374232u, 4014787358u),
+    SC(3694002726u, 1248495545u, 1402565507u, 3814485208u, 2449943464u, 2806119715u, 2415110597u, 257522391u, 2307843910u, 3973445411u, 1141555455u, 1868136069u, 2379984073u, 3418885633u, 3634610673u, 2081605453u),
+    SC(381341236u, 1504545983u, 533067649u, 432905777u, 3494107058u, 3984826115u, 300988256u, 1792718705u, 16139570u, 1858508771u, 748829049u, 1924315188u, 1726494129u, 735351363u, 3902194143u, 3224351172u),
+    SC(2948156815u, 975639609u, 342178216u, 1760559942u, 2599771866u, 2208072100u, 119927717u, 2104084278u, 2950375758u, 2757034781u, 2802470655u, 1969477476u, 3186851751u, 1435814347u, 946768849u, 2740060632u),
+    SC(3140604470u, 1251538932u, 517671655u, 1612244458u, 3972216704u, 1601707463u, 112286377u, 3504905076u, 436620291u, 524799102u, 3444174898u, 4108114270u, 2278277770u, 2073926695u, 2838121503u, 3657636506u),
+    SC(4147845996u, 1270832552u, 375410403u, 251062331u, 605964398u, 3609716480u, 29606165u, 1011030200u, 2586357102u, 165039290u, 3045769765u, 1543615073u, 632948975u, 998072315u, 1198496650u, 1821154071u),
+    SC(104583698u, 3504194976u, 2230905467u, 1767922475u, 1888257894u, 252523283u, 2989943073u, 2444208292u, 250017014u, 75644978u, 184266931u, 2851943469u, 50055822u, 3438074639u, 2737862296u, 3312205415u),
+    SC(1667748395u, 906395682u, 816060087u, 2355662968u, 2524681565u, 2271204905u, 2650832774u, 448554085u, 3287162669u, 350648639u, 400835757u, 1435892147u, 294458951u, 2455363771u, 3965880471u, 4136900587u),
+    SC(1692591427u, 4223137070u, 1469062714u, 1149473990u, 210906383u, 191048783u, 770728360u, 2491783022u, 1679450158u, 862611636u, 4232347226u, 1482925286u, 2303793474u, 1338900763u, 1224292319u, 4239075916u),
+    SC(774441725u, 415774152u, 3520568966u, 2644251426u, 3782115914u, 1625718584u, 3602853937u, 3825131974u, 2139447950u, 3539626855u, 124283662u, 3264886310u, 3659058348u, 1580677236u, 2519098456u, 2033782561u),
+    SC(2241470602u, 206003517u, 4126288135u, 2559342452u, 3233426892u, 3624641579u, 401543303u, 753811486u, 2791818821u, 2005824570u, 3593392611u, 3483447247u, 2226750117u, 4046757425u, 862093306u, 2333734360u),
+    SC(3374913800u, 3435465390u, 4053535622u, 2191514723u, 3054031835u, 3643476281u, 3106586666u, 45920033u, 3854904247u, 1192304472u, 3339932360u, 3002894843u, 550206789u, 2009473818u, 400085019u, 114107801u),
+    SC(1345688720u, 1119204896u, 2024472897u, 521805131u, 1690059463u, 1490699353u, 2957853124u, 1640954662u, 4129194557u, 3062629967u, 4161641432u, 4067620887u, 880546602u, 4156369649u, 3853799914u, 3209626848u),
+    SC(4189911783u, 3601068539u, 1629980611u, 1404384748u, 972200449u, 2672161854u, 2070016734u, 3299134451u, 4107824751u, 658167783u, 2418891417u, 1358726250u, 2790676578u, 2933769851u, 687605665u, 590346371u),
+    SC(29949579u, 2417815632u, 3913023492u, 2960541461u, 1613415657u, 2139971002u, 3614732345u, 4048195922u, 2992495412u, 2084907330u, 2450799470u, 3407476863u, 3022655271u, 4143402060u, 2581051404u, 2100721308u),
+    SC(63245281u, 1287535239u, 3546518652u, 1857369312u, 2415294159u, 1093387485u, 743715121u, 3884381522u, 1144276764u, 1845753344u, 3634526069u, 1147587280u, 424629565u, 3143971384u, 2316231843u, 2600838989u),
+    SC(1691185586u, 1431597816u, 4204170059u, 1334610724u, 1530827181u, 1839059977u, 4268912686u, 3875873525u, 4054960954u, 3925493845u, 47709226u, 2174473769u, 1077217852u, 377979567u, 1543444184u, 2314068740u),
+    SC(3250586692u, 3313812294u, 3518881496u, 2093222670u, 4254034407u, 3538717644u, 3290313748u, 1637545896u, 3593581716u, 1044376496u, 2277194010u, 3582004065u, 4153261260u, 3161318286u, 3993567325u, 1032295478u),
+    SC(4199585154u, 3671440225u, 3343192016u, 998132640u, 800918568u, 2945915798u, 3421460822u, 1067624429u, 645670756u, 1635528568u, 2595786967u, 1455301013u, 718143323u, 881899542u, 375270198u, 792589541u),
+    SC(1700646630u, 2253296234u, 2799722244u, 3053765338u, 890723852u, 4157760720u, 1351748934u, 3248633964u, 3660492506u, 3204852916u, 3123525316u, 1737907114u, 1595785784u, 3051498999u, 733877490u, 3488487880u),
+    SC(1790304684u, 461104676u, 159158206u, 4274373844u, 750902790u, 3512343531u, 1980169226u, 3745259838u, 653886386u, 82522524u, 1950605348u, 2146230104u, 4164129421u, 1317051708u, 4083298788u, 3500794982u),
+    SC(3352987294u, 60598829u, 3925293581u, 1064545139u, 1646584485u, 1206868723u, 1599774033u, 1623351099u, 3919253762u, 1235617752u, 313478390u, 1991134282u, 3487305609u, 2663520093u, 3348376427u, 1088051103u),
+    SC(711806113u, 1595686125u, 3983018271u, 2941064347u, 3792398420u, 3204534404u, 2848722209u, 1229254553u, 3754063496u, 2928842217u, 2878182020u, 1785739973u, 1555319795u, 334592436u, 3470177848u, 241572576u),
+    SC(1148346547u, 3148292684u, 2858786672u, 2984735082u, 2455767591u, 403871093u, 770059482u, 298337984u, 4051582479u, 871313118u, 2306918690u, 6371655u, 2201084582u, 1076234646u, 3683492320u, 3700005311u),
+    SC(2363169965u, 3132780547u, 2370506564u, 456207085u, 1518831782u, 1850955517u, 1536773999u, 2809665897u, 3013983502u, 640575290u, 2927353965u, 2371273219u, 3095875812u, 3121008545u, 2081914589u, 1951623543u),
+    SC(683544400u, 4217436421u, 405945964u, 3707005964u, 3158191119u, 392004982u, 2232576645u, 3586830078u, 1556109559u, 4212689996u, 3776185385u, 1452028278u, 2375577539u, 3915647454u, 566205347u, 2250994464u),
+    SC(191745210u, 3710778068u, 2338922890u, 3654255518u, 2206081634u, 2140081846u, 4063528098u, 2571531168u, 3787541207u, 696194598u, 2001380011u, 1573679882u, 1231171958u, 2927750831u, 3039624524u, 4197312914u),
+    SC(3831414472u, 2283010021u, 2055130825u, 3697266086u, 3117134073u, 26979869u, 3195472213u, 3816188551u, 979542203u, 1288648579u, 2084063365u, 2060167839u, 4178955391u, 329541718u, 1072772587u, 234598522u),
+    SC(3734138743u, 653499720u, 504077909u, 582469748u, 1505533191u, 3747999979u, 129114090u, 3906784699u, 2635665065u, 641548864u, 615913678u, 305788641u, 291234481u, 3609308064u, 4126369782u, 810388997u),
+    SC(4150399876u, 543595524u, 1836664839u, 1452745396u, 2447648558u, 319156369u, 3041526770u, 3975334640u, 3502762213u, 2720527017u, 1549354280u, 1167116963u, 814270763u, 3032993645u, 315790288u, 1268664596u),
+    SC(1316576902u, 1157623304u, 4098705198u, 2342579101u, 2781721041u, 1637499773u, 1250672616u, 1448929105u, 1385355493u, 1199728889u, 3147516899u, 3344033159u, 1694731349u, 2580231497u, 1956545506u, 361800928u),
+    SC(1894139529u, 2839851071u, 850606743u, 3365025073u, 3455540877u, 3898045785u, 3209024210u, 3719629629u, 2792736485u, 1175161252u, 2732253795u, 3340660447u, 2455409595u, 2836829466u, 1399116370u, 203576710u),
+    SC(560167982u, 1747657854u, 13339676u, 2337013535u, 1199502224u, 1000186106u, 2961923314u, 1533478251u, 3814135390u, 1047927381u, 2118921068u, 1920828295u, 3312544600u, 3796700676u, 2199164830u, 1318246530u),
+    SC(1989256089u, 148558561u, 1947877685u, 1621435u, 3635305393u, 1952885065u, 2751815843u, 2619152740u, 576656388u, 2958777270u, 3451855510u, 4151213863u, 39266318u, 684100580u, 3636993095u, 172108660u),
+    SC(1954748068u, 4086630473u, 2599788875u, 41855993u, 2966494865u, 226972363u, 1770625784u, 2041549570u, 3452818642u, 1809254872u, 3285744658u, 1842913988u, 4127259675u, 2659468831u, 395510907u, 1543339746u),
+    SC(2941816235u, 943319132u, 1841842854u, 3252703892u, 2842724689u, 2147922832u, 3271549167u, 4142766986u, 2748544576u, 453399695u, 664015647u, 1577069229u, 1634509109u, 2364590109u, 2265011222u, 937021424u),
+    SC(3180452960u, 829452283u, 431363990u, 2572626096u, 1602657543u, 1863017783u, 902065680u, 3652464070u, 1016479441u, 1517614534u, 438885262u, 3725002864u, 3452841207u, 3595721325u, 370610294u, 1156666290u),
+    SC(3861234853u, 2437286847u, 1547347331u, 3301645855u, 203435138u, 2112600109u, 2555851501u, 3991506759u, 3492201977u, 2835567510u, 501548340u, 2387265024u, 135439457u, 3373476253u, 2145242305u, 1500559150u),
+    SC(1808934910u, 3568407471u, 2341754172u, 1904433124u, 304926807u, 3646521576u, 3955818076u, 2145037340u, 1598022976u, 177778756u, 2664969683u, 2963453159u, 3328836937u, 3837245936u, 587027017u, 3324094969u),
+    SC(661682725u, 2304667448u, 1379743858u, 3316862588u, 1755377913u, 1422323529u, 1560241764u, 517678601u, 4017049486u, 3365131927u, 1777552184u, 4160124905u, 3856555153u, 1221456734u, 60915746u, 1051162606u),
+    SC(1615996046u, 861487438u, 3145167082u, 69750140u, 3222761664u, 3881068251u, 523324943u, 3488672734u, 1033379928u, 1559287110u, 2678468098u, 178607867u, 437962707u, 481915180u, 2333183530u, 3824662434u),
+    SC(4073413459u, 1336283724u, 383264006u, 2334300247u, 1297073766u, 2605012238u, 1819648276u, 4084266684u, 1558075143u, 1671809746u, 328543727u, 1137473439u, 2395593915u, 3321546912u, 2910483467u, 1916866862u),
+    SC(2007859733u, 2682698233u, 3766497479u, 2807848991u, 77110097u, 1324800800u, 2862418723u, 3900330030u, 2456330734u, 4290922802u, 1954900701u, 732031923u, 12662392u, 2578420522u, 2281465869u, 3936055357u),
+    SC(1142453389u, 387774479u, 2818052055u, 3268905243u, 1556720143u, 3125723592u, 2702494665u, 1250939549u, 85131909u, 2045778815u, 1928430370u, 2994339450u, 2568405354u, 2793171694u, 3132863512u, 4212667841u),
+    SC(380586336u, 1871300731u, 2119762356u, 3508175469u, 309221887u, 3749513347u, 490199014u, 913528288u, 437486656u, 1399989193u, 3907072458u, 2393093004u, 315156714u, 1357777398u, 2359608013u, 1286622254u),
+    SC(584188988u, 2873373112u, 3480730124u, 2910946444u, 120629040u, 891780682u, 2925761273u, 3725725597u, 3615055277u, 1583040208u, 2620805642u, 3355234207u, 1299315145u, 2396247130u, 1127173995u, 2568719053u),
+    SC(92174987u, 880960819u, 2116039520u, 794969270u, 1104751755u, 2990642996u, 2679845489u, 1466393346u, 1301428456u, 3125528754u, 3282817771u, 1806886213u, 1363587037u, 1025303200u, 2538766395u, 1167702074u),
+    SC(1163296608u, 659882622u, 673921517u, 98413340u, 2124520066u, 1275464154u, 2595509680u, 648856409u, 3679841626u, 2007192813u, 3827470689u, 336827101u, 2193738999u, 4146527564u, 800826509u, 1093989799u),
+    SC(2526000468u, 2433061703u, 2646709052u, 2823107073u, 2039090151u, 438848568u, 1049601440u, 4135561231u, 104171185u, 1750332752u, 3278734228u, 1450279798u, 29442305u, 3708013520u, 2976173217u, 619221518u),
+    SC(4083598921u, 258161879u, 4060017954u, 3079633797u, 1029966541u, 296693015u, 348209745u, 2911318279u, 1606653615u, 955553933u, 2193936299u, 1507071471u, 632447189u, 1897583942u, 3849303644u, 1954727609u),
+    SC(2852933588u, 1244555442u, 3988877055u, 3534996124u, 1504809609u, 352577257u, 2902886211u, 4229963014u, 1632514596u, 800749943u, 1179343949u, 3076681936u, 660843682u, 1420450690u, 3051223223u, 4282379827u),
+    SC(1820880110u, 431148742u, 2445638331u, 3666021957u, 3662462415u, 927484626u, 3024374088u, 2402076790u, 617597885u, 2595544967u, 142521220u, 4274409050u, 2711087255u, 3170032885u, 3740580174u, 184293025u),
+    SC(1298137497u, 3275716334u, 3357349510u, 4044805344u, 4226147530u, 3745246787u, 2592176219u, 3322500436u, 3410054350u, 3077175054u, 291324705u, 4261336899u, 737623492u, 2669029609u, 3671154482u, 1605263690u),
+    SC(930992288u, 426596832u, 3877536882u, 1264958230u, 314821322u, 3539084042u, 2792727130u, 1560956866u, 745700989u, 2358126556u, 2784984103u, 187995986u, 291096374u, 726791055u, 3761519732u, 2902373728u),
+    SC(2629881738u, 598728501u, 464618095u, 2643463050u, 3903475737u, 2364761426u, 2628331685u, 2625769286u, 3044208987u, 3802841256u, 3356765267u, 3930300576u, 1765692486u, 1565864440u, 2959659847u, 4159074902u),
+    SC(3579706022u, 1095314206u, 2552042826u, 736117790u, 1291518442u, 2770092266u, 3567573229u, 435826768u, 779705803u, 1082946754u, 2844364593u, 1379540594u, 3658239095u, 204329707u, 1174089297u, 2401471169u),
+    SC(1186948055u, 756101458u, 813035443u, 4207329406u, 3822222983u, 664216808u, 1177578990u, 2099318741u, 1998303730u, 821703251u, 2117813050u, 688243874u, 3695849015u, 853705468u, 2496343176u, 867217817u),
+    SC(1271915400u, 65502231u, 2356090918u, 4150164539u, 1498347704u, 3249125946u, 334497175u, 1355430573u, 3042324115u, 2647606898u, 4196941045u, 1812281500u, 3965626659u, 3028093366u, 769306452u, 2317025577u),
+    SC(3379043060u, 1902012910u, 3620530178u, 884681289u, 1649785401u, 502754391u, 3751233464u, 3636609499u, 3367073227u, 2956808710u, 1596700742u, 2176699140u, 3662876289u, 822619656u, 683810686u, 3454023910u),
+    SC(167381531u, 1455254215u, 4104283930u, 995060457u, 3176478909u, 1282097409u, 2030769852u, 3271279420u, 670689982u, 2019327182u, 3833960793u, 881543268u, 369454952u, 1833197493u, 3230652598u, 856858211u),
+    SC(352595440u, 3390540460u, 119793593u, 2255984207u, 2826044402u, 3155042282u, 2775500452u, 1943025694u, 1146992215u, 3670567693u, 4177128281u, 2705581919u, 3799108605u, 606122913u, 1736369085u, 2365686770u),
+    SC(894397027u, 223090807u, 3773291070u, 2451421031u, 1803525584u, 246385509u, 3943215154u, 523758002u, 268455995u, 3596320958u, 3950179456u, 2755591525u, 783779032u, 1695285226u, 1431939627u, 273590524u),
+    SC(432234849u, 2051313600u, 1238206564u, 3530587502u, 2655758158u, 2041462154u, 3239325893u, 2581464668u, 798990296u, 4248366721u, 2498713356u, 460495342u, 1970547992u, 370189050u, 1305505584u, 2560282613u),
+    SC(926516362u, 3534457446u, 3064439508u, 2916743823u, 1515225211u, 1456364857u, 1540669766u, 1887697038u, 1876367392u, 1628504765u, 4108132438u, 2464254157u, 109728777u, 272012574u, 1868043820u, 1710279625u),
+    SC(2619525957u, 639378230u, 2110678769u, 4165698805u, 769123727u, 2328288169u, 1342582444u, 470854197u, 4286899189u, 2351283826u, 2433477334u, 678284191u, 1616576535u, 429315182u, 3369856612u, 86642966u),
+    SC(1461798344u, 2133923634u, 2127327716u, 1580713301u, 1514219397u, 1964243643u, 3506167113u, 1840534414u, 373187500u, 1580796122u, 720195942u, 3240187021u, 1396229804u, 82474320u, 606894352u, 2318960415u),
+    SC(3387980116u, 3628154549u, 2398229431u, 1370056391u, 1281629913u, 2377672795u, 3643925281u, 770261231u, 2657633468u, 2152676668u, 2691038844u, 2963001036u, 2463062771u, 3991471133u, 2032932940u, 3454107600u),
+    SC(2888400710u, 2960951849u, 3596919373u, 4032465489u, 4155565226u, 243794115u, 4180220435u, 2021598691u, 1752054655u, 2028231383u, 4246453408u, 1420153218u, 2975165559u, 1966872664u, 1978240488u, 699821243u),
+    SC(113611067u, 3011749512u, 956462303u, 304011811u, 1523932604u, 2159810956u, 562657588u, 2561925557u, 1421457466u, 3815022410u, 789703668u, 1642220117u, 1407562933u, 3505884617u, 473279198u, 750374129u),
+    SC(3113381795u, 4110628203u, 3970277097u, 560188409u, 2221817597u, 3348355909u, 3481184485u, 2938410463u, 225302469u, 869590945u, 3980483665u, 532766213u, 89116684u, 269217863u, 3146747988u, 1122149650u),
+    SC(1126552018u, 4073373303u, 4262119256u, 4127666263u, 3409358284u, 1398275418u, 826751704u, 1961268566u, 3728963944u, 804663647u, 2289063469u, 1443677327u, 2173472693u, 3294288178u, 3982130511u, 1397294249u),
+    SC(2709776735u, 4253335498u, 1258066009u, 3457958132u, 4007208156u, 3519020817u, 221817025u, 337004823u, 298153488u, 3355429441u, 21300333u, 1289721324u, 3280824669u, 3203422192u, 2697993140u, 1104563093u),
+    SC(3007369433u, 2909087984u, 3647280148u, 4103068610u, 2876962301u, 1001029777u, 2228611201u, 1825599764u, 2246931050u, 2664263927u, 4184137661u, 1088730766u, 2921755049u, 3066286980u, 2442986510u, 302896353u),
+    SC(3039668872u, 899231652u, 362148004u, 3386930640u, 2974218979u, 1812816910u, 2389652674u, 376542071u, 1619571001u, 2678601865u, 2798345402u, 3564685216u, 1329787010u, 615606751u, 2246873316u, 2051725229u),
+    SC(151764245u, 1118894222u, 2675933887u, 2083217381u, 4067015222u, 1159963021u, 1573220506u, 716822701u, 3386872394u, 1370436684u, 2803130834u, 3174515679u, 3331687568u, 3399911235u, 3765334856u, 1385153765u),
+    SC(4147045800u, 378935631u, 3980215811u, 4073271598u, 3004978427u, 1133191122u, 663284330u, 2745860965u, 3801496962u, 3066695499u, 2415661176u, 3443894061u, 241628364u, 2018930804u, 83629857u, 3843022474u),
+    SC(277539697u, 1539769637u, 1123407581u, 3755165939u, 1721831245u, 3651113624u, 3277489047u, 3870948179u, 2206774073u, 1973784068u, 2700533575u, 594708870u, 2545473904u, 2892747867u, 1236913948u, 839512526u),
+    SC(3695029997u, 2268356287u, 2185912309u, 3354681960u, 4266969345u, 1228811910u, 3798368182u, 4284601776u, 3047679553u, 596509799u, 426514051u, 3132391270u, 3472887929u, 2469027158u, 3659593885u, 3644068325u),
+    SC(1066838076u, 736190752u, 3894287654u, 3817160435u, 2821480242u, 4174823161u, 941071366u, 1113965961u, 3951900430u, 2038231567u, 3584087860u, 2679964285u, 1661706746u, 3137337871u, 782463281u, 1801217203u),
+    SC(667613292u, 3790873571u, 483009144u, 38075363u, 3008902527u, 2937813094u, 501300118u, 4025861363u, 3908531992u, 1685770164u, 1664998338u, 1035848207u, 562553418u, 791496097u, 968860088u, 2729643873u),
+    SC(1719783353u, 3795945350u, 411564388u, 2223085125u, 758127132u, 2080908129u, 1738689634u, 259313743u, 2626284346u, 2018109764u, 794776092u, 3230470639u, 4056828009u, 2564085600u, 2378910263u, 3088389405u),
+    SC(1729214537u, 1214662201u, 1730627337u, 800829346u, 4239148508u, 395700238u, 1744506469u, 3199896997u, 3390228543u, 479157977u, 573410540u, 3150619933u, 1805150815u, 1624424728u, 3088233049u, 692911302u),
+    SC(1592381392u, 2970627291u, 2700944048u, 1452832197u, 4258739303u, 578195473u, 2339914722u, 3072186701u, 500671717u, 3179257572u, 3783020943u, 431358770u, 101524116u, 2338276922u, 3985646046u, 142441862u),
+    SC(1483582843u, 322505702u, 4091107910u, 1828857054u, 3612577565u, 757962629u, 3817488170u, 3992228428u, 3346525605u, 2794075522u, 389397811u, 1897522572u, 3157242113u, 3382049158u, 2079168390u, 3425395920u),
+    SC(94851794u, 262148807u, 421836518u, 2430453736u, 2256498400u, 2911825297u, 2230789389u, 1716556268u, 1475486507u, 850617385u, 4048562684u, 1468597295u, 3961179799u, 1596763431u, 3577407513u, 1203330486u),
+    SC(4181507839u, 582768510u, 2848976674u, 932098370u, 1113813728u, 2078748256u, 2785380u, 2772329358u, 2881974971u, 1075567426u, 2494654064u, 578413811u, 4004362077u, 1461258841u, 2532524599u, 2209342735u),
+    SC(2351377566u, 2517830002u, 788280515u, 1785619372u, 1980050683u, 2238625996u, 1037047017u, 220596393u, 2575815016u, 331706722u, 1000854054u, 414531587u, 1931360022u, 882241021u, 3898511998u, 1850083251u),
+    SC(3212353750u, 353981483u, 2772575940u, 3548831168u, 954193996u, 2677364194u, 1041792017u, 1299618757u, 1620369892u, 3629039745u, 3858844505u, 3559479791u, 3781187709u, 828100581u, 1562832024u, 2979070592u),
+    SC(1529236342u, 3439929883u, 4290426449u, 4096034301u, 1232775770u, 3809602344u, 3995065241u, 853957802u, 2488243033u, 1265162179u, 1712389576u, 2238274310u, 500713250u, 3587738756u, 3368126688u, 1775701368u),
+    SC(2722577642u, 2155192529u, 867963993u, 2366928645u, 841970001u, 41215895u, 1266549802u, 3229791577u, 1692304141u, 3059055366u, 3652230521u, 1332514907u, 1365824298u, 1887732917u, 3536226953u, 2723633688u),
+    SC(1041815014u, 1037092116u, 1128354653u, 2802351061u, 4048226056u, 170468176u, 1697163267u, 1621031493u, 1855746489u, 2097181570u, 4163883073u, 3193128716u, 651964182u, 648671398u, 3789160295u, 1411943515u),
+    SC(3517766605u, 3105776405u, 3169414832u, 2619510918u, 1786147905u, 1116051531u, 1907319126u, 2190794661u, 1580928216u, 2557622108u, 1065382401u, 1944231228u, 2899011561u, 1723438162u, 748593032u, 1631430052u),
+    SC(984193506u, 2470764786u, 3052193920u, 2740899701u, 635285544u, 3289343201u, 2719002295u, 3629173005u, 3442270812u, 4225999294u, 3710808011u, 3924404353u, 42747214u, 3351910737u, 1450420927u, 2772685867u),
+    SC(2560767517u, 2084050379u, 3973098060u, 2319084707u, 1041969634u, 1514890136u, 342714121u, 1638203773u, 523493240u, 50596883u, 3196195733u, 2373509177u, 1366159965u, 1302138342u, 3549893258u, 738849468u),
+    SC(1384881548u, 2423961712u, 1836733794u, 2227923403u, 4281631303u, 3189472452u, 1630869108u, 87922896u, 4179540022u, 3597031288u, 2087544763u, 2148143425u, 695209299u, 424431697u, 2879908563u, 3723164349u),
+    SC(4054707341u, 1025183008u, 2346347142u, 1804400432u, 4106113254u, 747477306u, 894878158u, 1649420726u, 1199776938u, 3284099458u, 633320987u, 852785494u, 1474602836u, 3767179151u, 2521252308u, 466383396u),
+    SC(2871980339u, 2981172652u, 1099369720u, 3613215392u, 234979786u, 1948946192u, 4149039271u, 958701721u, 2730785652u, 3313823403u, 1469357813u, 952151913u, 791390926u, 1890005157u, 1969396400u, 1449824746u),
+    SC(2639180826u, 4141510531u, 2983333419u, 4181133416u, 1402626429u, 287018098u, 881629991u, 3763826565u, 3251089421u, 3079063631u, 2829975184u, 1129525343u, 1940702151u, 472219863u, 3428674355u, 3321040618u),
+    SC(820893055u, 2065378433u, 3364282352u, 1570672738u, 2773705615u, 2655195600u, 413409833u, 1069094617u, 1808037707u, 382883745u, 2179074888u, 1523568176u, 4148469348u, 2854782210u, 3561913418u, 1149513447u),
+    SC(686025629u, 161658965u, 1707446214u, 2761032012u, 4043925927u, 511772266u, 1104266612u, 825255299u, 4234492807u, 2155036775u, 15017052u, 2350189283u, 1504525333u, 3746205309u, 3700672764u, 3753602092u),
+    SC(3415754549u, 3821552336u, 2734417272u, 4282286691u, 1513786294u, 1956482568u, 3373625766u, 2594993571u, 3912605900u, 1904329717u, 806615415u, 2909883124u, 1279141243u, 3918750312u, 3028370075u, 2078966631u),
+    SC(907568754u, 2122516458u, 4004002576u, 1750130637u, 1582130779u, 548026275u, 3976221099u, 2752504176u, 3965873875u, 719772673u, 4124362512u, 3459035977u, 2871512050u, 3663565387u, 3811506385u, 7371373u),
+    SC(2980318558u, 1776939877u, 3266104660u, 3699533759u, 1113631666u, 995111222u, 35142423u, 1282112814u, 1986108843u, 712720885u, 604110729u, 1324757739u, 837672616u, 195962819u, 2936304394u, 1036093164u),
+    SC(2882832563u, 3757443619u, 3896446155u, 576847972u, 3005910837u, 3569495010u, 1122702375u, 359008293u, 1862238450u, 400221103u, 2529666147u, 3515124651u, 4204349700u, 2443251803u, 3787423523u, 2215328393u),
+    SC(2886531844u, 3642551112u, 793344372u, 840686352u, 710353173u, 1946043800u, 3374649546u, 1305913890u, 1801416071u, 1251004585u, 106475082u, 1682394522u, 961556810u, 1180872168u, 475944453u, 658866901u),
+    SC(531152399u, 1198279527u, 1769764161u, 231856318u, 2745221107u, 1428768998u, 142323473u, 2948809778u, 3333574788u, 2151171614u, 848698656u, 404517255u, 4269399915u, 2405195348u, 2531112363u, 2155384115u),
+    SC(672875456u, 3547564425u, 2820133651u, 1968987919u, 4080444629u, 2123173577u, 2996810789u, 3254324822u, 649398030u, 3121633737u, 3074309555u, 304588455u, 1751658564u, 2139240073u, 2451217340u, 3164555932u),
+    SC(3595463145u, 1424498372u, 1950757503u, 1441114157u, 998501190u, 714256146u, 252389012u, 3364831314u, 2860438879u, 676084898u, 2615629157u, 4134446410u, 665382925u, 2947543253u, 2402895767u, 1036542506u),
+    SC(4107123438u, 3568311729u, 4038439113u, 3591864885u, 1212134796u, 1411496532u, 398183759u, 3840389160u, 1725272299u, 701929732u, 3736728716u, 1512374409u, 2998477895u, 2393445122u, 500935449u, 113654599u),
+    SC(2415479882u, 1816585012u, 267167753u, 127738272u, 1981792717u, 501706572u, 1917058826u, 2479479973u, 306043955u, 1597794531u, 703868239u, 411032773u, 1998614836u, 2830858108u, 716213678u, 4048137207u),
+    SC(209217972u, 1848907883u, 2122825958u, 599150512u, 4025315524u, 4071579248u, 1546906833u, 667887226u, 1713984569u, 912394392u, 790092125u, 2107816919u, 43708324u, 1761630809u, 1654071463u, 1544680586u),
+    SC(3773462214u, 181787783u, 3173431966u, 632620059u, 159608690u, 1860960578u, 890971185u, 114090404u, 2346132710u, 1663060395u, 2292867594u, 2022845285u, 1782203415u, 3366944188u, 1510200504u, 3572496680u),
+    SC(799423175u, 1046448514u, 910270239u, 1216607532u, 3907213266u, 1263183807u, 3333062321u, 702742873u, 1474387996u, 3593617320u, 4121277204u, 1801346116u, 1917967144u, 116890961u, 2097873806u, 3101213693u),
+    SC(1961705528u, 3569682736u, 585597948u, 465020529u, 1238370423u, 2986475823u, 1789317933u, 3341821601u, 1534392078u, 1708132840u, 2361792740u, 2675703206u, 1478709120u, 954827614u, 2162621762u, 1797801839u),
+    SC(1909894310u, 3817280476u, 1844256659u, 1340023034u, 382629340u, 3695202632u, 3941585624u, 4026687383u, 3023127859u, 2101927880u, 663514191u, 2980014546u, 120585549u, 2720902062u, 231990794u, 1885856514u),
+    SC(687556593u, 1855044767u, 2586662688u, 4093810606u, 3999366854u, 2305836204u, 2316782284u, 1542279826u, 3494603105u, 3609490110u, 1338881541u, 2571354548u, 4019092205u, 732399006u, 198935716u, 4172585207u),
+    SC(1761400309u, 3362085727u, 1563413113u, 1504162607u, 2190236253u, 3798136568u, 2485587682u, 524788602u, 1464338000u, 862089574u, 3279076430u, 2054226549u, 2057416014u, 1415634870u, 3553787698u, 2005759147u),
+    SC(3345054418u, 4095978436u, 2128083112u, 2812674093u, 399078477u, 449232535u, 1225852549u, 2510960346u, 3650112359u, 4222184621u, 3420957147u, 2201772362u, 1776496892u, 2691474152u, 3583506007u, 3071417757u),
+    SC(2817478301u, 597098006u, 3236400021u, 1381607889u, 1196416033u, 2334451912u, 3746980242u, 2789768413u, 3598198276u, 2445721092u, 2562979814u, 2264018743u, 599909597u, 1333155265u, 4093970927u, 1526103848u),
+    SC(4089346118u, 2146449014u, 1255031311u, 1083292462u, 1904569624u, 165824656u, 3937842230u, 1998464376u, 4077024855u, 1170994149u, 1738970735u, 1797783489u, 231051066u, 1746006793u, 1128686267u, 104258501u),
+    SC(1553235861u, 1541000745u, 86068272u, 1052725045u, 1821220394u, 1310143600u, 2496919381u, 921707932u, 3065493365u, 1047876259u, 3537887049u, 2239275597u, 2426936717u, 1760508356u, 1761303719u, 3076421324u),
+    SC(594532704u, 3283186526u, 664504066u, 2351276148u, 743752073u, 3506703379u, 1313666059u, 3180014696u, 2595593207u, 3233464717u, 3503896078u, 3080353485u, 3024858302u, 3022377345u, 2268775312u, 1505477241u),
+    SC(3375144742u, 399303415u, 1704788547u, 2342357298u, 3249138175u, 3398110617u, 3447067571u, 2979298097u, 2883496268u, 442393835u, 1709639529u, 1370284722u, 3833613791u, 356111627u, 1918886043u, 1379236433u),
+    SC(2556463049u, 338452620u, 863517202u, 1294123798u, 1933322984u, 197262290u, 2345771330u, 1839812544u, 345136117u, 4252415261u, 1810377829u, 72756447u, 2405150172u, 3945186957u, 1067847999u, 2873270733u),
+    SC(1180311412u, 4109810349u, 2086948385u, 4082520246u, 574770835u, 2209620415u, 2437383713u, 2760514883u, 651850212u, 395587773u, 3999701205u, 2108691795u, 3558610043u, 2200203607u, 2670717219u, 3347630920u),
+    SC(3715520717u, 4068546500u, 1341376651u, 3501484763u, 3349819097u, 361810432u, 2019356271u, 1553438388u, 842103821u, 504424855u, 175412058u, 2386940543u, 2593884864u, 4152217399u, 3251090240u, 3486270398u),
+    SC(1438460607u, 2818819230u, 3025439511u, 1918849788u, 1646440331u, 3717917961u, 1901915015u, 1472667699u, 883766195u, 2641577139u, 2885443643u, 2379164244u, 2528743864u, 1096175157u, 1403911301u, 1027522371u),
+    SC(2008964102u, 3507233388u, 2358646483u, 22748700u, 1140877430u, 1099562038u, 3675031717u, 3960667358u, 3438463946u, 1548175689u, 2297592545u, 2956336028u, 552121694u, 3647338486u, 3968850400u, 1117495323u),
+    SC(4206306438u, 1052176993u, 4031122201u, 3198671837u, 2159579374u, 3569047064u, 819686130u, 4113216028u, 152367162u, 1082797614u, 2861659373u, 2581073512u, 3061803770u, 4204635585u, 1562572620u, 2289488048u),
+    SC(589963321u, 4210985862u, 1353085432u, 3732418890u, 1359853149u, 1559299489u, 165380226u, 705376102u, 348811394u, 1359725027u, 1396416366u, 3793153043u, 1004775138u, 1691542040u, 3646897858u, 2910345066u),
+    SC(3007850553u, 1630162935u, 2690139986u, 1760640617u, 3740180386u, 2303364348u, 1692635220u, 461330663u, 1915552493u, 3744465499u, 246737402u, 4156919265u, 1698398756u, 1722882362u, 1060091677u, 1562816068u),
+    SC(3548854871u, 185234823u, 3400599665u, 2838636306u, 3480213578u, 577623986u, 2239904150u, 1513435664u, 998132100u, 1506273030u, 3456079281u, 3311285073u, 4059323660u, 3388740054u, 1625678463u, 1365307782u),
+    SC(2284353676u, 4008424119u, 1909623207u, 343673466u, 648038851u, 651997825u, 3432721850u, 371990701u, 3827868053u, 2269273890u, 1031375138u, 3029802022u, 1570961965u, 3729405516u, 3368443720u, 3229315495u),
+    SC(2046747953u, 651214861u, 1956146200u, 2571084148u, 1392040884u, 3933562890u, 938521588u, 3934147453u, 4259643505u, 826538388u, 3034035361u, 1135295165u, 1381821374u, 2480256420u, 1442846632u, 2150413750u),
+    SC(4098832880u, 1520394105u, 1594833548u, 3761943819u, 913457820u, 3211369658u, 2887669928u, 1719750289u, 3109963217u, 3839759104u, 2500470703u, 3132263354u, 4285899334u, 1185706211u, 4228504112u, 3583647188u),
+    SC(288940553u, 3136932279u, 3097329016u, 2200762302u, 3662000063u, 1009754440u, 1346531010u, 2158664379u, 365071722u, 962966191u, 245531936u, 2120741611u, 2893895959u, 157757320u, 925361305u, 4033482094u),
+    SC(701753666u, 463001484u, 1625581658u, 2857382192u, 3704869873u, 1526474272u, 1194034169u, 881929246u, 2426737912u, 1231554921u, 559761078u, 3682358201u, 1092389991u, 3364596961u, 2798935207u, 3535755301u),
+    SC(2829281940u, 1608332256u, 1326192855u, 3442296585u, 3606047624u, 2772410567u, 3909708224u, 2231320248u, 500693253u, 3988770160u, 40562110u, 485366958u, 601563085u, 1201603241u, 3143199477u, 4117411172u),
+    SC(1510248142u, 3019543631u, 2431300848u, 3286737004u, 1010168522u, 2166767573u, 913359378u, 1788354303u, 307174318u, 3071274341u, 3577524091u, 1585973116u, 2385710341u, 1763809714u, 1262316875u, 3083372287u),
+    SC(839320194u, 207535151u, 1717495161u, 3326474948u, 4246648044u, 3609817432u, 1036522120u, 3912415418u, 2406049325u, 224936062u, 3673887214u, 142878471u, 3246316186u, 2151464277u, 3094195698u, 2243799575u),
+    SC(2082637403u, 4211397617u, 3147336315u, 134892030u, 3347121555u, 664901510u, 3682051198u, 1471145863u, 2687414894u, 821402071u, 3579418420u, 1134500299u, 3498249074u, 1625754963u, 159319777u, 3493248315u),
+    SC(2696563731u, 816677458u, 3228336745u, 2749154149u, 4253298266u, 179254180u, 584979403u, 194217420u, 1491905299u, 1560132599u, 4088845006u, 662412932u, 2484067092u, 1196853600u, 3241316581u, 4263746504u),
+    SC(1118724162u, 3366107741u, 3372107684u, 316850383u, 8119368u, 1894152217u, 1311894563u, 1157063433u, 1923967404u, 2074315762u, 571516647u, 1405502567u, 921319971u, 3418975292u, 3785302171u, 3735114798u),
+    SC(2403002550u, 1162902062u, 1051056175u, 1191315257u, 3639828236u, 2411798140u, 1853893979u, 142289433u, 1639681589u, 807988564u, 461586958u, 4221244531u, 1614960935u, 3556357797u, 220015488u, 3998960894u),
+    SC(981776971u, 504699168u, 2699361103u, 815087212u, 2813992466u, 1655588032u, 227652663u, 2958947119u, 2987353465u, 1129471764u, 2065935337u, 3373145359u, 851726059u, 3453775079u, 3553340830u, 2101223616u),
+    SC(1686240876u, 184853763u, 1053560875u, 3729141373u, 2072498561u, 734086582u, 757464456u, 3878773264u, 3166811307u, 4126354128u, 2440450955u, 2156695943u, 3572009742u, 2935165045u, 2993576999u, 2405717517u),
+    SC(87294324u, 1915508799u, 2946290533u, 527676223u, 2387333578u, 3401625421u, 535900260u, 3578896532u, 3834650933u, 1149919597u, 239292800u, 4166847125u, 3655624027u, 2931788353u, 2746999329u, 27683470u),
+    SC(3228122798u, 2776783949u, 1814356107u, 3581657901u, 1822352039u, 2430383259u, 3008428114u, 1311270860u, 3659594571u, 1982284062u, 96912897u, 3166239573u, 4109768586u, 4024486404u, 1657298310u, 867803230u),
+    SC(3307016051u, 1929184514u, 3514798592u, 3390609441u, 3862845466u, 2203480924u, 2837147283u, 1023020445u, 2366695090u, 133005021u, 754970932u, 1424725915u, 2725870205u, 1013953555u, 3015365826u, 775235157u),
+    SC(377559126u, 1294834094u, 766474744u, 1488267987u, 912654478u, 3654469021u, 3190907103u, 3200461068u, 736883105u, 1164015688u, 3894262467u, 1159908619u, 1050462282u, 1007181869u, 450852794u, 690910304u),
+    SC(2062108979u, 3779298597u, 2999850530u, 1448389231u, 185964954u, 1468226057u, 547657544u, 2081095349u, 2442210871u, 2198496346u, 327320229u, 506671549u, 2705033142u, 4098095361u, 2510484725u, 3181090293u),
+    SC(3883478423u, 3492509355u, 605341174u, 3268525834u, 3262581168u, 1437778795u, 395680161u, 806999212u, 2672662153u, 1607381369u, 3112990112u, 3587534017u, 3710338580u, 2726391437u, 385587424u, 3980340050u),
+    SC(50313684u, 2490357311u, 617608783u, 1254593616u, 1033361158u, 4003906807u, 1775887181u, 843562465u, 107682932u, 881333553u, 735481978u, 1849034986u, 3488712754u, 1433860767u, 4079114167u, 3951100239u),
+    SC(1162132018u, 4178374321u, 336767738u, 3031331665u, 2931225786u, 316673699u, 3244673201u, 3971690430u, 1660671924u, 3265646312u, 3216633321u, 2955787260u, 733631371u, 2202507187u, 2491975627u, 2676975414u),
+    SC(621478329u, 635043746u, 1978340717u, 3636886366u, 1570249959u, 2284114810u, 453632998u, 2031654927u, 3122500170u, 854645382u, 3845307582u, 1734747551u, 3944239457u, 1078116607u, 639547421u, 1040827521u),
+    SC(2633174612u, 522870748u, 1929668615u, 854156014u, 1658894355u, 2417897717u, 3971882990u, 180270290u, 2092058317u, 310491003u, 425729300u, 3131637602u, 2223135211u, 1701300033u, 3334296739u, 3041986339u),
+    SC(3989432497u, 1013031392u, 2408824338u, 1230013677u, 3047755466u, 1326570499u, 3441523482u, 1445485100u, 1724054817u, 132709063u, 1339308827u, 1489503841u, 2968051589u, 2734546906u, 1587517950u, 1646141245u),
+    SC(3717474655u, 2206770328u, 715800932u, 2457567674u, 3404320770u, 3017651894u, 2533895280u, 4058170990u, 2206991884u, 3557409258u, 2613943948u, 2986002495u, 990429874u, 1210945355u, 4248747032u, 148271211u)
+};
+#endif
+#undef SC
+#endif
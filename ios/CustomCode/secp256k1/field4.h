@@ -0,0 +1,83 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef SECP256K1_FIELD4_H
+#define SECP256K1_FIELD4_H
+
+/** Four independent field elements, for running four copies of the same
+ *  computation in lockstep with SIMD.
+ *
+ *  The layout is a structure of arrays in the 10x26 representation:
+ *  n[i][l] is limb i of lane l. Limbs are kept in 64-bit slots so that the
+ *  32x32->64 bit vector multiplies (AVX2's vpmuludq, NEON's umull) read them
+ *  in place; their values are the same as those of field_10x26, and so are
+ *  the magnitude rules of every operation below. The vector kernels are
+ *  picked at compile time: AVX2 on x86_64 built with -mavx2, and NEON on ARM
+ *  only where USE_FE4_NEON is defined (see libsecp256k1-config.h), as the
+ *  NEON kernels have yet to pass ios/test_secp256k1_field4.c on ARM
+ *  hardware. SECP256K1_FE4_VECTOR is defined when one of them is in use, and
+ *  only then do the batch engines run four lanes at a time. The portable version
+ *  under the vector kernels is correct but slower than the scalar field, so
+ *  without SECP256K1_FE4_VECTOR none of this is compiled in.
+ */
+
+#include "field.h"
+
+#if defined(__AVX2__)
+# define SECP256K1_FE4_AVX2 1
+# define SECP256K1_FE4_VECTOR 1
+#elif defined(USE_FE4_NEON) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+# define SECP256K1_FE4_NEON 1
+# define SECP256K1_FE4_VECTOR 1
+#endif
+
+#ifdef SECP256K1_FE4_VECTOR
+
+#if defined(__GNUC__)
+# define SECP256K1_FE4_ALIGN __attribute__((aligned(32)))
+#else
+# define SECP256K1_FE4_ALIGN
+#endif
+
+typedef struct {
+    SECP256K1_FE4_ALIGN uint64_t n[10][4];
+} secp256k1_fe4;
+
+/** Set lane l of r to a (of any magnitude up to 32); the lane gets magnitude 1. */
+static void secp256k1_fe4_set_fe(secp256k1_fe4 *r, int l, const secp256k1_fe *a);
+
+/** Set lane l of r to the field element stored in a; the lane gets magnitude 1. */
+static void secp256k1_fe4_set_fe_storage(secp256k1_fe4 *r, int l, const secp256k1_fe_storage *a);
+
+/** Set r to lane l of a, normalized. */
+static void secp256k1_fe4_get_fe(secp256k1_fe *r, const secp256k1_fe4 *a, int l);
+
+/** r = a*b lane by lane. Magnitudes of a and b up to 8; r gets magnitude 1. */
+static void secp256k1_fe4_mul(secp256k1_fe4 *r, const secp256k1_fe4 *a, const secp256k1_fe4 *b);
+
+/** r = a^2 lane by lane. Magnitude of a up to 8; r gets magnitude 1. */
+static void secp256k1_fe4_sqr(secp256k1_fe4 *r, const secp256k1_fe4 *a);
+
+/** r = a+b lane by lane; the magnitudes add up. */
+static void secp256k1_fe4_add(secp256k1_fe4 *r, const secp256k1_fe4 *a, const secp256k1_fe4 *b);
+
+/** r = a*k lane by lane; the magnitude is multiplied by k. */
+static void secp256k1_fe4_mul_int(secp256k1_fe4 *r, const secp256k1_fe4 *a, int k);
+
+/** r = -a lane by lane, where a has magnitude at most m; r gets magnitude m+1. */
+static void secp256k1_fe4_negate(secp256k1_fe4 *r, const secp256k1_fe4 *a, int m);
+
+/** Set r to a with every lane reduced to magnitude 1, without fully normalizing it. */
+static void secp256k1_fe4_normalize_weak(secp256k1_fe4 *r, const secp256k1_fe4 *a);
+
+/** Set flags[l] to whether lane l of a is zero modulo p, in constant time. */
+static void secp256k1_fe4_normalizes_to_zero(int *flags, const secp256k1_fe4 *a);
+
+/** Replace lane l of r with lane l of a wherever flags[l] is set, in constant time. */
+static void secp256k1_fe4_cmov(secp256k1_fe4 *r, const secp256k1_fe4 *a, const int *flags);
+
+#endif /* SECP256K1_FE4_VECTOR */
+
+#endif /* SECP256K1_FIELD4_H */
@@ -0,0 +1,361 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef SECP256K1_FIELD4_IMPL_H
+#define SECP256K1_FIELD4_IMPL_H
+
+#include "util.h"
+#include "field4.h"
+
+/* Four 64-bit lanes (secp256k1_u64x4), and the operand form the 32x32->64
+ * bit multiply reads (secp256k1_u32x4, the low 32 bits of each lane). The
+ * multiplies below load their operands straight from the limbs rather than
+ * from a local copy: with AVX2 the loads fold into vpmuludq, and a copy would
+ * be an extra memcpy per call. */
+
+#if defined(SECP256K1_FE4_AVX2)
+
+#include <immintrin.h>
+
+typedef __m256i secp256k1_u64x4;
+typedef __m256i secp256k1_u32x4; /* vpmuludq ignores the high halves */
+
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_load(const uint64_t *p) { return _mm256_loadu_si256((const __m256i *)p); }
+static SECP256K1_INLINE void secp256k1_u64x4_store(uint64_t *p, secp256k1_u64x4 a) { _mm256_storeu_si256((__m256i *)p, a); }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_set1(uint64_t a) { return _mm256_set1_epi64x((long long)a); }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_add(secp256k1_u64x4 a, secp256k1_u64x4 b) { return _mm256_add_epi64(a, b); }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_sub(secp256k1_u64x4 a, secp256k1_u64x4 b) { return _mm256_sub_epi64(a, b); }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_and(secp256k1_u64x4 a, secp256k1_u64x4 b) { return _mm256_and_si256(a, b); }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_or(secp256k1_u64x4 a, secp256k1_u64x4 b) { return _mm256_or_si256(a, b); }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_xor(secp256k1_u64x4 a, secp256k1_u64x4 b) { return _mm256_xor_si256(a, b); }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_shr(secp256k1_u64x4 a, int n) { return _mm256_srl_epi64(a, _mm_cvtsi32_si128(n)); }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_shl(secp256k1_u64x4 a, int n) { return _mm256_sll_epi64(a, _mm_cvtsi32_si128(n)); }
+static SECP256K1_INLINE secp256k1_u32x4 secp256k1_u64x4_narrow(secp256k1_u64x4 a) { return a; }
+static SECP256K1_INLINE secp256k1_u32x4 secp256k1_u32x4_load(const uint64_t *p) { return _mm256_loadu_si256((const __m256i *)p); }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u32x4_mul(secp256k1_u32x4 a, secp256k1_u32x4 b) { return _mm256_mul_epu32(a, b); }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u32x4_madd(secp256k1_u64x4 c, secp256k1_u32x4 a, secp256k1_u32x4 b) { return _mm256_add_epi64(c, _mm256_mul_epu32(a, b)); }
+
+#elif defined(SECP256K1_FE4_NEON)
+
+#include <arm_neon.h>
+
+typedef struct { uint64x2_t lo, hi; } secp256k1_u64x4;
+typedef struct { uint32x2_t lo, hi; } secp256k1_u32x4;
+
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_load(const uint64_t *p) { secp256k1_u64x4 r; r.lo = vld1q_u64(p); r.hi = vld1q_u64(p + 2); return r; }
+static SECP256K1_INLINE void secp256k1_u64x4_store(uint64_t *p, secp256k1_u64x4 a) { vst1q_u64(p, a.lo); vst1q_u64(p + 2, a.hi); }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_set1(uint64_t a) { secp256k1_u64x4 r; r.lo = r.hi = vdupq_n_u64(a); return r; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_add(secp256k1_u64x4 a, secp256k1_u64x4 b) { a.lo = vaddq_u64(a.lo, b.lo); a.hi = vaddq_u64(a.hi, b.hi); return a; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_sub(secp256k1_u64x4 a, secp256k1_u64x4 b) { a.lo = vsubq_u64(a.lo, b.lo); a.hi = vsubq_u64(a.hi, b.hi); return a; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_and(secp256k1_u64x4 a, secp256k1_u64x4 b) { a.lo = vandq_u64(a.lo, b.lo); a.hi = vandq_u64(a.hi, b.hi); return a; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_or(secp256k1_u64x4 a, secp256k1_u64x4 b) { a.lo = vorrq_u64(a.lo, b.lo); a.hi = vorrq_u64(a.hi, b.hi); return a; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_xor(secp256k1_u64x4 a, secp256k1_u64x4 b) { a.lo = veorq_u64(a.lo, b.lo); a.hi = veorq_u64(a.hi, b.hi); return a; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_shr(secp256k1_u64x4 a, int n) { const int64x2_t s = vdupq_n_s64(-n); a.lo = vshlq_u64(a.lo, s); a.hi = vshlq_u64(a.hi, s); return a; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_shl(secp256k1_u64x4 a, int n) { const int64x2_t s = vdupq_n_s64(n); a.lo = vshlq_u64(a.lo, s); a.hi = vshlq_u64(a.hi, s); return a; }
+static SECP256K1_INLINE secp256k1_u32x4 secp256k1_u64x4_narrow(secp256k1_u64x4 a) { secp256k1_u32x4 r; r.lo = vmovn_u64(a.lo); r.hi = vmovn_u64(a.hi); return r; }
+static SECP256K1_INLINE secp256k1_u32x4 secp256k1_u32x4_load(const uint64_t *p) { secp256k1_u32x4 r; r.lo = vld2_u32((const uint32_t *)p).val[0]; r.hi = vld2_u32((const uint32_t *)(p + 2)).val[0]; return r; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u32x4_mul(secp256k1_u32x4 a, secp256k1_u32x4 b) { secp256k1_u64x4 r; r.lo = vmull_u32(a.lo, b.lo); r.hi = vmull_u32(a.hi, b.hi); return r; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u32x4_madd(secp256k1_u64x4 c, secp256k1_u32x4 a, secp256k1_u32x4 b) { c.lo = vmlal_u32(c.lo, a.lo, b.lo); c.hi = vmlal_u32(c.hi, a.hi, b.hi); return c; }
+
+#else
+
+typedef struct { uint64_t v[4]; } secp256k1_u64x4;
+typedef secp256k1_u64x4 secp256k1_u32x4;
+
+#define SECP256K1_U64X4_MAP(expr) do { int l_; for (l_ = 0; l_ < 4; l_++) { r.v[l_] = (expr); } } while (0)
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_load(const uint64_t *p) { secp256k1_u64x4 r; SECP256K1_U64X4_MAP(p[l_]); return r; }
+static SECP256K1_INLINE void secp256k1_u64x4_store(uint64_t *p, secp256k1_u64x4 a) { int l; for (l = 0; l < 4; l++) { p[l] = a.v[l]; } }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_set1(uint64_t a) { secp256k1_u64x4 r; SECP256K1_U64X4_MAP(a); return r; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_add(secp256k1_u64x4 a, secp256k1_u64x4 b) { secp256k1_u64x4 r; SECP256K1_U64X4_MAP(a.v[l_] + b.v[l_]); return r; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_sub(secp256k1_u64x4 a, secp256k1_u64x4 b) { secp256k1_u64x4 r; SECP256K1_U64X4_MAP(a.v[l_] - b.v[l_]); return r; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_and(secp256k1_u64x4 a, secp256k1_u64x4 b) { secp256k1_u64x4 r; SECP256K1_U64X4_MAP(a.v[l_] & b.v[l_]); return r; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_or(secp256k1_u64x4 a, secp256k1_u64x4 b) { secp256k1_u64x4 r; SECP256K1_U64X4_MAP(a.v[l_] | b.v[l_]); return r; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_xor(secp256k1_u64x4 a, secp256k1_u64x4 b) { secp256k1_u64x4 r; SECP256K1_U64X4_MAP(a.v[l_] ^ b.v[l_]); return r; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_shr(secp256k1_u64x4 a, int n) { secp256k1_u64x4 r; SECP256K1_U64X4_MAP(a.v[l_] >> n); return r; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_shl(secp256k1_u64x4 a, int n) { secp256k1_u64x4 r; SECP256K1_U64X4_MAP(a.v[l_] << n); return r; }
+static SECP256K1_INLINE secp256k1_u32x4 secp256k1_u64x4_narrow(secp256k1_u64x4 a) { secp256k1_u64x4 r; SECP256K1_U64X4_MAP(a.v[l_] & 0xFFFFFFFFULL); return r; }
+static SECP256K1_INLINE secp256k1_u32x4 secp256k1_u32x4_load(const uint64_t *p) { secp256k1_u64x4 r; SECP256K1_U64X4_MAP(p[l_] & 0xFFFFFFFFULL); return r; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u32x4_mul(secp256k1_u32x4 a, secp256k1_u32x4 b) { secp256k1_u64x4 r; SECP256K1_U64X4_MAP(a.v[l_] * b.v[l_]); return r; }
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u32x4_madd(secp256k1_u64x4 c, secp256k1_u32x4 a, secp256k1_u32x4 b) { secp256k1_u64x4 r; SECP256K1_U64X4_MAP(c.v[l_] + a.v[l_] * b.v[l_]); return r; }
+#undef SECP256K1_U64X4_MAP
+
+#endif
+
+/* a*k for a full 64-bit a and a k below 2^32, modulo 2^64. */
+static SECP256K1_INLINE secp256k1_u64x4 secp256k1_u64x4_mul_small(secp256k1_u64x4 a, secp256k1_u32x4 k) {
+    return secp256k1_u64x4_add(secp256k1_u32x4_mul(secp256k1_u64x4_narrow(a), k),
+                               secp256k1_u64x4_shl(secp256k1_u32x4_mul(secp256k1_u64x4_narrow(secp256k1_u64x4_shr(a, 32)), k), 32));
+}
+
+static void secp256k1_fe4_set_fe(secp256k1_fe4 *r, int l, const secp256k1_fe *a) {
+    secp256k1_fe t = *a;
+    int i;
+    secp256k1_fe_normalize_weak(&t);
+#if defined(USE_FIELD_10X26)
+    for (i = 0; i < 10; i++) {
+        r->n[i][l] = t.n[i];
+    }
+#elif defined(USE_FIELD_5X52)
+    /* A weakly normalized 5x52 limb splits into two 10x26 limbs of magnitude 1. */
+    for (i = 0; i < 5; i++) {
+        r->n[2 * i][l] = t.n[i] & 0x3FFFFFFULL;
+        r->n[2 * i + 1][l] = t.n[i] >> 26;
+    }
+#else
+#error "Please select field implementation"
+#endif
+}
+
+static void secp256k1_fe4_set_fe_storage(secp256k1_fe4 *r, int l, const secp256k1_fe_storage *a) {
+    uint32_t w[9];
+    int i;
+#if defined(USE_FIELD_10X26)
+    for (i = 0; i < 8; i++) {
+        w[i] = a->n[i];
+    }
+#elif defined(USE_FIELD_5X52)
+    for (i = 0; i < 4; i++) {
+        w[2 * i] = (uint32_t)a->n[i];
+        w[2 * i + 1] = (uint32_t)(a->n[i] >> 32);
+    }
+#endif
+    w[8] = 0;
+    /* Limb i is bits 26*i up to 26*i+25 of the little-endian 32-bit words. */
+    for (i = 0; i < 10; i++) {
+        const int j = (26 * i) >> 5, sh = (26 * i) & 31;
+        r->n[i][l] = ((w[j] | ((uint64_t)w[j + 1] << 32)) >> sh) & 0x3FFFFFFULL;
+    }
+}
+
+static void secp256k1_fe4_get_fe(secp256k1_fe *r, const secp256k1_fe4 *a, int l) {
+    secp256k1_fe4 t;
+    int i;
+    secp256k1_fe4_normalize_weak(&t, a);
+#if defined(USE_FIELD_10X26)
+    for (i = 0; i < 10; i++) {
+        r->n[i] = (uint32_t)t.n[i][l];
+    }
+#elif defined(USE_FIELD_5X52)
+    for (i = 0; i < 5; i++) {
+        r->n[i] = t.n[2 * i][l] | (t.n[2 * i + 1][l] << 26);
+    }
+#endif
+#ifdef VERIFY
+    r->magnitude = 1;
+    r->normalized = 0;
+    secp256k1_fe_verify(r);
+#endif
+    secp256k1_fe_normalize(r);
+}
+
+/* Sets r to the product whose columns are p[s] = sum over i+j=s of a[i]*b[j],
+ * reducing it exactly as secp256k1_fe_mul_inner of field_10x26 does. */
+static SECP256K1_INLINE void secp256k1_fe4_reduce(secp256k1_fe4 *r, const secp256k1_u64x4 *p) {
+    const secp256k1_u64x4 M = secp256k1_u64x4_set1(0x3FFFFFFULL);
+    const secp256k1_u32x4 R0 = secp256k1_u64x4_narrow(secp256k1_u64x4_set1(0x3D10ULL));
+    const secp256k1_u32x4 R1 = secp256k1_u64x4_narrow(secp256k1_u64x4_set1(0x400ULL));
+    const secp256k1_u32x4 R0_4 = secp256k1_u64x4_narrow(secp256k1_u64x4_set1(0x3D10ULL >> 4));
+    const secp256k1_u32x4 R1_4 = secp256k1_u64x4_narrow(secp256k1_u64x4_set1(0x400ULL >> 4));
+    const secp256k1_u32x4 R1x16 = secp256k1_u64x4_narrow(secp256k1_u64x4_set1(0x400ULL << 4));
+    secp256k1_u64x4 c = secp256k1_u64x4_set1(0), d, t[10];
+    secp256k1_u32x4 u;
+    int k;
+
+    d = p[9];
+    t[9] = secp256k1_u64x4_and(d, M); d = secp256k1_u64x4_shr(d, 26);
+    for (k = 0; k < 8; k++) {
+        c = secp256k1_u64x4_add(c, p[k]);
+        d = secp256k1_u64x4_add(d, p[10 + k]);
+        u = secp256k1_u64x4_narrow(secp256k1_u64x4_and(d, M)); d = secp256k1_u64x4_shr(d, 26);
+        c = secp256k1_u32x4_madd(c, u, R0);
+        t[k] = secp256k1_u64x4_and(c, M); c = secp256k1_u64x4_shr(c, 26);
+        c = secp256k1_u32x4_madd(c, u, R1);
+    }
+    c = secp256k1_u64x4_add(c, p[8]);
+    d = secp256k1_u64x4_add(d, p[18]);
+    u = secp256k1_u64x4_narrow(secp256k1_u64x4_and(d, M)); d = secp256k1_u64x4_shr(d, 26);
+    c = secp256k1_u32x4_madd(c, u, R0);
+
+    for (k = 3; k < 8; k++) {
+        secp256k1_u64x4_store(r->n[k], t[k]);
+    }
+
+    secp256k1_u64x4_store(r->n[8], secp256k1_u64x4_and(c, M)); c = secp256k1_u64x4_shr(c, 26);
+    c = secp256k1_u32x4_madd(c, u, R1);
+    c = secp256k1_u64x4_add(c, secp256k1_u64x4_add(secp256k1_u64x4_mul_small(d, R0), t[9]));
+    secp256k1_u64x4_store(r->n[9], secp256k1_u64x4_and(c, secp256k1_u64x4_shr(M, 4))); c = secp256k1_u64x4_shr(c, 22);
+    c = secp256k1_u64x4_add(c, secp256k1_u64x4_mul_small(d, R1x16));
+
+    d = secp256k1_u64x4_add(secp256k1_u64x4_mul_small(c, R0_4), t[0]);
+    secp256k1_u64x4_store(r->n[0], secp256k1_u64x4_and(d, M)); d = secp256k1_u64x4_shr(d, 26);
+    d = secp256k1_u64x4_add(d, secp256k1_u64x4_add(secp256k1_u64x4_mul_small(c, R1_4), t[1]));
+    secp256k1_u64x4_store(r->n[1], secp256k1_u64x4_and(d, M)); d = secp256k1_u64x4_shr(d, 26);
+    secp256k1_u64x4_store(r->n[2], secp256k1_u64x4_add(d, t[2]));
+}
+
+static void secp256k1_fe4_mul(secp256k1_fe4 *r, const secp256k1_fe4 *a, const secp256k1_fe4 *b) {
+    secp256k1_u64x4 p[19];
+#define MUL(i, j) secp256k1_u32x4_mul(secp256k1_u32x4_load(a->n[i]), secp256k1_u32x4_load(b->n[j]))
+#define ACC(s, i, j) p[s] = secp256k1_u32x4_madd(p[s], secp256k1_u32x4_load(a->n[i]), secp256k1_u32x4_load(b->n[j]))
+    p[0] = MUL(0, 0);
+    p[1] = MUL(0, 1); ACC(1, 1, 0);
+    p[2] = MUL(0, 2); ACC(2, 1, 1); ACC(2, 2, 0);
+    p[3] = MUL(0, 3); ACC(3, 1, 2); ACC(3, 2, 1); ACC(3, 3, 0);
+    p[4] = MUL(0, 4); ACC(4, 1, 3); ACC(4, 2, 2); ACC(4, 3, 1); ACC(4, 4, 0);
+    p[5] = MUL(0, 5); ACC(5, 1, 4); ACC(5, 2, 3); ACC(5, 3, 2); ACC(5, 4, 1); ACC(5, 5, 0);
+    p[6] = MUL(0, 6); ACC(6, 1, 5); ACC(6, 2, 4); ACC(6, 3, 3); ACC(6, 4, 2); ACC(6, 5, 1); ACC(6, 6, 0);
+    p[7] = MUL(0, 7); ACC(7, 1, 6); ACC(7, 2, 5); ACC(7, 3, 4); ACC(7, 4, 3); ACC(7, 5, 2); ACC(7, 6, 1); ACC(7, 7, 0);
+    p[8] = MUL(0, 8); ACC(8, 1, 7); ACC(8, 2, 6); ACC(8, 3, 5); ACC(8, 4, 4); ACC(8, 5, 3); ACC(8, 6, 2); ACC(8, 7, 1); ACC(8, 8, 0);
+    p[9] = MUL(0, 9); ACC(9, 1, 8); ACC(9, 2, 7); ACC(9, 3, 6); ACC(9, 4, 5); ACC(9, 5, 4); ACC(9, 6, 3); ACC(9, 7, 2); ACC(9, 8, 1); ACC(9, 9, 0);
+    p[10] = MUL(1, 9); ACC(10, 2, 8); ACC(10, 3, 7); ACC(10, 4, 6); ACC(10, 5, 5); ACC(10, 6, 4); ACC(10, 7, 3); ACC(10, 8, 2); ACC(10, 9, 1);
+    p[11] = MUL(2, 9); ACC(11, 3, 8); ACC(11, 4, 7); ACC(11, 5, 6); ACC(11, 6, 5); ACC(11, 7, 4); ACC(11, 8, 3); ACC(11, 9, 2);
+    p[12] = MUL(3, 9); ACC(12, 4, 8); ACC(12, 5, 7); ACC(12, 6, 6); ACC(12, 7, 5); ACC(12, 8, 4); ACC(12, 9, 3);
+    p[13] = MUL(4, 9); ACC(13, 5, 8); ACC(13, 6, 7); ACC(13, 7, 6); ACC(13, 8, 5); ACC(13, 9, 4);
+    p[14] = MUL(5, 9); ACC(14, 6, 8); ACC(14, 7, 7); ACC(14, 8, 6); ACC(14, 9, 5);
+    p[15] = MUL(6, 9); ACC(15, 7, 8); ACC(15, 8, 7); ACC(15, 9, 6);
+    p[16] = MUL(7, 9); ACC(16, 8, 8); ACC(16, 9, 7);
+    p[17] = MUL(8, 9); ACC(17, 9, 8);
+    p[18] = MUL(9, 9);
+#undef MUL
+#undef ACC
+    secp256k1_fe4_reduce(r, p);
+}
+
+static void secp256k1_fe4_sqr(secp256k1_fe4 *r, const secp256k1_fe4 *a) {
+    secp256k1_u32x4 x2[10];
+    secp256k1_u64x4 p[19];
+    int i;
+    for (i = 0; i < 10; i++) {
+        const secp256k1_u64x4 v = secp256k1_u64x4_load(a->n[i]);
+        x2[i] = secp256k1_u64x4_narrow(secp256k1_u64x4_add(v, v));
+    }
+    /* Every cross product appears twice in a column; take it once, doubled. */
+#define MUL(i, j) secp256k1_u32x4_mul(x2[i], secp256k1_u32x4_load(a->n[j]))
+#define ACC(s, i, j) p[s] = secp256k1_u32x4_madd(p[s], x2[i], secp256k1_u32x4_load(a->n[j]))
+#define SQR(i) secp256k1_u32x4_mul(secp256k1_u32x4_load(a->n[i]), secp256k1_u32x4_load(a->n[i]))
+#define ACC_SQR(s, i) p[s] = secp256k1_u32x4_madd(p[s], secp256k1_u32x4_load(a->n[i]), secp256k1_u32x4_load(a->n[i]))
+    p[0] = SQR(0);
+    p[1] = MUL(0, 1);
+    p[2] = MUL(0, 2); ACC_SQR(2, 1);
+    p[3] = MUL(0, 3); ACC(3, 1, 2);
+    p[4] = MUL(0, 4); ACC(4, 1, 3); ACC_SQR(4, 2);
+    p[5] = MUL(0, 5); ACC(5, 1, 4); ACC(5, 2, 3);
+    p[6] = MUL(0, 6); ACC(6, 1, 5); ACC(6, 2, 4); ACC_SQR(6, 3);
+    p[7] = MUL(0, 7); ACC(7, 1, 6); ACC(7, 2, 5); ACC(7, 3, 4);
+    p[8] = MUL(0, 8); ACC(8, 1, 7); ACC(8, 2, 6); ACC(8, 3, 5); ACC_SQR(8, 4);
+    p[9] = MUL(0, 9); ACC(9, 1, 8); ACC(9, 2, 7); ACC(9, 3, 6); ACC(9, 4, 5);
+    p[10] = MUL(1, 9); ACC(10, 2, 8); ACC(10, 3, 7); ACC(10, 4, 6); ACC_SQR(10, 5);
+    p[11] = MUL(2, 9); ACC(11, 3, 8); ACC(11, 4, 7); ACC(11, 5, 6);
+    p[12] = MUL(3, 9); ACC(12, 4, 8); ACC(12, 5, 7); ACC_SQR(12, 6);
+    p[13] = MUL(4, 9); ACC(13, 5, 8); ACC(13, 6, 7);
+    p[14] = MUL(5, 9); ACC(14, 6, 8); ACC_SQR(14, 7);
+    p[15] = MUL(6, 9); ACC(15, 7, 8);
+    p[16] = MUL(7, 9); ACC_SQR(16, 8);
+    p[17] = MUL(8, 9);
+    p[18] = SQR(9);
+#undef MUL
+#undef ACC
+#undef SQR
+#undef ACC_SQR
+    secp256k1_fe4_reduce(r, p);
+}
+
+static void secp256k1_fe4_add(secp256k1_fe4 *r, const secp256k1_fe4 *a, const secp256k1_fe4 *b) {
+    int i;
+    for (i = 0; i < 10; i++) {
+        secp256k1_u64x4_store(r->n[i], secp256k1_u64x4_add(secp256k1_u64x4_load(a->n[i]), secp256k1_u64x4_load(b->n[i])));
+    }
+}
+
+static void secp256k1_fe4_mul_int(secp256k1_fe4 *r, const secp256k1_fe4 *a, int k) {
+    const secp256k1_u32x4 kk = secp256k1_u64x4_narrow(secp256k1_u64x4_set1(k));
+    int i;
+    for (i = 0; i < 10; i++) {
+        secp256k1_u64x4_store(r->n[i], secp256k1_u32x4_mul(secp256k1_u32x4_load(a->n[i]), kk));
+    }
+}
+
+static void secp256k1_fe4_negate(secp256k1_fe4 *r, const secp256k1_fe4 *a, int m) {
+    int i;
+    for (i = 0; i < 10; i++) {
+        const uint64_t p = i == 0 ? 0x3FFFC2FULL : i == 1 ? 0x3FFFFBFULL : i == 9 ? 0x03FFFFFULL : 0x3FFFFFFULL;
+        secp256k1_u64x4_store(r->n[i], secp256k1_u64x4_sub(secp256k1_u64x4_set1(p * 2 * (m + 1)), secp256k1_u64x4_load(a->n[i])));
+    }
+}
+
+/* The first carry pass of secp256k1_fe_normalize_weak on t; see there. */
+static SECP256K1_INLINE void secp256k1_fe4_carry(secp256k1_u64x4 *t) {
+    const secp256k1_u64x4 M = secp256k1_u64x4_set1(0x3FFFFFFULL);
+    secp256k1_u64x4 x;
+    int i;
+
+    /* Reduce t9 at the start so there will be at most a single carry from the first pass */
+    x = secp256k1_u64x4_shr(t[9], 22); t[9] = secp256k1_u64x4_and(t[9], secp256k1_u64x4_set1(0x03FFFFFULL));
+
+    t[0] = secp256k1_u32x4_madd(t[0], secp256k1_u64x4_narrow(x), secp256k1_u64x4_narrow(secp256k1_u64x4_set1(0x3D1ULL)));
+    t[1] = secp256k1_u64x4_add(t[1], secp256k1_u64x4_shl(x, 6));
+    for (i = 0; i < 9; i++) {
+        t[i + 1] = secp256k1_u64x4_add(t[i + 1], secp256k1_u64x4_shr(t[i], 26));
+        t[i] = secp256k1_u64x4_and(t[i], M);
+    }
+}
+
+static void secp256k1_fe4_normalize_weak(secp256k1_fe4 *r, const secp256k1_fe4 *a) {
+    secp256k1_u64x4 t[10];
+    int i;
+    for (i = 0; i < 10; i++) {
+        t[i] = secp256k1_u64x4_load(a->n[i]);
+    }
+    secp256k1_fe4_carry(t);
+    for (i = 0; i < 10; i++) {
+        secp256k1_u64x4_store(r->n[i], t[i]);
+    }
+}
+
+static void secp256k1_fe4_normalizes_to_zero(int *flags, const secp256k1_fe4 *a) {
+    SECP256K1_FE4_ALIGN uint64_t z[2][4];
+    secp256k1_u64x4 t[10], z0, z1;
+    int i, l;
+    for (i = 0; i < 10; i++) {
+        t[i] = secp256k1_u64x4_load(a->n[i]);
+    }
+    secp256k1_fe4_carry(t);
+
+    /* z0 tracks a possible raw value of 0, z1 tracks a possible raw value of P */
+    z0 = t[0];
+    z1 = secp256k1_u64x4_and(secp256k1_u64x4_xor(t[0], secp256k1_u64x4_set1(0x3D0ULL)),
+                             secp256k1_u64x4_xor(t[1], secp256k1_u64x4_set1(0x40ULL)));
+    for (i = 1; i < 9; i++) {
+        z0 = secp256k1_u64x4_or(z0, t[i]);
+    }
+    for (i = 2; i < 9; i++) {
+        z1 = secp256k1_u64x4_and(z1, t[i]);
+    }
+    z0 = secp256k1_u64x4_or(z0, t[9]);
+    z1 = secp256k1_u64x4_and(z1, secp256k1_u64x4_xor(t[9], secp256k1_u64x4_set1(0x3C00000ULL)));
+
+    secp256k1_u64x4_store(z[0], z0);
+    secp256k1_u64x4_store(z[1], z1);
+    for (l = 0; l < 4; l++) {
+        flags[l] = (z[0][l] == 0) | (z[1][l] == 0x3FFFFFFULL);
+    }
+}
+
+static void secp256k1_fe4_cmov(secp256k1_fe4 *r, const secp256k1_fe4 *a, const int *flags) {
+    SECP256K1_FE4_ALIGN uint64_t mask[4];
+    secp256k1_u64x4 m, x;
+    int i, l;
+    for (l = 0; l < 4; l++) {
+        mask[l] = ~((uint64_t)(flags[l] != 0) + ~((uint64_t)0));
+    }
+    m = secp256k1_u64x4_load(mask);
+    for (i = 0; i < 10; i++) {
+        x = secp256k1_u64x4_load(r->n[i]);
+        x = secp256k1_u64x4_xor(x, secp256k1_u64x4_and(secp256k1_u64x4_xor(x, secp256k1_u64x4_load(a->n[i])), m));
+        secp256k1_u64x4_store(r->n[i], x);
+    }
+}
+
+#endif /* SECP256K1_FIELD4_IMPL_H */
@@ -0,0 +1,923 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+/**
+ * Inline assembly versions of secp256k1_fe_mul_inner and secp256k1_fe_sqr_inner
+ * for x86_64 (USE_ASM_X86_64) and AArch64 (USE_ASM_AARCH64 together with
+ * USE_ASM_AARCH64_FIELD).
+ *
+ * Both follow field_5x52_int128_impl.h step for step and produce the same limbs;
+ * see the comments there for the bounds on each intermediate. The 128-bit
+ * accumulators c and d are kept as register pairs, and the int128 version stays
+ * the reference implementation for every other target.
+ */
+
+#ifndef SECP256K1_FIELD_INNER5X52_IMPL_H
+#define SECP256K1_FIELD_INNER5X52_IMPL_H
+
+#if defined(USE_ASM_X86_64)
+
+SECP256K1_INLINE static void secp256k1_fe_mul_inner(uint64_t *r, const uint64_t *a, const uint64_t * SECP256K1_RESTRICT b) {
+/**
+ * Registers: rdx:rax = multiplication accumulator
+ *            r9:r8   = c
+ *            r15:rcx = d
+ *            r10-r14 = a0-a4
+ *            rbx     = b
+ *            rdi     = r
+ *            rsi     = a, then t4
+ *            tmp1    = t3
+ */
+    uint64_t tmp1;
+    __asm__ __volatile__(
+    "movq 0(%%rsi),%%r10\n"
+    "movq 8(%%rsi),%%r11\n"
+    "movq 16(%%rsi),%%r12\n"
+    "movq 24(%%rsi),%%r13\n"
+    "movq 32(%%rsi),%%r14\n"
+    /* d = a0 * b3 */
+    "movq %%r10,%%rax\n"
+    "mulq 24(%%rbx)\n"
+    "movq %%rax,%%rcx\n"
+    "movq %%rdx,%%r15\n"
+    /* d += a1 * b2 */
+    "movq %%r11,%%rax\n"
+    "mulq 16(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += a2 * b1 */
+    "movq %%r12,%%rax\n"
+    "mulq 8(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += a3 * b0 */
+    "movq %%r13,%%rax\n"
+    "mulq 0(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* c = a4 * b4 */
+    "movq %%r14,%%rax\n"
+    "mulq 32(%%rbx)\n"
+    "movq %%rax,%%r8\n"
+    "movq %%rdx,%%r9\n"
+    /* d += (c & M) * R */
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    "movq $0x1000003d10,%%rdx\n"
+    "mulq %%rdx\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* c >>= 52 (r8 only) */
+    "shrdq $52,%%r9,%%r8\n"
+    /* t3 (tmp1) = d & M */
+    "movq %%rcx,%%rsi\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rsi\n"
+    "movq %%rsi,%1\n"
+    /* d >>= 52 */
+    "shrdq $52,%%r15,%%rcx\n"
+    "xorq %%r15,%%r15\n"
+    /* d += a0 * b4 */
+    "movq %%r10,%%rax\n"
+    "mulq 32(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += a1 * b3 */
+    "movq %%r11,%%rax\n"
+    "mulq 24(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += a2 * b2 */
+    "movq %%r12,%%rax\n"
+    "mulq 16(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += a3 * b1 */
+    "movq %%r13,%%rax\n"
+    "mulq 8(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += a4 * b0 */
+    "movq %%r14,%%rax\n"
+    "mulq 0(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += c * R */
+    "movq %%r8,%%rax\n"
+    "movq $0x1000003d10,%%rdx\n"
+    "mulq %%rdx\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* t4 = d & M (rsi) */
+    "movq %%rcx,%%rsi\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rsi\n"
+    /* d >>= 52 */
+    "shrdq $52,%%r15,%%rcx\n"
+    "xorq %%r15,%%r15\n"
+    /* c = a0 * b0 */
+    "movq %%r10,%%rax\n"
+    "mulq 0(%%rbx)\n"
+    "movq %%rax,%%r8\n"
+    "movq %%rdx,%%r9\n"
+    /* d += a1 * b4 */
+    "movq %%r11,%%rax\n"
+    "mulq 32(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += a2 * b3 */
+    "movq %%r12,%%rax\n"
+    "mulq 24(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += a3 * b2 */
+    "movq %%r13,%%rax\n"
+    "mulq 16(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += a4 * b1 */
+    "movq %%r14,%%rax\n"
+    "mulq 8(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* u0 = d & M (rax) */
+    "movq %%rcx,%%rax\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    /* d >>= 52 */
+    "shrdq $52,%%r15,%%rcx\n"
+    "xorq %%r15,%%r15\n"
+    /* u0 = (u0 << 4) | tx, where tx = t4 >> 48 */
+    "shlq $4,%%rax\n"
+    "movq %%rsi,%%rdx\n"
+    "shrq $48,%%rdx\n"
+    "orq %%rdx,%%rax\n"
+    /* c += u0 * (R >> 4) */
+    "movq $0x1000003d1,%%rdx\n"
+    "mulq %%rdx\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    /* r[0] = c & M */
+    "movq %%r8,%%rax\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    "movq %%rax,0(%%rdi)\n"
+    /* c >>= 52 */
+    "shrdq $52,%%r9,%%r8\n"
+    "xorq %%r9,%%r9\n"
+    /* c += a0 * b1 */
+    "movq %%r10,%%rax\n"
+    "mulq 8(%%rbx)\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    /* c += a1 * b0 */
+    "movq %%r11,%%rax\n"
+    "mulq 0(%%rbx)\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    /* d += a2 * b4 */
+    "movq %%r12,%%rax\n"
+    "mulq 32(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += a3 * b3 */
+    "movq %%r13,%%rax\n"
+    "mulq 24(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += a4 * b2 */
+    "movq %%r14,%%rax\n"
+    "mulq 16(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* c += (d & M) * R */
+    "movq %%rcx,%%rax\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    "movq $0x1000003d10,%%rdx\n"
+    "mulq %%rdx\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    /* d >>= 52 */
+    "shrdq $52,%%r15,%%rcx\n"
+    "xorq %%r15,%%r15\n"
+    /* r[1] = c & M */
+    "movq %%r8,%%rax\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    "movq %%rax,8(%%rdi)\n"
+    /* c >>= 52 */
+    "shrdq $52,%%r9,%%r8\n"
+    "xorq %%r9,%%r9\n"
+    /* c += a0 * b2 */
+    "movq %%r10,%%rax\n"
+    "mulq 16(%%rbx)\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    /* c += a1 * b1 */
+    "movq %%r11,%%rax\n"
+    "mulq 8(%%rbx)\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    /* c += a2 * b0 */
+    "movq %%r12,%%rax\n"
+    "mulq 0(%%rbx)\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    /* d += a3 * b4 */
+    "movq %%r13,%%rax\n"
+    "mulq 32(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += a4 * b3 */
+    "movq %%r14,%%rax\n"
+    "mulq 24(%%rbx)\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* c += (d & M) * R */
+    "movq %%rcx,%%rax\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    "movq $0x1000003d10,%%rdx\n"
+    "mulq %%rdx\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    /* d >>= 52 */
+    "shrdq $52,%%r15,%%rcx\n"
+    "xorq %%r15,%%r15\n"
+    /* r[2] = c & M */
+    "movq %%r8,%%rax\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    "movq %%rax,16(%%rdi)\n"
+    /* c >>= 52 */
+    "shrdq $52,%%r9,%%r8\n"
+    "xorq %%r9,%%r9\n"
+    /* c += d * R + t3 */
+    "movq %%rcx,%%rax\n"
+    "movq $0x1000003d10,%%rdx\n"
+    "mulq %%rdx\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    "movq %1,%%rax\n"
+    "addq %%rax,%%r8\n"
+    "adcq $0,%%r9\n"
+    /* r[3] = c & M */
+    "movq %%r8,%%rax\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    "movq %%rax,24(%%rdi)\n"
+    /* c >>= 52 (r8 only) */
+    "shrdq $52,%%r9,%%r8\n"
+    /* c += t4 & (M >> 4) */
+    "movq $0xffffffffffff,%%rax\n"
+    "andq %%rax,%%rsi\n"
+    "addq %%rsi,%%r8\n"
+    /* r[4] = c */
+    "movq %%r8,32(%%rdi)\n"
+: "+S"(a), "=m"(tmp1)
+: "b"(b), "D"(r)
+: "%rax", "%rcx", "%rdx", "%r8", "%r9", "%r10", "%r11", "%r12", "%r13", "%r14", "%r15", "cc", "memory"
+);
+}
+
+SECP256K1_INLINE static void secp256k1_fe_sqr_inner(uint64_t *r, const uint64_t *a) {
+/**
+ * Registers: rdx:rax = multiplication accumulator
+ *            r9:r8   = c
+ *            r15:rcx = d
+ *            r10-r14 = a0-a4
+ *            rdi     = r
+ *            rsi     = a, then t4
+ *            tmp1    = t3
+ */
+    uint64_t tmp1;
+    __asm__ __volatile__(
+    "movq 0(%%rsi),%%r10\n"
+    "movq 8(%%rsi),%%r11\n"
+    "movq 16(%%rsi),%%r12\n"
+    "movq 24(%%rsi),%%r13\n"
+    "movq 32(%%rsi),%%r14\n"
+    /* d = (a0*2) * a3 */
+    "leaq (%%r10,%%r10,1),%%rax\n"
+    "mulq %%r13\n"
+    "movq %%rax,%%rcx\n"
+    "movq %%rdx,%%r15\n"
+    /* d += (a1*2) * a2 */
+    "leaq (%%r11,%%r11,1),%%rax\n"
+    "mulq %%r12\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* c = a4 * a4 */
+    "movq %%r14,%%rax\n"
+    "mulq %%r14\n"
+    "movq %%rax,%%r8\n"
+    "movq %%rdx,%%r9\n"
+    /* d += (c & M) * R */
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    "movq $0x1000003d10,%%rdx\n"
+    "mulq %%rdx\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* c >>= 52 (r8 only) */
+    "shrdq $52,%%r9,%%r8\n"
+    /* t3 (tmp1) = d & M */
+    "movq %%rcx,%%rsi\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rsi\n"
+    "movq %%rsi,%1\n"
+    /* d >>= 52 */
+    "shrdq $52,%%r15,%%rcx\n"
+    "xorq %%r15,%%r15\n"
+    /* a4 *= 2 */
+    "addq %%r14,%%r14\n"
+    /* d += a0 * a4 */
+    "movq %%r10,%%rax\n"
+    "mulq %%r14\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += (a1*2) * a3 */
+    "leaq (%%r11,%%r11,1),%%rax\n"
+    "mulq %%r13\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += a2 * a2 */
+    "movq %%r12,%%rax\n"
+    "mulq %%r12\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += c * R */
+    "movq %%r8,%%rax\n"
+    "movq $0x1000003d10,%%rdx\n"
+    "mulq %%rdx\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* t4 = d & M (rsi) */
+    "movq %%rcx,%%rsi\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rsi\n"
+    /* d >>= 52 */
+    "shrdq $52,%%r15,%%rcx\n"
+    "xorq %%r15,%%r15\n"
+    /* c = a0 * a0 */
+    "movq %%r10,%%rax\n"
+    "mulq %%r10\n"
+    "movq %%rax,%%r8\n"
+    "movq %%rdx,%%r9\n"
+    /* d += a1 * a4 */
+    "movq %%r11,%%rax\n"
+    "mulq %%r14\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += (a2*2) * a3 */
+    "leaq (%%r12,%%r12,1),%%rax\n"
+    "mulq %%r13\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* u0 = d & M (rax) */
+    "movq %%rcx,%%rax\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    /* d >>= 52 */
+    "shrdq $52,%%r15,%%rcx\n"
+    "xorq %%r15,%%r15\n"
+    /* u0 = (u0 << 4) | tx, where tx = t4 >> 48 */
+    "shlq $4,%%rax\n"
+    "movq %%rsi,%%rdx\n"
+    "shrq $48,%%rdx\n"
+    "orq %%rdx,%%rax\n"
+    /* c += u0 * (R >> 4) */
+    "movq $0x1000003d1,%%rdx\n"
+    "mulq %%rdx\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    /* r[0] = c & M */
+    "movq %%r8,%%rax\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    "movq %%rax,0(%%rdi)\n"
+    /* c >>= 52 */
+    "shrdq $52,%%r9,%%r8\n"
+    "xorq %%r9,%%r9\n"
+    /* a0 *= 2 */
+    "addq %%r10,%%r10\n"
+    /* c += a0 * a1 */
+    "movq %%r10,%%rax\n"
+    "mulq %%r11\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    /* d += a2 * a4 */
+    "movq %%r12,%%rax\n"
+    "mulq %%r14\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* d += a3 * a3 */
+    "movq %%r13,%%rax\n"
+    "mulq %%r13\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* c += (d & M) * R */
+    "movq %%rcx,%%rax\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    "movq $0x1000003d10,%%rdx\n"
+    "mulq %%rdx\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    /* d >>= 52 */
+    "shrdq $52,%%r15,%%rcx\n"
+    "xorq %%r15,%%r15\n"
+    /* r[1] = c & M */
+    "movq %%r8,%%rax\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    "movq %%rax,8(%%rdi)\n"
+    /* c >>= 52 */
+    "shrdq $52,%%r9,%%r8\n"
+    "xorq %%r9,%%r9\n"
+    /* c += a0 * a2 */
+    "movq %%r10,%%rax\n"
+    "mulq %%r12\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    /* c += a1 * a1 */
+    "movq %%r11,%%rax\n"
+    "mulq %%r11\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    /* d += a3 * a4 */
+    "movq %%r13,%%rax\n"
+    "mulq %%r14\n"
+    "addq %%rax,%%rcx\n"
+    "adcq %%rdx,%%r15\n"
+    /* c += (d & M) * R */
+    "movq %%rcx,%%rax\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    "movq $0x1000003d10,%%rdx\n"
+    "mulq %%rdx\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    /* d >>= 52 */
+    "shrdq $52,%%r15,%%rcx\n"
+    "xorq %%r15,%%r15\n"
+    /* r[2] = c & M */
+    "movq %%r8,%%rax\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    "movq %%rax,16(%%rdi)\n"
+    /* c >>= 52 */
+    "shrdq $52,%%r9,%%r8\n"
+    "xorq %%r9,%%r9\n"
+    /* c += d * R + t3 */
+    "movq %%rcx,%%rax\n"
+    "movq $0x1000003d10,%%rdx\n"
+    "mulq %%rdx\n"
+    "addq %%rax,%%r8\n"
+    "adcq %%rdx,%%r9\n"
+    "movq %1,%%rax\n"
+    "addq %%rax,%%r8\n"
+    "adcq $0,%%r9\n"
+    /* r[3] = c & M */
+    "movq %%r8,%%rax\n"
+    "movq $0xfffffffffffff,%%rdx\n"
+    "andq %%rdx,%%rax\n"
+    "movq %%rax,24(%%rdi)\n"
+    /* c >>= 52 (r8 only) */
+    "shrdq $52,%%r9,%%r8\n"
+    /* c += t4 & (M >> 4) */
+    "movq $0xffffffffffff,%%rax\n"
+    "andq %%rax,%%rsi\n"
+    "addq %%rsi,%%r8\n"
+    /* r[4] = c */
+    "movq %%r8,32(%%rdi)\n"
+: "+S"(a), "=m"(tmp1)
+: "D"(r)
+: "%rax", "%rcx", "%rdx", "%r8", "%r9", "%r10", "%r11", "%r12", "%r13", "%r14", "%r15", "cc", "memory"
+);
+}
+
+#elif defined(USE_ASM_AARCH64)
+
+/* Registers are left to the compiler, which keeps x18 (reserved on Apple
+ * platforms) and the frame pointer out of the way. Products alternate between
+ * two register pairs so that a multiply never waits on the previous add. */
+
+SECP256K1_INLINE static void secp256k1_fe_mul_inner(uint64_t *r, const uint64_t *a, const uint64_t * SECP256K1_RESTRICT b) {
+    uint64_t a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+    uint64_t b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3], b4 = b[4];
+    uint64_t c0, c1, d0, d1, lo0, hi0, lo1, hi1, t3, t4, tx, u0, R, R4;
+    __asm__ __volatile__(
+    /* R and R >> 4 do not fit a logical immediate */
+    "mov %[R], #0x3d10\n"
+    "movk %[R], #0x10, lsl #32\n"
+    "lsr %[R4], %[R], #4\n"
+    /* d = a0 * b3 */
+    "mul %[d0], %[a0], %[b3]\n"
+    "umulh %[d1], %[a0], %[b3]\n"
+    /* d += a1 * b2 */
+    "mul %[lo0], %[a1], %[b2]\n"
+    "umulh %[hi0], %[a1], %[b2]\n"
+    "adds %[d0], %[d0], %[lo0]\n"
+    "adc %[d1], %[d1], %[hi0]\n"
+    /* d += a2 * b1 */
+    "mul %[lo1], %[a2], %[b1]\n"
+    "umulh %[hi1], %[a2], %[b1]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* d += a3 * b0 */
+    "mul %[lo0], %[a3], %[b0]\n"
+    "umulh %[hi0], %[a3], %[b0]\n"
+    "adds %[d0], %[d0], %[lo0]\n"
+    "adc %[d1], %[d1], %[hi0]\n"
+    /* c = a4 * b4 */
+    "mul %[c0], %[a4], %[b4]\n"
+    "umulh %[c1], %[a4], %[b4]\n"
+    /* d += (c & M) * R */
+    "and %[tx], %[c0], #0xfffffffffffff\n"
+    "mul %[lo1], %[tx], %[R]\n"
+    "umulh %[hi1], %[tx], %[R]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* c >>= 52 */
+    "extr %[c0], %[c1], %[c0], #52\n"
+    "lsr %[c1], %[c1], #52\n"
+    /* t3 = d & M */
+    "and %[t3], %[d0], #0xfffffffffffff\n"
+    /* d >>= 52 */
+    "extr %[d0], %[d1], %[d0], #52\n"
+    "lsr %[d1], %[d1], #52\n"
+    /* d += a0 * b4 */
+    "mul %[lo0], %[a0], %[b4]\n"
+    "umulh %[hi0], %[a0], %[b4]\n"
+    "adds %[d0], %[d0], %[lo0]\n"
+    "adc %[d1], %[d1], %[hi0]\n"
+    /* d += a1 * b3 */
+    "mul %[lo1], %[a1], %[b3]\n"
+    "umulh %[hi1], %[a1], %[b3]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* d += a2 * b2 */
+    "mul %[lo0], %[a2], %[b2]\n"
+    "umulh %[hi0], %[a2], %[b2]\n"
+    "adds %[d0], %[d0], %[lo0]\n"
+    "adc %[d1], %[d1], %[hi0]\n"
+    /* d += a3 * b1 */
+    "mul %[lo1], %[a3], %[b1]\n"
+    "umulh %[hi1], %[a3], %[b1]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* d += a4 * b0 */
+    "mul %[lo0], %[a4], %[b0]\n"
+    "umulh %[hi0], %[a4], %[b0]\n"
+    "adds %[d0], %[d0], %[lo0]\n"
+    "adc %[d1], %[d1], %[hi0]\n"
+    /* d += c * R */
+    "mul %[lo1], %[c0], %[R]\n"
+    "umulh %[hi1], %[c0], %[R]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* t4 = d & M */
+    "and %[t4], %[d0], #0xfffffffffffff\n"
+    /* d >>= 52 */
+    "extr %[d0], %[d1], %[d0], #52\n"
+    "lsr %[d1], %[d1], #52\n"
+    /* c = a0 * b0 */
+    "mul %[c0], %[a0], %[b0]\n"
+    "umulh %[c1], %[a0], %[b0]\n"
+    /* d += a1 * b4 */
+    "mul %[lo0], %[a1], %[b4]\n"
+    "umulh %[hi0], %[a1], %[b4]\n"
+    "adds %[d0], %[d0], %[lo0]\n"
+    "adc %[d1], %[d1], %[hi0]\n"
+    /* d += a2 * b3 */
+    "mul %[lo1], %[a2], %[b3]\n"
+    "umulh %[hi1], %[a2], %[b3]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* d += a3 * b2 */
+    "mul %[lo0], %[a3], %[b2]\n"
+    "umulh %[hi0], %[a3], %[b2]\n"
+    "adds %[d0], %[d0], %[lo0]\n"
+    "adc %[d1], %[d1], %[hi0]\n"
+    /* d += a4 * b1 */
+    "mul %[lo1], %[a4], %[b1]\n"
+    "umulh %[hi1], %[a4], %[b1]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* u0 = d & M */
+    "and %[u0], %[d0], #0xfffffffffffff\n"
+    /* d >>= 52 */
+    "extr %[d0], %[d1], %[d0], #52\n"
+    "lsr %[d1], %[d1], #52\n"
+    /* u0 = (u0 << 4) | tx, where tx = t4 >> 48 */
+    "lsr %[tx], %[t4], #48\n"
+    "orr %[u0], %[tx], %[u0], lsl #4\n"
+    /* c += u0 * (R >> 4) */
+    "mul %[lo0], %[u0], %[R4]\n"
+    "umulh %[hi0], %[u0], %[R4]\n"
+    "adds %[c0], %[c0], %[lo0]\n"
+    "adc %[c1], %[c1], %[hi0]\n"
+    /* r[0] = c & M */
+    "and %[tx], %[c0], #0xfffffffffffff\n"
+    "str %[tx], [%[r], #0]\n"
+    /* c >>= 52 */
+    "extr %[c0], %[c1], %[c0], #52\n"
+    "lsr %[c1], %[c1], #52\n"
+    /* c += a0 * b1 */
+    "mul %[lo1], %[a0], %[b1]\n"
+    "umulh %[hi1], %[a0], %[b1]\n"
+    "adds %[c0], %[c0], %[lo1]\n"
+    "adc %[c1], %[c1], %[hi1]\n"
+    /* c += a1 * b0 */
+    "mul %[lo0], %[a1], %[b0]\n"
+    "umulh %[hi0], %[a1], %[b0]\n"
+    "adds %[c0], %[c0], %[lo0]\n"
+    "adc %[c1], %[c1], %[hi0]\n"
+    /* d += a2 * b4 */
+    "mul %[lo1], %[a2], %[b4]\n"
+    "umulh %[hi1], %[a2], %[b4]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* d += a3 * b3 */
+    "mul %[lo0], %[a3], %[b3]\n"
+    "umulh %[hi0], %[a3], %[b3]\n"
+    "adds %[d0], %[d0], %[lo0]\n"
+    "adc %[d1], %[d1], %[hi0]\n"
+    /* d += a4 * b2 */
+    "mul %[lo1], %[a4], %[b2]\n"
+    "umulh %[hi1], %[a4], %[b2]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* c += (d & M) * R */
+    "and %[tx], %[d0], #0xfffffffffffff\n"
+    "mul %[lo0], %[tx], %[R]\n"
+    "umulh %[hi0], %[tx], %[R]\n"
+    "adds %[c0], %[c0], %[lo0]\n"
+    "adc %[c1], %[c1], %[hi0]\n"
+    /* d >>= 52 */
+    "extr %[d0], %[d1], %[d0], #52\n"
+    "lsr %[d1], %[d1], #52\n"
+    /* r[1] = c & M */
+    "and %[tx], %[c0], #0xfffffffffffff\n"
+    "str %[tx], [%[r], #8]\n"
+    /* c >>= 52 */
+    "extr %[c0], %[c1], %[c0], #52\n"
+    "lsr %[c1], %[c1], #52\n"
+    /* c += a0 * b2 */
+    "mul %[lo1], %[a0], %[b2]\n"
+    "umulh %[hi1], %[a0], %[b2]\n"
+    "adds %[c0], %[c0], %[lo1]\n"
+    "adc %[c1], %[c1], %[hi1]\n"
+    /* c += a1 * b1 */
+    "mul %[lo0], %[a1], %[b1]\n"
+    "umulh %[hi0], %[a1], %[b1]\n"
+    "adds %[c0], %[c0], %[lo0]\n"
+    "adc %[c1], %[c1], %[hi0]\n"
+    /* c += a2 * b0 */
+    "mul %[lo1], %[a2], %[b0]\n"
+    "umulh %[hi1], %[a2], %[b0]\n"
+    "adds %[c0], %[c0], %[lo1]\n"
+    "adc %[c1], %[c1], %[hi1]\n"
+    /* d += a3 * b4 */
+    "mul %[lo0], %[a3], %[b4]\n"
+    "umulh %[hi0], %[a3], %[b4]\n"
+    "adds %[d0], %[d0], %[lo0]\n"
+    "adc %[d1], %[d1], %[hi0]\n"
+    /* d += a4 * b3 */
+    "mul %[lo1], %[a4], %[b3]\n"
+    "umulh %[hi1], %[a4], %[b3]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* c += (d & M) * R */
+    "and %[tx], %[d0], #0xfffffffffffff\n"
+    "mul %[lo0], %[tx], %[R]\n"
+    "umulh %[hi0], %[tx], %[R]\n"
+    "adds %[c0], %[c0], %[lo0]\n"
+    "adc %[c1], %[c1], %[hi0]\n"
+    /* d >>= 52 */
+    "extr %[d0], %[d1], %[d0], #52\n"
+    "lsr %[d1], %[d1], #52\n"
+    /* r[2] = c & M */
+    "and %[tx], %[c0], #0xfffffffffffff\n"
+    "str %[tx], [%[r], #16]\n"
+    /* c >>= 52 */
+    "extr %[c0], %[c1], %[c0], #52\n"
+    "lsr %[c1], %[c1], #52\n"
+    /* c += d * R + t3 */
+    "mul %[lo1], %[d0], %[R]\n"
+    "umulh %[hi1], %[d0], %[R]\n"
+    "adds %[c0], %[c0], %[lo1]\n"
+    "adc %[c1], %[c1], %[hi1]\n"
+    "adds %[c0], %[c0], %[t3]\n"
+    "adc %[c1], %[c1], xzr\n"
+    /* r[3] = c & M */
+    "and %[tx], %[c0], #0xfffffffffffff\n"
+    "str %[tx], [%[r], #24]\n"
+    /* c >>= 52 */
+    "extr %[c0], %[c1], %[c0], #52\n"
+    /* c += t4 & (M >> 4) */
+    "and %[t4], %[t4], #0xffffffffffff\n"
+    "add %[c0], %[c0], %[t4]\n"
+    /* r[4] = c */
+    "str %[c0], [%[r], #32]\n"
+    : [c0]"=&r"(c0), [c1]"=&r"(c1), [d0]"=&r"(d0), [d1]"=&r"(d1),
+      [lo0]"=&r"(lo0), [hi0]"=&r"(hi0), [lo1]"=&r"(lo1), [hi1]"=&r"(hi1),
+      [t3]"=&r"(t3), [t4]"=&r"(t4), [tx]"=&r"(tx), [u0]"=&r"(u0), [R]"=&r"(R), [R4]"=&r"(R4)
+    : [a0]"r"(a0), [a1]"r"(a1), [a2]"r"(a2), [a3]"r"(a3), [a4]"r"(a4),
+      [b0]"r"(b0), [b1]"r"(b1), [b2]"r"(b2), [b3]"r"(b3), [b4]"r"(b4), [r]"r"(r)
+    : "cc", "memory"
+    );
+}
+
+SECP256K1_INLINE static void secp256k1_fe_sqr_inner(uint64_t *r, const uint64_t *a) {
+    uint64_t a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+    uint64_t c0, c1, d0, d1, lo0, hi0, lo1, hi1, t3, t4, tx, u0, R, R4;
+    __asm__ __volatile__(
+    /* R and R >> 4 do not fit a logical immediate */
+    "mov %[R], #0x3d10\n"
+    "movk %[R], #0x10, lsl #32\n"
+    "lsr %[R4], %[R], #4\n"
+    /* d = (a0*2) * a3 */
+    "add %[tx], %[a0], %[a0]\n"
+    "mul %[d0], %[tx], %[a3]\n"
+    "umulh %[d1], %[tx], %[a3]\n"
+    /* d += (a1*2) * a2 */
+    "add %[u0], %[a1], %[a1]\n"
+    "mul %[lo0], %[u0], %[a2]\n"
+    "umulh %[hi0], %[u0], %[a2]\n"
+    "adds %[d0], %[d0], %[lo0]\n"
+    "adc %[d1], %[d1], %[hi0]\n"
+    /* c = a4 * a4 */
+    "mul %[c0], %[a4], %[a4]\n"
+    "umulh %[c1], %[a4], %[a4]\n"
+    /* d += (c & M) * R */
+    "and %[tx], %[c0], #0xfffffffffffff\n"
+    "mul %[lo1], %[tx], %[R]\n"
+    "umulh %[hi1], %[tx], %[R]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* c >>= 52 */
+    "extr %[c0], %[c1], %[c0], #52\n"
+    "lsr %[c1], %[c1], #52\n"
+    /* t3 = d & M */
+    "and %[t3], %[d0], #0xfffffffffffff\n"
+    /* d >>= 52 */
+    "extr %[d0], %[d1], %[d0], #52\n"
+    "lsr %[d1], %[d1], #52\n"
+    /* a4 *= 2 */
+    "add %[a4], %[a4], %[a4]\n"
+    /* d += a0 * a4 */
+    "mul %[lo0], %[a0], %[a4]\n"
+    "umulh %[hi0], %[a0], %[a4]\n"
+    "adds %[d0], %[d0], %[lo0]\n"
+    "adc %[d1], %[d1], %[hi0]\n"
+    /* d += (a1*2) * a3 */
+    "mul %[lo1], %[u0], %[a3]\n"
+    "umulh %[hi1], %[u0], %[a3]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* d += a2 * a2 */
+    "mul %[lo0], %[a2], %[a2]\n"
+    "umulh %[hi0], %[a2], %[a2]\n"
+    "adds %[d0], %[d0], %[lo0]\n"
+    "adc %[d1], %[d1], %[hi0]\n"
+    /* d += c * R */
+    "mul %[lo1], %[c0], %[R]\n"
+    "umulh %[hi1], %[c0], %[R]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* t4 = d & M */
+    "and %[t4], %[d0], #0xfffffffffffff\n"
+    /* d >>= 52 */
+    "extr %[d0], %[d1], %[d0], #52\n"
+    "lsr %[d1], %[d1], #52\n"
+    /* c = a0 * a0 */
+    "mul %[c0], %[a0], %[a0]\n"
+    "umulh %[c1], %[a0], %[a0]\n"
+    /* d += a1 * a4 */
+    "mul %[lo0], %[a1], %[a4]\n"
+    "umulh %[hi0], %[a1], %[a4]\n"
+    "adds %[d0], %[d0], %[lo0]\n"
+    "adc %[d1], %[d1], %[hi0]\n"
+    /* d += (a2*2) * a3 */
+    "add %[tx], %[a2], %[a2]\n"
+    "mul %[lo1], %[tx], %[a3]\n"
+    "umulh %[hi1], %[tx], %[a3]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* u0 = d & M */
+    "and %[u0], %[d0], #0xfffffffffffff\n"
+    /* d >>= 52 */
+    "extr %[d0], %[d1], %[d0], #52\n"
+    "lsr %[d1], %[d1], #52\n"
+    /* u0 = (u0 << 4) | tx, where tx = t4 >> 48 */
+    "lsr %[tx], %[t4], #48\n"
+    "orr %[u0], %[tx], %[u0], lsl #4\n"
+    /* c += u0 * (R >> 4) */
+    "mul %[lo0], %[u0], %[R4]\n"
+    "umulh %[hi0], %[u0], %[R4]\n"
+    "adds %[c0], %[c0], %[lo0]\n"
+    "adc %[c1], %[c1], %[hi0]\n"
+    /* r[0] = c & M */
+    "and %[tx], %[c0], #0xfffffffffffff\n"
+    "str %[tx], [%[r], #0]\n"
+    /* c >>= 52 */
+    "extr %[c0], %[c1], %[c0], #52\n"
+    "lsr %[c1], %[c1], #52\n"
+    /* a0 *= 2 */
+    "add %[a0], %[a0], %[a0]\n"
+    /* c += a0 * a1 */
+    "mul %[lo1], %[a0], %[a1]\n"
+    "umulh %[hi1], %[a0], %[a1]\n"
+    "adds %[c0], %[c0], %[lo1]\n"
+    "adc %[c1], %[c1], %[hi1]\n"
+    /* d += a2 * a4 */
+    "mul %[lo0], %[a2], %[a4]\n"
+    "umulh %[hi0], %[a2], %[a4]\n"
+    "adds %[d0], %[d0], %[lo0]\n"
+    "adc %[d1], %[d1], %[hi0]\n"
+    /* d += a3 * a3 */
+    "mul %[lo1], %[a3], %[a3]\n"
+    "umulh %[hi1], %[a3], %[a3]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* c += (d & M) * R */
+    "and %[tx], %[d0], #0xfffffffffffff\n"
+    "mul %[lo0], %[tx], %[R]\n"
+    "umulh %[hi0], %[tx], %[R]\n"
+    "adds %[c0], %[c0], %[lo0]\n"
+    "adc %[c1], %[c1], %[hi0]\n"
+    /* d >>= 52 */
+    "extr %[d0], %[d1], %[d0], #52\n"
+    "lsr %[d1], %[d1], #52\n"
+    /* r[1] = c & M */
+    "and %[tx], %[c0], #0xfffffffffffff\n"
+    "str %[tx], [%[r], #8]\n"
+    /* c >>= 52 */
+    "extr %[c0], %[c1], %[c0], #52\n"
+    "lsr %[c1], %[c1], #52\n"
+    /* c += a0 * a2 */
+    "mul %[lo1], %[a0], %[a2]\n"
+    "umulh %[hi1], %[a0], %[a2]\n"
+    "adds %[c0], %[c0], %[lo1]\n"
+    "adc %[c1], %[c1], %[hi1]\n"
+    /* c += a1 * a1 */
+    "mul %[lo0], %[a1], %[a1]\n"
+    "umulh %[hi0], %[a1], %[a1]\n"
+    "adds %[c0], %[c0], %[lo0]\n"
+    "adc %[c1], %[c1], %[hi0]\n"
+    /* d += a3 * a4 */
+    "mul %[lo1], %[a3], %[a4]\n"
+    "umulh %[hi1], %[a3], %[a4]\n"
+    "adds %[d0], %[d0], %[lo1]\n"
+    "adc %[d1], %[d1], %[hi1]\n"
+    /* c += (d & M) * R */
+    "and %[tx], %[d0], #0xfffffffffffff\n"
+    "mul %[lo0], %[tx], %[R]\n"
+    "umulh %[hi0], %[tx], %[R]\n"
+    "adds %[c0], %[c0], %[lo0]\n"
+    "adc %[c1], %[c1], %[hi0]\n"
+    /* d >>= 52 */
+    "extr %[d0], %[d1], %[d0], #52\n"
+    "lsr %[d1], %[d1], #52\n"
+    /* r[2] = c & M */
+    "and %[tx], %[c0], #0xfffffffffffff\n"
+    "str %[tx], [%[r], #16]\n"
+    /* c >>= 52 */
+    "extr %[c0], %[c1], %[c0], #52\n"
+    "lsr %[c1], %[c1], #52\n"
+    /* c += d * R + t3 */
+    "mul %[lo1], %[d0], %[R]\n"
+    "umulh %[hi1], %[d0], %[R]\n"
+    "adds %[c0], %[c0], %[lo1]\n"
+    "adc %[c1], %[c1], %[hi1]\n"
+    "adds %[c0], %[c0], %[t3]\n"
+    "adc %[c1], %[c1], xzr\n"
+    /* r[3] = c & M */
+    "and %[tx], %[c0], #0xfffffffffffff\n"
+    "str %[tx], [%[r], #24]\n"
+    /* c >>= 52 */
+    "extr %[c0], %[c1], %[c0], #52\n"
+    /* c += t4 & (M >> 4) */
+    "and %[t4], %[t4], #0xffffffffffff\n"
+    "add %[c0], %[c0], %[t4]\n"
+    /* r[4] = c */
+    "str %[c0], [%[r], #32]\n"
+    : [c0]"=&r"(c0), [c1]"=&r"(c1), [d0]"=&r"(d0), [d1]"=&r"(d1),
+      [lo0]"=&r"(lo0), [hi0]"=&r"(hi0), [lo1]"=&r"(lo1), [hi1]"=&r"(hi1),
+      [t3]"=&r"(t3), [t4]"=&r"(t4), [tx]"=&r"(tx), [u0]"=&r"(u0), [R]"=&r"(R), [R4]"=&r"(R4),
+      [a0]"+&r"(a0), [a4]"+&r"(a4)
+    : [a1]"r"(a1), [a2]"r"(a2), [a3]"r"(a3), [r]"r"(r)
+    : "cc", "memory"
+    );
+}
+
+#else
+#error "field_5x52_asm_impl.h needs USE_ASM_X86_64 or USE_ASM_AARCH64"
+#endif
+
+#endif /* SECP256K1_FIELD_INNER5X52_IMPL_H */
@@ -12,6 +12,7 @@
 #endif
 
 #include "util.h"
+#include "stats.h"
 
 #if defined(USE_FIELD_10X26)
 #include "field_10x26_impl.h"
@@ -21,6 +22,10 @@
 #error "Please select field implementation"
 #endif
 
+#if defined(USE_FIELD_INV_SAFEGCD) && !defined(USE_FIELD_5X52)
+#error "USE_FIELD_INV_SAFEGCD requires USE_FIELD_5X52"
+#endif
+
 SECP256K1_INLINE static int secp256k1_fe_equal(const secp256k1_fe *a, const secp256k1_fe *b) {
     secp256k1_fe na;
     secp256k1_fe_negate(&na, a, 1);
@@ -48,6 +53,8 @@ static int secp256k1_fe_sqrt(secp256k1_fe *r, const secp256k1_fe *a) {
     secp256k1_fe x2, x3, x6, x9, x11, x22, x44, x88, x176, x220, x223, t1;
     int j;
 
+    SECP256K1_STATS_INC(FE_SQRT);
+
     /** The binary representation of (p + 1)/4 has 3 blocks of 1s, with lengths in
      *  { 2, 22, 223 }. Use an addition chain to calculate 2^n - 1 for each block:
      *  1, [2], 3, 6, 9, 11, [22], 44, 88, 176, 220, [223]
@@ -134,9 +141,15 @@ static int secp256k1_fe_sqrt(secp256k1_fe *r, const secp256k1_fe *a) {
 }
 
 static void secp256k1_fe_inv(secp256k1_fe *r, const secp256k1_fe *a) {
+#if defined(USE_FIELD_INV_SAFEGCD)
+    SECP256K1_STATS_INC(FE_INV);
+    secp256k1_fe_inv_safegcd(r, a);
+#else
     secp256k1_fe x2, x3, x6, x9, x11, x22, x44, x88, x176, x220, x223, t1;
     int j;
 
+    SECP256K1_STATS_INC(FE_INV);
+
     /** The binary representation of (p - 2) has 5 blocks of 1s, with lengths in
      *  { 1, 2, 22, 223 }. Use an addition chain to calculate 2^n - 1 for each block:
      *  [1], [2], 3, 6, 9, 11, [22], 44, 88, 176, 220, [223]
@@ -221,11 +234,15 @@ static void secp256k1_fe_inv(secp256k1_fe *r, const secp256k1_fe *a) {
         secp256k1_fe_sqr(&t1, &t1);
     }
     secp256k1_fe_mul(r, a, &t1);
+#endif
 }
 
 static void secp256k1_fe_inv_var(secp256k1_fe *r, const secp256k1_fe *a) {
 #if defined(USE_FIELD_INV_BUILTIN)
     secp256k1_fe_inv(r, a);
+#elif defined(USE_FIELD_INV_SAFEGCD)
+    SECP256K1_STATS_INC(FE_INV);
+    secp256k1_fe_inv_safegcd_var(r, a);
 #elif defined(USE_FIELD_INV_NUM)
     secp256k1_num n, m;
     static const secp256k1_fe negone = SECP256K1_FE_CONST(
@@ -242,6 +259,7 @@ static void secp256k1_fe_inv_var(secp256k1_fe *r, const secp256k1_fe *a) {
     unsigned char b[32];
     int res;
     secp256k1_fe c = *a;
+    SECP256K1_STATS_INC(FE_INV);
     secp256k1_fe_normalize_var(&c);
     secp256k1_fe_get_b32(b, &c);
     secp256k1_num_set_bin(&n, b, 32);
@@ -306,6 +324,15 @@ static int secp256k1_fe_is_quad_var(const secp256k1_fe *a) {
     secp256k1_num_set_bin(&n, b, 32);
     secp256k1_num_set_bin(&m, prime, 32);
     return secp256k1_num_jacobi(&n, &m) >= 0;
+#elif defined(USE_FIELD_INV_SAFEGCD)
+    int jac = secp256k1_fe_jacobi_safegcd_var(a);
+    if (jac == 0) {
+        /* The Jacobi computation failed to converge; this is extremely rare with
+         * random input (except in VERIFY mode, where fewer iterations are used). */
+        secp256k1_fe r;
+        return secp256k1_fe_sqrt(&r, a);
+    }
+    return jac > 0;
 #else
     secp256k1_fe r;
     return secp256k1_fe_sqrt(&r, a);
@@ -0,0 +1,169 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef SECP256K1_MODULE_FIXED_TABLE_MAIN
+#define SECP256K1_MODULE_FIXED_TABLE_MAIN
+
+#include "secp256k1_fixed_table.h"
+
+#define FIXED_TABLE_WINDOW_MIN 2
+#define FIXED_TABLE_WINDOW_MAX 8
+
+/* The table follows the layout of secp256k1_ecmult_gen_context's prec, with
+ * windows of any width: entry [j][i] is i*2^(window*j)*P + U_j, where the U_j
+ * are multiples of a point with no known discrete logarithm that sum to zero.
+ * Adding one entry per window then gives n*P, and no entry is infinity. */
+struct secp256k1_ecmult_fixed_table_struct {
+    int window;
+    int nwindows;
+    secp256k1_ge_storage point; /* P itself */
+    secp256k1_ge_storage *prec; /* nwindows rows of 2^window entries */
+};
+
+secp256k1_ecmult_fixed_table* secp256k1_ecmult_fixed_table_create(const secp256k1_context* ctx, const secp256k1_pubkey *pubkey, int window) {
+    secp256k1_ecmult_fixed_table *table;
+    secp256k1_ge p;
+    secp256k1_ge *prec;
+    secp256k1_gej *precj;
+    secp256k1_gej pbase, nums_gej, numsbase;
+    size_t rowlen, count, i;
+    int j, ok = 1;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(pubkey != NULL);
+
+    if (window < FIXED_TABLE_WINDOW_MIN || window > FIXED_TABLE_WINDOW_MAX || !secp256k1_pubkey_load(ctx, &p, pubkey)) {
+        return NULL;
+    }
+    table = (secp256k1_ecmult_fixed_table *)checked_malloc(&ctx->error_callback, sizeof(*table));
+    if (table == NULL) {
+        return NULL;
+    }
+    table->window = window;
+    secp256k1_ge_to_storage(&table->point, &p);
+    table->nwindows = (256 + window - 1) / window;
+    rowlen = (size_t)1 << window;
+    count = table->nwindows * rowlen;
+    table->prec = (secp256k1_ge_storage *)checked_malloc(&ctx->error_callback, count * sizeof(secp256k1_ge_storage));
+    prec = (secp256k1_ge *)checked_malloc(&ctx->error_callback, count * sizeof(secp256k1_ge));
+    precj = (secp256k1_gej *)checked_malloc(&ctx->error_callback, count * sizeof(secp256k1_gej));
+    if (table->prec == NULL || prec == NULL || precj == NULL) {
+        free(precj);
+        free(prec);
+        secp256k1_ecmult_fixed_table_destroy(table);
+        return NULL;
+    }
+
+    /* The same nothing-up-my-sleeve point secp256k1_ecmult_gen_context_build uses. */
+    {
+        static const unsigned char nums_b32[33] = "The scalar for this x is unknown";
+        secp256k1_fe nums_x;
+        secp256k1_ge nums_ge;
+        int r;
+        r = secp256k1_fe_set_b32(&nums_x, nums_b32);
+        (void)r;
+        VERIFY_CHECK(r);
+        r = secp256k1_ge_set_xo_var(&nums_ge, &nums_x, 0);
+        (void)r;
+        VERIFY_CHECK(r);
+        secp256k1_gej_set_ge(&nums_gej, &nums_ge);
+        secp256k1_gej_add_ge_var(&nums_gej, &nums_gej, &secp256k1_ge_const_g, NULL);
+    }
+
+    secp256k1_gej_set_ge(&pbase, &p); /* 2^(window*j) * P */
+    numsbase = nums_gej; /* 2^j * nums */
+    for (j = 0; j < table->nwindows; j++) {
+        secp256k1_gej *row = &precj[j * rowlen];
+        row[0] = numsbase;
+        for (i = 1; i < rowlen; i++) {
+            secp256k1_gej_add_var(&row[i], &row[i - 1], &pbase, NULL);
+        }
+        for (i = 0; i < (size_t)window; i++) {
+            secp256k1_gej_double_var(&pbase, &pbase, NULL);
+        }
+        secp256k1_gej_double_var(&numsbase, &numsbase, NULL);
+        if (j == table->nwindows - 2) {
+            /* In the last window, numsbase is (1 - 2^j) * nums instead. */
+            secp256k1_gej_neg(&numsbase, &numsbase);
+            secp256k1_gej_add_var(&numsbase, &numsbase, &nums_gej, NULL);
+        }
+    }
+    secp256k1_ge_set_all_gej_var(prec, precj, count, &ctx->error_callback);
+    for (i = 0; i < count; i++) {
+        /* Only a key chosen as a known multiple of nums can put an entry
+         * at infinity, which the constant-time addition cannot take. */
+        ok &= !secp256k1_ge_is_infinity(&prec[i]);
+        secp256k1_ge_to_storage(&table->prec[i], &prec[i]);
+    }
+    free(precj);
+    free(prec);
+    if (!ok) {
+        secp256k1_ecmult_fixed_table_destroy(table);
+        return NULL;
+    }
+    return table;
+}
+
+void secp256k1_ecmult_fixed_table_destroy(secp256k1_ecmult_fixed_table* table) {
+    if (table == NULL) {
+        return;
+    }
+    free(table->prec);
+    free(table);
+}
+
+/** Set r to q times the table's point, in constant time. */
+static void secp256k1_ecmult_fixed_table_mul(const secp256k1_ecmult_fixed_table *table, secp256k1_gej *r, const secp256k1_scalar *q) {
+    secp256k1_ge add;
+    secp256k1_ge_storage adds;
+    size_t rowlen = (size_t)1 << table->window;
+    size_t i;
+    unsigned int bits, offset, count;
+    int j;
+
+    memset(&adds, 0, sizeof(adds));
+    secp256k1_gej_set_infinity(r);
+    for (j = 0; j < table->nwindows; j++) {
+        /* The last window may be narrower; which bits are read depends only
+         * on j, never on the scalar. */
+        offset = j * table->window;
+        count = 256 - offset < (unsigned int)table->window ? 256 - offset : (unsigned int)table->window;
+        bits = secp256k1_scalar_get_bits_var(q, offset, count);
+        for (i = 0; i < rowlen; i++) {
+            /* As in secp256k1_ecmult_gen, no secret data is used as an index. */
+            secp256k1_ge_storage_cmov(&adds, &table->prec[j * rowlen + i], i == bits);
+        }
+        secp256k1_ge_from_storage(&add, &adds);
+        secp256k1_gej_add_ge(r, r, &add);
+    }
+    bits = 0;
+    secp256k1_ge_clear(&add);
+}
+
+int secp256k1_ec_pubkey_tweak_mul_with_table(const secp256k1_context* ctx, secp256k1_pubkey *pubkey, const secp256k1_ecmult_fixed_table *table, const unsigned char *tweak) {
+    secp256k1_gej r;
+    secp256k1_ge p;
+    secp256k1_scalar factor;
+    int overflow = 0;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(pubkey != NULL);
+    memset(pubkey, 0, sizeof(*pubkey));
+    ARG_CHECK(table != NULL);
+    ARG_CHECK(tweak != NULL);
+
+    secp256k1_scalar_set_b32(&factor, tweak, &overflow);
+    if (overflow || secp256k1_scalar_is_zero(&factor)) {
+        secp256k1_scalar_clear(&factor);
+        return 0;
+    }
+    secp256k1_ecmult_fixed_table_mul(table, &r, &factor);
+    secp256k1_ge_set_gej(&p, &r);
+    secp256k1_pubkey_save(pubkey, &p);
+    secp256k1_ge_clear(&p);
+    secp256k1_gej_clear(&r);
+    secp256k1_scalar_clear(&factor);
+    return 1;
+}
+
+#endif
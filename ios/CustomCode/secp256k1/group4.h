@@ -0,0 +1,38 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef SECP256K1_GROUP4_H
+#define SECP256K1_GROUP4_H
+
+#include "group.h"
+#include "field4.h"
+
+/** Four group elements in affine coordinates, none of them infinity. */
+typedef struct {
+    secp256k1_fe4 x;
+    secp256k1_fe4 y;
+} secp256k1_ge4;
+
+/** Four group elements in jacobian coordinates. */
+typedef struct {
+    secp256k1_fe4 x;
+    secp256k1_fe4 y;
+    secp256k1_fe4 z;
+    int infinity[4];
+} secp256k1_gej4;
+
+/** Set lane l of r to the group element stored in a. */
+static void secp256k1_ge4_set_ge_storage(secp256k1_ge4 *r, int l, const secp256k1_ge_storage *a);
+
+/** Set lane l of r to a. */
+static void secp256k1_gej4_set_gej(secp256k1_gej4 *r, int l, const secp256k1_gej *a);
+
+/** Set r to lane l of a. */
+static void secp256k1_gej4_get_gej(secp256k1_gej *r, const secp256k1_gej4 *a, int l);
+
+/** r = a+b lane by lane, in constant time: the four lanes of secp256k1_gej_add_ge. */
+static void secp256k1_gej4_add_ge(secp256k1_gej4 *r, const secp256k1_gej4 *a, const secp256k1_ge4 *b);
+
+#endif /* SECP256K1_GROUP4_H */
@@ -0,0 +1,96 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef SECP256K1_GROUP4_IMPL_H
+#define SECP256K1_GROUP4_IMPL_H
+
+#include "group4.h"
+#include "field4_impl.h"
+
+static void secp256k1_ge4_set_ge_storage(secp256k1_ge4 *r, int l, const secp256k1_ge_storage *a) {
+    secp256k1_fe4_set_fe_storage(&r->x, l, &a->x);
+    secp256k1_fe4_set_fe_storage(&r->y, l, &a->y);
+}
+
+static void secp256k1_gej4_set_gej(secp256k1_gej4 *r, int l, const secp256k1_gej *a) {
+    secp256k1_fe4_set_fe(&r->x, l, &a->x);
+    secp256k1_fe4_set_fe(&r->y, l, &a->y);
+    secp256k1_fe4_set_fe(&r->z, l, &a->z);
+    r->infinity[l] = a->infinity;
+}
+
+static void secp256k1_gej4_get_gej(secp256k1_gej *r, const secp256k1_gej4 *a, int l) {
+    secp256k1_fe4_get_fe(&r->x, &a->x, l);
+    secp256k1_fe4_get_fe(&r->y, &a->y, l);
+    secp256k1_fe4_get_fe(&r->z, &a->z, l);
+    r->infinity = a->infinity[l];
+}
+
+static void secp256k1_gej4_add_ge(secp256k1_gej4 *r, const secp256k1_gej4 *a, const secp256k1_ge4 *b) {
+    /* Operations and magnitudes follow secp256k1_gej_add_ge step by step; see
+     * there for the derivation. The branch-free flags become one per lane. */
+    static const secp256k1_fe4 fe4_1 = {{{1, 1, 1, 1}}};
+    secp256k1_fe4 zz, u1, u2, s1, s2, t, tt, m, n, q, rr;
+    secp256k1_fe4 m_alt, rr_alt;
+    int a_infinity[4], degenerate[4], not_degenerate[4], rr_zero[4], z_zero[4];
+    int l;
+    for (l = 0; l < 4; l++) {
+        VERIFY_CHECK(a->infinity[l] == 0 || a->infinity[l] == 1);
+        a_infinity[l] = a->infinity[l];
+    }
+
+    secp256k1_fe4_sqr(&zz, &a->z);                      /* z = Z1^2 */
+    secp256k1_fe4_normalize_weak(&u1, &a->x);           /* u1 = U1 = X1*Z2^2 (1) */
+    secp256k1_fe4_mul(&u2, &b->x, &zz);                 /* u2 = U2 = X2*Z1^2 (1) */
+    secp256k1_fe4_normalize_weak(&s1, &a->y);           /* s1 = S1 = Y1*Z2^3 (1) */
+    secp256k1_fe4_mul(&s2, &b->y, &zz);                 /* s2 = Y2*Z1^2 (1) */
+    secp256k1_fe4_mul(&s2, &s2, &a->z);                 /* s2 = S2 = Y2*Z1^3 (1) */
+    secp256k1_fe4_add(&t, &u1, &u2);                    /* t = T = U1+U2 (2) */
+    secp256k1_fe4_add(&m, &s1, &s2);                    /* m = M = S1+S2 (2) */
+    secp256k1_fe4_sqr(&rr, &t);                         /* rr = T^2 (1) */
+    secp256k1_fe4_negate(&m_alt, &u2, 1);               /* Malt = -X2*Z1^2 */
+    secp256k1_fe4_mul(&tt, &u1, &m_alt);                /* tt = -U1*U2 (2) */
+    secp256k1_fe4_add(&rr, &rr, &tt);                   /* rr = R = T^2-U1*U2 (3) */
+    secp256k1_fe4_normalizes_to_zero(degenerate, &m);
+    secp256k1_fe4_normalizes_to_zero(rr_zero, &rr);
+    for (l = 0; l < 4; l++) {
+        degenerate[l] &= rr_zero[l];
+        not_degenerate[l] = !degenerate[l];
+    }
+    secp256k1_fe4_mul_int(&rr_alt, &s1, 2);             /* rr = Y1*Z2^3 - Y2*Z1^3 (2) */
+    secp256k1_fe4_add(&m_alt, &m_alt, &u1);             /* Malt = X1*Z2^2 - X2*Z1^2 */
+
+    secp256k1_fe4_cmov(&rr_alt, &rr, not_degenerate);
+    secp256k1_fe4_cmov(&m_alt, &m, not_degenerate);
+    secp256k1_fe4_sqr(&n, &m_alt);                      /* n = Malt^2 (1) */
+    secp256k1_fe4_mul(&q, &n, &t);                      /* q = Q = T*Malt^2 (1) */
+    secp256k1_fe4_sqr(&n, &n);
+    secp256k1_fe4_cmov(&n, &m, degenerate);             /* n = M^3 * Malt (2) */
+    secp256k1_fe4_sqr(&t, &rr_alt);                     /* t = Ralt^2 (1) */
+    secp256k1_fe4_mul(&r->z, &a->z, &m_alt);            /* r->z = Malt*Z (1) */
+    secp256k1_fe4_normalizes_to_zero(z_zero, &r->z);
+    secp256k1_fe4_mul_int(&r->z, &r->z, 2);             /* r->z = Z3 = 2*Malt*Z (2) */
+    secp256k1_fe4_negate(&q, &q, 1);                    /* q = -Q (2) */
+    secp256k1_fe4_add(&t, &t, &q);                      /* t = Ralt^2-Q (3) */
+    secp256k1_fe4_normalize_weak(&r->x, &t);            /* r->x = Ralt^2-Q (1) */
+    secp256k1_fe4_mul_int(&t, &r->x, 2);                /* t = 2*x3 (2) */
+    secp256k1_fe4_add(&t, &t, &q);                      /* t = 2*x3 - Q: (4) */
+    secp256k1_fe4_mul(&t, &t, &rr_alt);                 /* t = Ralt*(2*x3 - Q) (1) */
+    secp256k1_fe4_add(&t, &t, &n);                      /* t = Ralt*(2*x3 - Q) + M^3*Malt (3) */
+    secp256k1_fe4_negate(&r->y, &t, 3);                 /* r->y = Ralt*(Q - 2x3) - M^3*Malt (4) */
+    secp256k1_fe4_normalize_weak(&r->y, &r->y);
+    secp256k1_fe4_mul_int(&r->x, &r->x, 4);             /* r->x = X3 = 4*(Ralt^2-Q) */
+    secp256k1_fe4_mul_int(&r->y, &r->y, 4);             /* r->y = Y3 = 4*Ralt*(Q - 2x3) - 4*M^3*Malt (4) */
+
+    /** In case a->infinity == 1, replace r with (b->x, b->y, 1). */
+    secp256k1_fe4_cmov(&r->x, &b->x, a_infinity);
+    secp256k1_fe4_cmov(&r->y, &b->y, a_infinity);
+    secp256k1_fe4_cmov(&r->z, &fe4_1, a_infinity);
+    for (l = 0; l < 4; l++) {
+        r->infinity[l] = z_zero[l] * (1 - a_infinity[l]);
+    }
+}
+
+#endif /* SECP256K1_GROUP4_IMPL_H */
@@ -16,10 +16,28 @@ typedef struct {
     size_t bytes;
 } secp256k1_sha256;
 
+/* Select the SHA-256 kernel (portable, x86 SHA-NI or ARMv8 SHA2) used by the functions below. */
+static void secp256k1_sha256_select_transform(void);
+
 static void secp256k1_sha256_initialize(secp256k1_sha256 *hash);
 static void secp256k1_sha256_write(secp256k1_sha256 *hash, const unsigned char *data, size_t size);
 static void secp256k1_sha256_finalize(secp256k1_sha256 *hash, unsigned char *out32);
 
+/* Double SHA-256 of n 64-byte messages (e.g. merkle tree nodes): out receives
+ * n consecutive 32-byte digests. in and out may not overlap. */
+static void secp256k1_sha256d64(unsigned char *out, const unsigned char *in, size_t n);
+
+typedef struct {
+    uint64_t s[8];
+    unsigned char buf[128];
+    uint64_t bytes;
+} secp256k1_sha512;
+
+/* SHA-512/256 (FIPS 180-4): SHA-512 from its own initial state, truncated to 32 bytes. */
+static void secp256k1_sha512_256_initialize(secp256k1_sha512 *hash);
+static void secp256k1_sha512_write(secp256k1_sha512 *hash, const unsigned char *data, size_t size);
+static void secp256k1_sha512_256_finalize(secp256k1_sha512 *hash, unsigned char *out32);
+
 typedef struct {
     secp256k1_sha256 inner, outer;
 } secp256k1_hmac_sha256;
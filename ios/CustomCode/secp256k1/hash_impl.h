@@ -46,7 +46,7 @@ static void secp256k1_sha256_initialize(secp256k1_sha256 *hash) {
 }
 
 /** Perform one SHA-256 transformation, processing 16 big endian 32-bit words. */
-static void secp256k1_sha256_transform(uint32_t* s, const uint32_t* chunk) {
+static void secp256k1_sha256_transform_generic(uint32_t* s, const uint32_t* chunk) {
     uint32_t a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
     uint32_t w0, w1, w2, w3, w4, w5, w6, w7, w8, w9, w10, w11, w12, w13, w14, w15;
 
@@ -128,6 +128,375 @@ static void secp256k1_sha256_transform(uint32_t* s, const uint32_t* chunk) {
     s[7] += h;
 }
 
+#ifdef USE_SHA256_HW
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__clang__) || SECP256K1_GNUC_PREREQ(4,9))
+#define SECP256K1_SHA256_X86 1
+#endif
+#if defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_SHA2))
+/* The SHA2 instructions are part of the target (e.g. every arm64 iOS device),
+ * so no runtime feature detection is needed. */
+#define SECP256K1_SHA256_ARMV8 1
+#endif
+#endif
+
+#if defined(SECP256K1_SHA256_X86) || defined(SECP256K1_SHA256_ARMV8)
+static const uint32_t secp256k1_sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+#endif
+
+#ifdef SECP256K1_SHA256_X86
+#include <cpuid.h>
+#include <immintrin.h>
+
+/* Four rounds: m holds the next four message words, k the matching round constants. */
+#define SHANI_QUAD(s0, s1, m, k) do { \
+    __m128i msg_ = _mm_add_epi32((m), _mm_loadu_si128((const __m128i*)(k))); \
+    (s1) = _mm_sha256rnds2_epu32((s1), (s0), msg_); \
+    (s0) = _mm_sha256rnds2_epu32((s0), (s1), _mm_shuffle_epi32(msg_, 0x0e)); \
+} while(0)
+
+/* Message schedule: msg1 adds sigma0(w[t-15]) to w[t-16] for the next four words... */
+#define SHANI_MSG1(m0, m1) ((m0) = _mm_sha256msg1_epu32((m0), (m1)))
+/* ...and msg2 adds w[t-7] and sigma1(w[t-2]) to finish them. */
+#define SHANI_MSG2(m0, m1, m2) ((m2) = _mm_sha256msg2_epu32(_mm_add_epi32((m2), _mm_alignr_epi8((m1), (m0), 4)), (m1)))
+
+/** secp256k1_sha256_transform_generic using the x86 SHA extensions. */
+__attribute__((target("sha,sse4.1")))
+static void secp256k1_sha256_transform_shani(uint32_t* s, const uint32_t* chunk) {
+    const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    const uint32_t *k = secp256k1_sha256_k;
+    __m128i m0, m1, m2, m3, s0, s1, so0, so1, t1, t2;
+
+    /* The SHA-NI instructions keep the state as ABEF and CDGH. */
+    t1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)s), 0xB1);
+    t2 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(s + 4)), 0x1B);
+    s0 = _mm_alignr_epi8(t1, t2, 0x08);
+    s1 = _mm_blend_epi16(t2, t1, 0xF0);
+    so0 = s0;
+    so1 = s1;
+
+    m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)chunk), mask);
+    m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(chunk + 4)), mask);
+    m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(chunk + 8)), mask);
+    m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(chunk + 12)), mask);
+
+    SHANI_QUAD(s0, s1, m0, k + 0);
+    SHANI_QUAD(s0, s1, m1, k + 4);  SHANI_MSG1(m0, m1);
+    SHANI_QUAD(s0, s1, m2, k + 8);  SHANI_MSG1(m1, m2);
+    SHANI_QUAD(s0, s1, m3, k + 12); SHANI_MSG2(m2, m3, m0); SHANI_MSG1(m2, m3);
+    SHANI_QUAD(s0, s1, m0, k + 16); SHANI_MSG2(m3, m0, m1); SHANI_MSG1(m3, m0);
+    SHANI_QUAD(s0, s1, m1, k + 20); SHANI_MSG2(m0, m1, m2); SHANI_MSG1(m0, m1);
+    SHANI_QUAD(s0, s1, m2, k + 24); SHANI_MSG2(m1, m2, m3); SHANI_MSG1(m1, m2);
+    SHANI_QUAD(s0, s1, m3, k + 28); SHANI_MSG2(m2, m3, m0); SHANI_MSG1(m2, m3);
+    SHANI_QUAD(s0, s1, m0, k + 32); SHANI_MSG2(m3, m0, m1); SHANI_MSG1(m3, m0);
+    SHANI_QUAD(s0, s1, m1, k + 36); SHANI_MSG2(m0, m1, m2); SHANI_MSG1(m0, m1);
+    SHANI_QUAD(s0, s1, m2, k + 40); SHANI_MSG2(m1, m2, m3); SHANI_MSG1(m1, m2);
+    SHANI_QUAD(s0, s1, m3, k + 44); SHANI_MSG2(m2, m3, m0); SHANI_MSG1(m2, m3);
+    SHANI_QUAD(s0, s1, m0, k + 48); SHANI_MSG2(m3, m0, m1); SHANI_MSG1(m3, m0);
+    SHANI_QUAD(s0, s1, m1, k + 52); SHANI_MSG2(m0, m1, m2);
+    SHANI_QUAD(s0, s1, m2, k + 56); SHANI_MSG2(m1, m2, m3);
+    SHANI_QUAD(s0, s1, m3, k + 60);
+
+    s0 = _mm_add_epi32(s0, so0);
+    s1 = _mm_add_epi32(s1, so1);
+    t1 = _mm_shuffle_epi32(s0, 0x1B);
+    t2 = _mm_shuffle_epi32(s1, 0xB1);
+    _mm_storeu_si128((__m128i*)s, _mm_blend_epi16(t1, t2, 0xF0));
+    _mm_storeu_si128((__m128i*)(s + 4), _mm_alignr_epi8(t2, t1, 0x08));
+}
+
+#undef SHANI_MSG2
+#undef SHANI_MSG1
+#undef SHANI_QUAD
+
+static int secp256k1_sha256_have_shani(void) {
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_max(0, NULL) < 7) {
+        return 0;
+    }
+    __cpuid(1, eax, ebx, ecx, edx);
+    if (!((ecx >> 19) & 1)) { /* SSE4.1 */
+        return 0;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return (ebx >> 29) & 1; /* SHA */
+}
+
+/* Eight independent SHA-256 computations side by side, one per 32-bit lane
+ * of an AVX2 register. Used for batches of 64-byte double hashes when there
+ * is no single-message hardware kernel. */
+#define AVX2_ROR(x, n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+#define AVX2_ADD3(x, y, z) _mm256_add_epi32(_mm256_add_epi32((x), (y)), (z))
+#define AVX2_ROUND(a, b, c, d, e, f, g, h, kw) do { \
+    __m256i t1_ = AVX2_ADD3((h), _mm256_xor_si256(_mm256_xor_si256(AVX2_ROR((e), 6), AVX2_ROR((e), 11)), AVX2_ROR((e), 25)), \
+        _mm256_add_epi32(_mm256_xor_si256((g), _mm256_and_si256((e), _mm256_xor_si256((f), (g)))), (kw))); \
+    __m256i t2_ = _mm256_add_epi32(_mm256_xor_si256(_mm256_xor_si256(AVX2_ROR((a), 2), AVX2_ROR((a), 13)), AVX2_ROR((a), 22)), \
+        _mm256_or_si256(_mm256_and_si256((a), (b)), _mm256_and_si256((c), _mm256_or_si256((a), (b))))); \
+    (d) = _mm256_add_epi32((d), t1_); \
+    (h) = _mm256_add_epi32(t1_, t2_); \
+} while(0)
+
+__attribute__((target("avx2")))
+static void secp256k1_sha256_transform_avx2(__m256i *s, __m256i *w) {
+    __m256i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+    int i, j;
+
+    for (i = 0; i < 64; i += 8) {
+        if (i >= 16) {
+            /* Extend the message schedule by eight words. */
+            for (j = i; j < i + 8; j++) {
+                __m256i w15 = w[(j - 15) & 15], w2 = w[(j - 2) & 15];
+                __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(AVX2_ROR(w15, 7), AVX2_ROR(w15, 18)), _mm256_srli_epi32(w15, 3));
+                __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(AVX2_ROR(w2, 17), AVX2_ROR(w2, 19)), _mm256_srli_epi32(w2, 10));
+                w[j & 15] = _mm256_add_epi32(AVX2_ADD3(w[j & 15], s0, s1), w[(j - 7) & 15]);
+            }
+        }
+#define AVX2_KW(n) _mm256_add_epi32(_mm256_set1_epi32(secp256k1_sha256_k[i + (n)]), w[(i + (n)) & 15])
+        AVX2_ROUND(a, b, c, d, e, f, g, h, AVX2_KW(0));
+        AVX2_ROUND(h, a, b, c, d, e, f, g, AVX2_KW(1));
+        AVX2_ROUND(g, h, a, b, c, d, e, f, AVX2_KW(2));
+        AVX2_ROUND(f, g, h, a, b, c, d, e, AVX2_KW(3));
+        AVX2_ROUND(e, f, g, h, a, b, c, d, AVX2_KW(4));
+        AVX2_ROUND(d, e, f, g, h, a, b, c, AVX2_KW(5));
+        AVX2_ROUND(c, d, e, f, g, h, a, b, AVX2_KW(6));
+        AVX2_ROUND(b, c, d, e, f, g, h, a, AVX2_KW(7));
+#undef AVX2_KW
+    }
+
+    s[0] = _mm256_add_epi32(s[0], a);
+    s[1] = _mm256_add_epi32(s[1], b);
+    s[2] = _mm256_add_epi32(s[2], c);
+    s[3] = _mm256_add_epi32(s[3], d);
+    s[4] = _mm256_add_epi32(s[4], e);
+    s[5] = _mm256_add_epi32(s[5], f);
+    s[6] = _mm256_add_epi32(s[6], g);
+    s[7] = _mm256_add_epi32(s[7], h);
+}
+
+#undef AVX2_ROUND
+#undef AVX2_ADD3
+#undef AVX2_ROR
+
+static SECP256K1_INLINE uint32_t secp256k1_sha256_read_be32(const unsigned char *p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+/** Eight 64-byte double hashes: in and out point at 8*64 and 8*32 bytes. */
+__attribute__((target("avx2")))
+static void secp256k1_sha256d64_avx2(unsigned char *out, const unsigned char *in) {
+    static const uint32_t iv[8] = {
+        0x6a09e667ul, 0xbb67ae85ul, 0x3c6ef372ul, 0xa54ff53aul, 0x510e527ful, 0x9b05688cul, 0x1f83d9abul, 0x5be0cd19ul
+    };
+    __m256i s[8], t[8], w[16];
+    uint32_t lanes[8];
+    int i, j;
+
+    for (i = 0; i < 8; i++) {
+        s[i] = _mm256_set1_epi32(iv[i]);
+        t[i] = s[i];
+    }
+    for (i = 0; i < 16; i++) {
+        w[i] = _mm256_set_epi32(secp256k1_sha256_read_be32(in + 448 + 4 * i), secp256k1_sha256_read_be32(in + 384 + 4 * i),
+                                secp256k1_sha256_read_be32(in + 320 + 4 * i), secp256k1_sha256_read_be32(in + 256 + 4 * i),
+                                secp256k1_sha256_read_be32(in + 192 + 4 * i), secp256k1_sha256_read_be32(in + 128 + 4 * i),
+                                secp256k1_sha256_read_be32(in + 64 + 4 * i), secp256k1_sha256_read_be32(in + 4 * i));
+    }
+    secp256k1_sha256_transform_avx2(s, w);
+
+    /* Padding block of a 64-byte message. */
+    w[0] = _mm256_set1_epi32(0x80000000);
+    for (i = 1; i < 15; i++) {
+        w[i] = _mm256_setzero_si256();
+    }
+    w[15] = _mm256_set1_epi32(512);
+    secp256k1_sha256_transform_avx2(s, w);
+
+    /* Hash the 32-byte digests, padded to one block. */
+    for (i = 0; i < 8; i++) {
+        w[i] = s[i];
+    }
+    w[8] = _mm256_set1_epi32(0x80000000);
+    for (i = 9; i < 15; i++) {
+        w[i] = _mm256_setzero_si256();
+    }
+    w[15] = _mm256_set1_epi32(256);
+    secp256k1_sha256_transform_avx2(t, w);
+
+    for (i = 0; i < 8; i++) {
+        _mm256_storeu_si256((__m256i*)lanes, t[i]);
+        for (j = 0; j < 8; j++) {
+            unsigned char *p = out + 32 * j + 4 * i;
+            p[0] = lanes[j] >> 24;
+            p[1] = lanes[j] >> 16;
+            p[2] = lanes[j] >> 8;
+            p[3] = lanes[j];
+        }
+    }
+}
+
+static int secp256k1_sha256_have_avx2(void) {
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_max(0, NULL) < 7) {
+        return 0;
+    }
+    __cpuid(1, eax, ebx, ecx, edx);
+    if (!((ecx >> 27) & 1)) { /* OSXSAVE */
+        return 0;
+    }
+    /* The OS must save the YMM registers on context switches. */
+    __asm__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    if ((eax & 6) != 6) {
+        return 0;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return (ebx >> 5) & 1; /* AVX2 */
+}
+#endif
+
+#ifdef SECP256K1_SHA256_ARMV8
+#include <arm_neon.h>
+
+/* Four rounds; if su is set, also extend the message schedule by four words into m0. */
+#define ARMV8_QUAD(abcd, efgh, m0, m1, m2, m3, k, su) do { \
+    uint32x4_t wk_ = vaddq_u32((m0), vld1q_u32(k)); \
+    uint32x4_t abcd_ = (abcd); \
+    if (su) (m0) = vsha256su0q_u32((m0), (m1)); \
+    (abcd) = vsha256hq_u32((abcd), (efgh), wk_); \
+    (efgh) = vsha256h2q_u32((efgh), abcd_, wk_); \
+    if (su) (m0) = vsha256su1q_u32((m0), (m2), (m3)); \
+} while(0)
+
+/** secp256k1_sha256_transform_generic using the ARMv8 SHA2 instructions. */
+static void secp256k1_sha256_transform_armv8(uint32_t* s, const uint32_t* chunk) {
+    const uint32_t *k = secp256k1_sha256_k;
+    uint32x4_t abcd, efgh, m0, m1, m2, m3;
+
+    abcd = vld1q_u32(s);
+    efgh = vld1q_u32(s + 4);
+    m0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8((const uint8_t*)chunk)));
+    m1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8((const uint8_t*)(chunk + 4))));
+    m2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8((const uint8_t*)(chunk + 8))));
+    m3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8((const uint8_t*)(chunk + 12))));
+
+    ARMV8_QUAD(abcd, efgh, m0, m1, m2, m3, k + 0, 1);
+    ARMV8_QUAD(abcd, efgh, m1, m2, m3, m0, k + 4, 1);
+    ARMV8_QUAD(abcd, efgh, m2, m3, m0, m1, k + 8, 1);
+    ARMV8_QUAD(abcd, efgh, m3, m0, m1, m2, k + 12, 1);
+    ARMV8_QUAD(abcd, efgh, m0, m1, m2, m3, k + 16, 1);
+    ARMV8_QUAD(abcd, efgh, m1, m2, m3, m0, k + 20, 1);
+    ARMV8_QUAD(abcd, efgh, m2, m3, m0, m1, k + 24, 1);
+    ARMV8_QUAD(abcd, efgh, m3, m0, m1, m2, k + 28, 1);
+    ARMV8_QUAD(abcd, efgh, m0, m1, m2, m3, k + 32, 1);
+    ARMV8_QUAD(abcd, efgh, m1, m2, m3, m0, k + 36, 1);
+    ARMV8_QUAD(abcd, efgh, m2, m3, m0, m1, k + 40, 1);
+    ARMV8_QUAD(abcd, efgh, m3, m0, m1, m2, k + 44, 1);
+    ARMV8_QUAD(abcd, efgh, m0, m1, m2, m3, k + 48, 0);
+    ARMV8_QUAD(abcd, efgh, m1, m2, m3, m0, k + 52, 0);
+    ARMV8_QUAD(abcd, efgh, m2, m3, m0, m1, k + 56, 0);
+    ARMV8_QUAD(abcd, efgh, m3, m0, m1, m2, k + 60, 0);
+
+    vst1q_u32(s, vaddq_u32(abcd, vld1q_u32(s)));
+    vst1q_u32(s + 4, vaddq_u32(efgh, vld1q_u32(s + 4)));
+}
+
+#undef ARMV8_QUAD
+#endif
+
+/** The transform used by secp256k1_sha256_write. Starts out as the portable
+ *  one; secp256k1_sha256_select_transform may switch it to a hardware kernel. */
+static void (*secp256k1_sha256_transform)(uint32_t* s, const uint32_t* chunk) = secp256k1_sha256_transform_generic;
+
+#if defined(SECP256K1_SHA256_X86) || defined(SECP256K1_SHA256_ARMV8)
+/** Check a candidate transform against the portable one on the padded
+ *  message "abc" and on a second chained block. */
+static int secp256k1_sha256_transform_selftest(void (*transform)(uint32_t* s, const uint32_t* chunk)) {
+    static const uint32_t abc[8] = {
+        0xba7816bf, 0x8f01cfea, 0x414140de, 0x5dae2223, 0xb00361a3, 0x96177a9c, 0xb410ff61, 0xf20015ad
+    };
+    secp256k1_sha256 a, b;
+    uint32_t block[16];
+    unsigned char *bytes = (unsigned char*)block;
+    int i;
+
+    memset(block, 0, sizeof(block));
+    bytes[0] = 'a';
+    bytes[1] = 'b';
+    bytes[2] = 'c';
+    bytes[3] = 0x80;
+    bytes[63] = 24;
+    secp256k1_sha256_initialize(&a);
+    transform(a.s, block);
+    if (memcmp(a.s, abc, sizeof(abc)) != 0) {
+        return 0;
+    }
+    for (i = 0; i < 64; i++) {
+        bytes[i] = (unsigned char)(i * 37 + 11);
+    }
+    b = a;
+    secp256k1_sha256_transform_generic(a.s, block);
+    transform(b.s, block);
+    return memcmp(a.s, b.s, sizeof(a.s)) == 0;
+}
+#endif
+
+#ifdef SECP256K1_SHA256_X86
+static int secp256k1_sha256d64_use_avx2 = 0;
+
+/** Check the AVX2 batch kernel against the one-at-a-time code. */
+static int secp256k1_sha256d64_selftest(void) {
+    unsigned char in[512], out[256], ref[32];
+    secp256k1_sha256 sha;
+    int i;
+    for (i = 0; i < 512; i++) {
+        in[i] = (unsigned char)(i * 101 + 7);
+    }
+    secp256k1_sha256d64_avx2(out, in);
+    for (i = 0; i < 8; i++) {
+        secp256k1_sha256_initialize(&sha);
+        secp256k1_sha256_write(&sha, in + 64 * i, 64);
+        secp256k1_sha256_finalize(&sha, ref);
+        secp256k1_sha256_initialize(&sha);
+        secp256k1_sha256_write(&sha, ref, 32);
+        secp256k1_sha256_finalize(&sha, ref);
+        if (memcmp(ref, out + 32 * i, 32) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+#endif
+
+/** Pick the fastest SHA-256 transform the CPU supports and passes the self
+ *  test. Called on context creation; every call picks the same kernel, so
+ *  concurrent calls are harmless. */
+static void secp256k1_sha256_select_transform(void) {
+    void (*transform)(uint32_t* s, const uint32_t* chunk) = secp256k1_sha256_transform_generic;
+#ifdef SECP256K1_SHA256_X86
+    if (secp256k1_sha256_have_shani() && secp256k1_sha256_transform_selftest(secp256k1_sha256_transform_shani)) {
+        transform = secp256k1_sha256_transform_shani;
+    }
+#endif
+#ifdef SECP256K1_SHA256_ARMV8
+    if (secp256k1_sha256_transform_selftest(secp256k1_sha256_transform_armv8)) {
+        transform = secp256k1_sha256_transform_armv8;
+    }
+#endif
+    secp256k1_sha256_transform = transform;
+#ifdef SECP256K1_SHA256_X86
+    /* Eight AVX2 lanes are no faster than one SHA-NI lane, so only use them without it. */
+    secp256k1_sha256d64_use_avx2 = transform == secp256k1_sha256_transform_generic && secp256k1_sha256_have_avx2() &&
+                                   secp256k1_sha256d64_selftest();
+#endif
+}
+
 static void secp256k1_sha256_write(secp256k1_sha256 *hash, const unsigned char *data, size_t len) {
     size_t bufsize = hash->bytes & 0x3F;
     hash->bytes += len;
@@ -162,6 +531,136 @@ static void secp256k1_sha256_finalize(secp256k1_sha256 *hash, unsigned char *out
     memcpy(out32, (const unsigned char*)out, 32);
 }
 
+static void secp256k1_sha256d64(unsigned char *out, const unsigned char *in, size_t n) {
+    secp256k1_sha256 sha;
+    unsigned char tmp[32];
+#ifdef SECP256K1_SHA256_X86
+    if (secp256k1_sha256d64_use_avx2) {
+        for (; n >= 8; n -= 8, in += 512, out += 256) {
+            secp256k1_sha256d64_avx2(out, in);
+        }
+    }
+#endif
+    for (; n > 0; n--, in += 64, out += 32) {
+        secp256k1_sha256_initialize(&sha);
+        secp256k1_sha256_write(&sha, in, 64);
+        secp256k1_sha256_finalize(&sha, tmp);
+        secp256k1_sha256_initialize(&sha);
+        secp256k1_sha256_write(&sha, tmp, 32);
+        secp256k1_sha256_finalize(&sha, out);
+    }
+}
+
+static const uint64_t secp256k1_sha512_k[80] = {
+    0x428a2f98d728ae22ull, 0x7137449123ef65cdull, 0xb5c0fbcfec4d3b2full, 0xe9b5dba58189dbbcull,
+    0x3956c25bf348b538ull, 0x59f111f1b605d019ull, 0x923f82a4af194f9bull, 0xab1c5ed5da6d8118ull,
+    0xd807aa98a3030242ull, 0x12835b0145706fbeull, 0x243185be4ee4b28cull, 0x550c7dc3d5ffb4e2ull,
+    0x72be5d74f27b896full, 0x80deb1fe3b1696b1ull, 0x9bdc06a725c71235ull, 0xc19bf174cf692694ull,
+    0xe49b69c19ef14ad2ull, 0xefbe4786384f25e3ull, 0x0fc19dc68b8cd5b5ull, 0x240ca1cc77ac9c65ull,
+    0x2de92c6f592b0275ull, 0x4a7484aa6ea6e483ull, 0x5cb0a9dcbd41fbd4ull, 0x76f988da831153b5ull,
+    0x983e5152ee66dfabull, 0xa831c66d2db43210ull, 0xb00327c898fb213full, 0xbf597fc7beef0ee4ull,
+    0xc6e00bf33da88fc2ull, 0xd5a79147930aa725ull, 0x06ca6351e003826full, 0x142929670a0e6e70ull,
+    0x27b70a8546d22ffcull, 0x2e1b21385c26c926ull, 0x4d2c6dfc5ac42aedull, 0x53380d139d95b3dfull,
+    0x650a73548baf63deull, 0x766a0abb3c77b2a8ull, 0x81c2c92e47edaee6ull, 0x92722c851482353bull,
+    0xa2bfe8a14cf10364ull, 0xa81a664bbc423001ull, 0xc24b8b70d0f89791ull, 0xc76c51a30654be30ull,
+    0xd192e819d6ef5218ull, 0xd69906245565a910ull, 0xf40e35855771202aull, 0x106aa07032bbd1b8ull,
+    0x19a4c116b8d2d0c8ull, 0x1e376c085141ab53ull, 0x2748774cdf8eeb99ull, 0x34b0bcb5e19b48a8ull,
+    0x391c0cb3c5c95a63ull, 0x4ed8aa4ae3418acbull, 0x5b9cca4f7763e373ull, 0x682e6ff3d6b2b8a3ull,
+    0x748f82ee5defb2fcull, 0x78a5636f43172f60ull, 0x84c87814a1f0ab72ull, 0x8cc702081a6439ecull,
+    0x90befffa23631e28ull, 0xa4506cebde82bde9ull, 0xbef9a3f7b2c67915ull, 0xc67178f2e372532bull,
+    0xca273eceea26619cull, 0xd186b8c721c0c207ull, 0xeada7dd6cde0eb1eull, 0xf57d4f7fee6ed178ull,
+    0x06f067aa72176fbaull, 0x0a637dc5a2c898a6ull, 0x113f9804bef90daeull, 0x1b710b35131c471bull,
+    0x28db77f523047d84ull, 0x32caab7b40c72493ull, 0x3c9ebe0a15c9bebcull, 0x431d67c49c100d4cull,
+    0x4cc5d4becb3e42b6ull, 0x597f299cfc657e2aull, 0x5fcb6fab3ad6faecull, 0x6c44198c4a475817ull
+};
+
+#define ROTR64(x,n) ((x) >> (n) | (x) << (64 - (n)))
+
+/** Perform one SHA-512 transformation, processing a 128-byte block. */
+static void secp256k1_sha512_transform(uint64_t* s, const unsigned char* chunk) {
+    uint64_t w[16];
+    uint64_t a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+    int i, j;
+
+    for (i = 0; i < 80; i++) {
+        uint64_t t1, t2;
+        if (i < 16) {
+            w[i] = 0;
+            for (j = 0; j < 8; j++) {
+                w[i] = (w[i] << 8) | chunk[8 * i + j];
+            }
+        } else {
+            uint64_t w1 = w[(i + 1) & 15], w14 = w[(i + 14) & 15];
+            w[i & 15] += (ROTR64(w1, 1) ^ ROTR64(w1, 8) ^ (w1 >> 7)) + w[(i + 9) & 15] +
+                         (ROTR64(w14, 19) ^ ROTR64(w14, 61) ^ (w14 >> 6));
+        }
+        t1 = h + (ROTR64(e, 14) ^ ROTR64(e, 18) ^ ROTR64(e, 41)) + Ch(e, f, g) + secp256k1_sha512_k[i] + w[i & 15];
+        t2 = (ROTR64(a, 28) ^ ROTR64(a, 34) ^ ROTR64(a, 39)) + Maj(a, b, c);
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+
+    s[0] += a;
+    s[1] += b;
+    s[2] += c;
+    s[3] += d;
+    s[4] += e;
+    s[5] += f;
+    s[6] += g;
+    s[7] += h;
+}
+
+#undef ROTR64
+
+static void secp256k1_sha512_256_initialize(secp256k1_sha512 *hash) {
+    hash->s[0] = 0x22312194fc2bf72cull;
+    hash->s[1] = 0x9f555fa3c84c64c2ull;
+    hash->s[2] = 0x2393b86b6f53b151ull;
+    hash->s[3] = 0x963877195940eabdull;
+    hash->s[4] = 0x96283ee2a88effe3ull;
+    hash->s[5] = 0xbe5e1e2553863992ull;
+    hash->s[6] = 0x2b0199fc2c85b8aaull;
+    hash->s[7] = 0x0eb72ddc81c52ca2ull;
+    hash->bytes = 0;
+}
+
+static void secp256k1_sha512_write(secp256k1_sha512 *hash, const unsigned char *data, size_t len) {
+    size_t bufsize = hash->bytes & 0x7F;
+    hash->bytes += len;
+    while (bufsize + len >= 128) {
+        /* Fill the buffer, and process it. */
+        size_t chunk_len = 128 - bufsize;
+        memcpy(hash->buf + bufsize, data, chunk_len);
+        data += chunk_len;
+        len -= chunk_len;
+        secp256k1_sha512_transform(hash->s, hash->buf);
+        bufsize = 0;
+    }
+    if (len) {
+        /* Fill the buffer with what remains. */
+        memcpy(hash->buf + bufsize, data, len);
+    }
+}
+
+static void secp256k1_sha512_256_finalize(secp256k1_sha512 *hash, unsigned char *out32) {
+    static const unsigned char pad[128] = {0x80};
+    unsigned char sizedesc[16] = {0};
+    uint64_t bits = hash->bytes << 3;
+    int i;
+    for (i = 0; i < 8; i++) {
+        sizedesc[15 - i] = (unsigned char)(bits >> (8 * i));
+    }
+    sizedesc[7] = (unsigned char)(hash->bytes >> 61);
+    secp256k1_sha512_write(hash, pad, 1 + ((239 - (hash->bytes % 128)) % 128));
+    secp256k1_sha512_write(hash, sizedesc, 16);
+    for (i = 0; i < 32; i++) {
+        out32[i] = (unsigned char)(hash->s[i / 8] >> (56 - 8 * (i % 8)));
+    }
+    for (i = 0; i < 8; i++) {
+        hash->s[i] = 0;
+    }
+}
+
 static void secp256k1_hmac_sha256_initialize(secp256k1_hmac_sha256 *hash, const unsigned char *key, size_t keylen) {
     size_t n;
     unsigned char rkey[64];
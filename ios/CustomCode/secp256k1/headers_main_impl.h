@@ -0,0 +1,236 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef SECP256K1_MODULE_HEADERS_MAIN
+#define SECP256K1_MODULE_HEADERS_MAIN
+
+#include "secp256k1_headers.h"
+
+#define SECP256K1_HEADER_SIZE 80
+#define SECP256K1_HEADERS_MAX_BITS 0x1d00ffffu
+
+/* Block targets are 256-bit integers, held here as nine little endian 32-bit
+ * limbs so that the DAA's intermediate product cannot overflow. */
+typedef struct {
+    uint32_t d[9];
+} secp256k1_headers_target;
+
+static int secp256k1_headers_target_bits(const secp256k1_headers_target *t) {
+    int i, bits;
+    for (i = 8; i >= 0; i--) {
+        if (t->d[i]) {
+            bits = 32;
+            while (!(t->d[i] >> (bits - 1))) {
+                bits--;
+            }
+            return 32 * i + bits;
+        }
+    }
+    return 0;
+}
+
+static void secp256k1_headers_target_shift(secp256k1_headers_target *t, int shift) {
+    secp256k1_headers_target r;
+    int i;
+    memset(&r, 0, sizeof(r));
+    for (i = 0; i < 9; i++) {
+        /* Bit b of t lands at bit b + shift of r. */
+        int lo = 32 * i + shift;
+        if (lo > -32 && lo < 288) {
+            if (lo >= 0) {
+                r.d[lo / 32] |= t->d[i] << (lo % 32);
+                if (lo % 32 && lo / 32 < 8) {
+                    r.d[lo / 32 + 1] |= t->d[i] >> (32 - lo % 32);
+                }
+            } else {
+                r.d[0] |= t->d[i] >> -lo;
+            }
+        }
+    }
+    *t = r;
+}
+
+/** arith_uint256::SetCompact. Returns 0 if the target is negative or overflows. */
+static int secp256k1_headers_set_compact(secp256k1_headers_target *t, uint32_t compact) {
+    int size = compact >> 24;
+    uint32_t word = compact & 0x007fffff;
+    memset(t, 0, sizeof(*t));
+    if (size <= 3) {
+        word >>= 8 * (3 - size);
+    }
+    if (word != 0 && (compact & 0x00800000)) {
+        return 0;
+    }
+    if (word != 0 && (size > 34 || (word > 0xff && size > 33) || (word > 0xffff && size > 32))) {
+        return 0;
+    }
+    t->d[0] = word;
+    if (size > 3) {
+        secp256k1_headers_target_shift(t, 8 * (size - 3));
+    }
+    return 1;
+}
+
+/** arith_uint256::GetCompact, for targets below 2^256. */
+static uint32_t secp256k1_headers_get_compact(const secp256k1_headers_target *t) {
+    secp256k1_headers_target tmp = *t;
+    int size = (secp256k1_headers_target_bits(t) + 7) / 8;
+    uint32_t compact;
+    secp256k1_headers_target_shift(&tmp, -8 * (size - 3));
+    compact = tmp.d[0] & 0x00ffffff;
+    if (compact & 0x00800000) {
+        compact >>= 8;
+        size++;
+    }
+    return compact | ((uint32_t)size << 24);
+}
+
+/** The ASERTi3-2d next_bits_aserti3_2d from electroncash/asert_daa.py.
+ *  Returns 0 for the inputs it rejects. */
+static int secp256k1_headers_asert_bits(uint32_t *bits, uint32_t anchor_bits, int64_t time_diff, int64_t height_diff, int64_t half_life) {
+    secp256k1_headers_target t;
+    int64_t exponent, shifts, span;
+    uint64_t frac, factor, carry = 0;
+    int i;
+
+    span = time_diff - 300 * (height_diff + 1);
+    if (span <= -((int64_t)1 << 47) || span >= ((int64_t)1 << 47)) {
+        return 0;
+    }
+    /* asert_daa.py only takes anchor targets of at most 2^232, normalized. */
+    if ((anchor_bits >> 24) > 0x1d || (anchor_bits & 0x00ffffff) < 0x8000 || (anchor_bits & 0x00ffffff) > 0x7fffff) {
+        return 0;
+    }
+    secp256k1_headers_set_compact(&t, anchor_bits);
+    exponent = span * 65536 / half_life;
+    /* Floor division, so that frac is in [0, 65536). */
+    shifts = exponent >= 0 ? exponent / 65536 : -((65535 - exponent) / 65536);
+    frac = (uint64_t)(exponent - shifts * 65536);
+    factor = 65536 + ((195766423245049ull * frac + 971821376ull * frac * frac + 5127ull * frac * frac * frac + (1ull << 47)) >> 48);
+
+    for (i = 0; i < 9; i++) {
+        carry += (uint64_t)t.d[i] * factor;
+        t.d[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    /* Multiply by 2^shifts and drop the 2^16 the factor carries. Anything
+     * longer than 224 bits will be clamped below, so avoid overflowing. */
+    shifts -= 16;
+    if (shifts > 0 && secp256k1_headers_target_bits(&t) + shifts > 224) {
+        *bits = SECP256K1_HEADERS_MAX_BITS;
+        return 1;
+    }
+    if (shifts <= -288) {
+        memset(&t, 0, sizeof(t));
+    } else {
+        secp256k1_headers_target_shift(&t, (int)shifts);
+    }
+
+    if (secp256k1_headers_target_bits(&t) == 0) {
+        t.d[0] = 1;
+    } else if (secp256k1_headers_target_bits(&t) > 224) {
+        *bits = SECP256K1_HEADERS_MAX_BITS;
+        return 1;
+    }
+    *bits = secp256k1_headers_get_compact(&t);
+    return 1;
+}
+
+/** Is the hash, a little endian number, at most the target? */
+static int secp256k1_headers_check_pow(const unsigned char *hash32, const secp256k1_headers_target *target) {
+    int i;
+    for (i = 31; i >= 0; i--) {
+        unsigned int byte = (target->d[i / 4] >> (8 * (i % 4))) & 0xFF;
+        if (hash32[i] != byte) {
+            return hash32[i] < byte;
+        }
+    }
+    return 1;
+}
+
+static uint32_t secp256k1_headers_read_le32(const unsigned char *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+/** The median of the last 11 timestamps, like Blockchain.get_median_time_past. */
+static uint32_t secp256k1_headers_median_time(const uint32_t *times) {
+    uint32_t sorted[11];
+    int i, j;
+    for (i = 0; i < 11; i++) {
+        uint32_t v = times[i];
+        for (j = i; j > 0 && sorted[j - 1] > v; j--) {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = v;
+    }
+    return sorted[5];
+}
+
+int secp256k1_headers_verify_chunk(const secp256k1_context* ctx, size_t *nverified, const unsigned char *chunk, size_t n, int64_t height, const unsigned char *prev_hash32, const uint32_t *prev_times, int64_t asert_activation_mtp, int64_t asert_half_life, int64_t asert_anchor_height, uint32_t asert_anchor_bits, int64_t asert_anchor_prev_time, int64_t checkpoint_height, const unsigned char *checkpoint_hash32, unsigned int flags) {
+    secp256k1_sha512 sha;
+    secp256k1_headers_target target;
+    unsigned char prev_hash[32], hash[32];
+    uint32_t times[11];
+    size_t i;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(nverified != NULL);
+    *nverified = 0;
+    ARG_CHECK(chunk != NULL || n == 0);
+    ARG_CHECK(height >= 11);
+    ARG_CHECK(prev_hash32 != NULL);
+    ARG_CHECK(prev_times != NULL);
+    ARG_CHECK(asert_half_life > 0);
+    ARG_CHECK(checkpoint_hash32 != NULL || checkpoint_height == -1);
+
+    memcpy(prev_hash, prev_hash32, 32);
+    memcpy(times, prev_times, sizeof(times));
+    for (i = 0; i < n; i++, chunk += SECP256K1_HEADER_SIZE) {
+        const int64_t h = height + (int64_t)i;
+        const uint32_t time = secp256k1_headers_read_le32(chunk + 68);
+        const uint32_t header_bits = secp256k1_headers_read_le32(chunk + 72);
+        uint32_t bits;
+
+        if (memcmp(chunk + 4, prev_hash, 32) != 0) {
+            return 0;
+        }
+        /* Before activation the legacy DAA rules apply; leave those to the caller. */
+        if ((int64_t)secp256k1_headers_median_time(times) < asert_activation_mtp) {
+            return 0;
+        }
+        if ((flags & SECP256K1_HEADERS_TESTNET_RULE) && (int64_t)time - times[10] > 20 * 60) {
+            bits = SECP256K1_HEADERS_MAX_BITS;
+        } else if (!secp256k1_headers_asert_bits(&bits, asert_anchor_bits, (int64_t)times[10] - asert_anchor_prev_time,
+                                                 h - 1 - asert_anchor_height, asert_half_life)) {
+            return 0;
+        }
+        if (bits != header_bits || !secp256k1_headers_set_compact(&target, bits)) {
+            return 0;
+        }
+
+        secp256k1_sha512_256_initialize(&sha);
+        secp256k1_sha512_write(&sha, chunk, SECP256K1_HEADER_SIZE);
+        secp256k1_sha512_256_finalize(&sha, hash);
+        secp256k1_sha512_256_initialize(&sha);
+        secp256k1_sha512_write(&sha, hash, 32);
+        secp256k1_sha512_256_finalize(&sha, hash);
+        if (h == checkpoint_height && memcmp(hash, checkpoint_hash32, 32) != 0) {
+            return 0;
+        }
+        if (!secp256k1_headers_check_pow(hash, &target)) {
+            return 0;
+        }
+
+        memcpy(prev_hash, hash, 32);
+        memmove(times, times + 1, sizeof(times) - sizeof(times[0]));
+        times[10] = time;
+        *nverified = i + 1;
+    }
+    return 1;
+}
+
+#undef SECP256K1_HEADERS_MAX_BITS
+#undef SECP256K1_HEADER_SIZE
+
+#endif /* SECP256K1_MODULE_HEADERS_MAIN */
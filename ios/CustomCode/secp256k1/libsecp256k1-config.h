@@ -23,6 +23,34 @@
 /* Define this symbol to enable the Schnorr signature module */
 #define ENABLE_MODULE_SCHNORR 1
 
+/* Define this symbol to enable the RPA (paycode) shared secret and grinding module (needs ENABLE_MODULE_SCHNORR) */
+#define ENABLE_MODULE_RPA 1
+
+/* Define this symbol to enable the block header chunk verification module */
+#define ENABLE_MODULE_HEADERS 1
+
+/* Define this symbol to enable the transaction parsing module */
+#define ENABLE_MODULE_TX 1
+
+/* Define this symbol to enable the pubkey cache module */
+#define ENABLE_MODULE_PUBKEY_CACHE 1
+
+/* Define this symbol to enable the fixed-base table module */
+#define ENABLE_MODULE_FIXED_TABLE 1
+
+/* Define this symbol to enable the blind Schnorr signature module (needs ENABLE_MODULE_SCHNORR and ENABLE_MODULE_FIXED_TABLE) */
+#define ENABLE_MODULE_SCHNORR_BLIND 1
+
+/* Define this symbol to enable the ECIES (encrypt_message / decrypt_message) key derivation module */
+#define ENABLE_MODULE_ECIES 1
+
+/* Define this symbol to count ecmult, ecmult_const, ecmult_gen, field
+   inversions and square roots (see secp256k1_context_get_stats) */
+/* #undef ENABLE_STATS */
+
+/* Define this symbol as well to time the point multiplications */
+/* #undef ENABLE_STATS_TIMING */
+
 /* Define this symbol if OpenSSL EC functions are available */
 /* #undef ENABLE_OPENSSL_TESTS */
 
@@ -92,17 +120,96 @@
 /* Define to the version of this package. */
 #define PACKAGE_VERSION "0.1"
 
+/* Set window size for ecmult precomputation (2..24). Each step up doubles the
+   precomputed tables; a context keeps two of them with USE_ENDOMORPHISM.
+   Schnorr verify on x86_64 -O2 with endomorphism, and the runtime context
+   build cost without USE_ECMULT_STATIC_PRECOMPUTATION:
+
+     window   tables    build     verify
+        2      128 B     1 ms      69 us
+        4      512 B     1 ms      57 us
+        6        2 KiB   1 ms      54 us
+        8        8 KiB   1 ms      52 us
+       10       32 KiB   1 ms      49 us
+       12      128 KiB   2 ms      47 us
+       14      512 KiB   8 ms      46 us
+       15        1 MiB  11 ms      48 us
+       16        2 MiB  32 ms      49 us
+       18        8 MiB  87 ms      47 us
+       20       32 MiB 337 ms      46 us
+
+   Verify latency flattens out past 12 while memory keeps doubling, so the iOS
+   build uses 12. ecmult_static_context.h must be regenerated when this changes. */
+#ifndef ECMULT_WINDOW_SIZE
+#define ECMULT_WINDOW_SIZE 12
+#endif
+
+/* Set the tooth size of the ecmult_gen comb (2, 4 or 8 bits), used for key
+   generation and for every signing nonce. Each multiplication adds one point
+   per tooth but, to stay constant-time, also scans every entry of the table.
+   secp256k1_ec_pubkey_create on x86_64 -O2:
+
+     bits    table   additions   pubkey_create
+       2     32 KiB     128          42 us
+       4     64 KiB      64          25 us
+       8    512 KiB      32          29 us
+
+   With 8 bits the scan reads the whole 512 KiB table and outweighs the saved
+   additions, at least on cores with small L2 caches, so the iOS build uses 4.
+   ecmult_static_context.h must be regenerated when this changes. */
+#ifndef ECMULT_GEN_PREC_BITS
+#define ECMULT_GEN_PREC_BITS 4
+#endif
+
+/* Set the window of the constant-time wNAF in ecmult_const (2..8 bits), used
+   for ECDH (RPA shared secrets, ECIES) and secp256k1_ec_pubkey_tweak_mul_batch.
+   Each window holds 2^(w-2) odd multiples of the point (twice that with the
+   endomorphism). A lone multiplication builds them every time, a batch builds
+   them once. x86_64 -O2 with endomorphism, compressed output:
+
+     window   single   batch (per scalar)
+        2      97 us      93 us
+        3      61 us      55 us
+        4      51 us      44 us
+        5      47 us      39 us
+        6      48 us      36 us
+        7      54 us      35 us
+        8      69 us      36 us
+
+   Past 5 the larger table costs a single multiplication more than it saves,
+   and single multiplications are the common case, so the iOS build uses 5. */
+#ifndef ECMULT_CONST_WINDOW
+#define ECMULT_CONST_WINDOW 5
+#endif
+
 /* Define to 1 if you have the ANSI C header files. */
 #define STDC_HEADERS 1
 
-/* Define this symbol to enable x86_64 assembly optimizations */
+/* Define this symbol to enable x86_64 assembly optimizations. Left off: for
+   the simulator build, GCC and Clang already compile the int128 field and
+   scalar code to about the same speed. */
 /* #undef USE_ASM_X86_64 */
 
+/* Define this symbol to enable AArch64 assembly optimizations */
+#if defined(__aarch64__)
+#define USE_ASM_AARCH64 1
+#endif
+
+/* Define this symbol to also use the AArch64 assembly for the 5x52 field
+   mul/sqr. Left off until ios/test_secp256k1_field.c has passed on arm64
+   hardware; without it USE_ASM_AARCH64 covers only the scalar arithmetic. */
+/* #undef USE_ASM_AARCH64_FIELD */
+
+/* Define this symbol to run the 4-way field code (field4.h) on NEON, for
+   batches of G multiples. Left off until ios/test_secp256k1_field4.c has
+   passed on ARM hardware; without it fe4 is only used with AVX2. */
+/* #undef USE_FE4_NEON */
+
 /* Define this symbol to use a statically generated ecmult table */
-/* #undef USE_ECMULT_STATIC_PRECOMPUTATION */
+#define USE_ECMULT_STATIC_PRECOMPUTATION 1
 
 /* Define this symbol to use endomorphism optimization */
-/* #undef USE_ENDOMORPHISM */
+#define USE_ENDOMORPHISM 1
 
 /* Define this symbol if an external (non-inline) assembly implementation is
    used */
@@ -115,11 +222,19 @@
 #define USE_FIELD_5X52 1
 
 /* Define this symbol to use the native field inverse implementation */
-#define USE_FIELD_INV_BUILTIN 1
+/* #undef USE_FIELD_INV_BUILTIN */
 
 /* Define this symbol to use the num-based field inverse implementation */
 /* #undef USE_FIELD_INV_NUM */
 
+/* Define this symbol to use the x86 SHA-NI or ARMv8 SHA2 instructions for
+   SHA-256 when the CPU has them, falling back to the portable code */
+#define USE_SHA256_HW 1
+
+/* Define this symbol to use the safegcd (Bernstein-Yang divsteps) field inverse
+   implementation */
+#define USE_FIELD_INV_SAFEGCD 1
+
 /* Define this symbol to use the gmp implementation for num */
 /* #undef USE_NUM_GMP */
 
@@ -133,11 +248,15 @@
 /* #undef USE_SCALAR_8X32 */
 
 /* Define this symbol to use the native scalar inverse implementation */
-#define USE_SCALAR_INV_BUILTIN 1
+/* #undef USE_SCALAR_INV_BUILTIN */
 
 /* Define this symbol to use the num-based scalar inverse implementation */
 /* #undef USE_SCALAR_INV_NUM */
 
+/* Define this symbol to use the safegcd (Bernstein-Yang divsteps) scalar inverse
+   implementation */
+#define USE_SCALAR_INV_SAFEGCD 1
+
 /* Version number of package */
 #define VERSION "0.1"
 
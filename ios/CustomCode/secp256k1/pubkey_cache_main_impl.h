@@ -0,0 +1,188 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef SECP256K1_MODULE_PUBKEY_CACHE_MAIN
+#define SECP256K1_MODULE_PUBKEY_CACHE_MAIN
+
+#include "secp256k1_pubkey_cache.h"
+
+/** Entries per set. A key can only live in the set its X coordinate selects,
+ *  and replaces the least recently used entry of that set. */
+#define PUBKEY_CACHE_WAYS 4
+/** A key's odd-multiples table is built on its second use. */
+#define PUBKEY_CACHE_HOT 2
+
+typedef struct {
+    unsigned char key[33];     /* compressed encoding; key[0] == 0 if unused */
+    uint32_t stamp;            /* cache clock at the last use */
+    uint32_t uses;
+    secp256k1_ge_storage point;
+    secp256k1_ecmult_point_table *table; /* NULL until the key is hot */
+} secp256k1_pubkey_cache_entry;
+
+struct secp256k1_pubkey_cache_struct {
+    secp256k1_pubkey_cache_entry *entries;
+    size_t set_mask;
+    uint32_t clock;
+    secp256k1_callback error_callback;
+};
+
+secp256k1_pubkey_cache* secp256k1_pubkey_cache_create(const secp256k1_context* ctx, size_t size) {
+    secp256k1_pubkey_cache *cache;
+    size_t nsets = 1;
+    VERIFY_CHECK(ctx != NULL);
+
+    while (nsets < (size + PUBKEY_CACHE_WAYS - 1) / PUBKEY_CACHE_WAYS) {
+        nsets *= 2;
+    }
+    cache = (secp256k1_pubkey_cache *)checked_malloc(&ctx->error_callback, sizeof(*cache));
+    if (cache == NULL) {
+        return NULL;
+    }
+    cache->entries = (secp256k1_pubkey_cache_entry *)checked_malloc(&ctx->error_callback, nsets * PUBKEY_CACHE_WAYS * sizeof(secp256k1_pubkey_cache_entry));
+    if (cache->entries == NULL) {
+        free(cache);
+        return NULL;
+    }
+    memset(cache->entries, 0, nsets * PUBKEY_CACHE_WAYS * sizeof(secp256k1_pubkey_cache_entry));
+    cache->set_mask = nsets - 1;
+    cache->clock = 0;
+    cache->error_callback = ctx->error_callback;
+    return cache;
+}
+
+void secp256k1_pubkey_cache_destroy(secp256k1_pubkey_cache* cache) {
+    size_t i;
+    if (cache == NULL) {
+        return;
+    }
+    for (i = 0; i < (cache->set_mask + 1) * PUBKEY_CACHE_WAYS; i++) {
+        free(cache->entries[i].table);
+    }
+    free(cache->entries);
+    free(cache);
+}
+
+/** Find or insert the key for input, loading its point into ge and, once it
+ *  is hot, pointing *table at its odd multiples (else setting it to NULL).
+ *  Returns 0 if input is not a valid public key. */
+static int secp256k1_pubkey_cache_load(secp256k1_pubkey_cache *cache, secp256k1_ge *ge, const secp256k1_ecmult_point_table **table, const unsigned char *input, size_t inputlen) {
+    unsigned char key[33];
+    const unsigned char *k = input;
+    secp256k1_pubkey_cache_entry *set, *e = NULL;
+    size_t i, keylen;
+    int parsed = 0;
+
+    if (inputlen != 33) {
+        /* Uncompressed and hybrid keys have no square root to skip, but are
+         * cached by their compressed form for the sake of the table. */
+        if (!secp256k1_eckey_pubkey_parse(ge, input, inputlen) ||
+            !secp256k1_eckey_pubkey_serialize(ge, key, &keylen, 1)) {
+            return 0;
+        }
+        k = key;
+        parsed = 1;
+    } else if (input[0] != SECP256K1_TAG_PUBKEY_EVEN && input[0] != SECP256K1_TAG_PUBKEY_ODD) {
+        return 0;
+    }
+
+    /* The low bytes of X select the set. */
+    set = &cache->entries[((((size_t)k[29] << 8 | k[30]) << 8 | k[31]) & cache->set_mask) * PUBKEY_CACHE_WAYS];
+    cache->clock++;
+    for (i = 0; i < PUBKEY_CACHE_WAYS; i++) {
+        if (memcmp(set[i].key, k, 33) == 0) {
+            e = &set[i];
+            if (!parsed) {
+                secp256k1_ge_from_storage(ge, &e->point);
+            }
+            break;
+        }
+    }
+    if (e == NULL) {
+        if (!parsed && !secp256k1_eckey_pubkey_parse(ge, input, inputlen)) {
+            return 0;
+        }
+        /* Take an unused entry, or else the least recently used one. */
+        e = &set[0];
+        for (i = 0; i < PUBKEY_CACHE_WAYS && e->key[0] != 0; i++) {
+            if (set[i].key[0] == 0 || (uint32_t)(cache->clock - set[i].stamp) > (uint32_t)(cache->clock - e->stamp)) {
+                e = &set[i];
+            }
+        }
+        memcpy(e->key, k, 33);
+        e->uses = 0;
+        secp256k1_ge_to_storage(&e->point, ge);
+        /* A table left by the evicted key is rebuilt in place when this one
+         * turns hot; until then it is stale and must not be used. */
+    }
+    e->stamp = cache->clock;
+    if (e->uses < PUBKEY_CACHE_HOT) {
+        e->uses++;
+        if (e->uses == PUBKEY_CACHE_HOT) {
+            if (e->table == NULL) {
+                e->table = (secp256k1_ecmult_point_table *)checked_malloc(&cache->error_callback, sizeof(*e->table));
+            }
+            if (e->table != NULL) {
+                secp256k1_ecmult_point_table_build(e->table, ge);
+            }
+        }
+    }
+    *table = e->uses >= PUBKEY_CACHE_HOT ? e->table : NULL;
+    return 1;
+}
+
+int secp256k1_pubkey_cache_parse(const secp256k1_context* ctx, secp256k1_pubkey_cache* cache, secp256k1_pubkey* pubkey, const unsigned char *input, size_t inputlen) {
+    secp256k1_ge Q;
+    const secp256k1_ecmult_point_table *table;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(pubkey != NULL);
+    memset(pubkey, 0, sizeof(*pubkey));
+    ARG_CHECK(cache != NULL);
+    ARG_CHECK(input != NULL);
+    if (!secp256k1_pubkey_cache_load(cache, &Q, &table, input, inputlen)) {
+        return 0;
+    }
+    secp256k1_pubkey_save(pubkey, &Q);
+    secp256k1_ge_clear(&Q);
+    return 1;
+}
+
+int secp256k1_ecdsa_verify_cached(const secp256k1_context* ctx, secp256k1_pubkey_cache* cache, const secp256k1_ecdsa_signature *sig, const unsigned char *msg32, const unsigned char *input, size_t inputlen) {
+    secp256k1_ge q;
+    const secp256k1_ecmult_point_table *table;
+    secp256k1_scalar r, s;
+    secp256k1_scalar m;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_context_is_built(&ctx->ecmult_ctx));
+    ARG_CHECK(cache != NULL);
+    ARG_CHECK(msg32 != NULL);
+    ARG_CHECK(sig != NULL);
+    ARG_CHECK(input != NULL);
+
+    secp256k1_scalar_set_b32(&m, msg32, NULL);
+    secp256k1_ecdsa_signature_load(ctx, &r, &s, sig);
+    return (!secp256k1_scalar_is_high(&s) &&
+            secp256k1_pubkey_cache_load(cache, &q, &table, input, inputlen) &&
+            secp256k1_ecdsa_sig_verify(&ctx->ecmult_ctx, &r, &s, &q, table, &m));
+}
+
+#ifdef ENABLE_MODULE_SCHNORR
+int secp256k1_schnorr_verify_cached(const secp256k1_context* ctx, secp256k1_pubkey_cache* cache, const unsigned char *sig64, const unsigned char *msg32, const unsigned char *input, size_t inputlen) {
+    secp256k1_ge q;
+    const secp256k1_ecmult_point_table *table;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_context_is_built(&ctx->ecmult_ctx));
+    ARG_CHECK(cache != NULL);
+    ARG_CHECK(msg32 != NULL);
+    ARG_CHECK(sig64 != NULL);
+    ARG_CHECK(input != NULL);
+
+    return (secp256k1_pubkey_cache_load(cache, &q, &table, input, inputlen) &&
+            secp256k1_schnorr_sig_verify(&ctx->ecmult_ctx, sig64, &q, table, msg32));
+}
+#endif
+
+#endif
@@ -85,13 +85,13 @@ int secp256k1_ecdsa_recoverable_signature_convert(const secp256k1_context* ctx,
     return 1;
 }
 
-static int secp256k1_ecdsa_sig_recover(const secp256k1_ecmult_context *ctx, const secp256k1_scalar *sigr, const secp256k1_scalar* sigs, secp256k1_ge *pubkey, const secp256k1_scalar *message, int recid) {
+/** Recover the public key as a Jacobian point, given rn = 1/sigr. */
+static int secp256k1_ecdsa_sig_recover_inv(const secp256k1_ecmult_context *ctx, const secp256k1_scalar *sigr, const secp256k1_scalar *rn, const secp256k1_scalar* sigs, secp256k1_gej *qj, const secp256k1_scalar *message, int recid) {
     unsigned char brx[32];
     secp256k1_fe fx;
     secp256k1_ge x;
     secp256k1_gej xj;
-    secp256k1_scalar rn, u1, u2;
-    secp256k1_gej qj;
+    secp256k1_scalar u1, u2;
     int r;
 
     if (secp256k1_scalar_is_zero(sigr) || secp256k1_scalar_is_zero(sigs)) {
@@ -112,13 +112,26 @@ static int secp256k1_ecdsa_sig_recover(const secp256k1_ecmult_context *ctx, cons
         return 0;
     }
     secp256k1_gej_set_ge(&xj, &x);
-    secp256k1_scalar_inverse_var(&rn, sigr);
-    secp256k1_scalar_mul(&u1, &rn, message);
+    secp256k1_scalar_mul(&u1, rn, message);
     secp256k1_scalar_negate(&u1, &u1);
-    secp256k1_scalar_mul(&u2, &rn, sigs);
-    secp256k1_ecmult(ctx, &qj, &xj, &u2, &u1);
+    secp256k1_scalar_mul(&u2, rn, sigs);
+    secp256k1_ecmult(ctx, qj, &xj, &u2, &u1);
+    return !secp256k1_gej_is_infinity(qj);
+}
+
+static int secp256k1_ecdsa_sig_recover(const secp256k1_ecmult_context *ctx, const secp256k1_scalar *sigr, const secp256k1_scalar* sigs, secp256k1_ge *pubkey, const secp256k1_scalar *message, int recid) {
+    secp256k1_scalar rn;
+    secp256k1_gej qj;
+
+    if (secp256k1_scalar_is_zero(sigr)) {
+        return 0;
+    }
+    secp256k1_scalar_inverse_var(&rn, sigr);
+    if (!secp256k1_ecdsa_sig_recover_inv(ctx, sigr, &rn, sigs, &qj, message, recid)) {
+        return 0;
+    }
     secp256k1_ge_set_gej_var(pubkey, &qj);
-    return !secp256k1_gej_is_infinity(&qj);
+    return 1;
 }
 
 int secp256k1_ecdsa_sign_recoverable(const secp256k1_context* ctx, secp256k1_ecdsa_recoverable_signature *signature, const unsigned char *msg32, const unsigned char *seckey, secp256k1_nonce_function noncefp, const void* noncedata) {
@@ -192,4 +205,79 @@ int secp256k1_ecdsa_recover(const secp256k1_context* ctx, secp256k1_pubkey *pubk
     }
 }
 
+int secp256k1_ecdsa_recover_batch(const secp256k1_context* ctx, unsigned char *output, size_t outputlen, const unsigned char *sigs64, const int *recids, const unsigned char *msgs32, size_t n, unsigned int flags) {
+    secp256k1_scalar *rs, *rns;
+    secp256k1_gej *qj;
+    secp256k1_fe *zs;
+    secp256k1_scalar s, m, acc;
+    unsigned char *valid;
+    size_t i;
+    int overflow;
+    int ret = 1;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_context_is_built(&ctx->ecmult_ctx));
+    ARG_CHECK((flags & SECP256K1_FLAGS_TYPE_MASK) == SECP256K1_FLAGS_TYPE_COMPRESSION);
+    ARG_CHECK(outputlen == ((flags & SECP256K1_FLAGS_BIT_COMPRESSION) ? 33 : 65));
+    if (n == 0) {
+        return 1;
+    }
+    ARG_CHECK(output != NULL);
+    ARG_CHECK(sigs64 != NULL);
+    ARG_CHECK(recids != NULL);
+    ARG_CHECK(msgs32 != NULL);
+
+    rs = (secp256k1_scalar *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_scalar) * n);
+    rns = (secp256k1_scalar *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_scalar) * n);
+    qj = (secp256k1_gej *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_gej) * n);
+    zs = (secp256k1_fe *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_fe) * n);
+    valid = (unsigned char *)checked_malloc(&ctx->error_callback, n);
+
+    /* rns[i] = r[0] * ... * r[i], with a zero or invalid r replaced by one */
+    for (i = 0; i < n; i++) {
+        secp256k1_scalar_set_b32(&rs[i], sigs64 + 64 * i, &overflow);
+        valid[i] = !overflow && !secp256k1_scalar_is_zero(&rs[i]) && recids[i] >= 0 && recids[i] <= 3;
+        if (!valid[i]) {
+            secp256k1_scalar_set_int(&rs[i], 1);
+        }
+        if (i == 0) {
+            rns[0] = rs[0];
+        } else {
+            secp256k1_scalar_mul(&rns[i], &rns[i - 1], &rs[i]);
+        }
+    }
+    /* One inversion for all of them; r is public, so variable time is fine. */
+    secp256k1_scalar_inverse_var(&acc, &rns[n - 1]);
+    for (i = n - 1; i > 0; i--) {
+        /* acc = 1/(r[0] * ... * r[i]), so 1/r[i] = acc * rns[i - 1]. */
+        secp256k1_scalar_mul(&rns[i], &acc, &rns[i - 1]);
+        secp256k1_scalar_mul(&acc, &acc, &rs[i]);
+    }
+    rns[0] = acc;
+
+    for (i = 0; i < n; i++) {
+        if (valid[i]) {
+            secp256k1_scalar_set_b32(&s, sigs64 + 64 * i + 32, &overflow);
+            secp256k1_scalar_set_b32(&m, msgs32 + 32 * i, NULL);
+            valid[i] = !overflow && secp256k1_ecdsa_sig_recover_inv(&ctx->ecmult_ctx, &rs[i], &rns[i], &s, &qj[i], &m, recids[i]);
+        }
+        if (!valid[i]) {
+            /* Keep the batch free of infinities; this output is zeroed below. */
+            secp256k1_gej_set_ge(&qj[i], &secp256k1_ge_const_g);
+            ret = 0;
+        }
+    }
+    secp256k1_eckey_pubkey_serialize_batch(qj, zs, n, output, outputlen, flags & SECP256K1_FLAGS_BIT_COMPRESSION);
+    for (i = 0; i < n; i++) {
+        if (!valid[i]) {
+            memset(output + i * outputlen, 0, outputlen);
+        }
+    }
+    free(valid);
+    free(zs);
+    free(qj);
+    free(rns);
+    free(rs);
+    return ret;
+}
+
 #endif /* SECP256K1_MODULE_RECOVERY_MAIN_H */
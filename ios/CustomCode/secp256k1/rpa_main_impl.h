@@ -0,0 +1,258 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef SECP256K1_MODULE_RPA_MAIN
+#define SECP256K1_MODULE_RPA_MAIN
+
+#include "secp256k1_rpa.h"
+#include "schnorr_impl.h"
+
+/* Candidates per batch of secp256k1_rpa_grind, which share one field inversion. */
+#define RPA_GRIND_BATCH 64
+
+/** Finish an RPA shared secret from the X coordinate of the ECDH product. */
+static void secp256k1_rpa_hash(unsigned char *output32, const unsigned char *x32, const unsigned char *outpoint, size_t outpointlen) {
+    static const unsigned char zero = 0;
+    secp256k1_sha256 sha;
+    unsigned char h1[32], h2[32], sum[33];
+    unsigned int carry = 0;
+    size_t skip = 0;
+    int i;
+
+    /* The Python code hashes x as a 33-byte big-endian integer. */
+    secp256k1_sha256_initialize(&sha);
+    secp256k1_sha256_write(&sha, &zero, 1);
+    secp256k1_sha256_write(&sha, x32, 32);
+    secp256k1_sha256_finalize(&sha, h1);
+
+    secp256k1_sha256_initialize(&sha);
+    secp256k1_sha256_write(&sha, outpoint, outpointlen);
+    secp256k1_sha256_finalize(&sha, h2);
+
+    for (i = 31; i >= 0; i--) {
+        carry += (unsigned int)h1[i] + h2[i];
+        sum[i + 1] = carry & 0xFF;
+        carry >>= 8;
+    }
+    sum[0] = carry;
+    /* Hash the sum's minimal big-endian encoding (one byte if it is zero). */
+    while (skip < 32 && sum[skip] == 0) {
+        skip++;
+    }
+    secp256k1_sha256_initialize(&sha);
+    secp256k1_sha256_write(&sha, sum + skip, 33 - skip);
+    secp256k1_sha256_finalize(&sha, output32);
+}
+
+int secp256k1_rpa_shared_secret(const secp256k1_context* ctx, unsigned char *output32, const unsigned char *seckey, const unsigned char *pubkey, size_t pubkeylen, const unsigned char *outpoint, size_t outpointlen) {
+    secp256k1_ge pt;
+    secp256k1_gej res;
+    secp256k1_scalar s;
+    unsigned char x[32];
+    int overflow = 0;
+    int ret = 0;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(output32 != NULL);
+    ARG_CHECK(seckey != NULL);
+    ARG_CHECK(pubkey != NULL);
+    ARG_CHECK(outpoint != NULL);
+
+    secp256k1_scalar_set_b32(&s, seckey, &overflow);
+    if (!overflow && !secp256k1_scalar_is_zero(&s) && secp256k1_eckey_pubkey_parse(&pt, pubkey, pubkeylen)) {
+        secp256k1_ecmult_const(&res, &pt, &s);
+        secp256k1_ge_set_gej(&pt, &res);
+        secp256k1_fe_normalize(&pt.x);
+        secp256k1_fe_get_b32(x, &pt.x);
+        secp256k1_rpa_hash(output32, x, outpoint, outpointlen);
+        memset(x, 0, sizeof(x));
+        ret = 1;
+    }
+    secp256k1_scalar_clear(&s);
+    return ret;
+}
+
+int secp256k1_rpa_shared_secret_batch(const secp256k1_context* ctx, unsigned char *output, const unsigned char *seckey, const unsigned char *pubkeys, const size_t *pubkeylens, const unsigned char *outpoints, const size_t *outpointlens, size_t n) {
+    secp256k1_ge pt;
+    secp256k1_gej *pj;
+    secp256k1_fe *zs;
+    secp256k1_scalar s;
+    unsigned char *ser;
+    unsigned char *valid;
+    size_t i, poff, ooff;
+    int overflow = 0;
+    int ret = 1;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(seckey != NULL);
+    if (n == 0) {
+        return 1;
+    }
+    ARG_CHECK(output != NULL);
+    ARG_CHECK(pubkeys != NULL);
+    ARG_CHECK(pubkeylens != NULL);
+    ARG_CHECK(outpoints != NULL);
+    ARG_CHECK(outpointlens != NULL);
+
+    secp256k1_scalar_set_b32(&s, seckey, &overflow);
+    if (overflow || secp256k1_scalar_is_zero(&s)) {
+        secp256k1_scalar_clear(&s);
+        memset(output, 0, 32 * n);
+        return 0;
+    }
+    pj = (secp256k1_gej *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_gej) * n);
+    zs = (secp256k1_fe *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_fe) * n);
+    ser = (unsigned char *)checked_malloc(&ctx->error_callback, 33 * n);
+    valid = (unsigned char *)checked_malloc(&ctx->error_callback, n);
+    for (i = 0, poff = 0; i < n; poff += pubkeylens[i], i++) {
+        valid[i] = secp256k1_eckey_pubkey_parse(&pt, pubkeys + poff, pubkeylens[i]);
+        if (!valid[i]) {
+            /* Keep the batch free of infinities; this output is zeroed below. */
+            pt = secp256k1_ge_const_g;
+            ret = 0;
+        }
+        secp256k1_ecmult_const(&pj[i], &pt, &s);
+    }
+    secp256k1_scalar_clear(&s);
+    /* Only the X coordinates are needed; they are bytes 1..32 of the compressed encoding. */
+    secp256k1_eckey_pubkey_serialize_batch(pj, zs, n, ser, 33, 1);
+    for (i = 0, ooff = 0; i < n; ooff += outpointlens[i], i++) {
+        if (valid[i]) {
+            secp256k1_rpa_hash(output + 32 * i, ser + 33 * i + 1, outpoints + ooff, outpointlens[i]);
+        } else {
+            memset(output + 32 * i, 0, 32);
+        }
+    }
+    memset(ser, 0, 33 * n);
+    free(valid);
+    free(ser);
+    free(zs);
+    free(pj);
+    return ret;
+}
+
+/** Does the hash start with the prefix_bits leading bits of prefix? */
+static int secp256k1_rpa_prefix_matches(const unsigned char *hash32, const unsigned char *prefix, unsigned int prefix_bits) {
+    unsigned int i;
+    for (i = 0; i < prefix_bits / 8; i++) {
+        if (hash32[i] != prefix[i]) {
+            return 0;
+        }
+    }
+    if (prefix_bits % 8) {
+        unsigned char mask = (unsigned char)(0xFF << (8 - prefix_bits % 8));
+        return ((hash32[i] ^ prefix[i]) & mask) == 0;
+    }
+    return 1;
+}
+
+int secp256k1_rpa_grind(const secp256k1_context* ctx, unsigned char *sig64, size_t *tried, const unsigned char *input, size_t inputlen, size_t sigpos, const unsigned char *msg32, const unsigned char *seckey, const unsigned char *ndata32, size_t start, size_t count, const unsigned char *prefix, unsigned int prefix_bits, const volatile int *stop) {
+    secp256k1_gej Rj[RPA_GRIND_BATCH];
+    secp256k1_fe zs[RPA_GRIND_BATCH], zis[RPA_GRIND_BATCH];
+    secp256k1_ge R, P;
+    secp256k1_gej Pj;
+    secp256k1_scalar x, k, kr, e, one;
+    secp256k1_sha256 head, sha;
+    unsigned char hash[32], startb[32];
+    size_t done = 0, n, i;
+    int overflow = 0;
+    int found = 0;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(sig64 != NULL);
+    memset(sig64, 0, 64);
+    ARG_CHECK(tried != NULL);
+    *tried = 0;
+    ARG_CHECK(input != NULL);
+    ARG_CHECK(sigpos <= inputlen && inputlen - sigpos >= 64);
+    ARG_CHECK(msg32 != NULL);
+    ARG_CHECK(seckey != NULL);
+    ARG_CHECK(ndata32 != NULL);
+    ARG_CHECK(prefix != NULL);
+    ARG_CHECK(prefix_bits <= 32);
+
+    secp256k1_scalar_set_b32(&x, seckey, &overflow);
+    if (overflow || secp256k1_scalar_is_zero(&x) ||
+        !secp256k1_schnorr_sig_generate_k(&k, msg32, &x, NULL, ndata32)) {
+        secp256k1_scalar_clear(&x);
+        return 0;
+    }
+    secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &Pj, &x);
+    secp256k1_ge_set_gej(&P, &Pj);
+
+    /* k += start, with start as a big-endian scalar */
+    memset(startb, 0, sizeof(startb));
+    for (i = 0; i < sizeof(start); i++) {
+        startb[31 - i] = (unsigned char)(start >> (8 * i));
+    }
+    secp256k1_scalar_set_b32(&kr, startb, NULL);
+    secp256k1_scalar_add(&k, &k, &kr);
+    secp256k1_scalar_set_int(&one, 1);
+
+    /* Everything before the signature is hashed once. */
+    secp256k1_sha256_initialize(&head);
+    secp256k1_sha256_write(&head, input, sigpos);
+
+    secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &Rj[RPA_GRIND_BATCH - 1], &k);
+    while (!found && done < count && !(stop != NULL && *stop)) {
+        n = count - done < RPA_GRIND_BATCH ? count - done : RPA_GRIND_BATCH;
+        /* The nonce points are public once signed with and may be walked in
+         * variable time; the batch continues from the last one. */
+        Rj[0] = Rj[RPA_GRIND_BATCH - 1];
+        for (i = 1; i < n; i++) {
+            secp256k1_gej_add_ge_var(&Rj[i], &Rj[i - 1], &secp256k1_ge_const_g, NULL);
+        }
+        for (i = 0; i < n; i++) {
+            /* k + start + done + i is never zero but for a 2^-256 chance; keep
+             * the inversion defined and skip that candidate below. */
+            if (Rj[i].infinity) {
+                secp256k1_fe_set_int(&zs[i], 1);
+            } else {
+                zs[i] = Rj[i].z;
+            }
+        }
+        secp256k1_fe_inv_all_var(zis, zs, n);
+
+        for (i = 0; i < n && !found; i++) {
+            if (!Rj[i].infinity) {
+                secp256k1_ge_set_gej_zinv(&R, &Rj[i], &zis[i]);
+                /* As secp256k1_schnorr_compute_sig does, sign with -k if R.y is
+                 * not a quadratic residue. */
+                kr = k;
+                secp256k1_scalar_cond_negate(&kr, !secp256k1_fe_is_quad_var(&R.y));
+                secp256k1_fe_normalize_var(&R.x);
+                secp256k1_fe_get_b32(sig64, &R.x);
+                secp256k1_schnorr_compute_e(&e, sig64, &P, msg32);
+                secp256k1_scalar_mul(&e, &e, &x);
+                secp256k1_scalar_add(&e, &e, &kr);
+                secp256k1_scalar_get_b32(sig64 + 32, &e);
+
+                sha = head;
+                secp256k1_sha256_write(&sha, sig64, 64);
+                secp256k1_sha256_write(&sha, input + sigpos + 64, inputlen - sigpos - 64);
+                secp256k1_sha256_finalize(&sha, hash);
+                secp256k1_sha256_initialize(&sha);
+                secp256k1_sha256_write(&sha, hash, 32);
+                secp256k1_sha256_finalize(&sha, hash);
+                found = secp256k1_rpa_prefix_matches(hash, prefix, prefix_bits);
+            }
+            secp256k1_scalar_add(&k, &k, &one);
+        }
+        done += i;
+        if (!found && n == RPA_GRIND_BATCH) {
+            secp256k1_gej_add_ge_var(&Rj[RPA_GRIND_BATCH - 1], &Rj[RPA_GRIND_BATCH - 1], &secp256k1_ge_const_g, NULL);
+        }
+    }
+    *tried = done;
+    if (!found) {
+        memset(sig64, 0, 64);
+    }
+
+    secp256k1_scalar_clear(&x);
+    secp256k1_scalar_clear(&k);
+    secp256k1_scalar_clear(&kr);
+    secp256k1_scalar_clear(&e);
+    return found;
+}
+
+#endif /* SECP256K1_MODULE_RPA_MAIN */
@@ -7,6 +7,10 @@
 #ifndef SECP256K1_SCALAR_REPR_IMPL_H
 #define SECP256K1_SCALAR_REPR_IMPL_H
 
+#if defined(USE_SCALAR_INV_SAFEGCD)
+#include "modinv64_impl.h"
+#endif
+
 /* Limbs of the secp256k1 order. */
 #define SECP256K1_N_0 ((uint64_t)0xBFD25E8CD0364141ULL)
 #define SECP256K1_N_1 ((uint64_t)0xBAAEDCE6AF48A03BULL)
@@ -503,6 +507,194 @@ static void secp256k1_scalar_reduce_512(secp256k1_scalar *r, const uint64_t *l)
     : "=g"(c)
     : "g"(p0), "g"(p1), "g"(p2), "g"(p3), "g"(p4), "D"(r), "n"(SECP256K1_N_C_0), "n"(SECP256K1_N_C_1)
     : "rax", "rdx", "r8", "r9", "r10", "cc", "memory");
+#elif defined(USE_ASM_AARCH64)
+    uint64_t m0 = l[0], m1 = l[1], m2 = l[2], m3 = l[3];
+    uint64_t m4 = l[4], m5 = l[5], m6 = l[6], n3 = l[7];
+    uint64_t k0, k1, k2, lo, hi;
+    uint64_t c;
+
+    __asm__ __volatile__(
+    /* Reduce 512 bits into 385. m0..m3 start out as l[0..3], m4..m6 as n0..n2. */
+    /* m[0..6] = l[0..3] + n[0..3] * SECP256K1_N_C. */
+    /* muladd_fast(m4, nc0) */
+    "mul %[lo], %[m4], %[nc0]\n"
+    "umulh %[hi], %[m4], %[nc0]\n"
+    "adds %[m0], %[m0], %[lo]\n"
+    "adc %[k0], %[hi], xzr\n"
+    /* extract_fast(m0) */
+    /* sumadd_fast(m1) */
+    "adds %[k0], %[k0], %[m1]\n"
+    "adc %[k1], xzr, xzr\n"
+    /* muladd(m5, nc0) */
+    "mul %[lo], %[m5], %[nc0]\n"
+    "umulh %[hi], %[m5], %[nc0]\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k1], %[k1], %[hi]\n"
+    "adc %[k2], xzr, xzr\n"
+    /* muladd(m4, nc1) */
+    "mul %[lo], %[m4], %[nc1]\n"
+    "umulh %[hi], %[m4], %[nc1]\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k1], %[k1], %[hi]\n"
+    "adc %[k2], %[k2], xzr\n"
+    /* extract(m1) */
+    "mov %[m1], %[k0]\n"
+    /* sumadd(m2) */
+    "adds %[k1], %[k1], %[m2]\n"
+    "adcs %[k2], %[k2], xzr\n"
+    "adc %[k0], xzr, xzr\n"
+    /* muladd(m6, nc0) */
+    "mul %[lo], %[m6], %[nc0]\n"
+    "umulh %[hi], %[m6], %[nc0]\n"
+    "adds %[k1], %[k1], %[lo]\n"
+    "adcs %[k2], %[k2], %[hi]\n"
+    "adc %[k0], %[k0], xzr\n"
+    /* muladd(m5, nc1) */
+    "mul %[lo], %[m5], %[nc1]\n"
+    "umulh %[hi], %[m5], %[nc1]\n"
+    "adds %[k1], %[k1], %[lo]\n"
+    "adcs %[k2], %[k2], %[hi]\n"
+    "adc %[k0], %[k0], xzr\n"
+    /* sumadd(m4) */
+    "adds %[k1], %[k1], %[m4]\n"
+    "adcs %[k2], %[k2], xzr\n"
+    "adc %[k0], %[k0], xzr\n"
+    /* extract(m2) */
+    "mov %[m2], %[k1]\n"
+    /* sumadd(m3) */
+    "adds %[k2], %[k2], %[m3]\n"
+    "adcs %[k0], %[k0], xzr\n"
+    "adc %[k1], xzr, xzr\n"
+    /* muladd(n3, nc0) */
+    "mul %[lo], %[n3], %[nc0]\n"
+    "umulh %[hi], %[n3], %[nc0]\n"
+    "adds %[k2], %[k2], %[lo]\n"
+    "adcs %[k0], %[k0], %[hi]\n"
+    "adc %[k1], %[k1], xzr\n"
+    /* muladd(m6, nc1) */
+    "mul %[lo], %[m6], %[nc1]\n"
+    "umulh %[hi], %[m6], %[nc1]\n"
+    "adds %[k2], %[k2], %[lo]\n"
+    "adcs %[k0], %[k0], %[hi]\n"
+    "adc %[k1], %[k1], xzr\n"
+    /* sumadd(m5) */
+    "adds %[k2], %[k2], %[m5]\n"
+    "adcs %[k0], %[k0], xzr\n"
+    "adc %[k1], %[k1], xzr\n"
+    /* extract(m3) */
+    "mov %[m3], %[k2]\n"
+    /* muladd(n3, nc1) */
+    "mul %[lo], %[n3], %[nc1]\n"
+    "umulh %[hi], %[n3], %[nc1]\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k1], %[k1], %[hi]\n"
+    "adc %[k2], xzr, xzr\n"
+    /* sumadd(m6) */
+    "adds %[k0], %[k0], %[m6]\n"
+    "adcs %[k1], %[k1], xzr\n"
+    "adc %[k2], %[k2], xzr\n"
+    /* extract(m4) */
+    "mov %[m4], %[k0]\n"
+    /* sumadd_fast(n3) */
+    "adds %[k1], %[k1], %[n3]\n"
+    "adc %[k2], %[k2], xzr\n"
+    /* extract_fast(m5) */
+    "mov %[m5], %[k1]\n"
+    /* m6 = c0 */
+    "mov %[m6], %[k2]\n"
+    /* Reduce 385 bits into 258. p0..p3 are kept in m0..m3, p4 in m6. */
+    /* p[0..4] = m[0..3] + m[4..6] * SECP256K1_N_C. */
+    /* muladd_fast(m4, nc0) */
+    "mul %[lo], %[m4], %[nc0]\n"
+    "umulh %[hi], %[m4], %[nc0]\n"
+    "adds %[m0], %[m0], %[lo]\n"
+    "adc %[k0], %[hi], xzr\n"
+    /* extract_fast(m0) */
+    /* sumadd_fast(m1) */
+    "adds %[k0], %[k0], %[m1]\n"
+    "adc %[k1], xzr, xzr\n"
+    /* muladd(m5, nc0) */
+    "mul %[lo], %[m5], %[nc0]\n"
+    "umulh %[hi], %[m5], %[nc0]\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k1], %[k1], %[hi]\n"
+    "adc %[k2], xzr, xzr\n"
+    /* muladd(m4, nc1) */
+    "mul %[lo], %[m4], %[nc1]\n"
+    "umulh %[hi], %[m4], %[nc1]\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k1], %[k1], %[hi]\n"
+    "adc %[k2], %[k2], xzr\n"
+    /* extract(m1) */
+    "mov %[m1], %[k0]\n"
+    /* sumadd(m2) */
+    "adds %[k1], %[k1], %[m2]\n"
+    "adcs %[k2], %[k2], xzr\n"
+    "adc %[k0], xzr, xzr\n"
+    /* muladd(m6, nc0) */
+    "mul %[lo], %[m6], %[nc0]\n"
+    "umulh %[hi], %[m6], %[nc0]\n"
+    "adds %[k1], %[k1], %[lo]\n"
+    "adcs %[k2], %[k2], %[hi]\n"
+    "adc %[k0], %[k0], xzr\n"
+    /* muladd(m5, nc1) */
+    "mul %[lo], %[m5], %[nc1]\n"
+    "umulh %[hi], %[m5], %[nc1]\n"
+    "adds %[k1], %[k1], %[lo]\n"
+    "adcs %[k2], %[k2], %[hi]\n"
+    "adc %[k0], %[k0], xzr\n"
+    /* sumadd(m4) */
+    "adds %[k1], %[k1], %[m4]\n"
+    "adcs %[k2], %[k2], xzr\n"
+    "adc %[k0], %[k0], xzr\n"
+    /* extract(m2) */
+    "mov %[m2], %[k1]\n"
+    /* sumadd_fast(m3) */
+    "adds %[k2], %[k2], %[m3]\n"
+    "adc %[k0], %[k0], xzr\n"
+    /* muladd_fast(m6, nc1) */
+    "mul %[lo], %[m6], %[nc1]\n"
+    "umulh %[hi], %[m6], %[nc1]\n"
+    "adds %[k2], %[k2], %[lo]\n"
+    "adc %[k0], %[k0], %[hi]\n"
+    /* sumadd_fast(m5) */
+    "adds %[k2], %[k2], %[m5]\n"
+    "adc %[k0], %[k0], xzr\n"
+    /* extract_fast(m3) */
+    "mov %[m3], %[k2]\n"
+    /* p4 = c0 + m6 */
+    "add %[m6], %[k0], %[m6]\n"
+    /* Reduce 258 bits into 256. */
+    /* r[0..3] = p[0..3] + p[4] * SECP256K1_N_C. */
+    /* c = p0 + SECP256K1_N_C_0 * p4 */
+    "mul %[lo], %[nc0], %[m6]\n"
+    "umulh %[k0], %[nc0], %[m6]\n"
+    "adds %[lo], %[lo], %[m0]\n"
+    "adc %[k0], %[k0], xzr\n"
+    "str %[lo], [%[r], #0]\n"
+    /* c += p1 + SECP256K1_N_C_1 * p4 */
+    "mul %[lo], %[nc1], %[m6]\n"
+    "umulh %[k1], %[nc1], %[m6]\n"
+    "adds %[lo], %[lo], %[m1]\n"
+    "adc %[k1], %[k1], xzr\n"
+    "adds %[lo], %[lo], %[k0]\n"
+    "adc %[k1], %[k1], xzr\n"
+    "str %[lo], [%[r], #8]\n"
+    /* c += p2 + p4 */
+    "adds %[lo], %[m2], %[m6]\n"
+    "adc %[k0], xzr, xzr\n"
+    "adds %[lo], %[lo], %[k1]\n"
+    "adc %[k0], %[k0], xzr\n"
+    "str %[lo], [%[r], #16]\n"
+    /* c += p3 */
+    "adds %[lo], %[m3], %[k0]\n"
+    "adc %[c], xzr, xzr\n"
+    "str %[lo], [%[r], #24]\n"
+    : [m0]"+r"(m0), [m1]"+r"(m1), [m2]"+r"(m2), [m3]"+r"(m3),
+      [m4]"+r"(m4), [m5]"+r"(m5), [m6]"+r"(m6), [n3]"+r"(n3),
+      [k0]"=&r"(k0), [k1]"=&r"(k1), [k2]"=&r"(k2), [lo]"=&r"(lo), [hi]"=&r"(hi), [c]"=&r"(c)
+    : [nc0]"r"(SECP256K1_N_C_0), [nc1]"r"(SECP256K1_N_C_1), [r]"r"(r->d)
+    : "cc", "memory");
 #else
     uint128_t c;
     uint64_t c0, c1, c2;
@@ -709,6 +901,124 @@ static void secp256k1_scalar_mul_512(uint64_t l[8], const secp256k1_scalar *a, c
     : "+d"(pb)
     : "S"(l), "D"(a->d)
     : "rax", "rbx", "rcx", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "cc", "memory");
+#elif defined(USE_ASM_AARCH64)
+    const uint64_t a0 = a->d[0], a1 = a->d[1], a2 = a->d[2], a3 = a->d[3];
+    const uint64_t b0 = b->d[0], b1 = b->d[1], b2 = b->d[2], b3 = b->d[3];
+    uint64_t k0, k1, k2, lo, hi;
+
+    __asm__ __volatile__(
+    /* muladd_fast(a0, b0) */
+    "mul %[k0], %[a0], %[b0]\n"
+    "umulh %[k1], %[a0], %[b0]\n"
+    /* extract_fast(l[0]) */
+    "str %[k0], [%[l], #0]\n"
+    /* muladd(a0, b1) */
+    "mul %[lo], %[a0], %[b1]\n"
+    "umulh %[hi], %[a0], %[b1]\n"
+    "adds %[k1], %[k1], %[lo]\n"
+    "adcs %[k0], %[hi], xzr\n"
+    "adc %[k2], xzr, xzr\n"
+    /* muladd(a1, b0) */
+    "mul %[lo], %[a1], %[b0]\n"
+    "umulh %[hi], %[a1], %[b0]\n"
+    "adds %[k1], %[k1], %[lo]\n"
+    "adcs %[k0], %[k0], %[hi]\n"
+    "adc %[k2], %[k2], xzr\n"
+    /* extract(l[1]) */
+    "str %[k1], [%[l], #8]\n"
+    /* muladd(a0, b2) */
+    "mul %[lo], %[a0], %[b2]\n"
+    "umulh %[hi], %[a0], %[b2]\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k2], %[k2], %[hi]\n"
+    "adc %[k1], xzr, xzr\n"
+    /* muladd(a1, b1) */
+    "mul %[lo], %[a1], %[b1]\n"
+    "umulh %[hi], %[a1], %[b1]\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k2], %[k2], %[hi]\n"
+    "adc %[k1], %[k1], xzr\n"
+    /* muladd(a2, b0) */
+    "mul %[lo], %[a2], %[b0]\n"
+    "umulh %[hi], %[a2], %[b0]\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k2], %[k2], %[hi]\n"
+    "adc %[k1], %[k1], xzr\n"
+    /* extract(l[2]) */
+    "str %[k0], [%[l], #16]\n"
+    /* muladd(a0, b3) */
+    "mul %[lo], %[a0], %[b3]\n"
+    "umulh %[hi], %[a0], %[b3]\n"
+    "adds %[k2], %[k2], %[lo]\n"
+    "adcs %[k1], %[k1], %[hi]\n"
+    "adc %[k0], xzr, xzr\n"
+    /* muladd(a1, b2) */
+    "mul %[lo], %[a1], %[b2]\n"
+    "umulh %[hi], %[a1], %[b2]\n"
+    "adds %[k2], %[k2], %[lo]\n"
+    "adcs %[k1], %[k1], %[hi]\n"
+    "adc %[k0], %[k0], xzr\n"
+    /* muladd(a2, b1) */
+    "mul %[lo], %[a2], %[b1]\n"
+    "umulh %[hi], %[a2], %[b1]\n"
+    "adds %[k2], %[k2], %[lo]\n"
+    "adcs %[k1], %[k1], %[hi]\n"
+    "adc %[k0], %[k0], xzr\n"
+    /* muladd(a3, b0) */
+    "mul %[lo], %[a3], %[b0]\n"
+    "umulh %[hi], %[a3], %[b0]\n"
+    "adds %[k2], %[k2], %[lo]\n"
+    "adcs %[k1], %[k1], %[hi]\n"
+    "adc %[k0], %[k0], xzr\n"
+    /* extract(l[3]) */
+    "str %[k2], [%[l], #24]\n"
+    /* muladd(a1, b3) */
+    "mul %[lo], %[a1], %[b3]\n"
+    "umulh %[hi], %[a1], %[b3]\n"
+    "adds %[k1], %[k1], %[lo]\n"
+    "adcs %[k0], %[k0], %[hi]\n"
+    "adc %[k2], xzr, xzr\n"
+    /* muladd(a2, b2) */
+    "mul %[lo], %[a2], %[b2]\n"
+    "umulh %[hi], %[a2], %[b2]\n"
+    "adds %[k1], %[k1], %[lo]\n"
+    "adcs %[k0], %[k0], %[hi]\n"
+    "adc %[k2], %[k2], xzr\n"
+    /* muladd(a3, b1) */
+    "mul %[lo], %[a3], %[b1]\n"
+    "umulh %[hi], %[a3], %[b1]\n"
+    "adds %[k1], %[k1], %[lo]\n"
+    "adcs %[k0], %[k0], %[hi]\n"
+    "adc %[k2], %[k2], xzr\n"
+    /* extract(l[4]) */
+    "str %[k1], [%[l], #32]\n"
+    /* muladd(a2, b3) */
+    "mul %[lo], %[a2], %[b3]\n"
+    "umulh %[hi], %[a2], %[b3]\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k2], %[k2], %[hi]\n"
+    "adc %[k1], xzr, xzr\n"
+    /* muladd(a3, b2) */
+    "mul %[lo], %[a3], %[b2]\n"
+    "umulh %[hi], %[a3], %[b2]\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k2], %[k2], %[hi]\n"
+    "adc %[k1], %[k1], xzr\n"
+    /* extract(l[5]) */
+    "str %[k0], [%[l], #40]\n"
+    /* muladd_fast(a3, b3) */
+    "mul %[lo], %[a3], %[b3]\n"
+    "umulh %[hi], %[a3], %[b3]\n"
+    "adds %[k2], %[k2], %[lo]\n"
+    "adc %[k1], %[k1], %[hi]\n"
+    /* extract_fast(l[6]) */
+    "str %[k2], [%[l], #48]\n"
+    /* l[7] = c0 */
+    "str %[k1], [%[l], #56]\n"
+    : [k0]"=&r"(k0), [k1]"=&r"(k1), [k2]"=&r"(k2), [lo]"=&r"(lo), [hi]"=&r"(hi)
+    : [a0]"r"(a0), [a1]"r"(a1), [a2]"r"(a2), [a3]"r"(a3),
+      [b0]"r"(b0), [b1]"r"(b1), [b2]"r"(b2), [b3]"r"(b3), [l]"r"(l)
+    : "cc", "memory");
 #else
     /* 160 bit accumulator. */
     uint64_t c0 = 0, c1 = 0;
@@ -743,6 +1053,8 @@ static void secp256k1_scalar_mul_512(uint64_t l[8], const secp256k1_scalar *a, c
 #endif
 }
 
+/* Squaring only serves the addition chain in secp256k1_scalar_inverse. */
+#if !defined(USE_SCALAR_INV_SAFEGCD)
 static void secp256k1_scalar_sqr_512(uint64_t l[8], const secp256k1_scalar *a) {
 #ifdef USE_ASM_X86_64
     __asm__ __volatile__(
@@ -852,6 +1164,104 @@ static void secp256k1_scalar_sqr_512(uint64_t l[8], const secp256k1_scalar *a) {
     :
     : "S"(l), "D"(a->d)
     : "rax", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "cc", "memory");
+#elif defined(USE_ASM_AARCH64)
+    const uint64_t a0 = a->d[0], a1 = a->d[1], a2 = a->d[2], a3 = a->d[3];
+    uint64_t k0, k1, k2, lo, hi;
+
+    __asm__ __volatile__(
+    /* muladd_fast(a0, a0) */
+    "mul %[k0], %[a0], %[a0]\n"
+    "umulh %[k1], %[a0], %[a0]\n"
+    /* extract_fast(l[0]) */
+    "str %[k0], [%[l], #0]\n"
+    /* muladd2(a0, a1) */
+    "mul %[lo], %[a0], %[a1]\n"
+    "umulh %[hi], %[a0], %[a1]\n"
+    "adds %[k1], %[k1], %[lo]\n"
+    "adcs %[k0], %[hi], xzr\n"
+    "adc %[k2], xzr, xzr\n"
+    "adds %[k1], %[k1], %[lo]\n"
+    "adcs %[k0], %[k0], %[hi]\n"
+    "adc %[k2], %[k2], xzr\n"
+    /* extract(l[1]) */
+    "str %[k1], [%[l], #8]\n"
+    /* muladd2(a0, a2) */
+    "mul %[lo], %[a0], %[a2]\n"
+    "umulh %[hi], %[a0], %[a2]\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k2], %[k2], %[hi]\n"
+    "adc %[k1], xzr, xzr\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k2], %[k2], %[hi]\n"
+    "adc %[k1], %[k1], xzr\n"
+    /* muladd(a1, a1) */
+    "mul %[lo], %[a1], %[a1]\n"
+    "umulh %[hi], %[a1], %[a1]\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k2], %[k2], %[hi]\n"
+    "adc %[k1], %[k1], xzr\n"
+    /* extract(l[2]) */
+    "str %[k0], [%[l], #16]\n"
+    /* muladd2(a0, a3) */
+    "mul %[lo], %[a0], %[a3]\n"
+    "umulh %[hi], %[a0], %[a3]\n"
+    "adds %[k2], %[k2], %[lo]\n"
+    "adcs %[k1], %[k1], %[hi]\n"
+    "adc %[k0], xzr, xzr\n"
+    "adds %[k2], %[k2], %[lo]\n"
+    "adcs %[k1], %[k1], %[hi]\n"
+    "adc %[k0], %[k0], xzr\n"
+    /* muladd2(a1, a2) */
+    "mul %[lo], %[a1], %[a2]\n"
+    "umulh %[hi], %[a1], %[a2]\n"
+    "adds %[k2], %[k2], %[lo]\n"
+    "adcs %[k1], %[k1], %[hi]\n"
+    "adc %[k0], %[k0], xzr\n"
+    "adds %[k2], %[k2], %[lo]\n"
+    "adcs %[k1], %[k1], %[hi]\n"
+    "adc %[k0], %[k0], xzr\n"
+    /* extract(l[3]) */
+    "str %[k2], [%[l], #24]\n"
+    /* muladd2(a1, a3) */
+    "mul %[lo], %[a1], %[a3]\n"
+    "umulh %[hi], %[a1], %[a3]\n"
+    "adds %[k1], %[k1], %[lo]\n"
+    "adcs %[k0], %[k0], %[hi]\n"
+    "adc %[k2], xzr, xzr\n"
+    "adds %[k1], %[k1], %[lo]\n"
+    "adcs %[k0], %[k0], %[hi]\n"
+    "adc %[k2], %[k2], xzr\n"
+    /* muladd(a2, a2) */
+    "mul %[lo], %[a2], %[a2]\n"
+    "umulh %[hi], %[a2], %[a2]\n"
+    "adds %[k1], %[k1], %[lo]\n"
+    "adcs %[k0], %[k0], %[hi]\n"
+    "adc %[k2], %[k2], xzr\n"
+    /* extract(l[4]) */
+    "str %[k1], [%[l], #32]\n"
+    /* muladd2(a2, a3) */
+    "mul %[lo], %[a2], %[a3]\n"
+    "umulh %[hi], %[a2], %[a3]\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k2], %[k2], %[hi]\n"
+    "adc %[k1], xzr, xzr\n"
+    "adds %[k0], %[k0], %[lo]\n"
+    "adcs %[k2], %[k2], %[hi]\n"
+    "adc %[k1], %[k1], xzr\n"
+    /* extract(l[5]) */
+    "str %[k0], [%[l], #40]\n"
+    /* muladd_fast(a3, a3) */
+    "mul %[lo], %[a3], %[a3]\n"
+    "umulh %[hi], %[a3], %[a3]\n"
+    "adds %[k2], %[k2], %[lo]\n"
+    "adc %[k1], %[k1], %[hi]\n"
+    /* extract_fast(l[6]) */
+    "str %[k2], [%[l], #48]\n"
+    /* l[7] = c0 */
+    "str %[k1], [%[l], #56]\n"
+    : [k0]"=&r"(k0), [k1]"=&r"(k1), [k2]"=&r"(k2), [lo]"=&r"(lo), [hi]"=&r"(hi)
+    : [a0]"r"(a0), [a1]"r"(a1), [a2]"r"(a2), [a3]"r"(a3), [l]"r"(l)
+    : "cc", "memory");
 #else
     /* 160 bit accumulator. */
     uint64_t c0 = 0, c1 = 0;
@@ -879,6 +1289,7 @@ static void secp256k1_scalar_sqr_512(uint64_t l[8], const secp256k1_scalar *a) {
     l[7] = c0;
 #endif
 }
+#endif
 
 #undef sumadd
 #undef sumadd_fast
@@ -906,11 +1317,13 @@ static int secp256k1_scalar_shr_int(secp256k1_scalar *r, int n) {
     return ret;
 }
 
+#if !defined(USE_SCALAR_INV_SAFEGCD)
 static void secp256k1_scalar_sqr(secp256k1_scalar *r, const secp256k1_scalar *a) {
     uint64_t l[8];
     secp256k1_scalar_sqr_512(l, a);
     secp256k1_scalar_reduce_512(r, l);
 }
+#endif
 
 #ifdef USE_ENDOMORPHISM
 static void secp256k1_scalar_split_128(secp256k1_scalar *r1, secp256k1_scalar *r2, const secp256k1_scalar *a) {
@@ -946,4 +1359,73 @@ SECP256K1_INLINE static void secp256k1_scalar_mul_shift_var(secp256k1_scalar *r,
     secp256k1_scalar_cadd_bit(r, 0, (l[(shift - 1) >> 6] >> ((shift - 1) & 0x3f)) & 1);
 }
 
+#if defined(USE_SCALAR_INV_SAFEGCD)
+static void secp256k1_scalar_from_signed62(secp256k1_scalar *r, const secp256k1_modinv64_signed62 *a) {
+    const uint64_t a0 = a->v[0], a1 = a->v[1], a2 = a->v[2], a3 = a->v[3], a4 = a->v[4];
+
+    /* The output from secp256k1_modinv64{_var} should be normalized to range [0,modulus), and
+     * have limbs in [0,2^62). The modulus is < 2^256, so the top limb must be below 2^(256-62*4).
+     */
+    VERIFY_CHECK(a0 >> 62 == 0);
+    VERIFY_CHECK(a1 >> 62 == 0);
+    VERIFY_CHECK(a2 >> 62 == 0);
+    VERIFY_CHECK(a3 >> 62 == 0);
+    VERIFY_CHECK(a4 >> 8 == 0);
+
+    r->d[0] = a0      | a1 << 62;
+    r->d[1] = a1 >> 2 | a2 << 60;
+    r->d[2] = a2 >> 4 | a3 << 58;
+    r->d[3] = a3 >> 6 | a4 << 56;
+
+    VERIFY_CHECK(secp256k1_scalar_check_overflow(r) == 0);
+}
+
+static void secp256k1_scalar_to_signed62(secp256k1_modinv64_signed62 *r, const secp256k1_scalar *a) {
+    const uint64_t M62 = UINT64_MAX >> 2;
+    const uint64_t a0 = a->d[0], a1 = a->d[1], a2 = a->d[2], a3 = a->d[3];
+
+    VERIFY_CHECK(secp256k1_scalar_check_overflow(a) == 0);
+
+    r->v[0] =  a0                   & M62;
+    r->v[1] = (a0 >> 62 | a1 <<  2) & M62;
+    r->v[2] = (a1 >> 60 | a2 <<  4) & M62;
+    r->v[3] = (a2 >> 58 | a3 <<  6) & M62;
+    r->v[4] =  a3 >> 56;
+}
+
+/* The group order n in signed62 notation, and n^{-1} mod 2^62. */
+static const secp256k1_modinv64_modinfo secp256k1_const_modinfo_scalar = {
+    {{0x3FD25E8CD0364141LL, 0x2ABB739ABD2280EELL, -0x15LL, 0, 256}},
+    0x34F20099AA774EC1LL
+};
+
+static void secp256k1_scalar_inverse_safegcd(secp256k1_scalar *r, const secp256k1_scalar *x) {
+    secp256k1_modinv64_signed62 s;
+#ifdef VERIFY
+    int zero_in = secp256k1_scalar_is_zero(x);
+#endif
+    secp256k1_scalar_to_signed62(&s, x);
+    secp256k1_modinv64(&s, &secp256k1_const_modinfo_scalar);
+    secp256k1_scalar_from_signed62(r, &s);
+
+#ifdef VERIFY
+    VERIFY_CHECK(secp256k1_scalar_is_zero(r) == zero_in);
+#endif
+}
+
+static void secp256k1_scalar_inverse_safegcd_var(secp256k1_scalar *r, const secp256k1_scalar *x) {
+    secp256k1_modinv64_signed62 s;
+#ifdef VERIFY
+    int zero_in = secp256k1_scalar_is_zero(x);
+#endif
+    secp256k1_scalar_to_signed62(&s, x);
+    secp256k1_modinv64_var(&s, &secp256k1_const_modinfo_scalar);
+    secp256k1_scalar_from_signed62(r, &s);
+
+#ifdef VERIFY
+    VERIFY_CHECK(secp256k1_scalar_is_zero(r) == zero_in);
+#endif
+}
+#endif
+
 #endif /* SECP256K1_SCALAR_REPR_IMPL_H */
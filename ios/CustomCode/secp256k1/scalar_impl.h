@@ -24,6 +24,10 @@
 #error "Please select scalar implementation"
 #endif
 
+#if defined(USE_SCALAR_INV_SAFEGCD) && !defined(USE_SCALAR_4X64) && !defined(EXHAUSTIVE_TEST_ORDER)
+#error "USE_SCALAR_INV_SAFEGCD requires USE_SCALAR_4X64"
+#endif
+
 #ifndef USE_NUM_NONE
 static void secp256k1_scalar_get_num(secp256k1_num *r, const secp256k1_scalar *a) {
     unsigned char c[32];
@@ -63,6 +67,9 @@ static void secp256k1_scalar_inverse(secp256k1_scalar *r, const secp256k1_scalar
      * have a composite group order; fix it in exhaustive_tests.c). */
     VERIFY_CHECK(*r != 0);
 }
+#else
+#if defined(USE_SCALAR_INV_SAFEGCD)
+    secp256k1_scalar_inverse_safegcd(r, x);
 #else
     secp256k1_scalar *t;
     int i;
@@ -215,6 +222,7 @@ static void secp256k1_scalar_inverse(secp256k1_scalar *r, const secp256k1_scalar
         secp256k1_scalar_sqr(t, t);
     }
     secp256k1_scalar_mul(r, t, &x6); /* 111111 */
+#endif
 }
 
 SECP256K1_INLINE static int secp256k1_scalar_is_even(const secp256k1_scalar *a) {
@@ -223,7 +231,9 @@ SECP256K1_INLINE static int secp256k1_scalar_is_even(const secp256k1_scalar *a)
 #endif
 
 static void secp256k1_scalar_inverse_var(secp256k1_scalar *r, const secp256k1_scalar *x) {
-#if defined(USE_SCALAR_INV_BUILTIN)
+#if defined(USE_SCALAR_INV_SAFEGCD) && !defined(EXHAUSTIVE_TEST_ORDER)
+    secp256k1_scalar_inverse_safegcd_var(r, x);
+#elif defined(USE_SCALAR_INV_BUILTIN) || defined(USE_SCALAR_INV_SAFEGCD)
     secp256k1_scalar_inverse(r, x);
 #elif defined(USE_SCALAR_INV_NUM)
     unsigned char b[32];
@@ -294,6 +304,35 @@ static void secp256k1_scalar_split_lambda(secp256k1_scalar *r1, secp256k1_scalar
  * The function below splits a in r1 and r2, such that r1 + lambda * r2 == a (mod order).
  */
 
+#ifdef VERIFY
+/* Check that the split is correct and that both halves (up to sign) fit in 128 bits. The
+ * fixed-size wNAF buffers in secp256k1_ecmult, secp256k1_ecmult_const and the multi-mult
+ * code depend on this bound. */
+static void secp256k1_scalar_split_lambda_verify(const secp256k1_scalar *r1, const secp256k1_scalar *r2, const secp256k1_scalar *a, const secp256k1_scalar *minus_lambda) {
+    secp256k1_scalar s;
+    unsigned char buf[32];
+    int i;
+
+    secp256k1_scalar_mul(&s, r2, minus_lambda);
+    secp256k1_scalar_negate(&s, &s);
+    secp256k1_scalar_add(&s, &s, r1);
+    VERIFY_CHECK(secp256k1_scalar_eq(&s, a));
+
+    s = *r1;
+    secp256k1_scalar_cond_negate(&s, secp256k1_scalar_is_high(&s));
+    secp256k1_scalar_get_b32(buf, &s);
+    for (i = 0; i < 16; i++) {
+        VERIFY_CHECK(buf[i] == 0);
+    }
+    s = *r2;
+    secp256k1_scalar_cond_negate(&s, secp256k1_scalar_is_high(&s));
+    secp256k1_scalar_get_b32(buf, &s);
+    for (i = 0; i < 16; i++) {
+        VERIFY_CHECK(buf[i] == 0);
+    }
+}
+#endif
+
 static void secp256k1_scalar_split_lambda(secp256k1_scalar *r1, secp256k1_scalar *r2, const secp256k1_scalar *a) {
     secp256k1_scalar c1, c2;
     static const secp256k1_scalar minus_lambda = SECP256K1_SCALAR_CONST(
@@ -326,6 +365,9 @@ static void secp256k1_scalar_split_lambda(secp256k1_scalar *r1, secp256k1_scalar
     secp256k1_scalar_add(r2, &c1, &c2);
     secp256k1_scalar_mul(r1, r2, &minus_lambda);
     secp256k1_scalar_add(r1, r1, a);
+#ifdef VERIFY
+    secp256k1_scalar_split_lambda_verify(r1, r2, a, &minus_lambda);
+#endif
 }
 #endif
 #endif
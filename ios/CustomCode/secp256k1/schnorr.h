@@ -14,9 +14,20 @@ static int secp256k1_schnorr_sig_verify(
     const secp256k1_ecmult_context* ctx,
     const unsigned char *sig64,
     secp256k1_ge *pubkey,
+    const secp256k1_ecmult_point_table *pubkey_table,
     const unsigned char *msg32
 );
 
+static int secp256k1_schnorr_sig_verify_batch(
+    const secp256k1_ecmult_context* ctx,
+    const secp256k1_callback* cb,
+    secp256k1_scratch *scratch,
+    const unsigned char * const *sig64,
+    secp256k1_ge *pubkeys,
+    const unsigned char * const *msg32,
+    size_t n
+);
+
 static int secp256k1_schnorr_compute_e(
     secp256k1_scalar* res,
     const unsigned char *r,
@@ -0,0 +1,181 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef SECP256K1_MODULE_SCHNORR_BLIND_MAIN
+#define SECP256K1_MODULE_SCHNORR_BLIND_MAIN
+
+#include "secp256k1_schnorr_blind.h"
+#include "schnorr_impl.h"
+
+/* Layout of secp256k1_schnorr_blind_request. */
+#define SCHNORR_BLIND_A 0       /* blinding factor a, 32 bytes */
+#define SCHNORR_BLIND_RX 32     /* R'.x, 32 bytes */
+#define SCHNORR_BLIND_PUBKEY 64 /* the signer's key as a secp256k1_pubkey */
+#define SCHNORR_BLIND_MSG 128   /* the message hash, 32 bytes */
+#define SCHNORR_BLIND_NEG 160   /* 1 if c = -1 */
+
+int secp256k1_schnorr_blind_request_create(
+    const secp256k1_context* ctx,
+    secp256k1_schnorr_blind_request *request,
+    unsigned char *e32,
+    const unsigned char *pubkey,
+    size_t pubkeylen,
+    const unsigned char *R,
+    size_t Rlen,
+    const unsigned char *msg32,
+    const unsigned char *blind64,
+    const secp256k1_ecmult_fixed_table *pubkey_table
+) {
+    secp256k1_ge P, Rg;
+    secp256k1_gej Rj, bP;
+    secp256k1_scalar a, b, e;
+    secp256k1_pubkey p;
+    int overflow = 0;
+    int ret;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(request != NULL);
+    memset(request, 0, sizeof(*request));
+    ARG_CHECK(e32 != NULL);
+    memset(e32, 0, 32);
+    ARG_CHECK(pubkey != NULL);
+    ARG_CHECK(R != NULL);
+    ARG_CHECK(msg32 != NULL);
+    ARG_CHECK(blind64 != NULL);
+
+    secp256k1_scalar_set_b32(&a, blind64, &overflow);
+    ret = !overflow && !secp256k1_scalar_is_zero(&a);
+    secp256k1_scalar_set_b32(&b, blind64 + 32, &overflow);
+    ret = ret && !overflow && !secp256k1_scalar_is_zero(&b);
+    ret = ret && secp256k1_eckey_pubkey_parse(&P, pubkey, pubkeylen) && secp256k1_eckey_pubkey_parse(&Rg, R, Rlen);
+    if (ret && pubkey_table != NULL) {
+        secp256k1_ge_storage ps;
+        secp256k1_ge_to_storage(&ps, &P);
+        ARG_CHECK(memcmp(&ps, &pubkey_table->point, sizeof(ps)) == 0);
+    }
+    if (ret) {
+        /* R + a*G + b*P, with both secret multiplications in constant time. */
+        secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &Rj, &a);
+        if (pubkey_table != NULL) {
+            secp256k1_ecmult_fixed_table_mul(pubkey_table, &bP, &b);
+        } else {
+            secp256k1_ecmult_const(&bP, &P, &b);
+        }
+        secp256k1_gej_add_var(&Rj, &Rj, &bP, NULL);
+        secp256k1_gej_add_ge_var(&Rj, &Rj, &Rg, NULL);
+        /* Infinity would mean the requester knows the signer's nonce. */
+        ret = !secp256k1_gej_is_infinity(&Rj);
+    }
+    if (ret) {
+        secp256k1_ge_set_gej(&Rg, &Rj);
+        secp256k1_fe_normalize_var(&Rg.x);
+        secp256k1_fe_get_b32(&request->data[SCHNORR_BLIND_RX], &Rg.x);
+        /* Negating R' leaves its x, and so e', unchanged; only c records it. */
+        request->data[SCHNORR_BLIND_NEG] = !secp256k1_fe_is_quad_var(&Rg.y);
+        secp256k1_schnorr_compute_e(&e, &request->data[SCHNORR_BLIND_RX], &P, msg32);
+        if (request->data[SCHNORR_BLIND_NEG]) {
+            secp256k1_scalar_negate(&e, &e);
+        }
+        secp256k1_scalar_add(&e, &e, &b);
+        secp256k1_scalar_get_b32(e32, &e);
+
+        secp256k1_scalar_get_b32(&request->data[SCHNORR_BLIND_A], &a);
+        secp256k1_pubkey_save(&p, &P);
+        memcpy(&request->data[SCHNORR_BLIND_PUBKEY], &p, sizeof(p));
+        memcpy(&request->data[SCHNORR_BLIND_MSG], msg32, 32);
+    }
+
+    secp256k1_scalar_clear(&a);
+    secp256k1_scalar_clear(&b);
+    secp256k1_gej_clear(&bP);
+    return ret;
+}
+
+int secp256k1_schnorr_blind_request_get_nonce(
+    const secp256k1_context* ctx,
+    unsigned char *rx32,
+    int *negated,
+    const secp256k1_schnorr_blind_request *request
+) {
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(rx32 != NULL);
+    ARG_CHECK(negated != NULL);
+    ARG_CHECK(request != NULL);
+    memcpy(rx32, &request->data[SCHNORR_BLIND_RX], 32);
+    *negated = request->data[SCHNORR_BLIND_NEG];
+    return 1;
+}
+
+int secp256k1_schnorr_blind_sign(
+    const secp256k1_context* ctx,
+    unsigned char *s32,
+    const unsigned char *k32,
+    const unsigned char *seckey,
+    const unsigned char *e32
+) {
+    secp256k1_scalar k, x, e;
+    int overflow = 0;
+    int ret;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(s32 != NULL);
+    memset(s32, 0, 32);
+    ARG_CHECK(k32 != NULL);
+    ARG_CHECK(seckey != NULL);
+    ARG_CHECK(e32 != NULL);
+
+    secp256k1_scalar_set_b32(&k, k32, &overflow);
+    ret = !overflow && !secp256k1_scalar_is_zero(&k);
+    secp256k1_scalar_set_b32(&x, seckey, &overflow);
+    ret = ret && !overflow && !secp256k1_scalar_is_zero(&x);
+    if (ret) {
+        secp256k1_scalar_set_b32(&e, e32, NULL);
+        secp256k1_scalar_mul(&e, &e, &x);
+        secp256k1_scalar_add(&e, &e, &k);
+        secp256k1_scalar_get_b32(s32, &e);
+    }
+
+    secp256k1_scalar_clear(&k);
+    secp256k1_scalar_clear(&x);
+    secp256k1_scalar_clear(&e);
+    return ret;
+}
+
+int secp256k1_schnorr_blind_finalize(
+    const secp256k1_context* ctx,
+    unsigned char *sig64,
+    const secp256k1_schnorr_blind_request *request,
+    const unsigned char *s32,
+    int check
+) {
+    secp256k1_scalar s, a;
+    secp256k1_pubkey p;
+    secp256k1_ge P;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(sig64 != NULL);
+    memset(sig64, 0, 64);
+    ARG_CHECK(request != NULL);
+    ARG_CHECK(s32 != NULL);
+    ARG_CHECK(!check || secp256k1_ecmult_context_is_built(&ctx->ecmult_ctx));
+
+    /* s' = c*(s + a) */
+    secp256k1_scalar_set_b32(&s, s32, NULL);
+    secp256k1_scalar_set_b32(&a, &request->data[SCHNORR_BLIND_A], NULL);
+    secp256k1_scalar_add(&s, &s, &a);
+    if (request->data[SCHNORR_BLIND_NEG]) {
+        secp256k1_scalar_negate(&s, &s);
+    }
+    memcpy(sig64, &request->data[SCHNORR_BLIND_RX], 32);
+    secp256k1_scalar_get_b32(sig64 + 32, &s);
+    secp256k1_scalar_clear(&a);
+
+    if (!check) {
+        return 1;
+    }
+    memcpy(&p, &request->data[SCHNORR_BLIND_PUBKEY], sizeof(p));
+    return secp256k1_pubkey_load(ctx, &P, &p) &&
+           secp256k1_schnorr_sig_verify(&ctx->ecmult_ctx, sig64, &P, NULL, &request->data[SCHNORR_BLIND_MSG]);
+}
+
+#endif
@@ -52,6 +52,7 @@ static int secp256k1_schnorr_sig_verify(
     const secp256k1_ecmult_context* ctx,
     const unsigned char *sig64,
     secp256k1_ge *pubkey,
+    const secp256k1_ecmult_point_table *pubkey_table,
     const unsigned char *msg32
 ) {
     secp256k1_gej Pj, Rj;
@@ -80,8 +81,12 @@ static int secp256k1_schnorr_sig_verify(
 
     /* Verify the signature */
     secp256k1_scalar_negate(&e, &e);
-    secp256k1_gej_set_ge(&Pj, pubkey);
-    secp256k1_ecmult(ctx, &Rj, &Pj, &e, &s);
+    if (pubkey_table != NULL) {
+        secp256k1_ecmult_point_table_mul(ctx, &Rj, pubkey_table, &e, &s);
+    } else {
+        secp256k1_gej_set_ge(&Pj, pubkey);
+        secp256k1_ecmult(ctx, &Rj, &Pj, &e, &s);
+    }
     if (secp256k1_gej_is_infinity(&Rj)) {
         return 0;
     }
@@ -100,6 +105,138 @@ static int secp256k1_schnorr_sig_verify(
     return 1;
 }
 
+/**
+ * Batch verification, following "Option 2" above.
+ *
+ * For n signatures (r_i, s_i) on messages m_i by keys P_i, decompress every
+ * r_i into R_i and pick per-signature coefficients a_i (with a_0 = 1). The
+ * whole batch is valid iff
+ *
+ *   sum(a_i * R_i) + sum(a_i * e_i * P_i) - (sum(a_i * s_i)) * G == 0
+ *
+ * which costs a single multi-scalar multiplication over 2n points, done with
+ * secp256k1_ecmult_multi_var in the given scratch space. The a_i
+ * are derived by hashing every signature, message and public key in the
+ * batch, so they cannot be chosen by whoever produced the signatures; a
+ * forged signature slips through with probability about 2^-128.
+ *
+ * Returns 1 only if every signature in the batch is valid. On 0 the caller
+ * has to fall back to secp256k1_schnorr_sig_verify to learn which one failed.
+ */
+typedef struct {
+    const secp256k1_ge *points;
+    const secp256k1_scalar *scalars;
+} secp256k1_schnorr_verify_batch_data;
+
+static int secp256k1_schnorr_verify_batch_ecmult_callback(secp256k1_scalar *sc, secp256k1_ge *pt, size_t idx, void *data) {
+    const secp256k1_schnorr_verify_batch_data *d = (const secp256k1_schnorr_verify_batch_data*)data;
+    *sc = d->scalars[idx];
+    *pt = d->points[idx];
+    return 1;
+}
+
+static int secp256k1_schnorr_sig_verify_batch(
+    const secp256k1_ecmult_context* ctx,
+    const secp256k1_callback* cb,
+    secp256k1_scratch *scratch,
+    const unsigned char * const *sig64,
+    secp256k1_ge *pubkeys,
+    const unsigned char * const *msg32,
+    size_t n
+) {
+    secp256k1_sha256 sha;
+    unsigned char seed[32];
+    unsigned char buf[33];
+    secp256k1_ge *points;
+    secp256k1_scalar *scalars;
+    secp256k1_schnorr_verify_batch_data data;
+    secp256k1_scalar sum_s;
+    secp256k1_gej Rj;
+    size_t i;
+    int ret = 1;
+
+    if (n == 0) {
+        return 1;
+    }
+
+    /* Derive the seed for the coefficients from the whole batch. */
+    secp256k1_sha256_initialize(&sha);
+    for (i = 0; i < n; i++) {
+        size_t size;
+        if (secp256k1_ge_is_infinity(&pubkeys[i])) {
+            return 0;
+        }
+        secp256k1_sha256_write(&sha, sig64[i], 64);
+        secp256k1_sha256_write(&sha, msg32[i], 32);
+        secp256k1_eckey_pubkey_serialize(&pubkeys[i], buf, &size, 1);
+        VERIFY_CHECK(size == 33);
+        secp256k1_sha256_write(&sha, buf, 33);
+    }
+    secp256k1_sha256_finalize(&sha, seed);
+
+    points = (secp256k1_ge*)checked_malloc(cb, sizeof(secp256k1_ge) * 2 * n);
+    scalars = (secp256k1_scalar*)checked_malloc(cb, sizeof(secp256k1_scalar) * 2 * n);
+    secp256k1_scalar_set_int(&sum_s, 0);
+
+    for (i = 0; i < n && ret; i++) {
+        secp256k1_scalar a, e, s;
+        secp256k1_fe Rx;
+        secp256k1_ge R;
+        int overflow = 0;
+
+        /* Extract s */
+        secp256k1_scalar_set_b32(&s, sig64[i] + 32, &overflow);
+        if (overflow) {
+            ret = 0;
+            break;
+        }
+
+        /* Extract R.x and lift it to the point with a quadratic residue Y */
+        if (!secp256k1_fe_set_b32(&Rx, sig64[i]) || !secp256k1_ge_set_xquad(&R, &Rx)) {
+            ret = 0;
+            break;
+        }
+
+        /* Compute the coefficient a_i = H(seed || i), with a_0 = 1 */
+        if (i == 0) {
+            secp256k1_scalar_set_int(&a, 1);
+        } else {
+            unsigned char idx[8];
+            size_t j;
+            for (j = 0; j < 8; j++) {
+                idx[j] = (unsigned char)(((uint64_t)i) >> (8 * j));
+            }
+            secp256k1_sha256_initialize(&sha);
+            secp256k1_sha256_write(&sha, seed, 32);
+            secp256k1_sha256_write(&sha, idx, 8);
+            secp256k1_sha256_finalize(&sha, buf);
+            secp256k1_scalar_set_b32(&a, buf, NULL);
+        }
+
+        /* Compute e */
+        secp256k1_schnorr_compute_e(&e, sig64[i], &pubkeys[i], msg32[i]);
+
+        points[2 * i] = R;
+        scalars[2 * i] = a;
+        points[2 * i + 1] = pubkeys[i];
+        secp256k1_scalar_mul(&scalars[2 * i + 1], &a, &e);
+        secp256k1_scalar_mul(&s, &s, &a);
+        secp256k1_scalar_add(&sum_s, &sum_s, &s);
+    }
+
+    if (ret) {
+        secp256k1_scalar_negate(&sum_s, &sum_s);
+        data.points = points;
+        data.scalars = scalars;
+        ret = secp256k1_ecmult_multi_var(cb, ctx, scratch, &Rj, &sum_s, secp256k1_schnorr_verify_batch_ecmult_callback, &data, 2 * n) &&
+              secp256k1_gej_is_infinity(&Rj);
+    }
+
+    free(scalars);
+    free(points);
+    return ret;
+}
+
 static int secp256k1_schnorr_compute_e(
     secp256k1_scalar* e,
     const unsigned char *r,
@@ -13,6 +13,9 @@
 #include "secp256k1_schnorr.h"
 #include "schnorr_impl.h"
 
+/** Upper bound on the scratch space secp256k1_schnorr_verify_batch allocates. */
+#define SECP256K1_SCHNORR_BATCH_MAX_SCRATCH (4 * 1024 * 1024)
+
 int secp256k1_schnorr_verify(
     const secp256k1_context* ctx,
     const unsigned char *sig64,
@@ -27,7 +30,50 @@ int secp256k1_schnorr_verify(
     ARG_CHECK(pubkey != NULL);
 
     secp256k1_pubkey_load(ctx, &q, pubkey);
-    return secp256k1_schnorr_sig_verify(&ctx->ecmult_ctx, sig64, &q, msg32);
+    return secp256k1_schnorr_sig_verify(&ctx->ecmult_ctx, sig64, &q, NULL, msg32);
+}
+
+int secp256k1_schnorr_verify_batch(
+    const secp256k1_context* ctx,
+    const unsigned char * const *sig64,
+    const unsigned char * const *msg32,
+    const secp256k1_pubkey * const *pubkeys,
+    size_t n
+) {
+    secp256k1_ge *q;
+    secp256k1_scratch *scratch;
+    size_t i;
+    int ret = 1;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_context_is_built(&ctx->ecmult_ctx));
+    ARG_CHECK(n == 0 || msg32 != NULL);
+    ARG_CHECK(n == 0 || sig64 != NULL);
+    ARG_CHECK(n == 0 || pubkeys != NULL);
+
+    if (n == 0) {
+        return 1;
+    }
+
+    q = (secp256k1_ge*)checked_malloc(&ctx->error_callback, sizeof(secp256k1_ge) * n);
+    for (i = 0; i < n; i++) {
+        if (!secp256k1_pubkey_load(ctx, &q[i], pubkeys[i])) {
+            ret = 0;
+            break;
+        }
+    }
+    if (ret) {
+        /* Enough scratch for the whole batch in one go, up to a cap beyond
+         * which secp256k1_ecmult_multi_var works in several batches. */
+        size_t scratch_size = secp256k1_ecmult_multi_scratch_size(2 * n);
+        if (scratch_size > SECP256K1_SCHNORR_BATCH_MAX_SCRATCH) {
+            scratch_size = SECP256K1_SCHNORR_BATCH_MAX_SCRATCH;
+        }
+        scratch = secp256k1_scratch_create(&ctx->error_callback, scratch_size);
+        ret = secp256k1_schnorr_sig_verify_batch(&ctx->ecmult_ctx, &ctx->error_callback, scratch, sig64, q, msg32, n);
+        secp256k1_scratch_destroy(&ctx->error_callback, scratch);
+    }
+    free(q);
+    return ret;
 }
 
 int secp256k1_schnorr_sign(
@@ -63,4 +109,53 @@ int secp256k1_schnorr_sign(
     return ret;
 }
 
+int secp256k1_schnorr_sign_batch(
+    const secp256k1_context *ctx,
+    unsigned char *sig64,
+    const unsigned char *msg32,
+    size_t n,
+    const unsigned char *seckey,
+    const secp256k1_pubkey *pubkey_hint,
+    secp256k1_nonce_function noncefp,
+    const void *ndata
+) {
+    secp256k1_scalar sec;
+    secp256k1_pubkey pubkey;
+    secp256k1_ge p;
+    size_t i;
+    int ret = 1;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(n == 0 || msg32 != NULL);
+    ARG_CHECK(n == 0 || sig64 != NULL);
+    ARG_CHECK(seckey != NULL);
+
+    if (!secp256k1_ec_pubkey_create(ctx, &pubkey, seckey)) {
+        ret = 0;
+    } else if (pubkey_hint != NULL && memcmp(&pubkey, pubkey_hint, sizeof(pubkey)) != 0) {
+        /* The deterministic nonce does not depend on P, so signing the same
+         * message under a wrong P would reuse k with a different e and leak
+         * the key. Never sign with a hint we have not checked. */
+        ret = 0;
+    }
+    if (!ret) {
+        if (n > 0) {
+            memset(sig64, 0, 64 * n);
+        }
+        return 0;
+    }
+
+    secp256k1_pubkey_load(ctx, &p, &pubkey);
+    secp256k1_scalar_set_b32(&sec, seckey, NULL);
+    for (i = 0; i < n; i++) {
+        if (!secp256k1_schnorr_sig_sign(&ctx->ecmult_gen_ctx, sig64 + 64 * i, msg32 + 32 * i, &sec, &p, noncefp, ndata)) {
+            memset(sig64 + 64 * i, 0, 64);
+            ret = 0;
+        }
+    }
+
+    secp256k1_scalar_clear(&sec);
+    return ret;
+}
+
 #endif
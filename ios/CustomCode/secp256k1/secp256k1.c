@@ -28,6 +28,7 @@
 #include "ecdsa_impl.h"
 #include "eckey_impl.h"
 #include "hash_impl.h"
+#include "scratch_impl.h"
 
 #define ARG_CHECK(cond) do { \
     if (EXPECT(!(cond), 0)) { \
@@ -71,6 +72,8 @@ secp256k1_context* secp256k1_context_create(unsigned int flags) {
     ret->illegal_callback = default_illegal_callback;
     ret->error_callback = default_error_callback;
 
+    secp256k1_sha256_select_transform();
+
     if (EXPECT((flags & SECP256K1_FLAGS_TYPE_MASK) != SECP256K1_FLAGS_TYPE_CONTEXT, 0)) {
             secp256k1_callback_call(&ret->illegal_callback,
                                     "Invalid flags");
@@ -125,6 +128,16 @@ void secp256k1_context_set_error_callback(secp256k1_context* ctx, void (*fun)(co
     ctx->error_callback.data = data;
 }
 
+secp256k1_scratch_space* secp256k1_scratch_space_create(const secp256k1_context* ctx, size_t max_size) {
+    VERIFY_CHECK(ctx != NULL);
+    return secp256k1_scratch_create(&ctx->error_callback, max_size);
+}
+
+void secp256k1_scratch_space_destroy(const secp256k1_context *ctx, secp256k1_scratch_space* scratch) {
+    VERIFY_CHECK(ctx != NULL);
+    secp256k1_scratch_destroy(&ctx->error_callback, scratch);
+}
+
 static int secp256k1_pubkey_load(const secp256k1_context* ctx, secp256k1_ge* ge, const secp256k1_pubkey* pubkey) {
     if (sizeof(secp256k1_ge_storage) == 64) {
         /* When the secp256k1_ge_storage type is exactly 64 byte, use its
@@ -315,7 +328,7 @@ int secp256k1_ecdsa_verify(const secp256k1_context* ctx, const secp256k1_ecdsa_s
     secp256k1_ecdsa_signature_load(ctx, &r, &s, sig);
     return (!secp256k1_scalar_is_high(&s) &&
             secp256k1_pubkey_load(ctx, &q, pubkey) &&
-            secp256k1_ecdsa_sig_verify(&ctx->ecmult_ctx, &r, &s, &q, &m));
+            secp256k1_ecdsa_sig_verify(&ctx->ecmult_ctx, &r, &s, &q, NULL, &m));
 }
 
 static SECP256K1_INLINE void buffer_append(unsigned char *buf, unsigned int *offset, const void *data, unsigned int len) {
@@ -403,6 +416,38 @@ int secp256k1_ecdsa_sign(const secp256k1_context* ctx, secp256k1_ecdsa_signature
     return ret;
 }
 
+/* Attempts secp256k1_ecdsa_sign_grind makes before giving up. */
+#define SECP256K1_ECDSA_GRIND_MAX_TRIES 65536
+
+int secp256k1_ecdsa_sign_grind(const secp256k1_context* ctx, secp256k1_ecdsa_signature *signature, const unsigned char *msg32, const unsigned char *seckey, size_t max_der_len) {
+    unsigned char ndata[32];
+    unsigned char der[72];
+    size_t derlen;
+    unsigned int counter;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(msg32 != NULL);
+    ARG_CHECK(signature != NULL);
+    ARG_CHECK(seckey != NULL);
+
+    memset(ndata, 0, sizeof(ndata));
+    for (counter = 0; counter < SECP256K1_ECDSA_GRIND_MAX_TRIES; counter++) {
+        ndata[0] = counter & 0xFF;
+        ndata[1] = (counter >> 8) & 0xFF;
+        ndata[2] = (counter >> 16) & 0xFF;
+        ndata[3] = (counter >> 24) & 0xFF;
+        if (!secp256k1_ecdsa_sign(ctx, signature, msg32, seckey, secp256k1_nonce_function_rfc6979, counter ? ndata : NULL)) {
+            return 0;
+        }
+        derlen = sizeof(der);
+        if (secp256k1_ecdsa_signature_serialize_der(ctx, der, &derlen, signature) && derlen <= max_der_len) {
+            return 1;
+        }
+    }
+    memset(signature, 0, sizeof(*signature));
+    return 0;
+}
+
 int secp256k1_ec_seckey_verify(const secp256k1_context* ctx, const unsigned char *seckey) {
     secp256k1_scalar sec;
     int ret;
@@ -439,6 +484,52 @@ int secp256k1_ec_pubkey_create(const secp256k1_context* ctx, secp256k1_pubkey *p
     return ret;
 }
 
+int secp256k1_ec_pubkey_create_batch(const secp256k1_context* ctx, unsigned char *output, size_t outputlen, const unsigned char *seckeys, size_t n, unsigned int flags) {
+    secp256k1_gej *pj;
+    secp256k1_fe *zs;
+    secp256k1_scalar *secs;
+    unsigned char *valid;
+    size_t i;
+    int overflow;
+    int ret = 1;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK((flags & SECP256K1_FLAGS_TYPE_MASK) == SECP256K1_FLAGS_TYPE_COMPRESSION);
+    ARG_CHECK(outputlen == ((flags & SECP256K1_FLAGS_BIT_COMPRESSION) ? 33 : 65));
+    if (n == 0) {
+        return 1;
+    }
+    ARG_CHECK(output != NULL);
+    ARG_CHECK(seckeys != NULL);
+
+    pj = (secp256k1_gej *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_gej) * n);
+    zs = (secp256k1_fe *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_fe) * n);
+    secs = (secp256k1_scalar *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_scalar) * n);
+    valid = (unsigned char *)checked_malloc(&ctx->error_callback, n);
+    for (i = 0; i < n; i++) {
+        secp256k1_scalar_set_b32(&secs[i], seckeys + 32 * i, &overflow);
+        valid[i] = (!overflow) & (!secp256k1_scalar_is_zero(&secs[i]));
+        if (!valid[i]) {
+            /* Keep the batch free of infinities; this output is zeroed below. */
+            secp256k1_scalar_set_int(&secs[i], 1);
+            ret = 0;
+        }
+    }
+    secp256k1_ecmult_gen_many(&ctx->ecmult_gen_ctx, pj, secs, n);
+    memset(secs, 0, sizeof(secp256k1_scalar) * n);
+    free(secs);
+    secp256k1_eckey_pubkey_serialize_batch(pj, zs, n, output, outputlen, flags & SECP256K1_FLAGS_BIT_COMPRESSION);
+    for (i = 0; i < n; i++) {
+        if (!valid[i]) {
+            memset(output + i * outputlen, 0, outputlen);
+        }
+    }
+    free(valid);
+    free(zs);
+    free(pj);
+    return ret;
+}
+
 int secp256k1_ec_privkey_negate(const secp256k1_context* ctx, unsigned char *seckey) {
     secp256k1_scalar sec;
     VERIFY_CHECK(ctx != NULL);
@@ -513,6 +604,65 @@ int secp256k1_ec_pubkey_tweak_add(const secp256k1_context* ctx, secp256k1_pubkey
     return ret;
 }
 
+int secp256k1_ec_pubkey_tweak_add_batch(const secp256k1_context* ctx, unsigned char *output, size_t outputlen, const secp256k1_pubkey *pubkey, const unsigned char *tweaks, size_t n, unsigned int flags) {
+    secp256k1_ge p;
+    secp256k1_gej *pj;
+    secp256k1_fe *zs;
+    secp256k1_scalar *terms;
+    unsigned char *valid;
+    size_t i;
+    int overflow;
+    int ret = 1;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK((flags & SECP256K1_FLAGS_TYPE_MASK) == SECP256K1_FLAGS_TYPE_COMPRESSION);
+    ARG_CHECK(outputlen == ((flags & SECP256K1_FLAGS_BIT_COMPRESSION) ? 33 : 65));
+    ARG_CHECK(pubkey != NULL);
+    if (n == 0) {
+        return 1;
+    }
+    ARG_CHECK(output != NULL);
+    ARG_CHECK(tweaks != NULL);
+
+    if (!secp256k1_pubkey_load(ctx, &p, pubkey)) {
+        memset(output, 0, n * outputlen);
+        return 0;
+    }
+    pj = (secp256k1_gej *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_gej) * n);
+    zs = (secp256k1_fe *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_fe) * n);
+    terms = (secp256k1_scalar *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_scalar) * n);
+    valid = (unsigned char *)checked_malloc(&ctx->error_callback, n);
+    for (i = 0; i < n; i++) {
+        secp256k1_scalar_set_b32(&terms[i], tweaks + 32 * i, &overflow);
+        valid[i] = !overflow;
+        if (overflow) {
+            secp256k1_scalar_clear(&terms[i]);
+        }
+    }
+    /* The comb is much faster than the wNAF ecmult for a lone G multiple. */
+    secp256k1_ecmult_gen_many(&ctx->ecmult_gen_ctx, pj, terms, n);
+    free(terms);
+    for (i = 0; i < n; i++) {
+        secp256k1_gej_add_ge_var(&pj[i], &pj[i], &p, NULL);
+        valid[i] = valid[i] && !secp256k1_gej_is_infinity(&pj[i]);
+        if (!valid[i]) {
+            /* Keep the batch free of infinities; this output is zeroed below. */
+            secp256k1_gej_set_ge(&pj[i], &p);
+            ret = 0;
+        }
+    }
+    secp256k1_eckey_pubkey_serialize_batch(pj, zs, n, output, outputlen, flags & SECP256K1_FLAGS_BIT_COMPRESSION);
+    for (i = 0; i < n; i++) {
+        if (!valid[i]) {
+            memset(output + i * outputlen, 0, outputlen);
+        }
+    }
+    free(valid);
+    free(zs);
+    free(pj);
+    return ret;
+}
+
 int secp256k1_ec_privkey_tweak_mul(const secp256k1_context* ctx, unsigned char *seckey, const unsigned char *tweak) {
     secp256k1_scalar factor;
     secp256k1_scalar sec;
@@ -559,6 +709,61 @@ int secp256k1_ec_pubkey_tweak_mul(const secp256k1_context* ctx, secp256k1_pubkey
     return ret;
 }
 
+int secp256k1_ec_pubkey_tweak_mul_batch(const secp256k1_context* ctx, unsigned char *output, size_t outputlen, const secp256k1_pubkey *pubkey, const unsigned char *tweaks, size_t n, unsigned int flags) {
+    secp256k1_ge p;
+    secp256k1_gej *pj;
+    secp256k1_fe *zs;
+    secp256k1_ecmult_const_table *t;
+    unsigned char *valid;
+    size_t i;
+    int ret = 1;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK((flags & SECP256K1_FLAGS_TYPE_MASK) == SECP256K1_FLAGS_TYPE_COMPRESSION);
+    ARG_CHECK(outputlen == ((flags & SECP256K1_FLAGS_BIT_COMPRESSION) ? 33 : 65));
+    ARG_CHECK(pubkey != NULL);
+    if (n == 0) {
+        return 1;
+    }
+    ARG_CHECK(output != NULL);
+    ARG_CHECK(tweaks != NULL);
+
+    if (!secp256k1_pubkey_load(ctx, &p, pubkey)) {
+        memset(output, 0, n * outputlen);
+        return 0;
+    }
+    pj = (secp256k1_gej *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_gej) * n);
+    zs = (secp256k1_fe *)checked_malloc(&ctx->error_callback, sizeof(secp256k1_fe) * n);
+    t = (secp256k1_ecmult_const_table *)checked_malloc(&ctx->error_callback, sizeof(*t));
+    valid = (unsigned char *)checked_malloc(&ctx->error_callback, n);
+    secp256k1_ecmult_const_table_build(t, &p);
+    for (i = 0; i < n; i++) {
+        SECP256K1_STATS_BEGIN(ticks)
+        secp256k1_scalar factor;
+        int overflow;
+        secp256k1_scalar_set_b32(&factor, tweaks + 32 * i, &overflow);
+        valid[i] = !overflow && !secp256k1_scalar_is_zero(&factor);
+        if (!valid[i]) {
+            /* Keep the batch free of infinities; this output is zeroed below. */
+            secp256k1_scalar_set_int(&factor, 1);
+            ret = 0;
+        }
+        secp256k1_ecmult_const_table_mul(&pj[i], t, &factor);
+        secp256k1_scalar_clear(&factor);
+        SECP256K1_STATS_END(ECMULT_CONST, ticks);
+    }
+    secp256k1_eckey_pubkey_serialize_batch(pj, zs, n, output, outputlen, flags & SECP256K1_FLAGS_BIT_COMPRESSION);
+    for (i = 0; i < n; i++) {
+        if (!valid[i]) {
+            memset(output + i * outputlen, 0, outputlen);
+        }
+    }
+    free(valid);
+    free(t);
+    free(zs);
+    free(pj);
+    return ret;
+}
+
 int secp256k1_context_randomize(secp256k1_context* ctx, const unsigned char *seed32) {
     VERIFY_CHECK(ctx != NULL);
     ARG_CHECK(secp256k1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
@@ -566,6 +771,28 @@ int secp256k1_context_randomize(secp256k1_context* ctx, const unsigned char *see
     return 1;
 }
 
+int secp256k1_context_get_stats(const secp256k1_context* ctx, secp256k1_context_stats *stats, int reset) {
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(stats != NULL);
+    memset(stats, 0, sizeof(*stats));
+#ifdef ENABLE_STATS
+#define READ_STAT(which) (reset ? SECP256K1_STATS_XCHG(secp256k1_stats_##which) : SECP256K1_STATS_LOAD(secp256k1_stats_##which))
+    stats->ecmult = READ_STAT(counts[SECP256K1_STAT_ECMULT]);
+    stats->ecmult_const = READ_STAT(counts[SECP256K1_STAT_ECMULT_CONST]);
+    stats->ecmult_gen = READ_STAT(counts[SECP256K1_STAT_ECMULT_GEN]);
+    stats->fe_inv = READ_STAT(counts[SECP256K1_STAT_FE_INV]);
+    stats->fe_sqrt = READ_STAT(counts[SECP256K1_STAT_FE_SQRT]);
+    stats->ecmult_ticks = READ_STAT(ticks[SECP256K1_STAT_ECMULT]);
+    stats->ecmult_const_ticks = READ_STAT(ticks[SECP256K1_STAT_ECMULT_CONST]);
+    stats->ecmult_gen_ticks = READ_STAT(ticks[SECP256K1_STAT_ECMULT_GEN]);
+#undef READ_STAT
+    return 1;
+#else
+    (void)reset;
+    return 0;
+#endif
+}
+
 int secp256k1_ec_pubkey_combine(const secp256k1_context* ctx, secp256k1_pubkey *pubnonce, const secp256k1_pubkey * const *pubnonces, size_t n) {
     size_t i;
     secp256k1_gej Qj;
@@ -590,6 +817,98 @@ int secp256k1_ec_pubkey_combine(const secp256k1_context* ctx, secp256k1_pubkey *
     return 1;
 }
 
+int secp256k1_sha256d64_multi(const secp256k1_context* ctx, unsigned char *output, const unsigned char *input, size_t n) {
+    VERIFY_CHECK(ctx != NULL);
+    if (n == 0) {
+        return 1;
+    }
+    ARG_CHECK(output != NULL);
+    ARG_CHECK(input != NULL);
+    secp256k1_sha256d64(output, input, n);
+    return 1;
+}
+
+int secp256k1_merkle_roots(const secp256k1_context* ctx, unsigned char *roots, const unsigned char *leaves, const unsigned char *branches, const size_t *branchlens, const size_t *positions, size_t n) {
+    const unsigned char **branch;
+    unsigned char *in, *out;
+    size_t i, m, level, total = 0, depth = 0;
+    VERIFY_CHECK(ctx != NULL);
+    if (n == 0) {
+        return 1;
+    }
+    ARG_CHECK(roots != NULL);
+    ARG_CHECK(leaves != NULL);
+    ARG_CHECK(branchlens != NULL);
+    ARG_CHECK(positions != NULL);
+    for (i = 0; i < n; i++) {
+        total += branchlens[i];
+        depth = branchlens[i] > depth ? branchlens[i] : depth;
+    }
+    ARG_CHECK(branches != NULL || total == 0);
+
+    memcpy(roots, leaves, 32 * n);
+    /* Where each transaction's branch starts. */
+    branch = (const unsigned char **)checked_malloc(&ctx->error_callback, sizeof(*branch) * n);
+    in = (unsigned char *)checked_malloc(&ctx->error_callback, 64 * n);
+    out = (unsigned char *)checked_malloc(&ctx->error_callback, 32 * n);
+    for (i = 0; i < n; i++) {
+        branch[i] = branches;
+        branches += 32 * branchlens[i];
+    }
+    for (level = 0; level < depth; level++) {
+        for (i = 0, m = 0; i < n; i++) {
+            if (level < branchlens[i]) {
+                const int right = level < 8 * sizeof(size_t) && ((positions[i] >> level) & 1);
+                memcpy(in + 64 * m + (right ? 32 : 0), roots + 32 * i, 32);
+                memcpy(in + 64 * m + (right ? 0 : 32), branch[i] + 32 * level, 32);
+                m++;
+            }
+        }
+        secp256k1_sha256d64(out, in, m);
+        for (i = 0, m = 0; i < n; i++) {
+            if (level < branchlens[i]) {
+                memcpy(roots + 32 * i, out + 32 * m, 32);
+                m++;
+            }
+        }
+    }
+    free(branch);
+    free(in);
+    free(out);
+    return 1;
+}
+
+int secp256k1_sha256d_affixed_multi(const secp256k1_context* ctx, unsigned char *output, const unsigned char *prefix, size_t prefixlen, const unsigned char *middles, const size_t *middlelens, const unsigned char *suffix, size_t suffixlen, size_t n) {
+    secp256k1_sha256 midstate, hash;
+    unsigned char first[32];
+    size_t i;
+    VERIFY_CHECK(ctx != NULL);
+    if (n == 0) {
+        return 1;
+    }
+    ARG_CHECK(output != NULL);
+    ARG_CHECK(prefix != NULL || prefixlen == 0);
+    ARG_CHECK(suffix != NULL || suffixlen == 0);
+    ARG_CHECK(middlelens != NULL);
+
+    secp256k1_sha256_initialize(&midstate);
+    secp256k1_sha256_write(&midstate, prefix, prefixlen);
+    for (i = 0; i < n; i++) {
+        hash = midstate;
+        if (middlelens[i] > 0) {
+            ARG_CHECK(middles != NULL);
+            secp256k1_sha256_write(&hash, middles, middlelens[i]);
+            middles += middlelens[i];
+        }
+        secp256k1_sha256_write(&hash, suffix, suffixlen);
+        secp256k1_sha256_finalize(&hash, first);
+        secp256k1_sha256_initialize(&hash);
+        secp256k1_sha256_write(&hash, first, 32);
+        secp256k1_sha256_finalize(&hash, output + 32 * i);
+    }
+    return 1;
+}
+
 #ifdef ENABLE_MODULE_ECDH
 # include "modules/ecdh/main_impl.h"
 #endif
@@ -606,6 +925,34 @@ int secp256k1_ec_pubkey_combine(const secp256k1_context* ctx, secp256k1_pubkey *
 # include "schnorr_main_impl.h"
 #endif
 
+#ifdef ENABLE_MODULE_RPA
+# include "rpa_main_impl.h"
+#endif
+
+#ifdef ENABLE_MODULE_HEADERS
+# include "headers_main_impl.h"
+#endif
+
+#ifdef ENABLE_MODULE_TX
+# include "tx_main_impl.h"
+#endif
+
+#ifdef ENABLE_MODULE_PUBKEY_CACHE
+# include "pubkey_cache_main_impl.h"
+#endif
+
+#ifdef ENABLE_MODULE_FIXED_TABLE
+# include "fixed_table_main_impl.h"
+#endif
+
+#ifdef ENABLE_MODULE_SCHNORR_BLIND
+# include "schnorr_blind_main_impl.h"
+#endif
+
+#ifdef ENABLE_MODULE_ECIES
+# include "ecies_main_impl.h"
+#endif
+
 #ifdef __clang__
 #pragma clang diagnostic pop
 #endif
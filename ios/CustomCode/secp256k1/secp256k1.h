@@ -6,6 +6,7 @@ extern "C" {
 #endif
 
 #include <stddef.h>
+#include <stdint.h>
 
 /* These rules specify the order of arguments in API calls:
  *
@@ -42,6 +43,19 @@ extern "C" {
  */
 typedef struct secp256k1_context_struct secp256k1_context;
 
+/** Opaque data structure that holds rewriteable "scratch space"
+ *
+ *  The purpose of this structure is to replace dynamic memory allocations,
+ *  because we target architectures where this may not be available. It is
+ *  essentially a fixed-size block of bytes that the multi-scalar
+ *  multiplication routines carve their temporaries out of, so that callers
+ *  verifying many batches can allocate it once and reuse it.
+ *
+ *  Unlike the context object, this cannot safely be shared between threads
+ *  without additional synchronization logic.
+ */
+typedef struct secp256k1_scratch_space_struct secp256k1_scratch_space;
+
 /** Opaque data structure that holds a parsed and valid public key.
  *
  *  The exact representation of data inside is implementation defined and not
@@ -243,6 +257,29 @@ SECP256K1_API void secp256k1_context_set_error_callback(
     const void* data
 ) SECP256K1_ARG_NONNULL(1);
 
+/** Create a secp256k1 scratch space object.
+ *
+ *  Returns: a newly created scratch space.
+ *  Args: ctx:  an existing context object (cannot be NULL)
+ *  In:   size: amount of memory to be available as scratch space. Some extra
+ *              (<100 bytes) will be allocated for extra accounting.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT secp256k1_scratch_space* secp256k1_scratch_space_create(
+    const secp256k1_context* ctx,
+    size_t size
+) SECP256K1_ARG_NONNULL(1);
+
+/** Destroy a secp256k1 scratch space.
+ *
+ *  The pointer may not be used afterwards.
+ *  Args:       ctx: a secp256k1 context object.
+ *          scratch: space to destroy
+ */
+SECP256K1_API void secp256k1_scratch_space_destroy(
+    const secp256k1_context* ctx,
+    secp256k1_scratch_space* scratch
+) SECP256K1_ARG_NONNULL(1);
+
 /** Parse a variable-length public key into the pubkey object.
  *
  *  Returns: 1 if the public key was fully valid.
@@ -468,6 +505,36 @@ SECP256K1_API int secp256k1_ecdsa_sign(
     const void *ndata
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
 
+/** Create an ECDSA signature whose DER encoding is at most max_der_len bytes.
+ *
+ *  The first attempt is the signature secp256k1_ecdsa_sign makes with
+ *  secp256k1_nonce_function_rfc6979 and no extra data; attempt c after it
+ *  passes c as 32 bytes of extra entropy (little-endian in the first four)
+ *  to the same nonce function, as Bitcoin Core does when grinding for low R.
+ *  All attempts are made inside the library, and the first one that fits is
+ *  returned.
+ *
+ *  A low-S signature takes at most 71 bytes and, if R is low too, 70; each
+ *  attempt has an even chance of that. Every byte less needs about 256 times
+ *  more attempts than the one before.
+ *
+ *  Returns: 1: signature created
+ *           0: the private key was invalid, or no attempt of the first 2^16
+ *              fit in max_der_len bytes (expected for a bound below 68)
+ *  Args:    ctx:         pointer to a context object, initialized for signing (cannot be NULL)
+ *  Out:     sig:         pointer to an array where the signature will be placed (cannot be NULL)
+ *  In:      msg32:       the 32-byte message hash being signed (cannot be NULL)
+ *           seckey:      pointer to a 32-byte secret key (cannot be NULL)
+ *           max_der_len: the largest DER encoding to accept; 70 grinds for low R
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ecdsa_sign_grind(
+    const secp256k1_context* ctx,
+    secp256k1_ecdsa_signature *sig,
+    const unsigned char *msg32,
+    const unsigned char *seckey,
+    size_t max_der_len
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
+
 /** Verify an ECDSA secret key.
  *
  *  Returns: 1: secret key is valid
@@ -494,6 +561,35 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ec_pubkey_create(
     const unsigned char *seckey
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
 
+/** Compute and serialize the public keys for n secret keys at once.
+ *
+ *  This is equivalent to calling secp256k1_ec_pubkey_create followed by
+ *  secp256k1_ec_pubkey_serialize for every key, but converts all n results to
+ *  affine coordinates with a single field inversion.
+ *
+ *  Returns: 1: all secret keys were valid and all public keys were written
+ *           0: at least one secret key was invalid; its output is zeroed, the
+ *              others are still written
+ *  Args:   ctx:        pointer to a context object, initialized for signing (cannot be NULL)
+ *  Out:    output:     pointer to an n*outputlen byte array to place the serialized keys in
+ *                      (cannot be NULL unless n is 0)
+ *  In:     outputlen:  size of each serialized key: 33 for SECP256K1_EC_COMPRESSED, 65
+ *                      for SECP256K1_EC_UNCOMPRESSED
+ *          seckeys:    pointer to n consecutive 32-byte private keys (cannot be NULL unless
+ *                      n is 0)
+ *          n:          number of keys
+ *          flags:      SECP256K1_EC_COMPRESSED if serialization should be in
+ *                      compressed format, otherwise SECP256K1_EC_UNCOMPRESSED.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ec_pubkey_create_batch(
+    const secp256k1_context* ctx,
+    unsigned char *output,
+    size_t outputlen,
+    const unsigned char *seckeys,
+    size_t n,
+    unsigned int flags
+) SECP256K1_ARG_NONNULL(1);
+
 /** Negates a private key in place.
  *
  *  Returns: 1 always
@@ -547,6 +643,38 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ec_pubkey_tweak_add(
     const unsigned char *tweak
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
 
+/** Tweak one public key by n different tweaks and serialize the results.
+ *
+ *  Output i receives the serialization of pubkey + tweaks[i]*G. This is the
+ *  public half of BIP32 non-hardened child derivation for a range of indices:
+ *  the caller computes the HMAC-SHA512 tweak for each index and derives all
+ *  the child keys in one call, sharing a single field inversion.
+ *
+ *  Returns: 1: all tweaks were valid and all results were written
+ *           0: the public key could not be loaded, or at least one tweak was
+ *              out of range or produced the point at infinity; those outputs
+ *              are zeroed, the others are still written
+ *  Args:   ctx:        pointer to a context object, initialized for signing (cannot be NULL)
+ *  Out:    output:     pointer to an n*outputlen byte array to place the serialized keys in
+ *                      (cannot be NULL unless n is 0)
+ *  In:     outputlen:  size of each serialized key: 33 for SECP256K1_EC_COMPRESSED, 65
+ *                      for SECP256K1_EC_UNCOMPRESSED
+ *          pubkey:     pointer to the public key to tweak (cannot be NULL)
+ *          tweaks:     pointer to n consecutive 32-byte tweaks (cannot be NULL unless n is 0)
+ *          n:          number of tweaks
+ *          flags:      SECP256K1_EC_COMPRESSED if serialization should be in
+ *                      compressed format, otherwise SECP256K1_EC_UNCOMPRESSED.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ec_pubkey_tweak_add_batch(
+    const secp256k1_context* ctx,
+    unsigned char *output,
+    size_t outputlen,
+    const secp256k1_pubkey *pubkey,
+    const unsigned char *tweaks,
+    size_t n,
+    unsigned int flags
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(4);
+
 /** Tweak a private key by multiplying it by a tweak.
  * Returns: 0 if the tweak was out of range (chance of around 1 in 2^128 for
  *          uniformly random 32-byte arrays, or equal to zero. 1 otherwise.
@@ -574,6 +702,37 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ec_pubkey_tweak_mul(
     const unsigned char *tweak
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
 
+/** Multiply one public key by n different tweaks and serialize the results.
+ *
+ *  Output i receives the serialization of tweaks[i]*pubkey. The odd multiples
+ *  of pubkey are computed once for the whole batch and every multiplication
+ *  runs in constant time, so the tweaks may be secret (ECDH shared secrets).
+ *
+ *  Returns: 1: all tweaks were valid and all results were written
+ *           0: the public key could not be loaded, or at least one tweak was
+ *              zero or out of range; those outputs are zeroed, the others are
+ *              still written
+ *  Args:   ctx:        pointer to a context object (cannot be NULL)
+ *  Out:    output:     pointer to an n*outputlen byte array to place the serialized keys in
+ *                      (cannot be NULL unless n is 0)
+ *  In:     outputlen:  size of each serialized key: 33 for SECP256K1_EC_COMPRESSED, 65
+ *                      for SECP256K1_EC_UNCOMPRESSED
+ *          pubkey:     pointer to the public key to multiply (cannot be NULL)
+ *          tweaks:     pointer to n consecutive 32-byte tweaks (cannot be NULL unless n is 0)
+ *          n:          number of tweaks
+ *          flags:      SECP256K1_EC_COMPRESSED if serialization should be in
+ *                      compressed format, otherwise SECP256K1_EC_UNCOMPRESSED.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ec_pubkey_tweak_mul_batch(
+    const secp256k1_context* ctx,
+    unsigned char *output,
+    size_t outputlen,
+    const secp256k1_pubkey *pubkey,
+    const unsigned char *tweaks,
+    size_t n,
+    unsigned int flags
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(4);
+
 /** Updates the context randomization to protect against side-channel leakage.
  *  Returns: 1: randomization successfully updated
  *           0: error
@@ -598,6 +757,39 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_context_randomize(
     const unsigned char *seed32
 ) SECP256K1_ARG_NONNULL(1);
 
+/** Counts of the library's expensive internal operations since startup (or
+ *  the last reset), kept only when it is built with ENABLE_STATS. The *_ticks
+ *  fields also need ENABLE_STATS_TIMING; their unit is platform-specific (TSC
+ *  cycles on x86, the generic timer on ARM64, nanoseconds elsewhere), so only
+ *  compare them with each other.
+ */
+typedef struct {
+    uint64_t ecmult;             /* a*P + b*G: verification, recovery, tweaks */
+    uint64_t ecmult_const;       /* constant time a*P: RPA, blind Schnorr */
+    uint64_t ecmult_gen;         /* b*G: signing, pubkey creation */
+    uint64_t fe_inv;             /* field inversions, both variants */
+    uint64_t fe_sqrt;            /* field square roots (pubkey decompression, recovery) */
+    uint64_t ecmult_ticks;
+    uint64_t ecmult_const_ticks;
+    uint64_t ecmult_gen_ticks;
+} secp256k1_context_stats;
+
+/** Read the operation counters.
+ *  Returns: 1: the library keeps counters and stats was filled in
+ *           0: it was built without ENABLE_STATS; stats is zeroed
+ *  Args:    ctx:    pointer to a context object (cannot be NULL)
+ *  Out:     stats:  pointer to the counters to fill in (cannot be NULL)
+ *  In:      reset:  if non-zero, zero the counters after reading them
+ *
+ *  The internal routines do not see the context they are called through, so
+ *  the counters are shared by all contexts in the process.
+ */
+SECP256K1_API int secp256k1_context_get_stats(
+    const secp256k1_context* ctx,
+    secp256k1_context_stats *stats,
+    int reset
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2);
+
 /** Add a number of public keys together.
  *  Returns: 1: the sum of the public keys is valid.
  *           0: the sum of the public keys is not valid.
@@ -614,6 +806,86 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ec_pubkey_combine(
     size_t n
 ) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
 
+/** Compute the double SHA-256 of n 64-byte messages, such as the concatenated
+ *  child hashes of merkle tree nodes.
+ *
+ *  Where the CPU has no SHA-256 instructions but has AVX2, eight messages are
+ *  hashed at a time, one per SIMD lane.
+ *
+ *  Returns: 1 always.
+ *  Args:   ctx:    pointer to a context object (cannot be NULL)
+ *  Out:    output: pointer to an n*32 byte array for the digests (cannot be NULL
+ *                  unless n is 0)
+ *  In:     input:  pointer to n consecutive 64-byte messages (cannot be NULL unless
+ *                  n is 0). Must not overlap output.
+ *          n:      the number of messages
+ */
+SECP256K1_API int secp256k1_sha256d64_multi(
+    const secp256k1_context* ctx,
+    unsigned char *output,
+    const unsigned char *input,
+    size_t n
+) SECP256K1_ARG_NONNULL(1);
+
+/** Compute the merkle roots of n transactions from their merkle branches, as
+ *  returned by an Electrum server. The branches are hashed one tree level at a
+ *  time across all n transactions, see secp256k1_sha256d64_multi.
+ *
+ *  Returns: 1 always.
+ *  Args:   ctx:        pointer to a context object (cannot be NULL)
+ *  Out:    roots:      pointer to an n*32 byte array for the roots (cannot be NULL
+ *                      unless n is 0)
+ *  In:     leaves:     the n 32-byte transaction hashes (cannot be NULL unless n is 0)
+ *          branches:   all the 32-byte branch hashes back to back, those of the
+ *                      first transaction first, each branch ordered from the leaf up
+ *                      (cannot be NULL if any branchlens entry is nonzero)
+ *          branchlens: the number of hashes in each branch (cannot be NULL unless n is 0)
+ *          positions:  the index of each transaction in its block; bit i says
+ *                      whether the tree node at level i is a right child
+ *                      (cannot be NULL unless n is 0)
+ *          n:          the number of transactions
+ *  All hashes are in serialized byte order.
+ */
+SECP256K1_API int secp256k1_merkle_roots(
+    const secp256k1_context* ctx,
+    unsigned char *roots,
+    const unsigned char *leaves,
+    const unsigned char *branches,
+    const size_t *branchlens,
+    const size_t *positions,
+    size_t n
+) SECP256K1_ARG_NONNULL(1);
+
+/** Compute n double SHA256 hashes of messages that share a prefix and a
+ *  suffix, SHA256(SHA256(prefix || middle_i || suffix)), such as the
+ *  signature hashes of all inputs of a transaction. The prefix is hashed only
+ *  once; each message then starts from a copy of that hash state.
+ *
+ *  Returns: 1 always.
+ *  Args:   ctx:        pointer to a context object (cannot be NULL)
+ *  Out:    output:     pointer to an n*32 byte array for the hashes (cannot be
+ *                      NULL unless n is 0)
+ *  In:     prefix:     the shared prefix (cannot be NULL unless prefixlen is 0)
+ *          prefixlen:  the length of prefix
+ *          middles:    the n middle parts back to back (cannot be NULL if any
+ *                      middlelens entry is nonzero)
+ *          middlelens: the length of each middle part (cannot be NULL unless n is 0)
+ *          suffix:     the shared suffix (cannot be NULL unless suffixlen is 0)
+ *          suffixlen:  the length of suffix
+ *          n:          the number of messages
+ */
+SECP256K1_API int secp256k1_sha256d_affixed_multi(
+    const secp256k1_context* ctx,
+    unsigned char *output,
+    const unsigned char *prefix,
+    size_t prefixlen,
+    const unsigned char *middles,
+    const size_t *middlelens,
+    const unsigned char *suffix,
+    size_t suffixlen,
+    size_t n
+) SECP256K1_ARG_NONNULL(1);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,46 @@
+#ifndef _SECP256K1_ECIES_
+# define _SECP256K1_ECIES_
+
+# include "secp256k1.h"
+
+# ifdef __cplusplus
+extern "C" {
+# endif
+
+/**
+ * Derive the keys of an Electrum ECIES (BIE1) message.
+ *
+ * With P the point seckey*pubkey, the output is
+ *
+ *   sha512(33-byte compressed serialization of P)
+ *
+ * whose bytes 0..15 are the AES IV, 16..31 the AES-128 key and 32..63 the
+ * HMAC-SHA256 key, as computed by EC_KEY.encrypt_message and decrypt_message
+ * in electroncash/bitcoin.py. The multiplication is constant time.
+ *
+ * Returns: 1: the keys (and the ephemeral public key, if asked for) were written
+ *          0: seckey was zero or out of range, or pubkey could not be parsed
+ * Args:    ctx:         pointer to a context object, initialized for signing
+ *                       if ephemeral33 is not NULL (cannot be NULL)
+ * Out:     output64:    pointer to a 64-byte array for the keys (cannot be NULL)
+ *          ephemeral33: if not NULL, receives the 33-byte compressed public
+ *                       key of seckey, which is what the encrypting side
+ *                       sends along with the ciphertext
+ * In:      seckey:      pointer to a 32-byte secret key (cannot be NULL)
+ *          pubkey:      pointer to a serialized public key (cannot be NULL)
+ *          pubkeylen:   length of pubkey
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ecies_derive_keys(
+  const secp256k1_context* ctx,
+  unsigned char *output64,
+  unsigned char *ephemeral33,
+  const unsigned char *seckey,
+  const unsigned char *pubkey,
+  size_t pubkeylen
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(5);
+
+# ifdef __cplusplus
+}
+# endif
+
+#endif
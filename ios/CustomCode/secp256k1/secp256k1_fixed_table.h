@@ -0,0 +1,75 @@
+#ifndef _SECP256K1_FIXED_TABLE_
+# define _SECP256K1_FIXED_TABLE_
+
+# include "secp256k1.h"
+
+# ifdef __cplusplus
+extern "C" {
+# endif
+
+/** Opaque data structure holding a precomputed comb table for one point.
+ *
+ *  secp256k1_ec_pubkey_tweak_mul starts from scratch on every call. When the
+ *  same public key is multiplied by many different scalars (the signer's key
+ *  in blind signature requests, for instance), a table of multiples of that
+ *  key lets each multiplication be done with one point addition per window of
+ *  the scalar, in the same way secp256k1_ecmult_gen does for the generator.
+ *
+ *  A table is read-only once created, so one may be shared by many threads.
+ *  It does not refer to the context it was created with.
+ */
+typedef struct secp256k1_ecmult_fixed_table_struct secp256k1_ecmult_fixed_table;
+
+/** Precompute a comb table for a public key.
+ *
+ *  Returns: a newly created table, to be freed with
+ *           secp256k1_ecmult_fixed_table_destroy, or NULL if window is out of
+ *           range, memory ran out, or the key is one of the (deliberately
+ *           constructed, never random) points the table cannot represent. Fall
+ *           back to secp256k1_ec_pubkey_tweak_mul in that case.
+ *  Args:    ctx:    pointer to a context object (cannot be NULL)
+ *  In:      pubkey: pointer to the public key to precompute (cannot be NULL)
+ *           window: bits of the scalar handled per addition, 2 to 8. A table
+ *                   holds ceil(256/window) * 2^window points of 64 bytes and
+ *                   each multiplication scans all of them, so beyond 5 wider
+ *                   windows only cost more. 4 takes 64 kB and repays its
+ *                   construction after about 50 multiplications.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT secp256k1_ecmult_fixed_table* secp256k1_ecmult_fixed_table_create(
+  const secp256k1_context* ctx,
+  const secp256k1_pubkey *pubkey,
+  int window
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2);
+
+/** Destroy a comb table.
+ *
+ *  The pointer may not be used afterwards.
+ *  In:      table: the table to destroy (NULL is ignored)
+ */
+SECP256K1_API void secp256k1_ecmult_fixed_table_destroy(
+  secp256k1_ecmult_fixed_table* table
+);
+
+/** Multiply the table's public key by a tweak, as secp256k1_ec_pubkey_tweak_mul
+ *  does, but in constant time using the table.
+ *
+ *  Returns: 0 if the tweak was out of range (chance of around 1 in 2^128 for
+ *           uniformly random 32-byte arrays) or zero. 1 otherwise.
+ *  Args:    ctx:    pointer to a context object (cannot be NULL)
+ *  Out:     pubkey: pointer to a public key object, set to tweak times the
+ *                   table's key (cannot be NULL)
+ *  In:      table:  the table of the key to multiply (cannot be NULL)
+ *           tweak:  pointer to a 32-byte multiplier (cannot be NULL)
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ec_pubkey_tweak_mul_with_table(
+  const secp256k1_context* ctx,
+  secp256k1_pubkey *pubkey,
+  const secp256k1_ecmult_fixed_table *table,
+  const unsigned char *tweak
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
+
+# ifdef __cplusplus
+}
+# endif
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef _SECP256K1_HEADERS_
+# define _SECP256K1_HEADERS_
+
+# include <stdint.h>
+
+# include "secp256k1.h"
+
+# ifdef __cplusplus
+extern "C" {
+# endif
+
+/** Flag for secp256k1_headers_verify_chunk: apply the testnet rule that a
+ *  block more than 20 minutes after its parent may use the minimum difficulty. */
+#define SECP256K1_HEADERS_TESTNET_RULE (1 << 0)
+
+/**
+ * Verify a chunk of consecutive 80-byte block headers, the way
+ * Blockchain.verify_chunk in electroncash/blockchain.py does for headers whose
+ * difficulty comes from the ASERTi3-2d DAA: each header must link to the hash
+ * (sha512_256d) of its parent, carry the bits the DAA computes from the anchor,
+ * meet its own target and, at checkpoint_height, hash to checkpoint_hash32.
+ *
+ * Verification stops at the first header that fails, or whose parent's median
+ * time past is still before asert_activation_mtp. The caller is expected to
+ * re-check from there with the full (slow) rules, which also produces a
+ * proper error message.
+ *
+ * Returns: 1: all n headers verified (also returned if n is 0)
+ *          0: verification stopped early, see nverified
+ * Args:    ctx:                    pointer to a context object (cannot be NULL)
+ * Out:     nverified:              the number of leading headers that verified (cannot be NULL)
+ * In:      chunk:                  the n serialized headers, back to back
+ *                                  (cannot be NULL unless n is 0)
+ *          n:                      the number of headers
+ *          height:                 the height of the first header, at least 11
+ *          prev_hash32:            the 32-byte hash of the header at height - 1,
+ *                                  in serialized byte order (cannot be NULL)
+ *          prev_times:             the timestamps of the 11 headers before the
+ *                                  chunk, oldest first (cannot be NULL)
+ *          asert_activation_mtp:   median time past from which the DAA applies
+ *          asert_half_life:        the DAA half life in seconds (must be positive)
+ *          asert_anchor_height:    height of the DAA anchor block
+ *          asert_anchor_bits:      compact target of the DAA anchor block
+ *          asert_anchor_prev_time: timestamp of the anchor block's parent
+ *          checkpoint_height:      height checked against checkpoint_hash32, or -1
+ *          checkpoint_hash32:      the 32-byte checkpoint hash in serialized byte order
+ *                                  (cannot be NULL unless checkpoint_height is -1)
+ *          flags:                  0 or SECP256K1_HEADERS_TESTNET_RULE
+ */
+SECP256K1_API int secp256k1_headers_verify_chunk(
+  const secp256k1_context* ctx,
+  size_t *nverified,
+  const unsigned char *chunk,
+  size_t n,
+  int64_t height,
+  const unsigned char *prev_hash32,
+  const uint32_t *prev_times,
+  int64_t asert_activation_mtp,
+  int64_t asert_half_life,
+  int64_t asert_anchor_height,
+  uint32_t asert_anchor_bits,
+  int64_t asert_anchor_prev_time,
+  int64_t checkpoint_height,
+  const unsigned char *checkpoint_hash32,
+  unsigned int flags
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(6) SECP256K1_ARG_NONNULL(7);
+
+# ifdef __cplusplus
+}
+# endif
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef _SECP256K1_PUBKEY_CACHE_
+# define _SECP256K1_PUBKEY_CACHE_
+
+# include "secp256k1.h"
+
+# ifdef __cplusplus
+extern "C" {
+# endif
+
+/** Opaque data structure holding recently parsed public keys.
+ *
+ *  Parsing a 33-byte key costs a field square root, and every verification
+ *  against a key recomputes a small table of its odd multiples. A cache keeps
+ *  the decompressed point of each key it has seen, keyed by its compressed
+ *  encoding, and once a key has been used more than once also keeps that
+ *  table, so later verifications against it skip both steps.
+ *
+ *  The cache holds a bounded number of keys, evicting the least recently used
+ *  one of a small set when full. It is not thread-safe: give each thread its
+ *  own cache, or serialize access to a shared one. The context passed to the
+ *  functions below need not be the one the cache was created with.
+ */
+typedef struct secp256k1_pubkey_cache_struct secp256k1_pubkey_cache;
+
+/** Create a pubkey cache.
+ *
+ *  Returns: a newly created cache, to be freed with secp256k1_pubkey_cache_destroy
+ *  Args:    ctx:  pointer to a context object (cannot be NULL)
+ *  In:      size: the number of keys to hold, rounded up to a power of two
+ *                 (at least 4). Each key takes about 100 bytes, plus about
+ *                 1.5 kB once its table is kept.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT secp256k1_pubkey_cache* secp256k1_pubkey_cache_create(
+  const secp256k1_context* ctx,
+  size_t size
+) SECP256K1_ARG_NONNULL(1);
+
+/** Destroy a pubkey cache.
+ *
+ *  The pointer may not be used afterwards.
+ *  In:      cache: the cache to destroy (NULL is ignored)
+ */
+SECP256K1_API void secp256k1_pubkey_cache_destroy(
+  secp256k1_pubkey_cache* cache
+);
+
+/** Parse a variable-length public key, as secp256k1_ec_pubkey_parse does, but
+ *  consult and fill the cache.
+ *
+ *  Returns: 1 if the public key was fully valid.
+ *           0 if the public key could not be parsed or is invalid.
+ *  Args:    ctx:      a secp256k1 context object (cannot be NULL)
+ *           cache:    the cache to use (cannot be NULL)
+ *  Out:     pubkey:   pointer to a pubkey object, set to the parsed key
+ *                     if valid, all zeroes otherwise (cannot be NULL)
+ *  In:      input:    pointer to a serialized public key (cannot be NULL)
+ *           inputlen: length of the array pointed to by input
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_pubkey_cache_parse(
+  const secp256k1_context* ctx,
+  secp256k1_pubkey_cache* cache,
+  secp256k1_pubkey* pubkey,
+  const unsigned char *input,
+  size_t inputlen
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
+
+/** Verify an ECDSA signature against a serialized public key, using the cache.
+ *  Otherwise the same as parsing the key and calling secp256k1_ecdsa_verify,
+ *  so sig must be lower-S (see secp256k1_ecdsa_signature_normalize).
+ *
+ *  Returns: 1: correct signature
+ *           0: incorrect or unparseable signature, or invalid public key
+ *  Args:    ctx:      a secp256k1 context object, initialized for verification (cannot be NULL)
+ *           cache:    the cache to use (cannot be NULL)
+ *  In:      sig:      the signature being verified (cannot be NULL)
+ *           msg32:    the 32-byte message hash being verified (cannot be NULL)
+ *           input:    pointer to the serialized public key (cannot be NULL)
+ *           inputlen: length of the array pointed to by input
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ecdsa_verify_cached(
+  const secp256k1_context* ctx,
+  secp256k1_pubkey_cache* cache,
+  const secp256k1_ecdsa_signature *sig,
+  const unsigned char *msg32,
+  const unsigned char *input,
+  size_t inputlen
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(5);
+
+/** Verify a Schnorr signature against a serialized public key, using the
+ *  cache. Otherwise the same as parsing the key and calling
+ *  secp256k1_schnorr_verify. Only present in builds with the Schnorr module.
+ *
+ *  Returns: 1: correct signature
+ *           0: incorrect signature, or invalid public key
+ *  Args:    ctx:      a secp256k1 context object, initialized for verification (cannot be NULL)
+ *           cache:    the cache to use (cannot be NULL)
+ *  In:      sig64:    the 64-byte signature being verified (cannot be NULL)
+ *           msg32:    the 32-byte message hash being verified (cannot be NULL)
+ *           input:    pointer to the serialized public key (cannot be NULL)
+ *           inputlen: length of the array pointed to by input
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_schnorr_verify_cached(
+  const secp256k1_context* ctx,
+  secp256k1_pubkey_cache* cache,
+  const unsigned char *sig64,
+  const unsigned char *msg32,
+  const unsigned char *input,
+  size_t inputlen
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(5);
+
+# ifdef __cplusplus
+}
+# endif
+
+#endif
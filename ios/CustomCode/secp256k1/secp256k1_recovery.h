@@ -103,6 +103,35 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ecdsa_recover(
     const unsigned char *msg32
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
 
+/** Recover the ECDSA public keys of n signatures in one call, as
+ *  secp256k1_ecdsa_recover does one at a time. The inverses of all the r
+ *  values share one scalar inversion, and the conversion of the keys to
+ *  affine coordinates one field inversion.
+ *
+ *  Returns: 1: all n public keys were recovered (also returned if n is 0)
+ *           0: at least one signature did not yield a key; the outputs of
+ *              those are zeroed, the others are still written
+ *  Args:    ctx:       pointer to a context object, initialized for verification (cannot be NULL)
+ *  Out:     output:    pointer to an n*outputlen byte array for the serialized
+ *                      public keys (cannot be NULL unless n is 0)
+ *  In:      outputlen: 33 for compressed keys, 65 for uncompressed ones, matching flags
+ *           sigs64:    the n 64-byte compact signatures, back to back
+ *           recids:    array of the n recovery ids (0, 1, 2 or 3)
+ *           msgs32:    the n 32-byte message hashes, back to back
+ *           n:         the number of signatures
+ *           flags:     SECP256K1_EC_COMPRESSED or SECP256K1_EC_UNCOMPRESSED
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_ecdsa_recover_batch(
+    const secp256k1_context* ctx,
+    unsigned char *output,
+    size_t outputlen,
+    const unsigned char *sigs64,
+    const int *recids,
+    const unsigned char *msgs32,
+    size_t n,
+    unsigned int flags
+) SECP256K1_ARG_NONNULL(1);
+
 #ifdef __cplusplus
 }
 #endif
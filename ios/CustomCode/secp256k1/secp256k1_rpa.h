@@ -0,0 +1,131 @@
+#ifndef _SECP256K1_RPA_
+# define _SECP256K1_RPA_
+
+# include "secp256k1.h"
+
+# ifdef __cplusplus
+extern "C" {
+# endif
+
+/**
+ * Compute the shared secret of a Reusable Payment Address (paycode).
+ *
+ * With x the 32-byte X coordinate of seckey*pubkey, the secret is
+ *
+ *   sha256(minimal big-endian bytes of
+ *          int(sha256(0x00 || x)) + int(sha256(outpoint)))
+ *
+ * which is what electroncash/rpa/paycode.py computes in Python.
+ *
+ * Returns: 1: the shared secret was written
+ *          0: seckey was zero or out of range, or pubkey could not be parsed
+ * Args:    ctx:         pointer to a context object (cannot be NULL)
+ * Out:     output32:    pointer to a 32-byte array for the secret (cannot be NULL)
+ * In:      seckey:      pointer to a 32-byte secret key (cannot be NULL)
+ *          pubkey:      pointer to a serialized public key (cannot be NULL)
+ *          pubkeylen:   length of pubkey
+ *          outpoint:    pointer to the outpoint string, the previous txid in hex
+ *                       followed by the decimal output index (cannot be NULL)
+ *          outpointlen: length of outpoint
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rpa_shared_secret(
+  const secp256k1_context* ctx,
+  unsigned char *output32,
+  const unsigned char *seckey,
+  const unsigned char *pubkey,
+  size_t pubkeylen,
+  const unsigned char *outpoint,
+  size_t outpointlen
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(6);
+
+/**
+ * Compute the RPA shared secrets of one secret key with n (pubkey, outpoint)
+ * pairs, e.g. all the inputs of a transaction, in one call. The point
+ * multiplications share a single field inversion.
+ *
+ * Returns: 1: all n secrets were written (also returned if n is 0)
+ *          0: seckey was invalid, in which case every output is zeroed, or at
+ *             least one pubkey could not be parsed; the outputs of those are
+ *             zeroed, the others are still written
+ * Args:    ctx:         pointer to a context object (cannot be NULL)
+ * Out:     output:      pointer to an n*32 byte array for the secrets
+ *                       (cannot be NULL unless n is 0)
+ * In:      seckey:      pointer to a 32-byte secret key (cannot be NULL)
+ *          pubkeys:     the n serialized public keys, back to back
+ *          pubkeylens:  array of the n public key lengths
+ *          outpoints:   the n outpoint strings, back to back
+ *          outpointlens: array of the n outpoint lengths
+ *          n:           the number of secrets to compute
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rpa_shared_secret_batch(
+  const secp256k1_context* ctx,
+  unsigned char *output,
+  const unsigned char *seckey,
+  const unsigned char *pubkeys,
+  const size_t *pubkeylens,
+  const unsigned char *outpoints,
+  const size_t *outpointlens,
+  size_t n
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(3);
+
+/**
+ * Grind the Schnorr signature of a paycode transaction's first input until
+ * the double SHA256 of the serialized input starts with the given prefix.
+ *
+ * The candidates are the signatures of msg32 under seckey with the nonces
+ * k + start, k + start + 1, ..., where k is the nonce secp256k1_schnorr_sign
+ * derives with ndata32; with start 0 the first candidate is exactly the
+ * signature secp256k1_schnorr_sign returns. Consecutive nonce points differ
+ * by G, so each candidate costs one point addition and a share of one field
+ * inversion instead of a full signature. Only the winning signature is ever
+ * published, so nonces a known distance apart leak nothing.
+ *
+ * The caller may split a search over several threads, each with its own
+ * context and either its own ndata32 or its own range of start, and cancel
+ * all of them through stop.
+ *
+ * Returns: 1: a matching signature was written to sig64
+ *          0: none of the count candidates matched, *stop became nonzero, or
+ *             seckey was zero or out of range
+ * Args:    ctx:         pointer to a context object, initialized for signing
+ *                       (cannot be NULL)
+ * Out:     sig64:       pointer to a 64-byte array for the signature (cannot be NULL)
+ *          tried:       pointer to the number of candidates tried, including
+ *                       the matching one (cannot be NULL)
+ * In:      input:       pointer to the serialized input, with any 64 bytes in
+ *                       place of the signature (cannot be NULL)
+ *          inputlen:    length of input
+ *          sigpos:      offset of the signature in input; sigpos + 64 must
+ *                       not exceed inputlen
+ *          msg32:       the 32-byte signature hash of the input (cannot be NULL)
+ *          seckey:      pointer to the input's 32-byte secret key (cannot be NULL)
+ *          ndata32:     32 bytes of extra entropy for the nonce (cannot be NULL)
+ *          start:       offset of the first candidate's nonce
+ *          count:       the maximum number of candidates to try
+ *          prefix:      the bytes the hash must start with (cannot be NULL)
+ *          prefix_bits: how many leading bits of prefix must match, at most 32
+ *          stop:        pointer to a flag another thread may set to make the
+ *                       search return early, or NULL
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_rpa_grind(
+  const secp256k1_context* ctx,
+  unsigned char *sig64,
+  size_t *tried,
+  const unsigned char *input,
+  size_t inputlen,
+  size_t sigpos,
+  const unsigned char *msg32,
+  const unsigned char *seckey,
+  const unsigned char *ndata32,
+  size_t start,
+  size_t count,
+  const unsigned char *prefix,
+  unsigned int prefix_bits,
+  const volatile int *stop
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(7) SECP256K1_ARG_NONNULL(8) SECP256K1_ARG_NONNULL(9) SECP256K1_ARG_NONNULL(12);
+
+# ifdef __cplusplus
+}
+# endif
+
+#endif
@@ -23,6 +23,27 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_schnorr_verify(
   const secp256k1_pubkey *pubkey
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
 
+/**
+ * Verify a batch of signatures created by secp256k1_schnorr_sign, using a
+ * random linear combination of all of them and one multi-scalar
+ * multiplication. Much faster than calling secp256k1_schnorr_verify n times.
+ * Returns: 1: all signatures are correct (also returned if n is 0)
+ *          0: at least one signature is incorrect. Use secp256k1_schnorr_verify
+ *             to find out which.
+ * Args:    ctx:       a secp256k1 context object, initialized for verification.
+ * In:      sig64:     array of n pointers to 64-byte signatures
+ *          msg32:     array of n pointers to 32-byte message hashes
+ *          pubkeys:   array of n pointers to the public keys to verify with
+ *          n:         the number of signatures in the batch
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_schnorr_verify_batch(
+  const secp256k1_context* ctx,
+  const unsigned char * const *sig64,
+  const unsigned char * const *msg32,
+  const secp256k1_pubkey * const *pubkeys,
+  size_t n
+) SECP256K1_ARG_NONNULL(1);
+
 /**
  * Create a signature using a custom EC-Schnorr-SHA256 construction. It
  * produces non-malleable 64-byte signatures which support batch validation,
@@ -50,6 +71,39 @@ SECP256K1_API int secp256k1_schnorr_sign(
   const void *ndata
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
 
+/**
+ * Create n signatures with the same secret key, as secp256k1_schnorr_sign
+ * would one by one. The secret key is loaded and its public key derived only
+ * once for the whole batch.
+ * Returns: 1: all signatures created (also returned if n is 0)
+ *          0: the private key was invalid, pubkey_hint did not match it, or
+ *             the nonce generation function failed. Signatures that could not
+ *             be created are zeroed.
+ * Args:    ctx:    pointer to a context object, initialized for signing
+ *                  (cannot be NULL)
+ * Out:     sig64:  pointer to an array of n*64 bytes where the signatures
+ *                  will be placed back to back
+ * In:      msg32:  pointer to the n 32-byte message hashes, back to back
+ *          n:      the number of messages to sign
+ *          seckey: pointer to a 32-byte secret key (cannot be NULL)
+ *          pubkey_hint: the public key the caller expects seckey to have,
+ *                  checked before anything is signed (can be NULL)
+ *          noncefp:pointer to a nonce generation function. If NULL,
+ *                  secp256k1_nonce_function_default is used
+ *          ndata:  pointer to arbitrary data used by the nonce generation
+ *                  function for every signature (can be NULL)
+ */
+SECP256K1_API int secp256k1_schnorr_sign_batch(
+  const secp256k1_context *ctx,
+  unsigned char *sig64,
+  const unsigned char *msg32,
+  size_t n,
+  const unsigned char *seckey,
+  const secp256k1_pubkey *pubkey_hint,
+  secp256k1_nonce_function noncefp,
+  const void *ndata
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(5);
+
 # ifdef __cplusplus
 }
 # endif
@@ -0,0 +1,139 @@
+#ifndef _SECP256K1_SCHNORR_BLIND_
+# define _SECP256K1_SCHNORR_BLIND_
+
+# include "secp256k1.h"
+# include "secp256k1_fixed_table.h"
+
+# ifdef __cplusplus
+extern "C" {
+# endif
+
+/**
+ * Blind signatures in the custom EC-Schnorr-SHA256 construction of
+ * secp256k1_schnorr_sign, as done by electroncash/schnorr.py's BlindSigner
+ * and BlindSignatureRequest.
+ *
+ * The signer picks a secret nonce k and hands out R = k*G. The requester,
+ * with the signer's public key P, picks blinding factors a and b and computes
+ *
+ *   R' = c*(R + a*G + b*P), with c = +1 or -1 so that R'.y is a quadratic residue
+ *   e' = Hash(R'.x || compressed(P) || msg32)
+ *   e  = c*e' + b
+ *
+ * and sends e. The signer returns s = k + e*x, and the requester unblinds it
+ * into the ordinary signature (R'.x, c*(s + a)).
+ *
+ * A signer must never sign two requests with the same k, and should not serve
+ * many requests in parallel; see the security notes on BlindSigner.
+ */
+
+/** Opaque data structure holding the requester's state between
+ *  secp256k1_schnorr_blind_request_create and secp256k1_schnorr_blind_finalize.
+ *  It contains the blinding factor a and must be kept as secret. It may be
+ *  copied, but its layout is specific to one build of the library.
+ */
+typedef struct {
+    unsigned char data[161];
+} secp256k1_schnorr_blind_request;
+
+/** Create a blind signature request.
+ *
+ *  Returns: 1: the request was created
+ *           0: pubkey or R could not be parsed, or a or b was zero or out of
+ *              range (retry with new blinding factors), or the request hit
+ *              one of the cryptographically unreachable degenerate cases
+ *  Args:    ctx:       pointer to a context object, initialized for signing
+ *                      (cannot be NULL)
+ *  Out:     request:   pointer to the state to keep for finalizing (cannot be NULL)
+ *           e32:       pointer to a 32-byte array for the e value to send to the
+ *                      signer (cannot be NULL)
+ *  In:      pubkey:    pointer to the signer's serialized public key (cannot be NULL)
+ *           pubkeylen: length of pubkey
+ *           R:         pointer to the signer's serialized nonce point (cannot be NULL)
+ *           Rlen:      length of R
+ *           msg32:     the 32-byte message hash to be signed (cannot be NULL)
+ *           blind64:   64 bytes of fresh randomness, the blinding factors a
+ *                      and b back to back (cannot be NULL)
+ *           pubkey_table: a table created for pubkey with
+ *                      secp256k1_ecmult_fixed_table_create, which makes b*P
+ *                      cheaper when many requests go to the same signer, or
+ *                      NULL. A table for a different key is an error.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_schnorr_blind_request_create(
+  const secp256k1_context* ctx,
+  secp256k1_schnorr_blind_request *request,
+  unsigned char *e32,
+  const unsigned char *pubkey,
+  size_t pubkeylen,
+  const unsigned char *R,
+  size_t Rlen,
+  const unsigned char *msg32,
+  const unsigned char *blind64,
+  const secp256k1_ecmult_fixed_table *pubkey_table
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(6) SECP256K1_ARG_NONNULL(8) SECP256K1_ARG_NONNULL(9);
+
+/** Get the public part of a blind signature request: R'.x, which the finished
+ *  signature will start with, and the sign flip c.
+ *
+ *  Returns: 1 always
+ *  Args:    ctx:      pointer to a context object (cannot be NULL)
+ *  Out:     rx32:     pointer to a 32-byte array for R'.x (cannot be NULL)
+ *           negated:  pointer to an int set to 1 if c = -1, or 0 if c = +1
+ *                     (cannot be NULL)
+ *  In:      request:  the state from secp256k1_schnorr_blind_request_create
+ *                     (cannot be NULL)
+ */
+SECP256K1_API int secp256k1_schnorr_blind_request_get_nonce(
+  const secp256k1_context* ctx,
+  unsigned char *rx32,
+  int *negated,
+  const secp256k1_schnorr_blind_request *request
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
+
+/** Answer a blind signature request, computing s = k + e*x.
+ *
+ *  Returns: 1: s was written
+ *           0: k or seckey was zero or out of range (an out of range e is
+ *              reduced, as the requester's Python counterpart does)
+ *  Args:    ctx:    pointer to a context object (cannot be NULL)
+ *  Out:     s32:    pointer to a 32-byte array for the response (cannot be NULL)
+ *  In:      k32:    the 32-byte secret nonce of the R handed to the requester
+ *                   (cannot be NULL)
+ *           seckey: pointer to the signer's 32-byte secret key (cannot be NULL)
+ *           e32:    the 32-byte e value received from the requester (cannot be NULL)
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_schnorr_blind_sign(
+  const secp256k1_context* ctx,
+  unsigned char *s32,
+  const unsigned char *k32,
+  const unsigned char *seckey,
+  const unsigned char *e32
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(5);
+
+/** Unblind the signer's response into a signature on the request's message.
+ *
+ *  Returns: 1: the signature was written (and, if check is set, verified)
+ *           0: check was set and the signature does not verify, i.e. the
+ *              signer answered incorrectly
+ *  Args:    ctx:     pointer to a context object; if check is set it must be
+ *                    initialized for verification (cannot be NULL)
+ *  Out:     sig64:   pointer to a 64-byte array for the signature, which is
+ *                    written even if it does not verify (cannot be NULL)
+ *  In:      request: the state from secp256k1_schnorr_blind_request_create
+ *                    (cannot be NULL)
+ *           s32:     the 32-byte response received from the signer (cannot be NULL)
+ *           check:   whether to verify the signature before returning it
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_schnorr_blind_finalize(
+  const secp256k1_context* ctx,
+  unsigned char *sig64,
+  const secp256k1_schnorr_blind_request *request,
+  const unsigned char *s32,
+  int check
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
+
+# ifdef __cplusplus
+}
+# endif
+
+#endif
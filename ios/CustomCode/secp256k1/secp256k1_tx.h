@@ -0,0 +1,50 @@
+#ifndef _SECP256K1_TX_
+# define _SECP256K1_TX_
+
+# include "secp256k1.h"
+
+# ifdef __cplusplus
+extern "C" {
+# endif
+
+/**
+ * Find the inputs and outputs of a serialized transaction without copying
+ * any of it. For each input, and then each output, three offsets into tx are
+ * written to fields:
+ *
+ *   inputs:  start (the prevout hash, followed by the 4-byte prevout index),
+ *            scriptSig start, scriptSig length (the 4-byte sequence follows)
+ *   outputs: start (the 8-byte value), scriptPubKey start, scriptPubKey length
+ *
+ * The version is always at offset 0 and the lock time in the last 4 bytes.
+ *
+ * Returns: 1: tx is a complete transaction, exactly txlen bytes long, and
+ *             3 * (*ninputs + *noutputs) fields were written
+ *          0: tx is malformed or has trailing bytes, or nfields is too small
+ *             (txlen / 3 always suffices)
+ * Args:    ctx:      pointer to a context object (cannot be NULL)
+ * Out:     ninputs:  the number of inputs (cannot be NULL)
+ *          noutputs: the number of outputs (cannot be NULL)
+ *          fields:   pointer to an array of nfields offsets (cannot be NULL)
+ *          txid32:   if not NULL, a 32-byte array for the double SHA256 of
+ *                    tx, in serialized byte order
+ * In:      nfields:  the size of the fields array
+ *          tx:       the serialized transaction (cannot be NULL)
+ *          txlen:    its length
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int secp256k1_tx_parse(
+  const secp256k1_context* ctx,
+  size_t *ninputs,
+  size_t *noutputs,
+  size_t *fields,
+  size_t nfields,
+  unsigned char *txid32,
+  const unsigned char *tx,
+  size_t txlen
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(7);
+
+# ifdef __cplusplus
+}
+# endif
+
+#endif
@@ -0,0 +1,96 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef SECP256K1_STATS_H
+#define SECP256K1_STATS_H
+
+#include "util.h"
+
+/* Opt-in operation counters, read through secp256k1_context_get_stats.
+ *
+ * With ENABLE_STATS the expensive internal routines bump a counter each time
+ * they run; with ENABLE_STATS_TIMING as well, the point multiplications also
+ * add the ticks they took. The internal routines never see the context, so
+ * the counters are process-wide and shared by every context; they are updated
+ * with relaxed atomics where the compiler has them.
+ *
+ * Usage: SECP256K1_STATS_BEGIN(t) goes among a function's declarations
+ * (without a trailing semicolon) and SECP256K1_STATS_END(WHICH, t); at its
+ * end. SECP256K1_STATS_INC(WHICH); just counts. All of them compile to
+ * nothing without ENABLE_STATS. */
+
+#ifdef ENABLE_STATS
+
+enum {
+    SECP256K1_STAT_ECMULT,
+    SECP256K1_STAT_ECMULT_CONST,
+    SECP256K1_STAT_ECMULT_GEN,
+    SECP256K1_STAT_FE_INV,
+    SECP256K1_STAT_FE_SQRT,
+    SECP256K1_STAT_COUNT
+};
+
+static uint64_t secp256k1_stats_counts[SECP256K1_STAT_COUNT];
+static uint64_t secp256k1_stats_ticks[SECP256K1_STAT_COUNT];
+
+#if defined(__GNUC__)
+# define SECP256K1_STATS_ADD(var, n) ((void)__atomic_fetch_add(&(var), (n), __ATOMIC_RELAXED))
+# define SECP256K1_STATS_XCHG(var) __atomic_exchange_n(&(var), 0, __ATOMIC_RELAXED)
+# define SECP256K1_STATS_LOAD(var) __atomic_load_n(&(var), __ATOMIC_RELAXED)
+#else
+# define SECP256K1_STATS_ADD(var, n) ((var) += (n))
+static SECP256K1_INLINE uint64_t secp256k1_stats_xchg(uint64_t *var) { uint64_t r = *var; *var = 0; return r; }
+# define SECP256K1_STATS_XCHG(var) secp256k1_stats_xchg(&(var))
+# define SECP256K1_STATS_LOAD(var) (var)
+#endif
+
+#define SECP256K1_STATS_INC(which) SECP256K1_STATS_ADD(secp256k1_stats_counts[SECP256K1_STAT_##which], 1)
+
+#ifdef ENABLE_STATS_TIMING
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(__aarch64__)
+#include <time.h>
+#endif
+
+/* A cheap monotonic tick count: the TSC on x86, the generic timer on ARM64,
+ * nanoseconds elsewhere. */
+static SECP256K1_INLINE uint64_t secp256k1_stats_clock(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t t;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(t));
+    return t;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+# define SECP256K1_STATS_BEGIN(t) uint64_t t = secp256k1_stats_clock();
+# define SECP256K1_STATS_END(which, t) do { \
+    SECP256K1_STATS_ADD(secp256k1_stats_ticks[SECP256K1_STAT_##which], secp256k1_stats_clock() - (t)); \
+    SECP256K1_STATS_INC(which); \
+} while (0)
+
+#else
+
+# define SECP256K1_STATS_BEGIN(t)
+# define SECP256K1_STATS_END(which, t) SECP256K1_STATS_INC(which)
+
+#endif /* ENABLE_STATS_TIMING */
+
+#else
+
+# define SECP256K1_STATS_INC(which) do { } while (0)
+# define SECP256K1_STATS_BEGIN(t)
+# define SECP256K1_STATS_END(which, t) do { } while (0)
+
+#endif /* ENABLE_STATS */
+
+#endif /* SECP256K1_STATS_H */
@@ -0,0 +1,110 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef SECP256K1_MODULE_TX_MAIN
+#define SECP256K1_MODULE_TX_MAIN
+
+#include "secp256k1_tx.h"
+
+/** Read a compact size at *pos, advancing it. Like BCDataStream.read_compact_size
+ *  in electroncash/transaction.py, non-canonical encodings are accepted. */
+static int secp256k1_tx_read_compact_size(uint64_t *size, const unsigned char *tx, size_t txlen, size_t *pos) {
+    size_t len, i;
+    if (*pos >= txlen) {
+        return 0;
+    }
+    switch (tx[*pos]) {
+    case 253: len = 2; break;
+    case 254: len = 4; break;
+    case 255: len = 8; break;
+    default:
+        *size = tx[(*pos)++];
+        return 1;
+    }
+    (*pos)++;
+    if (txlen - *pos < len) {
+        return 0;
+    }
+    *size = 0;
+    for (i = 0; i < len; i++) {
+        *size |= (uint64_t)tx[*pos + i] << (8 * i);
+    }
+    *pos += len;
+    return 1;
+}
+
+/** Skip a script, writing its start and length to fields. fixed bytes must
+ *  precede it (the outpoint or the value) and after bytes follow it. */
+static int secp256k1_tx_read_item(size_t *fields, const unsigned char *tx, size_t txlen, size_t *pos, size_t fixed, size_t after) {
+    uint64_t size;
+    fields[0] = *pos;
+    if (txlen - *pos < fixed) {
+        return 0;
+    }
+    *pos += fixed;
+    if (!secp256k1_tx_read_compact_size(&size, tx, txlen, pos) || size > txlen - *pos) {
+        return 0;
+    }
+    fields[1] = *pos;
+    fields[2] = (size_t)size;
+    *pos += (size_t)size;
+    if (txlen - *pos < after) {
+        return 0;
+    }
+    *pos += after;
+    return 1;
+}
+
+int secp256k1_tx_parse(const secp256k1_context* ctx, size_t *ninputs, size_t *noutputs, size_t *fields, size_t nfields, unsigned char *txid32, const unsigned char *tx, size_t txlen) {
+    uint64_t n;
+    size_t pos = 4, used = 0, i;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(ninputs != NULL);
+    ARG_CHECK(noutputs != NULL);
+    *ninputs = *noutputs = 0;
+    ARG_CHECK(fields != NULL);
+    ARG_CHECK(tx != NULL);
+
+    if (txlen < 4 + 1 + 1 + 4) {
+        return 0;
+    }
+    /* An input takes at least 41 bytes and an output 9, so a count larger than
+     * the bytes left is always malformed, and fields overflows are caught below. */
+    if (!secp256k1_tx_read_compact_size(&n, tx, txlen, &pos) || n > txlen - pos) {
+        return 0;
+    }
+    *ninputs = (size_t)n;
+    for (i = 0; i < *ninputs; i++, used += 3) {
+        if (nfields - used < 3 || !secp256k1_tx_read_item(fields + used, tx, txlen, &pos, 36, 4)) {
+            return 0;
+        }
+    }
+    if (!secp256k1_tx_read_compact_size(&n, tx, txlen, &pos) || n > txlen - pos) {
+        return 0;
+    }
+    *noutputs = (size_t)n;
+    for (i = 0; i < *noutputs; i++, used += 3) {
+        if (nfields - used < 3 || !secp256k1_tx_read_item(fields + used, tx, txlen, &pos, 8, 0)) {
+            return 0;
+        }
+    }
+    if (txlen - pos != 4) {
+        return 0;
+    }
+
+    if (txid32 != NULL) {
+        secp256k1_sha256 sha;
+        unsigned char hash[32];
+        secp256k1_sha256_initialize(&sha);
+        secp256k1_sha256_write(&sha, tx, txlen);
+        secp256k1_sha256_finalize(&sha, hash);
+        secp256k1_sha256_initialize(&sha);
+        secp256k1_sha256_write(&sha, hash, 32);
+        secp256k1_sha256_finalize(&sha, txid32);
+    }
+    return 1;
+}
+
+#endif /* SECP256K1_MODULE_TX_MAIN */
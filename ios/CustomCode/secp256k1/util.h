@@ -76,6 +76,56 @@ static SECP256K1_INLINE void *checked_malloc(const secp256k1_callback* cb, size_
     return ret;
 }
 
+/* Reference-counted, read-only heap blocks, used for the precomputed tables so
+ * that cloned contexts share them instead of copying. The count sits in a
+ * header in front of the returned pointer; it is updated atomically where the
+ * compiler supports it, so contexts sharing a block may be cloned and destroyed
+ * from different threads. */
+typedef union {
+    long refs;
+    /* Keep the data that follows the header aligned for any table type. */
+    uint64_t align_u64;
+    void *align_ptr;
+} secp256k1_shared_header;
+
+static SECP256K1_INLINE void *secp256k1_shared_malloc(const secp256k1_callback* cb, size_t size) {
+    secp256k1_shared_header *hdr = (secp256k1_shared_header *)checked_malloc(cb, sizeof(*hdr) + size);
+    if (hdr == NULL) {
+        return NULL;
+    }
+    hdr->refs = 1;
+    return hdr + 1;
+}
+
+/* Take another reference to a block from secp256k1_shared_malloc. NULL is passed through. */
+static SECP256K1_INLINE void *secp256k1_shared_ref(void *ptr) {
+    if (ptr != NULL) {
+        secp256k1_shared_header *hdr = (secp256k1_shared_header *)ptr - 1;
+#if defined(__GNUC__)
+        __atomic_add_fetch(&hdr->refs, 1, __ATOMIC_RELAXED);
+#else
+        hdr->refs++;
+#endif
+    }
+    return ptr;
+}
+
+/* Drop a reference, freeing the block with the last one. NULL is ignored. */
+static SECP256K1_INLINE void secp256k1_shared_free(void *ptr) {
+    if (ptr != NULL) {
+        secp256k1_shared_header *hdr = (secp256k1_shared_header *)ptr - 1;
+        long refs;
+#if defined(__GNUC__)
+        refs = __atomic_sub_fetch(&hdr->refs, 1, __ATOMIC_ACQ_REL);
+#else
+        refs = --hdr->refs;
+#endif
+        if (refs == 0) {
+            free(hdr);
+        }
+    }
+}
+
 /* Macro for restrict, when available and not in a VERIFY build. */
 #if defined(SECP256K1_BUILD) && defined(VERIFY)
 # define SECP256K1_RESTRICT
@@ -108,6 +158,30 @@ static SECP256K1_INLINE void *checked_malloc(const secp256k1_callback* cb, size_
 #  define SECP256K1_GNUC_EXT
 # endif
 SECP256K1_GNUC_EXT typedef unsigned __int128 uint128_t;
+SECP256K1_GNUC_EXT typedef __int128 int128_t;
+#endif
+
+/* Determine the number of trailing zero bits in a (non-zero) 64-bit x.
+ * This function is only intended to be used as fallback for
+ * secp256k1_ctz64_var, but permits it to be tested separately. */
+static SECP256K1_INLINE int secp256k1_ctz64_var_debruijn(uint64_t x) {
+    static const uint8_t debruijn[64] = {
+        0, 1, 2, 53, 3, 7, 54, 27, 4, 38, 41, 8, 34, 55, 48, 28,
+        62, 5, 39, 46, 44, 42, 22, 9, 24, 35, 59, 56, 49, 18, 29, 11,
+        63, 52, 6, 26, 37, 40, 33, 47, 61, 45, 43, 21, 23, 58, 17, 10,
+        51, 25, 36, 32, 60, 20, 57, 16, 50, 31, 19, 15, 30, 14, 13, 12
+    };
+    return debruijn[((x & -x) * 0x022FDD63CC95386DULL) >> 58];
+}
+
+/* Determine the number of trailing zero bits in a (non-zero) 64-bit x. */
+static SECP256K1_INLINE int secp256k1_ctz64_var(uint64_t x) {
+    VERIFY_CHECK(x != 0);
+#if SECP256K1_GNUC_PREREQ(3,4)
+    return __builtin_ctzll(x);
+#else
+    return secp256k1_ctz64_var_debruijn(x);
 #endif
+}
 
 #endif /* SECP256K1_UTIL_H */
@@ -117,4 +117,5 @@ SignDecryptBase = ObjCClass('SignDecryptBase')
 ReceiveBase = ObjCClass('ReceiveBase')
 SeedDisplayBase = ObjCClass('SeedDisplayBase')
 KeyInterface = ObjCClass('KeyInterface')
+AES128Cryptor = ObjCClass('AES128Cryptor')  # NSData+AES128.h
 CrashReporterBase = ObjCClass('CrashReporterBase')
@@ -50,6 +50,7 @@ from .custom_objc import *
 from electroncash.i18n import _, set_language, languages
 from electroncash.plugins import run_hook
 from electroncash import WalletStorage, Wallet, Transaction
+from electroncash.storage import rename_wallet_file
 from electroncash.address import Address
 from electroncash.util import UserCancelled, print_error, format_satoshis, format_satoshis_plain, PrintError, InvalidPassword, inv_base_units
 import electroncash.web as web
@@ -1764,6 +1765,8 @@ class ElectrumGui(PrintError):
 
         def DoIt() -> None:
             try:
+                if self.wallet and self.wallet.storage.path == info.full_path:
+                    self.wallet.storage.compact()  # only the wallet file gets shared
                 fn = shutil.copy2(info.full_path, utils.get_tmp_dir())
                 if fn:
                     print("copied wallet to:", fn)
@@ -1802,7 +1805,7 @@ class ElectrumGui(PrintError):
                 self.daemon.stop_wallet(self.wallet.storage.path)
                 self.wallet = None
 
-            os.rename(info.full_path, new_path)
+            rename_wallet_file(info.full_path, new_path)
             oldEncPw = self.encPasswords.get(info.name)
             if oldEncPw:
                 self.encPasswords.set(newName, oldEncPw, save = False) # migrate encrypted password to new name if present
@@ -15,6 +15,7 @@
 import ssl
 import sys
 from .uikit_bindings import *
+from .custom_objc import AES128Cryptor
 from electroncash.util import (InvalidPassword, profiler)
 import electroncash.bitcoin as ec_bitcoin
 from electroncash.simple_config import SimpleConfig
@@ -99,6 +100,7 @@ class MonkeyPatches:
         def patch(cls):
             ec_bitcoin.aes_decrypt_with_iv = cls._aes_decrypt_with_iv
             ec_bitcoin.aes_encrypt_with_iv = cls._aes_encrypt_with_iv
+            ec_bitcoin._aes_cbc_stream = cls._aes_cbc_stream
             cls.patched = True
             NSLog("*** AES *** Use iOS CommonCrypto: ENABLED")
             return True
@@ -107,12 +109,14 @@ class MonkeyPatches:
         def unpatch(cls):
             ec_bitcoin.aes_decrypt_with_iv = cls._orig_aes_decrypt_with_iv
             ec_bitcoin.aes_encrypt_with_iv = cls._orig_aes_encrypt_with_iv
+            ec_bitcoin._aes_cbc_stream = cls._orig_aes_cbc_stream
             cls.patched = False
             NSLog("*** AES *** Use iOS CommonCrypto: Disabled")
             return True
 
         _orig_aes_encrypt_with_iv = ec_bitcoin.aes_encrypt_with_iv
         _orig_aes_decrypt_with_iv = ec_bitcoin.aes_decrypt_with_iv
+        _orig_aes_cbc_stream = ec_bitcoin._aes_cbc_stream
 
         @classmethod
         @profiler
@@ -142,6 +146,22 @@ class MonkeyPatches:
             except ec_bitcoin.InvalidPadding:
                 raise InvalidPassword()
 
+        @classmethod
+        def _aes_cbc_stream(cls, key, iv, decrypt):
+            ''' Feed the ECIES payload pieces of EC_KEY.encrypt_message and
+            decrypt_message to a CommonCrypto cryptor, rather than pyaes '''
+            cryptor = AES128Cryptor.alloc().initForEncryption_key_initializationVector_padding_(
+                not decrypt, ns_from_py(key), ns_from_py(iv), False)
+            if cryptor is None:
+                print('*** WARNING: Could not create platform-native AES cryptor, falling back to slow pyaes method!')
+                return cls._orig_aes_cbc_stream(key, iv, decrypt)
+            def crypt(data):
+                out = cryptor.cryptData_(ns_from_py(bytes(data)))
+                if out is None:
+                    raise ValueError('AES128Cryptor failed')
+                return py_from_ns(out)
+            return crypt
+
         '''
         @classmethod
         def TEST(cls):
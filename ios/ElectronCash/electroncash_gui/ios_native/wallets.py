@@ -9,6 +9,7 @@ from . import gui
 from . import history
 from . import newwallet
 from electroncash.i18n import _, pgettext, language
+from electroncash.storage import delete_wallet_file, is_wallet_file_name
 
 from .uikit_bindings import *
 from .custom_objc import *
@@ -511,7 +512,7 @@ class WalletsMgr(utils.DataMgr):
             it = glob.iglob(os.path.join(d,'*'))
             for wf in it:
                 fn = os.path.split(wf)[1]
-                if fn and fn[0] != '.':
+                if fn and fn[0] != '.' and is_wallet_file_name(fn):
                     st = os.stat(wf)
                     if st and not os.path.isdir(wf):
                         info = WalletsMgr.Info(fn, st.st_size, wf)
@@ -602,7 +603,7 @@ def _ShowOptionsForWalletAtIndex(index : int, vc : UIViewController, ipadAnchor
                 txt = str(tf.text).lower().strip()
                 if txt == 'delete' or txt == delete_confirm_text: # support i18n
                     try:
-                        os.remove(info.full_path)
+                        delete_wallet_file(info.full_path)
                         parent.set_wallet_use_touchid(info.name, None, clear_asked = True) # clear cached password if any
                         parent.refresh_components('wallets')
                         utils.show_notification(message = _("Wallet deleted successfully"))
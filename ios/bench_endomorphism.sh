@@ -0,0 +1,25 @@
+#!/bin/bash
+
+# Shows what the GLV endomorphism (USE_ENDOMORPHISM in
+# CustomCode/secp256k1/libsecp256k1-config.h) buys: builds bench_secp256k1.c
+# with and without it and prints the point multiplication and verify timings
+# of both builds side by side. Run it from the ios/ directory on the machine
+# to measure, e.g. an arm64 Mac or Linux box for the iOS build, an x86_64 one
+# for the desktop library. Extra arguments are passed on to the bench, e.g.
+# -iters 5000.
+
+CC=${CC:-cc}
+out=`mktemp -d` || exit 1
+trap 'rm -rf "$out"' EXIT
+
+for variant in with without; do
+	defs="-DHAVE_CONFIG_H"
+	[ "$variant" == "without" ] && defs="$defs -DBENCH_NO_ENDOMORPHISM"
+	$CC -O2 $defs -ICustomCode/secp256k1 bench_secp256k1.c -o "$out/bench_$variant" || exit 1
+	"$out/bench_$variant" "$@" ecdsa_verify schnorr_verify ecdsa_recover ec_pubkey_tweak_mul ecmult > "$out/$variant.txt" || exit 1
+done
+
+printf "%-22s %16s %16s %8s\n" "benchmark" "without ns/op" "with ns/op" "speedup"
+join <(tail -n +2 "$out/without.txt" | awk '{print $1, $3}' | sort) \
+     <(tail -n +2 "$out/with.txt" | awk '{print $1, $3}' | sort) |
+	awk '{printf "%-22s %16s %16s %7.2fx\n", $1, $2, $3, $2 / $3}'
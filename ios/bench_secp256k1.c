@@ -0,0 +1,415 @@
+/**********************************************************************
+ * Copyright (c) 2014, 2015 Pieter Wuille, Gregory Maxwell            *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+/* Microbenchmarks for the vendored libsecp256k1 in CustomCode/secp256k1, built
+ * with exactly the options in libsecp256k1-config.h. Like
+ * gen_secp256k1_context.c this lives outside CustomCode/ so that it is not
+ * compiled into the app. On the host, from the ios/ directory:
+ *
+ *   cc -O2 -DHAVE_CONFIG_H -ICustomCode/secp256k1 bench_secp256k1.c -o bench_secp256k1
+ *   ./bench_secp256k1 [-json] [-iters N] [name ...]
+ *
+ * For a device, add this file alone to a command line or XCTest target with
+ * the same header search path and HAVE_CONFIG_H; it pulls in secp256k1.c
+ * itself, so the library must not be linked in separately.
+ *
+ * Each benchmark is run 10 times for N iterations (default 20000) and reports
+ * the min/avg/max time per operation and the number of heap allocations the
+ * library made per operation. With -json one JSON object is printed per
+ * benchmark, together with the configuration, so that the output of two
+ * builds can be diffed or loaded side by side. Naming benchmarks on the
+ * command line runs only those whose name contains one of the arguments.
+ *
+ * Building with -DBENCH_NO_ENDOMORPHISM turns off USE_ENDOMORPHISM for a
+ * baseline; bench_endomorphism.sh builds both and compares the verifies. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Count the library's allocations; util.h's checked_malloc() is the only
+ * place it calls malloc. */
+static unsigned long bench_allocs = 0;
+static void *bench_malloc(size_t size) {
+    ++bench_allocs;
+    return malloc(size);
+}
+#define malloc(size) bench_malloc(size)
+#include "libsecp256k1-config.h"
+#ifdef BENCH_NO_ENDOMORPHISM
+#undef USE_ENDOMORPHISM
+#endif
+#include "secp256k1.c"
+#undef malloc
+
+typedef struct {
+    secp256k1_context *ctx;
+    unsigned char msg[32];
+    unsigned char key[32];
+    unsigned char sig[72];
+    size_t siglen;
+    unsigned char schnorr_sig[64];
+    secp256k1_pubkey pubkey;
+    secp256k1_ecdsa_recoverable_signature recsig;
+    unsigned char data[64];
+    secp256k1_fe fe_x, fe_y;
+    secp256k1_scalar scalar_x, scalar_y;
+    secp256k1_gej gej_x;
+} bench_data;
+
+typedef void (*bench_fn)(bench_data *data, int iters);
+
+static void bench_ecdsa_sign(bench_data *data, int iters) {
+    int i;
+    secp256k1_ecdsa_signature sig;
+    for (i = 0; i < iters; i++) {
+        CHECK(secp256k1_ecdsa_sign(data->ctx, &sig, data->msg, data->key, NULL, NULL));
+        /* Chain the output into the next input, so the work can't be hoisted. */
+        secp256k1_ecdsa_signature_serialize_compact(data->ctx, data->sig, &sig);
+        memcpy(data->msg, data->sig, 32);
+        memcpy(data->key, data->sig + 32, 32);
+    }
+}
+
+static void bench_ecdsa_verify(bench_data *data, int iters) {
+    int i;
+    secp256k1_ecdsa_signature sig;
+    for (i = 0; i < iters; i++) {
+        data->sig[data->siglen - 1] ^= (i & 0xFF);
+        data->sig[data->siglen - 2] ^= ((i >> 8) & 0xFF);
+        data->sig[data->siglen - 3] ^= ((i >> 16) & 0xFF);
+        CHECK(secp256k1_ecdsa_signature_parse_der(data->ctx, &sig, data->sig, data->siglen));
+        CHECK(secp256k1_ecdsa_verify(data->ctx, &sig, data->msg, &data->pubkey) == (i == 0));
+        data->sig[data->siglen - 1] ^= (i & 0xFF);
+        data->sig[data->siglen - 2] ^= ((i >> 8) & 0xFF);
+        data->sig[data->siglen - 3] ^= ((i >> 16) & 0xFF);
+    }
+}
+
+static void bench_ecdsa_recover(bench_data *data, int iters) {
+    int i;
+    secp256k1_pubkey pubkey;
+    for (i = 0; i < iters; i++) {
+        CHECK(secp256k1_ecdsa_recover(data->ctx, &pubkey, &data->recsig, data->msg));
+    }
+}
+
+static void bench_schnorr_sign(bench_data *data, int iters) {
+    int i;
+    for (i = 0; i < iters; i++) {
+        CHECK(secp256k1_schnorr_sign(data->ctx, data->sig, data->msg, data->key, NULL, NULL));
+        memcpy(data->msg, data->sig, 32);
+        memcpy(data->key, data->sig + 32, 32);
+    }
+}
+
+static void bench_schnorr_verify(bench_data *data, int iters) {
+    int i;
+    for (i = 0; i < iters; i++) {
+        data->schnorr_sig[63] ^= (i & 0xFF);
+        data->schnorr_sig[62] ^= ((i >> 8) & 0xFF);
+        data->schnorr_sig[61] ^= ((i >> 16) & 0xFF);
+        CHECK(secp256k1_schnorr_verify(data->ctx, data->schnorr_sig, data->msg, &data->pubkey) == (i == 0));
+        data->schnorr_sig[63] ^= (i & 0xFF);
+        data->schnorr_sig[62] ^= ((i >> 8) & 0xFF);
+        data->schnorr_sig[61] ^= ((i >> 16) & 0xFF);
+    }
+}
+
+static void bench_ec_pubkey_create(bench_data *data, int iters) {
+    int i;
+    secp256k1_pubkey pubkey;
+    size_t len = 33;
+    for (i = 0; i < iters; i++) {
+        CHECK(secp256k1_ec_pubkey_create(data->ctx, &pubkey, data->key));
+        CHECK(secp256k1_ec_pubkey_serialize(data->ctx, data->data, &len, &pubkey, SECP256K1_EC_COMPRESSED));
+        memcpy(data->key, data->data + 1, 32);
+    }
+}
+
+static void bench_ec_pubkey_tweak_mul(bench_data *data, int iters) {
+    int i;
+    for (i = 0; i < iters; i++) {
+        CHECK(secp256k1_ec_pubkey_tweak_mul(data->ctx, &data->pubkey, data->key));
+    }
+}
+
+static void bench_fe_mul(bench_data *data, int iters) {
+    int i;
+    for (i = 0; i < iters; i++) {
+        secp256k1_fe_mul(&data->fe_x, &data->fe_x, &data->fe_y);
+    }
+}
+
+static void bench_fe_sqr(bench_data *data, int iters) {
+    int i;
+    for (i = 0; i < iters; i++) {
+        secp256k1_fe_sqr(&data->fe_x, &data->fe_x);
+    }
+}
+
+static void bench_fe_inv(bench_data *data, int iters) {
+    int i;
+    for (i = 0; i < iters; i++) {
+        secp256k1_fe_inv(&data->fe_x, &data->fe_x);
+        secp256k1_fe_add(&data->fe_x, &data->fe_y);
+    }
+}
+
+static void bench_fe_inv_var(bench_data *data, int iters) {
+    int i;
+    for (i = 0; i < iters; i++) {
+        secp256k1_fe_inv_var(&data->fe_x, &data->fe_x);
+        secp256k1_fe_add(&data->fe_x, &data->fe_y);
+    }
+}
+
+static void bench_fe_sqrt(bench_data *data, int iters) {
+    int i;
+    secp256k1_fe t;
+    for (i = 0; i < iters; i++) {
+        t = data->fe_x;
+        secp256k1_fe_sqrt(&data->fe_x, &t);
+        secp256k1_fe_add(&data->fe_x, &data->fe_y);
+    }
+}
+
+static void bench_fe_is_quad_var(bench_data *data, int iters) {
+    int i, j = 0;
+    for (i = 0; i < iters; i++) {
+        j += secp256k1_fe_is_quad_var(&data->fe_x);
+        secp256k1_fe_add(&data->fe_x, &data->fe_y);
+    }
+    CHECK(j <= iters);
+}
+
+static void bench_scalar_mul(bench_data *data, int iters) {
+    int i;
+    for (i = 0; i < iters; i++) {
+        secp256k1_scalar_mul(&data->scalar_x, &data->scalar_x, &data->scalar_y);
+    }
+}
+
+static void bench_scalar_inverse(bench_data *data, int iters) {
+    int i;
+    for (i = 0; i < iters; i++) {
+        secp256k1_scalar_inverse(&data->scalar_x, &data->scalar_x);
+        secp256k1_scalar_add(&data->scalar_x, &data->scalar_x, &data->scalar_y);
+    }
+}
+
+static void bench_sha256(bench_data *data, int iters) {
+    int i;
+    secp256k1_sha256 sha;
+    for (i = 0; i < iters; i++) {
+        secp256k1_sha256_initialize(&sha);
+        secp256k1_sha256_write(&sha, data->data, 32);
+        secp256k1_sha256_finalize(&sha, data->data);
+    }
+}
+
+static void bench_sha256d64(bench_data *data, int iters) {
+    int i;
+    for (i = 0; i < iters; i++) {
+        secp256k1_sha256d64(data->data, data->data, 1);
+    }
+}
+
+static void bench_ecmult_gen(bench_data *data, int iters) {
+    int i;
+    secp256k1_gej r;
+    for (i = 0; i < iters; i++) {
+        secp256k1_ecmult_gen(&data->ctx->ecmult_gen_ctx, &r, &data->scalar_x);
+        secp256k1_scalar_add(&data->scalar_x, &data->scalar_x, &data->scalar_y);
+    }
+}
+
+static void bench_ecmult(bench_data *data, int iters) {
+    int i;
+    for (i = 0; i < iters; i++) {
+        secp256k1_ecmult(&data->ctx->ecmult_ctx, &data->gej_x, &data->gej_x, &data->scalar_x, &data->scalar_y);
+    }
+}
+
+static void bench_ecmult_const(bench_data *data, int iters) {
+    int i;
+    secp256k1_ge p;
+    for (i = 0; i < iters; i++) {
+        secp256k1_ge_set_gej_var(&p, &data->gej_x);
+        secp256k1_ecmult_const(&data->gej_x, &p, &data->scalar_x);
+    }
+}
+
+static const struct {
+    const char *name;
+    bench_fn fn;
+    int divisor; /* run iters/divisor operations; cheap ops use a multiplier instead */
+} benches[] = {
+    {"ecdsa_sign", bench_ecdsa_sign, 1},
+    {"ecdsa_verify", bench_ecdsa_verify, 1},
+    {"ecdsa_recover", bench_ecdsa_recover, 1},
+    {"schnorr_sign", bench_schnorr_sign, 1},
+    {"schnorr_verify", bench_schnorr_verify, 1},
+    {"ec_pubkey_create", bench_ec_pubkey_create, 1},
+    {"ec_pubkey_tweak_mul", bench_ec_pubkey_tweak_mul, 1},
+    {"ecmult_gen", bench_ecmult_gen, 1},
+    {"ecmult", bench_ecmult, 1},
+    {"ecmult_const", bench_ecmult_const, 1},
+    {"fe_mul", bench_fe_mul, -10},
+    {"fe_sqr", bench_fe_sqr, -10},
+    {"fe_inv", bench_fe_inv, 1},
+    {"fe_inv_var", bench_fe_inv_var, 1},
+    {"fe_sqrt", bench_fe_sqrt, 1},
+    {"fe_is_quad_var", bench_fe_is_quad_var, 1},
+    {"scalar_mul", bench_scalar_mul, -10},
+    {"scalar_inverse", bench_scalar_inverse, 1},
+    {"sha256", bench_sha256, -10},
+    {"sha256d64", bench_sha256d64, -10},
+};
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void setup(bench_data *data) {
+    secp256k1_ecdsa_signature sig;
+    unsigned char b32[32];
+    int i;
+    for (i = 0; i < 32; i++) {
+        data->msg[i] = 1 + i;
+        data->key[i] = 33 + i;
+        b32[i] = 65 + i;
+    }
+    for (i = 0; i < 64; i++) {
+        data->data[i] = i;
+    }
+    data->siglen = sizeof(data->sig);
+    CHECK(secp256k1_ec_pubkey_create(data->ctx, &data->pubkey, data->key));
+    CHECK(secp256k1_ecdsa_sign(data->ctx, &sig, data->msg, data->key, NULL, NULL));
+    CHECK(secp256k1_ecdsa_signature_serialize_der(data->ctx, data->sig, &data->siglen, &sig));
+    CHECK(secp256k1_ecdsa_sign_recoverable(data->ctx, &data->recsig, data->msg, data->key, NULL, NULL));
+    CHECK(secp256k1_schnorr_sign(data->ctx, data->schnorr_sig, data->msg, data->key, NULL, NULL));
+    secp256k1_fe_set_b32(&data->fe_x, data->key);
+    secp256k1_fe_set_b32(&data->fe_y, b32);
+    secp256k1_scalar_set_b32(&data->scalar_x, data->key, NULL);
+    secp256k1_scalar_set_b32(&data->scalar_y, b32, NULL);
+    secp256k1_gej_set_ge(&data->gej_x, &secp256k1_ge_const_g);
+}
+
+static int selected(const char *name, int argc, char **argv, int first) {
+    int i, any = 0;
+    for (i = first; i < argc; i++) {
+        any = 1;
+        if (strstr(name, argv[i]) != NULL) {
+            return 1;
+        }
+    }
+    return !any;
+}
+
+static void print_config(void) {
+    printf("{\"config\": {\"field\": \"%s\", \"scalar\": \"%s\", \"field_inv\": \"%s\", "
+           "\"ecmult_window\": %d, \"gen_prec_bits\": %d, \"endomorphism\": %d, \"static_tables\": %d}}\n",
+#if defined(USE_FIELD_5X52)
+           "5x52",
+#else
+           "10x26",
+#endif
+#if defined(USE_SCALAR_4X64)
+           "4x64",
+#else
+           "8x32",
+#endif
+#if defined(USE_FIELD_INV_SAFEGCD)
+           "safegcd",
+#elif defined(USE_FIELD_INV_NUM)
+           "num",
+#else
+           "builtin",
+#endif
+           ECMULT_WINDOW_SIZE, ECMULT_GEN_PREC_BITS,
+#ifdef USE_ENDOMORPHISM
+           1,
+#else
+           0,
+#endif
+#ifdef USE_ECMULT_STATIC_PRECOMPUTATION
+           1
+#else
+           0
+#endif
+    );
+}
+
+int main(int argc, char **argv) {
+    const int count = 10;
+    int iters = 20000, json = 0, first = 1;
+    size_t b;
+    bench_data data;
+
+    while (first < argc && argv[first][0] == '-') {
+        if (strcmp(argv[first], "-json") == 0) {
+            json = 1;
+        } else if (strcmp(argv[first], "-iters") == 0 && first + 1 < argc) {
+            iters = atoi(argv[++first]);
+        } else {
+            fprintf(stderr, "usage: %s [-json] [-iters N] [name ...]\n", argv[0]);
+            return 1;
+        }
+        first++;
+    }
+    if (iters < 10) {
+        iters = 10;
+    }
+
+    data.ctx = secp256k1_context_create(SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY);
+    if (json) {
+        print_config();
+    } else {
+        printf("%-22s %12s %12s %12s %12s\n", "benchmark", "min ns/op", "avg ns/op", "max ns/op", "allocs/op");
+    }
+
+    for (b = 0; b < sizeof(benches) / sizeof(benches[0]); b++) {
+        double min = 1e300, max = 0, sum = 0;
+        unsigned long allocs;
+        int n = benches[b].divisor > 0 ? iters / benches[b].divisor : iters * -benches[b].divisor;
+        int i;
+        if (!selected(benches[b].name, argc, argv, first)) {
+            continue;
+        }
+        setup(&data);
+        /* Warm up, then time the runs. */
+        benches[b].fn(&data, n / 10);
+        allocs = 0;
+        for (i = 0; i < count; i++) {
+            double t;
+            unsigned long a;
+            setup(&data);
+            a = bench_allocs;
+            t = now_ns();
+            benches[b].fn(&data, n);
+            t = (now_ns() - t) / n;
+            allocs += bench_allocs - a;
+            if (t < min) min = t;
+            if (t > max) max = t;
+            sum += t;
+        }
+        if (json) {
+            printf("{\"bench\": \"%s\", \"iters\": %d, \"runs\": %d, \"min_ns\": %.1f, \"avg_ns\": %.1f, \"max_ns\": %.1f, \"allocs_per_op\": %.3f}\n",
+                   benches[b].name, n, count, min, sum / count, max, (double)allocs / ((double)n * count));
+        } else {
+            printf("%-22s %12.1f %12.1f %12.1f %12.3f\n",
+                   benches[b].name, min, sum / count, max, (double)allocs / ((double)n * count));
+        }
+        fflush(stdout);
+    }
+
+    secp256k1_context_destroy(data.ctx);
+    return 0;
+}
@@ -0,0 +1,133 @@
+/**********************************************************************
+ * Copyright (c) 2013, 2014, 2015 Thomas Daede, Cory Fields           *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+/* Generates CustomCode/secp256k1/ecmult_static_context.h, the precomputed
+ * ecmult_gen and ecmult tables used when USE_ECMULT_STATIC_PRECOMPUTATION is
+ * defined. This lives outside CustomCode/ so that it is not compiled into the
+ * app. Build and run it from the ios/ directory on the host:
+ *
+ *   cc -O2 -ICustomCode/secp256k1 gen_secp256k1_context.c -o gen_context
+ *   ./gen_context CustomCode/secp256k1/ecmult_static_context.h
+ *
+ * The tables are generated for the ECMULT_WINDOW_SIZE and ECMULT_GEN_PREC_BITS
+ * in libsecp256k1-config.h. Regenerate whenever either changes. */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "libsecp256k1-config.h"
+/* We are generating the static tables, so we cannot use them. */
+#undef USE_ECMULT_STATIC_PRECOMPUTATION
+/* Only the 10x26 field exposes SECP256K1_FE_STORAGE_CONST_GET. The emitted SC()
+ * initializers are independent of the field implementation the app builds with. */
+#undef USE_FIELD_5X52
+#undef USE_ASM_X86_64
+#undef USE_FIELD_INV_SAFEGCD
+#define USE_FIELD_10X26 1
+#define USE_FIELD_INV_BUILTIN 1
+
+#include "secp256k1.h"
+#include "util.h"
+#include "field_impl.h"
+#include "scalar_impl.h"
+#include "group_impl.h"
+#include "ecmult_gen_impl.h"
+#include "ecmult_impl.h"
+
+static void default_error_callback_fn(const char* str, void* data) {
+    (void)data;
+    fprintf(stderr, "[libsecp256k1] internal consistency check failed: %s\n", str);
+    abort();
+}
+
+static const secp256k1_callback default_error_callback = {
+    default_error_callback_fn,
+    NULL
+};
+
+static void print_table(FILE *fp, const char *name, const secp256k1_ge_storage *table, int n) {
+    int i;
+    fprintf(fp, "static const secp256k1_ge_storage %s[%d] = {\n", name, n);
+    for (i = 0; i < n; i++) {
+        fprintf(fp, "    SC(%uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu)",
+                SECP256K1_GE_STORAGE_CONST_GET(table[i]));
+        fprintf(fp, i != n - 1 ? ",\n" : "\n");
+    }
+    fprintf(fp, "};\n");
+}
+
+int main(int argc, char **argv) {
+    secp256k1_ecmult_gen_context gen_ctx;
+    secp256k1_ge_storage *pre_g, *pre_g_128;
+    secp256k1_gej gj, g_128j;
+    const char *path = "CustomCode/secp256k1/ecmult_static_context.h";
+    const int n = ECMULT_TABLE_SIZE(WINDOW_G);
+    int i, j;
+    FILE* fp;
+
+    if (argc > 1) {
+        path = argv[1];
+    }
+    fp = fopen(path, "w");
+    if (fp == NULL) {
+        fprintf(stderr, "Could not open %s for writing!\n", path);
+        return -1;
+    }
+
+    /* The ecmult_gen comb, exactly as secp256k1_ecmult_gen_context_build computes it. */
+    secp256k1_ecmult_gen_context_init(&gen_ctx);
+    secp256k1_ecmult_gen_context_build(&gen_ctx, &default_error_callback);
+
+    /* Odd multiples of G and of 2^128*G, as secp256k1_ecmult_context_build computes them.
+     * The 2^128*G table is always emitted so the same header serves builds with and
+     * without USE_ENDOMORPHISM. */
+    pre_g = (secp256k1_ge_storage *)checked_malloc(&default_error_callback, sizeof(*pre_g) * n);
+    pre_g_128 = (secp256k1_ge_storage *)checked_malloc(&default_error_callback, sizeof(*pre_g_128) * n);
+    secp256k1_gej_set_ge(&gj, &secp256k1_ge_const_g);
+    secp256k1_ecmult_odd_multiples_table_storage_var(n, pre_g, &gj, &default_error_callback);
+    g_128j = gj;
+    for (i = 0; i < 128; i++) {
+        secp256k1_gej_double_var(&g_128j, &g_128j, NULL);
+    }
+    secp256k1_ecmult_odd_multiples_table_storage_var(n, pre_g_128, &g_128j, &default_error_callback);
+
+    fprintf(fp, "/* This file was automatically generated by gen_secp256k1_context.c. */\n");
+    fprintf(fp, "#ifndef SECP256K1_ECMULT_STATIC_CONTEXT_H\n");
+    fprintf(fp, "#define SECP256K1_ECMULT_STATIC_CONTEXT_H\n");
+    fprintf(fp, "#include \"group.h\"\n");
+    fprintf(fp, "#define SC SECP256K1_GE_STORAGE_CONST\n");
+
+    fprintf(fp, "/* Tooth size (ECMULT_GEN_PREC_BITS) the comb below was generated for. */\n");
+    fprintf(fp, "#define ECMULT_STATIC_GEN_PREC_BITS %d\n", ECMULT_GEN_PREC_BITS);
+    fprintf(fp, "static const secp256k1_ge_storage secp256k1_ecmult_static_context[%d][%d] = {\n", ECMULT_GEN_PREC_N, ECMULT_GEN_PREC_G);
+    for (j = 0; j < ECMULT_GEN_PREC_N; j++) {
+        fprintf(fp, "{\n");
+        for (i = 0; i < ECMULT_GEN_PREC_G; i++) {
+            fprintf(fp, "    SC(%uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu)",
+                    SECP256K1_GE_STORAGE_CONST_GET((*gen_ctx.prec)[j][i]));
+            fprintf(fp, i != ECMULT_GEN_PREC_G - 1 ? ",\n" : "\n");
+        }
+        fprintf(fp, j != ECMULT_GEN_PREC_N - 1 ? "},\n" : "}\n");
+    }
+    fprintf(fp, "};\n");
+
+    fprintf(fp, "/* Window size the odd-multiple tables below were generated for. Any\n");
+    fprintf(fp, " * WINDOW_G up to this value can use them, since a smaller table is a prefix. */\n");
+    fprintf(fp, "#define ECMULT_STATIC_WINDOW_G %d\n", WINDOW_G);
+    print_table(fp, "secp256k1_ecmult_static_pre_g", pre_g, n);
+    fprintf(fp, "#ifdef USE_ENDOMORPHISM\n");
+    print_table(fp, "secp256k1_ecmult_static_pre_g_128", pre_g_128, n);
+    fprintf(fp, "#endif\n");
+
+    fprintf(fp, "#undef SC\n");
+    fprintf(fp, "#endif\n");
+    fclose(fp);
+
+    free(pre_g);
+    free(pre_g_128);
+    secp256k1_ecmult_gen_context_clear(&gen_ctx);
+    return 0;
+}
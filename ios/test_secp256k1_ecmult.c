@@ -0,0 +1,137 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+/* Checks secp256k1_ecmult_multi_var in CustomCode/secp256k1/ecmult_impl.h
+ * against the one point at a time secp256k1_ecmult_multi_simple_var, for
+ * batches below and above the Pippenger threshold and for every scratch space
+ * size from none at all to enough for the whole batch. A scratch space too
+ * small for Pippenger or Strauss must still give the right sum. Like
+ * bench_secp256k1.c this lives outside CustomCode/ so that it is not compiled
+ * into the app. From the ios/ directory, with and without the endomorphism:
+ *
+ *   cc -O2 -DHAVE_CONFIG_H -ICustomCode/secp256k1 test_secp256k1_ecmult.c -o test_secp256k1_ecmult
+ *   cc -O2 -DHAVE_CONFIG_H -DTEST_NO_ENDOMORPHISM -ICustomCode/secp256k1 test_secp256k1_ecmult.c -o test_secp256k1_ecmult_noendo
+ *   ./test_secp256k1_ecmult [seed]
+ *
+ * It exits non-zero on the first mismatch. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "libsecp256k1-config.h"
+#ifdef TEST_NO_ENDOMORPHISM
+#undef USE_ENDOMORPHISM
+#endif
+#include "secp256k1.c"
+
+static uint64_t test_rng_state;
+
+/* splitmix64; any seed gives a full period. */
+static uint64_t test_rand64(void) {
+    uint64_t z = (test_rng_state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void test_random_scalar(secp256k1_scalar *r) {
+    unsigned char b32[32];
+    int i;
+    for (i = 0; i < 32; i++) {
+        b32[i] = (unsigned char)test_rand64();
+    }
+    secp256k1_scalar_set_b32(r, b32, NULL);
+}
+
+struct test_ecmult_data {
+    const secp256k1_scalar *sc;
+    const secp256k1_ge *pt;
+};
+
+static int test_ecmult_callback(secp256k1_scalar *sc, secp256k1_ge *pt, size_t idx, void *cbdata) {
+    const struct test_ecmult_data *data = (const struct test_ecmult_data *)cbdata;
+    *sc = data->sc[idx];
+    *pt = data->pt[idx];
+    return 1;
+}
+
+static int test_gej_eq(const secp256k1_gej *a, const secp256k1_gej *b) {
+    secp256k1_gej d;
+    secp256k1_gej_neg(&d, a);
+    secp256k1_gej_add_var(&d, &d, b, NULL);
+    return secp256k1_gej_is_infinity(&d);
+}
+
+int main(int argc, char **argv) {
+    static const size_t counts[] = {1, 2, 5, 40, ECMULT_PIPPENGER_THRESHOLD - 1, ECMULT_PIPPENGER_THRESHOLD, 300};
+    const size_t ncounts = sizeof(counts) / sizeof(counts[0]);
+    const size_t max_n = 300;
+    uint64_t seed = (uint64_t)time(NULL);
+    secp256k1_context *ctx = secp256k1_context_create(SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY);
+    secp256k1_scalar *sc = (secp256k1_scalar *)malloc(max_n * sizeof(secp256k1_scalar));
+    secp256k1_ge *pt = (secp256k1_ge *)malloc(max_n * sizeof(secp256k1_ge));
+    struct test_ecmult_data data;
+    secp256k1_scalar g_sc;
+    size_t i, j, checks = 0;
+
+    if (argc > 1) seed = strtoull(argv[1], NULL, 0);
+    test_rng_state = seed;
+#ifdef USE_ENDOMORPHISM
+    printf("ecmult_multi: with endomorphism\n");
+#else
+    printf("ecmult_multi: without endomorphism\n");
+#endif
+    printf("seed %llu\n", (unsigned long long)seed);
+
+    for (i = 0; i < max_n; i++) {
+        secp256k1_scalar k;
+        secp256k1_gej pj;
+        test_random_scalar(&k);
+        secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &pj, &k);
+        secp256k1_ge_set_gej(&pt[i], &pj);
+        test_random_scalar(&sc[i]);
+    }
+    test_random_scalar(&g_sc);
+    data.sc = sc;
+    data.pt = pt;
+
+    for (i = 0; i < ncounts; i++) {
+        const size_t n = counts[i];
+        const size_t full = secp256k1_ecmult_multi_scratch_size(n);
+        secp256k1_gej want[2];
+        size_t size;
+        /* Without and with a multiple of G. */
+        secp256k1_ecmult_multi_simple_var(&ctx->ecmult_ctx, &want[0], NULL, test_ecmult_callback, &data, n);
+        secp256k1_ecmult_multi_simple_var(&ctx->ecmult_ctx, &want[1], &g_sc, test_ecmult_callback, &data, n);
+        /* No scratch space, then sizes growing by about 6% up to twice what
+         * the whole batch needs, so that Strauss and Pippenger run with many
+         * different batch splits and bucket windows. */
+        for (size = 0; size <= 2 * full; size += 64 + size / 16) {
+            secp256k1_scratch *scratch = size ? secp256k1_scratch_create(&ctx->error_callback, size) : NULL;
+            secp256k1_gej got;
+            for (j = 0; j < 2; j++) {
+                if (!secp256k1_ecmult_multi_var(&ctx->error_callback, &ctx->ecmult_ctx, scratch, &got, j ? &g_sc : NULL, test_ecmult_callback, &data, n)) {
+                    fprintf(stderr, "secp256k1_ecmult_multi_var failed: %lu points, %lu bytes of scratch\n", (unsigned long)n, (unsigned long)size);
+                    return 1;
+                }
+                if (!test_gej_eq(&got, &want[j])) {
+                    fprintf(stderr, "secp256k1_ecmult_multi_var mismatch: %lu points, %lu bytes of scratch\n", (unsigned long)n, (unsigned long)size);
+                    return 1;
+                }
+                checks++;
+            }
+            if (scratch) {
+                secp256k1_scratch_destroy(&ctx->error_callback, scratch);
+            }
+        }
+    }
+    free(pt);
+    free(sc);
+    secp256k1_context_destroy(ctx);
+    printf("ok, %lu sums\n", (unsigned long)checks);
+    return 0;
+}
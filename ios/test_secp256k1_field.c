@@ -0,0 +1,132 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+/* Differential test for the assembly 5x52 field multiply and square in
+ * CustomCode/secp256k1/field_5x52_asm_impl.h. The host's assembly (AArch64,
+ * or x86_64) is turned on whatever libsecp256k1-config.h says, and
+ * secp256k1_fe_mul_inner and secp256k1_fe_sqr_inner are compared limb for
+ * limb with the C code of field_5x52_int128_impl.h, on random and edge-case
+ * inputs up to the largest limbs the callers may pass, and with the output
+ * aliasing an input. Run it on an AArch64 host before defining
+ * USE_ASM_AARCH64_FIELD for the app. Like bench_secp256k1.c this lives
+ * outside CustomCode/ so that it is not compiled into the app. From the ios/
+ * directory:
+ *
+ *   cc -O2 -DHAVE_CONFIG_H -ICustomCode/secp256k1 test_secp256k1_field.c -o test_secp256k1_field
+ *   ./test_secp256k1_field [iterations [seed]]
+ *
+ * It exits non-zero on the first mismatch. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "libsecp256k1-config.h"
+#if defined(__aarch64__)
+#define USE_ASM_AARCH64_FIELD 1
+#elif defined(__x86_64__)
+#define USE_ASM_X86_64 1
+#else
+#error "test_secp256k1_field.c needs an AArch64 or x86_64 host"
+#endif
+#include "secp256k1.c"
+
+#if !defined(USE_FIELD_5X52)
+#error "test_secp256k1_field.c tests the 5x52 field implementation"
+#endif
+
+/* The C reference, under other names. */
+#undef SECP256K1_FIELD_INNER5X52_IMPL_H
+#define secp256k1_fe_mul_inner test_ref_fe_mul_inner
+#define secp256k1_fe_sqr_inner test_ref_fe_sqr_inner
+#include "field_5x52_int128_impl.h"
+#undef secp256k1_fe_mul_inner
+#undef secp256k1_fe_sqr_inner
+
+static uint64_t test_rng_state;
+
+/* splitmix64; any seed gives a full period. */
+static uint64_t test_rand64(void) {
+    uint64_t z = (test_rng_state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/* Limbs below 2^56, the top one below 2^52: the bounds fe_mul_inner and
+ * fe_sqr_inner check under VERIFY, i.e. magnitude 8 and a bit. Mostly
+ * uniform, sometimes all ones, zero or short, where carries go wrong. */
+static void test_random_limbs(uint64_t *a) {
+    int i;
+    for (i = 0; i < 5; i++) {
+        const int bits = i == 4 ? 52 : 56;
+        const uint64_t mask = (((uint64_t)1) << bits) - 1;
+        switch (test_rand64() % 8) {
+        case 0: a[i] = mask; break;
+        case 1: a[i] = 0; break;
+        case 2: a[i] = test_rand64() & (mask >> (test_rand64() % bits)); break;
+        case 3: a[i] = 0xFFFFFFFFFFFFFULL; break;
+        default: a[i] = test_rand64() & mask; break;
+        }
+    }
+}
+
+static int test_fail(const char *what, const uint64_t *a, const uint64_t *b) {
+    int i;
+    fprintf(stderr, "mismatch in %s\n  a =", what);
+    for (i = 0; i < 5; i++) fprintf(stderr, " %016llx", (unsigned long long)a[i]);
+    fprintf(stderr, "\n  b =");
+    for (i = 0; i < 5; i++) fprintf(stderr, " %016llx", (unsigned long long)b[i]);
+    fprintf(stderr, "\n");
+    return 1;
+}
+
+static int test_pair(const uint64_t *a, const uint64_t *b) {
+    uint64_t want[5], got[5];
+
+    test_ref_fe_mul_inner(want, a, b);
+    secp256k1_fe_mul_inner(got, a, b);
+    if (memcmp(want, got, sizeof(want)) != 0) return test_fail("secp256k1_fe_mul_inner", a, b);
+
+    /* r aliasing a, as secp256k1_fe_mul(r, r, b) does. */
+    memcpy(got, a, sizeof(got));
+    secp256k1_fe_mul_inner(got, got, b);
+    if (memcmp(want, got, sizeof(want)) != 0) return test_fail("secp256k1_fe_mul_inner (r == a)", a, b);
+
+    test_ref_fe_sqr_inner(want, a);
+    secp256k1_fe_sqr_inner(got, a);
+    if (memcmp(want, got, sizeof(want)) != 0) return test_fail("secp256k1_fe_sqr_inner", a, a);
+
+    memcpy(got, a, sizeof(got));
+    secp256k1_fe_sqr_inner(got, got);
+    if (memcmp(want, got, sizeof(want)) != 0) return test_fail("secp256k1_fe_sqr_inner (r == a)", a, a);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    long iters = 1000000, i;
+    uint64_t seed = (uint64_t)time(NULL);
+
+    if (argc > 1) iters = atol(argv[1]);
+    if (argc > 2) seed = strtoull(argv[2], NULL, 0);
+    test_rng_state = seed;
+
+#if defined(USE_ASM_AARCH64)
+    printf("field mul/sqr: AArch64 assembly\n");
+#else
+    printf("field mul/sqr: x86_64 assembly\n");
+#endif
+    printf("seed %llu, %ld iterations\n", (unsigned long long)seed, iters);
+
+    for (i = 0; i < iters; i++) {
+        uint64_t a[5], b[5];
+        test_random_limbs(a);
+        test_random_limbs(b);
+        if (test_pair(a, b)) return 1;
+    }
+    printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,338 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+/* Differential test for the 4-way field code of CustomCode/secp256k1/field4.h
+ * and its users. The host's vector kernels (NEON on ARM, AVX2 on x86_64) are
+ * turned on whatever libsecp256k1-config.h says, and every secp256k1_fe4
+ * operation is compared lane by lane with the scalar field, on random and
+ * edge-case inputs up to the largest magnitudes the callers may pass. So are
+ * secp256k1_gej4_add_ge, including the doubling and infinity cases, and
+ * secp256k1_ecmult_gen_many. Run it on an ARM host before defining
+ * USE_FE4_NEON for the app. Like bench_secp256k1.c this lives outside
+ * CustomCode/ so that it is not compiled into the app. From the ios/
+ * directory, with the 5x52 field and with the 10x26 one of 32-bit ARM:
+ *
+ *   cc -O2 -DHAVE_CONFIG_H -ICustomCode/secp256k1 test_secp256k1_field4.c -o test_secp256k1_field4
+ *   cc -O2 -DHAVE_CONFIG_H -DTEST_FIELD_10X26 -ICustomCode/secp256k1 test_secp256k1_field4.c -o test_secp256k1_field4_10x26
+ *   ./test_secp256k1_field4 [iterations [seed]]
+ *
+ * On x86_64 add -mavx2. It exits non-zero on the first mismatch. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "libsecp256k1-config.h"
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define USE_FE4_NEON 1
+#elif !defined(__AVX2__)
+#error "test_secp256k1_field4.c needs NEON, or AVX2 (build with -mavx2)"
+#endif
+#ifdef TEST_FIELD_10X26
+#undef USE_FIELD_5X52
+#define USE_FIELD_10X26 1
+#undef USE_FIELD_INV_SAFEGCD  /* 5x52 only */
+#define USE_FIELD_INV_BUILTIN 1
+#endif
+#include "secp256k1.c"
+
+#if !defined(SECP256K1_FE4_VECTOR)
+#error "field4.h did not pick a vector kernel"
+#endif
+
+static uint64_t test_rng_state;
+
+/* splitmix64; any seed gives a full period. */
+static uint64_t test_rand64(void) {
+    uint64_t z = (test_rng_state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void test_random_fe(secp256k1_fe *r) {
+    unsigned char b32[32];
+    int i;
+    do {
+        for (i = 0; i < 32; i++) {
+            b32[i] = (unsigned char)test_rand64();
+        }
+    } while (!secp256k1_fe_set_b32(r, b32));
+}
+
+static void test_random_scalar(secp256k1_scalar *r) {
+    unsigned char b32[32];
+    int i;
+    for (i = 0; i < 32; i++) {
+        b32[i] = (unsigned char)test_rand64();
+    }
+    secp256k1_scalar_set_b32(r, b32, NULL);
+}
+
+/* Limbs of magnitude 1 as the lane keeps them, 26 bits each and 22 in the
+ * top one: mostly random, sometimes all ones (2^256-1, above p), zero, or
+ * the raw limbs of p itself, where the carries and the reduction go wrong. */
+static void test_edge_limbs(uint64_t *n) {
+    static const uint64_t p[10] = {0x3FFFC2FULL, 0x3FFFFBFULL, 0x3FFFFFFULL, 0x3FFFFFFULL, 0x3FFFFFFULL,
+                                   0x3FFFFFFULL, 0x3FFFFFFULL, 0x3FFFFFFULL, 0x3FFFFFFULL, 0x03FFFFFULL};
+    const int kind = (int)(test_rand64() % 4);
+    int i;
+    for (i = 0; i < 10; i++) {
+        const uint64_t mask = i == 9 ? 0x03FFFFFULL : 0x3FFFFFFULL;
+        switch (kind) {
+        case 0: n[i] = mask; break;
+        case 1: n[i] = 0; break;
+        case 2: n[i] = p[i]; break;
+        default: n[i] = test_rand64() & mask; break;
+        }
+    }
+}
+
+/* The scalar field element with the 10x26 limbs n, of magnitude 1. */
+static void test_fe_from_limbs(secp256k1_fe *r, const uint64_t *n) {
+    int i;
+#if defined(USE_FIELD_10X26)
+    for (i = 0; i < 10; i++) {
+        r->n[i] = (uint32_t)n[i];
+    }
+#else
+    for (i = 0; i < 5; i++) {
+        r->n[i] = n[2 * i] | (n[2 * i + 1] << 26);
+    }
+#endif
+#ifdef VERIFY
+    r->magnitude = 1;
+    r->normalized = 0;
+#endif
+}
+
+/* Four lanes of magnitude 1 in a, and the same values in ref. */
+static void test_random_lanes(secp256k1_fe4 *a, secp256k1_fe *ref) {
+    int l, i;
+    for (l = 0; l < 4; l++) {
+        if (test_rand64() % 4 == 0) {
+            uint64_t n[10];
+            test_edge_limbs(n);
+            for (i = 0; i < 10; i++) {
+                a->n[i][l] = n[i];
+            }
+            test_fe_from_limbs(&ref[l], n);
+        } else {
+            /* set_fe takes any magnitude up to 32 */
+            test_random_fe(&ref[l]);
+            secp256k1_fe_mul_int(&ref[l], 1 + (int)(test_rand64() % 32));
+            secp256k1_fe4_set_fe(a, l, &ref[l]);
+        }
+    }
+}
+
+static int test_lanes_eq(const char *what, const secp256k1_fe4 *a, const secp256k1_fe *ref) {
+    int l;
+    for (l = 0; l < 4; l++) {
+        secp256k1_fe got, want = ref[l];
+        secp256k1_fe4_get_fe(&got, a, l);
+        secp256k1_fe_normalize(&want);
+        if (!secp256k1_fe_equal(&got, &want)) {
+            unsigned char g[32], w[32];
+            int i;
+            secp256k1_fe_get_b32(g, &got);
+            secp256k1_fe_get_b32(w, &want);
+            fprintf(stderr, "mismatch in %s, lane %d\n  got  ", what, l);
+            for (i = 0; i < 32; i++) fprintf(stderr, "%02x", g[i]);
+            fprintf(stderr, "\n  want ");
+            for (i = 0; i < 32; i++) fprintf(stderr, "%02x", w[i]);
+            fprintf(stderr, "\n");
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int test_field(void) {
+    secp256k1_fe4 a, b, am, bm, r;
+    secp256k1_fe ra[4], rb[4], ram[4], rbm[4], rr[4];
+    const int ka = 1 + (int)(test_rand64() % 8), kb = 1 + (int)(test_rand64() % 8);
+    int flags[4], l;
+
+    test_random_lanes(&a, ra);
+    test_random_lanes(&b, rb);
+    if (test_lanes_eq("secp256k1_fe4_set_fe/get_fe", &a, ra)) return 1;
+
+    /* mul and sqr at magnitudes up to 8, made with mul_int */
+    secp256k1_fe4_mul_int(&am, &a, ka);
+    secp256k1_fe4_mul_int(&bm, &b, kb);
+    for (l = 0; l < 4; l++) {
+        ram[l] = ra[l];
+        secp256k1_fe_normalize_weak(&ram[l]);
+        secp256k1_fe_mul_int(&ram[l], ka);
+        rbm[l] = rb[l];
+        secp256k1_fe_normalize_weak(&rbm[l]);
+        secp256k1_fe_mul_int(&rbm[l], kb);
+    }
+    if (test_lanes_eq("secp256k1_fe4_mul_int", &am, ram)) return 1;
+    secp256k1_fe4_mul(&r, &am, &bm);
+    for (l = 0; l < 4; l++) secp256k1_fe_mul(&rr[l], &ram[l], &rbm[l]);
+    if (test_lanes_eq("secp256k1_fe4_mul", &r, rr)) return 1;
+    /* r aliasing a, as secp256k1_gej4_add_ge does */
+    r = am;
+    secp256k1_fe4_mul(&r, &r, &bm);
+    if (test_lanes_eq("secp256k1_fe4_mul (r == a)", &r, rr)) return 1;
+    secp256k1_fe4_sqr(&r, &am);
+    for (l = 0; l < 4; l++) secp256k1_fe_sqr(&rr[l], &ram[l]);
+    if (test_lanes_eq("secp256k1_fe4_sqr", &r, rr)) return 1;
+
+    secp256k1_fe4_add(&r, &am, &bm);
+    for (l = 0; l < 4; l++) {
+        rr[l] = ram[l];
+        secp256k1_fe_add(&rr[l], &rbm[l]);
+    }
+    if (test_lanes_eq("secp256k1_fe4_add", &r, rr)) return 1;
+
+    secp256k1_fe4_negate(&r, &am, ka);
+    for (l = 0; l < 4; l++) secp256k1_fe_negate(&rr[l], &ram[l], ka);
+    if (test_lanes_eq("secp256k1_fe4_negate", &r, rr)) return 1;
+
+    secp256k1_fe4_normalize_weak(&r, &am);
+    if (test_lanes_eq("secp256k1_fe4_normalize_weak", &r, ram)) return 1;
+
+    /* a - a in some lanes, so that zero shows up at magnitude ka+1 */
+    secp256k1_fe4_negate(&r, &am, ka);
+    for (l = 0; l < 4; l++) {
+        flags[l] = (int)(test_rand64() & 1);
+    }
+    secp256k1_fe4_cmov(&bm, &am, flags);
+    for (l = 0; l < 4; l++) {
+        if (flags[l]) rbm[l] = ram[l];
+    }
+    if (test_lanes_eq("secp256k1_fe4_cmov", &bm, rbm)) return 1;
+    secp256k1_fe4_add(&r, &r, &bm);
+    for (l = 0; l < 4; l++) {
+        secp256k1_fe_negate(&rr[l], &ram[l], ka);
+        secp256k1_fe_add(&rr[l], &rbm[l]);
+    }
+    if (test_lanes_eq("secp256k1_fe4_add (a - b)", &r, rr)) return 1;
+    secp256k1_fe4_normalizes_to_zero(flags, &r);
+    for (l = 0; l < 4; l++) {
+        if (flags[l] != secp256k1_fe_normalizes_to_zero(&rr[l])) {
+            fprintf(stderr, "mismatch in secp256k1_fe4_normalizes_to_zero, lane %d\n", l);
+            return 1;
+        }
+    }
+    /* the edge lanes of a, 0 and p among them, as they are */
+    secp256k1_fe4_normalizes_to_zero(flags, &a);
+    for (l = 0; l < 4; l++) {
+        rr[l] = ra[l];
+        secp256k1_fe_normalize_weak(&rr[l]);
+        if (flags[l] != secp256k1_fe_normalizes_to_zero(&rr[l])) {
+            fprintf(stderr, "mismatch in secp256k1_fe4_normalizes_to_zero (edge), lane %d\n", l);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int test_gej_eq(const secp256k1_gej *a, const secp256k1_gej *b) {
+    secp256k1_gej d;
+    secp256k1_gej_neg(&d, a);
+    secp256k1_gej_add_var(&d, &d, b, NULL);
+    return secp256k1_gej_is_infinity(&d);
+}
+
+static int test_group(const secp256k1_context *ctx) {
+    secp256k1_gej a[4], want, got;
+    secp256k1_ge b[4];
+    secp256k1_ge_storage bs;
+    secp256k1_gej4 a4, r4;
+    secp256k1_ge4 b4;
+    int l;
+
+    for (l = 0; l < 4; l++) {
+        secp256k1_scalar k;
+        secp256k1_gej t;
+        secp256k1_fe z;
+        test_random_scalar(&k);
+        secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &t, &k);
+        secp256k1_ge_set_gej(&b[l], &t);
+        test_random_scalar(&k);
+        secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &a[l], &k);
+        /* a random z, so that a is not affine */
+        test_random_fe(&z);
+        if (!secp256k1_fe_is_zero(&z)) {
+            secp256k1_gej_rescale(&a[l], &z);
+        }
+        switch (test_rand64() % 6) {
+        case 0: secp256k1_gej_set_infinity(&a[l]); break;
+        case 1: secp256k1_gej_set_ge(&a[l], &b[l]); break;  /* a == b: a doubling */
+        case 2: secp256k1_gej_set_ge(&a[l], &b[l]); secp256k1_gej_neg(&a[l], &a[l]); break;  /* a == -b */
+        default: break;
+        }
+        secp256k1_gej4_set_gej(&a4, l, &a[l]);
+        secp256k1_ge_to_storage(&bs, &b[l]);
+        secp256k1_ge4_set_ge_storage(&b4, l, &bs);
+    }
+    secp256k1_gej4_add_ge(&r4, &a4, &b4);
+    for (l = 0; l < 4; l++) {
+        secp256k1_gej_add_ge(&want, &a[l], &b[l]);
+        secp256k1_gej4_get_gej(&got, &r4, l);
+        if (secp256k1_gej_is_infinity(&got) != secp256k1_gej_is_infinity(&want) || !test_gej_eq(&got, &want)) {
+            fprintf(stderr, "mismatch in secp256k1_gej4_add_ge, lane %d\n", l);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int test_ecmult_gen_many(const secp256k1_context *ctx) {
+    secp256k1_scalar k[9];
+    secp256k1_gej got[9], want;
+    size_t i;
+    for (i = 0; i < 9; i++) {
+        test_random_scalar(&k[i]);
+    }
+    secp256k1_scalar_set_int(&k[1], 0);
+    secp256k1_scalar_set_int(&k[2], 1);
+    secp256k1_scalar_negate(&k[3], &k[2]);
+    secp256k1_ecmult_gen_many(&ctx->ecmult_gen_ctx, got, k, 9);
+    for (i = 0; i < 9; i++) {
+        secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &want, &k[i]);
+        if (!test_gej_eq(&got[i], &want)) {
+            fprintf(stderr, "mismatch in secp256k1_ecmult_gen_many, key %lu\n", (unsigned long)i);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    long iters = 100000, i;
+    uint64_t seed = (uint64_t)time(NULL);
+    secp256k1_context *ctx = secp256k1_context_create(SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY);
+
+    if (argc > 1) iters = atol(argv[1]);
+    if (argc > 2) seed = strtoull(argv[2], NULL, 0);
+    test_rng_state = seed;
+
+#if defined(SECP256K1_FE4_NEON)
+    printf("fe4: NEON");
+#else
+    printf("fe4: AVX2");
+#endif
+#if defined(USE_FIELD_10X26)
+    printf(", 10x26 field\n");
+#else
+    printf(", 5x52 field\n");
+#endif
+    printf("seed %llu, %ld iterations\n", (unsigned long long)seed, iters);
+
+    for (i = 0; i < iters; i++) {
+        if (test_field()) return 1;
+        if (i % 16 == 0 && test_group(ctx)) return 1;
+        if (i % 256 == 0 && test_ecmult_gen_many(ctx)) return 1;
+    }
+    secp256k1_context_destroy(ctx);
+    printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,241 @@
+/**********************************************************************
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+/* Differential test for the 4x64 scalar multiply, square and reduction in
+ * CustomCode/secp256k1/scalar_4x64_impl.h. Random and edge-case inputs go
+ * through secp256k1_scalar_mul_512, secp256k1_scalar_sqr_512 and
+ * secp256k1_scalar_reduce_512, whichever of the AArch64, x86_64 or C branches
+ * libsecp256k1-config.h selects for the host, and the results are compared
+ * with a plain 32-bit limb reference below. Run it on an AArch64 host to cover
+ * the assembly. Like bench_secp256k1.c this lives outside CustomCode/ so that
+ * it is not compiled into the app. From the ios/ directory:
+ *
+ *   cc -O2 -DHAVE_CONFIG_H -ICustomCode/secp256k1 test_secp256k1_scalar.c -o test_secp256k1_scalar
+ *   ./test_secp256k1_scalar [iterations [seed]]
+ *
+ * It exits non-zero on the first mismatch. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "libsecp256k1-config.h"
+/* The safegcd inverse never squares, so secp256k1_scalar_sqr_512 is only
+ * compiled with the addition chain inverse. Use that one here so that the
+ * squaring code is tested too; the inverse is then checked as a bonus. */
+#undef USE_SCALAR_INV_SAFEGCD
+#define USE_SCALAR_INV_BUILTIN 1
+#include "secp256k1.c"
+
+#if !defined(USE_SCALAR_4X64)
+#error "test_secp256k1_scalar.c tests the 4x64 scalar implementation"
+#endif
+
+/* The group order, least significant 32-bit limb first. */
+static const uint32_t test_order[8] = {
+    0xD0364141UL, 0xBFD25E8CUL, 0xAF48A03BUL, 0xBAAEDCE6UL,
+    0xFFFFFFFEUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL
+};
+
+static uint64_t test_rng_state;
+
+/* splitmix64; any seed gives a full period. */
+static uint64_t test_rand64(void) {
+    uint64_t z = (test_rng_state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void test_split(uint32_t *r, const uint64_t *a, int n) {
+    int i;
+    for (i = 0; i < n; i++) {
+        r[2 * i] = (uint32_t)a[i];
+        r[2 * i + 1] = (uint32_t)(a[i] >> 32);
+    }
+}
+
+/* r[16] = a[8] * b[8], schoolbook. */
+static void test_ref_mul(uint32_t *r, const uint32_t *a, const uint32_t *b) {
+    int i, j;
+    memset(r, 0, 16 * sizeof(r[0]));
+    for (i = 0; i < 8; i++) {
+        uint64_t c = 0;
+        for (j = 0; j < 8; j++) {
+            c += (uint64_t)a[i] * b[j] + r[i + j];
+            r[i + j] = (uint32_t)c;
+            c >>= 32;
+        }
+        r[i + 8] = (uint32_t)c;
+    }
+}
+
+/* r[8] = l[16] mod n, one bit at a time. */
+static void test_ref_mod(uint32_t *r, const uint32_t *l) {
+    uint32_t t[9];
+    int bit, i;
+    memset(t, 0, sizeof(t));
+    for (bit = 511; bit >= 0; bit--) {
+        uint64_t c;
+        int ge = 1;
+        /* t = 2t + bit; t < 2n fits in 257 bits. */
+        for (i = 8; i > 0; i--) {
+            t[i] = (t[i] << 1) | (t[i - 1] >> 31);
+        }
+        t[0] = (t[0] << 1) | ((l[bit / 32] >> (bit % 32)) & 1);
+        if (t[8] == 0) {
+            for (i = 7; i >= 0; i--) {
+                if (t[i] != test_order[i]) {
+                    ge = t[i] > test_order[i];
+                    break;
+                }
+            }
+        }
+        if (ge) {
+            c = 0;
+            for (i = 0; i < 8; i++) {
+                uint64_t d = (uint64_t)t[i] - test_order[i] - c;
+                t[i] = (uint32_t)d;
+                c = (d >> 32) & 1;
+            }
+            t[8] -= (uint32_t)c;
+        }
+    }
+    memcpy(r, t, 8 * sizeof(r[0]));
+}
+
+static void test_random_scalar(secp256k1_scalar *r) {
+    unsigned char b32[32];
+    int i;
+    for (i = 0; i < 4; i++) {
+        uint64_t v = test_rand64();
+        int k;
+        for (k = 0; k < 8; k++) {
+            b32[i * 8 + k] = (unsigned char)(v >> (8 * k));
+        }
+    }
+    /* Mostly uniform, sometimes with long runs of set or clear bits, where
+     * the carry chains are most likely to go wrong. */
+    switch (test_rand64() % 4) {
+    case 0: memset(b32, 0xFF, test_rand64() % 32); break;
+    case 1: memset(b32 + 16, 0, test_rand64() % 16); break;
+    default: break;
+    }
+    secp256k1_scalar_set_b32(r, b32, NULL);
+}
+
+static int test_fail(const char *what, const secp256k1_scalar *a, const secp256k1_scalar *b) {
+    unsigned char a32[32], b32[32];
+    int i;
+    secp256k1_scalar_get_b32(a32, a);
+    secp256k1_scalar_get_b32(b32, b);
+    fprintf(stderr, "mismatch in %s\n  a = ", what);
+    for (i = 0; i < 32; i++) fprintf(stderr, "%02x", a32[i]);
+    fprintf(stderr, "\n  b = ");
+    for (i = 0; i < 32; i++) fprintf(stderr, "%02x", b32[i]);
+    fprintf(stderr, "\n");
+    return 1;
+}
+
+static int test_pair(const secp256k1_scalar *a, const secp256k1_scalar *b) {
+    uint64_t l[8], l2[8];
+    uint32_t a32[8], b32[8], want[16], got[16], want_mod[8], got_mod[8];
+    secp256k1_scalar r, r2, one;
+
+    test_split(a32, a->d, 4);
+    test_split(b32, b->d, 4);
+
+    test_ref_mul(want, a32, b32);
+    secp256k1_scalar_mul_512(l, a, b);
+    test_split(got, l, 8);
+    if (memcmp(want, got, sizeof(want)) != 0) return test_fail("secp256k1_scalar_mul_512", a, b);
+
+    test_ref_mod(want_mod, want);
+    secp256k1_scalar_reduce_512(&r, l);
+    test_split(got_mod, r.d, 4);
+    if (memcmp(want_mod, got_mod, sizeof(want_mod)) != 0) return test_fail("secp256k1_scalar_reduce_512", a, b);
+
+    test_ref_mul(want, a32, a32);
+    secp256k1_scalar_sqr_512(l2, a);
+    test_split(got, l2, 8);
+    if (memcmp(want, got, sizeof(want)) != 0) return test_fail("secp256k1_scalar_sqr_512", a, a);
+
+    secp256k1_scalar_mul(&r, a, a);
+    secp256k1_scalar_sqr(&r2, a);
+    if (!secp256k1_scalar_eq(&r, &r2)) return test_fail("secp256k1_scalar_sqr", a, a);
+
+    /* Any 512-bit input must reduce, not just products of scalars. */
+    l[0] ^= b->d[0]; l[3] ^= a->d[3]; l[5] ^= b->d[2]; l[7] ^= a->d[1];
+    test_split(got, l, 8);
+    test_ref_mod(want_mod, got);
+    secp256k1_scalar_reduce_512(&r, l);
+    test_split(got_mod, r.d, 4);
+    if (memcmp(want_mod, got_mod, sizeof(want_mod)) != 0) return test_fail("secp256k1_scalar_reduce_512 (512-bit)", a, b);
+
+    if (!secp256k1_scalar_is_zero(a)) {
+        secp256k1_scalar_inverse(&r, a);
+        secp256k1_scalar_mul(&r, &r, a);
+        secp256k1_scalar_set_int(&one, 1);
+        if (!secp256k1_scalar_eq(&r, &one)) return test_fail("secp256k1_scalar_inverse", a, a);
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    static const unsigned char edges[][32] = {
+        {0},
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+         0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+         0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2},
+        /* 2^128 - 1 */
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+         0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+        /* (n - 1) / 2 */
+        {0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+         0x5D, 0x57, 0x6E, 0x73, 0x57, 0xA4, 0x50, 0x1D, 0xDF, 0xE9, 0x2F, 0x46, 0x68, 0x1B, 0x20, 0xA0},
+        /* n - 2 */
+        {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+         0xBA, 0xAE, 0xDC, 0xE6, 0xAF, 0x48, 0xA0, 0x3B, 0xBF, 0xD2, 0x5E, 0x8C, 0xD0, 0x36, 0x41, 0x3F},
+        /* n - 1 */
+        {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+         0xBA, 0xAE, 0xDC, 0xE6, 0xAF, 0x48, 0xA0, 0x3B, 0xBF, 0xD2, 0x5E, 0x8C, 0xD0, 0x36, 0x41, 0x40}
+    };
+    const size_t nedges = sizeof(edges) / sizeof(edges[0]);
+    long iters = 100000, i;
+    uint64_t seed = (uint64_t)time(NULL);
+    size_t j, k;
+
+    if (argc > 1) iters = atol(argv[1]);
+    if (argc > 2) seed = strtoull(argv[2], NULL, 0);
+    test_rng_state = seed;
+
+#if defined(USE_ASM_AARCH64)
+    printf("scalar mul/sqr/reduce: AArch64 assembly\n");
+#elif defined(USE_ASM_X86_64)
+    printf("scalar mul/sqr/reduce: x86_64 assembly\n");
+#else
+    printf("scalar mul/sqr/reduce: C\n");
+#endif
+    printf("seed %llu, %ld iterations\n", (unsigned long long)seed, iters);
+
+    for (j = 0; j < nedges; j++) {
+        for (k = 0; k < nedges; k++) {
+            secp256k1_scalar a, b;
+            secp256k1_scalar_set_b32(&a, edges[j], NULL);
+            secp256k1_scalar_set_b32(&b, edges[k], NULL);
+            if (test_pair(&a, &b)) return 1;
+        }
+    }
+    for (i = 0; i < iters; i++) {
+        secp256k1_scalar a, b;
+        test_random_scalar(&a);
+        test_random_scalar(&b);
+        if (test_pair(&a, &b)) return 1;
+    }
+    printf("ok\n");
+    return 0;
+}